@@ -0,0 +1,222 @@
+/**
+ * @file benchmarks.cpp
+ *
+ * @brief Microbenchmarks for the simulation and asset hot paths.
+ *
+ * Build with "-DBUILD_BENCHMARKS=ON" and run the "benchmarks" executable directly; results print to stdout. Like the headless benchmark, no window is created: the track is built from default-constructed textures, which are only dereferenced when drawing.
+ *
+ * @note Run on an idle machine and pin the CPU frequency if possible; the numbers are meant for before/after comparisons of optimization work, not absolute truth.
+ */
+
+#include <array>    // for std::array
+#include <cmath>    // for std::atan2, std::cos, std::hypot, std::remainder, std::sin
+#include <cstddef>  // for std::size_t
+#include <numbers>  // for std::numbers
+#include <vector>   // for std::vector
+
+#include <nanobench.h>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "assets/textures.hpp"
+#include "core/math.hpp"
+#include "core/world.hpp"
+#include "game/entities.hpp"
+#include "rng.hpp"
+
+namespace {
+
+/**
+ * @brief Fixed RNG seed, so every run generates the same track layouts.
+ */
+constexpr unsigned benchmark_seed = 12345;
+
+/**
+ * @brief Fixed physics timestep matching the game's 120 Hz simulation rate, in seconds.
+ */
+constexpr float fixed_dt = 1.0f / 120.0f;
+
+/**
+ * @brief Build the placeholder track textures; never dereferenced, because the benchmarks never draw.
+ *
+ * @param placeholder_texture Default-constructed texture shared by all tile regions; must outlive the returned struct.
+ *
+ * @return Textures struct usable for building a Track without a GPU session.
+ */
+[[nodiscard]] core::world::Track::Textures make_placeholder_tiles(const sf::Texture &placeholder_texture)
+{
+    return {
+        .top_left = {placeholder_texture, {}},
+        .top_right = {placeholder_texture, {}},
+        .bottom_right = {placeholder_texture, {}},
+        .bottom_left = {placeholder_texture, {}},
+        .vertical = {placeholder_texture, {}},
+        .horizontal = {placeholder_texture, {}},
+        .horizontal_finish = {placeholder_texture, {}},
+    };
+}
+
+}  // namespace
+
+/**
+ * @brief Entry-point of the microbenchmark suite.
+ *
+ * @return EXIT_SUCCESS after all benchmarks have run.
+ */
+int main()
+{
+    const sf::Texture placeholder_texture;
+    const core::world::Track::Textures tiles = make_placeholder_tiles(placeholder_texture);
+
+    ankerl::nanobench::Bench bench;
+    bench.warmup(3).relative(false);
+
+    // Track generation cost at several grid sizes; this is what the player pays when changing track settings
+    struct NamedConfig final {
+        const char *name;
+        core::world::TrackConfig config;
+    };
+    const std::array<NamedConfig, 3> build_configs = {{
+        {"Track build 5x5", {.horizontal_count = 5, .vertical_count = 5}},
+        {"Track build 7x7 (default)", {}},
+        {"Track build 11x11", {.horizontal_count = 11, .vertical_count = 11}},
+    }};
+    for (const NamedConfig &named : build_configs) {
+        bench.run(named.name, [&]() {
+            core::rng::Pcg32 rng{benchmark_seed};
+            const core::world::Track track{tiles, rng, named.config};
+            ankerl::nanobench::doNotOptimizeAway(track.get_waypoints().size());
+        });
+    }
+
+    // Boundary queries; called once per car per physics tick, for both the on-track and off-track outcome
+    core::rng::Pcg32 rng{benchmark_seed};
+    const core::world::Track track{tiles, rng};
+    const sf::Vector2f on_track_point = track.get_finish_position();
+    constexpr sf::Vector2f off_track_point = {-1.0e6f, -1.0e6f};
+    bench.run("Track::is_on_track (hit)", [&]() {
+        ankerl::nanobench::doNotOptimizeAway(track.is_on_track(on_track_point));
+    });
+    bench.run("Track::is_on_track (miss)", [&]() {
+        ankerl::nanobench::doNotOptimizeAway(track.is_on_track(off_track_point));
+    });
+
+    // Full physics tick for a field of cars, with and without the AI steering logic
+    constexpr std::size_t benchmark_car_count = 16;
+    {
+        game::entities::CarPhysicsSystem car_physics{rng, track};
+        for (std::size_t i = 0; i < benchmark_car_count; ++i) {
+            static_cast<void>(car_physics.create_car(game::entities::CarControlMode::AI));
+        }
+        bench.run("CarPhysicsSystem::update, 16 AI cars", [&]() {
+            car_physics.update(fixed_dt);
+        });
+    }
+    {
+        game::entities::CarPhysicsSystem car_physics{rng, track};
+        for (std::size_t i = 0; i < benchmark_car_count; ++i) {
+            static_cast<void>(car_physics.create_car(game::entities::CarControlMode::Player));
+        }
+        bench.run("CarPhysicsSystem::update, 16 player cars (AI off)", [&]() {
+            car_physics.update(fixed_dt);
+        });
+    }
+
+    // Instanced vertex build for a stress-mode grid; this is the per-frame CPU cost of the batched draw path
+    {
+        game::entities::CarPhysicsSystem car_physics{rng, track};
+        constexpr std::size_t stress_car_count = 128;
+        std::vector<sf::Color> tints;
+        for (std::size_t i = 0; i < stress_car_count; ++i) {
+            static_cast<void>(car_physics.create_car(game::entities::CarControlMode::AI));
+            tints.push_back(sf::Color::White);
+        }
+        car_physics.update(fixed_dt);
+        const sf::Texture placeholder_car_texture;
+        game::entities::CarBatchRenderer car_batch{placeholder_car_texture, {{0, 0}, {131, 71}}};
+        bench.run("CarBatchRenderer::build, 128 cars", [&]() {
+            car_batch.build(car_physics, tints, 0.5f);
+            ankerl::nanobench::doNotOptimizeAway(car_batch.get_body_vertices().size());
+        });
+    }
+
+    // Transcendental kernels against their libm counterparts; the physics and AI code use the fast variants, so the libm rows only exist to show the margin on this architecture
+    {
+        // Sweep the same pseudo-random angles and vectors through both variants, so neither side wins on branch prediction alone
+        core::rng::Pcg32 math_rng{benchmark_seed};
+        constexpr std::size_t sample_count = 256;
+        std::array<float, sample_count> angles{};
+        std::array<sf::Vector2f, sample_count> vectors{};
+        for (std::size_t i = 0; i < sample_count; ++i) {
+            angles[i] = math_rng.uniform(-std::numbers::pi_v<float>, std::numbers::pi_v<float>);
+            vectors[i] = {math_rng.uniform(-500.0f, 500.0f), math_rng.uniform(-500.0f, 500.0f)};
+        }
+
+        bench.run("std::sin + std::cos, 256 angles", [&]() {
+            float sum = 0.0f;
+            for (const float angle : angles) {
+                sum += std::sin(angle) + std::cos(angle);
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+        bench.run("math::fast_sincos, 256 angles", [&]() {
+            float sum = 0.0f;
+            for (const float angle : angles) {
+                const core::math::SinCos result = core::math::fast_sincos(angle);
+                sum += result.sin + result.cos;
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+        bench.run("std::atan2, 256 vectors", [&]() {
+            float sum = 0.0f;
+            for (const sf::Vector2f &vector : vectors) {
+                sum += std::atan2(vector.y, vector.x);
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+        bench.run("math::fast_atan2, 256 vectors", [&]() {
+            float sum = 0.0f;
+            for (const sf::Vector2f &vector : vectors) {
+                sum += core::math::fast_atan2(vector.y, vector.x);
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+        bench.run("std::hypot, 256 vectors", [&]() {
+            float sum = 0.0f;
+            for (const sf::Vector2f &vector : vectors) {
+                sum += std::hypot(vector.x, vector.y);
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+        bench.run("math::fast_length, 256 vectors", [&]() {
+            float sum = 0.0f;
+            for (const sf::Vector2f &vector : vectors) {
+                sum += core::math::fast_length(vector.x, vector.y);
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+        bench.run("std::remainder 2pi, 256 angles", [&]() {
+            float sum = 0.0f;
+            for (const float angle : angles) {
+                sum += std::remainder(angle * 3.0f, 2.0f * std::numbers::pi_v<float>);
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+        bench.run("math::wrap_angle, 256 angles", [&]() {
+            float sum = 0.0f;
+            for (const float angle : angles) {
+                sum += core::math::wrap_angle(angle * 3.0f);
+            }
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+    }
+
+    // Atlas region lookup; a plain array access that does not depend on any textures being loaded
+    const assets::textures::TextureManager texture_manager;
+    bench.run("TextureManager::get_region", [&]() {
+        ankerl::nanobench::doNotOptimizeAway(texture_manager.get_region(assets::textures::TextureId::Car).rect.size.x);
+    });
+
+    return 0;
+}
@@ -11,8 +11,8 @@ function(fetch_and_link_external_dependencies target)
   set(FETCHCONTENT_BASE_DIR "${CMAKE_SOURCE_DIR}/deps")
 
   # SYSTEM is used to prevent applying compile flags to the dependencies
-  # Do not build unnecessary SFML modules
-  set(SFML_BUILD_NETWORK OFF)
+  # The network module is needed for the LAN lockstep sessions
+  set(SFML_BUILD_NETWORK ON)
   # Prevent SFML v3.0.1 from using the system locale (C locale when using VSCode on macOS)
   # if(NOT DEFINED ENV{LC_ALL})
   set(ENV{LC_ALL} "en_US.UTF-8")  # Always set, so it will work the first time instead of second time
@@ -69,6 +69,7 @@ function(fetch_and_link_external_dependencies target)
   target_link_libraries(${target} PUBLIC
     ImGui-SFML::ImGui-SFML  # ImGui-SFML already includes both ImGui and SFML
     SFML::Audio             # SFML audio for sound effects and music
+    SFML::Network           # SFML network for LAN lockstep sessions
     spdlog::spdlog
     tomlplusplus::tomlplusplus
   )
@@ -85,7 +86,32 @@ function(fetch_and_link_external_dependencies target)
     target_link_libraries(${target} PUBLIC SFML::Main)
   endif()
 
-  message(STATUS "Linked dependencies 'ImGui-SFML::ImGui-SFML', 'SFML::Audio', 'spdlog::spdlog', and 'tomlplusplus::tomlplusplus' to target '${target}'.")
+  message(STATUS "Linked dependencies 'ImGui-SFML::ImGui-SFML', 'SFML::Audio', 'SFML::Network', 'spdlog::spdlog', and 'tomlplusplus::tomlplusplus' to target '${target}'.")
+endfunction()
+
+# Download and link benchmark dependencies (microbenchmarking)
+function(fetch_and_link_external_benchmark_dependencies target)
+  if(NOT TARGET ${target})
+    message(FATAL_ERROR "Target '${target}' does not exist. Cannot fetch and link benchmark dependencies.")
+  endif()
+
+  set(FETCHCONTENT_UPDATES_DISCONNECTED ON)
+  set(FETCHCONTENT_QUIET OFF)
+  set(FETCHCONTENT_BASE_DIR "${CMAKE_SOURCE_DIR}/deps")
+
+  FetchContent_Declare(
+    nanobench
+    URL https://github.com/martinus/nanobench/archive/refs/tags/v4.3.11.tar.gz
+    DOWNLOAD_EXTRACT_TIMESTAMP TRUE
+    EXCLUDE_FROM_ALL
+    SYSTEM
+  )
+  FetchContent_MakeAvailable(nanobench)
+
+  # Link benchmark dependencies to target
+  target_link_libraries(${target} PRIVATE nanobench)
+
+  message(STATUS "Linked benchmark dependency 'nanobench' to target '${target}'.")
 endfunction()
 
 # Download and link test dependencies (automated testing)
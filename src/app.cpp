@@ -2,24 +2,32 @@
  * @file app.cpp
  */
 
-#include <algorithm>  // for std::clamp, std::max
-#include <array>      // for std::array
-#include <cstddef>    // for std::size_t
-#include <format>     // for std::format
-#include <random>     // for std::mt19937, std::random_device
-#include <string>     // for std::string
-#include <vector>     // for std::vector
+#include <algorithm>   // for std::clamp, std::max, std::min
+#include <array>       // for std::array
+#include <chrono>      // for std::chrono
+#include <cstddef>     // for std::size_t
+#include <cstdint>     // for std::uint64_t
+#include <filesystem>  // for std::filesystem
+#include <format>      // for std::format
+#include <future>      // for std::async, std::future, std::launch
+#include <optional>    // for std::optional
+#include <random>      // for std::random_device
+#include <string>      // for std::string
+#include <vector>      // for std::vector
 
 #include <imgui.h>
 #include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Joystick.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <spdlog/spdlog.h>
 
 #include "app.hpp"
+#include "arena.hpp"
 #include "assets/builder.hpp"
 #include "assets/sounds.hpp"
 #include "assets/textures.hpp"
@@ -28,34 +36,67 @@
 #include "core/imgui_sfml_ctx.hpp"
 #include "core/input.hpp"
 #include "core/io.hpp"
+#include "core/jobs.hpp"
+#include "core/profiler.hpp"
 #include "core/sfx.hpp"
 #include "core/states.hpp"
 #include "core/widgets.hpp"
 #include "core/world.hpp"
 #include "game/entities.hpp"
+#include "game/ghost.hpp"
+#include "game/net.hpp"
+#include "game/particles.hpp"
 #include "generated.hpp"
+#include "memory.hpp"
+#include "rng.hpp"
 #include "settings.hpp"
 
 namespace app {
 
 void run()
 {
+    // Time the cold-start milestones below; each mark is logged as it completes and the whole timeline is appended to the startup report once the loop is about to start
+    core::profiler::StartupTimeline startup_timeline;
+
     // Define initial game state
     core::states::GameState current_state = core::states::GameState::Menu;
 
-    // Create a RAII context to load and save settings on scope exit
+    // Idle power governor state: menus and the pause screen are near-static, so once no input has arrived for a short grace period, whole UI frames are skipped and the previous frame stays on display
+    // The grace period lets ImGui's hover fades and nav highlights finish animating before frames start being dropped
+    constexpr float ui_idle_grace_seconds = 0.25f;
+    float seconds_since_last_event = 0.0f;
+    bool ui_frame_skipped = false;
+
+    // Latency measurement state: the arrival time of the most recent input event, consumed when the frame that processed it is presented
+    auto last_input_event_time = std::chrono::steady_clock::now();
+    bool input_event_pending = false;
+
+    // Kick off asset decoding in the background; it overlaps with config loading and window creation below
+    // Each builder fans the actual decoding out across its own worker threads, so cold start is bounded by the slowest single asset, not the sum of all of them
+    std::future<assets::textures::TextureManager> textures_future = std::async(std::launch::async, &assets::builder::build_texture_manager);
+    std::future<assets::sounds::SoundManager> sounds_future = std::async(std::launch::async, &assets::builder::build_sound_manager);
+
+    // Create a RAII context to load and save settings
     // This uses platform-specific APIs (e.g., POSIX, WinAPI) to get platform-appropriate paths
     // Then, it loads the configuration from a TOML file, creating default values if the file is missing
     // And it sets values in "settings.hpp"
-    // These values can be modified at runtime and on scope exit, the configuration is saved to the TOML file
-    const core::io::ConfigContext config_context;
+    // These values can be modified at runtime; a background thread autosaves them periodically (atomically, so a power cut cannot truncate the file), with a final flush on scope exit
+    // Not "const" because the autosave thread mutates the dirty-tracking state
+    core::io::ConfigContext config_context;
+    startup_timeline.mark("config");
 
     // Create SFML window based on current settings from "settings.hpp"
     // If they were modified by ConfigContext, the window will indeed use these new settings
     core::backend::Window window;
+    startup_timeline.mark("window");
 
     // Create RAII context with theme and no INI file
     core::imgui_sfml_ctx::ImGuiContext imgui_context{window.raw()};
+    startup_timeline.mark("imgui");
+
+    // Optionally renders the world pass at a reduced resolution and upscales it; UI and ImGui stay native
+    core::backend::ResolutionScaler resolution_scaler;
+    core::backend::QualityGovernor quality_governor;  // Steps effect density and AA behind the scaler when "Auto Quality" is enabled
 
     // Get window size, update during game loop
     sf::Vector2u window_size_u = window.raw().getSize();
@@ -64,77 +105,192 @@ void run()
     // Setup main camera zoom factor
     float camera_zoom_factor = 2.5f;
 
-    // Create random number generator
-    std::mt19937 rng{std::random_device{}()};
+    // Seed once, then hand each subsystem its own cheap RNG stream; track generation and car physics no longer contend on (or perturb) a shared generator
+    // Deterministic mode swaps the entropy seed for a fixed one, which makes track layouts and car physics reproducible run to run (the physics already steps at a fixed timestep, and every car derives its own stream from the physics stream)
+    const unsigned rng_seed = settings::current::deterministic ? settings::constants::deterministic_seed : std::random_device{}();
+    // An explicit track seed (a shareable "track code" from the settings UI) overrides the session seed for the track stream only, so players can reproduce each other's layouts without forcing full determinism
+    core::rng::Pcg32 track_rng{settings::current::track_seed != 0 ? static_cast<unsigned>(settings::current::track_seed) : rng_seed, 0};
+    core::rng::Pcg32 physics_rng{rng_seed, 1};
+
+    // Create job system for fanning per-car updates across worker threads
+    core::jobs::JobSystem job_system;
 
-    // Setup texture manager and load textures
+    // Collect the texture manager decoded in the background, then pack the atlas here so the GPU upload happens on the main thread, which owns the GL context
     // Note: This cannot be "static", because the destructor for static objects is called after "main()" has finished
-    const assets::textures::TextureManager textures = assets::builder::build_texture_manager();
+    assets::textures::TextureManager textures = textures_future.get();
+    textures.pack();
+    startup_timeline.mark("textures");
 
-    // Setup sound manager and load sounds
+    // Collect the sound manager decoded in the background
     // Note: This cannot be "static", because the destructor for static objects is called after "main()" has finished
-    const assets::sounds::SoundManager sounds = assets::builder::build_sound_manager();
+    const assets::sounds::SoundManager sounds = sounds_future.get();
+    startup_timeline.mark("sounds");
 
-    // Create race track
+    // Convert an atlas region from the texture manager into the track's region type
+    const auto track_region = [&textures](const assets::textures::TextureId id) -> core::world::Track::TextureRegion {
+        const auto region = textures.get_region(id);
+        return {.texture = *region.texture, .rect = region.rect};
+    };
+
+    // Create race track; all tile regions come from the same atlas, so the whole track renders with a single texture bind
+    // The binary layout cache lets a restart with an unchanged seed and config bulk-load the finished track (tiles, collision data, waypoints, distance field) instead of regenerating it
     core::world::Track race_track(
-        {.top_left = textures.get("top_left"),
-         .top_right = textures.get("top_right"),
-         .bottom_right = textures.get("bottom_right"),
-         .bottom_left = textures.get("bottom_left"),
-         .vertical = textures.get("vertical"),
-         .horizontal = textures.get("horizontal"),
-         .horizontal_finish = textures.get("horizontal_finish")},
-        rng);
-
-    // Create cars
-    game::entities::Car player_car(textures.get("car_black"), rng, race_track, game::entities::CarControlMode::Player);
-    std::array<game::entities::Car, 4> ai_cars = {
-        game::entities::Car(textures.get("car_blue"), rng, race_track, game::entities::CarControlMode::AI),
-        game::entities::Car(textures.get("car_green"), rng, race_track, game::entities::CarControlMode::AI),
-        game::entities::Car(textures.get("car_red"), rng, race_track, game::entities::CarControlMode::AI),
-        game::entities::Car(textures.get("car_yellow"), rng, race_track, game::entities::CarControlMode::AI)};
-
-    // Create gamepad instance
-    core::input::Gamepad gamepad;
+        {.top_left = track_region(assets::textures::TextureId::TopLeft),
+         .top_right = track_region(assets::textures::TextureId::TopRight),
+         .bottom_right = track_region(assets::textures::TextureId::BottomRight),
+         .bottom_left = track_region(assets::textures::TextureId::BottomLeft),
+         .vertical = track_region(assets::textures::TextureId::Vertical),
+         .horizontal = track_region(assets::textures::TextureId::Horizontal),
+         .horizontal_finish = track_region(assets::textures::TextureId::HorizontalFinish)},
+        track_rng,
+        core::world::TrackConfig{},
+        core::io::get_application_storage_location(generated::PROJECT_NAME) / "track.bin");
+    startup_timeline.mark("track");
+
+    // Create the physics system that owns all car state in parallel arrays; it hands each car its own RNG stream so their updates can run in parallel
+    game::entities::CarPhysicsSystem car_physics(physics_rng, race_track);
+
+    // Persistent skid mark layer: settled tire marks are stamped into it once and persist for the whole session at the cost of a single quad per frame
+    // Rebuilt whenever the track layout (and thus its bounds) changes
+    game::entities::SkidMarkLayer skid_marks;
+    skid_marks.rebuild(race_track.get_world_bounds());
+
+    // Pooled particle effects (drift smoke, collision sparks) fed from the per-car physics events; the whole pool renders as one untextured draw call
+    // Stream 2 keeps the purely visual emission jitter out of the track (0) and physics (1) streams, so toggling particles never perturbs a deterministic run
+    game::particles::ParticleSystem particle_system{core::rng::Pcg32{rng_seed, 2}};
+
+    // Create car handles from the single shared car region; each registers itself with the physics system and owns only its visual state
+    // Every car draws the same grayscale base texture and differs only in its vertex-color tint, so the whole grid renders without a single texture bind change and the binary embeds one car image instead of five
+    // The tints were sampled from the paint of the former per-color textures; the AI colors cycle through the list as the grid grows
+    const auto car_region = textures.get_region(assets::textures::TextureId::Car);
+    static constexpr sf::Color player_car_tint = {94, 91, 91};
+    static constexpr std::array<sf::Color, 4> ai_car_tints = {
+        sf::Color{49, 154, 215},   // Blue
+        sf::Color{56, 197, 115},   // Green
+        sf::Color{239, 112, 28},   // Red
+        sf::Color{255, 206, 12}};  // Yellow
+    static constexpr std::array<const char *, 4> ai_color_names = {"Blue", "Green", "Red", "Yellow"};
+
+    game::entities::Car player_car(*car_region.texture, car_region.rect, player_car_tint, car_physics, game::entities::CarControlMode::Player);
+
+    // Extra player cars for split-screen (players 2-4); they occupy the physics slots right after player 1, before the AI grid
+    std::vector<game::entities::Car> extra_player_cars;
+
+    // AI cars and their display names; sized from the config now and resized by the settings slider later
+    std::vector<game::entities::Car> ai_cars;
+    std::vector<std::string> vehicle_names = {"Player"};
+
+    // Per-car tints indexed by physics slot, maintained in lockstep with "vehicle_names"; the instanced renderer reads them when it batches the grid
+    std::vector<sf::Color> car_tints = {player_car_tint};
+
+    // Function to grow or shrink the AI grid to match "settings::current::ai_car_count"
+    // Only the last physics slot can be removed, so shrinking pops handles from the back; indices of the remaining cars stay valid
+    const auto apply_ai_car_count = [&car_physics, &ai_cars, &vehicle_names, &car_tints, &car_region]() {
+        const std::size_t desired_count = static_cast<std::size_t>(std::clamp(settings::current::ai_car_count, settings::constants::min_ai_cars, settings::constants::max_ai_cars));
+        while (ai_cars.size() > desired_count) {
+            ai_cars.pop_back();
+            vehicle_names.pop_back();
+            car_tints.pop_back();
+            car_physics.remove_last_car();
+        }
+        while (ai_cars.size() < desired_count) {
+            ai_cars.emplace_back(*car_region.texture, car_region.rect, ai_car_tints[ai_cars.size() % ai_car_tints.size()], car_physics, game::entities::CarControlMode::AI);
+            vehicle_names.emplace_back(std::format("{} {}", ai_color_names[(ai_cars.size() - 1) % ai_color_names.size()], ai_cars.size()));
+            car_tints.push_back(ai_car_tints[(ai_cars.size() - 1) % ai_car_tints.size()]);
+        }
+    };
 
-    // Function to reset the cars to their spawn point and reset their speed
-    const auto reset_cars = [&player_car, &ai_cars]() {
-        // Reset positions of all cars to spawn point
-        player_car.reset();
-        for (auto &ai_car : ai_cars) {
-            ai_car.reset();
+    // Function to grow or shrink the extra player cars to match "settings::current::player_count"
+    // The physics slots are a stack, so the AI grid sitting behind the players is popped off first and regrown afterwards; the simulation itself is shared, only the input and render plumbing is per player
+    const auto apply_player_count = [&car_physics, &extra_player_cars, &ai_cars, &vehicle_names, &car_tints, &car_region, &apply_ai_car_count]() {
+        const std::size_t desired_extra_count = static_cast<std::size_t>(std::clamp(settings::current::player_count, settings::constants::min_players, settings::constants::max_players)) - 1;
+        if (extra_player_cars.size() != desired_extra_count) {
+            while (!ai_cars.empty()) {
+                ai_cars.pop_back();
+                vehicle_names.pop_back();
+                car_tints.pop_back();
+                car_physics.remove_last_car();
+            }
+            while (extra_player_cars.size() > desired_extra_count) {
+                extra_player_cars.pop_back();
+                vehicle_names.pop_back();
+                car_tints.pop_back();
+                car_physics.remove_last_car();
+            }
+            while (extra_player_cars.size() < desired_extra_count) {
+                extra_player_cars.emplace_back(*car_region.texture, car_region.rect, player_car_tint, car_physics, game::entities::CarControlMode::Player);
+                vehicle_names.emplace_back(std::format("Player {}", extra_player_cars.size() + 1));
+                car_tints.push_back(player_car_tint);
+            }
         }
+        apply_ai_car_count();
     };
+    apply_player_count();
 
-    // Shared vehicle names for both leaderboard and combo box
-    static constexpr std::array<const char *, 5> vehicle_names = {"Player", "Blue", "Green", "Red", "Yellow"};
+    // Ghost replay: the recorder samples the player car into a ring buffer every fixed update, and the ghost car plays the persisted recording back as a translucent overlay
+    // The recording survives power cycles; F10 saves the current driving window and immediately becomes the new ghost
+    const std::filesystem::path ghost_file_path = core::io::get_application_storage_location(generated::PROJECT_NAME) / "ghost.bin";
+    game::ghost::GhostRecorder ghost_recorder;
+    game::ghost::GhostCar ghost_car(*car_region.texture, car_region.rect, player_car_tint);
+    ghost_car.set_recording(game::ghost::GhostRecorder::load(ghost_file_path));
 
-    const auto collect_leaderboard_data = [&player_car, &ai_cars]() -> std::vector<core::widgets::LeaderboardEntry> {
-        std::vector<core::widgets::LeaderboardEntry> entries;
-        entries.reserve(5);  // Reserve space for player + 4 AI cars
+    // Create gamepad instance for player 1
+    core::input::Gamepad gamepad;
 
-        // Add player car
-        entries.emplace_back(core::widgets::LeaderboardEntry{
-            .car_name = vehicle_names.at(0),
-            .drift_score = player_car.get_state().drift_score,
-            .is_player = true});
+    // One gamepad per potential split-screen player; players 2-4 are gamepad-only, the keyboard stays bound to player 1
+    std::array<core::input::Gamepad, 3> extra_gamepads = {core::input::Gamepad{1}, core::input::Gamepad{2}, core::input::Gamepad{3}};
 
-        // Add AI cars using shared names array
+    // Function to reset the cars: player 1 returns to the spawn point, the extra players and the AI grid are spread evenly along the waypoint line
+    const auto reset_cars = [&player_car, &extra_player_cars, &ai_cars, &race_track, &ghost_recorder]() {
+        player_car.reset();
+        // Teleporting the player would put a discontinuity into the delta-encoded recording, so start a fresh window
+        ghost_recorder.clear();
+        const std::size_t waypoint_count = race_track.get_waypoints().size();
+        const std::size_t spread_count = extra_player_cars.size() + ai_cars.size();
+        for (std::size_t i = 0; i < extra_player_cars.size(); ++i) {
+            // Skip slot 0, so the densest grids still leave player 1's spawn point clear
+            extra_player_cars[i].place_at_waypoint((i + 1) * waypoint_count / (spread_count + 1));
+        }
         for (std::size_t i = 0; i < ai_cars.size(); ++i) {
+            ai_cars[i].place_at_waypoint((extra_player_cars.size() + i + 1) * waypoint_count / (spread_count + 1));
+        }
+    };
+    reset_cars();
+    startup_timeline.mark("entities");
+
+    // Frame-scoped bump allocator for transient UI data; everything allocated from it dies together when the arena is reset after display, so steady-state frames do no heap traffic for UI assembly
+    // 64 KiB fits the leaderboard and profiler rows of the largest stress-test grids with room to spare; exhaustion degrades to heap fallback, visible in the overflow counter
+    core::arena::FrameArena frame_arena{64 * 1024};
+
+    const auto collect_leaderboard_data = [&car_physics, &vehicle_names, &extra_player_cars, &frame_arena]() -> core::arena::FrameVector<core::widgets::LeaderboardEntry> {
+        core::arena::FrameVector<core::widgets::LeaderboardEntry> entries{core::arena::Allocator<core::widgets::LeaderboardEntry>{frame_arena}};
+
+        // Walk the standings maintained incrementally by the physics system; the entries are already in race order, so the widget displays them as-is without sorting
+        // The lowest car indices are the players (created first), and "vehicle_names" is indexed the same way as the physics slots
+        const std::vector<std::size_t> &standings = car_physics.get_standings();
+        entries.reserve(standings.size());
+        for (const std::size_t car_index : standings) {
+            const game::entities::CarState state = car_physics.get_state(car_index);
             entries.emplace_back(core::widgets::LeaderboardEntry{
-                .car_name = vehicle_names.at(i + 1),
-                .drift_score = ai_cars.at(i).get_state().drift_score,
-                .is_player = false});
+                .car_name = vehicle_names.at(car_index),
+                .lap = state.lap + 1,
+                .best_lap_time = state.best_lap_time,
+                .drift_score = state.drift_score,
+                .is_player = car_index <= extra_player_cars.size()});
         }
 
         return entries;
     };
 
     // Setup sound effects
-    core::sfx::EngineSound engine_sound{sounds.get("engine")};
-    core::sfx::TireScreechSound tire_screech_sound{sounds.get("tires")};
-    core::sfx::WallHitSound wall_hit_sound{sounds.get("hit")};
-    core::sfx::UiSound ui_sound{sounds.get("ok"), sounds.get("other")};
+    core::sfx::EngineMixer engine_mixer{sounds.get(assets::sounds::SoundId::Engine)};
+    core::sfx::TireScreechSound tire_screech_sound{sounds.get(assets::sounds::SoundId::Tires)};
+    // Shared pool of preallocated voices for all one-shot effects; rapid wall hits overlap on separate voices and UI feedback can never be stolen by collision noise
+    core::sfx::VoicePool voice_pool{sounds.get(assets::sounds::SoundId::Hit)};
+    core::sfx::WallHitSound wall_hit_sound{voice_pool, sounds.get(assets::sounds::SoundId::Hit)};
+    core::sfx::UiSound ui_sound{voice_pool, sounds.get(assets::sounds::SoundId::Ok), sounds.get(assets::sounds::SoundId::Other)};
+    // Streamed background music; tracks are optional files (e.g., "menu.ogg", "race.ogg") in the storage directory, so the binary stays free of multi-megabyte embedded audio and the game is simply silent when none are installed
+    core::sfx::MusicPlayer music_player{core::io::get_application_storage_location(generated::PROJECT_NAME) / "music"};
 
     // Full game reset: restore default track layout, reset cars, reset camera
     const auto reset_game = [&race_track, &reset_cars, &camera_zoom_factor]() {
@@ -143,6 +299,67 @@ void run()
         camera_zoom_factor = 2.5f;
     };
 
+    // LAN lockstep session: the host and joiner each simulate the full deterministic world and exchange only per-tick inputs; see "game/net.hpp"
+    game::net::LockstepSession lan_session;
+
+    // The networking module only defines the wire format, so translating between it and the physics input type is this layer's job; both structs carry the same four floats
+    const auto to_peer_input = [](const game::entities::CarInput &input) {
+        return game::net::PeerInput{.throttle = input.throttle, .brake = input.brake, .steering = input.steering, .handbrake = input.handbrake};
+    };
+    const auto to_car_input = [](const game::net::PeerInput &input) {
+        return game::entities::CarInput{.throttle = input.throttle, .brake = input.brake, .steering = input.steering, .handbrake = input.handbrake};
+    };
+
+    // Hash each car's position, velocity, and heading in car-index order; two machines running the same seeded simulation with the same input sequence produce the same hash at the same tick, so any physics divergence shows up as a mismatch
+    const auto hash_physics_state = [&car_physics]() {
+        game::net::StateHash hasher;
+        for (std::size_t car_index = 0; car_index < car_physics.size(); ++car_index) {
+            const game::entities::CarState state = car_physics.get_state(car_index);
+            hasher.mix(state.position.x);
+            hasher.mix(state.position.y);
+            hasher.mix(state.velocity.x);
+            hasher.mix(state.velocity.y);
+            hasher.mix(state.heading_radians);
+        }
+        return hasher.get();
+    };
+    // Peer address entry buffer for the LAN Race section; plain char storage because "ImGui::InputText" writes into it in place
+    std::array<char, 64> lan_address_input = {};
+    // True between the handshake and the seeded track swap landing; the lockstep must not tick while either machine still stands in its old world
+    bool lan_world_pending = false;
+
+    // Build the shared deterministic session from the handshake seed: both machines re-seed the track stream, rebuild the identical layout, and field the same two-car head-to-head grid
+    // The camera selection helper already falls back to player 1 when the grid shrinks underneath it, so no index clamping is needed here
+    const auto start_lan_race = [&track_rng, &race_track, &apply_player_count, &lan_world_pending, &current_state](const std::uint64_t session_seed) {
+        settings::current::track_seed = static_cast<int>(static_cast<unsigned>(session_seed));
+        settings::current::player_count = 2;
+        settings::current::ai_car_count = 0;
+        apply_player_count();
+        track_rng = core::rng::Pcg32{static_cast<unsigned>(session_seed), 0};
+        race_track.regenerate();
+        lan_world_pending = true;
+        current_state = core::states::GameState::Playing;
+        SPDLOG_INFO("Starting LAN race from session seed '{}'", session_seed);
+    };
+
+    // Frame profiler; the instrumented phases of the loop below report into it and the profiler overlay widget reads the aggregated statistics back out
+    core::profiler::FrameProfiler frame_profiler;
+
+    // Telemetry recorder keeping the last few seconds of phase timings and counters; every profiler sample is forwarded into its ring buffer, and the F9 hotkey below dumps it as a Chrome trace
+    core::profiler::TraceRecorder trace_recorder;
+    frame_profiler.set_recorder(&trace_recorder);
+
+    // Function to collect the current phase timings for the profiler overlay
+    const auto collect_profiler_data = [&frame_profiler, &frame_arena]() -> core::arena::FrameVector<core::widgets::ProfilerEntry> {
+        const auto &stats = frame_profiler.get_stats();
+        core::arena::FrameVector<core::widgets::ProfilerEntry> entries{core::arena::Allocator<core::widgets::ProfilerEntry>{frame_arena}};
+        entries.reserve(stats.size());
+        for (const auto &phase : stats) {
+            entries.emplace_back(core::widgets::ProfilerEntry{.phase_name = phase.name, .current_ms = phase.current_ms, .average_ms = phase.average_ms});
+        }
+        return entries;
+    };
+
     // Player input states
     struct
     {
@@ -150,7 +367,7 @@ void run()
     } key_states;
 
     // Handle key press events
-    const auto onKeyPressed = [&key_states, &current_state, &ui_sound](const sf::Event::KeyPressed &pressed) {
+    const auto onKeyPressed = [&key_states, &current_state, &ui_sound, &trace_recorder, &ghost_recorder, &ghost_car, &ghost_file_path](const sf::Event::KeyPressed &pressed) {
         switch (pressed.code) {
         [[likely]] case sf::Keyboard::Key::Up:
             key_states.gas = true;
@@ -179,6 +396,18 @@ void run()
                 ui_sound.play_ok();  // Play 'ok' sound for starting game
             }
             break;
+        [[unlikely]] case sf::Keyboard::Key::F9:
+            // Dump the recorded telemetry as a Chrome trace; serialization and disk IO run on a background thread
+            trace_recorder.dump(core::io::get_application_storage_location(generated::PROJECT_NAME));
+            ui_sound.play_ok();  // Play 'ok' sound to confirm the dump was triggered
+            break;
+        [[unlikely]] case sf::Keyboard::Key::F10:
+            // Persist the recorded driving window as the ghost; encoding and disk IO run on a background thread
+            ghost_recorder.save(ghost_file_path);
+            // Start playing it back immediately instead of waiting for the next launch
+            ghost_car.set_recording(ghost_recorder.snapshot());
+            ui_sound.play_ok();  // Play 'ok' sound to confirm the ghost was saved
+            break;
         default:
             break;
         }
@@ -206,47 +435,89 @@ void run()
         }
     };
 
-    // List of vehicles and selected index
-    const std::array<game::entities::Car *, 5> vehicle_pointer_array = {
-        &player_car,
-        &ai_cars.at(0),
-        &ai_cars.at(1),
-        &ai_cars.at(2),
-        &ai_cars.at(3)};
+    // Selected vehicle index (0 = player 1, then the extra players, then the AI grid), matching the physics slot order
+    // The selection is resolved through this helper instead of a cached pointer array, because the car vectors reallocate when their counts change
     int selected_vehicle_index = 0;
+    const auto selected_vehicle = [&player_car, &extra_player_cars, &ai_cars, &selected_vehicle_index]() -> const game::entities::Car * {
+        const auto index = static_cast<std::size_t>(std::max(selected_vehicle_index, 0));
+        if (index == 0 || index > extra_player_cars.size() + ai_cars.size()) [[likely]] {
+            return &player_car;
+        }
+        if (index <= extra_player_cars.size()) {
+            return &extra_player_cars[index - 1];
+        }
+        return &ai_cars[index - 1 - extra_player_cars.size()];
+    };
+
+    // Instanced car renderer for the stress-mode grids: one pass over the physics state packs every car into a shadow layer and a body layer, submitted as two textured draws
+    // Below the threshold the per-sprite path is used instead; a handful of draw calls costs nothing and keeps the normal game on the battle-tested path
+    game::entities::CarBatchRenderer car_batch{*car_region.texture, car_region.rect};
+    static constexpr std::size_t instanced_draw_threshold = 16;
 
     // Function to draw the game entities (race track and cars) in the window
-    const auto draw_game_entities = [&race_track, &player_car, &ai_cars](sf::RenderTarget &rt) {
-        race_track.draw(rt);
-        player_car.draw(rt);
-        for (const auto &ai_car : ai_cars) {
-            ai_car.draw(rt);
+    // The interpolation alpha blends car transforms between the previous and current physics states
+    const auto draw_game_entities = [&race_track, &skid_marks, &player_car, &extra_player_cars, &ai_cars, &car_physics, &car_tints, &car_batch, &ghost_car, &particle_system, &frame_profiler](sf::RenderTarget &rt, const float interpolation_alpha) {
+        {
+            const core::profiler::ScopedTimer timer{frame_profiler, "Track Draw"};
+            race_track.draw(rt);
+        }
+        skid_marks.draw(rt);  // Between the track and the cars, so marks sit on the ground but never cover a car
+        const core::profiler::ScopedTimer timer{frame_profiler, "Car Draw"};
+        ghost_car.draw(rt);  // Behind the real cars, so the translucent ghost never obscures them
+        if (car_physics.size() >= instanced_draw_threshold) {
+            // Stress-mode grid: fresh tire marks still come from the per-car pools (only the active cars have any), then the whole grid lands in two batched draws
+            player_car.draw_tire_marks(rt);
+            for (const auto &extra_player_car : extra_player_cars) {
+                extra_player_car.draw_tire_marks(rt);
+            }
+            for (const auto &ai_car : ai_cars) {
+                ai_car.draw_tire_marks(rt);
+            }
+            car_batch.build(car_physics, car_tints, interpolation_alpha);
+            car_batch.draw(rt);
+        }
+        else {
+            player_car.draw(rt, interpolation_alpha);
+            for (const auto &extra_player_car : extra_player_cars) {
+                extra_player_car.draw(rt, interpolation_alpha);
+            }
+            for (const auto &ai_car : ai_cars) {
+                ai_car.draw(rt, interpolation_alpha);
+            }
         }
+        particle_system.draw(rt);  // Above the cars; one vertex-array submit for the whole pool, rebuilt once per step rather than per viewport
     };
 
-    // Create minimap blips
+    // Create minimap blips; one reusable shape per role, so the blip count scales with any AI grid size
     static constexpr float blip_radius = 200.0f;
-    std::array<sf::CircleShape, 5> minimap_blips;
-    for (auto &blip : minimap_blips) {
-        blip.setRadius(blip_radius);
-        blip.setOrigin({blip_radius, blip_radius});  // Center
-        blip.setFillColor({255, 0, 0});              // Red by default
-    }
-    minimap_blips.at(0).setFillColor({0, 0, 0});  // Player as black
-
-    // Function to draw the game entities (race track and cars as blips) in the minimap
-    const auto draw_minimap_entities = [&race_track, &player_car, &ai_cars, &minimap_blips](sf::RenderTarget &rt) {
+    sf::CircleShape player_blip;
+    player_blip.setRadius(blip_radius);
+    player_blip.setOrigin({blip_radius, blip_radius});  // Center
+    player_blip.setFillColor({0, 0, 0});                // Player as black
+    sf::CircleShape ai_blip;
+    ai_blip.setRadius(blip_radius);
+    ai_blip.setOrigin({blip_radius, blip_radius});  // Center
+    ai_blip.setFillColor({255, 0, 0});              // AI as red
+
+    // Function to draw the static track into the minimap's cache texture; only called when the track layout changes
+    const auto draw_minimap_track = [&race_track](sf::RenderTarget &rt) {
         race_track.draw(rt);
+    };
 
-        // Update and draw player car blip
-        minimap_blips.at(0).setPosition(player_car.get_state().position);
-        rt.draw(minimap_blips.at(0));
+    // Function to draw the moving car blips in the minimap, on every refresh; the track itself comes from the cache
+    const auto draw_minimap_entities = [&player_car, &extra_player_cars, &ai_cars, &player_blip, &ai_blip](sf::RenderTarget &rt) {
+        // Update and draw player car blips (every split-screen player shares the black blip)
+        player_blip.setPosition(player_car.get_state().position);
+        rt.draw(player_blip);
+        for (const auto &extra_player_car : extra_player_cars) {
+            player_blip.setPosition(extra_player_car.get_state().position);
+            rt.draw(player_blip);
+        }
 
-        // Update and draw AI car blips
-        for (std::size_t i = 1; i <= 4; ++i) {
-            // AI cars are 0-indexed, so we use (i - 1)
-            minimap_blips.at(i).setPosition(ai_cars.at(i - 1).get_state().position);
-            rt.draw(minimap_blips.at(i));
+        // Reuse one shape for all AI car blips
+        for (const auto &ai_car : ai_cars) {
+            ai_blip.setPosition(ai_car.get_state().position);
+            rt.draw(ai_blip);
         }
     };
 
@@ -266,11 +537,36 @@ void run()
 
     // Widgets
     core::widgets::FpsCounter fps_counter{window.raw()};                                             // FPS counter in the top-left corner
-    core::widgets::Minimap minimap{window.raw(), core::colors::window.game, draw_minimap_entities};  // Minimap in the top-right corner
+    core::widgets::Minimap minimap{window.raw(), core::colors::window.game, draw_minimap_track, draw_minimap_entities};  // Minimap in the top-right corner
+    minimap.invalidate_track_cache(race_track.get_world_bounds());                                                       // Bake the initial layout on the first refresh
     core::widgets::Speedometer speedometer{window.raw()};                                            // Speedometer in the bottom-right corner
     core::widgets::Leaderboard leaderboard{window.raw()};                                            // Leaderboard in the top-right corner
+    core::widgets::ProfilerOverlay profiler_overlay{window.raw()};                                   // Frame phase timings in the top-left corner, below the FPS counter
+    profiler_overlay.enabled = false;                                                                // Debug overlay; opt-in via the settings menu
+    core::widgets::FrameTimeHistogram frame_time_histogram{window.raw()};                            // Frame-time distribution and percentiles in the bottom-left corner
+    frame_time_histogram.enabled = false;                                                            // Debug overlay; opt-in via the settings menu
+    core::widgets::MemoryOverlay memory_overlay{window.raw()};                                       // Per-subsystem memory usage against budgets, below the profiler
+    memory_overlay.enabled = false;                                                                  // Debug overlay; opt-in via the settings menu
+    core::widgets::LatencyOverlay latency_overlay{window.raw()};                                     // Input-event-to-present latency, below the memory overlay
+    latency_overlay.enabled = false;                                                                 // Debug overlay; opt-in via the settings menu
+
+    // Per-player world views for the current frame, rebuilt in the update pass and consumed by the render pass
+    // Each view carries its own viewport rectangle, so the track chunk culling (which reads the active view) only draws what that viewport can actually see; the capacity sticks, so this does no steady-state allocation
+    std::vector<sf::View> player_views;
+    player_views.reserve(static_cast<std::size_t>(settings::constants::max_players));
 
     const auto on_event = [&](const sf::Event &event) {
+        // Any event wakes the idle governor; ImGui still receives the event below, so the next rendered frame reflects it
+        seconds_since_last_event = 0.0f;
+
+        // Timestamp discrete input events for the latency overlay; window management events are not input, and mouse movement is left out so its flood of cheap samples does not drown the figures that matter
+        if (event.is<sf::Event::KeyPressed>() || event.is<sf::Event::KeyReleased>() ||
+            event.is<sf::Event::MouseButtonPressed>() ||
+            event.is<sf::Event::JoystickButtonPressed>() || event.is<sf::Event::JoystickMoved>()) {
+            last_input_event_time = std::chrono::steady_clock::now();
+            input_event_pending = true;
+        }
+
         // Let ImGui handle the event
         imgui_context.process_event(event);
 
@@ -285,23 +581,26 @@ void run()
             onKeyReleased(*released);
     };
 
-    const auto on_update = [&](const float dt) {
-        imgui_context.update(dt);
-        fps_counter.update_and_draw(dt);
+    // Fixed-rate simulation step: input sampling and car physics only
+    // This runs at the fixed timestep from "settings.hpp" (possibly zero or multiple times per frame), so physics behavior is independent of the display refresh rate
+    const auto on_fixed_update = [&](const float fixed_dt) {
+        if (current_state != core::states::GameState::Playing) [[unlikely]] {
+            return;
+        }
 
-        // Get window sizes, highly re-used during game loop and mandatory for correct resizing
-        window_size_u = window.raw().getSize();
-        window_size_f = core::backend::to_vector2f(window_size_u);
+        // Late input sampling: refresh the joystick snapshots at the top of every tick, so each physics step consumes input that is at most one tick (~8 ms) old instead of up to a whole frame old; drift correction is where that difference is felt
+        gamepad.poll();
+        for (std::size_t player = 0; player < extra_player_cars.size() && player < extra_gamepads.size(); ++player) {
+            extra_gamepads[player].poll();
+        }
 
         // Currently selected vehicle
-        game::entities::Car const *const selected_vehicle_pointer = vehicle_pointer_array.at(static_cast<std::size_t>(selected_vehicle_index));
+        game::entities::Car const *const selected_vehicle_pointer = selected_vehicle();
 
-        // Check if gamepad is usable with current configuration
-        const bool gamepad_available = gamepad.is_connected();
-
-        if (current_state == core::states::GameState::Playing) [[likely]] {
-            game::entities::CarInput player_input = {};
-            if (gamepad_available && settings::current::prefer_gamepad) {
+        game::entities::CarInput player_input = {};
+        {
+            const core::profiler::ScopedTimer timer{frame_profiler, "Input"};
+            if (gamepad.is_connected() && settings::current::prefer_gamepad) {
                 // Use gamepad input
                 player_input.throttle = gamepad.get_gas();
                 player_input.brake = gamepad.get_brake();
@@ -316,32 +615,248 @@ void run()
                 player_input.steering = (key_states.left ? -1.0f : 0.0f) + (key_states.right ? 1.0f : 0.0f);
                 player_input.handbrake = key_states.handbrake ? 1.0f : 0.0f;
             }
+        }
+
+        // LAN lockstep: only simulate a tick once both inputs for it are present; the host's input drives the first car on both machines and the joiner's the second, so the mapping is mirrored, not symmetric
+        game::entities::CarInput lan_second_input = {};
+        const bool lan_active = lan_session.is_running();
+        if (lan_active) {
+            if (lan_world_pending) [[unlikely]] {
+                // The seeded track rebuild has not landed yet; stepping now would simulate in a stale world and diverge immediately
+                return;
+            }
+            lan_session.submit_local_input(to_peer_input(player_input));
+            game::net::PeerInput lan_local_input = {};
+            game::net::PeerInput lan_remote_input = {};
+            if (!lan_session.try_get_tick_inputs(lan_local_input, lan_remote_input)) {
+                // The peer's input for this tick has not arrived yet; the accumulator retries after the next "poll()"
+                return;
+            }
+            player_input = to_car_input(lan_session.is_host() ? lan_local_input : lan_remote_input);
+            lan_second_input = to_car_input(lan_session.is_host() ? lan_remote_input : lan_local_input);
+        }
 
-            // Set active car for visual effects (tire marks, particles, etc.)
+        {
+            // This phase covers the AI as well, because the AI decisions run inside the parallel physics step
+            const core::profiler::ScopedTimer timer{frame_profiler, "Car Updates"};
+
+            // Set active car for visual effects (tire marks, particles, etc.); every split-screen player is on some viewport, so they all count as active
             player_car.set_active(&player_car == selected_vehicle_pointer);
+            for (auto &extra : extra_player_cars) {
+                extra.set_active(true);
+            }
             for (auto &ai : ai_cars) {
                 ai.set_active(&ai == selected_vehicle_pointer);
             }
 
             player_car.apply_input(player_input);
-            player_car.update(dt);
+
+            if (lan_active) {
+                // In a LAN race the second car is driven by the other machine's player, never by a local gamepad
+                if (!extra_player_cars.empty()) {
+                    extra_player_cars.front().apply_input(lan_second_input);
+                }
+            }
+            else {
+                // Split-screen players drive the extra cars from their own gamepads; an unplugged pad simply yields neutral input
+                for (std::size_t player = 0; player < extra_player_cars.size() && player < extra_gamepads.size(); ++player) {
+                    const core::input::Gamepad &pad = extra_gamepads[player];
+                    game::entities::CarInput extra_input = {};
+                    if (pad.is_connected()) {
+                        extra_input.throttle = pad.get_gas();
+                        extra_input.brake = pad.get_brake();
+                        extra_input.steering = pad.get_steer();
+                        extra_input.handbrake = pad.get_handbrake() ? 1.0f : 0.0f;
+                    }
+                    extra_player_cars[player].apply_input(extra_input);
+                }
+            }
+
+            // Fan disjoint index ranges of the physics system across the worker threads; each car only touches its own array slots, its own RNG stream, and the read-only track
+            const std::size_t car_count = car_physics.size();
+            const std::size_t worker_count = job_system.get_worker_count();
+            const std::size_t cars_per_range = std::max<std::size_t>(1, (car_count + worker_count - 1) / worker_count);
+            for (std::size_t first = 0; first < car_count; first += cars_per_range) {
+                const std::size_t last = std::min(first + cars_per_range, car_count);
+                job_system.submit([&car_physics, first, last, fixed_dt]() { car_physics.update_range(first, last, fixed_dt); });
+            }
+
+            // Frame barrier: all physics updates must finish before state is read for drawing
+            job_system.wait();
+
+            // Car-to-car contacts touch pairs of cars, so they are resolved on this thread after the barrier
+            car_physics.resolve_car_collisions();
+
+            // Standings are cross-car state as well, so they are restored here; the pass is O(cars) and only moves the cars whose order actually changed
+            car_physics.update_standings();
+        }
+
+        {
+            const core::profiler::ScopedTimer timer{frame_profiler, "Car Visuals"};
+
+            // Update visual effects (tire marks) from the freshly stepped physics state; only the active cars do real work here
+            player_car.update_visuals(fixed_dt, skid_marks);
+            for (auto &extra : extra_player_cars) {
+                extra.update_visuals(fixed_dt, skid_marks);
+            }
             for (auto &ai : ai_cars) {
-                ai.update(dt);
+                ai.update_visuals(fixed_dt, skid_marks);
+            }
+        }
+
+        {
+            // Feed drift and collision events from the freshly stepped physics state into the particle pool, then integrate it; both are tight loops over contiguous arrays
+            const core::profiler::ScopedTimer timer{frame_profiler, "Particles"};
+            if (settings::current::particles) [[likely]] {
+                for (std::size_t car_index = 0; car_index < car_physics.size(); ++car_index) {
+                    const game::entities::CarState car_state = car_physics.get_state(car_index);
+                    if (car_state.just_hit_wall) [[unlikely]] {
+                        particle_system.emit_sparks(car_state.position, car_state.last_wall_hit_speed);
+                    }
+                    particle_system.emit_drift_smoke(car_state.position, car_state.lateral_slip_velocity);
+                }
             }
+            // Updating even when emission is off lets the already-spawned particles fade out instead of freezing on screen
+            particle_system.update(fixed_dt);
+        }
+
+        {
+            // Feed the player state into the ghost recorder and advance the ghost playback; the recorder only stores a sample when its own interval elapses, so this is a few float ops per step
+            const auto player_state = player_car.get_state();
+            ghost_recorder.record(player_state.position, player_state.heading_radians, player_state.steering_angle, fixed_dt);
+            ghost_car.update(fixed_dt);
+        }
+
+        if (lan_active) {
+            // Hash after the complete step (collisions and standings included), so both machines sample the same point in the tick; off-interval ticks skip the hash entirely
+            const std::uint64_t state_hash = lan_session.get_current_tick() % game::net::hash_interval_ticks == 0
+                                                 ? hash_physics_state()
+                                                 : 0;
+            lan_session.complete_tick(state_hash);
+        }
+    };
+
+    const auto on_update = [&](const float dt) {
+        // State-aware idle governor: cap the pacer at a low rate while a menu is on screen, and skip the whole ImGui pass (update and render) on frames where no input has arrived recently
+        // Gamepad input also reaches us as sf::Event joystick events, so a button press on any pad wakes the governor like a key or mouse event does
+        const bool menu_on_screen = current_state != core::states::GameState::Playing;
+        window.set_idle(menu_on_screen);
+        // Music runs above the idle skip below, so crossfades finish and volume changes apply while a menu sits idle
+        music_player.set_context(menu_on_screen ? core::sfx::MusicContext::Menu : core::sfx::MusicContext::Race);
+        music_player.update(dt);
+        // Publish a settings snapshot for the background autosave; serialization happens here on the game thread, which owns the settings, so the autosave thread never reads them. Runs above the idle skip, so changes made right before a menu goes idle still reach the disk
+        config_context.publish_snapshot();
+        // The LAN session pumps above the idle skip too, so hosting from an idle menu still accepts the peer; the running transition fires once, when the handshake completes on either side
+        const bool lan_was_running = lan_session.is_running();
+        lan_session.poll();
+        if (!lan_was_running && lan_session.is_running()) [[unlikely]] {
+            start_lan_race(lan_session.get_session_seed());
+        }
+        seconds_since_last_event += dt;
+        ui_frame_skipped = menu_on_screen && seconds_since_last_event > ui_idle_grace_seconds;
+        if (ui_frame_skipped) [[unlikely]] {
+            return;
+        }
+
+        // Refresh the joystick snapshots for the controls UI below; the physics steps re-poll at the top of every fixed tick, so this one only matters on frames where no tick ran (display rates above the physics rate)
+        gamepad.poll();
+        for (std::size_t player = 0; player < extra_player_cars.size() && player < extra_gamepads.size(); ++player) {
+            extra_gamepads[player].poll();
+        }
+
+        imgui_context.update(dt);
+        {
+            const core::profiler::ScopedTimer timer{frame_profiler, "Widgets"};
+            fps_counter.update_and_draw(dt);
+            frame_time_histogram.update_and_draw(dt);
+            profiler_overlay.update_and_draw(dt, collect_profiler_data);
+            memory_overlay.update_and_draw(dt);
+            latency_overlay.update_and_draw(dt);
+        }
+
+        // Swap in a track layout built on a background thread, if one finished; the spawn point moved, so respawn the cars and re-cover the new bounds with an empty skid mark layer
+        if (race_track.poll()) {
+            reset_cars();
+            skid_marks.rebuild(race_track.get_world_bounds());
+            minimap.invalidate_track_cache(race_track.get_world_bounds());
+            // If this was the seeded LAN rebuild, both machines now stand in the identical world and the lockstep may start ticking
+            lan_world_pending = false;
+        }
+
+        // Get window sizes, highly re-used during game loop and mandatory for correct resizing
+        window_size_u = window.raw().getSize();
+        window_size_f = core::backend::to_vector2f(window_size_u);
+
+        // Currently selected vehicle
+        game::entities::Car const *const selected_vehicle_pointer = selected_vehicle();
+
+        // Check if gamepad is usable with current configuration
+        const bool gamepad_available = gamepad.is_connected();
+
+        if (current_state == core::states::GameState::Playing) [[likely]] {
             const auto vehicle_state = selected_vehicle_pointer->get_state();
-            sf::View view;
-            view.setCenter(vehicle_state.position);
-            view.setSize({window_size_f.x * camera_zoom_factor, window_size_f.y * camera_zoom_factor});
-            window.raw().setView(view);
-            speedometer.update_and_draw(vehicle_state.speed);
-            minimap.update_and_draw(dt, vehicle_state.position);
-            leaderboard.update_and_draw(dt, collect_leaderboard_data);
 
-            // Update engine sound based on the currently selected vehicle's speed
-            engine_sound.update(vehicle_state.speed);
-            if (!engine_sound.is_playing()) {
-                engine_sound.start();
+            // Build one view per split-screen player: a full window for one player, stacked halves for two, quadrants for three or four
+            // View 0 follows the selected vehicle (so single-player spectating keeps working); the other views each follow their own player car
+            const auto make_view = [&window_size_f, &camera_zoom_factor](const sf::Vector2f center, const sf::FloatRect &viewport) {
+                sf::View view;
+                view.setCenter(center);
+                // Scale the world size by the viewport fraction, so every viewport shows the world at the same pixels-per-meter regardless of the split
+                view.setSize({window_size_f.x * viewport.size.x * camera_zoom_factor, window_size_f.y * viewport.size.y * camera_zoom_factor});
+                view.setViewport(viewport);
+                return view;
+            };
+            static constexpr sf::FloatRect full_viewport = {{0.f, 0.f}, {1.f, 1.f}};
+            static constexpr std::array<sf::FloatRect, 2> half_viewports = {{{{0.f, 0.f}, {1.f, 0.5f}}, {{0.f, 0.5f}, {1.f, 0.5f}}}};
+            static constexpr std::array<sf::FloatRect, 4> quadrant_viewports = {{{{0.f, 0.f}, {0.5f, 0.5f}}, {{0.5f, 0.f}, {0.5f, 0.5f}}, {{0.f, 0.5f}, {0.5f, 0.5f}}, {{0.5f, 0.5f}, {0.5f, 0.5f}}}};
+            const std::size_t view_count = 1 + extra_player_cars.size();
+            player_views.clear();
+            for (std::size_t player = 0; player < view_count; ++player) {
+                const sf::Vector2f center = player == 0 ? vehicle_state.position : extra_player_cars[player - 1].get_state().position;
+                const sf::FloatRect &viewport = view_count == 1 ? full_viewport
+                                                                : (view_count == 2 ? half_viewports[player] : quadrant_viewports[player]);
+                player_views.emplace_back(make_view(center, viewport));
+            }
+            window.raw().setView(player_views.front());
+            {
+                const core::profiler::ScopedTimer timer{frame_profiler, "Widgets"};  // Samples with the same name are summed within the frame
+                speedometer.update_and_draw(vehicle_state.speed);
+                minimap.update_and_draw(dt, vehicle_state.position);
+                leaderboard.update_and_draw(dt, collect_leaderboard_data);
+            }
+
+            // Per-frame telemetry counters; graphed alongside the phase timings when a Chrome trace is dumped
+            trace_recorder.record_counter("Cars Updated", static_cast<float>(car_physics.size()));
+            trace_recorder.record_counter("Tiles Drawn", static_cast<float>(race_track.get_last_drawn_tile_count()));
+            std::size_t tire_marks_alive = player_car.get_tire_mark_count();
+            for (const auto &extra : extra_player_cars) {
+                tire_marks_alive += extra.get_tire_mark_count();
+            }
+            for (const auto &ai : ai_cars) {
+                tire_marks_alive += ai.get_tire_mark_count();
+            }
+            trace_recorder.record_counter("Tire Marks Alive", static_cast<float>(tire_marks_alive));
+            trace_recorder.record_counter("Skid Marks Baked", static_cast<float>(skid_marks.get_stamp_count()));
+            trace_recorder.record_counter("Particles Alive", static_cast<float>(particle_system.get_alive_count()));
+
+            // Let the auto mode react to the frame time before this frame's world pass begins
+            resolution_scaler.update(dt);
+            trace_recorder.record_counter("World Render Scale", resolution_scaler.get_scale());
+
+            // The governor only acts once the render scale has bottomed out; an anti-aliasing rung needs a window recreate, because the sample count lives in the GL context
+            if (quality_governor.update(dt)) [[unlikely]] {
+                window.apply_settings();
+            }
+            trace_recorder.record_counter("Quality Level", static_cast<float>(quality_governor.get_level()));
+
+            // Feed every car's position and speed to the engine mixer; only the loudest few around the camera occupy real voices, the rest stay virtual
+            core::arena::FrameVector<core::sfx::EngineSource> engine_sources{core::arena::Allocator<core::sfx::EngineSource>{frame_arena}};
+            engine_sources.reserve(car_physics.size());
+            for (std::size_t car_index = 0; car_index < car_physics.size(); ++car_index) {
+                const game::entities::CarState car_state = car_physics.get_state(car_index);
+                engine_sources.emplace_back(core::sfx::EngineSource{.position = car_state.position, .speed = car_state.speed});
             }
+            engine_mixer.update(vehicle_state.position, {engine_sources.data(), engine_sources.size()});
 
             // Update tire screeching sound based on the currently selected vehicle's drift state
             tire_screech_sound.update(vehicle_state.lateral_slip_velocity, vehicle_state.speed);
@@ -354,8 +869,8 @@ void run()
 
         // Paused state, this rarely happens, but more often than the initial menu state, that is gonna be shown only once
         else if (current_state == core::states::GameState::Paused) {
-            // Stop engine sound when paused
-            engine_sound.stop();
+            // Stop engine voices when paused
+            engine_mixer.stop();
 
             // Stop tire screeching sound when paused
             tire_screech_sound.stop();
@@ -425,6 +940,77 @@ void run()
                             player_car.set_control_mode(player_ai_controlled ? game::entities::CarControlMode::AI : game::entities::CarControlMode::Player);
                         }
 
+                        if (ImGui::Checkbox("Deterministic Mode", &settings::current::deterministic)) {
+                            ui_sound.play_ok();
+                        }
+                        ImGui::TextWrapped("Note: Deterministic mode uses a fixed random seed and takes effect on the next launch");
+
+                        if (ImGui::SliderInt("AI Cars", &settings::current::ai_car_count, settings::constants::min_ai_cars, settings::constants::max_ai_cars, "%d cars")) {
+                            ui_sound.play_ok();
+                            apply_ai_car_count();
+                            // Keep the camera on a car that still exists, then respread the grid along the waypoint line
+                            selected_vehicle_index = std::min(selected_vehicle_index, static_cast<int>(extra_player_cars.size() + ai_cars.size()));
+                            reset_cars();
+                        }
+                        ImGui::TextWrapped("Note: High car counts are a stress test and may reduce performance");
+
+                        ImGui::SeparatorText("Split-Screen");
+                        if (ImGui::SliderInt("Players", &settings::current::player_count, settings::constants::min_players, settings::constants::max_players, "%d players")) {
+                            ui_sound.play_ok();
+                            apply_player_count();
+                            selected_vehicle_index = std::min(selected_vehicle_index, static_cast<int>(extra_player_cars.size() + ai_cars.size()));
+                            reset_cars();
+                        }
+                        ImGui::TextWrapped("Note: The simulation is shared; each extra player needs their own gamepad, the keyboard stays on player 1");
+
+                        ImGui::SeparatorText("LAN Race");
+                        const game::net::SessionState lan_state = lan_session.get_state();
+                        if (lan_state == game::net::SessionState::Disconnected) {
+                            if (ImGui::Button("Host")) {
+                                ui_sound.play_ok();
+                                // The host picks the session seed: the entered track seed when set, fresh entropy otherwise; it reaches the joiner via the handshake
+                                const std::uint64_t session_seed = settings::current::track_seed != 0
+                                                                       ? static_cast<std::uint64_t>(static_cast<unsigned>(settings::current::track_seed))
+                                                                       : static_cast<std::uint64_t>(std::random_device{}());
+                                lan_session.host(game::net::default_port, session_seed);
+                            }
+                            ImGui::InputTextWithHint("Host IP", "192.168.0.10", lan_address_input.data(), lan_address_input.size());
+                            if (ImGui::Button("Join")) {
+                                ui_sound.play_ok();
+                                const std::optional<sf::IpAddress> address = sf::IpAddress::resolve(lan_address_input.data());
+                                if (address.has_value()) {
+                                    lan_session.join(*address, game::net::default_port);
+                                }
+                                else {
+                                    SPDLOG_WARN("Could not resolve host address '{}'", lan_address_input.data());
+                                }
+                            }
+                        }
+                        else {
+                            if (ImGui::Button("Disconnect")) {
+                                ui_sound.play_ok();
+                                lan_session.disconnect();
+                            }
+                            ImGui::SameLine();
+                            switch (lan_state) {
+                            case game::net::SessionState::Listening:
+                                ImGui::TextUnformatted("Waiting for a peer to join...");
+                                break;
+                            case game::net::SessionState::Connecting:
+                                ImGui::TextUnformatted("Waiting for the host's handshake...");
+                                break;
+                            case game::net::SessionState::Running:
+                                ImGui::Text("Racing, tick %llu", static_cast<unsigned long long>(lan_session.get_current_tick()));
+                                break;
+                            case game::net::SessionState::Diverged:
+                                ImGui::TextColored({1.0f, 0.3f, 0.3f, 1.0f}, "Simulations diverged - race void");
+                                break;
+                            default:
+                                break;
+                            }
+                        }
+                        ImGui::TextWrapped("Note: Both peers simulate the full race and exchange only inputs, so both machines must run the same build");
+
                         ImGui::SeparatorText("Track Layout");
                         const core::world::TrackConfig &track_config = race_track.get_config();
                         int track_width_tiles = static_cast<int>(track_config.horizontal_count);
@@ -453,6 +1039,18 @@ void run()
                             track_config_changed = true;
                         }
 
+                        // The seed is a shareable track code: the same seed with the same layout settings above regenerates the same track on any machine
+                        if (ImGui::InputInt("Seed", &settings::current::track_seed)) {
+                            ui_sound.play_ok();
+                        }
+                        if (ImGui::Button("Regenerate Track")) {
+                            ui_sound.play_ok();
+                            // Re-seed the track stream so the rebuild is a pure function of the entered seed (or fresh entropy when it is "0"), then rebuild with the current layout settings; "poll()" respawns the cars when the new layout lands
+                            track_rng = core::rng::Pcg32{settings::current::track_seed != 0 ? static_cast<unsigned>(settings::current::track_seed) : std::random_device{}(), 0};
+                            race_track.regenerate();
+                        }
+                        ImGui::TextWrapped("Note: Seed 0 rolls a fresh random track; any other value is a shareable track code");
+
                         if (track_config_changed) {
                             race_track.set_config(
                                 {.horizontal_count = static_cast<std::size_t>(track_width_tiles),
@@ -461,13 +1059,21 @@ void run()
                                  .detour_probability = detour_probability});
                             // Reset all cars to the new track spawn point
                             reset_cars();
+                            // A pure tile-size change rescales the layout synchronously (no "poll()" swap), so refresh the bounds-dependent overlays here as well; layout changes refresh them again when the background build lands
+                            skid_marks.rebuild(race_track.get_world_bounds());
+                            minimap.invalidate_track_cache(race_track.get_world_bounds());
                         }
 
                         ImGui::SeparatorText("Camera");
                         if (ImGui::SliderFloat("Zoom", &camera_zoom_factor, 1.f, 15.f, "%.1fx")) {
                             ui_sound.play_ok();
                         }
-                        if (ImGui::Combo("Car", &selected_vehicle_index, vehicle_names.data(), static_cast<int>(vehicle_names.size()))) {
+                        std::vector<const char *> vehicle_name_cstr;
+                        vehicle_name_cstr.reserve(vehicle_names.size());
+                        for (const auto &name : vehicle_names) {
+                            vehicle_name_cstr.emplace_back(name.c_str());
+                        }
+                        if (ImGui::Combo("Car", &selected_vehicle_index, vehicle_name_cstr.data(), static_cast<int>(vehicle_name_cstr.size()))) {
                             ui_sound.play_ok();
                         }
 
@@ -604,7 +1210,7 @@ void run()
                         ImGui::SeparatorText("Display");
                         if (ImGui::Checkbox("Fullscreen", &settings::current::fullscreen)) {
                             ui_sound.play_ok();
-                            window.recreate();
+                            window.apply_settings();
                         }
 
                         ImGui::BeginDisabled(!settings::current::fullscreen);
@@ -614,7 +1220,7 @@ void run()
                                 if (ImGui::Selectable(mode_cstr.at(static_cast<std::size_t>(i)), is_selected)) {
                                     ui_sound.play_ok();
                                     settings::current::mode_idx = i;
-                                    window.recreate();
+                                    window.apply_settings();
                                 }
                                 if (is_selected) {
                                     ImGui::SetItemDefaultFocus();
@@ -629,13 +1235,27 @@ void run()
 
                         if (ImGui::Combo("Anti-Aliasing", &settings::current::anti_aliasing_idx, settings::constants::anti_aliasing_labels, IM_ARRAYSIZE(settings::constants::anti_aliasing_labels))) {
                             ui_sound.play_ok();
-                            window.recreate();
+                            window.apply_settings();
+                        }
+
+                        // The scaler picks these up next frame, so no recreate is needed; the slider is read-only in auto mode, where it doubles as a live readout
+                        ImGui::BeginDisabled(settings::current::world_render_auto_scale);
+                        if (ImGui::SliderFloat("World Render Scale", &settings::current::world_render_scale, settings::constants::min_world_render_scale, 1.0f, "%.2f")) {
+                            ui_sound.play_ok();
+                        }
+                        ImGui::EndDisabled();
+                        if (ImGui::Checkbox("Auto Render Scale", &settings::current::world_render_auto_scale)) {
+                            ui_sound.play_ok();
+                        }
+                        // The governor restores the user's exact settings when this is unticked, so toggling it is always safe
+                        if (ImGui::Checkbox("Auto Quality", &settings::current::auto_quality)) {
+                            ui_sound.play_ok();
                         }
 
                         ImGui::SeparatorText("Frame Rate");
                         if (ImGui::Checkbox("V-Sync", &settings::current::vsync)) {
                             ui_sound.play_ok();
-                            window.recreate();
+                            window.apply_settings();
                             // Hack: set FPS limit's label to "Unlimited", because we don't store previous value
                             settings::current::fps_idx = 8;
                         }
@@ -643,13 +1263,21 @@ void run()
                         ImGui::BeginDisabled(settings::current::vsync);
                         if (ImGui::Combo("FPS Limit", &settings::current::fps_idx, settings::constants::fps_labels, IM_ARRAYSIZE(settings::constants::fps_labels))) {
                             ui_sound.play_ok();
-                            window.recreate();
+                            window.apply_settings();
+                        }
+                        // The frame pacer reads this every frame, so no recreate is needed
+                        if (ImGui::Checkbox("Low-Power Pacing", &settings::current::low_power_pacing)) {
+                            ui_sound.play_ok();
                         }
                         ImGui::EndDisabled();
 
                         ImGui::SeparatorText("Effects");
 
                         if (ImGui::Checkbox("Tire Marks", &settings::current::tire_marks)) {
+                            if (!settings::current::tire_marks) {
+                                // Also erase the marks already baked into the persistent layer, so the toggle visibly clears the ground
+                                skid_marks.clear();
+                            }
                             ui_sound.play_ok();
                         }
                         ImGui::BeginDisabled(!settings::current::tire_marks);
@@ -657,7 +1285,10 @@ void run()
                             ui_sound.play_ok();
                         }
                         ImGui::EndDisabled();
-                        ImGui::TextWrapped("Note: This option has a high performance impact, consider disabling it on older hardware");
+
+                        if (ImGui::Checkbox("Particles", &settings::current::particles)) {
+                            ui_sound.play_ok();
+                        }
 
                         ImGui::SeparatorText("Widgets");
 
@@ -699,6 +1330,18 @@ void run()
                         if (ImGui::Checkbox("Leaderboard", &leaderboard.enabled)) {
                             ui_sound.play_ok();
                         }
+                        if (ImGui::Checkbox("Profiler", &profiler_overlay.enabled)) {
+                            ui_sound.play_ok();
+                        }
+                        if (ImGui::Checkbox("Frame Times", &frame_time_histogram.enabled)) {
+                            ui_sound.play_ok();
+                        }
+                        if (ImGui::Checkbox("Memory", &memory_overlay.enabled)) {
+                            ui_sound.play_ok();
+                        }
+                        if (ImGui::Checkbox("Latency", &latency_overlay.enabled)) {
+                            ui_sound.play_ok();
+                        }
 
                         ImGui::PopItemWidth();
                         ImGui::EndTabItem();
@@ -733,6 +1376,12 @@ void run()
                             ui_sound.play_ok();  // Play a sound when the slider changes
                         }
 
+                        float music_volume_percent = settings::current::music_volume * 100.0f;
+                        if (ImGui::SliderFloat("Music", &music_volume_percent, 0.0f, 100.0f, "%.0f%%", ImGuiSliderFlags_AlwaysClamp)) {
+                            settings::current::music_volume = music_volume_percent / 100.0f;
+                            // No feedback sound; the music itself reflects the change on the next update
+                        }
+
                         ImGui::PopItemWidth();
                         ImGui::EndTabItem();
                     }
@@ -774,8 +1423,8 @@ void run()
         // Handle each core::states::GameState
         // Menu state
         else [[unlikely]] {
-            // Stop engine sound when in menu
-            engine_sound.stop();
+            // Stop engine voices when in menu
+            engine_mixer.stop();
 
             // Main menu
             constexpr float main_menu_width = 240.0f;
@@ -832,10 +1481,33 @@ void run()
         }
     };
 
-    const auto on_render = [&](sf::RenderWindow &rt) {
+    const auto on_render = [&](sf::RenderWindow &rt, const float interpolation_alpha) {
+        if (ui_frame_skipped) [[unlikely]] {
+            // The update pass was skipped, so no ImGui frame is open and nothing on screen changed; present nothing and leave the previous frame on display
+            frame_profiler.end_frame();
+            frame_arena.reset();
+            return;
+        }
         if (current_state == core::states::GameState::Playing) [[likely]] {
-            rt.clear(core::colors::window.game);
-            draw_game_entities(rt);
+            if (player_views.size() > 1) {
+                // Split-screen: the simulation already ran once, only this render pass repeats per viewport; each pass culls against its own view, so the cost scales with the visible area, not the player count
+                // The resolution scaler blits over the whole window, so split viewports always render at native resolution
+                rt.clear(core::colors::window.game);
+                for (const sf::View &player_view : player_views) {
+                    rt.setView(player_view);
+                    draw_game_entities(rt, interpolation_alpha);
+                }
+                rt.setView(rt.getDefaultView());
+            }
+            // Draw the world into a reduced-resolution texture and upscale it when the render scale is below native; the blit covers the whole window, so no clear is needed there
+            else if (sf::RenderTexture *world_target = resolution_scaler.begin_world_pass(window_size_u, rt.getView(), core::colors::window.game)) {
+                draw_game_entities(*world_target, interpolation_alpha);
+                resolution_scaler.end_world_pass(rt);
+            }
+            else {
+                rt.clear(core::colors::window.game);
+                draw_game_entities(rt, interpolation_alpha);
+            }
         }
         else if (current_state == core::states::GameState::Paused) {
             rt.clear(core::colors::window.settings);
@@ -843,13 +1515,34 @@ void run()
         else [[unlikely]] {
             rt.clear(core::colors::window.menu);
         }
-        imgui_context.render();
+        {
+            const core::profiler::ScopedTimer timer{frame_profiler, "ImGui Render"};
+            imgui_context.render();
+        }
         rt.display();
+
+        // The frame that consumed the most recent input event has just been handed to the display; the elapsed time is the input-to-present latency
+        if (input_event_pending) {
+            latency_overlay.record(std::chrono::duration<float>(std::chrono::steady_clock::now() - last_input_event_time).count());
+            input_event_pending = false;
+        }
+
+        // Close the profiling frame now that every instrumented phase has run
+        frame_profiler.end_frame();
+
+        // Latch the per-frame allocation counters; a no-op unless the build has memory tracking enabled
+        core::memory::end_frame();
+
+        // Reclaim the frame arena wholesale; every transient container assembled this frame is dead now
+        frame_arena.reset();
     };
 
+    // Everything is constructed; persist this launch's timings so the fleet telemetry can trend cold start across releases
+    startup_timeline.append_report(core::io::get_application_storage_location(generated::PROJECT_NAME), generated::PROJECT_VERSION);
+
     window.raw().requestFocus();  // Ask OS to switch to this window
 
-    window.run(on_event, on_update, on_render);  // Start the main loop
+    window.run(on_event, on_fixed_update, on_update, on_render);  // Start the main loop
 }
 
 }  // namespace app
@@ -0,0 +1,225 @@
+/**
+ * @file arena.hpp
+ *
+ * @brief Frame-scoped bump allocator for transient containers.
+ */
+
+#pragma once
+
+#include <cstddef>  // for std::size_t, std::byte, std::max_align_t
+#include <new>      // for ::operator new, ::operator delete, std::align_val_t
+#include <string>   // for std::basic_string, std::char_traits
+#include <vector>   // for std::vector
+
+namespace core::arena {
+
+/**
+ * @brief Class that hands out memory by bumping an offset through a fixed buffer, reclaiming everything at once on "reset()".
+ *
+ * Transient data assembled within a single frame (leaderboard rows, profiler rows, and similar UI scratch) does not need individual deallocation: it all dies together when the frame is displayed. Serving it from one pre-allocated buffer turns thousands of small heap round-trips per second into pointer bumps and keeps the scratch data contiguous and cache-warm.
+ *
+ * If the buffer runs out mid-frame, further allocations fall back to the heap (and are individually freed), so an undersized arena degrades to the old behavior instead of crashing; the overflow count is exposed for telemetry so the capacity can be tuned.
+ *
+ * @note Not thread-safe; one arena belongs to one thread's frame loop.
+ */
+class FrameArena final {
+  public:
+    /**
+     * @brief Construct a new FrameArena object, allocating the buffer up front.
+     *
+     * @param capacity Size of the buffer in bytes (e.g., "65536"); chosen once, never grown.
+     */
+    explicit FrameArena(const std::size_t capacity)
+        : buffer_(capacity) {}
+
+    /**
+     * @brief Allocate a block from the buffer, falling back to the heap when the buffer is exhausted.
+     *
+     * @param bytes Size of the block in bytes.
+     * @param alignment Required alignment of the block in bytes; must be a power of two.
+     *
+     * @return Pointer to uninitialized storage of the requested size and alignment.
+     */
+    [[nodiscard]] void *allocate(const std::size_t bytes,
+                                 const std::size_t alignment)
+    {
+        // Round the current offset up to the requested alignment
+        const std::size_t aligned_offset = (this->offset_ + alignment - 1) & ~(alignment - 1);
+        if (aligned_offset + bytes <= this->buffer_.size()) [[likely]] {
+            this->offset_ = aligned_offset + bytes;
+            return this->buffer_.data() + aligned_offset;
+        }
+
+        // Exhausted: serve from the heap, so an undersized arena degrades instead of failing; "deallocate()" recognizes these blocks by address
+        ++this->overflow_count_;
+        return ::operator new(bytes, std::align_val_t{alignment});
+    }
+
+    /**
+     * @brief Return a block obtained from "allocate()".
+     *
+     * Blocks inside the buffer are reclaimed wholesale by "reset()", so this is a no-op for them; heap-fallback blocks are freed individually.
+     *
+     * @param pointer Pointer previously returned by "allocate()".
+     * @param bytes Size passed to the matching "allocate()" call.
+     * @param alignment Alignment passed to the matching "allocate()" call.
+     */
+    void deallocate(void *pointer,
+                    [[maybe_unused]] const std::size_t bytes,
+                    const std::size_t alignment)
+    {
+        const std::byte *block = static_cast<const std::byte *>(pointer);
+        if (block >= this->buffer_.data() && block < this->buffer_.data() + this->buffer_.size()) [[likely]] {
+            return;
+        }
+        ::operator delete(pointer, std::align_val_t{alignment});
+    }
+
+    /**
+     * @brief Reclaim the whole buffer by rewinding the bump offset.
+     *
+     * @note Call this once per frame, after the frame has been displayed; every container still holding arena memory is invalidated.
+     */
+    void reset()
+    {
+        this->high_water_mark_ = this->offset_ > this->high_water_mark_ ? this->offset_ : this->high_water_mark_;
+        this->offset_ = 0;
+    }
+
+    /**
+     * @brief Get the largest number of buffer bytes in use at any "reset()" so far.
+     *
+     * @return High water mark in bytes; intended for telemetry and capacity tuning.
+     */
+    [[nodiscard]] std::size_t get_high_water_mark() const { return this->high_water_mark_; }
+
+    /**
+     * @brief Get the number of allocations that fell back to the heap because the buffer was exhausted.
+     *
+     * @return Overflow count since construction; a steadily climbing value means the capacity is too small.
+     */
+    [[nodiscard]] std::size_t get_overflow_count() const { return this->overflow_count_; }
+
+    // Disable move semantics - containers hold pointers into the buffer
+    FrameArena(FrameArena &&) = delete;
+    FrameArena &operator=(FrameArena &&) = delete;
+
+    // Disable copy semantics
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+  private:
+    /**
+     * @brief Fixed byte buffer that allocations are bumped through.
+     */
+    std::vector<std::byte> buffer_;
+
+    /**
+     * @brief Current bump offset into "buffer_", in bytes.
+     */
+    std::size_t offset_ = 0;
+
+    /**
+     * @brief Largest offset observed at any "reset()", in bytes.
+     */
+    std::size_t high_water_mark_ = 0;
+
+    /**
+     * @brief Number of heap-fallback allocations since construction.
+     */
+    std::size_t overflow_count_ = 0;
+};
+
+/**
+ * @brief Standard-conforming allocator that serves containers from a FrameArena.
+ *
+ * Plug this into std::vector or std::basic_string (see the "FrameVector" and "FrameString" aliases) to make the container's storage frame-scoped. The arena outlives every container using it within a frame, and "FrameArena::reset()" invalidates them all at once.
+ *
+ * @tparam T Type of the allocated elements.
+ *
+ * @note Not marked "final": the standard library derives from allocators internally (empty base optimization).
+ */
+template <typename T>
+class Allocator {
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Construct a new Allocator object bound to an arena.
+     *
+     * @param arena Arena that allocations are served from; must outlive the allocator and every container using it.
+     */
+    explicit Allocator(FrameArena &arena)
+        : arena_(&arena) {}
+
+    /**
+     * @brief Rebinding copy constructor required by the allocator interface.
+     *
+     * @tparam U Element type of the source allocator.
+     *
+     * @param other Allocator to share the arena of.
+     */
+    template <typename U>
+    explicit Allocator(const Allocator<U> &other)
+        : arena_(other.get_arena()) {}
+
+    /**
+     * @brief Allocate storage for a number of elements.
+     *
+     * @param count Number of elements of type "T".
+     *
+     * @return Pointer to uninitialized storage.
+     */
+    [[nodiscard]] T *allocate(const std::size_t count)
+    {
+        return static_cast<T *>(this->arena_->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @brief Return storage obtained from "allocate()"; arena-backed blocks are reclaimed by the next "FrameArena::reset()".
+     *
+     * @param pointer Pointer previously returned by "allocate()".
+     * @param count Element count passed to the matching "allocate()" call.
+     */
+    void deallocate(T *pointer,
+                    const std::size_t count)
+    {
+        this->arena_->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    /**
+     * @brief Get the arena this allocator is bound to.
+     *
+     * @return Pointer to the arena; never null.
+     */
+    [[nodiscard]] FrameArena *get_arena() const { return this->arena_; }
+
+    /**
+     * @brief Compare two allocators; equal allocators can free each other's memory, which holds exactly when they share an arena.
+     */
+    template <typename U>
+    [[nodiscard]] bool operator==(const Allocator<U> &other) const { return this->arena_ == other.get_arena(); }
+
+  private:
+    /**
+     * @brief Arena that allocations are served from.
+     *
+     * @note A pointer instead of a reference, so the allocator stays copy-assignable as the standard requires.
+     */
+    FrameArena *arena_;
+};
+
+/**
+ * @brief Vector whose storage is frame-scoped; construct with an "Allocator" bound to the frame arena.
+ *
+ * @tparam T Type of the vector elements.
+ */
+template <typename T>
+using FrameVector = std::vector<T, Allocator<T>>;
+
+/**
+ * @brief String whose storage is frame-scoped; construct with an "Allocator" bound to the frame arena.
+ */
+using FrameString = std::basic_string<char, std::char_traits<char>, Allocator<char>>;
+
+}  // namespace core::arena
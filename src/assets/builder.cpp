@@ -2,6 +2,20 @@
  * @file builder.cpp
  */
 
+#include <algorithm>  // for std::max, std::min
+#include <array>      // for std::array
+#include <atomic>     // for std::atomic
+#include <cstddef>    // for std::size_t
+#include <span>       // for std::span
+#include <thread>     // for std::jthread, std::thread
+#include <utility>    // for std::move
+#include <vector>     // for std::vector
+
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include "memory.hpp"
+
 // Managers
 #include "sounds.hpp"
 #include "textures.hpp"
@@ -15,12 +29,8 @@
 #include "data/textures/road/road_sand88.hpp"
 #include "data/textures/road/road_sand89.hpp"
 
-// Embedded car textures
-#include "data/textures/car/car_black_1.hpp"
-#include "data/textures/car/car_blue_1.hpp"
-#include "data/textures/car/car_green_1.hpp"
-#include "data/textures/car/car_red_1.hpp"
-#include "data/textures/car/car_yellow_1.hpp"
+// Embedded car texture (single grayscale base; paint colors are vertex tints applied at draw time)
+#include "data/textures/car/car_base_1.hpp"
 
 // Embedded sounds
 #include "data/sounds/car/engine.hpp"
@@ -33,42 +43,119 @@
 
 namespace assets::builder {
 
+namespace {
+
+/**
+ * @brief Parameter struct describing one embedded asset to decode. Holds pointer to the asset data and its size; the asset's id is its position in the entry array.
+ */
+struct EmbeddedEntry final {
+    /**
+     * @brief Pointer to the asset data in memory.
+     */
+    const unsigned char *data;
+
+    /**
+     * @brief Size (in bytes) of the asset data.
+     */
+    std::size_t size;
+};
+
+/**
+ * @brief Decode all embedded entries concurrently across a pool of worker threads.
+ *
+ * Workers pull entries from a shared atomic index, so the work is balanced regardless of per-asset decode cost. Decode failures leave the corresponding result default-constructed (i.e., empty); the manager's "load()" overloads reject those on the calling thread.
+ *
+ * @tparam Decoded Decoded asset type (e.g., "sf::Image", "sf::SoundBuffer"); must be default-constructible and movable.
+ * @tparam DecodeFunction Callable with the signature "Decoded(const EmbeddedEntry &)".
+ *
+ * @param entries Embedded entries to decode.
+ * @param decode_function Function that decodes a single entry; invoked from worker threads.
+ *
+ * @return Decoded assets, in the same order as the entries.
+ */
+template <typename Decoded, typename DecodeFunction>
+[[nodiscard]] core::memory::TrackedVector<Decoded, core::memory::Tag::Assets> decode_concurrently(const std::span<const EmbeddedEntry> entries,
+                                                                                                  const DecodeFunction &decode_function)
+{
+    core::memory::TrackedVector<Decoded, core::memory::Tag::Assets> results(entries.size());
+    std::atomic<std::size_t> next_entry_index = 0;
+    {
+        // Never spawn more workers than entries, and always spawn at least one even if "hardware_concurrency()" returns 0
+        const std::size_t worker_count = std::min(entries.size(), static_cast<std::size_t>(std::max(1u, std::thread::hardware_concurrency())));
+        std::vector<std::jthread> workers;
+        workers.reserve(worker_count);
+        for (std::size_t worker = 0; worker < worker_count; ++worker) {
+            workers.emplace_back([entries, &results, &next_entry_index, &decode_function]() {
+                for (std::size_t index = next_entry_index.fetch_add(1); index < entries.size(); index = next_entry_index.fetch_add(1)) {
+                    results[index] = decode_function(entries[index]);
+                }
+            });
+        }
+    }  // "std::jthread" joins on destruction, so every result is ready past this point
+    return results;
+}
+
+}  // namespace
+
 assets::textures::TextureManager build_texture_manager()
 {
-    assets::textures::TextureManager texture_manager;
+    // All embedded images, listed in "TextureId" order and decoded below across worker threads; PNG decompression dominates startup cost
+    static constexpr std::array<EmbeddedEntry, assets::textures::texture_count> entries = {{
+        // Road textures
+        {.data = road_sand89::data, .size = road_sand89::size},  // TextureId::TopLeft
+        {.data = road_sand01::data, .size = road_sand01::size},  // TextureId::TopRight
+        {.data = road_sand37::data, .size = road_sand37::size},  // TextureId::BottomRight
+        {.data = road_sand35::data, .size = road_sand35::size},  // TextureId::BottomLeft
+        {.data = road_sand87::data, .size = road_sand87::size},  // TextureId::Vertical
+        {.data = road_sand88::data, .size = road_sand88::size},  // TextureId::Horizontal
+        {.data = road_sand39::data, .size = road_sand39::size},  // TextureId::HorizontalFinish
+        // Car texture
+        {.data = car_base_1::data, .size = car_base_1::size},  // TextureId::Car
+    }};
 
-    // Road textures
-    texture_manager.load("top_left", {.data = road_sand89::data, .size = road_sand89::size});
-    texture_manager.load("top_right", {.data = road_sand01::data, .size = road_sand01::size});
-    texture_manager.load("bottom_right", {.data = road_sand37::data, .size = road_sand37::size});
-    texture_manager.load("bottom_left", {.data = road_sand35::data, .size = road_sand35::size});
-    texture_manager.load("vertical", {.data = road_sand87::data, .size = road_sand87::size});
-    texture_manager.load("horizontal", {.data = road_sand88::data, .size = road_sand88::size});
-    texture_manager.load("horizontal_finish", {.data = road_sand39::data, .size = road_sand39::size});
-
-    // Car textures
-    texture_manager.load("car_black", {.data = car_black_1::data, .size = car_black_1::size});
-    texture_manager.load("car_blue", {.data = car_blue_1::data, .size = car_blue_1::size});
-    texture_manager.load("car_green", {.data = car_green_1::data, .size = car_green_1::size});
-    texture_manager.load("car_red", {.data = car_red_1::data, .size = car_red_1::size});
-    texture_manager.load("car_yellow", {.data = car_yellow_1::data, .size = car_yellow_1::size});
+    core::memory::TrackedVector<sf::Image, core::memory::Tag::Assets> images = decode_concurrently<sf::Image>(
+        entries,
+        [](const EmbeddedEntry &entry) {
+            // On failure, the image stays empty; "load()" below turns it into an exception naming the id
+            sf::Image image;
+            static_cast<void>(image.loadFromMemory(entry.data, entry.size));
+            return image;
+        });
 
+    // Stage the decoded images from this thread; the caller packs them into the atlas once a GL context exists
+    assets::textures::TextureManager texture_manager;
+    for (std::size_t index = 0; index < entries.size(); ++index) {
+        texture_manager.load(static_cast<assets::textures::TextureId>(index), std::move(images[index]));
+    }
     return texture_manager;
 }
 
 assets::sounds::SoundManager build_sound_manager()
 {
-    assets::sounds::SoundManager sound_manager;
+    // All embedded sounds, listed in "SoundId" order and decoded below across worker threads
+    static constexpr std::array<EmbeddedEntry, assets::sounds::sound_count> entries = {{
+        // Car sounds
+        {.data = engine::data, .size = engine::size},  // SoundId::Engine
+        {.data = tires::data, .size = tires::size},    // SoundId::Tires
+        {.data = hit::data, .size = hit::size},        // SoundId::Hit
+        // UI sounds
+        {.data = ok::data, .size = ok::size},          // SoundId::Ok
+        {.data = other::data, .size = other::size},    // SoundId::Other
+    }};
 
-    // Car sounds
-    sound_manager.load("engine", {.data = engine::data, .size = engine::size});
-    sound_manager.load("tires", {.data = tires::data, .size = tires::size});
-    sound_manager.load("hit", {.data = hit::data, .size = hit::size});
-
-    // UI sounds
-    sound_manager.load("ok", {.data = ok::data, .size = ok::size});
-    sound_manager.load("other", {.data = other::data, .size = other::size});
+    core::memory::TrackedVector<sf::SoundBuffer, core::memory::Tag::Assets> sound_buffers = decode_concurrently<sf::SoundBuffer>(
+        entries,
+        [](const EmbeddedEntry &entry) {
+            // On failure, the buffer stays empty; "load()" below turns it into an exception naming the id
+            sf::SoundBuffer sound_buffer;
+            static_cast<void>(sound_buffer.loadFromMemory(entry.data, entry.size));
+            return sound_buffer;
+        });
 
+    assets::sounds::SoundManager sound_manager;
+    for (std::size_t index = 0; index < entries.size(); ++index) {
+        sound_manager.load(static_cast<assets::sounds::SoundId>(index), std::move(sound_buffers[index]));
+    }
     return sound_manager;
 }
 
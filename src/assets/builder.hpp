@@ -14,22 +14,22 @@
 namespace assets::builder {
 
 /**
- * @brief Build and return a TextureManager populated with all embedded textures.
+ * @brief Build and return a TextureManager with all embedded textures decoded and staged.
  *
- * Available texture identifiers:
- * - Road textures: "top_left", "top_right", "bottom_right", "bottom_left", "vertical", "horizontal", "horizontal_finish"
- * - Car textures: "car_black", "car_blue", "car_green", "car_red", "car_yellow"
+ * Images are decoded concurrently across worker threads, so this is safe (and intended) to run on a background thread via "std::async" while the window is being created.
  *
- * @return TextureManager instance with all game textures loaded and ready to use.
+ * Every enumerator of "assets::textures::TextureId" is staged, so lookups never fail.
+ *
+ * @return TextureManager instance with all game textures staged; the caller must call "pack()" on the main thread to build the atlas texture.
  */
 [[nodiscard]] assets::textures::TextureManager build_texture_manager();
 
 /**
  * @brief Build and return a SoundManager populated with all embedded sounds.
  *
- * Available sound identifiers:
- * - Car sounds: "engine", "tires", "hit"
- * - UI sounds: "ok", "other"
+ * Sounds are decoded concurrently across worker threads, so this is safe (and intended) to run on a background thread via "std::async" while the window is being created.
+ *
+ * Every enumerator of "assets::sounds::SoundId" is loaded, so lookups never fail.
  *
  * @return SoundManager instance with all game audio loaded and ready to use.
  */
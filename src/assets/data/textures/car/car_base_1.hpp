@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>  // for std::size_t
+
+namespace car_base_1 {
+
+constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x47, 0x08, 0x06, 0x00, 0x00, 0x00, 0x24, 0xE4, 0xF4, 0xC4, 0x00, 0x00, 0x07, 0x12, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0x5D, 0x3B, 0x4E, 0x34, 0x39, 0x10, 0xE6, 0x06, 0xFF, 0x11, 0xF6, 0x08, 0x7B, 0x84, 0xFF, 0x08, 0x7B, 0x84, 0x3D, 0xC2, 0x1E, 0x81, 0x94, 0x8C, 0x84, 0x00, 0xF1, 0x9A, 0x88, 0x88, 0x00, 0x08, 0x10, 0x22, 0x40, 0x2B, 0x81, 0x84, 0x44, 0x80, 0x08, 0x10, 0x24, 0x04, 0x40, 0xC0, 0xFB, 0x31, 0x88, 0xF7, 0x53, 0xFE, 0xE7, 0x1B, 0xE1, 0x91, 0xA7, 0xDA, 0xEE, 0xB6, 0xDD, 0x5D, 0xD3, 0x9E, 0x99, 0x2A, 0xA9, 0x12, 0xE8, 0xEE, 0xB1, 0xAB, 0x3E, 0x97, 0xAB, 0xAA, 0xDD, 0x55, 0x23, 0x23, 0x81, 0x34, 0x3D, 0x3D, 0xFD, 0xCF, 0xEC, 0xEC, 0xEC, 0x68, 0x8B, 0x17, 0xE7, 0xE6, 0xE6, 0xFE, 0x9F, 0x99, 0x99, 0x39, 0x6A, 0x34, 0x1A, 0xCA, 0xE4, 0xD6, 0xDF, 0x76, 0xF1, 0x3F, 0xF0, 0xCF, 0xB5, 0xA3, 0xB8, 0x6F, 0x6A, 0x6A, 0xEA, 0x37, 0x78, 0x6C, 0x6C, 0xEC, 0xD7, 0x88, 0x50, 0x86, 0x20, 0x17, 0x2D, 0x23, 0xB0, 0x96, 0x9D, 0x8B, 0x5B, 0x72, 0xFE, 0x57, 0x5F, 0xDB, 0xB3, 0x41, 0xE2, 0x47, 0x5B, 0x3F, 0xDE, 0xA0, 0x4A, 0xAF, 0x82, 0x09, 0x70, 0xC6, 0x6D, 0xE0, 0x99, 0x98, 0x98, 0xF8, 0xAB, 0x5F, 0x15, 0x8C, 0xB1, 0xEB, 0x79, 0xFC, 0xC8, 0x51, 0x2B, 0x73, 0x5C, 0xCF, 0xBB, 0xC5, 0xCD, 0x8A, 0x64, 0x79, 0xA4, 0x17, 0xE0, 0xE4, 0xE4, 0xE4, 0xDF, 0x95, 0x4E, 0xE4, 0x67, 0x02, 0x47, 0x1C, 0x20, 0x28, 0xC3, 0x86, 0x10, 0x35, 0x88, 0x1A, 0x8E, 0x95, 0xF3, 0x9F, 0xB9, 0xD2, 0xCA, 0x30, 0x51, 0xA4, 0xC9, 0x0D, 0x3A, 0x9E, 0x54, 0xE4, 0x04, 0xDD, 0x61, 0x8C, 0xA5, 0x17, 0x13, 0x97, 0x25, 0x10, 0xAE, 0x87, 0x01, 0x8A, 0xA8, 0xED, 0x39, 0x0F, 0xDD, 0xF3, 0xF3, 0xF3, 0x6A, 0x73, 0x73, 0x53, 0xED, 0xEF, 0xEF, 0xAB, 0xF3, 0xF3, 0x73, 0x75, 0x7B, 0x7B, 0xAB, 0x5C, 0x84, 0xFF, 0x83, 0x0F, 0x0F, 0x0F, 0xD5, 0xEE, 0xEE, 0x6E, 0x9B, 0x57, 0x57, 0x57, 0xDB, 0x8C, 0xE7, 0x88, 0x92, 0xB2, 0xBC, 0xBC, 0xBC, 0xDC, 0x91, 0xD1, 0xF6, 0xF6, 0x76, 0x47, 0x6E, 0x36, 0x86, 0x1E, 0x70, 0x1D, 0xEE, 0xF1, 0xB5, 0x14, 0xD8, 0x7E, 0x4B, 0x5B, 0x84, 0x85, 0x85, 0x85, 0xB6, 0x52, 0xDF, 0xDF, 0xDF, 0x55, 0x95, 0x84, 0xE7, 0x69, 0xD0, 0x00, 0x60, 0x3B, 0x3B, 0x3B, 0xED, 0x49, 0x2E, 0x2D, 0x2D, 0x75, 0xB8, 0x9F, 0x95, 0x0B, 0xD0, 0x6B, 0xE5, 0x82, 0x4D, 0x65, 0x9E, 0x9C, 0x9C, 0x14, 0x2E, 0xA8, 0x10, 0xC2, 0x73, 0x20, 0xC3, 0xF5, 0xF5, 0xF5, 0xDC, 0xC5, 0x86, 0x2D, 0xCF, 0x2B, 0x52, 0xB0, 0xDD, 0x0C, 0x84, 0x56, 0x0D, 0x82, 0x3C, 0xFA, 0xFE, 0xFE, 0x56, 0xCF, 0xCF, 0xCF, 0xEA, 0xE2, 0xE2, 0x42, 0x9D, 0x9E, 0x9E, 0x76, 0xF1, 0xF1, 0xF1, 0xB1, 0xDA, 0xDB, 0xDB, 0xEB, 0xE2, 0xAD, 0xAD, 0x2D, 0xB5, 0xB1, 0xB1, 0x91, 0xE1, 0xB5, 0xB5, 0xB5, 0x2E, 0x50, 0x95, 0x61, 0x3C, 0xCB, 0xF6, 0x1B, 0xF8, 0x6D, 0x73, 0x2C, 0x07, 0x07, 0x07, 0xEA, 0xE1, 0xE1, 0x41, 0x7D, 0x7E, 0x7E, 0xAA, 0x3A, 0x09, 0xFA, 0xC2, 0xE2, 0xC5, 0x22, 0x8E, 0x02, 0x84, 0x6D, 0x7B, 0xC0, 0x03, 0xEB, 0xA4, 0x8F, 0x8F, 0x0F, 0x75, 0x7F, 0x7F, 0x6F, 0x05, 0x46, 0x2A, 0x7C, 0x76, 0x76, 0xA6, 0xEE, 0xEE, 0xEE, 0xD4, 0xDB, 0xDB, 0x9B, 0x4A, 0x8D, 0x00, 0x0A, 0x58, 0x21, 0x1B, 0x20, 0x9C, 0x11, 0x07, 0x3C, 0x66, 0x9B, 0x45, 0x48, 0x89, 0x34, 0x30, 0x2E, 0x2F, 0x2F, 0x93, 0x00, 0x01, 0xCC, 0x32, 0x2C, 0x18, 0x2C, 0x59, 0xEA, 0x84, 0xB1, 0xD2, 0xAD, 0x03, 0x61, 0xBD, 0x97, 0xAF, 0x80, 0x1B, 0x7B, 0xB9, 0x35, 0x84, 0x12, 0xCC, 0x30, 0x14, 0xD1, 0x2B, 0x70, 0x60, 0xF5, 0x5F, 0x5F, 0x5F, 0xB7, 0xB7, 0x80, 0x14, 0x2D, 0x80, 0x0F, 0xC1, 0x47, 0xA1, 0x0B, 0xDE, 0x9A, 0xB0, 0x02, 0x4A, 0x52, 0xB6, 0x0A, 0x3E, 0x04, 0x25, 0x01, 0x20, 0x50, 0x18, 0x56, 0x02, 0x94, 0x07, 0x25, 0x86, 0x28, 0x1D, 0xDB, 0x11, 0xEE, 0x83, 0xD9, 0xC7, 0x73, 0x5E, 0x5E, 0x5E, 0x6A, 0xDF, 0xFF, 0xF3, 0x2C, 0x25, 0xE6, 0x6C, 0x72, 0x11, 0xC1, 0x39, 0x27, 0x21, 0x67, 0x23, 0x03, 0x06, 0x8A, 0x98, 0xAA, 0x3C, 0xDC, 0x94, 0x08, 0xE6, 0x9C, 0x0A, 0x2F, 0xC5, 0x55, 0xAE, 0x95, 0x0C, 0x20, 0x02, 0x90, 0x26, 0xB8, 0x7D, 0xAC, 0x20, 0xAE, 0x75, 0xCD, 0xEB, 0xF1, 0xF1, 0x91, 0x26, 0xF0, 0x9A, 0x85, 0x60, 0x10, 0xEA, 0xAD, 0xF2, 0x39, 0xB6, 0x3A, 0x6C, 0xA1, 0x36, 0xA2, 0x79, 0x89, 0xAE, 0x64, 0x14, 0x75, 0x1E, 0x11, 0x8E, 0x08, 0xF5, 0x96, 0x42, 0xB7, 0x33, 0x5F, 0xC6, 0xB6, 0x49, 0x09, 0x2E, 0x80, 0xD3, 0x6F, 0xA0, 0xF9, 0x05, 0x24, 0x2D, 0x42, 0xF6, 0x29, 0x5F, 0xC6, 0xBD, 0x83, 0x46, 0xF0, 0x27, 0x30, 0xAF, 0xD7, 0xD7, 0xD7, 0x8E, 0x59, 0x8F, 0xF1, 0x31, 0x60, 0xDA, 0x39, 0xC0, 0x00, 0x1F, 0x88, 0x12, 0x0D, 0x35, 0xBB, 0x72, 0x0E, 0xC8, 0x5B, 0x9B, 0xFF, 0xC4, 0xC5, 0x2E, 0xC2, 0xBE, 0x15, 0x3B, 0x30, 0x38, 0x65, 0x60, 0x98, 0x2F, 0x08, 0x0D, 0xA8, 0x85, 0x00, 0x21, 0xCC, 0xAF, 0xAF, 0xAF, 0xE4, 0x15, 0x8F, 0xE8, 0x4A, 0x3B, 0xA8, 0x98, 0x83, 0x9E, 0x0F, 0x65, 0xCC, 0x29, 0x94, 0xF0, 0x5C, 0xAE, 0x48, 0x88, 0x8E, 0x87, 0x82, 0x01, 0xFA, 0xEF, 0x29, 0x18, 0x90, 0x76, 0x75, 0x09, 0x4F, 0x73, 0xEA, 0x96, 0xA3, 0xD9, 0x6C, 0x16, 0xCE, 0x21, 0x16, 0x0C, 0x70, 0x6E, 0xB9, 0xC0, 0x00, 0xF0, 0xD2, 0x77, 0x46, 0x04, 0x0C, 0x8B, 0x51, 0x60, 0x88, 0x75, 0x74, 0x74, 0xB8, 0x96, 0xC7, 0xA9, 0x86, 0x70, 0x9A, 0x20, 0x54, 0x1F, 0x30, 0x50, 0xE1, 0xFB, 0x52, 0x19, 0xAB, 0x1B, 0xB2, 0x55, 0x50, 0x30, 0x20, 0xF3, 0x1C, 0x05, 0x86, 0x32, 0xE9, 0xDA, 0x3C, 0xC6, 0xAA, 0x4B, 0x9D, 0xB0, 0xE2, 0x7D, 0xC0, 0x00, 0x8E, 0xC9, 0x4A, 0x22, 0xEC, 0xE3, 0xB2, 0x0E, 0xE6, 0x78, 0x68, 0x78, 0x09, 0x76, 0xBE, 0x93, 0x00, 0x72, 0x5C, 0xCE, 0x63, 0xCC, 0x40, 0x60, 0x4D, 0x8A, 0x84, 0x87, 0x01, 0xF6, 0x43, 0x52, 0xCB, 0x17, 0x0C, 0x31, 0x5B, 0x1E, 0x2C, 0x23, 0xD7, 0x3B, 0x18, 0xBA, 0x75, 0x95, 0x06, 0x43, 0xAC, 0x93, 0xE3, 0xB3, 0x45, 0x70, 0x27, 0x7F, 0xE0, 0xA0, 0x42, 0x41, 0x79, 0x5C, 0xB4, 0x9A, 0x71, 0x8D, 0x2F, 0x18, 0x62, 0x53, 0xF9, 0xB8, 0xB7, 0x17, 0x7E, 0x83, 0x13, 0x0C, 0xBE, 0x09, 0x27, 0x3C, 0xB0, 0x4C, 0x14, 0x91, 0xC7, 0x9C, 0xD1, 0x04, 0xAC, 0x8E, 0xCF, 0x18, 0xB0, 0x55, 0xE5, 0x81, 0x32, 0x04, 0x0C, 0x31, 0x4E, 0x64, 0x19, 0x19, 0x87, 0x26, 0xA0, 0x4A, 0x83, 0x21, 0xC6, 0xC1, 0x81, 0xD9, 0xF3, 0x11, 0x1E, 0x17, 0x21, 0xFE, 0xF7, 0x55, 0x60, 0x11, 0x30, 0x61, 0x39, 0x7C, 0x9F, 0xF1, 0xF4, 0xF4, 0x14, 0xED, 0x97, 0x70, 0x80, 0x01, 0xBA, 0x2B, 0x78, 0x47, 0x31, 0x9A, 0xC9, 0x3E, 0xE2, 0x34, 0x4E, 0x95, 0x60, 0xB8, 0xBA, 0xBA, 0x2A, 0x14, 0x9C, 0x2B, 0x6D, 0xDA, 0x6B, 0xA7, 0xCF, 0x67, 0x55, 0xE7, 0xE5, 0x17, 0xAA, 0x88, 0x28, 0x62, 0x9D, 0xF4, 0x50, 0x30, 0x58, 0x73, 0x0D, 0xDC, 0x60, 0xB8, 0xB9, 0xB9, 0x29, 0x14, 0x9C, 0x2D, 0x65, 0x5A, 0x27, 0x18, 0xF2, 0xA2, 0x01, 0xDF, 0xF0, 0xB2, 0x0C, 0xC0, 0xB9, 0x52, 0xD3, 0x26, 0xE1, 0xD0, 0x52, 0xE6, 0xED, 0x65, 0x08, 0x18, 0xB8, 0xFC, 0x85, 0xD8, 0xFD, 0x95, 0x13, 0x0C, 0x2E, 0x07, 0xD0, 0x17, 0x0C, 0x65, 0xB6, 0x3E, 0xAE, 0x7C, 0x43, 0x61, 0xAE, 0x81, 0x13, 0x0C, 0x3E, 0x59, 0xC7, 0x32, 0x9E, 0x37, 0x27, 0x18, 0x5C, 0x00, 0x0D, 0x01, 0x43, 0xAC, 0x53, 0xCC, 0x15, 0x51, 0x14, 0x82, 0x01, 0x1F, 0x9A, 0xF8, 0x1E, 0x6A, 0xE1, 0x72, 0x1E, 0x39, 0xD3, 0xD0, 0xB1, 0x60, 0x70, 0x39, 0x80, 0xF8, 0x3B, 0x67, 0xAE, 0x81, 0x33, 0xA2, 0x30, 0xB7, 0x3E, 0x2B, 0x18, 0x7C, 0xB3, 0x8F, 0x08, 0xB9, 0x38, 0xF2, 0x0B, 0xB1, 0xD9, 0x3A, 0x6E, 0x30, 0xB8, 0x1C, 0xC0, 0x90, 0xE7, 0xC5, 0x82, 0x81, 0xEB, 0xA5, 0x95, 0x19, 0x36, 0x27, 0x0B, 0x86, 0x54, 0x52, 0xC8, 0x3E, 0x0E, 0x60, 0xC8, 0xF3, 0x62, 0x13, 0x69, 0x31, 0xB2, 0x4E, 0x1E, 0x0C, 0x78, 0x47, 0xDF, 0xAF, 0x60, 0x70, 0x8D, 0x2B, 0xE4, 0x79, 0xB1, 0x8E, 0x31, 0xD7, 0x1B, 0xCC, 0x5A, 0xC1, 0xC0, 0xED, 0x75, 0x0F, 0x2A, 0x18, 0xB8, 0x72, 0x0D, 0xE6, 0x78, 0x04, 0x0C, 0x43, 0x0E, 0x06, 0xD3, 0x0F, 0x12, 0x30, 0x08, 0x18, 0x04, 0x0C, 0x02, 0x06, 0x01, 0x83, 0x80, 0x41, 0xC0, 0x20, 0x60, 0x10, 0x30, 0x08, 0x18, 0x04, 0x0C, 0x02, 0x06, 0x01, 0x83, 0x80, 0xA1, 0xDF, 0xC0, 0x20, 0x19, 0xC8, 0x74, 0xC1, 0x60, 0x3D, 0xDC, 0x22, 0xEF, 0x26, 0x86, 0xE7, 0xDD, 0x44, 0x65, 0x60, 0x88, 0x39, 0x26, 0x2F, 0x6F, 0x2D, 0x3F, 0xA2, 0xC7, 0x9C, 0x34, 0x18, 0xE4, 0x3C, 0x43, 0xFF, 0x9F, 0x67, 0x08, 0x06, 0x43, 0x95, 0x87, 0x5B, 0xE4, 0xA4, 0x53, 0x5A, 0x27, 0x9D, 0x4C, 0x30, 0xE0, 0x4B, 0xFB, 0xCC, 0x97, 0xD8, 0x21, 0xC7, 0xDE, 0x62, 0x0E, 0x6A, 0xCA, 0x19, 0xC8, 0x74, 0xCE, 0x40, 0x9A, 0x72, 0x86, 0x9E, 0x33, 0x35, 0x1A, 0xE4, 0x74, 0xF4, 0xF0, 0x9C, 0x8E, 0x36, 0x1D, 0xDA, 0x5A, 0xC0, 0x20, 0xDF, 0x4D, 0xA4, 0x11, 0x56, 0xD2, 0xEF, 0x26, 0xAC, 0x60, 0x40, 0x61, 0x48, 0xDF, 0x12, 0x3E, 0x31, 0xD5, 0x45, 0x06, 0xE9, 0x8B, 0x2A, 0xBD, 0x9F, 0x73, 0x7E, 0x51, 0xC5, 0x15, 0x56, 0x52, 0x30, 0xD0, 0xBA, 0x4E, 0x9D, 0x52, 0x3E, 0x83, 0xFE, 0xAD, 0xA5, 0x6F, 0x04, 0x30, 0xC8, 0xDF, 0x5A, 0xD2, 0x05, 0xE7, 0xFC, 0xD6, 0x92, 0xF6, 0x94, 0x70, 0x95, 0xFD, 0x8B, 0x8D, 0x7F, 0xE5, 0x2B, 0x6C, 0x7F, 0xC2, 0x36, 0x54, 0xEB, 0x57, 0xD8, 0x52, 0x9F, 0xC1, 0x8F, 0xA0, 0xE0, 0x81, 0xAF, 0xCF, 0x40, 0x4B, 0x05, 0x4B, 0xE5, 0x96, 0xF2, 0xCE, 0x68, 0x4C, 0x56, 0x95, 0x2B, 0xF3, 0x08, 0x36, 0x4B, 0x24, 0xE5, 0x56, 0x6E, 0x91, 0x9A, 0x4E, 0xFE, 0xFB, 0x39, 0x67, 0x24, 0xC1, 0xE5, 0x2F, 0x60, 0x31, 0x9A, 0x94, 0x5B, 0xD3, 0x89, 0xD6, 0x81, 0xAC, 0x3A, 0xBC, 0x1C, 0x94, 0x6A, 0x6F, 0xBE, 0x61, 0x65, 0xAC, 0xF3, 0xC8, 0x55, 0x10, 0x9D, 0x86, 0xEE, 0xB9, 0xD5, 0xDE, 0xB8, 0x73, 0x0D, 0x83, 0x52, 0x07, 0x12, 0x61, 0x2A, 0x57, 0x1D, 0x48, 0x58, 0x45, 0xAE, 0x2D, 0x82, 0x26, 0xF5, 0xD0, 0xAD, 0xC6, 0x59, 0x07, 0x32, 0x04, 0x0C, 0x52, 0x21, 0x36, 0xAB, 0xC4, 0x2A, 0x2A, 0xC4, 0x72, 0x7D, 0x5F, 0x19, 0x5C, 0x21, 0x56, 0x6A, 0x47, 0xD7, 0x4F, 0x5C, 0xE5, 0x82, 0x83, 0x6B, 0x47, 0x4B, 0x55, 0xF9, 0xFA, 0xAD, 0x4B, 0x2F, 0xAB, 0xCA, 0xD3, 0x54, 0x74, 0xA6, 0xEF, 0x25, 0x05, 0x43, 0x3F, 0xC4, 0xFD, 0xA1, 0x24, 0xFD, 0x26, 0x0A, 0xC2, 0x4A, 0x57, 0x27, 0x9A, 0xBC, 0xF0, 0x32, 0x55, 0x92, 0x4E, 0x34, 0xC5, 0xC0, 0xB6, 0x1C, 0x6A, 0x59, 0xB4, 0xF5, 0xA8, 0x1A, 0x97, 0x1E, 0x55, 0x83, 0xDD, 0xA3, 0x0A, 0x0B, 0xC4, 0xAB, 0xA5, 0xA1, 0x74, 0xAF, 0x1B, 0xBE, 0xEE, 0x75, 0xD6, 0x96, 0x44, 0xD2, 0xD7, 0x72, 0xF0, 0xFB, 0x5A, 0xDA, 0x3A, 0xE0, 0xE6, 0xB6, 0x42, 0xB6, 0x59, 0x87, 0x3A, 0xFC, 0x07, 0x6C, 0x01, 0x26, 0x00, 0x42, 0xBA, 0xDC, 0x56, 0xD5, 0xE1, 0xD6, 0xC6, 0xBE, 0x1D, 0x6F, 0xB1, 0x0A, 0x53, 0xEF, 0x78, 0x6B, 0xED, 0x5A, 0x17, 0xDA, 0x0B, 0xBB, 0x4A, 0x82, 0x67, 0x6B, 0x36, 0x4E, 0x47, 0x09, 0xDB, 0x95, 0x95, 0x95, 0xBE, 0xEF, 0x7F, 0x6D, 0x6B, 0x74, 0x8E, 0x03, 0xA8, 0x5C, 0x3D, 0xB0, 0xCD, 0xAD, 0xC0, 0xA7, 0x17, 0xB6, 0x17, 0x10, 0x5C, 0x91, 0x05, 0x75, 0x2C, 0xA1, 0x34, 0xFC, 0x28, 0x26, 0x94, 0xE7, 0x64, 0x62, 0x70, 0x54, 0xD9, 0x10, 0x8C, 0x0B, 0xAD, 0xC3, 0xCC, 0x90, 0x89, 0xD9, 0x40, 0x1D, 0xFE, 0x9A, 0xD9, 0x44, 0xDD, 0xC6, 0x5A, 0x9E, 0xF4, 0xD4, 0x52, 0x1E, 0x23, 0x50, 0x18, 0x09, 0x21, 0xB4, 0xB6, 0x73, 0x59, 0x08, 0xE1, 0xFE, 0x64, 0xF8, 0x83, 0x99, 0xE4, 0x52, 0x08, 0xA1, 0x60, 0x28, 0x3C, 0xCE, 0x54, 0x26, 0x63, 0x32, 0x10, 0x8E, 0x17, 0x2C, 0x94, 0xE1, 0x14, 0xC1, 0xF7, 0xE1, 0x60, 0xDB, 0xEF, 0x61, 0x1C, 0x74, 0x6C, 0x29, 0x81, 0x00, 0x8B, 0xDA, 0xDA, 0xE2, 0x38, 0x86, 0x60, 0x25, 0x10, 0x8B, 0xD2, 0xA3, 0x71, 0x55, 0x2B, 0x59, 0x0B, 0x57, 0x0B, 0xBE, 0x14, 0x8A, 0x13, 0x22, 0x3D, 0x1F, 0xC8, 0xD0, 0x02, 0x9E, 0x66, 0xC5, 0xB2, 0x6C, 0xEA, 0x85, 0x82, 0x45, 0xD1, 0xD5, 0xBC, 0xB4, 0x6A, 0x82, 0x82, 0x60, 0x2D, 0x80, 0x36, 0xDF, 0x15, 0xE0, 0x52, 0xF6, 0x88, 0x90, 0x15, 0x34, 0x05, 0x56, 0xA8, 0x8B, 0x01, 0x30, 0x7D, 0x7D, 0x15, 0x8A, 0xFF, 0x03, 0x75, 0x32, 0x94, 0xE5, 0x95, 0x23, 0x83, 0x55, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
+
+constexpr std::size_t size = sizeof(data);
+
+}  // namespace car_base_1
@@ -1,11 +0,0 @@
-#pragma once
-
-#include <cstddef>  // for std::size_t
-
-namespace car_black_1 {
-
-constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x47, 0x08, 0x06, 0x00, 0x00, 0x00, 0x24, 0xE4, 0xF4, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0x44, 0x65, 0x58, 0x49, 0x66, 0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0xA0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x6B, 0x38, 0x00, 0x00, 0x0F, 0x46, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x5D, 0x5D, 0x6C, 0x54, 0xC7, 0x15, 0x9E, 0x5D, 0xDB, 0xFC, 0x18, 0x63, 0x0C, 0x06, 0x51, 0x62, 0x04, 0x16, 0x81, 0x14, 0xAB, 0x01, 0xB9, 0xD8, 0x84, 0x1F, 0x01, 0xD9, 0xA7, 0x92, 0x9F, 0x87, 0xD2, 0xA8, 0x52, 0xD3, 0x26, 0x51, 0x5D, 0x55, 0x44, 0x79, 0x68, 0x05, 0xE9, 0x6B, 0xA5, 0x94, 0x4A, 0x28, 0x6F, 0x55, 0x88, 0xFA, 0x16, 0xA4, 0xD6, 0x55, 0x42, 0x93, 0xAA, 0x52, 0x4A, 0x1F, 0xC2, 0x9F, 0xA2, 0x74, 0x09, 0x28, 0x85, 0x24, 0xC0, 0xF6, 0x21, 0x82, 0x06, 0x84, 0x16, 0x14, 0x40, 0x29, 0xD8, 0x18, 0x30, 0xFE, 0xC1, 0xEC, 0x6E, 0xCF, 0x37, 0xF6, 0x5C, 0xCE, 0xBD, 0x9E, 0x7B, 0xEF, 0xCC, 0xEE, 0xDE, 0xDD, 0x6B, 0xD8, 0x23, 0xDD, 0xBD, 0x73, 0xCF, 0xCC, 0x9D, 0x9F, 0x33, 0xDF, 0x9C, 0x39, 0x33, 0xB3, 0x77, 0x26, 0x21, 0x2C, 0x69, 0x5D, 0x77, 0xF7, 0x0F, 0x13, 0xF9, 0x7C, 0x67, 0x21, 0x91, 0xE8, 0x4C, 0x08, 0xD1, 0x42, 0xAF, 0xB7, 0x27, 0x93, 0xC9, 0x76, 0x1E, 0x4D, 0xA1, 0x50, 0xC8, 0xD0, 0x35, 0x20, 0x79, 0x85, 0x42, 0x1A, 0xF7, 0x42, 0x32, 0x99, 0x49, 0x26, 0x12, 0x92, 0xF7, 0x6D, 0x5F, 0x5F, 0xE6, 0xE2, 0xC5, 0x8B, 0xB7, 0xA4, 0x7F, 0xED, 0xC7, 0x91, 0xC0, 0xB2, 0x65, 0xCB, 0xE6, 0x2C, 0x6C, 0x6D, 0xED, 0x54, 0x8C, 0x42, 0x2E, 0x97, 0x52, 0x6E, 0xDD, 0x3D, 0x9F, 0xCF, 0x67, 0xEB, 0x1A, 0x1A, 0xB2, 0xF0, 0xFB, 0xF7, 0x17, 0x5F, 0x1C, 0xD5, 0x85, 0xB1, 0xE1, 0x51, 0x7D, 0x86, 0xD3, 0x53, 0x9D, 0x9D, 0x3F, 0xAF, 0xAF, 0xAB, 0x4B, 0x89, 0x64, 0xB2, 0x27, 0x3C, 0xB4, 0x5D, 0x08, 0x0E, 0x1C, 0x02, 0x58, 0x86, 0x80, 0x26, 0x01, 0xC3, 0xC1, 0x93, 0x18, 0x1C, 0xCC, 0x7E, 0x76, 0xF6, 0xEC, 0x25, 0xBB, 0x98, 0xE3, 0x11, 0x7A, 0x63, 0x47, 0xC7, 0xD2, 0x42, 0x53, 0x53, 0x3B, 0x72, 0x93, 0x1B, 0x1B, 0x73, 0x1A, 0x0E, 0x95, 0xAF, 0x25, 0x51, 0x28, 0xC8, 0x8A, 0x4F, 0x0A, 0xD1, 0x49, 0xB2, 0x6D, 0x29, 0x35, 0xC7, 0x00, 0x07, 0xC5, 0x91, 0x15, 0xD4, 0x00, 0x47, 0x47, 0x47, 0xF7, 0x9F, 0xF9, 0xEA, 0xAB, 0xFF, 0xD8, 0xC4, 0x19, 0x08, 0x86, 0x0D, 0x6B, 0xD7, 0x3E, 0x5D, 0xC8, 0xE7, 0x7B, 0xBD, 0x2D, 0xDF, 0x26, 0x81, 0x28, 0xC2, 0x52, 0xA1, 0xD3, 0x3C, 0x5E, 0x12, 0x66, 0x36, 0x5F, 0x28, 0x64, 0x39, 0x0F, 0x6E, 0x02, 0xD7, 0x00, 0xE5, 0x3D, 0xE3, 0xE5, 0x17, 0xF3, 0xCC, 0x2B, 0x92, 0xBF, 0x4F, 0xDA, 0xAE, 0x3D, 0x4F, 0xDA, 0xD1, 0xC5, 0x4B, 0x26, 0x53, 0xFC, 0xB9, 0x5A, 0x6E, 0x09, 0x8E, 0x42, 0xA1, 0x37, 0x39, 0x3C, 0xDC, 0x6B, 0xD2, 0x98, 0x7C, 0xC1, 0xB0, 0xB1, 0xAB, 0xEB, 0xCF, 0x51, 0x68, 0x82, 0x6A, 0x09, 0xE6, 0x51, 0x4F, 0x37, 0x9F, 0xCB, 0xED, 0xFA, 0xDF, 0xC0, 0xC0, 0x9E, 0xA0, 0xEE, 0x59, 0x0B, 0x86, 0xF5, 0x5D, 0x5D, 0xFF, 0xA2, 0x16, 0x95, 0xD2, 0x09, 0x90, 0xF8, 0x62, 0x56, 0x53, 0x93, 0x98, 0x36, 0x7D, 0xBA, 0x98, 0x4E, 0x17, 0x9E, 0xA7, 0xCF, 0x98, 0xA1, 0x0B, 0x2A, 0x86, 0x87, 0x86, 0x24, 0x7F, 0x6C, 0x6C, 0x4C, 0xDC, 0xBF, 0x7F, 0x5F, 0xBA, 0x15, 0xEF, 0xDE, 0xE8, 0xA8, 0x20, 0xE4, 0x6A, 0xDF, 0x7B, 0x94, 0x99, 0x90, 0x2B, 0x64, 0x0A, 0x92, 0xF2, 0xAD, 0xAB, 0xF3, 0x15, 0xC7, 0x7D, 0x92, 0x2B, 0x64, 0x0B, 0x39, 0x42, 0x9E, 0x61, 0x04, 0x4D, 0x41, 0xDA, 0x72, 0xE7, 0xC9, 0x2F, 0xBF, 0xFC, 0xA7, 0x2E, 0xEC, 0x24, 0x30, 0xF8, 0x69, 0x84, 0xFA, 0xFA, 0x7A, 0x31, 0xB7, 0xB5, 0x55, 0x02, 0xA1, 0x2E, 0x20, 0x83, 0xBA, 0x44, 0x82, 0x78, 0xB9, 0x5C, 0xCE, 0x29, 0x08, 0xF5, 0x73, 0x02, 0xCF, 0x63, 0xF7, 0xEE, 0x39, 0x3C, 0xBC, 0x8B, 0x02, 0x4F, 0x55, 0x42, 0xC5, 0xA2, 0x82, 0x15, 0xCD, 0x6C, 0x6C, 0x54, 0x4E, 0xA7, 0x31, 0x05, 0x35, 0x28, 0x27, 0xB0, 0x81, 0x63, 0x74, 0x64, 0x44, 0x0C, 0x0F, 0x0F, 0xCB, 0x46, 0x38, 0x42, 0x77, 0xBF, 0xC6, 0x46, 0x20, 0xEA, 0xF9, 0x3C, 0x93, 0xF9, 0x8B, 0x37, 0x4A, 0x17, 0x18, 0x30, 0x52, 0xA8, 0x4B, 0x24, 0xF6, 0x7B, 0x03, 0xCD, 0x69, 0x69, 0x91, 0x40, 0x28, 0x27, 0x08, 0xBC, 0x69, 0xF0, 0x67, 0x32, 0x2A, 0x25, 0x00, 0x50, 0x38, 0xB8, 0x39, 0xA1, 0x80, 0x4A, 0xCB, 0x28, 0x3E, 0x5A, 0x88, 0x37, 0x1C, 0xFC, 0x00, 0x2C, 0x52, 0x8F, 0x2A, 0x58, 0x49, 0xF7, 0x24, 0x35, 0x00, 0x5D, 0xF9, 0x13, 0x89, 0x84, 0xA8, 0x6F, 0x68, 0x70, 0xE2, 0x46, 0xC5, 0xCE, 0x9A, 0x35, 0x4B, 0x34, 0x4C, 0x9B, 0xE6, 0xB4, 0x70, 0xC7, 0xB3, 0x82, 0x0E, 0x94, 0xFD, 0xEE, 0xE0, 0xA0, 0xB8, 0xD9, 0xD7, 0x37, 0x49, 0x5E, 0xC8, 0x86, 0x0E, 0x10, 0x2E, 0x30, 0xE8, 0xBA, 0x87, 0x05, 0x0B, 0x17, 0x8A, 0xE6, 0x39, 0x73, 0x2A, 0x58, 0x0C, 0x77, 0x52, 0x4A, 0x53, 0x40, 0x3B, 0xE8, 0x2A, 0xDC, 0x1D, 0xBA, 0x7A, 0x4F, 0x0D, 0x04, 0x08, 0x00, 0x00, 0x1A, 0x34, 0x4E, 0x04, 0xF9, 0x2D, 0x7F, 0xFC, 0x71, 0xF1, 0xF1, 0x91, 0x23, 0x93, 0xB2, 0x45, 0x5D, 0x76, 0x27, 0x1F, 0x71, 0x8C, 0x77, 0x4E, 0x14, 0x0C, 0x23, 0x07, 0x42, 0x75, 0x8A, 0xBF, 0x01, 0x8D, 0x50, 0x4D, 0x20, 0x20, 0x2F, 0x68, 0x8D, 0x33, 0x66, 0xCE, 0x14, 0xB3, 0x9B, 0x9B, 0xC7, 0x6D, 0x95, 0x2A, 0xB7, 0x38, 0x2E, 0x1F, 0x54, 0xBC, 0xCA, 0x1B, 0xD4, 0x7F, 0xDC, 0x80, 0x80, 0xBC, 0x7E, 0xEF, 0xC9, 0x27, 0xC5, 0xEF, 0x77, 0xEF, 0x16, 0xBD, 0xEF, 0xBD, 0x27, 0x9A, 0xC8, 0xD6, 0xE3, 0x44, 0x79, 0xEF, 0xE5, 0xCF, 0x0E, 0x18, 0x68, 0x7C, 0xDF, 0xE3, 0xF2, 0x20, 0x75, 0x07, 0x1B, 0x21, 0x4E, 0xA4, 0x80, 0xD1, 0x34, 0x7B, 0xB6, 0xC0, 0x85, 0x8A, 0x98, 0x56, 0x41, 0x70, 0x20, 0x7D, 0x18, 0x75, 0x8D, 0xD4, 0x0D, 0xA0, 0x91, 0xE0, 0x8E, 0xF4, 0xD1, 0x55, 0xC4, 0x91, 0x1A, 0x09, 0xA0, 0xDB, 0x5F, 0x7D, 0x55, 0x66, 0x6D, 0xC5, 0x13, 0x4F, 0x88, 0xDF, 0xBE, 0xF1, 0x86, 0x2B, 0x9B, 0x94, 0xEF, 0x4E, 0x28, 0x01, 0xC5, 0x74, 0x74, 0xDA, 0xC4, 0x8C, 0xA2, 0xE2, 0xCB, 0x96, 0xA8, 0xEB, 0x23, 0x9D, 0x00, 0x55, 0x76, 0x48, 0xC3, 0x8C, 0x2A, 0x82, 0x13, 0x6C, 0x09, 0xD8, 0x14, 0x34, 0x37, 0x22, 0xED, 0x05, 0x74, 0x2B, 0x50, 0x93, 0x36, 0x84, 0x8A, 0x45, 0xDC, 0xCE, 0x35, 0x61, 0x2B, 0xE0, 0x39, 0x6E, 0x84, 0xB2, 0x79, 0xBB, 0x4E, 0xAE, 0x9D, 0x36, 0x6D, 0xDE, 0x2C, 0x16, 0x2C, 0x58, 0xE0, 0x64, 0x7B, 0x4B, 0x2A, 0x25, 0x9E, 0x7D, 0xFE, 0x79, 0x71, 0xF0, 0xA3, 0x8F, 0x1C, 0xDE, 0x84, 0x12, 0x38, 0x0A, 0x86, 0x03, 0xE9, 0x8D, 0x6B, 0xD7, 0xBA, 0x2C, 0xB5, 0xC5, 0x4B, 0x96, 0xF8, 0x0E, 0x19, 0x9D, 0x98, 0xA6, 0x98, 0xC3, 0x0F, 0x1C, 0x5C, 0x80, 0x71, 0x28, 0x92, 0xAA, 0x64, 0xE4, 0x57, 0x19, 0xC0, 0x2E, 0x1E, 0x81, 0x3D, 0x88, 0x50, 0x1E, 0x8C, 0x60, 0x9A, 0xA9, 0x6B, 0xFD, 0xC3, 0x5B, 0x6F, 0x49, 0x83, 0x56, 0x85, 0xBF, 0x76, 0xF5, 0xAA, 0xF8, 0xF1, 0xB6, 0x6D, 0xEA, 0x51, 0x50, 0xEB, 0x19, 0xF8, 0xEC, 0xD4, 0xA9, 0xB9, 0x60, 0xF8, 0xC2, 0xDD, 0x6F, 0xEE, 0xE0, 0x41, 0x2C, 0x53, 0xCF, 0x25, 0x2D, 0x7F, 0x12, 0x14, 0x84, 0xC5, 0xAF, 0x6A, 0x97, 0x04, 0x15, 0x3D, 0x78, 0xE7, 0x8E, 0xB8, 0x7D, 0xEB, 0x96, 0xBC, 0x30, 0x0A, 0x18, 0xBA, 0x7B, 0x57, 0x0E, 0x11, 0x31, 0xDC, 0xC6, 0x05, 0xAD, 0x87, 0x70, 0x7E, 0xC3, 0x45, 0x5E, 0x06, 0x84, 0xC5, 0xFB, 0xFD, 0x34, 0x92, 0x38, 0x72, 0xF8, 0x30, 0xF7, 0x12, 0x8B, 0x1E, 0x7B, 0x4C, 0x2C, 0x5F, 0xB1, 0xE2, 0x01, 0x8F, 0xA6, 0xC1, 0xB1, 0x26, 0x02, 0x86, 0xEC, 0x26, 0x78, 0xBF, 0x21, 0x99, 0x24, 0xAC, 0x1A, 0x95, 0x2E, 0x81, 0xF9, 0xF3, 0xE7, 0x8B, 0xF9, 0xA4, 0xA6, 0x97, 0x90, 0x96, 0xC5, 0x70, 0x13, 0x77, 0xD8, 0x19, 0x1D, 0x1D, 0x1D, 0x32, 0xF2, 0xDF, 0xEC, 0xDC, 0x29, 0x6E, 0xDC, 0xB8, 0x21, 0x8D, 0x64, 0x93, 0x4A, 0xB6, 0xCD, 0xD1, 0x3D, 0x9A, 0xAF, 0xF9, 0xDB, 0x07, 0x1F, 0x08, 0x6F, 0x77, 0xB1, 0xA6, 0xAB, 0x4B, 0x5C, 0x38, 0x7F, 0xDE, 0x89, 0x0E, 0x8B, 0x63, 0x34, 0x33, 0x79, 0x54, 0xD6, 0x3A, 0xCD, 0xEB, 0xB7, 0xD0, 0xFC, 0x82, 0xE3, 0xC9, 0x27, 0x49, 0x1C, 0xE6, 0x84, 0x43, 0xA9, 0x2B, 0x2F, 0xDF, 0xE4, 0x79, 0xE5, 0xCA, 0x95, 0xE2, 0xC2, 0x85, 0x0B, 0x26, 0x41, 0xA7, 0x4C, 0x98, 0xB6, 0xB6, 0x36, 0x31, 0x93, 0x0C, 0xD9, 0xB6, 0xC5, 0x8B, 0xE5, 0x1D, 0xAD, 0x0E, 0x20, 0xA0, 0xD6, 0x16, 0x5A, 0x86, 0x1F, 0xBD, 0xF0, 0x82, 0xD8, 0xFB, 0xCE, 0x3B, 0x32, 0x1C, 0x34, 0x95, 0x77, 0xFE, 0x24, 0x34, 0x02, 0x83, 0x00, 0x98, 0xAB, 0xD9, 0x47, 0x23, 0x89, 0x9D, 0xAF, 0xBF, 0xEE, 0x84, 0x86, 0xF1, 0xCD, 0x09, 0xEB, 0x2E, 0xF4, 0x3C, 0x0E, 0x06, 0x2C, 0x49, 0x13, 0x3C, 0x1D, 0xFF, 0xA0, 0x2E, 0x02, 0x33, 0x5B, 0x00, 0x44, 0x31, 0xF4, 0xEB, 0x1D, 0x3B, 0xE4, 0x6B, 0x7D, 0xA4, 0xBE, 0xFA, 0xFB, 0xFB, 0xC5, 0x95, 0x6F, 0xBE, 0x91, 0x33, 0x66, 0x40, 0x29, 0x9E, 0x71, 0xC5, 0x99, 0x56, 0xAD, 0x5A, 0x25, 0x55, 0x2C, 0x2A, 0x7E, 0xDE, 0xBC, 0x79, 0xA2, 0xD5, 0x67, 0xB4, 0x35, 0xC3, 0x67, 0x7A, 0xDE, 0x5B, 0xB6, 0x95, 0x13, 0x1A, 0x02, 0x7C, 0x4C, 0x5C, 0x45, 0x01, 0x06, 0xD8, 0x1D, 0x27, 0x4F, 0x9C, 0x10, 0x67, 0xCF, 0x9E, 0x75, 0x34, 0x92, 0x37, 0x1F, 0x64, 0x1C, 0xB7, 0xCB, 0x3C, 0x78, 0x3D, 0xA2, 0x7A, 0xFE, 0xFE, 0x9A, 0x35, 0x4E, 0xD4, 0x10, 0x22, 0xAE, 0x15, 0xBC, 0xEF, 0x22, 0x5F, 0x8C, 0x83, 0xAF, 0x92, 0x81, 0x33, 0x44, 0x6B, 0x1A, 0xE7, 0x28, 0xF3, 0xD7, 0xAF, 0x5F, 0x97, 0x6A, 0xF4, 0xF2, 0xA5, 0x4B, 0x92, 0xE7, 0x44, 0x50, 0x25, 0xC7, 0xCF, 0x5E, 0x7E, 0x59, 0x60, 0xB8, 0x56, 0x2E, 0x82, 0xA5, 0x8F, 0xAE, 0xE3, 0xF2, 0xE5, 0xCB, 0x02, 0x93, 0x56, 0x68, 0x68, 0x51, 0x10, 0x8C, 0xD0, 0x7D, 0xEF, 0xBE, 0x2B, 0x76, 0xBF, 0xF9, 0xA6, 0x8C, 0x9E, 0xD7, 0x05, 0x18, 0x18, 0x49, 0xE2, 0x6E, 0x6D, 0x1C, 0x78, 0x87, 0x32, 0x88, 0xC4, 0x84, 0xD0, 0x6F, 0x85, 0x11, 0x0C, 0xBC, 0xA5, 0x4B, 0x97, 0xCA, 0x60, 0xAA, 0x5F, 0xE5, 0xEF, 0x00, 0xDD, 0x28, 0x14, 0x84, 0x57, 0x0D, 0xBA, 0x72, 0xE5, 0xCA, 0x24, 0x00, 0xEB, 0xF2, 0x61, 0xD3, 0xC2, 0x61, 0x43, 0x80, 0x50, 0x76, 0x0C, 0xE5, 0x8B, 0xD5, 0xBA, 0xBA, 0x7C, 0x28, 0x1E, 0x6C, 0x07, 0xC8, 0xEC, 0xD8, 0xA7, 0x9F, 0x8A, 0xCD, 0x5B, 0xB6, 0x28, 0xB6, 0x73, 0x27, 0x03, 0xA1, 0x05, 0x0F, 0xBE, 0xA3, 0x09, 0x27, 0xA4, 0xC7, 0x51, 0x8C, 0xA1, 0xD3, 0x4A, 0x7D, 0x28, 0x8C, 0x96, 0x20, 0x52, 0x96, 0x7E, 0x50, 0x18, 0x00, 0xA4, 0xAB, 0xBB, 0x3B, 0x28, 0x48, 0xA4, 0x7E, 0xDC, 0xE8, 0x0A, 0x4A, 0x08, 0x60, 0x30, 0x95, 0x53, 0x17, 0x93, 0x0B, 0x5F, 0xE3, 0x08, 0x8A, 0xDF, 0xD6, 0x0F, 0x0D, 0x18, 0x17, 0x6C, 0x87, 0xBB, 0x34, 0xCA, 0x58, 0xB4, 0x68, 0x91, 0x2B, 0x0A, 0xEA, 0x26, 0x52, 0x60, 0x8C, 0x83, 0x21, 0x91, 0x90, 0x0F, 0x60, 0x80, 0x60, 0x10, 0xE9, 0xA8, 0x58, 0xD4, 0x9A, 0x68, 0x05, 0x18, 0x50, 0x71, 0x27, 0x1B, 0x9B, 0xC6, 0x54, 0x56, 0xBC, 0x91, 0xA0, 0xAB, 0x40, 0xA3, 0x88, 0x82, 0x00, 0x50, 0x74, 0xBF, 0x18, 0x6A, 0x62, 0x78, 0xA9, 0x23, 0xAB, 0x1A, 0x30, 0x2D, 0xA0, 0x37, 0x21, 0x8C, 0x22, 0xC2, 0x08, 0x82, 0x30, 0x21, 0xD8, 0x11, 0xC5, 0x10, 0x0C, 0x3E, 0x5C, 0x41, 0x84, 0x6E, 0x00, 0x4B, 0xC0, 0x7E, 0x84, 0x71, 0xBB, 0x29, 0x99, 0x76, 0xA7, 0x7C, 0x86, 0x10, 0xB3, 0x9C, 0x68, 0x14, 0x51, 0x2C, 0xD9, 0xCB, 0xC9, 0x2B, 0x92, 0xF1, 0x3F, 0x3E, 0xFC, 0x50, 0x0E, 0x35, 0x75, 0xE5, 0x90, 0x60, 0x50, 0x6A, 0x42, 0x05, 0xE0, 0x6B, 0xEE, 0x8A, 0x87, 0x3B, 0xA6, 0x79, 0x6D, 0x09, 0x71, 0x71, 0xAB, 0xD9, 0xEF, 0x7D, 0x53, 0xCD, 0x00, 0x63, 0xD2, 0x96, 0x7E, 0xB9, 0x7D, 0xBB, 0x58, 0xBD, 0x7A, 0x75, 0xE8, 0x6B, 0x68, 0x39, 0x10, 0xD6, 0xE7, 0x27, 0x4F, 0x86, 0x86, 0x0D, 0x0B, 0x60, 0xD3, 0x70, 0x94, 0x11, 0x89, 0x38, 0x01, 0x88, 0x28, 0x88, 0x83, 0x13, 0xDD, 0x85, 0x8E, 0xAC, 0x52, 0xB6, 0x31, 0x8C, 0x54, 0x62, 0x9B, 0x36, 0x6D, 0x52, 0xCE, 0xC0, 0xBB, 0xE9, 0x3A, 0x88, 0xAD, 0xF1, 0xF8, 0x74, 0x2A, 0x65, 0x04, 0x04, 0x64, 0x0E, 0x23, 0x85, 0x97, 0x68, 0xC4, 0xE0, 0xA7, 0x41, 0xA0, 0x39, 0x4C, 0xC9, 0xD4, 0x66, 0x90, 0xE9, 0x4E, 0x18, 0x91, 0x70, 0xE3, 0x7F, 0x13, 0x51, 0x10, 0x07, 0xE7, 0xE9, 0x53, 0xA7, 0xE4, 0xDA, 0x13, 0x4F, 0x67, 0xFD, 0x9A, 0x35, 0xBF, 0x4B, 0x7A, 0x67, 0x1F, 0xB1, 0x12, 0x58, 0x4E, 0x5A, 0x32, 0x31, 0x3A, 0x08, 0x8A, 0xD3, 0xB4, 0x35, 0x60, 0x34, 0x61, 0x4B, 0x7E, 0xF6, 0x4F, 0x50, 0x3C, 0x4F, 0xAD, 0x5B, 0xA7, 0xF5, 0x46, 0x17, 0x82, 0x39, 0x12, 0x13, 0xB2, 0x01, 0x03, 0x37, 0x22, 0x4D, 0xBB, 0x4B, 0x93, 0x3C, 0x04, 0x85, 0xD1, 0x19, 0xAB, 0x56, 0x9A, 0x21, 0x28, 0x72, 0x3F, 0x3F, 0xA8, 0xC0, 0x30, 0x32, 0x15, 0x40, 0x31, 0x5D, 0x44, 0x58, 0xDA, 0x3A, 0xFF, 0x67, 0x9F, 0x7B, 0xCE, 0xD7, 0x88, 0x36, 0x35, 0x22, 0x6D, 0xC0, 0x60, 0xD2, 0x60, 0x74, 0xF9, 0xB4, 0xE1, 0x71, 0xCD, 0x80, 0xF7, 0xBC, 0xDD, 0x32, 0xFE, 0xE5, 0x6D, 0x05, 0x06, 0x6F, 0x84, 0x26, 0x99, 0x31, 0x29, 0xA8, 0xA9, 0x05, 0x8D, 0x3E, 0xBD, 0x52, 0xB4, 0x7C, 0xF9, 0xF2, 0x92, 0x92, 0xB2, 0x01, 0x83, 0x37, 0x21, 0xD3, 0x2E, 0xD3, 0xFB, 0x9E, 0xCD, 0xB3, 0xB7, 0x01, 0x92, 0x35, 0x68, 0x07, 0x06, 0x9B, 0xC4, 0x10, 0xF6, 0xBB, 0x06, 0xA3, 0x08, 0x84, 0x33, 0x2D, 0x3C, 0xC6, 0xC8, 0x95, 0x22, 0x4C, 0x39, 0x97, 0x4A, 0xA6, 0x8D, 0xC7, 0xAB, 0x3D, 0x4D, 0xBB, 0xCD, 0x52, 0xF3, 0xE7, 0x7D, 0x3F, 0x49, 0x08, 0x96, 0x53, 0x91, 0xCA, 0x03, 0xFF, 0xE4, 0x29, 0x17, 0x79, 0x0B, 0xE9, 0x17, 0xAF, 0xA9, 0x66, 0xB0, 0x35, 0x1E, 0xFD, 0xD2, 0x33, 0xE1, 0xFB, 0x19, 0x91, 0x36, 0xC3, 0x4B, 0x53, 0xED, 0x80, 0x15, 0x4D, 0x4E, 0x51, 0x81, 0x81, 0x8F, 0x28, 0x78, 0x7A, 0xCA, 0x9D, 0xA4, 0x4F, 0xBC, 0xE4, 0x54, 0xA4, 0xC3, 0xF0, 0xB1, 0x66, 0x8B, 0x19, 0x49, 0x98, 0x0C, 0x29, 0x91, 0xAE, 0xA9, 0x66, 0x50, 0x79, 0xAC, 0xC4, 0x7D, 0x9E, 0xCF, 0x22, 0x94, 0xA9, 0xCD, 0x60, 0x9B, 0x47, 0xBE, 0xE6, 0x91, 0x88, 0x68, 0x78, 0x19, 0xA6, 0xA9, 0xAC, 0x6C, 0x86, 0x52, 0x0A, 0x18, 0xF4, 0xAE, 0x69, 0x4B, 0xA8, 0x94, 0x01, 0x89, 0xBC, 0xFA, 0x69, 0x86, 0xA0, 0x72, 0x78, 0xFD, 0x4C, 0x35, 0x03, 0xDE, 0xE3, 0xB6, 0x95, 0xA9, 0x3C, 0xBC, 0xE9, 0x95, 0xFA, 0x1C, 0x29, 0x18, 0x4C, 0xBB, 0x09, 0xD3, 0x42, 0x54, 0xD2, 0x80, 0xF4, 0x5B, 0x9E, 0x36, 0xCD, 0x2B, 0xC2, 0xD9, 0x80, 0x81, 0xC7, 0x5B, 0x2D, 0x4D, 0x19, 0x29, 0x18, 0xD4, 0x8A, 0x1C, 0x2F, 0x68, 0xCD, 0x1D, 0x2E, 0x01, 0x53, 0x1B, 0x2A, 0x3C, 0x26, 0x77, 0x88, 0x50, 0x9B, 0xC1, 0x1D, 0xBC, 0xF6, 0xF4, 0x30, 0x4B, 0x40, 0xFD, 0xB9, 0xD6, 0xAF, 0x8C, 0x91, 0x6A, 0x06, 0xBF, 0x44, 0x6B, 0xFC, 0x78, 0x4A, 0xA0, 0x06, 0x86, 0x78, 0xD6, 0x4B, 0x55, 0x72, 0x55, 0x03, 0x43, 0x55, 0xC4, 0x1E, 0xCF, 0x44, 0x6B, 0x60, 0x88, 0x67, 0xBD, 0x54, 0x25, 0x57, 0x35, 0x30, 0x54, 0x45, 0xEC, 0xF1, 0x4C, 0xB4, 0x06, 0x86, 0x78, 0xD6, 0x4B, 0x55, 0x72, 0x55, 0x03, 0x43, 0x55, 0xC4, 0x1E, 0xCF, 0x44, 0x23, 0x05, 0x03, 0xBE, 0xF7, 0xAB, 0x51, 0x3C, 0x25, 0x30, 0xE9, 0xBF, 0x9E, 0xB4, 0x5D, 0x60, 0xA4, 0x60, 0xA8, 0xE4, 0x2A, 0x63, 0xB9, 0x45, 0x6E, 0xFA, 0x8F, 0xA6, 0xA0, 0x74, 0x8B, 0x5D, 0x63, 0x28, 0x66, 0x51, 0x30, 0x28, 0x1F, 0xA6, 0x7E, 0xC6, 0x60, 0x28, 0x66, 0x8A, 0xD4, 0x74, 0x2D, 0xC1, 0x74, 0x0E, 0xDF, 0x74, 0x15, 0xD4, 0xB4, 0xF0, 0x41, 0xE1, 0xCA, 0xB1, 0x3A, 0x69, 0x03, 0x06, 0xBE, 0x08, 0x17, 0x36, 0x6D, 0x1C, 0x94, 0xEF, 0x52, 0xFC, 0x8C, 0xC1, 0x50, 0xCC, 0xE2, 0x09, 0x3E, 0x91, 0x33, 0xA1, 0xB0, 0xA5, 0x55, 0x93, 0x38, 0xCA, 0x1D, 0xC6, 0xEF, 0x7F, 0x0B, 0xE5, 0x58, 0xCD, 0xD4, 0xE5, 0x95, 0x37, 0x9C, 0xB0, 0x69, 0x63, 0xDD, 0xFB, 0xE5, 0xE0, 0x4D, 0x02, 0x43, 0x39, 0x33, 0x62, 0xDA, 0x4D, 0x98, 0xB6, 0x04, 0x7C, 0xDD, 0x5C, 0x29, 0xF2, 0xD3, 0x0C, 0x7E, 0xFF, 0x73, 0xD0, 0xE5, 0xCB, 0x54, 0x33, 0x78, 0xFF, 0xC1, 0x65, 0xAA, 0x29, 0x75, 0x69, 0x9A, 0xF2, 0xF0, 0x75, 0x36, 0x27, 0x4A, 0x33, 0x9B, 0x4C, 0xD4, 0xD5, 0xA5, 0x39, 0x13, 0x1B, 0x43, 0x94, 0x8B, 0xFE, 0x7B, 0xEE, 0x9C, 0x51, 0x54, 0xA6, 0x9A, 0x81, 0x7F, 0x70, 0x62, 0x14, 0x71, 0x09, 0x81, 0xF0, 0x85, 0x78, 0xA9, 0x64, 0xAA, 0x4D, 0xBD, 0x8D, 0x26, 0x2A, 0x30, 0xF0, 0xBF, 0xE1, 0x7B, 0xD3, 0xC0, 0x86, 0xE4, 0x93, 0x34, 0x43, 0x90, 0x00, 0x4C, 0x0B, 0xC7, 0xE3, 0xE0, 0x7D, 0x21, 0xE7, 0x73, 0xB7, 0xA9, 0x66, 0xE0, 0xEF, 0x44, 0xED, 0x2E, 0x75, 0x1F, 0x09, 0x53, 0xAD, 0xA0, 0x2B, 0x87, 0x69, 0xE3, 0xD0, 0xBD, 0x1B, 0xC4, 0x0B, 0xB3, 0xFB, 0xAC, 0xC0, 0x10, 0x94, 0x90, 0x9F, 0x9F, 0x17, 0xF5, 0xBA, 0x70, 0xA6, 0x9F, 0x93, 0x55, 0xCA, 0x80, 0x3C, 0x78, 0xE0, 0x80, 0xEF, 0x67, 0x76, 0xA6, 0x36, 0x83, 0x0D, 0x18, 0x4C, 0x1A, 0x8C, 0x4E, 0x6E, 0x36, 0x3C, 0x34, 0x64, 0xEF, 0xDF, 0xE3, 0xBD, 0xEF, 0x27, 0x47, 0x86, 0x86, 0x06, 0x38, 0x13, 0xBB, 0xAD, 0xFA, 0x51, 0x18, 0xB2, 0x74, 0xEF, 0x99, 0x14, 0xD4, 0xAB, 0xB2, 0x74, 0xF1, 0x80, 0xA7, 0xFB, 0x4C, 0xDF, 0x2F, 0xAC, 0xE2, 0x4F, 0x1A, 0x4F, 0x2B, 0x8F, 0x80, 0x7B, 0xD0, 0xE7, 0x75, 0xA6, 0xFF, 0x80, 0xB2, 0x01, 0xC3, 0x29, 0xFA, 0xC2, 0x49, 0x51, 0xA5, 0x86, 0x95, 0x3A, 0x99, 0x27, 0xF9, 0x0E, 0xA1, 0xC8, 0x50, 0x50, 0x66, 0x8A, 0xE9, 0x26, 0x8E, 0x1F, 0x3F, 0xAE, 0xCA, 0x19, 0x78, 0x37, 0x55, 0x8D, 0xB6, 0x7F, 0xA5, 0x3B, 0x9A, 0x4E, 0xCB, 0x9D, 0x4B, 0x02, 0x13, 0x9F, 0xF0, 0x84, 0x45, 0x8F, 0xEF, 0x10, 0xFD, 0x8C, 0x47, 0x9B, 0x6F, 0x29, 0x6C, 0xC0, 0xC0, 0x27, 0xE7, 0x72, 0xF4, 0xB5, 0x74, 0x14, 0xC4, 0xF3, 0x83, 0x2F, 0xBF, 0xBD, 0x1B, 0x8F, 0xE3, 0xF0, 0x92, 0x7A, 0x24, 0x4C, 0x28, 0xC9, 0x52, 0xE0, 0x76, 0x95, 0x09, 0x58, 0x9A, 0xBA, 0xAD, 0x7C, 0xB8, 0x01, 0xA2, 0xC2, 0x86, 0xDD, 0xB1, 0x8B, 0x3C, 0x86, 0x98, 0x61, 0x2A, 0x1E, 0x20, 0x34, 0x01, 0x1B, 0xFE, 0x38, 0x6A, 0xD2, 0xF5, 0xF0, 0x7C, 0xFD, 0x75, 0xDF, 0x3E, 0x71, 0xE8, 0xE0, 0xC1, 0xD0, 0x3F, 0xB9, 0x86, 0x7D, 0x85, 0xCD, 0xE3, 0x0C, 0x73, 0x9B, 0x94, 0x45, 0xC5, 0xC1, 0xCB, 0x13, 0x95, 0xFD, 0xC4, 0xC1, 0x80, 0xEF, 0x49, 0xFF, 0xFE, 0xFE, 0xFB, 0x2A, 0x79, 0xE7, 0x2E, 0xC1, 0x40, 0x4F, 0x59, 0xBA, 0xDA, 0xE9, 0x92, 0xA4, 0x53, 0x21, 0xF0, 0xE0, 0x11, 0x8E, 0x87, 0x34, 0xFB, 0x3D, 0x47, 0xA3, 0x8A, 0x30, 0x30, 0xC0, 0x6E, 0x30, 0xF9, 0x66, 0xA3, 0xD8, 0x11, 0x05, 0x5A, 0xBB, 0x5F, 0x8B, 0x37, 0x2B, 0x85, 0xFF, 0xBE, 0x15, 0xBA, 0xF7, 0x4D, 0xBB, 0x54, 0xBE, 0xC5, 0x00, 0xE4, 0x6E, 0x6A, 0x3F, 0xE9, 0xD2, 0x0C, 0xE2, 0xA9, 0x86, 0x8C, 0x4D, 0xC5, 0xFC, 0x64, 0x28, 0x0D, 0x48, 0xFA, 0xC9, 0xF2, 0x88, 0xFC, 0xFA, 0x59, 0x1B, 0xB4, 0xF3, 0xF8, 0x8E, 0x1F, 0x3B, 0xC6, 0x1F, 0xB5, 0xEE, 0xA0, 0xEE, 0x49, 0xFB, 0x42, 0x15, 0x98, 0x36, 0x5F, 0x59, 0x99, 0xCA, 0x0A, 0x5F, 0x44, 0x2B, 0x42, 0x57, 0x19, 0x95, 0x66, 0x40, 0x7E, 0xF0, 0x6D, 0xC6, 0x0F, 0xB6, 0x6E, 0x15, 0xD8, 0x18, 0x54, 0x47, 0x12, 0x0C, 0xBA, 0x23, 0x7D, 0x74, 0x81, 0xC1, 0x2B, 0x46, 0x3B, 0xF4, 0xD1, 0x5E, 0x87, 0xBC, 0xD0, 0xBA, 0xB8, 0x21, 0x84, 0xB8, 0x03, 0xC2, 0xB5, 0x99, 0xA6, 0xAE, 0x10, 0x13, 0x3C, 0x58, 0xED, 0xA6, 0x72, 0xE2, 0xC6, 0x63, 0x39, 0x27, 0xFC, 0xBC, 0xD9, 0x43, 0x7E, 0xD0, 0x3D, 0xE0, 0xEB, 0xAD, 0x6B, 0xD7, 0xAE, 0xB9, 0xBC, 0x49, 0x23, 0xA5, 0xC1, 0x90, 0xDD, 0x04, 0x0E, 0x07, 0xE3, 0xBE, 0xF2, 0xB4, 0x18, 0x9F, 0x2F, 0x8A, 0x4C, 0xD5, 0x1F, 0x8F, 0x0F, 0x6E, 0x68, 0x07, 0xBE, 0x65, 0x8D, 0xD7, 0x1F, 0xCF, 0x00, 0x84, 0xDA, 0xE1, 0xED, 0xC6, 0xC4, 0x4E, 0x6F, 0x98, 0x9D, 0x43, 0x9F, 0x0A, 0x23, 0x8B, 0xF7, 0xAD, 0xBA, 0xF7, 0xA3, 0xE6, 0x99, 0x0E, 0x2B, 0xC3, 0x86, 0x70, 0x3C, 0x9F, 0xDC, 0x78, 0x8C, 0xAA, 0x8B, 0xC0, 0x66, 0xE7, 0x30, 0xBC, 0x75, 0x9B, 0x7B, 0x21, 0x2F, 0xB4, 0x4F, 0xB4, 0x1C, 0x51, 0x4A, 0x30, 0xA8, 0x23, 0x06, 0x79, 0x26, 0xCB, 0xED, 0x3E, 0x73, 0xFA, 0xB4, 0x13, 0xE5, 0x54, 0xDD, 0x07, 0x12, 0x23, 0x13, 0x00, 0x22, 0x6C, 0x1F, 0x48, 0xA7, 0xA0, 0x21, 0x0E, 0x00, 0x5F, 0x01, 0x1C, 0xF6, 0x82, 0x9F, 0xAD, 0x16, 0x12, 0x4D, 0xA8, 0x37, 0xEC, 0x85, 0x97, 0x5E, 0x79, 0xC5, 0x09, 0x77, 0xFE, 0xEB, 0xAF, 0x1D, 0x37, 0x1C, 0xF4, 0x89, 0xA5, 0x54, 0x06, 0xCA, 0x80, 0x74, 0x79, 0x06, 0x3D, 0x60, 0x33, 0x8F, 0x62, 0xFB, 0xB5, 0x3F, 0xBE, 0xFD, 0xF6, 0x94, 0xDE, 0x21, 0x16, 0x60, 0xF0, 0x52, 0x29, 0x3B, 0xC4, 0xF2, 0x85, 0xBC, 0xA8, 0xBA, 0x48, 0x68, 0xF2, 0xF5, 0x1B, 0x36, 0xB8, 0xE6, 0x68, 0x06, 0x69, 0x6F, 0x6A, 0x4E, 0x04, 0xC2, 0x2C, 0x9E, 0xB5, 0x60, 0x08, 0x9A, 0x78, 0x32, 0x35, 0x8C, 0x78, 0x62, 0xCA, 0x5D, 0xEA, 0x14, 0xAF, 0x8A, 0x27, 0x4E, 0x77, 0xB5, 0xB5, 0x8F, 0x53, 0x36, 0x1A, 0xC2, 0x2A, 0x0A, 0xDB, 0x3B, 0x1A, 0xFB, 0x47, 0x29, 0x0A, 0x92, 0xB9, 0x0A, 0x53, 0xCC, 0x1D, 0x53, 0x04, 0xB0, 0x15, 0x38, 0x61, 0xD3, 0x72, 0x4E, 0xEA, 0xA0, 0x54, 0x09, 0x06, 0x4C, 0x38, 0xD0, 0x11, 0x03, 0x8E, 0x7F, 0x54, 0x28, 0x75, 0x12, 0x78, 0x44, 0x1C, 0xD8, 0x24, 0x1C, 0x17, 0xD7, 0x00, 0xBA, 0xA2, 0x47, 0xD5, 0x45, 0xC0, 0x56, 0xF8, 0xC9, 0x8B, 0x2F, 0x4E, 0x1A, 0x4A, 0x4E, 0xEA, 0x26, 0x06, 0x07, 0xB3, 0xC8, 0x97, 0x56, 0x33, 0xC0, 0x03, 0xC6, 0x8C, 0x77, 0x77, 0x0F, 0xF0, 0xA7, 0x32, 0xA1, 0x7B, 0xD3, 0xCD, 0x74, 0xDA, 0x18, 0x7C, 0x51, 0x94, 0x1F, 0x96, 0x3E, 0xDF, 0xDC, 0x5B, 0x0D, 0x31, 0x91, 0x5F, 0x35, 0xC2, 0x70, 0xF1, 0x42, 0x76, 0xDD, 0x43, 0x79, 0xD4, 0x79, 0x13, 0x18, 0x4A, 0x72, 0xC2, 0xB0, 0x92, 0xDB, 0x6F, 0xF0, 0x53, 0x07, 0xA0, 0x3A, 0x60, 0xA0, 0x84, 0x33, 0xD4, 0xBF, 0x74, 0xAA, 0x17, 0xEF, 0xDC, 0xBE, 0x2D, 0x6C, 0xD6, 0xEE, 0xD5, 0x7B, 0xD5, 0xBC, 0x43, 0xA3, 0xA1, 0x95, 0x4D, 0xF5, 0x93, 0x68, 0x5C, 0x5D, 0x71, 0xC0, 0xFE, 0x98, 0x0A, 0x20, 0x5C, 0xE6, 0x1C, 0xD8, 0x5B, 0x9F, 0x79, 0xC6, 0x75, 0xF0, 0x08, 0xC2, 0x1D, 0x60, 0xA7, 0xD0, 0xE0, 0x39, 0x97, 0xCF, 0xEF, 0xC7, 0x1D, 0xE4, 0x80, 0x81, 0xF6, 0xF4, 0x49, 0xD3, 0xA6, 0x73, 0x0E, 0x18, 0x6E, 0xDD, 0xBC, 0x29, 0x70, 0x60, 0x99, 0x2B, 0x63, 0xE3, 0xEF, 0xC4, 0xE2, 0x17, 0x95, 0x2E, 0x2B, 0x9F, 0x26, 0x6A, 0x14, 0x08, 0xCA, 0x91, 0x31, 0xA5, 0x3D, 0x74, 0x1A, 0x04, 0xB2, 0x80, 0xB0, 0xEB, 0xE8, 0xE2, 0x42, 0x2F, 0x47, 0xBA, 0xC5, 0xC4, 0x11, 0x56, 0x37, 0x87, 0x0F, 0x1D, 0x92, 0x93, 0x4C, 0x6A, 0x67, 0x18, 0x74, 0x0F, 0x7F, 0xDA, 0xBB, 0xD7, 0x95, 0x14, 0x1D, 0xBE, 0xEE, 0x80, 0xC1, 0xD9, 0x74, 0x70, 0x49, 0x5B, 0xDB, 0x08, 0x6D, 0x54, 0xDB, 0xA3, 0x42, 0x42, 0x28, 0xB8, 0xE2, 0xF4, 0x59, 0x3D, 0x2A, 0x08, 0x0B, 0x2C, 0x23, 0xB4, 0x76, 0xC2, 0x4F, 0x67, 0x41, 0x3E, 0x2B, 0x41, 0x0A, 0x28, 0xE8, 0x42, 0x91, 0xBE, 0x6C, 0x99, 0x94, 0x30, 0xD4, 0x7C, 0xB1, 0xF3, 0x2F, 0x51, 0xE6, 0x1B, 0xF9, 0xC4, 0x04, 0x13, 0x46, 0x13, 0x00, 0xC2, 0xAF, 0x5E, 0x7B, 0x4D, 0x60, 0x53, 0x71, 0x87, 0xE8, 0x48, 0xA2, 0x13, 0x67, 0xCE, 0xFC, 0x54, 0x3D, 0x53, 0xFD, 0x3F, 0xA0, 0xDA, 0xB9, 0x96, 0x0F, 0x64, 0x61, 0xEB, 0x82, 0x7D, 0x15, 0xD7, 0x73, 0x2D, 0x57, 0xD3, 0x39, 0x19, 0x9F, 0x7C, 0xFC, 0xB1, 0xF0, 0x0E, 0x29, 0x73, 0x85, 0xC2, 0x36, 0x7E, 0x14, 0xB2, 0x0B, 0x0C, 0xD8, 0x20, 0x94, 0x18, 0x69, 0xAF, 0x20, 0x70, 0xA4, 0x61, 0x25, 0xED, 0x07, 0x74, 0x01, 0xD0, 0x00, 0x40, 0x36, 0x5A, 0xA3, 0xEA, 0x12, 0x78, 0xBE, 0x30, 0x14, 0xD3, 0x69, 0x04, 0x1C, 0x9D, 0x1C, 0x15, 0xA1, 0xB2, 0xBD, 0x04, 0x8D, 0xC0, 0x37, 0xD8, 0x84, 0x96, 0xC0, 0x16, 0xC9, 0x58, 0x74, 0x83, 0xBB, 0x5A, 0x04, 0xAD, 0x15, 0x74, 0xE2, 0x2D, 0x09, 0xB5, 0x97, 0x0E, 0x2A, 0xFB, 0x05, 0xCF, 0x9F, 0x0B, 0x0C, 0xF0, 0x08, 0x3B, 0x0B, 0xBB, 0x9C, 0x87, 0x9E, 0xA2, 0xB2, 0x51, 0xA9, 0xF2, 0x4E, 0xC6, 0x1F, 0xDC, 0x50, 0x63, 0xB0, 0xA0, 0xC1, 0x7B, 0x18, 0x08, 0x56, 0x3D, 0x40, 0x81, 0x4B, 0xFD, 0x2D, 0x40, 0x01, 0x85, 0xF3, 0xCA, 0x51, 0x56, 0xFC, 0xF5, 0x00, 0x8B, 0x8C, 0x58, 0x4E, 0x08, 0x3A, 0x0B, 0x5B, 0x07, 0x04, 0xA4, 0x3F, 0x09, 0x0C, 0x60, 0x6E, 0xE8, 0xEE, 0x3E, 0xC3, 0x47, 0x16, 0xE0, 0x29, 0x42, 0x01, 0x66, 0xD1, 0x89, 0x31, 0x28, 0x24, 0x0A, 0x85, 0xBB, 0x9F, 0x21, 0x83, 0xCC, 0xA1, 0x55, 0xF3, 0xCA, 0x56, 0x00, 0xA8, 0xCD, 0x65, 0x28, 0x89, 0x8E, 0xDF, 0x61, 0x90, 0x72, 0x0D, 0x23, 0x01, 0x43, 0x06, 0x6B, 0x10, 0xA9, 0x86, 0xA4, 0x34, 0x69, 0x50, 0x58, 0xE5, 0x47, 0x5D, 0xC3, 0x1E, 0xEA, 0x1A, 0x1E, 0x1C, 0x58, 0xA5, 0x3C, 0xE8, 0xAE, 0x05, 0x03, 0x8E, 0xB6, 0xFB, 0xCE, 0xDC, 0xB9, 0x7B, 0x08, 0xCE, 0x3D, 0x2C, 0x6C, 0xCD, 0x39, 0x85, 0x25, 0x40, 0x80, 0x49, 0x27, 0x87, 0x86, 0x7A, 0xD4, 0x9C, 0x82, 0xAE, 0x28, 0x5A, 0x30, 0xA8, 0x80, 0xEB, 0xBA, 0xBA, 0x76, 0x10, 0x36, 0x77, 0x11, 0x28, 0x5A, 0x14, 0xAF, 0x5A, 0x77, 0x14, 0x86, 0xA7, 0x4D, 0xE7, 0x2A, 0x65, 0xE8, 0xA0, 0xB5, 0x01, 0xCE, 0x83, 0x1B, 0x2B, 0xB0, 0x51, 0x2D, 0xBC, 0xD1, 0x30, 0x2C, 0xA5, 0x49, 0xAF, 0x85, 0x16, 0x7A, 0x9C, 0x21, 0x39, 0xFC, 0x49, 0x7B, 0xA6, 0x70, 0x8F, 0x05, 0x91, 0x6D, 0x40, 0x32, 0xE9, 0xC5, 0x2C, 0x73, 0x58, 0x7E, 0x02, 0xC1, 0x80, 0x97, 0xA1, 0x25, 0xE6, 0x37, 0x37, 0x6F, 0xA3, 0x95, 0xAF, 0x5D, 0x54, 0xC8, 0xF6, 0xB0, 0x08, 0x6D, 0xFD, 0x9D, 0x4A, 0xA6, 0x0F, 0x3F, 0xF1, 0xAE, 0xFA, 0x8E, 0x23, 0x41, 0x53, 0xA4, 0x41, 0x28, 0xB6, 0x4D, 0xA7, 0x5A, 0xE1, 0xD5, 0xAE, 0xFD, 0x38, 0x2E, 0x10, 0xF2, 0xA3, 0x8A, 0x71, 0xC0, 0x43, 0xE6, 0x65, 0x67, 0x59, 0x1B, 0x1A, 0x35, 0x0E, 0x9A, 0x2F, 0xCA, 0xA0, 0xA1, 0x50, 0x79, 0xD3, 0xD7, 0xFB, 0xFB, 0xD3, 0x74, 0x5E, 0xE5, 0x2D, 0xD3, 0xB2, 0x87, 0x82, 0x81, 0x47, 0xB4, 0xB1, 0xA3, 0x63, 0x69, 0xAE, 0xB1, 0x71, 0x1B, 0x69, 0x8B, 0x4E, 0xB9, 0xF1, 0xB4, 0x41, 0x0B, 0xF0, 0xAB, 0x6C, 0x13, 0xA4, 0xF2, 0xB4, 0x1F, 0x76, 0xB7, 0x02, 0x8D, 0x2A, 0xA7, 0x4E, 0x0B, 0x29, 0x3F, 0x75, 0x27, 0xD9, 0x66, 0xD5, 0x22, 0xD3, 0xB7, 0x7D, 0x7D, 0x19, 0x9B, 0x8A, 0x57, 0x71, 0xF0, 0xFB, 0xFF, 0x01, 0xC1, 0xF0, 0xAD, 0xAB, 0xA6, 0x73, 0x36, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
-
-constexpr std::size_t size = sizeof(data);
-
-}  // namespace car_black_1
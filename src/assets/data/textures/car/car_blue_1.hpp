@@ -1,11 +0,0 @@
-#pragma once
-
-#include <cstddef>  // for std::size_t
-
-namespace car_blue_1 {
-
-constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x47, 0x08, 0x06, 0x00, 0x00, 0x00, 0x24, 0xE4, 0xF4, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0x44, 0x65, 0x58, 0x49, 0x66, 0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0xA0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x6B, 0x38, 0x00, 0x00, 0x10, 0x88, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x5D, 0x6D, 0x8C, 0x5C, 0x55, 0x19, 0x7E, 0xE7, 0xCE, 0xC7, 0xCE, 0x6E, 0x77, 0xDB, 0xA5, 0xBB, 0xDB, 0x2E, 0x2D, 0xB4, 0x5B, 0x6D, 0xAD, 0x8A, 0xC8, 0x4A, 0x80, 0x10, 0x3E, 0xB4, 0x80, 0x1A, 0xE0, 0x07, 0xD4, 0x18, 0x43, 0x84, 0x88, 0x0B, 0xFE, 0x21, 0xF1, 0x87, 0x98, 0xB4, 0xCA, 0x0F, 0x23, 0x8D, 0xF2, 0x43, 0xA0, 0x6A, 0x63, 0x34, 0xE1, 0x87, 0x89, 0x0B, 0x28, 0x09, 0x01, 0x13, 0x44, 0x63, 0xF0, 0x07, 0xB2, 0xA8, 0x90, 0x1A, 0x1A, 0x58, 0x14, 0xD0, 0x4A, 0xA5, 0x0B, 0xB5, 0xA5, 0x94, 0x7E, 0x4C, 0xBB, 0xBB, 0xDD, 0xE9, 0x7C, 0xDC, 0xF1, 0x7D, 0xCE, 0xDD, 0x33, 0x73, 0xEE, 0x9D, 0x73, 0xEF, 0x3D, 0x77, 0x66, 0xEE, 0xCC, 0x14, 0xF6, 0x4D, 0x76, 0xEF, 0xB9, 0xEF, 0xF9, 0x3E, 0xE7, 0x3D, 0xEF, 0xC7, 0x39, 0x77, 0xDE, 0x93, 0xA0, 0x88, 0x30, 0x78, 0xFB, 0x83, 0x37, 0xA7, 0x2C, 0x6B, 0xDC, 0xA2, 0xCA, 0xB8, 0x4D, 0x34, 0x68, 0x11, 0x8D, 0x91, 0x65, 0x8D, 0xA9, 0xC5, 0xD8, 0xB6, 0x3D, 0xCD, 0xEF, 0x39, 0x07, 0x97, 0x98, 0xC2, 0xB3, 0x04, 0x5C, 0xA5, 0x22, 0x70, 0xB9, 0xFC, 0xB1, 0x69, 0x7A, 0xE2, 0xFE, 0x93, 0x4E, 0xFC, 0xD2, 0xFF, 0xEA, 0x08, 0x7C, 0xE5, 0xBB, 0x2B, 0x06, 0xB3, 0x43, 0xE3, 0xF2, 0x3D, 0x95, 0x4C, 0x6E, 0x91, 0x61, 0xDD, 0xB3, 0x62, 0x57, 0x66, 0xCA, 0x15, 0x7B, 0x06, 0x71, 0xB9, 0x47, 0xBF, 0xF3, 0xBC, 0x2E, 0x4D, 0x14, 0x5C, 0xC2, 0x24, 0xF1, 0xD0, 0xED, 0x3B, 0xBF, 0x6E, 0x59, 0xB4, 0x25, 0x61, 0x59, 0x13, 0x26, 0xE9, 0xA3, 0xA4, 0x71, 0x13, 0x4E, 0x85, 0x89, 0xC8, 0x12, 0x04, 0xA3, 0x12, 0x4F, 0xBE, 0x5C, 0x98, 0xC9, 0x3F, 0xF6, 0xBD, 0xB7, 0xA3, 0x94, 0xDB, 0x2D, 0x69, 0xB3, 0xB7, 0xDE, 0xB7, 0x3E, 0x9B, 0xCC, 0x8C, 0xA1, 0x3D, 0xC9, 0x84, 0x35, 0x96, 0xB0, 0x12, 0x22, 0x4C, 0x64, 0x0F, 0x12, 0x25, 0x16, 0x27, 0x3E, 0x31, 0x6E, 0x59, 0x09, 0x7E, 0x6F, 0x12, 0x6C, 0x7B, 0x86, 0x17, 0xE8, 0x0C, 0x97, 0x3B, 0x65, 0x95, 0x8A, 0x4F, 0x1D, 0xF9, 0xF5, 0x3D, 0xAF, 0x46, 0x29, 0x31, 0x90, 0x18, 0x06, 0xBF, 0xF6, 0xC0, 0xE7, 0x32, 0x49, 0x6B, 0xD2, 0xBB, 0xF2, 0xA3, 0x54, 0x10, 0x47, 0x5A, 0x26, 0xA0, 0x29, 0xB5, 0x5C, 0xEE, 0xC4, 0x4C, 0x85, 0x12, 0x33, 0x2A, 0x0E, 0xE1, 0x84, 0x5D, 0xC9, 0x15, 0x2B, 0x82, 0x4B, 0x79, 0xA3, 0x22, 0xBF, 0xBB, 0x27, 0xB2, 0x96, 0x3D, 0x41, 0x95, 0xB1, 0x0A, 0xB8, 0xA3, 0x02, 0x96, 0x65, 0x6D, 0x51, 0x5E, 0x3B, 0x17, 0x14, 0xC4, 0x91, 0x98, 0x9C, 0x2B, 0x2C, 0x4C, 0x9A, 0x2C, 0x26, 0x5F, 0x62, 0x18, 0x99, 0xD8, 0xF9, 0xAB, 0x38, 0x38, 0x41, 0xE7, 0x46, 0xE6, 0xC3, 0x5D, 0xB3, 0x6D, 0x57, 0x76, 0x1C, 0x9D, 0x3F, 0xB2, 0x2B, 0x48, 0x3C, 0x6B, 0x89, 0x61, 0x78, 0x62, 0xE7, 0x73, 0x7E, 0xD4, 0x9D, 0x48, 0xA6, 0x28, 0x3B, 0x38, 0x4C, 0xE9, 0xDE, 0x01, 0x4A, 0xF5, 0xF5, 0x93, 0xC5, 0xEF, 0xE9, 0xBE, 0x01, 0xED, 0x48, 0x9F, 0x99, 0x3D, 0x21, 0xF0, 0xE5, 0x33, 0x79, 0x2A, 0x17, 0xF2, 0x22, 0x5C, 0x58, 0xC4, 0x15, 0x17, 0xE6, 0xA8, 0x52, 0x2E, 0x69, 0xF3, 0x7D, 0x98, 0x91, 0xA9, 0x5E, 0x67, 0x4C, 0x31, 0x06, 0xCE, 0xF8, 0xA6, 0x7D, 0x87, 0xA3, 0x5C, 0x58, 0x20, 0x8C, 0xAD, 0xCD, 0xE3, 0x58, 0xE2, 0xF1, 0x0C, 0x05, 0xE6, 0x14, 0x05, 0xBB, 0x72, 0x77, 0xEE, 0x91, 0xED, 0xBF, 0xD3, 0xA5, 0xAD, 0x23, 0x06, 0x3F, 0x8E, 0x90, 0xCC, 0x64, 0xA9, 0xFF, 0xDC, 0x0D, 0x82, 0x10, 0xAC, 0x94, 0x7F, 0x03, 0x75, 0x95, 0x04, 0xE1, 0xEC, 0x52, 0x91, 0x40, 0x18, 0x80, 0xD2, 0xE9, 0x39, 0xEE, 0x58, 0x91, 0xCA, 0xDC, 0xB9, 0xE2, 0xDC, 0xA9, 0x6A, 0xB6, 0xD2, 0xE9, 0x5A, 0xB8, 0x8A, 0x3C, 0x4B, 0x02, 0x58, 0x3C, 0x69, 0x9E, 0x60, 0x09, 0x99, 0x81, 0x73, 0x64, 0x90, 0x17, 0x51, 0x3F, 0x21, 0x3E, 0x68, 0x41, 0x55, 0x13, 0x1B, 0x04, 0x8A, 0xA7, 0x67, 0xA9, 0x30, 0x9B, 0x23, 0x2C, 0xC2, 0xC2, 0x5C, 0xCE, 0x77, 0xB1, 0x95, 0x4B, 0xF6, 0xC4, 0xB1, 0x47, 0xB6, 0x3D, 0xEC, 0x2D, 0xD2, 0x45, 0x0C, 0xB0, 0x14, 0x32, 0xA9, 0xE4, 0x53, 0xDE, 0x44, 0x7D, 0xAB, 0xCE, 0xA3, 0x01, 0x26, 0x84, 0x56, 0x12, 0x81, 0xB7, 0x0E, 0xF5, 0xBD, 0x52, 0xA9, 0x90, 0x6D, 0x97, 0xA9, 0xCC, 0x84, 0xC2, 0x16, 0x88, 0x1A, 0x25, 0x56, 0x41, 0x39, 0x7F, 0xDA, 0x85, 0x2B, 0xE5, 0xE7, 0xB9, 0xE3, 0x65, 0x17, 0x0E, 0x2F, 0x76, 0xF1, 0x0C, 0x73, 0xA4, 0x33, 0x75, 0xF8, 0x46, 0x10, 0xC9, 0x4C, 0x0F, 0x59, 0xE9, 0x9E, 0xBA, 0xAC, 0x89, 0x64, 0x92, 0x52, 0xD9, 0x65, 0x55, 0x7C, 0x22, 0x91, 0xA0, 0x9E, 0xE5, 0x2B, 0x79, 0x82, 0x93, 0x94, 0x48, 0xB0, 0xAD, 0xD5, 0x21, 0xC0, 0x22, 0xCB, 0xE7, 0x8E, 0xD2, 0xDC, 0xBB, 0xFB, 0xAB, 0x5C, 0x59, 0x6D, 0x8A, 0x8E, 0x20, 0x5C, 0xC4, 0xA0, 0x13, 0x0F, 0x2B, 0xD6, 0x7F, 0x82, 0xFA, 0x86, 0xCF, 0x55, 0xCB, 0x69, 0x6B, 0x98, 0x95, 0x45, 0x41, 0x00, 0x20, 0x0E, 0x2F, 0x61, 0xB4, 0xB5, 0x21, 0x21, 0x95, 0x61, 0xF2, 0xB1, 0xC2, 0x2D, 0x2B, 0x19, 0x92, 0xB2, 0xBD, 0xD1, 0x20, 0x8A, 0xCB, 0x96, 0x9D, 0xA2, 0xDF, 0xBF, 0xA8, 0x31, 0x2C, 0x0A, 0x85, 0x71, 0xD5, 0xE2, 0xA8, 0x92, 0x2E, 0x2C, 0x07, 0xAF, 0x9E, 0x00, 0x8E, 0xD0, 0x49, 0x42, 0xC0, 0xB0, 0x71, 0x9B, 0x28, 0x95, 0xCE, 0x50, 0xA6, 0xA7, 0x97, 0x52, 0x2C, 0xAA, 0x30, 0xE0, 0x58, 0x7D, 0xDD, 0x00, 0x09, 0x9E, 0xF8, 0x24, 0xB7, 0x2D, 0x8D, 0xB6, 0x31, 0xD7, 0xE8, 0x36, 0x42, 0xC0, 0x18, 0x5D, 0xB6, 0x6E, 0x90, 0x7E, 0xF9, 0x8D, 0x6B, 0xE9, 0xD9, 0x7B, 0x6F, 0xA3, 0xE5, 0xBD, 0x6E, 0xCE, 0x66, 0xA7, 0x52, 0x93, 0xEA, 0x38, 0x56, 0x89, 0x21, 0x9D, 0xB4, 0x26, 0xD4, 0x08, 0xC8, 0x32, 0x88, 0x86, 0x6E, 0x02, 0x49, 0x18, 0x18, 0xFC, 0x74, 0x4F, 0x56, 0x4C, 0x44, 0x3B, 0x89, 0x83, 0xAD, 0x2B, 0x4A, 0xB2, 0xBE, 0x94, 0x62, 0x91, 0x91, 0xC9, 0xF6, 0x51, 0x9A, 0x9F, 0xC9, 0x2E, 0x22, 0x4E, 0xEF, 0x5C, 0x0D, 0x64, 0x2C, 0xFA, 0xC1, 0xB5, 0xEB, 0x04, 0xFA, 0x53, 0xEB, 0x56, 0xD1, 0xCF, 0xEE, 0xFC, 0xA2, 0x2B, 0x09, 0x8F, 0xE7, 0x38, 0x98, 0x80, 0x44, 0x56, 0x89, 0x81, 0x25, 0xF3, 0xE2, 0x06, 0x88, 0x13, 0xD5, 0x3B, 0x34, 0xDA, 0x36, 0x1D, 0x41, 0x36, 0x26, 0xCA, 0x13, 0xF2, 0x18, 0x13, 0x01, 0xAE, 0x01, 0xE2, 0xC0, 0xE4, 0x60, 0x92, 0xB0, 0x52, 0x31, 0x61, 0x58, 0xB5, 0x98, 0xBC, 0xC8, 0xC0, 0x5C, 0x07, 0xF9, 0xC0, 0xF6, 0xC5, 0xC4, 0x8B, 0xF2, 0xB3, 0x8B, 0x93, 0xCF, 0x04, 0xC8, 0x65, 0x77, 0x0B, 0x07, 0x10, 0x22, 0x94, 0xC5, 0x27, 0x44, 0xA8, 0xFC, 0x53, 0xFB, 0x7B, 0xD3, 0xC7, 0x57, 0xD2, 0x9A, 0xE5, 0x99, 0x2A, 0xEA, 0x86, 0x8B, 0x37, 0xD2, 0x2D, 0x57, 0x7C, 0xB2, 0xFA, 0x8E, 0x80, 0xCA, 0x04, 0x52, 0x32, 0x06, 0x54, 0x22, 0xC3, 0x78, 0xF6, 0x0D, 0x75, 0x4E, 0x4F, 0x50, 0xDB, 0x11, 0x25, 0xAC, 0x4E, 0x92, 0x4E, 0x72, 0x43, 0x31, 0xAD, 0x54, 0x78, 0x8F, 0xCE, 0x03, 0x6A, 0x3E, 0x4F, 0x54, 0x47, 0x5E, 0x31, 0xC9, 0xAC, 0x20, 0x09, 0x1D, 0x09, 0x6D, 0x06, 0xE8, 0x70, 0x22, 0x42, 0xF3, 0x4F, 0x88, 0xAF, 0x54, 0x8A, 0x9E, 0xFE, 0xF7, 0x71, 0xBA, 0xEB, 0xD2, 0x51, 0x1A, 0xE8, 0xA9, 0x8D, 0xC6, 0xB6, 0x9B, 0x2F, 0xA7, 0xC7, 0x5F, 0x7C, 0xA3, 0x9A, 0x8B, 0x37, 0xEB, 0xB6, 0xF2, 0xCB, 0x1D, 0x40, 0xF8, 0x2E, 0x1D, 0xBF, 0xBD, 0x83, 0x6A, 0x29, 0x67, 0x61, 0x00, 0xBA, 0x06, 0x26, 0xDE, 0xFB, 0xD7, 0xE9, 0xAE, 0x60, 0xA2, 0x8B, 0x67, 0x16, 0xA8, 0xC0, 0x56, 0x12, 0xFE, 0x4A, 0xBC, 0x27, 0x53, 0x62, 0x2B, 0xA8, 0x54, 0x2C, 0x08, 0x8B, 0x0A, 0x56, 0x55, 0x85, 0x57, 0x7F, 0x85, 0xD3, 0x49, 0xE2, 0x08, 0x6A, 0x33, 0xD2, 0x22, 0xFF, 0x89, 0xF9, 0x3C, 0xFD, 0xE6, 0x1F, 0xEF, 0xBB, 0x92, 0xAE, 0x1B, 0x5E, 0x41, 0x17, 0x9C, 0x3F, 0x52, 0xC5, 0x89, 0x6D, 0x70, 0x3E, 0x13, 0x01, 0x42, 0x70, 0x06, 0x55, 0x6E, 0x00, 0x89, 0x3D, 0x85, 0x25, 0x68, 0x7E, 0x04, 0xD6, 0x0C, 0xA4, 0x69, 0xCD, 0x40, 0x86, 0x36, 0x0F, 0xF7, 0x8A, 0xD5, 0xB9, 0x79, 0xC8, 0x79, 0x5E, 0xB2, 0xD6, 0xD9, 0x77, 0xB8, 0xF1, 0xD1, 0x37, 0xE8, 0xD0, 0x6C, 0x91, 0x89, 0xD3, 0xA2, 0x92, 0xC7, 0x84, 0x6E, 0xBE, 0x76, 0xE6, 0x26, 0xBC, 0x5F, 0xF3, 0x8B, 0xDD, 0x07, 0xE9, 0xA6, 0xCD, 0x6E, 0x71, 0x71, 0xC5, 0xE6, 0xF3, 0xE8, 0xF5, 0x03, 0x35, 0x22, 0xC1, 0xE1, 0x58, 0x8E, 0xE8, 0x79, 0x47, 0x4C, 0x24, 0xDC, 0x87, 0x24, 0xD8, 0x05, 0xF3, 0x83, 0x2A, 0xBB, 0xF2, 0x4B, 0x10, 0x80, 0xFF, 0xCC, 0x68, 0x1F, 0xBD, 0x7A, 0xA4, 0x35, 0x76, 0x7F, 0x40, 0x35, 0x6D, 0x8D, 0xFA, 0xE8, 0x60, 0x9A, 0xFA, 0x59, 0x51, 0xDB, 0x38, 0x98, 0x11, 0xCF, 0xF1, 0x55, 0x3D, 0xB4, 0x6A, 0x70, 0x80, 0x2E, 0x18, 0xF5, 0x1F, 0x43, 0xD9, 0x40, 0xB0, 0xF0, 0xEF, 0xFF, 0xF9, 0x80, 0x78, 0x05, 0x6B, 0xC7, 0x8A, 0x6E, 0x35, 0x80, 0xAB, 0x3C, 0xF8, 0xC2, 0x41, 0xFA, 0xE9, 0x0D, 0x35, 0x63, 0x60, 0x45, 0x9F, 0xDB, 0xAA, 0xC0, 0xB9, 0x0B, 0xD7, 0xEB, 0x10, 0x03, 0x8E, 0xA4, 0xD5, 0x46, 0x04, 0x89, 0x88, 0x72, 0xA9, 0x20, 0xD8, 0x95, 0x9A, 0xDE, 0x34, 0xBC, 0xEB, 0x3A, 0xA7, 0x41, 0x87, 0xE7, 0x4A, 0x74, 0x78, 0xBE, 0x44, 0xFB, 0x72, 0x05, 0x9A, 0x2B, 0x54, 0x68, 0xFA, 0x48, 0x5E, 0xBC, 0xBF, 0x37, 0xDF, 0xFA, 0xC1, 0x30, 0x6D, 0x9B, 0x49, 0xBA, 0x2B, 0xD7, 0xF6, 0xD2, 0xF8, 0xEA, 0x1E, 0x31, 0xF1, 0xA3, 0xCB, 0x52, 0x34, 0xDA, 0x5F, 0x55, 0xB9, 0x5C, 0xD9, 0xB3, 0xD9, 0x9A, 0x8C, 0x76, 0x45, 0x78, 0x5E, 0x2E, 0x59, 0x53, 0x23, 0x18, 0x28, 0xAC, 0xE5, 0x18, 0x88, 0x01, 0x7B, 0x33, 0xCF, 0xEE, 0x3B, 0x4E, 0x7B, 0x0E, 0x8E, 0x90, 0xE4, 0x48, 0x9E, 0x66, 0xB0, 0xC2, 0x9C, 0x18, 0x03, 0x4E, 0xDF, 0x1B, 0xC4, 0xB4, 0x18, 0xAE, 0x5E, 0x57, 0xEB, 0x38, 0x06, 0x11, 0x7F, 0xE3, 0xAB, 0xA5, 0x38, 0x12, 0x22, 0x8B, 0xFA, 0xFB, 0xFB, 0xE9, 0xAD, 0x93, 0x25, 0x9A, 0x3D, 0x53, 0xA6, 0x3D, 0x87, 0xE6, 0xE8, 0xD0, 0xA9, 0x02, 0xB3, 0xD1, 0x02, 0xED, 0x3D, 0xBA, 0x40, 0xB3, 0x85, 0x7A, 0xC5, 0xAF, 0xC5, 0x4D, 0x0C, 0x2D, 0xEE, 0x9E, 0xCB, 0x87, 0xC4, 0xEA, 0x0F, 0x4D, 0x68, 0x98, 0x00, 0x9A, 0xFE, 0xE6, 0xA1, 0x2C, 0xED, 0x3D, 0x96, 0x17, 0x7A, 0x4C, 0x5C, 0x4B, 0x01, 0x7A, 0xC6, 0x83, 0x7F, 0x3B, 0x48, 0x8F, 0xDF, 0xB2, 0x59, 0xB4, 0x0C, 0x62, 0x42, 0x05, 0x7C, 0x9B, 0x82, 0xF7, 0xE8, 0xC4, 0xD0, 0xA0, 0x6C, 0xBB, 0x71, 0xA3, 0x33, 0xE1, 0x6A, 0x23, 0xBC, 0x61, 0x28, 0x78, 0x90, 0xAF, 0x00, 0x1D, 0x15, 0xEF, 0x39, 0x38, 0x27, 0x3A, 0x85, 0xC1, 0xEB, 0x04, 0xEC, 0x3B, 0x51, 0x50, 0x08, 0xD8, 0xBF, 0x05, 0xA5, 0x92, 0xF9, 0x01, 0x9C, 0xD4, 0xF4, 0xD1, 0x77, 0x98, 0xB4, 0x50, 0x12, 0x5B, 0x0D, 0x38, 0xEB, 0xC1, 0x98, 0xC1, 0xBA, 0x80, 0xB9, 0xE9, 0x05, 0xAE, 0x71, 0x10, 0x38, 0x5F, 0x6B, 0xC2, 0x9B, 0x41, 0xBE, 0x9B, 0x68, 0xB3, 0x32, 0xAD, 0x7C, 0x8E, 0xF6, 0xA7, 0xE9, 0xB3, 0xEB, 0xF5, 0x27, 0x9B, 0x32, 0x0D, 0x06, 0x23, 0xC5, 0xE6, 0x50, 0x10, 0x80, 0x40, 0xAE, 0xF9, 0x48, 0x38, 0x51, 0x05, 0x95, 0xD1, 0x4C, 0xDC, 0xB4, 0xA1, 0xBE, 0x03, 0x62, 0x70, 0x74, 0xAB, 0xF0, 0xDA, 0xAE, 0xD9, 0x50, 0xEB, 0x4F, 0x6C, 0x26, 0x2E, 0x2F, 0x60, 0xC9, 0x1D, 0xC0, 0x75, 0xCF, 0x1F, 0x5E, 0xEE, 0x6A, 0x18, 0x2B, 0xB0, 0x5B, 0x80, 0x58, 0x24, 0x86, 0x8A, 0x78, 0x01, 0x02, 0x90, 0x19, 0x10, 0x84, 0xE2, 0xBC, 0x28, 0xFF, 0x4D, 0x3B, 0xA8, 0x64, 0x11, 0x41, 0x13, 0xAE, 0x10, 0x46, 0x08, 0xDE, 0x32, 0x3B, 0xF1, 0x0E, 0x3D, 0xC7, 0x14, 0xCA, 0x9A, 0x83, 0x33, 0x5D, 0x5E, 0x17, 0x31, 0xB0, 0xDE, 0xC0, 0x7B, 0xED, 0xBA, 0x64, 0x4D, 0xE3, 0xA0, 0x9C, 0x42, 0xD4, 0xC2, 0xD4, 0x84, 0x79, 0xA9, 0x83, 0xE0, 0xA5, 0xE8, 0xC9, 0xA1, 0xDB, 0xB0, 0xF1, 0x24, 0xD1, 0xBE, 0xC2, 0x8A, 0x08, 0x83, 0x74, 0xDA, 0xEC, 0x58, 0x1C, 0x7A, 0x44, 0x23, 0xB0, 0x7A, 0x59, 0x92, 0xA0, 0xF4, 0x05, 0x01, 0xC4, 0xC0, 0x7C, 0xD1, 0xD9, 0xE4, 0xD1, 0xA5, 0x8B, 0x42, 0x0C, 0xA6, 0x1C, 0x54, 0xDD, 0x21, 0xC4, 0xAE, 0x2A, 0xCC, 0x4C, 0xDB, 0x90, 0x90, 0x74, 0x6D, 0xF4, 0xC3, 0xC9, 0xF6, 0x3C, 0xF4, 0xD2, 0x7B, 0xC2, 0xD4, 0xD4, 0xA5, 0x13, 0xA3, 0x23, 0xD9, 0x84, 0x4C, 0xD0, 0xA3, 0x9C, 0xB9, 0x4B, 0x9C, 0x78, 0x36, 0xA0, 0x2F, 0xC0, 0xEC, 0xBA, 0xF8, 0xDC, 0x70, 0x62, 0x30, 0xE5, 0x0C, 0x50, 0x26, 0xA3, 0xC2, 0x0F, 0xAF, 0x1E, 0xA6, 0xAB, 0xCE, 0x0B, 0x6F, 0xC3, 0x1C, 0xAF, 0x9C, 0x9F, 0xBF, 0x7C, 0x82, 0xFE, 0xB4, 0x7F, 0x3E, 0x6A, 0x15, 0x75, 0xE9, 0x4D, 0x39, 0x03, 0x32, 0x4A, 0x25, 0x12, 0x61, 0xE7, 0xD8, 0xBB, 0xF5, 0xAA, 0xA4, 0x24, 0x06, 0xD4, 0x01, 0x53, 0x53, 0x07, 0x91, 0x74, 0x06, 0x71, 0x8C, 0xAC, 0x2B, 0x25, 0x00, 0x67, 0x22, 0x22, 0x90, 0x3D, 0x09, 0x16, 0x69, 0x00, 0x51, 0x95, 0xC7, 0x2F, 0x7F, 0x6C, 0xC0, 0x88, 0x10, 0x50, 0x35, 0x08, 0x17, 0x16, 0x03, 0xB8, 0x88, 0x0E, 0xC0, 0x39, 0x4C, 0x21, 0x8A, 0x48, 0x95, 0x4A, 0x24, 0xCA, 0x86, 0xEE, 0x14, 0x07, 0xA8, 0x5C, 0xFD, 0xB9, 0xFD, 0xA7, 0x08, 0x67, 0x4F, 0x2A, 0x0C, 0x4F, 0xFC, 0xF8, 0x5E, 0xCB, 0xBB, 0xFB, 0x98, 0xE9, 0xD7, 0xEB, 0x0B, 0x6A, 0xC6, 0x28, 0xE1, 0x4D, 0x2B, 0xA5, 0xF9, 0xE8, 0x9F, 0x0B, 0xAC, 0xD1, 0x04, 0x60, 0x4D, 0x44, 0x05, 0x4C, 0x70, 0x54, 0xB8, 0x7E, 0x43, 0xCD, 0x0C, 0x56, 0xF3, 0x42, 0x84, 0x60, 0x8F, 0xC4, 0x04, 0xA2, 0x10, 0x83, 0x5B, 0x6F, 0x08, 0x16, 0x65, 0x26, 0x75, 0x9B, 0xA4, 0x49, 0x66, 0x1C, 0xAB, 0x4D, 0x4D, 0x1B, 0x7D, 0xA4, 0xD4, 0xDC, 0x06, 0xE1, 0x4D, 0x2B, 0xDD, 0xBB, 0x5D, 0xBA, 0x2C, 0xA6, 0xFA, 0x42, 0x23, 0x22, 0x42, 0x57, 0x5F, 0x18, 0x6E, 0xE2, 0xC2, 0x15, 0xB4, 0x2C, 0xAD, 0x5F, 0xA1, 0xA6, 0x7A, 0x43, 0x14, 0x62, 0x90, 0xE6, 0x74, 0x58, 0xBB, 0x9A, 0x89, 0xF7, 0x9A, 0xAC, 0xDE, 0x23, 0x07, 0x7C, 0xE5, 0x1D, 0x89, 0x18, 0xBC, 0x05, 0x9A, 0x34, 0x6E, 0x13, 0x6F, 0xAA, 0x84, 0x81, 0x29, 0x6B, 0x9C, 0x2D, 0xB4, 0x5E, 0x96, 0xFA, 0xB5, 0x6D, 0x7C, 0x55, 0x78, 0xBB, 0xFD, 0xF2, 0x02, 0x1F, 0x85, 0x18, 0xBC, 0xE5, 0x34, 0x74, 0xF4, 0xEE, 0x2D, 0x24, 0xE4, 0x3D, 0xC9, 0xDF, 0x83, 0xA8, 0xC0, 0x6A, 0x73, 0x34, 0x62, 0x50, 0x33, 0x9B, 0x84, 0x4D, 0xAC, 0x08, 0x94, 0x63, 0xAA, 0x2F, 0xC0, 0x46, 0x6E, 0x17, 0x6C, 0x3C, 0xA7, 0xF6, 0x1D, 0x40, 0xA3, 0x75, 0x9A, 0x2A, 0x91, 0x5E, 0xCE, 0x60, 0xBA, 0x38, 0x1A, 0x6D, 0x97, 0x5F, 0x3E, 0x2B, 0x9D, 0x70, 0x9F, 0x4B, 0xE0, 0xF3, 0xEC, 0x56, 0x81, 0x89, 0x88, 0x40, 0x5D, 0xA6, 0x9D, 0x6F, 0x97, 0x98, 0x40, 0x9B, 0x46, 0x7D, 0x94, 0x48, 0x53, 0x31, 0x81, 0x32, 0x4C, 0xB9, 0x83, 0xAA, 0x40, 0x22, 0x5F, 0x5C, 0x1F, 0xD2, 0xAA, 0x16, 0x05, 0xEA, 0xF1, 0x82, 0x55, 0xF1, 0xFC, 0xAC, 0xCB, 0x4A, 0xEA, 0xED, 0xFD, 0x46, 0x2C, 0x89, 0x56, 0x73, 0x06, 0x6F, 0xE3, 0xE3, 0x7C, 0xF7, 0xDB, 0x93, 0x38, 0x1C, 0xD3, 0x61, 0x1A, 0x3E, 0x51, 0xAB, 0x42, 0x1B, 0x2C, 0x8A, 0x6A, 0x5D, 0x4A, 0x40, 0x69, 0x81, 0x82, 0x6D, 0x51, 0xB0, 0x3F, 0xA3, 0x37, 0xD1, 0xBC, 0xC5, 0x9B, 0x5A, 0x13, 0xED, 0xE5, 0x0C, 0xCD, 0x6B, 0xF5, 0xA6, 0x9C, 0x01, 0xE3, 0xA1, 0x8A, 0x0A, 0x53, 0x4E, 0xE9, 0x1D, 0xC7, 0x66, 0xDF, 0x63, 0x25, 0x06, 0x53, 0x31, 0x61, 0xDA, 0x89, 0x76, 0x9E, 0x5C, 0xFA, 0x1D, 0x4F, 0x9B, 0xB6, 0x15, 0xE9, 0xA2, 0x10, 0x83, 0x5A, 0x6E, 0x5C, 0x62, 0x42, 0xAD, 0x43, 0x17, 0x8E, 0x95, 0x18, 0xBC, 0xB2, 0x50, 0xD7, 0x80, 0x25, 0x5C, 0xFD, 0x08, 0xC4, 0xC6, 0x19, 0x42, 0x76, 0x90, 0x63, 0x25, 0x86, 0xFA, 0x6E, 0x2E, 0x61, 0x3A, 0x39, 0x02, 0xA1, 0x0A, 0x64, 0x27, 0x1B, 0xB7, 0x54, 0x77, 0x77, 0x8D, 0xC0, 0x12, 0x67, 0xE8, 0xAE, 0xF9, 0xE8, 0x68, 0x6B, 0x96, 0x88, 0xA1, 0xA3, 0xC3, 0xDF, 0x5D, 0x95, 0x2F, 0x11, 0x43, 0x77, 0xCD, 0x47, 0x47, 0x5B, 0xB3, 0x44, 0x0C, 0x1D, 0x1D, 0xFE, 0xEE, 0xAA, 0x7C, 0x89, 0x18, 0xBA, 0x6B, 0x3E, 0x3A, 0xDA, 0x9A, 0x25, 0x62, 0xE8, 0xE8, 0xF0, 0x77, 0x57, 0xE5, 0xB1, 0x12, 0x43, 0x3B, 0x4F, 0x19, 0xBB, 0x6B, 0x58, 0xBB, 0xBF, 0x35, 0x70, 0xF7, 0xE3, 0x06, 0x76, 0x17, 0xE8, 0x46, 0xB4, 0xF6, 0xED, 0xCD, 0xE3, 0x67, 0xEF, 0x4F, 0xE9, 0x4C, 0xBF, 0x68, 0x0A, 0x1A, 0x31, 0xD3, 0x33, 0x17, 0x6F, 0x19, 0x8D, 0x1C, 0x0A, 0x7A, 0xCB, 0x68, 0xE4, 0x3D, 0x02, 0x31, 0xE8, 0xBF, 0xFC, 0x09, 0xAA, 0x74, 0xCE, 0xF0, 0x63, 0x14, 0xD3, 0x3D, 0xFC, 0x4B, 0xD6, 0xD4, 0x7C, 0x27, 0x05, 0xD5, 0xDB, 0x8A, 0xB8, 0x28, 0x47, 0xD5, 0x7E, 0xF5, 0x45, 0x21, 0x06, 0xD7, 0x21, 0x5C, 0xC8, 0xB6, 0xB1, 0x5F, 0x7D, 0xCD, 0xE2, 0x8D, 0x89, 0x21, 0x4A, 0xC7, 0x64, 0xA3, 0x5E, 0x39, 0xEC, 0x76, 0xC4, 0x25, 0xF1, 0xDE, 0xA7, 0xE9, 0x47, 0x20, 0xDE, 0x7C, 0x71, 0xBE, 0xFB, 0x11, 0x83, 0xDF, 0x77, 0x0E, 0xCD, 0xB6, 0x45, 0x3D, 0x84, 0x0B, 0xDB, 0x36, 0x6E, 0xB6, 0x2E, 0xBF, 0xFC, 0x75, 0xC4, 0x00, 0xD7, 0x7B, 0xAD, 0x02, 0x53, 0x31, 0x61, 0xDA, 0x79, 0xFC, 0xBC, 0xBD, 0x5D, 0xE0, 0xF7, 0xDD, 0x82, 0xDF, 0x77, 0x0E, 0xBA, 0x76, 0x99, 0x2E, 0x20, 0xAF, 0x6E, 0xA5, 0x7E, 0xC9, 0xAC, 0x2B, 0xB7, 0x15, 0x38, 0xB8, 0x09, 0x54, 0x01, 0x7E, 0xA8, 0xAD, 0x52, 0xB9, 0x3C, 0xA5, 0x22, 0xE1, 0x8B, 0xB1, 0x55, 0xD0, 0x6A, 0xCE, 0xA0, 0xFE, 0xE0, 0xA4, 0x55, 0x6D, 0xF4, 0x2B, 0x27, 0xCA, 0x67, 0xF1, 0x7E, 0x65, 0x98, 0x7E, 0xCE, 0xE7, 0x12, 0x11, 0x5C, 0x98, 0xE9, 0xE2, 0xF0, 0xAB, 0xD7, 0x0F, 0xAF, 0x9E, 0x86, 0x7A, 0x1D, 0xB2, 0xC2, 0x21, 0x79, 0x1D, 0x67, 0xF0, 0x2B, 0x08, 0xF8, 0x46, 0x3E, 0xD4, 0x7C, 0xD3, 0xE0, 0x47, 0xB2, 0x71, 0x75, 0x3E, 0xA8, 0x2F, 0x61, 0x71, 0x70, 0x13, 0xD0, 0x0C, 0x98, 0x72, 0x05, 0x5D, 0x1D, 0x8D, 0x7C, 0x78, 0xAC, 0x2B, 0xA7, 0x0E, 0x17, 0xF2, 0x05, 0x55, 0x24, 0x62, 0xA8, 0x2B, 0xDC, 0x00, 0x61, 0x22, 0x2A, 0x8A, 0x45, 0x33, 0xD1, 0xA4, 0xFA, 0x33, 0x30, 0xA8, 0xBA, 0xE1, 0x24, 0x93, 0xFF, 0x3C, 0xE9, 0xFB, 0x33, 0x3B, 0x53, 0x31, 0x11, 0x85, 0x18, 0xBC, 0x9C, 0xA1, 0xE1, 0x86, 0x07, 0x64, 0x14, 0x4E, 0xCB, 0xD8, 0x21, 0x48, 0x10, 0x58, 0x99, 0x8A, 0xED, 0x32, 0x38, 0xA5, 0x8F, 0x67, 0x7D, 0xA6, 0xE8, 0x16, 0xC5, 0x9B, 0xC7, 0xC3, 0x57, 0x98, 0xB1, 0x35, 0xB1, 0xE8, 0xFE, 0x46, 0xDF, 0x36, 0x3D, 0x16, 0x3F, 0x99, 0x8B, 0x0A, 0xCF, 0xEC, 0xF7, 0x17, 0x95, 0xA6, 0x5F, 0x40, 0x45, 0x21, 0x86, 0xE7, 0xF6, 0x9F, 0xAC, 0x36, 0xB1, 0x5D, 0x66, 0x25, 0x5C, 0xFC, 0x78, 0xC1, 0x52, 0x3D, 0x84, 0x22, 0x32, 0x88, 0x18, 0xA2, 0x74, 0x50, 0x56, 0xF4, 0xC7, 0x7D, 0xB5, 0x8E, 0x4A, 0x9C, 0xEE, 0x69, 0x6A, 0x51, 0xE0, 0x77, 0x89, 0x51, 0xE0, 0xB7, 0xFF, 0x99, 0xA5, 0x67, 0xDE, 0xF2, 0x9F, 0x5C, 0xB5, 0x2C, 0x10, 0xCE, 0x8F, 0x76, 0x1F, 0x23, 0x3F, 0x0F, 0x32, 0x17, 0xB1, 0x8B, 0x1E, 0x53, 0x88, 0x32, 0x56, 0xAA, 0x02, 0x19, 0x97, 0x88, 0x50, 0xF5, 0x85, 0x6B, 0x36, 0x2C, 0xAF, 0x73, 0x3C, 0x8E, 0xCB, 0x4B, 0x9C, 0xAF, 0x3E, 0xD9, 0xDB, 0x38, 0xFF, 0xFC, 0x77, 0x4C, 0x76, 0x14, 0x9A, 0xA6, 0xCE, 0x95, 0x8F, 0x5A, 0xA0, 0x4C, 0x1B, 0xF6, 0xC4, 0x00, 0xBF, 0xFC, 0xEE, 0xE9, 0xD0, 0x1F, 0xDF, 0xC2, 0xA7, 0x81, 0x89, 0xC2, 0x85, 0x0F, 0x47, 0xA3, 0xFE, 0xDE, 0xF2, 0xFE, 0xBF, 0x1F, 0xA7, 0xC9, 0xD7, 0x4E, 0x36, 0xFD, 0x2B, 0xEC, 0xB0, 0xBE, 0xAA, 0xF1, 0x26, 0x7D, 0x91, 0xE9, 0xD5, 0xFE, 0xC4, 0xA5, 0x3F, 0xA9, 0xDF, 0x55, 0x6E, 0xBF, 0x72, 0x2D, 0x3D, 0xF6, 0xA4, 0xAC, 0xBD, 0xF6, 0x14, 0xC4, 0xC0, 0x8C, 0x14, 0x9A, 0xE4, 0x98, 0x44, 0xEB, 0x58, 0x88, 0x88, 0x6B, 0xD0, 0x31, 0x36, 0xAC, 0x8A, 0xB0, 0x5F, 0x62, 0x43, 0x6F, 0xE8, 0xE9, 0x09, 0x5F, 0x79, 0x8D, 0x5A, 0x14, 0x58, 0xED, 0x7E, 0x2B, 0x5E, 0xF6, 0x3B, 0xEC, 0xD9, 0x9F, 0x36, 0x57, 0xB1, 0x4C, 0x17, 0x8E, 0xEA, 0x62, 0x00, 0x26, 0x65, 0x5C, 0x62, 0x42, 0xB6, 0xE7, 0xAE, 0x4B, 0x57, 0xBB, 0x1C, 0x85, 0xAA, 0x7D, 0x16, 0xBD, 0x63, 0x4D, 0x60, 0x46, 0x45, 0xD6, 0xEF, 0x5B, 0x3B, 0xB1, 0x51, 0x58, 0x9F, 0x5A, 0x9E, 0x89, 0xA8, 0x88, 0xE2, 0xFA, 0x46, 0x2D, 0xBB, 0x9D, 0xE1, 0x28, 0xBF, 0xB2, 0x32, 0xE5, 0x0C, 0xAA, 0xBE, 0x20, 0x44, 0x44, 0x4C, 0xBB, 0x8F, 0x50, 0x20, 0xF1, 0xDB, 0x8C, 0xDB, 0x3E, 0x3D, 0x42, 0xEF, 0x1C, 0xD5, 0x8B, 0x6E, 0x41, 0x0C, 0xBA, 0x2B, 0x7D, 0xFC, 0x06, 0x59, 0x52, 0x98, 0x5F, 0xBC, 0x0E, 0x7F, 0x78, 0xAE, 0x48, 0x7F, 0x79, 0xDB, 0xBD, 0xC9, 0xE1, 0x4D, 0x07, 0xF6, 0xD8, 0xED, 0x04, 0x01, 0xB7, 0x7E, 0x26, 0x00, 0x5F, 0x13, 0xA6, 0x0B, 0xC7, 0x45, 0x0C, 0x31, 0x11, 0x02, 0xDA, 0x0C, 0x31, 0xB1, 0xFD, 0xAA, 0xB5, 0xC2, 0x1F, 0xE5, 0x81, 0xA3, 0xEE, 0xFB, 0x3B, 0x58, 0x81, 0x9F, 0x42, 0x1A, 0x21, 0x26, 0x70, 0x39, 0x58, 0x46, 0x31, 0x3B, 0x9C, 0xDB, 0x62, 0x36, 0x20, 0xBE, 0x1E, 0x60, 0xAB, 0x36, 0xD0, 0x68, 0x70, 0x87, 0x30, 0xBF, 0x4E, 0x20, 0x08, 0xE9, 0xE1, 0x0D, 0x5E, 0xDE, 0xF0, 0x07, 0xE5, 0x0A, 0xA6, 0x97, 0x78, 0x1A, 0xEC, 0x59, 0xD4, 0x37, 0xB8, 0x75, 0x18, 0x53, 0xB3, 0xD2, 0xD4, 0xF1, 0x08, 0x5A, 0xA6, 0x2A, 0x8F, 0xBE, 0xE2, 0xB9, 0xC9, 0x2E, 0xC0, 0xD9, 0x3A, 0x14, 0x6F, 0x9D, 0x73, 0x2F, 0x14, 0xCD, 0x1C, 0x41, 0x58, 0x94, 0x8E, 0x02, 0xB9, 0x78, 0xC5, 0x60, 0x93, 0x75, 0x06, 0x66, 0xFF, 0xEB, 0x3B, 0x35, 0x8D, 0xFE, 0x6C, 0xF5, 0x03, 0xF9, 0xE4, 0xDE, 0x59, 0x76, 0x59, 0x98, 0x0C, 0xF5, 0x03, 0x19, 0x38, 0x10, 0x4A, 0x24, 0x08, 0x5F, 0x2A, 0x8F, 0xD0, 0x17, 0x62, 0x53, 0x1E, 0x59, 0x44, 0x80, 0x2B, 0x48, 0x50, 0xBD, 0xC3, 0x02, 0x67, 0x53, 0x62, 0x1A, 0x4F, 0x87, 0x18, 0x10, 0x32, 0x84, 0x64, 0x0A, 0xE7, 0x03, 0xFE, 0x7E, 0x8F, 0x82, 0x8A, 0xB9, 0xFB, 0xD9, 0xF7, 0xCE, 0x6A, 0x0F, 0xB1, 0x30, 0x53, 0xBD, 0xA0, 0xF7, 0x10, 0x9B, 0xA6, 0x0B, 0xEA, 0x7D, 0x61, 0x78, 0xB3, 0x0A, 0x5F, 0x97, 0x12, 0x69, 0xBA, 0xD7, 0x22, 0xD3, 0x1B, 0x3F, 0x99, 0x93, 0x7F, 0x7E, 0xE3, 0x4A, 0x97, 0x2B, 0xC5, 0x93, 0xA7, 0xDD, 0x9F, 0x16, 0xE0, 0x5C, 0x02, 0xE5, 0x69, 0x89, 0xA1, 0xD5, 0x7B, 0x0D, 0xB2, 0xE1, 0x1F, 0x34, 0x57, 0xC1, 0xE8, 0xD7, 0x7F, 0x73, 0xCE, 0xEE, 0xA9, 0xEC, 0xDB, 0xC3, 0xA2, 0xB3, 0x47, 0xC4, 0xFF, 0x30, 0xDF, 0xD1, 0x0F, 0xBD, 0x74, 0x58, 0xA4, 0xC3, 0xBF, 0x38, 0x9C, 0x7A, 0xA1, 0x5C, 0x5C, 0x89, 0x00, 0x53, 0x52, 0x05, 0x2F, 0x31, 0xC8, 0x8B, 0x52, 0x05, 0x31, 0x60, 0xC3, 0x61, 0xD5, 0x9D, 0x3F, 0xA9, 0xA6, 0x0F, 0x22, 0x86, 0x6A, 0xA2, 0xA5, 0x40, 0xE8, 0x08, 0xC0, 0x49, 0x38, 0xFE, 0xF6, 0x1C, 0x0A, 0x76, 0x18, 0x26, 0x4E, 0x29, 0x35, 0x57, 0x1F, 0x84, 0x56, 0x10, 0x92, 0x00, 0xBA, 0xC2, 0x37, 0x2F, 0x5F, 0x5B, 0x67, 0x4A, 0x7A, 0xC5, 0x04, 0x2E, 0x91, 0x45, 0x51, 0x5A, 0xCE, 0x80, 0x88, 0x12, 0xBB, 0xBC, 0x4F, 0xF1, 0xA5, 0x1E, 0x1F, 0x24, 0x80, 0x4C, 0xD6, 0x1D, 0x0F, 0xC7, 0xE6, 0x8C, 0xD3, 0x70, 0xF0, 0xA0, 0xE9, 0xE3, 0x02, 0x15, 0x09, 0x8E, 0xC8, 0x60, 0x51, 0x2C, 0xDA, 0xEB, 0x88, 0x64, 0x1D, 0x4E, 0xA6, 0xF7, 0x3E, 0xE5, 0x7D, 0x13, 0x2B, 0xB2, 0x69, 0x61, 0x4A, 0xAA, 0xF1, 0x30, 0x2B, 0x5F, 0xDC, 0xFB, 0x3F, 0x15, 0x45, 0xF2, 0x02, 0xD4, 0x2A, 0x31, 0x70, 0x65, 0xD3, 0x6C, 0x0E, 0x8D, 0xCB, 0x54, 0x0B, 0xC7, 0x0E, 0xD3, 0xC0, 0x1A, 0x1F, 0x8B, 0x42, 0x26, 0xEA, 0xB2, 0x27, 0x36, 0x6C, 0x84, 0x12, 0xC6, 0x83, 0x28, 0x07, 0x2F, 0xF2, 0xF6, 0x2E, 0xCB, 0x58, 0x98, 0xCF, 0xCE, 0x9F, 0xE5, 0x3C, 0x59, 0x01, 0x53, 0x77, 0xF0, 0xE2, 0xEE, 0xB6, 0xCE, 0x2C, 0xD5, 0x1D, 0x31, 0xC9, 0x3E, 0xAA, 0xED, 0x51, 0x09, 0xFB, 0xB6, 0x8B, 0x46, 0x5C, 0x17, 0x8F, 0x20, 0xDD, 0xE3, 0x2F, 0xD4, 0x2E, 0x1E, 0x11, 0xF9, 0x6C, 0xFB, 0x29, 0x99, 0x5F, 0xD9, 0x52, 0xAB, 0x4C, 0x49, 0x24, 0x9E, 0xF3, 0x47, 0x0E, 0x10, 0x6E, 0x3E, 0xEB, 0x56, 0xC0, 0x0A, 0x87, 0x4F, 0x64, 0x5C, 0xD0, 0x21, 0x2F, 0xEE, 0xC0, 0x85, 0x1B, 0xE5, 0xC5, 0x0B, 0x3B, 0xE4, 0x65, 0x1D, 0x91, 0xDB, 0x8F, 0xD5, 0xC8, 0xFE, 0x9B, 0x21, 0xC3, 0xE1, 0x9E, 0xDF, 0x29, 0x3F, 0x2F, 0x2E, 0x05, 0x29, 0xF2, 0xA5, 0x20, 0xC0, 0xC5, 0xB5, 0x4B, 0x18, 0xB5, 0xAD, 0x20, 0x9A, 0xA0, 0x8B, 0x54, 0x7E, 0xF3, 0xEA, 0xFB, 0x2E, 0xD3, 0xF5, 0xB5, 0x77, 0x8E, 0xD0, 0xCE, 0xA7, 0x77, 0xBB, 0xAA, 0x29, 0xDB, 0x54, 0x25, 0x86, 0x2A, 0xC1, 0x65, 0x2E, 0xFC, 0x42, 0x3E, 0xA9, 0x5E, 0x5A, 0x26, 0x4C, 0x1D, 0x9B, 0xB2, 0x2B, 0x86, 0x5C, 0x99, 0x3B, 0xF9, 0x82, 0x95, 0x80, 0xC9, 0xC0, 0x35, 0x07, 0x65, 0x3E, 0xCB, 0x10, 0x13, 0x1E, 0x83, 0xAC, 0xF5, 0xED, 0xA3, 0x87, 0x50, 0x9C, 0x95, 0xE9, 0xB8, 0x21, 0x6A, 0x64, 0x33, 0xCE, 0xB7, 0x9E, 0x16, 0x45, 0x14, 0xCA, 0x15, 0x9A, 0xC9, 0xE5, 0xE9, 0xFA, 0x4D, 0xE7, 0x10, 0x08, 0xE1, 0x4B, 0x0F, 0x3C, 0x49, 0x67, 0x4A, 0x35, 0xBF, 0x58, 0x7C, 0x25, 0x72, 0xEE, 0xD8, 0xC3, 0xDB, 0xBE, 0x2A, 0xAB, 0xE3, 0x1D, 0xA4, 0x1A, 0x2C, 0xDD, 0x6B, 0x59, 0x1B, 0x8B, 0xA8, 0xA1, 0x6E, 0xBE, 0xD7, 0xF2, 0xBA, 0x95, 0xF3, 0xF4, 0x87, 0xDD, 0xAF, 0xD3, 0xA9, 0x05, 0xB7, 0x49, 0x59, 0x28, 0x95, 0xB7, 0xAA, 0x57, 0x21, 0x57, 0x75, 0x06, 0x74, 0xBE, 0x54, 0xB6, 0x77, 0x64, 0x2C, 0x6B, 0x4A, 0x1D, 0x88, 0x93, 0x6F, 0xFF, 0x4B, 0x1C, 0x6B, 0xB7, 0x53, 0x7F, 0x10, 0x22, 0x40, 0x78, 0x66, 0x67, 0x2A, 0x86, 0xFC, 0x67, 0x71, 0x60, 0x7A, 0xCB, 0x6D, 0x71, 0xDE, 0xBD, 0xD5, 0xAA, 0xF6, 0xA5, 0xD9, 0x70, 0x7A, 0x99, 0xDB, 0x1B, 0x3B, 0xCA, 0xD3, 0xDD, 0x78, 0x8B, 0x74, 0xB8, 0x49, 0xAF, 0x9D, 0x7A, 0x86, 0xB7, 0x6F, 0xEA, 0x8D, 0xB7, 0x8F, 0x2D, 0xDE, 0x43, 0xAE, 0xA6, 0x61, 0x51, 0x38, 0xA9, 0x12, 0x82, 0xE8, 0x8B, 0x9A, 0x00, 0xE1, 0xB0, 0xBB, 0xB0, 0x5B, 0x79, 0xE9, 0x29, 0x2C, 0x16, 0x98, 0xB1, 0xF2, 0xE2, 0x74, 0x5C, 0xF4, 0x0D, 0x1C, 0x6F, 0x82, 0xF0, 0xBD, 0xD8, 0xF1, 0x4D, 0xAA, 0xB7, 0xCF, 0x71, 0xBE, 0xCB, 0x8B, 0xCE, 0xC5, 0x9D, 0xD8, 0x8B, 0x17, 0xC8, 0xB7, 0xFA, 0x0E, 0x6C, 0xD9, 0x7E, 0xD3, 0xBB, 0xB0, 0x41, 0x08, 0xEF, 0x4F, 0x6E, 0xBB, 0x43, 0xE6, 0x93, 0x4F, 0x97, 0x98, 0x90, 0x48, 0x16, 0x17, 0xAF, 0xA8, 0x96, 0x85, 0xC4, 0xE3, 0x89, 0x4E, 0x65, 0x07, 0x87, 0xF9, 0xB2, 0xEF, 0x01, 0x71, 0x8B, 0x3B, 0x2E, 0xFD, 0xF6, 0xBB, 0x23, 0x1B, 0x8D, 0x13, 0xAB, 0x9A, 0x6F, 0x72, 0x17, 0x93, 0xBE, 0x78, 0xAB, 0xBB, 0x13, 0x0E, 0xFF, 0x02, 0x4A, 0xAD, 0xF7, 0x83, 0x1E, 0x86, 0xC7, 0x56, 0xD5, 0x6B, 0x2B, 0x5C, 0x30, 0xFA, 0x79, 0xDE, 0x93, 0x63, 0x81, 0xC5, 0x83, 0x85, 0x84, 0x31, 0x2E, 0x2D, 0x5E, 0x2E, 0x2F, 0xE3, 0xFC, 0x9E, 0xAC, 0xFC, 0xEE, 0x3A, 0x3A, 0xB9, 0xFD, 0xDB, 0xBA, 0x78, 0x2D, 0x31, 0x10, 0x5F, 0x6D, 0x37, 0xB2, 0x6C, 0x64, 0x17, 0x1F, 0x7B, 0x4E, 0xE8, 0x32, 0x2D, 0xE1, 0xCE, 0xBE, 0x11, 0x60, 0x65, 0x77, 0x6A, 0xAE, 0x90, 0x9F, 0x90, 0x7B, 0x0A, 0xBA, 0x1E, 0xE8, 0x89, 0x61, 0x31, 0xE5, 0xC8, 0xED, 0x3B, 0xBF, 0xC5, 0x7E, 0x22, 0x77, 0x88, 0xBB, 0x0F, 0x75, 0xB9, 0xDB, 0x88, 0x43, 0x67, 0xDC, 0xD5, 0x55, 0xF8, 0x70, 0xC5, 0xCA, 0xB9, 0x71, 0xAC, 0xF7, 0xF0, 0x7E, 0x09, 0xEB, 0x19, 0x75, 0x78, 0x6F, 0xBA, 0x46, 0xDE, 0x53, 0xC9, 0xE4, 0x96, 0xFA, 0x7C, 0xF6, 0x20, 0xF3, 0xCB, 0x71, 0x15, 0xCF, 0x5C, 0x55, 0x93, 0x4E, 0x4D, 0xD1, 0xBE, 0x30, 0x44, 0x42, 0xB1, 0xCC, 0xFA, 0x01, 0xEF, 0x32, 0x87, 0xD5, 0x1A, 0x48, 0x0C, 0x22, 0x33, 0x73, 0x89, 0xA1, 0xDE, 0x91, 0xAD, 0x49, 0x8B, 0x76, 0xA8, 0x9F, 0xC6, 0x85, 0x15, 0x6C, 0x1A, 0x5F, 0x9B, 0xE4, 0xC4, 0x14, 0xF2, 0xC8, 0xDF, 0x71, 0x60, 0x8B, 0x34, 0x88, 0x8A, 0x4D, 0xCB, 0xEF, 0x74, 0x3A, 0xE9, 0xB5, 0x1F, 0xD7, 0x05, 0x3A, 0xB7, 0xC4, 0xA9, 0xC4, 0x93, 0x18, 0x6F, 0xE5, 0x42, 0x83, 0xA9, 0xC8, 0x1A, 0xF7, 0x34, 0xFE, 0x4A, 0x36, 0x4D, 0xE5, 0x16, 0x8E, 0x4E, 0xD1, 0x13, 0xF7, 0xEB, 0xBF, 0x64, 0xD1, 0x0C, 0x4C, 0x38, 0x31, 0x28, 0x99, 0xB2, 0xB7, 0xDE, 0xB7, 0x7E, 0x20, 0x95, 0xDD, 0xCA, 0x07, 0xE0, 0xE3, 0xC2, 0xF1, 0xB4, 0xC1, 0x0A, 0xF0, 0x9B, 0x6C, 0x13, 0x4A, 0x55, 0xAA, 0xFE, 0xC0, 0x07, 0x25, 0xD1, 0xC8, 0x8E, 0xEA, 0xB9, 0x90, 0x8C, 0x75, 0x9E, 0x38, 0x6D, 0x94, 0x87, 0x4C, 0xB9, 0xFC, 0xB1, 0xE9, 0x28, 0x13, 0xEF, 0x2E, 0xC9, 0x79, 0xFB, 0x3F, 0xDA, 0xEC, 0x8F, 0x7E, 0x31, 0xB3, 0xD5, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
-
-constexpr std::size_t size = sizeof(data);
-
-}  // namespace car_blue_1
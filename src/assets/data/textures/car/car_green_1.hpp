@@ -1,11 +0,0 @@
-#pragma once
-
-#include <cstddef>  // for std::size_t
-
-namespace car_green_1 {
-
-constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x47, 0x08, 0x06, 0x00, 0x00, 0x00, 0x24, 0xE4, 0xF4, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0x44, 0x65, 0x58, 0x49, 0x66, 0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0xA0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x6B, 0x38, 0x00, 0x00, 0x10, 0x8D, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x5D, 0x7D, 0x6C, 0x1C, 0xC5, 0x15, 0x7F, 0xBB, 0x77, 0x3E, 0x9F, 0x3F, 0x62, 0x5F, 0xEC, 0x24, 0xCE, 0x07, 0x24, 0x26, 0x21, 0x41, 0x50, 0x20, 0x26, 0xF4, 0x83, 0x26, 0x84, 0xA6, 0x12, 0x2D, 0x88, 0x4A, 0x25, 0xAA, 0x44, 0x4B, 0x55, 0x55, 0x0D, 0x42, 0x6A, 0xFF, 0x40, 0x2A, 0x50, 0x88, 0xDA, 0x4A, 0x48, 0xCD, 0x1F, 0xAD, 0xD4, 0x0A, 0x0A, 0x41, 0x55, 0xFF, 0x68, 0x2A, 0x4A, 0x50, 0x55, 0x89, 0xF6, 0xAF, 0x40, 0x55, 0x04, 0x08, 0x5A, 0x13, 0x20, 0x42, 0xB4, 0x04, 0x07, 0x50, 0x2B, 0x35, 0x89, 0xE3, 0x50, 0x4C, 0xE2, 0x40, 0x92, 0x8B, 0x89, 0x3F, 0xEE, 0x63, 0x77, 0x3B, 0xBF, 0x39, 0xCF, 0x7A, 0x76, 0x6F, 0x76, 0x77, 0xF6, 0x7C, 0x7B, 0xB6, 0xB1, 0x9F, 0x74, 0x9A, 0xB9, 0x37, 0x33, 0x6F, 0xBE, 0xDE, 0xBC, 0x79, 0xF3, 0x66, 0x76, 0xC6, 0xA0, 0x98, 0x90, 0x7B, 0x70, 0xEB, 0xED, 0x26, 0x51, 0x9F, 0x63, 0x98, 0x7D, 0x26, 0x39, 0x39, 0xC7, 0xA6, 0x5E, 0x33, 0x6D, 0xF6, 0x7A, 0xC8, 0xD8, 0xF6, 0x80, 0x43, 0x94, 0x07, 0xCE, 0x71, 0x9C, 0x7E, 0xB8, 0x36, 0xD1, 0x00, 0x59, 0x29, 0x8E, 0xCB, 0x8F, 0x0D, 0x0F, 0xD0, 0xBE, 0xC1, 0x0B, 0xC0, 0x2F, 0x82, 0xD4, 0x02, 0xDF, 0x5F, 0xDF, 0x99, 0x6B, 0x5B, 0xD3, 0x27, 0x30, 0x66, 0xCA, 0xDA, 0x21, 0xFC, 0x2A, 0xD7, 0x70, 0xEC, 0x21, 0xCB, 0x6E, 0x1A, 0x42, 0x58, 0xFE, 0xB1, 0x57, 0x5F, 0x51, 0xC5, 0x89, 0x83, 0x33, 0x74, 0x22, 0x77, 0x3F, 0x70, 0xC3, 0xF7, 0x1C, 0x33, 0xB5, 0xC3, 0x34, 0xCD, 0x5D, 0x3A, 0xF1, 0x63, 0xC5, 0x91, 0x18, 0xC7, 0x70, 0xCC, 0x01, 0x9B, 0x2C, 0xCE, 0x30, 0x32, 0xF3, 0x4C, 0x16, 0xAD, 0xA1, 0xC9, 0xDF, 0x1E, 0x3A, 0x19, 0x8B, 0xEE, 0x1C, 0x89, 0x9C, 0xBD, 0x67, 0xEB, 0xBA, 0x6C, 0x26, 0xD5, 0x8B, 0xE2, 0xA4, 0xCC, 0x52, 0x2F, 0x1B, 0x44, 0xDC, 0x6F, 0x52, 0x2A, 0xE7, 0x18, 0x36, 0xEF, 0x78, 0x87, 0x8C, 0x3E, 0xD3, 0x34, 0x72, 0x88, 0x33, 0x13, 0xB0, 0xCB, 0xF6, 0x90, 0x61, 0xD2, 0x10, 0x06, 0x60, 0xC1, 0x36, 0x0F, 0x8C, 0x3D, 0xFA, 0xDA, 0x91, 0x38, 0xF4, 0x42, 0x99, 0x21, 0x77, 0xFF, 0xF6, 0x2F, 0x99, 0xA6, 0xBD, 0xBF, 0x6A, 0xE4, 0xC7, 0xC9, 0x21, 0x81, 0xB8, 0x8E, 0x6D, 0xF7, 0xCB, 0x64, 0x99, 0x14, 0x1A, 0x62, 0x22, 0x68, 0x48, 0xC6, 0xC1, 0x6F, 0x1B, 0x66, 0x9E, 0xCA, 0xC6, 0x80, 0x1F, 0x5F, 0xCB, 0x7F, 0xB9, 0x23, 0x3D, 0xE9, 0x0D, 0xA3, 0x97, 0x35, 0x62, 0xAF, 0x8C, 0x33, 0x4C, 0x73, 0x87, 0xFC, 0x7F, 0xB6, 0xFC, 0x60, 0x0E, 0x32, 0x9C, 0xFD, 0xE3, 0x13, 0xB4, 0x5F, 0x67, 0x30, 0x05, 0x32, 0x43, 0xD7, 0xEE, 0x6D, 0x4F, 0x26, 0x22, 0x09, 0x66, 0xAB, 0x65, 0x16, 0x78, 0xBE, 0xB6, 0x65, 0xED, 0x39, 0x37, 0x7A, 0x7A, 0x6F, 0xD8, 0xF4, 0xAC, 0x64, 0x86, 0xEE, 0xDD, 0xDB, 0xFE, 0x11, 0xC4, 0xDD, 0x66, 0x3A, 0x45, 0x6D, 0x2B, 0x73, 0xD4, 0xDC, 0xD1, 0xCA, 0x7F, 0xA9, 0x74, 0x9A, 0x9A, 0x3B, 0x5B, 0x95, 0x4D, 0x3D, 0x7E, 0x76, 0x94, 0xE3, 0xCB, 0xE3, 0x45, 0x2A, 0x4D, 0x14, 0xB8, 0x7F, 0xE2, 0xEC, 0x27, 0xDC, 0x2D, 0x8C, 0x8E, 0x93, 0x5D, 0xB6, 0x94, 0xE9, 0x16, 0x32, 0x32, 0xD3, 0xD1, 0x42, 0x68, 0x53, 0x00, 0xDA, 0xD8, 0x6C, 0x4A, 0x05, 0x36, 0x07, 0xDA, 0x14, 0x6D, 0x6B, 0x95, 0xCB, 0x54, 0x1C, 0x9D, 0x08, 0x8C, 0x27, 0x02, 0x20, 0x29, 0x6C, 0xC3, 0xB9, 0x2F, 0xFF, 0xC8, 0xA1, 0x67, 0x04, 0x4E, 0x76, 0xAB, 0x98, 0x21, 0x48, 0x22, 0xA4, 0x5B, 0x32, 0xD4, 0xBD, 0x71, 0x0D, 0x67, 0x84, 0x54, 0x53, 0xA5, 0xB0, 0x32, 0xA1, 0x5A, 0xFD, 0x56, 0xA9, 0x4C, 0x60, 0x0C, 0x00, 0x5C, 0xAB, 0x58, 0x66, 0x95, 0xB3, 0xA8, 0x70, 0xFE, 0xA2, 0x4B, 0xB2, 0x70, 0xA1, 0x12, 0xEE, 0x22, 0xE6, 0x91, 0x07, 0x83, 0x07, 0x9D, 0x2A, 0xA0, 0xA5, 0x7B, 0x89, 0xF0, 0xBA, 0x9D, 0x1D, 0x36, 0xA0, 0xDC, 0xC8, 0x1A, 0x1E, 0xB4, 0xD3, 0xF8, 0xB9, 0x51, 0xC2, 0x80, 0xC3, 0x2F, 0x68, 0xB0, 0x39, 0xE5, 0xD2, 0xAE, 0xB3, 0xBF, 0x7E, 0xE3, 0x29, 0x3F, 0x49, 0x0F, 0x33, 0x60, 0xA5, 0x90, 0x4E, 0xA5, 0x0E, 0xF8, 0x23, 0xE5, 0x7A, 0x7B, 0xA8, 0x6B, 0xD3, 0x6A, 0xAA, 0x27, 0x13, 0xF8, 0xF3, 0x90, 0xFF, 0x33, 0x05, 0x88, 0x33, 0x44, 0xB9, 0x58, 0xC2, 0x6A, 0x44, 0x0E, 0xE2, 0x15, 0x2C, 0x5D, 0x9C, 0xF4, 0xE0, 0x8A, 0xEC, 0xBF, 0xA3, 0x90, 0x32, 0xE5, 0xC9, 0x12, 0x59, 0x93, 0x45, 0x4F, 0xDC, 0x5A, 0xFF, 0xA4, 0xB2, 0x19, 0x4A, 0x67, 0x9B, 0xAA, 0x92, 0x1B, 0xAC, 0xB3, 0x33, 0xED, 0x59, 0x17, 0x6F, 0x18, 0x06, 0xB5, 0x2E, 0xEF, 0x64, 0xA3, 0x3B, 0x45, 0x6C, 0x9A, 0x75, 0xF1, 0x8D, 0xF6, 0x60, 0x90, 0x8D, 0x9D, 0xCE, 0xD3, 0xD9, 0xA3, 0xC3, 0x54, 0x9E, 0xA8, 0x6E, 0x03, 0x15, 0x43, 0x78, 0x98, 0x41, 0x35, 0x3D, 0xF4, 0x5C, 0x7B, 0x19, 0x75, 0x5C, 0xBA, 0xAC, 0xD1, 0x75, 0x71, 0xF3, 0xB3, 0x2D, 0x9B, 0xCA, 0x4C, 0x0C, 0x82, 0xCB, 0xFD, 0x8C, 0xE1, 0x46, 0x9A, 0x03, 0x1E, 0x74, 0x3E, 0x06, 0x4B, 0x2A, 0x15, 0x2C, 0xD6, 0x67, 0xA3, 0x98, 0x60, 0x8A, 0x6B, 0x47, 0x97, 0xD3, 0x81, 0x37, 0x5E, 0xAC, 0xCA, 0x7E, 0xA2, 0xE4, 0xF4, 0xC9, 0x2B, 0x0E, 0x97, 0x75, 0xB1, 0x72, 0xF0, 0xEB, 0x09, 0x90, 0x08, 0xB3, 0xC9, 0x08, 0x28, 0xBD, 0x99, 0x32, 0x29, 0xD3, 0x9C, 0xA1, 0x6C, 0x5B, 0x0B, 0x35, 0xB7, 0x64, 0x79, 0x83, 0x1B, 0xA6, 0x87, 0x87, 0xAB, 0x2A, 0xD9, 0x28, 0x84, 0xC9, 0x3A, 0xBE, 0x69, 0xAA, 0x6C, 0x99, 0x6C, 0xF3, 0x9C, 0x63, 0x04, 0xB4, 0xC3, 0x67, 0x97, 0x5D, 0x41, 0xBF, 0xDF, 0xF9, 0x10, 0xFD, 0xFD, 0x87, 0x4F, 0x50, 0x47, 0xB6, 0xDD, 0xD3, 0x34, 0x2D, 0x29, 0x67, 0xBF, 0x8C, 0x70, 0x99, 0xC1, 0x4C, 0xDB, 0xBB, 0x3C, 0x01, 0x8C, 0xD3, 0x31, 0x35, 0xCC, 0x25, 0x70, 0x19, 0xA3, 0x95, 0x31, 0x46, 0x6B, 0x96, 0x77, 0x04, 0x46, 0x63, 0xA3, 0x98, 0x03, 0xF9, 0xA7, 0x33, 0x4D, 0x94, 0x69, 0x69, 0xA6, 0x96, 0x76, 0xA6, 0x40, 0x33, 0x37, 0x8D, 0xFC, 0xD9, 0xD4, 0x30, 0x17, 0xA1, 0x3D, 0x95, 0xA5, 0x87, 0x36, 0xDD, 0xC9, 0x8B, 0x76, 0xCD, 0xEA, 0x8D, 0xF4, 0x9B, 0x3B, 0x7E, 0xEA, 0x2D, 0xA6, 0x69, 0xF6, 0x41, 0x08, 0x08, 0xA4, 0xAB, 0x09, 0x32, 0xAE, 0xE0, 0x06, 0x10, 0x11, 0xD0, 0x71, 0xC9, 0xB2, 0x86, 0xE9, 0x08, 0x22, 0xCF, 0x38, 0x2E, 0xE6, 0x63, 0xFF, 0x9C, 0x6C, 0x59, 0x6C, 0x2A, 0xB1, 0x1D, 0x3E, 0x9D, 0x60, 0x7A, 0x61, 0xF6, 0x4F, 0xAA, 0xB8, 0xFA, 0x94, 0xD1, 0xB1, 0x60, 0xAE, 0x8A, 0x8B, 0x3C, 0xF0, 0xBF, 0x3A, 0x2F, 0x7D, 0x8A, 0xC9, 0xC5, 0x44, 0xDD, 0x58, 0x6D, 0x3D, 0x19, 0xC8, 0xD3, 0xD4, 0x6D, 0x3D, 0x9F, 0xA3, 0x55, 0xD9, 0x2E, 0x37, 0xFC, 0xB6, 0xCF, 0x6C, 0xA7, 0x3B, 0xAF, 0xBF, 0x95, 0x9E, 0x7E, 0xEB, 0x79, 0x17, 0x37, 0x25, 0x04, 0x5E, 0x01, 0xC2, 0x65, 0x06, 0x56, 0xEB, 0x2A, 0x66, 0x70, 0x53, 0xCC, 0x13, 0x0F, 0x6F, 0x88, 0x90, 0x29, 0x1B, 0x3A, 0x87, 0x6D, 0x83, 0x49, 0xBC, 0x20, 0x37, 0xA0, 0x37, 0x64, 0x76, 0xFE, 0xB9, 0x9D, 0xCC, 0xCB, 0x5B, 0xE9, 0x6C, 0xC1, 0xDC, 0xA8, 0x03, 0x18, 0x3E, 0x0C, 0x30, 0x7D, 0xA5, 0x33, 0x69, 0x7A, 0x6E, 0xE4, 0x9F, 0x74, 0xF7, 0xBA, 0x5B, 0x68, 0x49, 0xBA, 0xC5, 0x8D, 0xBE, 0xFB, 0xE6, 0xBB, 0x3C, 0xCC, 0x40, 0x64, 0xEC, 0x64, 0x81, 0x77, 0x21, 0x82, 0x3B, 0x4D, 0xB8, 0xB1, 0xA7, 0x3C, 0x41, 0xB6, 0x03, 0x7F, 0xBC, 0xF9, 0xF4, 0x1F, 0xA3, 0x1D, 0x1D, 0xEF, 0xFF, 0xCD, 0x76, 0x1D, 0xD0, 0xD1, 0x93, 0xCC, 0x4C, 0x38, 0x71, 0x71, 0x9C, 0xFF, 0x0A, 0x13, 0x93, 0x54, 0x64, 0x36, 0x84, 0x22, 0x5B, 0x09, 0x61, 0x45, 0x85, 0x1F, 0x33, 0x1A, 0x71, 0x29, 0x17, 0xC5, 0x08, 0xA8, 0x0B, 0xE2, 0x22, 0xFD, 0xB9, 0xF1, 0x51, 0xFA, 0xCB, 0xF0, 0x41, 0x4F, 0xF5, 0xD6, 0x2E, 0x5D, 0x45, 0x57, 0xAF, 0xBA, 0xDC, 0xC5, 0x71, 0x33, 0x38, 0xDB, 0x13, 0x01, 0x82, 0x4B, 0x06, 0x79, 0xDE, 0xE0, 0x48, 0x66, 0x53, 0x58, 0x84, 0x99, 0xB7, 0xC0, 0xCA, 0xE6, 0xA5, 0x5C, 0x4C, 0x6F, 0x6C, 0x5B, 0xCD, 0x47, 0x27, 0xDC, 0x76, 0x36, 0x4A, 0xB7, 0xE4, 0x2A, 0x9D, 0xF1, 0x8D, 0x37, 0x7F, 0x4E, 0xA7, 0x0B, 0xE7, 0xB9, 0x92, 0xAC, 0xD3, 0xC9, 0x71, 0x4B, 0x84, 0x95, 0xC4, 0xEF, 0x8E, 0x3F, 0x47, 0xFE, 0xE9, 0x62, 0xEB, 0xFA, 0x3E, 0x7A, 0xEF, 0xD4, 0x31, 0x97, 0x1C, 0x36, 0xC7, 0xF2, 0x34, 0xF8, 0x4A, 0x65, 0x9A, 0x48, 0x59, 0x39, 0xB6, 0x8D, 0xE2, 0x06, 0xCA, 0x46, 0x12, 0x17, 0x39, 0xE5, 0x71, 0x45, 0x98, 0x3F, 0x40, 0xE3, 0x7F, 0x5F, 0xC7, 0x7A, 0x7A, 0x77, 0xEC, 0xA4, 0x46, 0xCC, 0xF9, 0x13, 0xE5, 0xB2, 0x6C, 0x0F, 0x41, 0x51, 0x5B, 0xCF, 0xDC, 0x36, 0xE6, 0x5E, 0xD3, 0xB6, 0x8E, 0x56, 0x2C, 0xE9, 0xA2, 0x2B, 0x3B, 0xD7, 0x46, 0x56, 0x02, 0x22, 0xFC, 0x17, 0xFF, 0x7D, 0x9A, 0xC7, 0x83, 0x68, 0xC7, 0x88, 0xAE, 0x37, 0x40, 0xAA, 0xEC, 0x1D, 0x7C, 0x86, 0x7E, 0x75, 0x15, 0x9F, 0x09, 0x38, 0xF9, 0xCE, 0x96, 0x69, 0xC3, 0x17, 0x10, 0xD8, 0x77, 0x61, 0x4E, 0x85, 0x19, 0xFC, 0xCA, 0x63, 0x18, 0x33, 0x94, 0x8A, 0x45, 0x2E, 0xAE, 0x40, 0x24, 0x2E, 0xFC, 0x72, 0xF3, 0x77, 0x79, 0x92, 0x91, 0x62, 0x9E, 0x46, 0x4A, 0x17, 0x68, 0x70, 0xE2, 0x34, 0x8D, 0xD9, 0x05, 0xCE, 0x20, 0xC0, 0x9D, 0x61, 0xB8, 0xB9, 0x0C, 0x37, 0x2C, 0xD9, 0xC4, 0x3B, 0x7B, 0x7D, 0xCB, 0x4A, 0xEA, 0x69, 0xEA, 0xA4, 0x9E, 0x0C, 0x1B, 0x43, 0x0A, 0xC8, 0x66, 0xA6, 0x8D, 0x50, 0x8A, 0x60, 0x17, 0xB5, 0xA5, 0x73, 0x83, 0xEB, 0x87, 0x9D, 0x22, 0x09, 0x66, 0x80, 0x8E, 0xD1, 0x3F, 0x32, 0x40, 0x87, 0x57, 0x1F, 0x73, 0x25, 0x92, 0x9B, 0xE9, 0x94, 0x47, 0xEC, 0xA4, 0x56, 0x24, 0x83, 0x3F, 0x34, 0x81, 0xFF, 0xDB, 0x96, 0x5E, 0xE9, 0x52, 0x45, 0x23, 0xE2, 0x77, 0x2D, 0x1B, 0x45, 0x32, 0xB4, 0xB7, 0xB7, 0xD3, 0x89, 0xC2, 0x19, 0xBA, 0x58, 0x9E, 0xA0, 0xB7, 0x2F, 0x1C, 0xA7, 0x53, 0x93, 0xE7, 0xE8, 0x14, 0x13, 0xA3, 0x47, 0x2F, 0x0E, 0xD3, 0x45, 0xCB, 0x6B, 0x75, 0x94, 0xD3, 0x35, 0xCA, 0x7F, 0xFF, 0x25, 0x5F, 0xE7, 0x52, 0xA0, 0x5E, 0xF9, 0x41, 0xD3, 0xC7, 0xD4, 0x71, 0x74, 0xEC, 0x43, 0x6E, 0xB1, 0x2C, 0x55, 0xB6, 0x6F, 0xEA, 0x45, 0xDE, 0xA5, 0x63, 0x33, 0x85, 0xF3, 0x71, 0x26, 0x1D, 0x9E, 0xDA, 0xF2, 0x00, 0xC7, 0x6D, 0x63, 0xD3, 0xC4, 0xC3, 0x6E, 0x28, 0x5B, 0x73, 0xB1, 0xB3, 0x29, 0xF8, 0x1B, 0x9B, 0x19, 0x6A, 0xB5, 0x02, 0xDE, 0xB2, 0xFC, 0x7A, 0x29, 0x7B, 0xB5, 0x17, 0x0A, 0xDE, 0xA6, 0xF6, 0x35, 0x3C, 0x50, 0xCC, 0xAB, 0x72, 0xCC, 0xC3, 0xF9, 0x63, 0xBC, 0x52, 0x68, 0xBC, 0xD9, 0x80, 0xC1, 0xC9, 0x91, 0x2A, 0x06, 0x56, 0x95, 0x03, 0x16, 0x53, 0x5D, 0x80, 0x0E, 0x01, 0x40, 0xDD, 0x61, 0xC7, 0xA8, 0xAC, 0x1A, 0x74, 0x53, 0xEB, 0xC5, 0x83, 0xEE, 0x80, 0x36, 0xFB, 0x1B, 0x5B, 0x5D, 0x7C, 0x8D, 0x2D, 0x37, 0xFD, 0x80, 0x43, 0x4A, 0xC0, 0x05, 0xAE, 0x26, 0xFC, 0x09, 0xC4, 0xFF, 0x5A, 0x14, 0x9D, 0x9E, 0xE6, 0x1C, 0xDD, 0xD8, 0x75, 0x95, 0x20, 0xA1, 0x74, 0xD1, 0x18, 0xE9, 0xA9, 0xDD, 0x3A, 0x65, 0x04, 0x86, 0x04, 0x83, 0xDC, 0xD4, 0x7D, 0x75, 0x50, 0x70, 0xE2, 0x78, 0x5D, 0x7D, 0x87, 0x9B, 0xCF, 0x15, 0x4B, 0x58, 0x55, 0x01, 0xE5, 0xFA, 0x24, 0xB5, 0xC4, 0xE5, 0xCB, 0x51, 0x36, 0x5D, 0x3C, 0x7E, 0xFC, 0x00, 0x7D, 0xC2, 0xA4, 0xEE, 0xA5, 0x4B, 0x57, 0x7A, 0x8A, 0x22, 0x2C, 0xCF, 0x9C, 0x19, 0x58, 0x47, 0xEC, 0x90, 0x43, 0xE5, 0x9D, 0x35, 0x19, 0x5F, 0x2B, 0xD7, 0xDE, 0xAA, 0x21, 0x15, 0xA2, 0x18, 0x41, 0x2E, 0xC7, 0x6C, 0xF9, 0xA1, 0xD7, 0xE8, 0x02, 0x0C, 0x60, 0x3A, 0x20, 0x33, 0x03, 0x76, 0x38, 0x31, 0x28, 0x92, 0x00, 0xE8, 0x23, 0x98, 0x6A, 0xB1, 0xD4, 0xC4, 0xF2, 0x52, 0x05, 0xB1, 0xA6, 0x09, 0x95, 0xC1, 0x46, 0x45, 0xD4, 0x8F, 0xDB, 0xDC, 0x71, 0x99, 0x1F, 0x55, 0xF5, 0xBF, 0xA9, 0xA9, 0x7A, 0x47, 0xB0, 0x2A, 0x12, 0x43, 0x40, 0x8F, 0xA8, 0x05, 0x56, 0x84, 0x28, 0x7C, 0x82, 0x9E, 0x50, 0x68, 0xC5, 0x7F, 0xBF, 0x1B, 0x47, 0xC1, 0xD5, 0x9D, 0x4E, 0x65, 0x0B, 0x21, 0xB7, 0xAA, 0xB2, 0xA9, 0x02, 0x5B, 0xF8, 0xF5, 0x06, 0xE8, 0x0D, 0x58, 0x2F, 0x3E, 0xF1, 0xFE, 0x8B, 0x7C, 0xA9, 0xA9, 0xA2, 0xCF, 0x99, 0x41, 0x88, 0x09, 0x11, 0xA1, 0xB5, 0xBB, 0x43, 0x78, 0x3D, 0xAE, 0x6E, 0x05, 0xE5, 0x44, 0x58, 0x6E, 0x61, 0x49, 0x19, 0x05, 0xBA, 0x92, 0xA1, 0x16, 0x7D, 0xE1, 0xA1, 0xB5, 0x77, 0xD0, 0x17, 0x3B, 0xAE, 0x88, 0x2A, 0x02, 0x1F, 0x39, 0xFB, 0x4E, 0xBD, 0x48, 0x2F, 0xE7, 0xDF, 0x89, 0x8C, 0x1B, 0x15, 0x41, 0x57, 0x32, 0x80, 0x8E, 0x50, 0x22, 0xE1, 0x87, 0xE9, 0x9B, 0xA8, 0xFE, 0xCC, 0x20, 0xF7, 0x1D, 0x96, 0x9A, 0x2A, 0x88, 0xA5, 0x33, 0xD4, 0xB2, 0xF4, 0xB9, 0x75, 0xF9, 0x16, 0x55, 0xBE, 0x55, 0x38, 0xDD, 0xF9, 0x32, 0x2E, 0x33, 0xDC, 0xDE, 0xFD, 0x79, 0x2D, 0x46, 0x40, 0x81, 0x60, 0x2F, 0xF8, 0x11, 0x5B, 0x31, 0x40, 0x8A, 0xA8, 0x00, 0x92, 0x43, 0x17, 0xE2, 0x48, 0x51, 0xA1, 0x44, 0x82, 0x36, 0xF6, 0x42, 0x92, 0x00, 0x76, 0x6E, 0xD4, 0x25, 0xFB, 0xEA, 0xD9, 0xF7, 0x68, 0xC9, 0x25, 0xDD, 0xEE, 0x7F, 0x78, 0xBA, 0x1E, 0xDC, 0xFA, 0x33, 0xD3, 0x6F, 0x7D, 0x6C, 0xE9, 0xF2, 0x1A, 0x24, 0x3C, 0x29, 0x6A, 0xF8, 0xB3, 0xA1, 0x4D, 0x3D, 0x3F, 0xC9, 0xA4, 0xFC, 0x1B, 0x4E, 0x72, 0x98, 0xEC, 0xC7, 0x6A, 0x22, 0x2E, 0x40, 0x32, 0xC5, 0x85, 0x9B, 0x97, 0x6E, 0x56, 0x26, 0x81, 0x4D, 0x44, 0x57, 0x6F, 0x88, 0xC3, 0x0C, 0xB2, 0xDE, 0x20, 0x8E, 0xBC, 0x29, 0x0B, 0x50, 0x47, 0x64, 0x13, 0xDB, 0x71, 0xF5, 0x43, 0x2C, 0xC9, 0xE0, 0x4F, 0xAC, 0xF3, 0xFF, 0xF2, 0xD6, 0x68, 0x66, 0xD0, 0xD5, 0x17, 0xE2, 0x4A, 0x05, 0x9D, 0xF2, 0xA9, 0xE2, 0x7C, 0x67, 0xC5, 0x4D, 0xD4, 0x66, 0x56, 0x37, 0x16, 0xE2, 0xC2, 0x58, 0xA6, 0x03, 0x71, 0x98, 0x01, 0xD3, 0x44, 0xD2, 0xE0, 0x57, 0xFE, 0xAB, 0x98, 0xC1, 0x30, 0x7A, 0x63, 0x31, 0x83, 0x9F, 0xA0, 0x4E, 0x05, 0x2E, 0xD7, 0xA8, 0xA8, 0xAE, 0x06, 0x0D, 0x63, 0x54, 0xA3, 0x00, 0x66, 0xE5, 0x99, 0x40, 0x1C, 0x66, 0xF0, 0xE7, 0x03, 0x7B, 0x43, 0xD2, 0x90, 0x6E, 0xF5, 0xEE, 0x3F, 0xB1, 0xC9, 0x29, 0x1E, 0x33, 0xC4, 0x2D, 0xA0, 0xCE, 0x2A, 0x02, 0x34, 0x75, 0xF5, 0x05, 0xAC, 0x91, 0x1B, 0x05, 0x30, 0x39, 0xCF, 0x14, 0x74, 0x95, 0xC8, 0x8D, 0x53, 0x86, 0x36, 0x91, 0x9F, 0xEE, 0xE0, 0x10, 0xF1, 0xEB, 0xE5, 0xB2, 0xA3, 0x3B, 0x0E, 0x37, 0x45, 0x0A, 0x82, 0x61, 0xFB, 0x12, 0x22, 0x8E, 0xAE, 0xAB, 0x33, 0x45, 0x80, 0x96, 0x6E, 0xE5, 0x1B, 0x35, 0x4D, 0xA0, 0x4C, 0xD8, 0x7B, 0x50, 0xC1, 0x99, 0x18, 0xB6, 0x06, 0x5D, 0xE9, 0x20, 0x9F, 0x37, 0x40, 0x9E, 0x95, 0x15, 0x85, 0x2A, 0xF7, 0x99, 0xE1, 0xE4, 0x15, 0x85, 0x8A, 0x92, 0x69, 0x3A, 0x36, 0x37, 0x45, 0x8A, 0xC0, 0xA0, 0x73, 0xFA, 0xBA, 0x5C, 0x2E, 0xE8, 0xC0, 0xDD, 0xAC, 0xB1, 0xA4, 0x44, 0x3C, 0x5D, 0xC9, 0x80, 0xB8, 0x8D, 0x82, 0x15, 0x01, 0x9B, 0x50, 0xBA, 0x3A, 0x43, 0xDC, 0x72, 0x62, 0x25, 0x23, 0x40, 0x77, 0x70, 0x88, 0xF8, 0xBA, 0x6E, 0x14, 0x73, 0x26, 0x3A, 0x39, 0xB5, 0xA7, 0xA7, 0x2B, 0x18, 0x56, 0x60, 0xDD, 0xD5, 0x04, 0x36, 0xAC, 0x1A, 0x05, 0x41, 0x92, 0x21, 0x4E, 0xFE, 0x51, 0x8D, 0x2F, 0xD3, 0x92, 0xA7, 0x8A, 0x46, 0x9D, 0xE9, 0x94, 0xF3, 0x87, 0x3F, 0x51, 0x66, 0xD0, 0x9D, 0x26, 0xFC, 0x85, 0x0A, 0xFA, 0xDF, 0xC8, 0x9D, 0xCB, 0xA0, 0xED, 0xE9, 0xA0, 0xB2, 0xA9, 0xF0, 0x71, 0x98, 0x41, 0x4E, 0xAF, 0x3B, 0x38, 0xE4, 0x34, 0xF5, 0xF0, 0x27, 0xCA, 0x0C, 0xB2, 0x31, 0xA5, 0x1E, 0x85, 0x5D, 0x28, 0x34, 0x92, 0x9A, 0x26, 0xD8, 0x49, 0xE1, 0xD0, 0x26, 0x4C, 0x94, 0x19, 0x42, 0x73, 0x5E, 0x0C, 0x6C, 0x78, 0x0B, 0x60, 0x7F, 0x22, 0x0C, 0x16, 0x99, 0x21, 0xAC, 0x75, 0x16, 0x58, 0xD8, 0x22, 0x33, 0x2C, 0xB0, 0x0E, 0x0F, 0xAB, 0xEE, 0x22, 0x33, 0x84, 0xB5, 0xCE, 0x02, 0x0B, 0x5B, 0x64, 0x86, 0x05, 0xD6, 0xE1, 0x61, 0xD5, 0x5D, 0x64, 0x86, 0xB0, 0xD6, 0x59, 0x60, 0x61, 0x8B, 0xCC, 0xB0, 0xC0, 0x3A, 0x3C, 0xAC, 0xBA, 0x8B, 0xCC, 0x10, 0xD6, 0x3A, 0x0B, 0x2C, 0x2C, 0x51, 0x66, 0x68, 0xE4, 0x96, 0xF3, 0x02, 0xEB, 0xB7, 0x19, 0x57, 0x57, 0xDC, 0xAD, 0x25, 0x08, 0xB1, 0x4D, 0xAC, 0xFE, 0x44, 0x99, 0xE1, 0xD8, 0xF8, 0x29, 0x91, 0xD7, 0xBC, 0x73, 0x75, 0x4F, 0x34, 0x85, 0x55, 0xAC, 0x56, 0xB3, 0x72, 0x2D, 0x9B, 0x82, 0x61, 0xE5, 0xD0, 0x0D, 0xD3, 0x66, 0x06, 0x76, 0x4B, 0x81, 0x2E, 0x4D, 0x37, 0xDE, 0xC5, 0xB2, 0xDE, 0x57, 0x50, 0xBA, 0x36, 0xFC, 0xEB, 0xA4, 0xCF, 0xD1, 0xDC, 0x4C, 0x12, 0xF2, 0xD4, 0x63, 0x77, 0x32, 0x0E, 0x33, 0x78, 0x36, 0xE1, 0x22, 0xCC, 0xC6, 0x09, 0x55, 0x59, 0x7F, 0xA3, 0xAA, 0x96, 0xD3, 0x37, 0x47, 0x46, 0x07, 0xB5, 0xCA, 0x3D, 0x5B, 0x23, 0x21, 0xAC, 0x70, 0x41, 0xE7, 0x16, 0xEA, 0xB1, 0x9B, 0xA9, 0xCA, 0x57, 0xDE, 0x84, 0x8B, 0x32, 0x1B, 0xAB, 0xD2, 0xD7, 0x03, 0x57, 0x25, 0x19, 0xEC, 0x52, 0xFD, 0x8E, 0x69, 0xEB, 0x4E, 0x13, 0x51, 0x87, 0x2E, 0x44, 0x45, 0x57, 0xB1, 0x4F, 0xDC, 0x1B, 0x05, 0x41, 0x92, 0x21, 0xE8, 0x9C, 0x83, 0xAA, 0x5C, 0xBA, 0x92, 0xC1, 0x7F, 0x82, 0x4B, 0x3E, 0xC9, 0xAC, 0xA2, 0x5B, 0x0F, 0x9C, 0xB8, 0x6E, 0x51, 0xD0, 0xC2, 0x3D, 0xD4, 0xA6, 0x6D, 0xA5, 0xFA, 0x05, 0x02, 0xAE, 0x3F, 0x92, 0x1C, 0x16, 0xD7, 0x7F, 0x64, 0xF4, 0x84, 0x56, 0x12, 0x5D, 0xC9, 0x20, 0x7F, 0x70, 0xA2, 0x45, 0x78, 0x06, 0x91, 0xE2, 0x1C, 0x8B, 0x0F, 0xCA, 0x46, 0xF7, 0xD0, 0x8E, 0x67, 0x8A, 0x60, 0xC4, 0x74, 0x07, 0x47, 0x50, 0xBE, 0x41, 0x78, 0xF9, 0x18, 0xBE, 0x7F, 0xD0, 0xE3, 0x42, 0xF2, 0x2A, 0xC9, 0x10, 0x44, 0x08, 0xF8, 0x5A, 0xA6, 0x8A, 0x63, 0x1A, 0x1F, 0xC9, 0x26, 0x55, 0xF9, 0xB0, 0xBA, 0x44, 0x85, 0xE9, 0x7E, 0x57, 0x19, 0x44, 0x47, 0x57, 0x2A, 0xA8, 0xD2, 0xD7, 0x72, 0xF0, 0x58, 0x45, 0xA7, 0x0A, 0x17, 0xF1, 0xE9, 0x5E, 0x2C, 0x66, 0xA8, 0x22, 0xAE, 0x81, 0xD0, 0x99, 0x2A, 0x4A, 0xA5, 0x92, 0x06, 0x25, 0xA2, 0x46, 0x29, 0x90, 0x7F, 0x3A, 0x73, 0x90, 0xDF, 0x1B, 0xA1, 0x2A, 0x94, 0xAE, 0xCE, 0x10, 0x87, 0x19, 0x1A, 0x71, 0xB6, 0x13, 0x03, 0x39, 0x4A, 0x52, 0x99, 0x25, 0xC3, 0xF1, 0x7C, 0x4D, 0x2A, 0xEE, 0x78, 0x56, 0x35, 0x04, 0x3B, 0xAA, 0xA9, 0x46, 0x87, 0x60, 0x8F, 0x8F, 0x45, 0x2F, 0x2F, 0x75, 0x57, 0x13, 0xAA, 0xCF, 0xF4, 0x43, 0xB2, 0xE6, 0x41, 0x63, 0x35, 0xDC, 0xEB, 0xF0, 0xD2, 0xF9, 0x23, 0x81, 0x64, 0x75, 0x4F, 0x40, 0xC5, 0x61, 0x86, 0x83, 0xEC, 0x0B, 0x27, 0x01, 0xBA, 0x53, 0xA6, 0x88, 0x5F, 0xAB, 0x8B, 0xFB, 0xA6, 0xFD, 0x60, 0xCA, 0x37, 0x84, 0x22, 0x50, 0x75, 0xB5, 0xAC, 0x48, 0x54, 0xCB, 0x34, 0xF1, 0xFC, 0x47, 0x87, 0x45, 0xF2, 0x50, 0x57, 0xB7, 0x11, 0xE2, 0x7E, 0x70, 0xF2, 0xCC, 0xD9, 0x37, 0x29, 0xAC, 0x73, 0xE5, 0x42, 0x41, 0xA3, 0x7F, 0xF4, 0x83, 0x67, 0x03, 0x6F, 0x90, 0x89, 0xF3, 0x2D, 0x45, 0x1C, 0x66, 0x90, 0x8D, 0x73, 0x49, 0x4D, 0x11, 0xF2, 0xE9, 0xA9, 0xED, 0xEC, 0x5A, 0x03, 0xFF, 0xC5, 0xE3, 0x78, 0xBC, 0x84, 0x7F, 0x78, 0x8B, 0xDB, 0xC6, 0xE5, 0x37, 0x25, 0x70, 0x21, 0xB5, 0xEA, 0xB6, 0x37, 0x59, 0x01, 0x91, 0x1B, 0x31, 0xCC, 0x8F, 0x91, 0x39, 0xC0, 0x96, 0x98, 0x51, 0x1F, 0xDF, 0xE2, 0x4E, 0x83, 0x28, 0x31, 0x86, 0x7C, 0xE4, 0x8F, 0x54, 0xC3, 0xF2, 0x95, 0xC3, 0x1E, 0x1B, 0xFE, 0x2B, 0x41, 0xF4, 0x47, 0x8D, 0xEA, 0xA8, 0xAF, 0xB0, 0x65, 0x9A, 0x51, 0x7E, 0x9D, 0xBA, 0x08, 0x1A, 0xF2, 0x34, 0x91, 0x94, 0xFE, 0x24, 0x1F, 0xBF, 0xBF, 0x6F, 0xFD, 0xED, 0xF4, 0x07, 0x7A, 0x52, 0x64, 0xEF, 0xBA, 0x53, 0x5F, 0x61, 0xD3, 0x10, 0xC3, 0xF4, 0x0A, 0xAC, 0x4A, 0x84, 0x20, 0xCC, 0x60, 0xCF, 0x9C, 0xD4, 0x02, 0x58, 0x55, 0x44, 0x31, 0x03, 0xF4, 0x86, 0xE6, 0x66, 0xF5, 0x27, 0x6D, 0x72, 0x9E, 0xB5, 0xAE, 0x28, 0xF0, 0x39, 0x7D, 0x9C, 0x4F, 0xEA, 0xE5, 0x3C, 0x85, 0x3F, 0xE8, 0x93, 0x3B, 0x11, 0x2E, 0xBB, 0xF2, 0x48, 0x94, 0xF1, 0x7E, 0xBF, 0x7C, 0xC5, 0x00, 0xA6, 0xCB, 0xA0, 0x9B, 0xE0, 0xFD, 0xE9, 0xE2, 0xFE, 0x17, 0x03, 0xF9, 0xEE, 0xB5, 0x5F, 0xF5, 0x5C, 0x14, 0x2A, 0xD3, 0xE1, 0xBD, 0xCB, 0x4E, 0xC6, 0x0D, 0xC9, 0x48, 0xBF, 0xDD, 0x5A, 0x84, 0xD5, 0x32, 0x4D, 0x20, 0xED, 0xF3, 0x1F, 0xBD, 0x25, 0x48, 0x04, 0xBA, 0x71, 0xAE, 0xBE, 0x09, 0x24, 0x92, 0x70, 0x40, 0x9C, 0xAF, 0xAC, 0x74, 0x25, 0x83, 0xAC, 0x2F, 0xC0, 0xBE, 0x90, 0xA4, 0x64, 0xC0, 0xB7, 0x19, 0xDF, 0x5C, 0x73, 0x13, 0xBD, 0x7F, 0x5E, 0xAD, 0xC7, 0x55, 0x86, 0xBA, 0xE2, 0x49, 0x9F, 0xA0, 0x76, 0xAD, 0xE5, 0x4C, 0xFF, 0x48, 0x21, 0x4F, 0xAF, 0x9D, 0xFB, 0x77, 0x10, 0x49, 0x8E, 0x47, 0x23, 0xCC, 0x75, 0x86, 0xD0, 0xD5, 0x19, 0x70, 0xD7, 0x84, 0xAE, 0xCE, 0x20, 0x33, 0x43, 0x92, 0x96, 0x47, 0x94, 0xE7, 0xDE, 0x0D, 0x3B, 0xF9, 0x7D, 0x94, 0xFF, 0x3B, 0xEF, 0xBD, 0x5A, 0x40, 0x3C, 0xF3, 0x54, 0xD1, 0x19, 0xD8, 0xCB, 0x72, 0xF2, 0x04, 0x10, 0x24, 0x19, 0xD0, 0x6B, 0x10, 0x7F, 0xFE, 0xFB, 0x8A, 0x43, 0x7B, 0x79, 0x2A, 0xF0, 0x05, 0x26, 0x1D, 0xA2, 0xEE, 0x75, 0x02, 0x43, 0xF0, 0x1B, 0xDE, 0xA6, 0x6E, 0x79, 0x3B, 0xCD, 0x5C, 0x58, 0xE7, 0x30, 0xA7, 0x42, 0xC9, 0x92, 0xE7, 0x56, 0x9D, 0x3C, 0xEB, 0x1D, 0x47, 0x77, 0x59, 0xA9, 0x7B, 0xF1, 0x08, 0xCA, 0x27, 0x2B, 0x8F, 0x41, 0xD3, 0xF3, 0x4C, 0xEB, 0x81, 0xCB, 0xD6, 0xA1, 0x6B, 0xA9, 0x2E, 0xF7, 0x02, 0x6D, 0x9B, 0x0C, 0xBE, 0xA2, 0xE4, 0xCC, 0xC0, 0x9F, 0x18, 0x9C, 0xBE, 0x13, 0x74, 0xA6, 0x79, 0x2B, 0xD3, 0xBF, 0x7E, 0xFE, 0x3F, 0x2E, 0x1E, 0x3B, 0x82, 0x30, 0xF7, 0x0A, 0x85, 0x0D, 0x06, 0x1E, 0xE0, 0x66, 0x3A, 0xA7, 0xBB, 0x19, 0x24, 0xE4, 0xC1, 0xCA, 0x04, 0x17, 0x79, 0x44, 0xDD, 0x03, 0xA9, 0x9B, 0x3D, 0x18, 0x5F, 0x30, 0x38, 0xF4, 0x85, 0x5A, 0x2E, 0x4F, 0xD3, 0xC9, 0x8B, 0x4B, 0x05, 0xA6, 0x34, 0x0A, 0x78, 0xEF, 0x43, 0xEF, 0x3D, 0x17, 0xCC, 0x14, 0x3D, 0x80, 0xB0, 0x0A, 0x33, 0x88, 0x58, 0x1A, 0x6E, 0x53, 0x26, 0x53, 0x93, 0x64, 0x00, 0xE9, 0x9F, 0x9C, 0xF8, 0xE3, 0xBC, 0xBE, 0x21, 0x16, 0xCC, 0xE0, 0x07, 0xE5, 0x0D, 0xB1, 0x26, 0xBB, 0x21, 0xB6, 0x25, 0xFA, 0x86, 0xD8, 0xC3, 0xEC, 0xAE, 0x4B, 0x01, 0x49, 0x2E, 0x29, 0xBF, 0xBC, 0xB2, 0xCF, 0x73, 0x21, 0xE8, 0x85, 0xC9, 0xE9, 0x27, 0x9F, 0x90, 0x3F, 0xF6, 0x25, 0xE0, 0x2A, 0x99, 0x21, 0xCC, 0xF0, 0x54, 0xAB, 0x12, 0x89, 0xCC, 0x66, 0x6A, 0xE2, 0x05, 0x8D, 0xB9, 0x06, 0x27, 0xD8, 0xDD, 0x90, 0x00, 0x55, 0xDD, 0xA2, 0xEE, 0x8E, 0x7E, 0xE2, 0xE4, 0x0B, 0x6E, 0x75, 0x92, 0xB8, 0xD4, 0x0B, 0xC4, 0xF1, 0x3E, 0x06, 0x96, 0x92, 0x32, 0x5C, 0x98, 0xA8, 0x3C, 0x1A, 0x27, 0x70, 0xE2, 0xA1, 0x54, 0xCE, 0x0C, 0x30, 0x38, 0x2C, 0xFB, 0xF1, 0x76, 0x11, 0x16, 0x6A, 0x78, 0x72, 0x23, 0x2D, 0x7A, 0x22, 0x5B, 0x00, 0x97, 0x84, 0xE3, 0x87, 0xDB, 0x6E, 0xC3, 0x80, 0x4F, 0x11, 0xEC, 0xE9, 0xE0, 0x7A, 0x03, 0x74, 0x85, 0x1F, 0x6C, 0xB8, 0xAD, 0x6A, 0x29, 0x29, 0x5F, 0x22, 0x8E, 0x3C, 0xF1, 0x88, 0x2C, 0x5C, 0xA5, 0x64, 0x40, 0x40, 0x69, 0xBC, 0x40, 0x4D, 0xAD, 0xD1, 0xEB, 0x7E, 0xC4, 0x9D, 0x2F, 0x00, 0x05, 0x55, 0x65, 0xFA, 0xD6, 0x5D, 0x06, 0x26, 0x55, 0x4F, 0xCC, 0xE9, 0x59, 0xF6, 0xBA, 0x8E, 0x00, 0x4C, 0x19, 0x5C, 0x49, 0xE7, 0xE5, 0xAD, 0x7C, 0x12, 0x57, 0x99, 0x46, 0x18, 0x96, 0xE1, 0xA2, 0x74, 0x0B, 0xF1, 0xDE, 0x44, 0x67, 0xA6, 0x8D, 0x2F, 0x25, 0x05, 0x5D, 0xB8, 0x58, 0x56, 0x1E, 0x1A, 0xE4, 0x2A, 0x82, 0x8B, 0x16, 0x0F, 0xA0, 0x4E, 0x33, 0x03, 0x7B, 0x86, 0x58, 0x7E, 0x80, 0x64, 0xF4, 0x83, 0x8F, 0xA9, 0x7B, 0x53, 0xE5, 0xEA, 0x5E, 0x37, 0xD5, 0x1C, 0xF7, 0xC0, 0xA4, 0x8D, 0x86, 0xE2, 0x9D, 0xCE, 0x1A, 0x74, 0xBE, 0xBE, 0x44, 0x23, 0x4F, 0xC5, 0x61, 0x7A, 0xBD, 0xCB, 0x34, 0x52, 0xBF, 0xC8, 0x8C, 0xFD, 0x2D, 0x66, 0x53, 0xF0, 0x5F, 0x04, 0x22, 0xBF, 0x42, 0x83, 0x64, 0x96, 0xED, 0x1C, 0x10, 0xC9, 0xA7, 0x57, 0x94, 0x8E, 0xD9, 0x2F, 0x90, 0x70, 0xF3, 0x27, 0x46, 0x08, 0x77, 0x0E, 0xCF, 0x55, 0xC0, 0x08, 0x2F, 0xB3, 0xF2, 0x15, 0x0B, 0x45, 0xF7, 0xE1, 0x0E, 0x3C, 0xB8, 0x51, 0x62, 0xFF, 0xE5, 0xC7, 0x3A, 0xE2, 0x96, 0x5F, 0x30, 0x12, 0xE6, 0x70, 0xD0, 0xC1, 0x03, 0x20, 0x85, 0xF1, 0x49, 0xF7, 0x51, 0x90, 0x12, 0xC3, 0xE9, 0xEE, 0xA3, 0xC4, 0xCD, 0x3B, 0x6E, 0x7C, 0x30, 0x0D, 0x3A, 0x5F, 0xFE, 0xC9, 0x34, 0xFE, 0x3C, 0x7C, 0x90, 0x2F, 0xCD, 0x05, 0xEE, 0xDD, 0x0F, 0x8F, 0xD2, 0xC3, 0x2F, 0x79, 0xCD, 0xD0, 0xA6, 0x5D, 0x76, 0x99, 0xC1, 0x65, 0xBC, 0xCC, 0x17, 0xD6, 0x4D, 0x9A, 0x29, 0xDA, 0x25, 0x12, 0xF2, 0x11, 0x66, 0x39, 0xD4, 0xB6, 0x42, 0x7D, 0x9D, 0x8D, 0x88, 0xD7, 0x48, 0x17, 0x23, 0x01, 0x66, 0x6B, 0x3C, 0x73, 0x50, 0x66, 0x8F, 0xA1, 0xE2, 0x5E, 0x4A, 0x7E, 0x2A, 0xA8, 0x22, 0x49, 0x13, 0x2F, 0x8A, 0x9F, 0x51, 0x2A, 0xA2, 0x9B, 0x69, 0xE3, 0x53, 0x6F, 0x5A, 0x25, 0x5E, 0x80, 0x98, 0x19, 0x14, 0x9D, 0x32, 0x9D, 0x9C, 0x38, 0x43, 0x5F, 0x59, 0x7E, 0x1D, 0x81, 0x11, 0x76, 0xEE, 0xBB, 0x97, 0x0A, 0xE5, 0xA2, 0x4B, 0x85, 0x19, 0xB9, 0xF2, 0xE7, 0x1E, 0x39, 0xF4, 0x6D, 0x81, 0xF0, 0xEC, 0x49, 0x2F, 0xBE, 0x6B, 0x29, 0x9A, 0x25, 0xBE, 0x3B, 0x97, 0xDF, 0xB5, 0xDC, 0x3A, 0xBE, 0x96, 0x9E, 0xFD, 0xD7, 0xCB, 0x34, 0xEA, 0x5B, 0x52, 0x96, 0x2D, 0x6B, 0xA7, 0xFC, 0x14, 0xF2, 0xB4, 0xCE, 0xC0, 0xEA, 0x6F, 0x95, 0xCD, 0x3D, 0xE9, 0x0C, 0xF5, 0xCB, 0x4D, 0x31, 0xF2, 0xCE, 0x09, 0xFE, 0x8E, 0x75, 0x23, 0xF5, 0x07, 0x31, 0x05, 0x88, 0x87, 0x4D, 0xE1, 0xEA, 0xBE, 0x72, 0x5B, 0xC8, 0x8F, 0xC9, 0xC5, 0xAF, 0xAB, 0xBF, 0x39, 0xD7, 0x56, 0x45, 0x4F, 0xF5, 0xE2, 0x6D, 0x76, 0x69, 0x3B, 0x35, 0xB1, 0x17, 0x72, 0x75, 0x4D, 0xD2, 0x55, 0x44, 0xEB, 0x80, 0xC0, 0x14, 0x2F, 0x5E, 0xBC, 0x1D, 0x9C, 0x78, 0xBB, 0x8A, 0x22, 0x6B, 0xE3, 0xFD, 0x32, 0x23, 0x20, 0x82, 0x47, 0x32, 0x00, 0x11, 0xF5, 0x16, 0x76, 0x3D, 0x1F, 0x3D, 0xC5, 0x8A, 0x45, 0x3C, 0xEE, 0x0D, 0x97, 0xFF, 0x18, 0xCE, 0x61, 0xD3, 0xC1, 0x7C, 0x7E, 0xFF, 0x1A, 0xED, 0x28, 0x40, 0x3C, 0x74, 0x8E, 0x8B, 0xD3, 0xC4, 0x4D, 0x7A, 0x70, 0xF1, 0xBF, 0x5E, 0x6F, 0x60, 0x8B, 0xBC, 0x74, 0xDF, 0xC2, 0x06, 0x23, 0x9C, 0x7B, 0xF8, 0xF5, 0xBB, 0x44, 0x3A, 0xE1, 0x56, 0x31, 0x03, 0x02, 0x96, 0xED, 0xDE, 0xF6, 0xB6, 0xBC, 0xB2, 0x10, 0x91, 0xE1, 0xE2, 0x1A, 0xFC, 0xB6, 0x95, 0x39, 0x5E, 0x31, 0x54, 0x0A, 0x3F, 0xAC, 0x67, 0x55, 0x80, 0xC2, 0xC1, 0xDE, 0x8E, 0x97, 0xDC, 0x45, 0x67, 0x0B, 0x7F, 0xD8, 0x21, 0x1A, 0x15, 0xAD, 0x4F, 0x3B, 0x0E, 0x0F, 0xCF, 0xCB, 0xB7, 0xB6, 0x0A, 0x86, 0x09, 0xAB, 0xB7, 0x18, 0x48, 0x68, 0x63, 0xFF, 0x61, 0x95, 0xC0, 0x74, 0x16, 0xED, 0xFD, 0xF8, 0x91, 0x57, 0xEF, 0x57, 0x85, 0x2B, 0x99, 0x81, 0xD8, 0xD3, 0x76, 0x5D, 0x9D, 0xAB, 0xF6, 0x32, 0x31, 0xB7, 0x4B, 0x95, 0x68, 0x11, 0x37, 0xFF, 0x5A, 0x00, 0x3B, 0x93, 0x63, 0xE3, 0xCE, 0x2E, 0x61, 0x53, 0x50, 0xD5, 0x40, 0xCD, 0x0C, 0x53, 0x31, 0x73, 0xBB, 0x6F, 0xBC, 0x97, 0xAD, 0x3D, 0xF7, 0xB0, 0x83, 0x11, 0x39, 0x55, 0xE2, 0x46, 0xE2, 0xC4, 0x36, 0xAB, 0xC8, 0xD3, 0x70, 0xCC, 0x01, 0x9B, 0xAC, 0xBC, 0xF8, 0x2F, 0x5C, 0x66, 0x5D, 0x18, 0xE0, 0x1B, 0x6F, 0x02, 0x51, 0x47, 0xD7, 0x4C, 0x59, 0x3B, 0xFC, 0xE4, 0xD8, 0xE2, 0x2E, 0xE7, 0x18, 0x76, 0x9F, 0x8C, 0xF7, 0x3F, 0xD9, 0x20, 0x87, 0x35, 0xDA, 0x8F, 0x29, 0xC1, 0x2E, 0x9B, 0xFB, 0x61, 0x65, 0x8E, 0xCA, 0x3B, 0x94, 0x19, 0x78, 0x62, 0x26, 0x25, 0xBA, 0x97, 0xAC, 0xD8, 0xC9, 0x9E, 0xAE, 0xD8, 0x23, 0x1F, 0x8D, 0x8B, 0x22, 0xAC, 0x1B, 0x2E, 0x3A, 0x99, 0x2D, 0xDB, 0xFA, 0x91, 0x46, 0x7C, 0xC7, 0x01, 0x13, 0x69, 0x18, 0x17, 0xEB, 0xD2, 0x9F, 0xED, 0x78, 0xE2, 0xD6, 0x7E, 0x3C, 0x17, 0x88, 0x57, 0xE2, 0x64, 0xE6, 0x71, 0xC8, 0xE8, 0xAB, 0xE7, 0x40, 0xC3, 0x52, 0x91, 0x1D, 0x30, 0x18, 0xC0, 0x40, 0x29, 0x93, 0xD5, 0x9F, 0x1F, 0x3D, 0xDD, 0x4F, 0xFB, 0x06, 0xF5, 0x6E, 0x3E, 0x67, 0x0D, 0x15, 0xCD, 0x0C, 0x52, 0x6B, 0x66, 0xEF, 0xD9, 0xBA, 0x2E, 0xDB, 0x6A, 0xEE, 0x64, 0x0F, 0x5C, 0xF5, 0xB1, 0x84, 0xBD, 0x3A, 0x23, 0x20, 0xA8, 0xB3, 0x75, 0x38, 0x55, 0xCA, 0xFA, 0x53, 0xEF, 0x15, 0x4C, 0x23, 0x2A, 0xAA, 0x92, 0x42, 0x22, 0x4C, 0xB8, 0xD8, 0x6D, 0x14, 0x9B, 0x4C, 0xF9, 0xB1, 0xE1, 0x81, 0x38, 0x1D, 0x2F, 0x68, 0xC8, 0xEE, 0xFF, 0x01, 0x90, 0xA5, 0xBC, 0x96, 0x6F, 0x71, 0xA0, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
-
-constexpr std::size_t size = sizeof(data);
-
-}  // namespace car_green_1
@@ -1,11 +0,0 @@
-#pragma once
-
-#include <cstddef>  // for std::size_t
-
-namespace car_red_1 {
-
-constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x47, 0x08, 0x06, 0x00, 0x00, 0x00, 0x24, 0xE4, 0xF4, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0x44, 0x65, 0x58, 0x49, 0x66, 0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0xA0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x6B, 0x38, 0x00, 0x00, 0x10, 0x20, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x5D, 0x7B, 0x8C, 0x24, 0x45, 0x19, 0xFF, 0xBA, 0x67, 0x66, 0x77, 0x76, 0x6F, 0x5F, 0xB7, 0x77, 0x84, 0xE3, 0x8E, 0xC7, 0xF2, 0x32, 0x3C, 0xE5, 0x14, 0xCF, 0x88, 0x90, 0x78, 0xBC, 0x41, 0x7C, 0x9C, 0x4A, 0x62, 0x34, 0x11, 0x0F, 0x11, 0xF4, 0x0F, 0x12, 0xD4, 0x90, 0x88, 0x24, 0x44, 0xA2, 0x89, 0x68, 0xC2, 0x1F, 0x18, 0xD0, 0x3F, 0x78, 0xE8, 0x0A, 0xD1, 0xC4, 0x04, 0xF5, 0x88, 0xC8, 0x43, 0x79, 0x1C, 0x1A, 0xD1, 0x80, 0xC8, 0x22, 0x10, 0x41, 0xE0, 0x58, 0x05, 0x0E, 0x08, 0xB9, 0xBD, 0xBD, 0x7D, 0xEF, 0xCE, 0x4C, 0xB7, 0xDF, 0xAF, 0x66, 0xAB, 0xB7, 0xBA, 0xA6, 0x7A, 0xBA, 0x7A, 0xA6, 0x7B, 0x76, 0x16, 0xE6, 0xCB, 0xCE, 0x56, 0xD7, 0xBB, 0xBA, 0xEA, 0x57, 0x5F, 0x7D, 0x55, 0xD5, 0xF5, 0x95, 0x43, 0x09, 0xE9, 0xB6, 0x73, 0xFA, 0x3F, 0xED, 0xBA, 0xCE, 0x56, 0x72, 0x9C, 0xAD, 0x0E, 0xD1, 0x90, 0x47, 0x34, 0x92, 0x73, 0x9D, 0x11, 0x35, 0x99, 0x0A, 0xF9, 0x63, 0xAE, 0x47, 0x93, 0x70, 0xF3, 0x7D, 0x7F, 0x37, 0x4C, 0xCF, 0xF3, 0xC7, 0x7C, 0xC7, 0x17, 0x6E, 0x13, 0x13, 0x33, 0x63, 0xD7, 0x3C, 0x45, 0x07, 0xE0, 0xDE, 0xA1, 0x95, 0x1A, 0xF8, 0xE1, 0xA9, 0x34, 0x38, 0x3C, 0xDC, 0xB7, 0x55, 0xBA, 0xE4, 0x1C, 0x77, 0xBB, 0x7C, 0x36, 0x99, 0x3E, 0xF9, 0xE3, 0x9E, 0xEF, 0x8F, 0xC3, 0xEF, 0x8A, 0x3F, 0xCD, 0x3C, 0x66, 0x0A, 0x93, 0xC4, 0x8D, 0xDB, 0x33, 0x9E, 0x6E, 0x3F, 0xAF, 0xFF, 0xCB, 0x8E, 0xE3, 0x6C, 0x77, 0x5D, 0x77, 0x67, 0x7C, 0xE8, 0x64, 0x21, 0x42, 0xC0, 0x61, 0x10, 0x91, 0x5F, 0x05, 0x91, 0x0A, 0x9E, 0xA5, 0x4A, 0x79, 0xFC, 0xCA, 0x47, 0x16, 0xFE, 0x9B, 0x2C, 0xE5, 0xF6, 0x08, 0x7D, 0xCB, 0x59, 0xC5, 0x23, 0xBA, 0x72, 0xF9, 0x11, 0x94, 0xC6, 0x75, 0x9C, 0x11, 0x87, 0x9C, 0x11, 0x7E, 0x24, 0x72, 0x68, 0x88, 0x9F, 0xAB, 0x0D, 0xEF, 0x12, 0x77, 0x2C, 0x67, 0x48, 0xB8, 0x37, 0xF1, 0xAF, 0xE2, 0xF9, 0xE3, 0x2E, 0xD1, 0x38, 0x3A, 0x60, 0xC9, 0xA9, 0xEC, 0xFA, 0xFA, 0x83, 0xB3, 0xCF, 0x24, 0x49, 0xAE, 0x2E, 0x18, 0x6E, 0x3D, 0xB7, 0xEF, 0x63, 0xAE, 0x9B, 0x1B, 0xD5, 0x7B, 0x7E, 0x92, 0x0C, 0xB2, 0x08, 0xEB, 0x7B, 0x55, 0x6E, 0x23, 0xD3, 0x46, 0x0F, 0x61, 0x10, 0x8D, 0x4B, 0xBB, 0x34, 0x7D, 0x06, 0x96, 0x47, 0xDE, 0x98, 0xB4, 0x37, 0x63, 0x86, 0x1A, 0x52, 0x4D, 0xC8, 0xA1, 0x95, 0x06, 0x5E, 0x76, 0x77, 0x5C, 0x67, 0xBB, 0x1A, 0x64, 0xB5, 0x9E, 0x01, 0x0E, 0xC7, 0xF7, 0x47, 0xE7, 0xCB, 0x4B, 0xA3, 0x36, 0x9D, 0x29, 0x12, 0x0C, 0x77, 0x9C, 0x3F, 0xF0, 0xF3, 0x2C, 0x38, 0xC1, 0x6A, 0x55, 0xCC, 0x7B, 0x3D, 0x5F, 0xAF, 0xE2, 0x5D, 0xFF, 0xCE, 0xBE, 0xA9, 0x9B, 0xEA, 0x0D, 0xCF, 0x46, 0x30, 0xFC, 0xEC, 0xFC, 0xC1, 0x47, 0xA3, 0xD0, 0x9D, 0x67, 0x3E, 0x74, 0x70, 0xAF, 0x4B, 0x03, 0x5D, 0x0E, 0xF5, 0x77, 0xB9, 0x54, 0x60, 0xFB, 0x40, 0x37, 0xFF, 0x33, 0xD0, 0xBE, 0x79, 0x96, 0x28, 0x98, 0xE6, 0xCB, 0xBE, 0xF8, 0xE1, 0x79, 0x62, 0xA1, 0xEA, 0x36, 0xB5, 0xE4, 0x53, 0xB9, 0xFA, 0x08, 0xE7, 0x0E, 0x2D, 0xD7, 0x40, 0x3F, 0xD7, 0x2B, 0xEA, 0x14, 0x24, 0xEB, 0xB7, 0x6A, 0xAB, 0xFD, 0x2F, 0xEB, 0xB5, 0xC4, 0xF5, 0x38, 0xCD, 0xF5, 0x19, 0x47, 0xE0, 0x14, 0x7E, 0xC5, 0xFB, 0xC6, 0xE5, 0x0F, 0x4D, 0xDF, 0x63, 0x0A, 0x5B, 0x03, 0x86, 0x28, 0x8E, 0xD0, 0x93, 0x27, 0x3A, 0x66, 0x28, 0x2F, 0x80, 0x50, 0xC8, 0xD5, 0x44, 0x33, 0xA5, 0x6D, 0xE5, 0x56, 0xAA, 0xF8, 0x04, 0x60, 0x80, 0xA6, 0x97, 0x3C, 0xE2, 0x3F, 0x5A, 0xAA, 0x10, 0x1D, 0x58, 0x5C, 0x41, 0x8A, 0xF4, 0xB7, 0x4A, 0xB0, 0xCD, 0x02, 0xA1, 0xF3, 0xA0, 0xE3, 0x48, 0x1A, 0x2E, 0xAE, 0x74, 0x1C, 0xB8, 0xE7, 0xDD, 0x6A, 0xE3, 0x47, 0x75, 0x28, 0x19, 0xCF, 0xC6, 0x9C, 0xE2, 0x3A, 0x43, 0x67, 0xDB, 0xB7, 0xE0, 0x0B, 0x33, 0xAA, 0xB3, 0x55, 0x2A, 0x95, 0x9D, 0x5F, 0xFD, 0xE3, 0xF4, 0x2F, 0xF4, 0x34, 0x57, 0x4A, 0xC9, 0x3E, 0x98, 0x29, 0xE4, 0x0B, 0xB9, 0x5D, 0x7A, 0xA0, 0x23, 0x06, 0x72, 0x74, 0xEC, 0x50, 0x8E, 0xD2, 0x04, 0x81, 0x9E, 0x87, 0x6A, 0xE7, 0xB1, 0x9E, 0x80, 0xF6, 0x05, 0x06, 0x85, 0x8E, 0xF7, 0xB2, 0xE7, 0xD3, 0x6C, 0x29, 0xEC, 0x3A, 0xCB, 0x81, 0x2B, 0x2B, 0xD8, 0x09, 0x92, 0x5A, 0x60, 0xA0, 0x2D, 0x32, 0x57, 0x4A, 0x83, 0xBA, 0xF3, 0x0E, 0x15, 0x0D, 0x9D, 0x20, 0xC7, 0x6D, 0xBB, 0x4E, 0x76, 0x65, 0xCE, 0x88, 0xDB, 0x96, 0x36, 0xF6, 0xB8, 0xC4, 0x4C, 0x53, 0x3C, 0xA7, 0x91, 0x77, 0x23, 0x69, 0xA0, 0x93, 0xBD, 0x3D, 0xE7, 0xD1, 0xCB, 0x93, 0x65, 0xE6, 0xCA, 0xB5, 0x29, 0x98, 0x00, 0x11, 0x02, 0x83, 0x69, 0x78, 0x38, 0x79, 0x63, 0x9E, 0x0E, 0xED, 0xCF, 0xD5, 0xA6, 0xD6, 0x22, 0x17, 0x34, 0x32, 0xB8, 0x05, 0xC0, 0x91, 0x4E, 0xB3, 0x66, 0x53, 0x70, 0xE0, 0x01, 0x00, 0x00, 0x27, 0x68, 0x27, 0x02, 0x28, 0xDE, 0x3C, 0xF2, 0x3C, 0x7A, 0xFE, 0xB1, 0x7B, 0x6B, 0x8A, 0xB5, 0xE8, 0x95, 0xB6, 0xAA, 0x33, 0x8E, 0xA0, 0xE8, 0x98, 0x39, 0xE8, 0x72, 0x02, 0x38, 0xC2, 0x6A, 0x02, 0x01, 0xA5, 0x47, 0xCF, 0xC3, 0x10, 0x35, 0xD0, 0x45, 0xD4, 0xC7, 0xE6, 0x6A, 0xF7, 0x38, 0xB5, 0x46, 0x99, 0x59, 0x50, 0x0F, 0xF7, 0x93, 0x81, 0x02, 0x51, 0x2F, 0x97, 0xAD, 0xDD, 0x80, 0x80, 0xB2, 0xF6, 0x1E, 0x77, 0x3A, 0x6D, 0xFB, 0xF6, 0x5D, 0xF4, 0xA9, 0x9B, 0xFF, 0x4C, 0x5D, 0xEB, 0x06, 0xD4, 0xE2, 0x73, 0x79, 0xF3, 0xA3, 0xAA, 0x43, 0x00, 0x86, 0x9C, 0xB6, 0x86, 0x80, 0x17, 0xC3, 0xD0, 0xD0, 0x4E, 0x24, 0x81, 0xD1, 0xCF, 0x95, 0x8F, 0x1F, 0x1A, 0xA2, 0x95, 0xE0, 0xC0, 0x28, 0xD1, 0xCD, 0x79, 0xAE, 0xE3, 0x86, 0x1F, 0x64, 0x70, 0xAE, 0xE3, 0x32, 0x74, 0xB1, 0xDD, 0x09, 0xF1, 0xD7, 0xF6, 0xA9, 0x31, 0xA7, 0x67, 0x80, 0x06, 0xBF, 0xF4, 0x63, 0x51, 0xA0, 0xE1, 0xA3, 0x4F, 0xA6, 0x33, 0xBE, 0xF5, 0xD3, 0x50, 0xE1, 0x72, 0xBC, 0xCE, 0x01, 0x26, 0x20, 0x1D, 0x03, 0x30, 0xF8, 0x58, 0x55, 0x54, 0x68, 0x4B, 0x5F, 0xEB, 0x64, 0x04, 0x25, 0x5B, 0xEB, 0x47, 0x8C, 0xCD, 0x68, 0x08, 0x70, 0x0D, 0x00, 0x43, 0x34, 0x0E, 0x3F, 0x03, 0x20, 0x68, 0x30, 0xF4, 0x5A, 0xC3, 0x10, 0x1F, 0x9B, 0x3E, 0xDA, 0x15, 0xF1, 0xC0, 0xF6, 0x91, 0x0E, 0x7A, 0xBC, 0x4C, 0xBF, 0x8F, 0xF3, 0x29, 0x22, 0xED, 0xA0, 0xD6, 0x62, 0x93, 0xCB, 0x34, 0x00, 0x86, 0x50, 0x08, 0x89, 0xEA, 0x4F, 0xCD, 0xB0, 0xE7, 0x23, 0x9F, 0xA7, 0xDC, 0x86, 0xC3, 0x02, 0xA7, 0xC3, 0x4F, 0xBB, 0x88, 0x8E, 0x39, 0xE7, 0x0B, 0x81, 0x1D, 0x0F, 0x2A, 0x13, 0xC0, 0xBB, 0x0B, 0xFA, 0xF9, 0x85, 0x43, 0xA1, 0x21, 0xF9, 0xF4, 0xCD, 0x85, 0xC8, 0x29, 0xA3, 0x8C, 0xB3, 0xD6, 0x4C, 0x08, 0xA6, 0x3C, 0x84, 0xD6, 0x50, 0xBB, 0x34, 0xAE, 0x2C, 0x18, 0x1A, 0x19, 0xC5, 0xC4, 0x4F, 0x96, 0x57, 0x75, 0x63, 0x19, 0xBA, 0x2E, 0xA1, 0x23, 0x00, 0xC8, 0x05, 0x1E, 0x16, 0x36, 0x7E, 0xEF, 0x49, 0x72, 0x7B, 0x07, 0x83, 0xF0, 0x33, 0x6F, 0xFF, 0x8F, 0xEE, 0xBE, 0xF4, 0x94, 0xC0, 0xCE, 0x0B, 0x76, 0x93, 0x5F, 0xB9, 0xFF, 0xC0, 0x7A, 0x38, 0x44, 0x62, 0x3C, 0x8D, 0xA9, 0x4E, 0x90, 0x63, 0x9B, 0x3C, 0x80, 0x9D, 0xA3, 0xE1, 0xF5, 0xDF, 0x6A, 0x17, 0x0F, 0x0D, 0x3D, 0x5D, 0xE2, 0xE9, 0xF4, 0x52, 0xF5, 0x37, 0xC3, 0xD2, 0xFF, 0x2C, 0xFF, 0xE6, 0xF8, 0xB7, 0xC8, 0x33, 0x2A, 0xFC, 0x30, 0x29, 0x02, 0x30, 0xE2, 0x80, 0x80, 0x77, 0x41, 0x58, 0x11, 0x7F, 0x7A, 0x8A, 0xE6, 0x1E, 0xBD, 0x2D, 0xF4, 0x7A, 0x7D, 0x07, 0x1F, 0x4E, 0xC3, 0x47, 0x9D, 0x14, 0xB8, 0x61, 0x19, 0x1C, 0x7B, 0x22, 0x70, 0x60, 0x26, 0x48, 0xA4, 0x8E, 0x1B, 0xB0, 0x83, 0xF5, 0x76, 0xA8, 0xF9, 0x1A, 0x70, 0x87, 0x0F, 0x13, 0x6C, 0xBA, 0x70, 0xE8, 0x89, 0xE4, 0xF4, 0x0C, 0x52, 0x9E, 0x4D, 0x97, 0xCD, 0xAE, 0xF7, 0x7D, 0x54, 0x24, 0xFE, 0xCE, 0x75, 0xDB, 0xC8, 0x9B, 0x78, 0x4D, 0x08, 0xC9, 0x9E, 0x61, 0xFA, 0xD7, 0x6C, 0x09, 0x30, 0x0B, 0xDB, 0xFF, 0xFB, 0x1B, 0x49, 0x1F, 0x2E, 0x36, 0x9D, 0x7C, 0x06, 0x4D, 0xEC, 0x79, 0x2E, 0x48, 0xBE, 0xBA, 0x39, 0x36, 0xF3, 0x98, 0x68, 0x76, 0xC7, 0x0F, 0x6F, 0x92, 0x60, 0xE5, 0x2B, 0x8A, 0x24, 0xBB, 0x8A, 0xF2, 0xAF, 0xE7, 0x5E, 0x38, 0x7A, 0x1B, 0xF9, 0xAF, 0x3E, 0x59, 0x2F, 0xC8, 0x9A, 0xF3, 0x73, 0x36, 0x1D, 0xC7, 0xBD, 0xA7, 0x9F, 0x9C, 0x4D, 0xC7, 0x73, 0x83, 0xB3, 0x79, 0xE4, 0x87, 0x69, 0xDD, 0xF0, 0x26, 0x2A, 0x8E, 0xAC, 0xB0, 0xE2, 0xA8, 0x97, 0xEA, 0xBB, 0xE8, 0x6A, 0x9A, 0xBA, 0xEB, 0x2A, 0xE1, 0x0D, 0xD6, 0x9E, 0xD2, 0x92, 0x48, 0x28, 0x3B, 0xAC, 0xD5, 0x4C, 0xDF, 0x7D, 0x1D, 0x0D, 0x7D, 0x6D, 0x34, 0x70, 0xEF, 0xEA, 0x13, 0x8C, 0x20, 0xB0, 0x63, 0xDF, 0x85, 0x2D, 0x55, 0x30, 0x88, 0x2D, 0xE9, 0xC0, 0x2B, 0xBC, 0x62, 0xA6, 0x38, 0x8B, 0xC7, 0x79, 0x4E, 0x5C, 0x8E, 0x63, 0xBA, 0x5F, 0x9C, 0xFD, 0xA0, 0xCB, 0xEE, 0x14, 0x41, 0xFC, 0xFD, 0x6F, 0xF0, 0x48, 0xC5, 0xBF, 0x37, 0xFF, 0xCD, 0x2B, 0x4B, 0xD3, 0xE4, 0xBD, 0xFA, 0x04, 0xC1, 0x8D, 0x26, 0xF7, 0xC6, 0x25, 0xB1, 0xAA, 0xFE, 0xCE, 0xF1, 0x67, 0x93, 0x7B, 0xE4, 0x36, 0x72, 0x0E, 0xE1, 0x86, 0x1F, 0xDA, 0x42, 0xCE, 0xFA, 0x2D, 0xC6, 0xF2, 0xF8, 0xC5, 0xA2, 0xD1, 0x5D, 0x77, 0xEC, 0x3A, 0xB6, 0xCA, 0x21, 0xE0, 0x0E, 0x81, 0xB5, 0xCC, 0x75, 0x9B, 0x36, 0x41, 0xBC, 0x98, 0x19, 0x7B, 0x80, 0x7A, 0xFF, 0xF3, 0x78, 0xC0, 0x91, 0xF4, 0x3C, 0x78, 0xA8, 0x18, 0x81, 0x5B, 0xCB, 0x06, 0x84, 0xAE, 0x13, 0xCF, 0x46, 0x7E, 0x82, 0x50, 0x89, 0xA2, 0x22, 0xB9, 0x17, 0x81, 0x58, 0xD6, 0x11, 0xD4, 0xD7, 0xD7, 0x47, 0xF4, 0xF6, 0x8B, 0xE4, 0xCF, 0x4D, 0xD1, 0xD2, 0x4B, 0x8F, 0x53, 0x65, 0xDF, 0x6B, 0x54, 0x61, 0x36, 0x5A, 0x7E, 0xFD, 0x39, 0xF2, 0xE7, 0xA7, 0x96, 0x43, 0xAD, 0x9E, 0x91, 0xFF, 0xEC, 0x0F, 0xB8, 0xF7, 0x87, 0xE7, 0xEA, 0xCD, 0x94, 0x06, 0x92, 0x7E, 0x7E, 0xCB, 0x89, 0x54, 0x7E, 0xE3, 0x79, 0x01, 0x06, 0x74, 0xB4, 0x2C, 0x08, 0x9D, 0x17, 0xDC, 0x61, 0xC3, 0xB5, 0x0F, 0x8B, 0xE4, 0x31, 0x4C, 0x10, 0xFD, 0x68, 0x25, 0x2B, 0xFE, 0x36, 0x05, 0x96, 0xC4, 0x60, 0x00, 0xD2, 0x1A, 0xA1, 0xE2, 0xA9, 0x3B, 0x62, 0xA3, 0xF1, 0x37, 0x13, 0x3C, 0xAE, 0x56, 0x85, 0x1B, 0x39, 0xAE, 0xAA, 0x91, 0x96, 0x18, 0xDD, 0x78, 0x29, 0x54, 0xDE, 0x6A, 0x90, 0xFF, 0xD6, 0x0B, 0x62, 0x18, 0x88, 0xCB, 0xBB, 0x5C, 0xB6, 0x17, 0x00, 0x9C, 0x65, 0x49, 0x1F, 0xC2, 0x2D, 0xA6, 0xB4, 0x8D, 0x72, 0xDD, 0x7A, 0x65, 0xC2, 0x5E, 0x0F, 0xEA, 0x6C, 0xFE, 0xEF, 0xBF, 0x16, 0xF2, 0x83, 0x1E, 0x96, 0xB3, 0x1D, 0x82, 0x5B, 0xB4, 0x70, 0xA0, 0xC7, 0x58, 0xB6, 0xDB, 0x48, 0xB3, 0x7A, 0x54, 0x77, 0xFD, 0x66, 0xEA, 0x3E, 0xE9, 0x1C, 0xDD, 0x39, 0x64, 0x17, 0x40, 0xC8, 0xD7, 0xC7, 0x26, 0x00, 0xD2, 0x7D, 0xCA, 0x85, 0xA1, 0x78, 0xAD, 0xB4, 0xF8, 0x3C, 0x9C, 0xD9, 0x10, 0xC0, 0xE0, 0x79, 0x2C, 0xBD, 0x59, 0x50, 0xF7, 0xFB, 0x2F, 0x08, 0x42, 0x29, 0x5B, 0x1C, 0x81, 0x5B, 0x1A, 0x0F, 0xE8, 0xC0, 0x98, 0x56, 0xA3, 0x23, 0x79, 0x73, 0x07, 0x08, 0x33, 0x0A, 0x95, 0xE4, 0xCA, 0xB3, 0x00, 0x03, 0xBE, 0x62, 0x52, 0x3D, 0xD5, 0x9D, 0x35, 0xD5, 0x1D, 0xC2, 0x63, 0x23, 0x54, 0xFC, 0xD0, 0x67, 0x62, 0xA3, 0xE5, 0x63, 0x80, 0x10, 0x9B, 0x40, 0x0B, 0x02, 0x08, 0xB9, 0xC6, 0x32, 0x1F, 0xDE, 0x08, 0xB2, 0x0A, 0x59, 0x54, 0xC0, 0x0D, 0x30, 0x70, 0x2F, 0xCD, 0x84, 0x20, 0x9C, 0x62, 0xA8, 0xC5, 0x54, 0x53, 0x07, 0x83, 0xCC, 0xB0, 0x7E, 0x57, 0x94, 0xA1, 0x96, 0xCD, 0x46, 0x59, 0x58, 0xE1, 0xA8, 0xAA, 0x6C, 0xA0, 0x25, 0x17, 0xB2, 0x16, 0x0A, 0xBC, 0xBC, 0x67, 0x41, 0x90, 0x23, 0x1A, 0xA2, 0xA1, 0xCD, 0x91, 0x02, 0x9F, 0x4C, 0xCF, 0x7F, 0xF3, 0x05, 0x21, 0xD0, 0x4A, 0xBB, 0x6E, 0x42, 0xE8, 0xB5, 0x25, 0xFE, 0xF4, 0xCC, 0x2A, 0xA8, 0xBA, 0x42, 0x88, 0x55, 0x55, 0xAC, 0x81, 0x60, 0x53, 0x2E, 0x6D, 0x42, 0xDB, 0xA1, 0x86, 0x67, 0xEF, 0xAB, 0x4E, 0x35, 0x4D, 0xE9, 0x0B, 0x30, 0x48, 0x36, 0x21, 0x03, 0x6C, 0xE0, 0x2D, 0x58, 0x13, 0x35, 0x52, 0x46, 0xA7, 0xD8, 0x4F, 0x5D, 0x47, 0xC7, 0x83, 0xC1, 0x96, 0x33, 0x40, 0x98, 0x4C, 0x4A, 0xF9, 0x2F, 0xDE, 0x4C, 0xEE, 0x09, 0xF5, 0x87, 0x29, 0xA4, 0x89, 0x9E, 0x53, 0xB9, 0xEF, 0x06, 0xF2, 0x9E, 0xDE, 0x95, 0x34, 0x8B, 0x9A, 0xF0, 0xB6, 0x9C, 0x01, 0x11, 0xA5, 0x10, 0x89, 0x67, 0x00, 0x22, 0x0B, 0x52, 0xB1, 0x89, 0xE1, 0xC2, 0x44, 0xE6, 0x56, 0x37, 0x85, 0x64, 0xB7, 0xA8, 0x8F, 0x25, 0x22, 0x82, 0x0B, 0x67, 0x9B, 0x21, 0x02, 0x01, 0x73, 0x39, 0x39, 0xA7, 0xA8, 0x97, 0x5A, 0x55, 0x10, 0xAA, 0x1F, 0x22, 0xEC, 0xEB, 0x9E, 0x76, 0x89, 0x15, 0x10, 0x10, 0x0B, 0x33, 0x85, 0xFC, 0xE7, 0x6E, 0x60, 0x71, 0x6A, 0x73, 0x38, 0x91, 0x65, 0x9B, 0xE0, 0x1C, 0x46, 0x9F, 0x5A, 0x47, 0x5B, 0x99, 0x01, 0x31, 0xA5, 0x10, 0x89, 0xE7, 0x46, 0xF6, 0x53, 0x10, 0x2F, 0x8E, 0x54, 0xAE, 0xBE, 0xF8, 0xAF, 0x07, 0x68, 0x4B, 0x5F, 0xB8, 0xE9, 0xEF, 0x38, 0x6F, 0xE0, 0xBB, 0xAE, 0xBE, 0xFA, 0x38, 0x5C, 0x4C, 0x17, 0x9A, 0xF9, 0xCD, 0xBC, 0x28, 0x13, 0x43, 0xFC, 0xAD, 0x65, 0x4C, 0x88, 0xAA, 0x37, 0x66, 0x13, 0x49, 0x09, 0x0B, 0x41, 0x49, 0x29, 0xF7, 0xC1, 0x08, 0x19, 0x87, 0xD7, 0x44, 0x6C, 0xE5, 0x86, 0x24, 0x60, 0x68, 0x85, 0x10, 0xA9, 0xD7, 0x41, 0x0F, 0x56, 0xB9, 0x34, 0xB2, 0x6B, 0x05, 0x2D, 0x52, 0x12, 0xAB, 0x0D, 0x18, 0x6C, 0xE5, 0x85, 0x52, 0x03, 0x43, 0x44, 0x92, 0xB2, 0xCA, 0xB0, 0xB9, 0xB3, 0xAE, 0xE4, 0xED, 0x49, 0x33, 0x88, 0x6C, 0xE5, 0x86, 0x24, 0x60, 0x28, 0x2C, 0x4F, 0xA7, 0x65, 0xFE, 0x59, 0x98, 0x2A, 0x67, 0x40, 0xFA, 0x35, 0x60, 0x70, 0x68, 0x24, 0x11, 0x18, 0xF4, 0x04, 0x6D, 0x0A, 0x9D, 0xDF, 0x7C, 0x7C, 0x6C, 0x30, 0x4C, 0x2B, 0x6D, 0xA8, 0x95, 0x0B, 0x4F, 0x58, 0x56, 0x6E, 0x86, 0x92, 0x80, 0x41, 0xCF, 0x27, 0xAB, 0xA1, 0x42, 0xCD, 0x47, 0x07, 0x03, 0x56, 0x21, 0x13, 0x81, 0x41, 0x4D, 0xCC, 0xE6, 0xB9, 0x70, 0xD4, 0x36, 0x9B, 0x60, 0xD6, 0xF2, 0x82, 0x3F, 0x7F, 0xC0, 0x2A, 0xBD, 0x34, 0x02, 0xB9, 0x87, 0xC4, 0x0F, 0x6F, 0x71, 0xF9, 0xD8, 0x0A, 0x91, 0xD8, 0xC0, 0x52, 0x29, 0x2B, 0x21, 0x52, 0xCD, 0xC3, 0xF4, 0xCC, 0xA3, 0xB5, 0x2B, 0x96, 0x22, 0xA5, 0x67, 0xBD, 0x4D, 0x2A, 0x19, 0xC6, 0xD6, 0xB4, 0xE1, 0x0A, 0x48, 0xCB, 0x96, 0x33, 0x94, 0x5E, 0x6F, 0xE1, 0xCA, 0x23, 0xEF, 0x3D, 0x98, 0xC8, 0x56, 0x66, 0x40, 0x5C, 0x5B, 0xEE, 0xA0, 0x7E, 0x6F, 0x80, 0x78, 0x59, 0x81, 0x41, 0x9D, 0x51, 0x20, 0x1F, 0x9D, 0x78, 0xC3, 0xAA, 0xBA, 0x14, 0x29, 0x3D, 0xA2, 0x56, 0xC1, 0x1A, 0x99, 0x49, 0xA4, 0xCD, 0x19, 0x64, 0x19, 0x5B, 0x61, 0x46, 0x6D, 0x42, 0x51, 0x82, 0xB5, 0x86, 0x24, 0xE5, 0x54, 0xF7, 0x3C, 0xB2, 0x62, 0xD7, 0x71, 0xC3, 0x7C, 0x56, 0xF9, 0x8A, 0x7A, 0x50, 0x5F, 0xB0, 0x5E, 0xC5, 0xD8, 0xCE, 0x26, 0x1A, 0x59, 0x63, 0xA8, 0x97, 0x6F, 0x3D, 0x3F, 0xEC, 0x4A, 0x36, 0x4B, 0xB6, 0x9C, 0x01, 0xF9, 0xC8, 0x3D, 0x19, 0x3C, 0x67, 0xC5, 0x19, 0x90, 0x76, 0x3D, 0xCA, 0x14, 0x0C, 0x36, 0x33, 0x89, 0x7A, 0x85, 0xD3, 0xFD, 0x5A, 0x2A, 0x40, 0x46, 0x6C, 0x4F, 0xEB, 0x65, 0xAA, 0x67, 0x4F, 0x02, 0x06, 0x35, 0x9D, 0x56, 0x08, 0x90, 0x6A, 0x7E, 0xF2, 0x39, 0x53, 0x30, 0xB8, 0x29, 0x6E, 0xF7, 0xCA, 0x02, 0xBF, 0x17, 0x4C, 0xCB, 0xC9, 0x55, 0xE2, 0xAA, 0x88, 0x5B, 0x20, 0xCF, 0x14, 0x0C, 0x89, 0x4B, 0xDB, 0x89, 0x90, 0x69, 0x0D, 0xAC, 0xAA, 0xCC, 0x90, 0xE9, 0x9B, 0x75, 0x12, 0x4F, 0xBD, 0x06, 0x3A, 0x9C, 0x21, 0xF5, 0x2A, 0x5D, 0xBB, 0x09, 0x76, 0xC0, 0xB0, 0x76, 0xDB, 0x2E, 0xF5, 0x92, 0x77, 0xC0, 0x90, 0x7A, 0x95, 0xAE, 0xDD, 0x04, 0x3B, 0x60, 0x58, 0xBB, 0x6D, 0x97, 0x7A, 0xC9, 0x3B, 0x60, 0x48, 0xBD, 0x4A, 0xD7, 0x6E, 0x82, 0x1D, 0x30, 0xAC, 0xDD, 0xB6, 0x4B, 0xBD, 0xE4, 0x99, 0x82, 0xC1, 0x6B, 0x83, 0xB3, 0x0E, 0xA9, 0xD7, 0xD8, 0xBB, 0x24, 0x41, 0xA9, 0x5B, 0x4B, 0xBE, 0x0E, 0xD4, 0x05, 0x66, 0x0A, 0x86, 0xF2, 0x5E, 0xFE, 0xC0, 0x74, 0x8D, 0x52, 0x92, 0xDD, 0xC9, 0xA8, 0x57, 0xB4, 0xDD, 0x73, 0xD1, 0xE3, 0x37, 0xB2, 0x29, 0xA8, 0xA7, 0xD1, 0x88, 0xDD, 0x1A, 0x0C, 0x76, 0x9F, 0x9F, 0x84, 0x8B, 0x60, 0xBB, 0x97, 0x60, 0xBB, 0x86, 0x5F, 0x50, 0x8E, 0xA3, 0x85, 0x73, 0x4A, 0xDF, 0x66, 0xFB, 0x45, 0x53, 0xBD, 0x9C, 0x93, 0x80, 0x41, 0xDD, 0x84, 0x8B, 0x5B, 0x36, 0xAE, 0x97, 0x67, 0x33, 0x7E, 0xD6, 0x60, 0x80, 0xD6, 0x94, 0xA4, 0x54, 0xDA, 0x63, 0x77, 0xC8, 0xD6, 0xF6, 0x23, 0x90, 0xA4, 0xF9, 0x37, 0x13, 0x3E, 0x92, 0x33, 0xA4, 0xB0, 0x9B, 0x69, 0x2A, 0x97, 0xDA, 0x71, 0xE2, 0x96, 0x8D, 0x4D, 0xF1, 0xD3, 0x70, 0xAB, 0x69, 0xE2, 0x34, 0xBF, 0xD9, 0x2F, 0xEF, 0xE5, 0x83, 0xB5, 0x16, 0x64, 0x7D, 0xC6, 0x80, 0x8F, 0xB8, 0xB7, 0x8C, 0x22, 0xBE, 0x5B, 0x88, 0xFC, 0xCE, 0xC1, 0x50, 0x30, 0x5B, 0xCE, 0x80, 0x53, 0x4E, 0x2A, 0x35, 0x72, 0x6A, 0x4D, 0x8D, 0x6F, 0xF3, 0xAC, 0xAB, 0x53, 0x84, 0x96, 0x5D, 0xB7, 0xE2, 0x7B, 0xBB, 0xD5, 0xC8, 0xD0, 0xC5, 0x98, 0x16, 0xA5, 0xCD, 0x19, 0xD4, 0x03, 0x27, 0x69, 0x95, 0x31, 0x2A, 0x1D, 0x0F, 0x07, 0x6A, 0x9A, 0x24, 0xEB, 0xCF, 0xFF, 0xB5, 0x2F, 0xB8, 0xB2, 0x02, 0x83, 0xBA, 0x35, 0x0E, 0x15, 0x8A, 0x2A, 0x41, 0x21, 0x79, 0x0D, 0x67, 0x50, 0x03, 0xE8, 0xCF, 0x6A, 0x62, 0xBA, 0x5F, 0x94, 0xDD, 0x86, 0x3B, 0xD8, 0x72, 0x86, 0xA8, 0x3C, 0xB2, 0x70, 0xB7, 0x3D, 0x57, 0x19, 0x95, 0xB7, 0x2D, 0x57, 0x30, 0xC5, 0xCF, 0x6A, 0x98, 0x88, 0x93, 0xFB, 0x12, 0x81, 0xC1, 0x54, 0xF0, 0x38, 0x37, 0x9B, 0x19, 0x45, 0xA9, 0x54, 0x8A, 0x4B, 0x46, 0xF8, 0xAB, 0xFA, 0x0C, 0xAC, 0x22, 0x34, 0x18, 0xA8, 0xF2, 0xC8, 0x2D, 0x91, 0xC7, 0xEC, 0x6C, 0xBF, 0x80, 0x4A, 0x02, 0x86, 0x56, 0x1C, 0x01, 0x40, 0x47, 0x8E, 0xD3, 0x5D, 0xE5, 0x7A, 0x6E, 0xF5, 0x0E, 0x08, 0x59, 0x6F, 0xD0, 0x47, 0x1C, 0x45, 0x71, 0xC8, 0x32, 0xC5, 0xB3, 0x01, 0x83, 0xED, 0x6C, 0xC2, 0x74, 0x4C, 0xDF, 0x94, 0xA7, 0xEA, 0xE6, 0xCF, 0x4F, 0xAB, 0x56, 0xAB, 0xE7, 0xCA, 0x3F, 0x7F, 0x17, 0x19, 0xCE, 0x56, 0x66, 0x48, 0x02, 0x06, 0x9C, 0x70, 0x92, 0xD4, 0xAA, 0x69, 0xA5, 0x49, 0x36, 0x74, 0x55, 0x0D, 0xA1, 0x28, 0x90, 0x49, 0xB5, 0xAC, 0x2C, 0x68, 0x23, 0x33, 0x8A, 0x85, 0x7F, 0x44, 0x57, 0xAC, 0x4C, 0x17, 0xA6, 0xED, 0x8C, 0x02, 0xE7, 0x12, 0x93, 0x90, 0xF7, 0xB7, 0x3B, 0xA9, 0x5E, 0xE3, 0xAA, 0x69, 0x41, 0xA2, 0x2F, 0xFF, 0xE6, 0x3B, 0x91, 0x1A, 0x64, 0x1C, 0xD6, 0xDA, 0x62, 0x4B, 0x49, 0xC0, 0xE0, 0x2B, 0x02, 0x64, 0x9D, 0xBE, 0x68, 0x9B, 0xB5, 0x31, 0x9C, 0xFA, 0x5D, 0x25, 0x4E, 0x70, 0xE9, 0x8A, 0xC7, 0x71, 0x79, 0x89, 0x38, 0x78, 0x0B, 0x6D, 0xE3, 0xEA, 0x9D, 0x12, 0x50, 0x48, 0x6D, 0xD2, 0xF6, 0xD6, 0x88, 0xCC, 0xE0, 0xF3, 0x91, 0xB4, 0xA5, 0x57, 0x9E, 0x88, 0x3D, 0x7C, 0x0B, 0x9D, 0x06, 0x36, 0x02, 0x17, 0x3E, 0x1C, 0x4D, 0xAA, 0xAC, 0xA3, 0xF2, 0xDB, 0x6B, 0x09, 0xAC, 0x3F, 0xAE, 0x57, 0xC7, 0x9D, 0xC2, 0x36, 0xD6, 0x72, 0x84, 0xA3, 0xCD, 0xBB, 0xC8, 0xA8, 0xEA, 0xFB, 0xC4, 0x7D, 0xCE, 0x2E, 0xE3, 0x24, 0x35, 0x55, 0x30, 0xF4, 0x5F, 0xFC, 0x7D, 0xA2, 0x7B, 0xEE, 0xA9, 0x49, 0x42, 0x80, 0x81, 0x05, 0x87, 0x71, 0xF6, 0x19, 0x91, 0xBE, 0x26, 0x16, 0x02, 0xBF, 0x46, 0x05, 0x8C, 0xD2, 0x9E, 0x78, 0x30, 0x40, 0x6E, 0xE8, 0xEE, 0xEE, 0x96, 0x45, 0x88, 0x34, 0x1B, 0x9E, 0x51, 0xB0, 0xBE, 0x28, 0xBF, 0x59, 0x9D, 0x51, 0x45, 0x7B, 0x15, 0x3E, 0xB6, 0x67, 0x41, 0x54, 0x15, 0x03, 0x10, 0xF0, 0xA3, 0xEA, 0x3E, 0xB2, 0x42, 0x2C, 0x3D, 0x64, 0x47, 0x5E, 0xF7, 0xF1, 0xAB, 0x43, 0x8A, 0x42, 0xD5, 0xE8, 0xA2, 0x7D, 0xC5, 0x4D, 0x2E, 0x8A, 0xAB, 0xBE, 0x6E, 0x2D, 0xBD, 0x1A, 0x19, 0x26, 0x10, 0xD7, 0x66, 0xA8, 0x48, 0xA2, 0xFA, 0x46, 0x96, 0xA7, 0xD5, 0x66, 0x92, 0x53, 0x56, 0xB6, 0x9C, 0x61, 0xE1, 0x99, 0xFB, 0x83, 0xD7, 0xC0, 0x2C, 0x22, 0x5A, 0x62, 0x0B, 0x82, 0x35, 0xF4, 0x00, 0x30, 0xE0, 0xE8, 0x42, 0xEF, 0x99, 0x97, 0x13, 0x14, 0x83, 0x9A, 0xA8, 0xDA, 0xD9, 0x0D, 0x57, 0xFA, 0x98, 0x02, 0xC3, 0x4D, 0x65, 0x37, 0x51, 0x61, 0x74, 0x77, 0x6F, 0xFF, 0x5E, 0x5A, 0x7C, 0xEE, 0x21, 0xDD, 0x39, 0x64, 0xC7, 0xF4, 0xB2, 0xDD, 0x01, 0x61, 0x7B, 0xFE, 0x12, 0xBA, 0x26, 0x6C, 0x65, 0x06, 0x55, 0x78, 0xCC, 0x6A, 0x4A, 0x89, 0x8A, 0x46, 0xBB, 0x61, 0x78, 0xC0, 0xE9, 0x2D, 0x1D, 0x0C, 0xF2, 0x9A, 0x27, 0x31, 0x4C, 0xE0, 0x72, 0x30, 0x57, 0x51, 0x8F, 0x10, 0xC5, 0x19, 0x90, 0x68, 0x23, 0x33, 0x0A, 0xC4, 0x5B, 0x78, 0x6A, 0x57, 0xAC, 0x5E, 0x27, 0x00, 0x42, 0x68, 0x78, 0x5B, 0xD6, 0xF2, 0x86, 0x67, 0x9C, 0xAF, 0xC4, 0xB1, 0x3A, 0x08, 0x59, 0xEA, 0xD8, 0x8A, 0x34, 0x5B, 0x4D, 0xB6, 0xD3, 0x4A, 0x5B, 0xC5, 0x23, 0x28, 0xBF, 0x2A, 0x3C, 0x66, 0x35, 0x44, 0x40, 0xAD, 0x27, 0x04, 0x6F, 0x28, 0x07, 0x35, 0x11, 0x73, 0xA3, 0x49, 0xB8, 0x0B, 0x30, 0xC8, 0x2B, 0x06, 0x4D, 0x01, 0xD3, 0x72, 0x5B, 0x7A, 0xFE, 0xE1, 0x20, 0x29, 0xAC, 0xFB, 0x9B, 0xF4, 0x40, 0x4E, 0x34, 0x3B, 0xA6, 0x07, 0x39, 0x64, 0xF3, 0x50, 0x79, 0xFC, 0x4E, 0x16, 0x42, 0x59, 0x1D, 0x50, 0x8C, 0x1E, 0x48, 0xDB, 0xDC, 0x01, 0x76, 0x09, 0x70, 0xC8, 0x0B, 0xDA, 0xA2, 0xA0, 0x6D, 0x32, 0xB1, 0xE1, 0x30, 0x44, 0x08, 0xA1, 0x71, 0x39, 0xE4, 0xC4, 0x9E, 0x67, 0xC3, 0x71, 0x7C, 0xBE, 0x35, 0x90, 0x49, 0x80, 0x21, 0xEC, 0x53, 0xDF, 0x06, 0xAD, 0xED, 0x8D, 0x8E, 0x6B, 0xA5, 0x3B, 0x2E, 0x59, 0xD3, 0x1A, 0x62, 0x31, 0x4D, 0xD5, 0xC9, 0xA4, 0x21, 0xD6, 0x61, 0x0D, 0xB1, 0x64, 0xA1, 0x21, 0x16, 0xBA, 0x2E, 0x25, 0x65, 0xB5, 0xBE, 0x00, 0x4E, 0xDE, 0xFF, 0x81, 0x0B, 0x42, 0x0A, 0x41, 0x97, 0x66, 0xC3, 0x7B, 0x21, 0x52, 0x66, 0x34, 0x82, 0xA1, 0xDE, 0xC2, 0x53, 0xA3, 0x42, 0x24, 0x5E, 0xFA, 0xDD, 0xA6, 0x2A, 0x58, 0xBC, 0x13, 0xEB, 0x86, 0x0C, 0xBF, 0xDB, 0x4F, 0xC4, 0xED, 0xAD, 0xA8, 0xEE, 0x38, 0xDD, 0xD1, 0x33, 0x7F, 0xB8, 0x51, 0xC4, 0xC5, 0xBF, 0xAC, 0x86, 0x08, 0x5C, 0x89, 0xA0, 0x72, 0x05, 0xE4, 0xB5, 0x34, 0x13, 0x06, 0x83, 0xBC, 0x28, 0x55, 0x80, 0x01, 0x0B, 0x0E, 0x7C, 0xC5, 0x00, 0xC2, 0x09, 0xAA, 0xB7, 0xF0, 0x24, 0xC3, 0x74, 0xCC, 0xF8, 0x1A, 0x80, 0x92, 0x70, 0xFC, 0x4A, 0x0A, 0x07, 0x30, 0xC5, 0x12, 0x43, 0x84, 0xC9, 0xA3, 0x49, 0x37, 0xC8, 0x0A, 0xEB, 0x3F, 0x59, 0x3B, 0x95, 0xD4, 0x87, 0x09, 0x5C, 0x22, 0x8B, 0xAC, 0x8C, 0x9C, 0x01, 0x1E, 0x73, 0x7C, 0x29, 0x58, 0x6F, 0xA1, 0x51, 0x71, 0x11, 0x29, 0xB4, 0x1F, 0x61, 0x41, 0xC7, 0x24, 0xB1, 0xC7, 0xAD, 0xD9, 0x67, 0xFD, 0x26, 0x42, 0xD2, 0x57, 0x34, 0x1F, 0x4A, 0x65, 0xED, 0x18, 0x8E, 0x65, 0x79, 0x55, 0xB7, 0x38, 0xD9, 0x42, 0xBD, 0x6F, 0x02, 0x53, 0x49, 0x95, 0x30, 0x93, 0x78, 0xEB, 0xD9, 0xBF, 0xAA, 0x4E, 0x24, 0x2F, 0x40, 0x0D, 0xC0, 0x80, 0x6B, 0x88, 0x71, 0x4D, 0x8D, 0x0C, 0xF5, 0xC6, 0x4C, 0x85, 0x8E, 0x5D, 0x1F, 0x78, 0x4B, 0xE7, 0xB6, 0x36, 0x31, 0xEE, 0xCA, 0x5E, 0x26, 0x2B, 0x4F, 0x56, 0xA6, 0x6D, 0xC1, 0x01, 0x7F, 0x34, 0x8E, 0xFC, 0x41, 0xF8, 0xC2, 0x0F, 0xF6, 0x56, 0x91, 0x3A, 0x14, 0x07, 0x18, 0x51, 0x66, 0x7B, 0xB2, 0x1C, 0xF2, 0x1D, 0xA5, 0x1D, 0xA6, 0x0A, 0xEC, 0xDE, 0x33, 0xAF, 0x08, 0x5D, 0x3C, 0x02, 0xFF, 0x97, 0x1F, 0xFA, 0x15, 0x8C, 0x80, 0x78, 0x26, 0xB9, 0x4B, 0x5A, 0xAA, 0xEB, 0x0C, 0x6C, 0x73, 0xB4, 0x2B, 0x85, 0xC7, 0xA7, 0x2A, 0x84, 0x9B, 0xCF, 0xDA, 0x95, 0xD0, 0xE8, 0xD0, 0x89, 0x8C, 0x21, 0x4D, 0x5E, 0xDC, 0x81, 0x0B, 0x37, 0xA0, 0x8C, 0x5B, 0xBD, 0xAC, 0x23, 0x69, 0xF9, 0x65, 0x6F, 0xC4, 0x18, 0x8E, 0x74, 0x70, 0x01, 0x88, 0x4C, 0x7F, 0x86, 0x37, 0x57, 0xA1, 0xB2, 0x3F, 0x2B, 0x61, 0x2F, 0x69, 0x59, 0x01, 0x1A, 0x34, 0xBE, 0xFA, 0x53, 0xD3, 0x98, 0x7B, 0xF4, 0x56, 0xA1, 0x1E, 0x58, 0xBA, 0x4D, 0xBC, 0xF2, 0x2C, 0x8D, 0xFD, 0x52, 0x51, 0x20, 0xCE, 0x1E, 0xBE, 0xEF, 0xD5, 0x82, 0xA1, 0xE2, 0xAD, 0x38, 0x22, 0x32, 0x5E, 0xF8, 0xA5, 0x49, 0x7E, 0xF3, 0x36, 0x22, 0xF4, 0x04, 0xD9, 0xF8, 0x68, 0x20, 0x34, 0x3C, 0xBE, 0xC5, 0x89, 0x63, 0x9B, 0x69, 0xBD, 0x02, 0xFA, 0x06, 0x00, 0x02, 0xD0, 0xE1, 0xD6, 0x98, 0x59, 0x2E, 0x03, 0x00, 0x99, 0xD5, 0x7E, 0x42, 0xB3, 0xE5, 0xC6, 0xC6, 0x9B, 0xBC, 0xCF, 0x02, 0x40, 0x78, 0xE0, 0x9A, 0x4F, 0x84, 0x92, 0xC4, 0x95, 0x44, 0xEA, 0x65, 0xA7, 0x21, 0xE6, 0xD7, 0xB9, 0xD7, 0x32, 0x54, 0x57, 0x89, 0x2C, 0x50, 0x7F, 0x24, 0x16, 0x77, 0x02, 0x5E, 0x9B, 0x28, 0x7A, 0x66, 0x81, 0xC5, 0x65, 0xA7, 0x27, 0x5C, 0x4C, 0x2F, 0xFE, 0xE5, 0x5E, 0x5A, 0x9A, 0x0D, 0x5F, 0xD3, 0x50, 0x2E, 0x55, 0x76, 0xA8, 0x57, 0x21, 0x87, 0xC0, 0x00, 0x05, 0xA1, 0x85, 0x7C, 0x7E, 0xB7, 0x5E, 0xB2, 0x63, 0xF8, 0x4A, 0xC3, 0x56, 0xCA, 0x0F, 0xE8, 0xE9, 0xE8, 0x81, 0x60, 0xD5, 0x60, 0xDB, 0x49, 0x6E, 0xB9, 0x55, 0xAF, 0x4D, 0xD6, 0xDF, 0xA3, 0x59, 0xFB, 0xA0, 0xE1, 0xCE, 0x6F, 0xB0, 0x6A, 0xFD, 0xC6, 0xDB, 0xA1, 0x6E, 0x87, 0x6F, 0xBD, 0x73, 0x5A, 0x2A, 0x67, 0xE8, 0xEF, 0x16, 0x77, 0xE3, 0x2D, 0x7F, 0x43, 0x32, 0x7A, 0xD9, 0x83, 0x53, 0x97, 0xAA, 0xF1, 0x42, 0x60, 0x80, 0x47, 0xDC, 0x5D, 0xD8, 0x69, 0x5E, 0x7A, 0x8A, 0x19, 0x8B, 0xBC, 0xDC, 0x5B, 0x9A, 0x70, 0x03, 0x3B, 0xD6, 0x3F, 0xD8, 0x54, 0x0B, 0xBD, 0x96, 0x9E, 0xE5, 0x45, 0xE7, 0xB8, 0xF3, 0x5A, 0xDE, 0x89, 0x9D, 0xF6, 0x1D, 0xD8, 0xB2, 0x3E, 0x6C, 0xEF, 0xC2, 0x36, 0x01, 0x01, 0x69, 0xD4, 0x80, 0x01, 0x8E, 0xB7, 0x5F, 0x38, 0xF8, 0xB4, 0x3A, 0xB3, 0x80, 0x9B, 0x24, 0x08, 0x2B, 0x07, 0xF7, 0xBA, 0xE2, 0xC5, 0xA0, 0x26, 0x10, 0x2F, 0x16, 0x75, 0x47, 0x36, 0x0A, 0x87, 0xDE, 0x2D, 0x1B, 0x3A, 0x6C, 0xCA, 0x14, 0x3B, 0x26, 0x6A, 0x00, 0x97, 0xC4, 0xA9, 0x8A, 0x3A, 0x51, 0xB7, 0x51, 0x9A, 0xF7, 0x64, 0x8D, 0xC9, 0xFA, 0x44, 0x1D, 0xEB, 0x1F, 0xAB, 0xC8, 0x30, 0xBA, 0xC9, 0x40, 0xB8, 0x89, 0x39, 0xC2, 0x37, 0x75, 0x77, 0xD8, 0x8D, 0x60, 0xC0, 0xD5, 0x76, 0x07, 0x6D, 0x1C, 0xB8, 0x89, 0x77, 0xDE, 0x76, 0x9A, 0x22, 0x75, 0xDC, 0xD6, 0x5E, 0x0D, 0x60, 0x67, 0x72, 0xAE, 0xB4, 0xB8, 0x53, 0xAE, 0x29, 0x98, 0xDE, 0xC0, 0x08, 0x06, 0x19, 0xF0, 0xF6, 0x73, 0x07, 0xAE, 0x72, 0xF3, 0xCE, 0xF5, 0xB8, 0xFB, 0x50, 0xBA, 0xAD, 0x96, 0x29, 0xB7, 0x59, 0x65, 0xFE, 0x2C, 0x09, 0x8F, 0xB1, 0x40, 0x31, 0x29, 0xED, 0xD2, 0xC4, 0x0E, 0x6C, 0x56, 0x1B, 0x6F, 0x39, 0xC7, 0xDD, 0x2E, 0xF3, 0x09, 0x4C, 0xD6, 0xA3, 0xC9, 0xF5, 0xB3, 0x35, 0xB0, 0xF3, 0x83, 0x7E, 0x65, 0x83, 0xEA, 0xD7, 0xEA, 0x67, 0x0C, 0x09, 0x3C, 0x53, 0x1C, 0xC5, 0x2A, 0x73, 0x5C, 0xDE, 0x75, 0xC1, 0x80, 0xC8, 0xE0, 0x12, 0x1B, 0x37, 0xF4, 0xEF, 0xE0, 0x37, 0xBC, 0x5E, 0xFD, 0x34, 0x2E, 0x2E, 0x61, 0x5B, 0x7F, 0xD9, 0xC8, 0xBC, 0x7D, 0xBD, 0x1B, 0x71, 0xE4, 0x39, 0x0E, 0x2C, 0x91, 0xD6, 0x43, 0xB1, 0x6D, 0xFA, 0xAB, 0x1D, 0x4E, 0x6A, 0xED, 0xC7, 0x75, 0x81, 0xE2, 0x96, 0x38, 0x15, 0x3C, 0x2E, 0x6D, 0x4D, 0xB3, 0xA3, 0x61, 0xAA, 0x48, 0x1E, 0x8D, 0xA1, 0xA3, 0x78, 0x15, 0x7F, 0xF7, 0xBE, 0xFD, 0xD3, 0xBB, 0xAF, 0x79, 0x4A, 0x6C, 0x95, 0x58, 0x55, 0x43, 0x2C, 0x18, 0xD4, 0x54, 0x6E, 0x39, 0xAB, 0x78, 0x44, 0x31, 0xD7, 0xB5, 0xC3, 0xA9, 0xBE, 0xC4, 0x88, 0x4D, 0x0F, 0x88, 0x6A, 0x6C, 0x1B, 0xA4, 0xAA, 0x79, 0xBF, 0xDB, 0x9F, 0x25, 0x68, 0xE4, 0x7B, 0x1A, 0xB9, 0x90, 0xF4, 0x5C, 0x36, 0xB9, 0xD1, 0xC7, 0xE5, 0x26, 0xD3, 0xC4, 0xC4, 0xCC, 0x58, 0x92, 0x86, 0xD7, 0x92, 0x12, 0xD6, 0xFF, 0x03, 0x54, 0x9C, 0xF0, 0xB8, 0xA5, 0xA2, 0x3B, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
-
-constexpr std::size_t size = sizeof(data);
-
-}  // namespace car_red_1
@@ -1,11 +0,0 @@
-#pragma once
-
-#include <cstddef>  // for std::size_t
-
-namespace car_yellow_1 {
-
-constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x47, 0x08, 0x06, 0x00, 0x00, 0x00, 0x24, 0xE4, 0xF4, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0x44, 0x65, 0x58, 0x49, 0x66, 0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0xA0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x6B, 0x38, 0x00, 0x00, 0x10, 0x59, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x5D, 0x59, 0x8C, 0x1C, 0x47, 0x19, 0xFE, 0xFB, 0x98, 0x73, 0x77, 0xBD, 0xEB, 0xDD, 0xC4, 0x76, 0x0E, 0xDB, 0x8B, 0x64, 0x71, 0x04, 0x42, 0x56, 0xCA, 0x03, 0x48, 0x09, 0xC9, 0xBE, 0x80, 0x20, 0x1C, 0xB1, 0x44, 0x1E, 0x38, 0x1E, 0xD8, 0x28, 0x01, 0x22, 0x11, 0x89, 0xF0, 0x94, 0x40, 0x44, 0xEC, 0x24, 0xE2, 0xC8, 0x9B, 0x1F, 0x12, 0x29, 0x40, 0x42, 0x16, 0x71, 0x3D, 0x00, 0x92, 0x23, 0x44, 0x84, 0xE0, 0x81, 0xB5, 0x08, 0x02, 0x84, 0x04, 0x6B, 0x02, 0x06, 0xA1, 0x08, 0xAD, 0x93, 0x90, 0x98, 0x38, 0xBB, 0xDE, 0xCB, 0x73, 0xF6, 0x41, 0x7D, 0x35, 0x5B, 0x3D, 0xD5, 0x3D, 0xD5, 0xD3, 0xD5, 0xE3, 0xE9, 0x9D, 0x31, 0x99, 0x5F, 0x9A, 0xA9, 0xEA, 0xBF, 0xFE, 0x3A, 0xFB, 0xEF, 0xFF, 0xFF, 0xAB, 0xAA, 0xFB, 0x2F, 0x83, 0x52, 0xC2, 0x77, 0x1E, 0x2A, 0xDF, 0x6E, 0x92, 0x37, 0x47, 0x86, 0x31, 0x67, 0x90, 0x3F, 0xE5, 0x11, 0xCD, 0x5A, 0x86, 0x39, 0x2B, 0x17, 0xE3, 0xFA, 0xB4, 0xCC, 0x68, 0xD6, 0x81, 0xF3, 0x7D, 0x5A, 0x42, 0xE8, 0x91, 0xB9, 0xEC, 0xFB, 0x0D, 0x8E, 0x5B, 0x6B, 0x38, 0xCB, 0x0F, 0x3C, 0x46, 0x1B, 0xC0, 0x8F, 0xA0, 0x3D, 0x02, 0xDF, 0xBC, 0x9F, 0x26, 0xA7, 0xF3, 0xF6, 0x9C, 0xC0, 0x58, 0x86, 0x3D, 0x2F, 0xE2, 0xAA, 0xD0, 0x27, 0x77, 0xC5, 0xF3, 0xFD, 0x15, 0xA4, 0x7D, 0xEE, 0x51, 0xE7, 0x94, 0x8A, 0x26, 0x0D, 0xCE, 0xD0, 0x21, 0x7E, 0xEA, 0xA1, 0xDC, 0x67, 0x0C, 0x23, 0x37, 0x6F, 0x1A, 0xB4, 0xA0, 0x43, 0x9F, 0x86, 0x26, 0xC4, 0x38, 0x64, 0x2C, 0x33, 0xEE, 0xE1, 0x0C, 0x23, 0x33, 0x4F, 0xC3, 0x73, 0x56, 0xEE, 0xFD, 0x1A, 0x9D, 0x4D, 0x53, 0xEE, 0xB0, 0xD0, 0x3E, 0xFE, 0x20, 0x1D, 0xCE, 0x9B, 0xF6, 0x2C, 0xDA, 0x63, 0x1A, 0xC6, 0xAC, 0x41, 0x16, 0x8F, 0xB3, 0x87, 0x69, 0x8A, 0x3D, 0x4C, 0x3B, 0x37, 0xDE, 0x9C, 0x33, 0x0C, 0x9A, 0x02, 0xCD, 0xA5, 0x80, 0xEB, 0x7B, 0x2B, 0x26, 0xD1, 0x0A, 0x1E, 0xC0, 0xA6, 0x5F, 0x3B, 0x79, 0xCF, 0xA3, 0x74, 0x3A, 0x4D, 0x79, 0x5D, 0x99, 0xE1, 0xDB, 0x5F, 0xB5, 0x6F, 0x35, 0x4D, 0x7B, 0x31, 0xFA, 0xE4, 0xA7, 0xA9, 0x20, 0x0B, 0x5A, 0xDF, 0xF7, 0x96, 0xE4, 0x72, 0x7D, 0x32, 0x57, 0x88, 0x0D, 0x84, 0x8C, 0x43, 0xDC, 0x27, 0x7F, 0xDD, 0xF3, 0xDD, 0xE5, 0x28, 0xBE, 0x97, 0xEB, 0xD0, 0x8D, 0x94, 0x0B, 0x60, 0x52, 0xD1, 0x20, 0x6F, 0x36, 0x84, 0x32, 0xCC, 0x79, 0xF9, 0x7A, 0x50, 0x71, 0x30, 0x87, 0xE1, 0xD3, 0x62, 0xD5, 0xAD, 0x2D, 0xEA, 0x3C, 0x4C, 0xB1, 0xCC, 0xF0, 0xF4, 0xB1, 0xF2, 0x33, 0x59, 0x48, 0x82, 0x41, 0x0D, 0xCC, 0x9B, 0xBD, 0x5E, 0xCF, 0xF3, 0x8E, 0x9F, 0xAF, 0xD7, 0x4E, 0x74, 0x53, 0xCF, 0x4A, 0x66, 0xF8, 0xEE, 0xB1, 0xE2, 0x6F, 0x8C, 0x18, 0xEE, 0xCE, 0xDB, 0x3E, 0x1D, 0x3A, 0xE0, 0xD2, 0xF4, 0x1E, 0x8F, 0xA6, 0x27, 0x3D, 0xC2, 0xF5, 0xF4, 0xA4, 0xAF, 0x1C, 0xEB, 0x73, 0xAB, 0x4C, 0x68, 0x31, 0xD8, 0xAE, 0x18, 0xB4, 0x5D, 0x6D, 0xC5, 0x05, 0x6E, 0x6D, 0xC3, 0xA4, 0x86, 0xA3, 0xAC, 0x5E, 0x59, 0xD6, 0x9B, 0x05, 0x89, 0x71, 0xCD, 0xE7, 0x5A, 0xE3, 0xD9, 0x8A, 0xC7, 0xF7, 0xBC, 0x35, 0xAE, 0x06, 0x35, 0x9A, 0x06, 0xAD, 0x6D, 0xB6, 0xC6, 0x37, 0x9E, 0x9A, 0x08, 0x92, 0xC2, 0xF7, 0xCD, 0xFB, 0x3E, 0xFB, 0x48, 0xE5, 0x59, 0x15, 0x5D, 0xC7, 0xDD, 0x88, 0x93, 0x08, 0xE3, 0x25, 0x8F, 0xE6, 0xDE, 0xDA, 0xE4, 0x8C, 0x90, 0xCF, 0xA9, 0x8A, 0xEA, 0x0D, 0xD7, 0x68, 0x52, 0xD0, 0x11, 0x30, 0x48, 0xAD, 0x61, 0x52, 0xA5, 0x91, 0xA7, 0xD5, 0xF5, 0x36, 0x83, 0x5D, 0xD8, 0x6C, 0xC7, 0x7B, 0xAB, 0x65, 0x70, 0xB9, 0x5A, 0x0F, 0x0B, 0x33, 0xB3, 0x77, 0xE0, 0xC0, 0x4C, 0x3B, 0x2E, 0x6E, 0x7C, 0xB7, 0x07, 0x4A, 0xE4, 0xD3, 0x09, 0xD7, 0x36, 0x0C, 0x3A, 0xB7, 0x6A, 0xB1, 0x9F, 0xC9, 0xC3, 0xB8, 0x87, 0xCD, 0xF5, 0x9A, 0x0B, 0x77, 0x3F, 0xD2, 0xFC, 0x5E, 0xB4, 0xCC, 0x10, 0x33, 0x60, 0xA6, 0x60, 0x9B, 0x74, 0x32, 0x4A, 0x74, 0xDD, 0x5B, 0x9A, 0x9C, 0x11, 0xFA, 0xC9, 0x04, 0xD1, 0x3A, 0xE4, 0x6B, 0xCF, 0x33, 0xA8, 0xD6, 0xCC, 0xD1, 0x56, 0xB5, 0x48, 0xAE, 0x17, 0xE6, 0xF8, 0xA6, 0xE3, 0xD3, 0xD6, 0xC5, 0x30, 0x73, 0xE0, 0xDA, 0x71, 0xE5, 0x12, 0x5A, 0xF1, 0x6A, 0xCD, 0xA7, 0x6A, 0x3D, 0x4C, 0xDB, 0x49, 0xA5, 0x87, 0x29, 0x15, 0x0C, 0x2A, 0x15, 0x43, 0xC3, 0xC5, 0x33, 0xDA, 0x16, 0xD1, 0xC4, 0x58, 0x1B, 0x6F, 0x99, 0x1E, 0x5D, 0xBB, 0xCF, 0xA1, 0x52, 0xBE, 0x41, 0xB6, 0xD5, 0xBE, 0xF1, 0x7A, 0xB5, 0xF4, 0x8F, 0x0A, 0x0F, 0xD9, 0x4B, 0xE7, 0x2C, 0x5A, 0xFE, 0x57, 0x2E, 0x90, 0xCA, 0x72, 0xE9, 0x2A, 0x86, 0x68, 0xF7, 0x82, 0x51, 0xAA, 0xD4, 0xC3, 0xCD, 0x37, 0xD4, 0xE9, 0xC8, 0x41, 0xC5, 0x48, 0xCB, 0x25, 0x67, 0x18, 0x6F, 0x3A, 0x16, 0x55, 0xEA, 0x79, 0xCE, 0x1C, 0x51, 0xC6, 0xC8, 0xB0, 0xDA, 0x54, 0x45, 0x1B, 0xCC, 0x4A, 0x2B, 0xE6, 0x9A, 0x54, 0x2E, 0x34, 0xA8, 0x90, 0x73, 0x52, 0xE5, 0xCD, 0x9A, 0x18, 0x4C, 0x71, 0x66, 0xED, 0x0E, 0x5A, 0xFE, 0xD3, 0x73, 0x1D, 0x55, 0xD5, 0xDD, 0xCA, 0x9C, 0x3C, 0xE3, 0x08, 0x1E, 0x3B, 0xCC, 0x1C, 0xA2, 0x76, 0x02, 0x24, 0xC2, 0x20, 0x19, 0x01, 0xAD, 0xCF, 0xD9, 0x2E, 0x4D, 0x8E, 0x55, 0x69, 0xFF, 0xD4, 0x26, 0x5D, 0xB9, 0x67, 0x8B, 0xC6, 0x0A, 0x75, 0xF6, 0xC4, 0x0D, 0x8E, 0x39, 0xE5, 0x11, 0x05, 0x03, 0x4C, 0x8D, 0x55, 0x68, 0xFF, 0xE4, 0x26, 0xED, 0x1D, 0xAF, 0x0C, 0x1D, 0x23, 0xA0, 0xAD, 0xF9, 0xBD, 0xB7, 0xD2, 0xDC, 0x6D, 0x3F, 0xA1, 0x8F, 0x7D, 0xFE, 0xF7, 0x94, 0x2F, 0x4C, 0xCA, 0xCD, 0x27, 0xDB, 0x2C, 0x2F, 0xCA, 0x88, 0x80, 0x19, 0x2C, 0x33, 0xBF, 0x20, 0x27, 0x40, 0x8F, 0xC1, 0x46, 0x18, 0x26, 0x10, 0x8C, 0xB1, 0x6F, 0x72, 0x8B, 0xF6, 0xB1, 0x1B, 0x80, 0x1B, 0xB1, 0x5B, 0xCC, 0x81, 0xA7, 0x3F, 0x6F, 0x3B, 0x34, 0x51, 0xAA, 0xD1, 0xCC, 0xC4, 0x36, 0x5D, 0x3D, 0xBD, 0x4E, 0xD3, 0x13, 0x17, 0xB9, 0x34, 0x30, 0xCD, 0xFE, 0xA8, 0xA2, 0xBE, 0x8F, 0xB5, 0xC5, 0x6E, 0xFE, 0xEC, 0x22, 0x2F, 0x76, 0xFA, 0xC0, 0xBB, 0xE9, 0xE6, 0xA3, 0xDF, 0x0A, 0x55, 0x61, 0x19, 0x34, 0x07, 0x21, 0x20, 0x90, 0xB6, 0x88, 0xB0, 0xEE, 0xEC, 0x2C, 0x80, 0xB4, 0x30, 0x47, 0x0E, 0x3A, 0xCC, 0xAA, 0x15, 0xA9, 0xC3, 0x17, 0x42, 0x1F, 0xDB, 0x56, 0x83, 0xA8, 0xD0, 0x6E, 0x5B, 0xBD, 0x69, 0x73, 0x1B, 0x03, 0xEA, 0x04, 0xEA, 0xC5, 0xF3, 0x0D, 0x6A, 0xBA, 0x16, 0x5B, 0xC7, 0x0A, 0x69, 0xC3, 0x76, 0x06, 0x45, 0x0C, 0x3A, 0x5F, 0xFC, 0x5A, 0x75, 0xB8, 0x94, 0x63, 0x92, 0x68, 0x90, 0xFA, 0x5F, 0xD1, 0x4C, 0x8E, 0x12, 0x7D, 0x94, 0xD3, 0x43, 0x6A, 0x6A, 0x66, 0x81, 0x8D, 0xCF, 0x6C, 0x90, 0x7C, 0xE8, 0xED, 0x1F, 0xA5, 0x23, 0x37, 0x7C, 0x9A, 0x5E, 0x3C, 0xFD, 0xC3, 0x00, 0xD7, 0x12, 0x02, 0xAD, 0xD5, 0xCB, 0x80, 0x19, 0xC0, 0x25, 0x01, 0x05, 0x8B, 0x1C, 0xB9, 0x76, 0xB8, 0x74, 0x9F, 0xDC, 0xB6, 0xB8, 0x78, 0x68, 0x20, 0x14, 0x44, 0x30, 0x4C, 0xC1, 0x1C, 0x51, 0x48, 0xCA, 0x17, 0xA5, 0xCF, 0xFA, 0x5A, 0xDC, 0x64, 0x30, 0xB3, 0xB3, 0xD3, 0x5E, 0x15, 0x2E, 0xAE, 0x1D, 0x50, 0x5F, 0x63, 0xC5, 0x3A, 0x15, 0x56, 0x17, 0x89, 0xAE, 0x3A, 0x4E, 0x64, 0x4F, 0x05, 0xA4, 0x73, 0xF3, 0x0F, 0x86, 0x98, 0x81, 0x3D, 0x26, 0x47, 0x59, 0xE2, 0x9D, 0x20, 0x08, 0xD4, 0x44, 0x40, 0xBD, 0x13, 0x89, 0x5B, 0x3B, 0x88, 0xD2, 0x5D, 0x4E, 0xD7, 0x10, 0xE7, 0xB8, 0xF1, 0xD1, 0xDF, 0xA0, 0xFB, 0x80, 0x1B, 0xFD, 0xFA, 0xC6, 0x04, 0xBD, 0xBA, 0x36, 0xC5, 0x7F, 0xE7, 0x37, 0x27, 0x68, 0x75, 0x6B, 0x9C, 0x2E, 0x6C, 0x8F, 0xF1, 0x19, 0x15, 0x66, 0x55, 0x98, 0x5D, 0x35, 0x1C, 0x3B, 0x60, 0x8E, 0x6E, 0x6D, 0x06, 0x2D, 0xF2, 0x6F, 0x6C, 0x32, 0xC9, 0xF9, 0xFA, 0x89, 0x10, 0xE9, 0xF8, 0xD4, 0x61, 0x9A, 0xDE, 0x7F, 0x7D, 0x80, 0xC3, 0x32, 0x38, 0xF6, 0x44, 0x80, 0xE0, 0x92, 0x41, 0xD6, 0x1B, 0x40, 0x62, 0x4D, 0x61, 0x04, 0x7D, 0x18, 0x81, 0xFC, 0x61, 0x66, 0xC1, 0xCD, 0x12, 0x95, 0x99, 0xD0, 0xB5, 0xD8, 0xD3, 0x29, 0xC2, 0x89, 0xF9, 0x56, 0xE1, 0x2F, 0xB0, 0xB4, 0xC6, 0x59, 0x6E, 0x24, 0x67, 0x31, 0x53, 0xBA, 0x58, 0x2F, 0x50, 0x6E, 0xE5, 0x1B, 0x54, 0x9E, 0x59, 0x08, 0xA9, 0x8B, 0x03, 0xB3, 0xB7, 0xD0, 0xDA, 0x7F, 0x5F, 0x68, 0xB5, 0x81, 0xFD, 0xB7, 0x36, 0xC7, 0x9C, 0x53, 0x9C, 0x19, 0x0C, 0x23, 0xCF, 0x5A, 0xDA, 0x06, 0x2C, 0x86, 0xC4, 0x81, 0x10, 0x57, 0x71, 0xE9, 0xDD, 0xF0, 0xE6, 0xC4, 0x7B, 0x28, 0x57, 0xFB, 0x5D, 0x37, 0x92, 0xCB, 0x2E, 0xCD, 0xC9, 0xBF, 0x8B, 0x7C, 0x73, 0x92, 0xDC, 0xFC, 0xF5, 0xE4, 0x33, 0x83, 0xCD, 0x29, 0xDE, 0x44, 0xA5, 0x89, 0xAB, 0xC9, 0x9E, 0xB8, 0x31, 0xB9, 0x2F, 0x10, 0xE1, 0x67, 0xB9, 0x84, 0xA6, 0x02, 0x33, 0x4E, 0xF1, 0x44, 0xF7, 0x1B, 0x20, 0x55, 0xCA, 0x2F, 0xDF, 0xC7, 0xF4, 0xFE, 0xC9, 0xA0, 0xE8, 0x7C, 0x91, 0x0B, 0x82, 0xE0, 0x1A, 0xFB, 0x2E, 0xEC, 0xA2, 0xC5, 0x0C, 0x7C, 0x4B, 0x5A, 0xD2, 0x18, 0xDD, 0x54, 0xC4, 0x46, 0xA5, 0xC4, 0xC5, 0x55, 0x50, 0x52, 0x8A, 0x48, 0xE9, 0x6D, 0x3F, 0xE7, 0xD4, 0x66, 0xF3, 0x25, 0x32, 0x9D, 0x97, 0xC8, 0x6A, 0xBC, 0x40, 0x86, 0xB7, 0x49, 0x76, 0xF5, 0xF9, 0xD6, 0xB5, 0xF3, 0x72, 0x8A, 0xD2, 0x76, 0x9F, 0xB4, 0x51, 0xBE, 0x8D, 0x9C, 0xD2, 0x4D, 0xFC, 0xC6, 0x7B, 0xF6, 0x21, 0xF2, 0x72, 0x87, 0x94, 0x8D, 0x68, 0xDA, 0xC5, 0x96, 0xC8, 0x55, 0xA6, 0x4A, 0x48, 0x21, 0x21, 0x18, 0xAA, 0x98, 0x6F, 0x66, 0xC2, 0x0C, 0x90, 0x38, 0xD5, 0xF3, 0xCF, 0x51, 0x69, 0xFF, 0x12, 0x5B, 0x1D, 0x9B, 0x97, 0x2A, 0x6F, 0x47, 0x5B, 0x3B, 0xA9, 0x4D, 0xBD, 0x36, 0xB7, 0xB3, 0xF5, 0x1E, 0x33, 0xA7, 0xDE, 0x1F, 0x64, 0xC6, 0x20, 0xE2, 0xE7, 0x94, 0x6E, 0x6E, 0xE1, 0xF6, 0xDE, 0xCF, 0xC3, 0xF1, 0xF1, 0x71, 0xCA, 0x35, 0xFF, 0xCE, 0x16, 0xD1, 0xD7, 0x89, 0xB6, 0x96, 0x98, 0x08, 0x5D, 0x21, 0xAA, 0xB3, 0x5F, 0x75, 0x99, 0xE1, 0x06, 0xFF, 0xFA, 0x43, 0xE5, 0xCA, 0x27, 0xF8, 0xD3, 0xCF, 0x1B, 0xDB, 0x8F, 0x3F, 0x58, 0xFA, 0xA5, 0x1B, 0x58, 0xFF, 0x4E, 0xF3, 0x45, 0xAB, 0x7E, 0x14, 0xA9, 0x2A, 0x83, 0x1B, 0xA1, 0x90, 0x0E, 0xD7, 0xB1, 0x71, 0x64, 0x70, 0x60, 0xF6, 0x7D, 0x4C, 0x0E, 0x48, 0x94, 0xEC, 0xDD, 0x14, 0x5C, 0x05, 0xB3, 0x09, 0x29, 0xA9, 0x6B, 0x14, 0x16, 0x6E, 0x2F, 0x60, 0xCF, 0x7C, 0x3C, 0x31, 0x9B, 0xC1, 0xAC, 0x19, 0xAE, 0x57, 0x41, 0xA9, 0xE2, 0x62, 0x30, 0x08, 0x3A, 0xC5, 0x06, 0x6F, 0x10, 0x00, 0x49, 0x16, 0x30, 0x70, 0x97, 0x06, 0x38, 0x4E, 0x8A, 0x99, 0x18, 0x6C, 0x09, 0x06, 0x30, 0x6E, 0xB1, 0x8E, 0x01, 0x23, 0xB1, 0xDF, 0x80, 0x15, 0xDC, 0x09, 0x8C, 0xD9, 0x1B, 0x8B, 0x44, 0x57, 0x2C, 0x74, 0x14, 0x8F, 0x97, 0x94, 0x80, 0x8C, 0x9D, 0x4D, 0x74, 0xE4, 0xD8, 0x41, 0x88, 0xA9, 0x4E, 0x5C, 0xBA, 0x0A, 0x6F, 0xE4, 0xAF, 0x21, 0x6B, 0xEF, 0x07, 0x54, 0x49, 0x01, 0x0E, 0x8C, 0x60, 0xDB, 0x09, 0x03, 0x01, 0x06, 0x99, 0x3A, 0x1A, 0xE4, 0xD9, 0xED, 0x88, 0xAD, 0x69, 0xEF, 0x80, 0x19, 0xD8, 0x96, 0xB1, 0x5E, 0xF3, 0xA4, 0xFE, 0x40, 0x55, 0x64, 0x01, 0x50, 0x15, 0x98, 0x56, 0xD3, 0x2B, 0xEC, 0x41, 0x72, 0xD6, 0x09, 0x33, 0x0A, 0x19, 0xC4, 0xCA, 0x33, 0x67, 0x06, 0x76, 0x1F, 0xE6, 0xE5, 0xC4, 0x03, 0x33, 0xAE, 0x7C, 0x19, 0xC4, 0x61, 0x3C, 0xF6, 0x02, 0xD6, 0x15, 0x77, 0x24, 0x66, 0x4B, 0x64, 0x84, 0xC4, 0x12, 0xB2, 0x27, 0x80, 0xAD, 0xA3, 0x0B, 0xAE, 0xAB, 0x1E, 0xC3, 0x8E, 0xFC, 0x32, 0x33, 0xB0, 0xF5, 0x01, 0x2C, 0x78, 0x65, 0x01, 0x75, 0x48, 0x1C, 0xA8, 0x5A, 0x36, 0xD5, 0x8C, 0x32, 0x83, 0xA8, 0x2F, 0xE1, 0x51, 0x14, 0x64, 0xAD, 0x50, 0xB5, 0x60, 0x13, 0xA6, 0x50, 0x5F, 0x61, 0x16, 0x91, 0x04, 0xB9, 0x9C, 0xA6, 0x25, 0x0D, 0x3B, 0xA2, 0x07, 0x70, 0xED, 0x83, 0x04, 0xA3, 0xAF, 0x1B, 0x40, 0x0D, 0x98, 0xCC, 0xA0, 0x8D, 0x03, 0x18, 0xBD, 0xBA, 0xE0, 0xB3, 0x77, 0xCF, 0xB4, 0x40, 0x5A, 0x21, 0xC4, 0x2A, 0x27, 0x54, 0x45, 0x95, 0x6D, 0xE1, 0xF7, 0x1B, 0x5A, 0x12, 0x9D, 0x49, 0x9E, 0xD7, 0x1E, 0x26, 0x9A, 0x59, 0x50, 0x16, 0xCF, 0x99, 0x41, 0x88, 0x09, 0x41, 0x21, 0xEF, 0xB9, 0x0B, 0x1C, 0xC2, 0x9E, 0xE6, 0xC2, 0xD6, 0x04, 0x59, 0x13, 0xEF, 0x95, 0x8B, 0x51, 0xC6, 0xB5, 0x25, 0x43, 0x65, 0x59, 0x99, 0xBF, 0x1B, 0x72, 0x7B, 0xFF, 0xF7, 0xA9, 0x39, 0xF6, 0xE1, 0x6E, 0x24, 0x3C, 0xCD, 0x60, 0x4F, 0x4E, 0x69, 0xF5, 0x2B, 0x54, 0xD8, 0xFE, 0x71, 0x22, 0x6D, 0x12, 0x81, 0xB6, 0x64, 0x40, 0x41, 0x3B, 0x46, 0x24, 0xA2, 0x59, 0x2D, 0x7B, 0x73, 0x35, 0x81, 0x0A, 0x00, 0xB0, 0xBB, 0x14, 0xC0, 0xD5, 0x84, 0x02, 0xAF, 0x44, 0x61, 0xED, 0x3F, 0x2D, 0x58, 0x33, 0xC9, 0x2A, 0x02, 0x65, 0x5A, 0x96, 0xA6, 0x0A, 0x4A, 0x69, 0x3C, 0xD6, 0xF6, 0xDC, 0xA3, 0xC5, 0x08, 0x68, 0x03, 0xD6, 0x09, 0x2A, 0xFB, 0x9E, 0x20, 0x48, 0x11, 0x15, 0x40, 0x72, 0xE8, 0x82, 0xB6, 0xCD, 0x80, 0x02, 0x77, 0x8C, 0x48, 0x44, 0xB3, 0xDA, 0x91, 0x0D, 0x49, 0xF5, 0x8D, 0x67, 0x3B, 0xB6, 0x1B, 0x9E, 0x7E, 0xA8, 0x78, 0xCC, 0x8C, 0xAE, 0x3E, 0xC6, 0xD9, 0x0B, 0x68, 0x68, 0x2F, 0x60, 0x96, 0xDF, 0x91, 0x98, 0xCD, 0x34, 0x35, 0x79, 0x12, 0xB3, 0x89, 0x94, 0x80, 0x1B, 0x9C, 0x16, 0x1A, 0x13, 0x9F, 0x52, 0x66, 0x81, 0x0A, 0xD1, 0xB5, 0x1B, 0x52, 0x31, 0x83, 0x64, 0x37, 0x94, 0x32, 0x32, 0x22, 0xA3, 0x1D, 0x1A, 0x2F, 0x77, 0xAA, 0x31, 0xCD, 0xBB, 0x10, 0x2D, 0x4A, 0xFF, 0xDA, 0x2C, 0x5F, 0x97, 0x48, 0xAC, 0x6D, 0x2F, 0xF4, 0xA0, 0x22, 0x12, 0x2B, 0x57, 0x10, 0xD4, 0xD8, 0xBA, 0x87, 0x67, 0xEE, 0x51, 0xA4, 0xB0, 0xE9, 0x97, 0xA6, 0xDD, 0x90, 0x8A, 0x19, 0xB0, 0x4C, 0x2D, 0x01, 0xB6, 0xCB, 0xFB, 0x0D, 0xD1, 0x29, 0x6B, 0xC7, 0x96, 0x03, 0x7B, 0xCB, 0x3B, 0x15, 0x33, 0x44, 0x0B, 0xD4, 0x69, 0xB0, 0x0E, 0x33, 0xF0, 0xF5, 0x05, 0x9D, 0xC2, 0xB0, 0x18, 0xB5, 0x4B, 0xE0, 0x14, 0x77, 0x16, 0xC4, 0x7A, 0xAC, 0x2F, 0x15, 0x33, 0x44, 0xEA, 0xC0, 0x96, 0x79, 0xD6, 0x10, 0x95, 0x0C, 0x78, 0xDD, 0x3F, 0x15, 0x33, 0xA4, 0x6D, 0xA0, 0xCE, 0x2C, 0x02, 0x65, 0x6A, 0xDB, 0x0B, 0xBB, 0xC8, 0x0C, 0x6E, 0xA1, 0xBD, 0xB3, 0x97, 0xB6, 0xDF, 0x82, 0x5E, 0xDB, 0x88, 0x2C, 0x85, 0x25, 0x43, 0x56, 0xD3, 0x4B, 0xD1, 0xAE, 0xB8, 0xD0, 0x34, 0x0D, 0x2B, 0xD4, 0x92, 0x6E, 0x9B, 0x54, 0x71, 0x85, 0xC4, 0xE1, 0x8D, 0x52, 0xB2, 0x8A, 0x40, 0x5E, 0x6D, 0xC9, 0xB0, 0x4B, 0x6A, 0x02, 0x6D, 0xF2, 0x62, 0x8C, 0x48, 0x5D, 0x35, 0xC1, 0xCB, 0xD0, 0x5D, 0x78, 0x92, 0xDE, 0x37, 0x40, 0xBE, 0x5D, 0x99, 0x51, 0xA0, 0xA2, 0x08, 0xB0, 0xEF, 0x64, 0x8C, 0x29, 0x19, 0x17, 0xF7, 0x76, 0x53, 0x4F, 0x33, 0x09, 0x8D, 0xF5, 0x05, 0xD4, 0xAD, 0x2D, 0x19, 0xE4, 0x86, 0x66, 0x1C, 0x8F, 0x5B, 0x93, 0x30, 0xB3, 0xDA, 0x4C, 0x93, 0x0C, 0xDD, 0xAC, 0x24, 0x43, 0x68, 0x46, 0xA1, 0x18, 0xBF, 0x4C, 0xD5, 0x04, 0xD9, 0x6A, 0x23, 0x2C, 0xDA, 0x0E, 0xED, 0xD9, 0x04, 0x36, 0xAC, 0x76, 0x09, 0xE2, 0x98, 0x21, 0x4D, 0xF5, 0xA9, 0xEC, 0x06, 0x49, 0x55, 0x64, 0xC5, 0x0C, 0x49, 0x6D, 0xCF, 0x94, 0x19, 0x4C, 0x4D, 0x35, 0x91, 0xD4, 0xC8, 0x20, 0x7D, 0x17, 0x77, 0x2E, 0xE3, 0xB6, 0xA7, 0x83, 0xB6, 0x68, 0x44, 0x52, 0x31, 0x83, 0x54, 0xDE, 0x6E, 0x18, 0x90, 0x52, 0x75, 0x41, 0x34, 0x53, 0x66, 0x30, 0x34, 0x25, 0x43, 0xD0, 0x9A, 0x51, 0x84, 0x8F, 0x40, 0x56, 0x6F, 0x5B, 0x27, 0xED, 0x38, 0x67, 0xCA, 0x0C, 0xA3, 0x7B, 0x3B, 0x5C, 0x23, 0x90, 0xB4, 0xE3, 0x3C, 0x62, 0x86, 0xE1, 0xBA, 0x5F, 0x03, 0x6D, 0xCD, 0x88, 0x19, 0x06, 0x3A, 0xFC, 0xC3, 0x55, 0xF9, 0x88, 0x19, 0x86, 0xEB, 0x7E, 0x0C, 0xB4, 0x35, 0x23, 0x66, 0x18, 0xE8, 0xF0, 0x0F, 0x57, 0xE5, 0x23, 0x66, 0x18, 0xAE, 0xFB, 0x31, 0xD0, 0xD6, 0x8C, 0x98, 0x61, 0xA0, 0xC3, 0x3F, 0x5C, 0x95, 0x8F, 0x98, 0x61, 0xB8, 0xEE, 0xC7, 0x40, 0x5B, 0x93, 0x29, 0x33, 0xF8, 0x4E, 0xFC, 0xFB, 0x84, 0x03, 0xED, 0xF5, 0xA8, 0x72, 0xEE, 0xE6, 0x47, 0x1E, 0x06, 0xB8, 0x0B, 0xCC, 0x94, 0x19, 0xBC, 0xEA, 0x19, 0xB9, 0xBE, 0xCB, 0x2A, 0xAE, 0xFB, 0x46, 0x53, 0xB7, 0x4E, 0x69, 0xEF, 0xB9, 0x44, 0x0A, 0xE9, 0x65, 0x53, 0x30, 0x52, 0x44, 0x4F, 0x97, 0xDA, 0xCC, 0x60, 0xF6, 0xF2, 0xF6, 0x8D, 0xA6, 0x64, 0xD0, 0x5E, 0xC3, 0x1F, 0xBF, 0xB5, 0xA7, 0x4E, 0xF6, 0x92, 0x29, 0xCD, 0x56, 0x75, 0x5C, 0xF9, 0xA9, 0x98, 0x41, 0xDA, 0x84, 0x4B, 0x5A, 0x36, 0x8E, 0xAB, 0xEF, 0x52, 0xF1, 0xDA, 0xCC, 0x00, 0xAF, 0x29, 0x69, 0xC1, 0xDD, 0xFA, 0xA3, 0x56, 0x16, 0xED, 0x97, 0x40, 0xB4, 0x4A, 0xEB, 0x0F, 0x51, 0x1C, 0x33, 0xC4, 0xBD, 0xE7, 0x70, 0xC9, 0xB5, 0x4A, 0x9B, 0x70, 0x49, 0xCB, 0xC6, 0x97, 0x5C, 0x57, 0x4C, 0x01, 0x1D, 0xCC, 0x00, 0x87, 0x50, 0xFD, 0x02, 0x5F, 0x53, 0x4D, 0xF4, 0xF2, 0x8D, 0x41, 0xBF, 0xDA, 0x18, 0x57, 0x4E, 0xDC, 0x7B, 0x0B, 0x69, 0xB6, 0xB6, 0xB5, 0x25, 0x03, 0xFB, 0xCA, 0x49, 0x06, 0xC7, 0xED, 0xB8, 0x2D, 0x72, 0x72, 0x5F, 0xE2, 0x70, 0x13, 0x28, 0x03, 0xFC, 0x50, 0x9B, 0xAE, 0xEF, 0x2C, 0xC9, 0xC8, 0x6E, 0xCE, 0x25, 0xD3, 0xBE, 0xA8, 0xE9, 0xF5, 0x5B, 0x32, 0xC0, 0xD7, 0xC1, 0x2E, 0x81, 0x55, 0xD7, 0x7F, 0x2D, 0x3E, 0xAE, 0x49, 0xDA, 0x2F, 0xED, 0x48, 0x2A, 0x02, 0x65, 0xF5, 0xF4, 0x7D, 0x4A, 0x5C, 0x23, 0x24, 0xBC, 0xFC, 0x1A, 0x7E, 0xD4, 0x47, 0x24, 0x1C, 0x92, 0xA7, 0x62, 0xC1, 0x5E, 0xF6, 0xD9, 0xBD, 0x4A, 0xB2, 0x11, 0xA9, 0x2D, 0x19, 0xA4, 0x8E, 0x65, 0x1D, 0xB5, 0x6B, 0xCF, 0x5F, 0x52, 0x15, 0xDA, 0x52, 0x41, 0x51, 0x4B, 0xD2, 0x1B, 0x49, 0x8A, 0x2C, 0x5A, 0xA8, 0x24, 0xBB, 0x2F, 0x15, 0x33, 0x68, 0xD5, 0x18, 0x21, 0xD2, 0x61, 0x86, 0x66, 0x53, 0x53, 0x37, 0xA9, 0xBE, 0xCC, 0x8E, 0xD4, 0xD7, 0x8F, 0xCB, 0xE2, 0x85, 0xC7, 0x62, 0x3F, 0xB3, 0xD3, 0x55, 0x13, 0xA9, 0x98, 0x21, 0xF2, 0x6E, 0x67, 0x1A, 0x87, 0x64, 0xBA, 0xFD, 0xC5, 0x67, 0x7B, 0x49, 0xBE, 0xAB, 0xD8, 0x67, 0x9E, 0x61, 0x85, 0x05, 0x7F, 0xC4, 0x71, 0x90, 0xC4, 0x59, 0xAA, 0x7C, 0x5E, 0xE5, 0x1F, 0x2A, 0x74, 0x08, 0xA7, 0x3D, 0x9B, 0xE8, 0x81, 0x19, 0xF0, 0xC9, 0x5C, 0x5A, 0xC8, 0x6F, 0xFD, 0x28, 0x36, 0x8B, 0xEE, 0x1B, 0x50, 0xA9, 0x98, 0x61, 0xFD, 0x64, 0x50, 0xDF, 0x6E, 0x4D, 0x2B, 0xE1, 0x6F, 0x3A, 0x0A, 0xA6, 0xEC, 0x21, 0x14, 0x89, 0xC2, 0xE1, 0x77, 0x94, 0x10, 0xD7, 0x3D, 0xCD, 0x28, 0x56, 0x7F, 0xAA, 0x2A, 0xAA, 0x03, 0xA7, 0x3D, 0xA3, 0xC0, 0x77, 0x89, 0x29, 0xA0, 0xB8, 0xF9, 0x24, 0x75, 0xBB, 0xB9, 0x72, 0x51, 0x60, 0x9C, 0xF2, 0xEB, 0x5F, 0x20, 0x2B, 0xE6, 0xA5, 0xD7, 0x26, 0x73, 0xD1, 0xA3, 0x0B, 0xA9, 0x98, 0x41, 0xFA, 0x04, 0xA0, 0x97, 0x6F, 0x53, 0x74, 0xDA, 0x14, 0x7A, 0xAF, 0x72, 0xF2, 0xF6, 0xC0, 0x5F, 0xB7, 0xC8, 0x8B, 0xC3, 0x4B, 0xF8, 0xC7, 0x93, 0xF0, 0x36, 0x2E, 0x9F, 0x29, 0x01, 0x4B, 0x53, 0xE5, 0xCA, 0x47, 0x36, 0x40, 0x44, 0x21, 0x89, 0xA1, 0xBB, 0x45, 0xEE, 0xD6, 0x1F, 0x12, 0x3F, 0xBE, 0x85, 0x4F, 0x03, 0x2D, 0x83, 0x0B, 0x5F, 0x1F, 0xA5, 0xFC, 0xDE, 0x72, 0xEC, 0xFC, 0xBD, 0x04, 0xD1, 0x9F, 0x24, 0xE2, 0x93, 0xBE, 0xC2, 0x4E, 0xEC, 0xAB, 0x44, 0xA0, 0xD5, 0x17, 0x41, 0x2F, 0xF5, 0x27, 0xF4, 0x81, 0xAC, 0x48, 0xEF, 0x43, 0x18, 0x7A, 0xFD, 0xFE, 0xE0, 0x09, 0x56, 0xE2, 0x3B, 0x3B, 0x4A, 0xE5, 0xCC, 0xC0, 0x0C, 0x87, 0x15, 0x96, 0x32, 0x2B, 0x52, 0x5B, 0x96, 0x66, 0xE7, 0x27, 0x5E, 0x76, 0x8F, 0xBE, 0x03, 0x30, 0xAB, 0x48, 0xFA, 0x12, 0x1B, 0x76, 0x43, 0xA1, 0x50, 0x10, 0x4D, 0x88, 0x0F, 0x7B, 0x9C, 0x51, 0xE0, 0x69, 0x8F, 0x7B, 0xE2, 0xE3, 0x2B, 0x0B, 0xA7, 0xC0, 0x91, 0x97, 0x2E, 0x68, 0x7F, 0x0B, 0x02, 0x37, 0x45, 0x3B, 0x80, 0x29, 0x65, 0x16, 0x4E, 0xBE, 0x50, 0x7C, 0xF0, 0x20, 0x5F, 0x75, 0x2C, 0xE4, 0xF9, 0x4D, 0xD4, 0x8D, 0x90, 0x1B, 0x90, 0xFC, 0x24, 0x17, 0x09, 0x0B, 0x37, 0xF5, 0x2A, 0xE8, 0x45, 0x4D, 0xA0, 0x1C, 0xF7, 0x8D, 0x64, 0x55, 0x91, 0xCA, 0xF5, 0x8D, 0xAA, 0x71, 0xBB, 0x80, 0x4B, 0xF3, 0x95, 0x95, 0xB6, 0x64, 0x90, 0xEC, 0x05, 0xCC, 0x22, 0xB2, 0x9A, 0x56, 0xF2, 0x99, 0x20, 0xBE, 0xCD, 0xD8, 0x77, 0x1F, 0x6D, 0xAF, 0x9F, 0x55, 0x8E, 0x56, 0x6B, 0x36, 0xA1, 0x38, 0xD2, 0x47, 0x49, 0xCD, 0x90, 0x01, 0x87, 0xC5, 0x11, 0x28, 0xF0, 0x7E, 0xE3, 0x3F, 0xE4, 0x5E, 0xF8, 0x95, 0x22, 0xA5, 0x8D, 0xC2, 0xF4, 0x72, 0xD8, 0x19, 0x02, 0x6E, 0xFD, 0x74, 0x00, 0xBE, 0x26, 0xB4, 0x6D, 0x06, 0x89, 0x19, 0xB2, 0x5A, 0x79, 0xC4, 0xFA, 0x10, 0x57, 0x13, 0xD7, 0x32, 0xF5, 0xC0, 0xBE, 0xDE, 0x8A, 0x32, 0x83, 0x38, 0xE6, 0x89, 0xAB, 0x09, 0x1C, 0x0E, 0x26, 0xCF, 0x31, 0xC5, 0x69, 0x31, 0xAA, 0x8E, 0xF7, 0x32, 0xA3, 0x40, 0x39, 0xCE, 0xEA, 0xCF, 0x12, 0xFD, 0x3A, 0xF1, 0xF5, 0x06, 0x88, 0x4D, 0x78, 0x67, 0x11, 0x21, 0x8C, 0x2B, 0x4C, 0xBD, 0x10, 0x4A, 0xBA, 0x15, 0x65, 0xEE, 0x36, 0x24, 0xD9, 0x1C, 0xA2, 0x3D, 0xDA, 0x8E, 0x47, 0x90, 0x41, 0x32, 0x1E, 0xAB, 0x0D, 0x4D, 0xEF, 0x35, 0xA2, 0x22, 0xCD, 0xB0, 0xCC, 0xCE, 0xBE, 0xE0, 0x0E, 0x41, 0x14, 0xCE, 0xBD, 0x50, 0x84, 0x4F, 0x06, 0x1B, 0x5C, 0xC6, 0x27, 0xFC, 0x82, 0x1F, 0x31, 0xD8, 0x7F, 0xD7, 0x31, 0x28, 0x5B, 0x80, 0xB7, 0xFE, 0x6B, 0x11, 0xE5, 0x3E, 0x0E, 0xB0, 0xF6, 0x0F, 0x83, 0xED, 0x72, 0xF2, 0x03, 0x59, 0xD8, 0x78, 0x92, 0xB9, 0x2C, 0x3C, 0x98, 0xE8, 0x07, 0x32, 0xE8, 0x68, 0x52, 0x04, 0x0C, 0xBF, 0xC3, 0xE0, 0xB0, 0x17, 0xB2, 0x92, 0x0C, 0x5C, 0xBD, 0x73, 0xA3, 0xB1, 0xD5, 0xA0, 0xB5, 0x73, 0x7F, 0x0D, 0xB7, 0xCC, 0xF7, 0xD9, 0xD3, 0xB6, 0xC3, 0x0C, 0xE1, 0x94, 0xEE, 0x57, 0x93, 0xE5, 0x2A, 0xF7, 0xD6, 0xDE, 0x9D, 0x4A, 0x9D, 0x6A, 0xBE, 0xFA, 0xD1, 0xCB, 0xDA, 0x43, 0x2C, 0xA6, 0xA9, 0x51, 0x50, 0x79, 0x88, 0xCD, 0xD9, 0x57, 0x33, 0xB2, 0x1B, 0xA3, 0xA4, 0x9D, 0xD7, 0x92, 0xF3, 0x91, 0x2C, 0xA7, 0x94, 0xE5, 0x7D, 0x1F, 0x0A, 0xB9, 0x52, 0x6C, 0xD4, 0xC2, 0x6B, 0x2F, 0xD8, 0x97, 0x40, 0xE3, 0xB8, 0x64, 0x88, 0xB6, 0xB2, 0xDB, 0xC2, 0x53, 0xAF, 0x46, 0x24, 0xAF, 0x43, 0xD3, 0x75, 0x5E, 0xB4, 0x3D, 0xC3, 0x7C, 0x6D, 0x37, 0xFE, 0xC6, 0x9B, 0x17, 0x72, 0x83, 0xFC, 0xDA, 0x4E, 0x8B, 0x93, 0x7C, 0x47, 0xBF, 0x76, 0x3C, 0xE8, 0x5A, 0x2D, 0x23, 0x15, 0x81, 0xF3, 0x31, 0x48, 0x92, 0x0A, 0xA8, 0x30, 0xCA, 0x0C, 0xE2, 0xA0, 0x54, 0xCE, 0x0C, 0x58, 0x70, 0x78, 0xE6, 0x78, 0x5B, 0x4D, 0x74, 0x5B, 0x78, 0x0A, 0x5A, 0x3F, 0x8A, 0x24, 0x8F, 0x00, 0x73, 0x12, 0x0E, 0x47, 0xE1, 0xB4, 0x7D, 0xAA, 0x2B, 0x2D, 0x57, 0x11, 0x91, 0xB3, 0xB8, 0xBA, 0x66, 0xD0, 0x4C, 0xC4, 0xC1, 0x2C, 0xE5, 0xD9, 0x2F, 0x77, 0x4C, 0x25, 0xA3, 0x6A, 0x02, 0x87, 0xC8, 0xA2, 0x48, 0xA5, 0x64, 0x40, 0x02, 0xA4, 0x43, 0xD4, 0xBB, 0x07, 0xF0, 0x97, 0x33, 0x0C, 0xEB, 0x79, 0x13, 0xB0, 0xF4, 0x71, 0xBA, 0x8E, 0x00, 0xE1, 0xAC, 0xFD, 0x92, 0xCF, 0x9B, 0x28, 0x8E, 0xF1, 0xA9, 0xA4, 0x28, 0x17, 0x21, 0x66, 0x12, 0xE7, 0xCE, 0xFE, 0x56, 0x46, 0x91, 0x38, 0x00, 0x35, 0x60, 0x06, 0x1C, 0x43, 0x2C, 0x1F, 0x40, 0xF2, 0xE2, 0x2B, 0xF6, 0xD0, 0x1D, 0x4B, 0x14, 0xEA, 0x81, 0xE2, 0x02, 0xEB, 0xFA, 0x98, 0xA7, 0xE3, 0x27, 0x06, 0x14, 0x73, 0xF7, 0x34, 0x1B, 0x3F, 0x58, 0xB6, 0x15, 0x3F, 0xDC, 0x24, 0x4C, 0xA5, 0x31, 0x47, 0x0F, 0xAD, 0xE0, 0x29, 0xEA, 0xEE, 0x27, 0x2A, 0xAC, 0x8A, 0x9B, 0xB1, 0x45, 0x8B, 0x3E, 0xCA, 0x04, 0xA1, 0xCD, 0x28, 0xB6, 0xA6, 0x20, 0x1F, 0x3C, 0x02, 0xBA, 0x17, 0x97, 0x7F, 0x20, 0x93, 0x33, 0xFB, 0xCF, 0x3F, 0x29, 0x10, 0x01, 0x33, 0x30, 0xFF, 0xC1, 0x4B, 0xCC, 0x87, 0xCA, 0x9C, 0x48, 0x38, 0xF3, 0x6F, 0x9B, 0x70, 0x60, 0x59, 0x9C, 0xF3, 0x0E, 0x41, 0x37, 0xA8, 0x10, 0xA2, 0x15, 0x46, 0x17, 0x06, 0x04, 0xDE, 0x4F, 0xFB, 0x65, 0x89, 0x0B, 0x66, 0x8A, 0xF6, 0x0B, 0x73, 0x75, 0x30, 0x05, 0x06, 0x5B, 0x67, 0x07, 0x30, 0x9A, 0x3F, 0x8B, 0xEB, 0x30, 0xD3, 0x28, 0x6A, 0xC0, 0xC1, 0x23, 0x12, 0x43, 0x40, 0x3D, 0x2C, 0x9F, 0xFA, 0x7A, 0x88, 0xD0, 0xF7, 0x9D, 0x80, 0x19, 0x82, 0xA5, 0xC6, 0x8F, 0xDC, 0x42, 0x35, 0xCB, 0xB4, 0x16, 0x04, 0xA5, 0xCB, 0x7C, 0x0D, 0xBB, 0x1E, 0xD1, 0x35, 0xFB, 0xD8, 0xDF, 0x90, 0x00, 0x6E, 0xFC, 0x36, 0x3B, 0x3F, 0x61, 0xB3, 0x5A, 0x62, 0x27, 0xB4, 0x94, 0xF8, 0xD2, 0x6D, 0xD3, 0xB5, 0x19, 0x77, 0xCB, 0xAB, 0x24, 0x59, 0x35, 0x16, 0xE3, 0xD1, 0x62, 0x40, 0x78, 0x70, 0xC5, 0x39, 0x0E, 0x68, 0x0F, 0x9B, 0xA3, 0x73, 0x49, 0x02, 0x1F, 0xE8, 0x43, 0x07, 0x7E, 0x9D, 0xA8, 0xF6, 0x4F, 0x76, 0xBA, 0xC8, 0x27, 0x08, 0x8C, 0xF0, 0xCB, 0xC5, 0x0F, 0x92, 0xEB, 0x32, 0xDC, 0x0E, 0xB0, 0x75, 0xBE, 0xF5, 0xBB, 0x1E, 0xA9, 0x7F, 0x52, 0x5C, 0x87, 0xBA, 0x30, 0x3A, 0xD7, 0x52, 0x0C, 0x4B, 0xBA, 0x10, 0x52, 0x63, 0xA8, 0xCF, 0xB5, 0xDC, 0xBC, 0x9B, 0xCE, 0xFC, 0xF9, 0x17, 0xD4, 0xA8, 0x87, 0xA7, 0x94, 0x8E, 0x47, 0x47, 0xE5, 0xA3, 0x90, 0x03, 0x35, 0x81, 0xEE, 0x3B, 0x9E, 0x73, 0x3C, 0x67, 0xE5, 0x97, 0x10, 0x17, 0xF0, 0xFC, 0xE9, 0x02, 0x7B, 0x1A, 0x5B, 0x27, 0xDE, 0x0A, 0x5C, 0xD6, 0x21, 0x54, 0xC0, 0xC5, 0x5A, 0x81, 0x3F, 0xF9, 0x2D, 0xFD, 0x2F, 0x4E, 0xB9, 0x6D, 0x4B, 0xA9, 0xB8, 0x53, 0x6E, 0xD7, 0x36, 0xDA, 0x34, 0xFD, 0x6E, 0xE7, 0xF4, 0x64, 0xA7, 0x04, 0x6A, 0x9F, 0x78, 0x8B, 0xA1, 0xB4, 0xB9, 0x94, 0xD8, 0x3F, 0xDD, 0xA4, 0x3D, 0x65, 0x76, 0x98, 0x07, 0xB3, 0x39, 0x06, 0x05, 0xE1, 0x13, 0x6F, 0x3B, 0xDF, 0xCF, 0xF0, 0x7C, 0x5A, 0x94, 0x19, 0x01, 0xED, 0x0C, 0x49, 0x06, 0x20, 0x92, 0xCE, 0xC2, 0xEE, 0xE7, 0xA1, 0xA7, 0xE2, 0x60, 0xEF, 0x56, 0x68, 0xF2, 0x19, 0xCC, 0xE6, 0x45, 0x66, 0xFC, 0x31, 0xA3, 0xEF, 0x72, 0x3E, 0xFF, 0x1A, 0xE3, 0x28, 0x40, 0x75, 0xDE, 0xB5, 0x0A, 0x27, 0xE8, 0x2F, 0x25, 0xD4, 0x3D, 0x0B, 0x1B, 0x8C, 0x70, 0xD7, 0xC3, 0x95, 0x3B, 0xA3, 0x75, 0x75, 0x30, 0x03, 0x08, 0x9E, 0x3A, 0x56, 0xFE, 0x8B, 0x3C, 0xB3, 0x90, 0x33, 0xE1, 0xF0, 0xD3, 0x43, 0x07, 0x5C, 0x42, 0x87, 0xA6, 0x27, 0xD9, 0x8F, 0x9F, 0xEA, 0x2E, 0x53, 0xB4, 0xE3, 0x68, 0x1C, 0xB6, 0xC3, 0xE5, 0x9B, 0xBD, 0x5D, 0x6D, 0x5F, 0xB7, 0x29, 0x47, 0x31, 0x78, 0x6C, 0x95, 0xA7, 0xF2, 0xDD, 0xC6, 0x55, 0x8C, 0x96, 0x78, 0x98, 0xF0, 0xD6, 0x52, 0xB7, 0x17, 0x99, 0x05, 0x3D, 0x42, 0x36, 0x7B, 0x38, 0x71, 0xD7, 0xC3, 0xD5, 0x2F, 0xC9, 0x38, 0x11, 0x57, 0x32, 0x03, 0x8E, 0xB6, 0xBB, 0xB2, 0x58, 0x3E, 0xC1, 0xFC, 0x02, 0x2E, 0x08, 0xC2, 0x51, 0x78, 0x79, 0x8F, 0x00, 0x76, 0x26, 0x2B, 0x4E, 0x6D, 0x41, 0xAC, 0x29, 0xA8, 0x7A, 0xA3, 0x64, 0x06, 0x41, 0xF8, 0xD4, 0x43, 0x85, 0x2F, 0x32, 0xA7, 0xA1, 0xC7, 0x99, 0xA5, 0x3C, 0x25, 0x70, 0x83, 0x0A, 0xC5, 0x36, 0xAB, 0xA8, 0x9F, 0x59, 0xF1, 0xCB, 0x6C, 0x01, 0x61, 0x5D, 0x5C, 0x8B, 0x10, 0x3B, 0xB0, 0x3E, 0xDF, 0x78, 0x13, 0x98, 0xFE, 0x85, 0x96, 0x61, 0xCF, 0x77, 0x94, 0x66, 0x18, 0x53, 0x6C, 0x5A, 0x3E, 0x27, 0xE3, 0xA3, 0x47, 0x36, 0xC8, 0x69, 0xBB, 0x1D, 0x87, 0x4A, 0x70, 0xBD, 0xC6, 0x22, 0x56, 0x99, 0x93, 0xEA, 0xEE, 0xCA, 0x0C, 0xC8, 0x0C, 0x29, 0x71, 0x45, 0x21, 0x77, 0x94, 0x18, 0x53, 0xC8, 0xAF, 0xC6, 0x25, 0x15, 0xAC, 0x9B, 0x2E, 0x6E, 0x32, 0x3E, 0xFC, 0x44, 0x1E, 0xF1, 0x1D, 0x07, 0x96, 0x48, 0xBB, 0x71, 0xB1, 0x6E, 0xF9, 0x83, 0xA6, 0x13, 0x5E, 0xFB, 0x71, 0x5C, 0x20, 0x3F, 0x25, 0x2E, 0xC4, 0x3C, 0xE6, 0x5C, 0x3F, 0x1F, 0x34, 0x4C, 0x15, 0x99, 0x22, 0x58, 0xC6, 0x83, 0xC2, 0x56, 0x2F, 0x97, 0x56, 0xEB, 0x95, 0xA5, 0x07, 0x1E, 0xA3, 0xF0, 0x14, 0xA2, 0xCB, 0x80, 0x24, 0x32, 0x83, 0x9C, 0xF7, 0xF1, 0x07, 0xE9, 0x70, 0xD1, 0x2A, 0x1C, 0x35, 0x98, 0x8B, 0x61, 0x38, 0x9E, 0xD6, 0x79, 0x02, 0xE2, 0x6E, 0xB6, 0x0E, 0xA7, 0xCA, 0x75, 0xFF, 0xBF, 0xC7, 0x05, 0xD3, 0x88, 0x7E, 0x2A, 0xA5, 0x90, 0x48, 0xDC, 0x09, 0xB1, 0xDB, 0x28, 0x36, 0x99, 0xD6, 0x1A, 0xCE, 0x72, 0x9A, 0x1B, 0x1F, 0x29, 0x8A, 0x5F, 0xFE, 0x0F, 0xF2, 0x78, 0x42, 0x03, 0x56, 0xDF, 0x5D, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
-
-constexpr std::size_t size = sizeof(data);
-
-}  // namespace car_yellow_1
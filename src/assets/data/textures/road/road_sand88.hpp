@@ -4,7 +4,7 @@
 
 namespace road_sand88 {
 
-constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x5C, 0x72, 0xA8, 0x66, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x7D, 0xCB, 0x96, 0x25, 0xC7, 0x71, 0xD8, 0xED, 0xEE, 0x01, 0x44, 0xF9, 0x37, 0xA4, 0x9D, 0xCD, 0x01, 0x08, 0x90, 0x04, 0xA8, 0xE3, 0x8F, 0xB1, 0xBD, 0xB5, 0x8E, 0xF8, 0x14, 0x79, 0xFC, 0x03, 0x3E, 0xE2, 0x9B, 0xD4, 0xC2, 0xBF, 0x21, 0xAD, 0x24, 0x6A, 0xE7, 0x85, 0x6C, 0x00, 0x83, 0x21, 0x29, 0x80, 0x5A, 0x5A, 0x3E, 0xA4, 0xBD, 0xA5, 0xC9, 0x2D, 0x85, 0xE9, 0x87, 0x23, 0x32, 0x23, 0x32, 0x23, 0x23, 0x23, 0x2A, 0xB2, 0x1E, 0xB7, 0xEF, 0xED, 0x3B, 0xD5, 0x20, 0xA7, 0xBB, 0x2A, 0x33, 0x23, 0xE3, 0x1D, 0x91, 0x91, 0x59, 0x55, 0x57, 0x7F, 0xFA, 0x77, 0xFF, 0xF1, 0xE1, 0x70, 0x75, 0xA8, 0x3F, 0x0F, 0xF0, 0xA7, 0x75, 0x3D, 0x7A, 0x5F, 0x80, 0x32, 0xFF, 0x9C, 0x0B, 0x47, 0xF7, 0x67, 0xA0, 0x7C, 0xDF, 0xFB, 0xDD, 0xF4, 0x03, 0x82, 0x1E, 0xA0, 0x23, 0xFF, 0xBA, 0xBA, 0x3A, 0xDC, 0xC2, 0xDF, 0x37, 0x70, 0xEF, 0xC5, 0x7B, 0x3F, 0x3C, 0x3C, 0xBB, 0x7A, 0xF3, 0x70, 0xF7, 0xF0, 0x19, 0xB4, 0x53, 0x87, 0x88, 0x86, 0x27, 0xD2, 0x7E, 0x05, 0x04, 0x3F, 0xC0, 0x7F, 0xFC, 0x83, 0xD7, 0xC0, 0x88, 0x74, 0x79, 0x07, 0x7F, 0xBE, 0xF1, 0x70, 0x73, 0x78, 0xFB, 0xC5, 0x57, 0xE1, 0xEE, 0xF5, 0xE1, 0x1A, 0x6E, 0x23, 0x8B, 0xD2, 0x4F, 0x92, 0x3F, 0x5D, 0x28, 0xFE, 0x16, 0xD5, 0xD0, 0x7C, 0x1F, 0x95, 0x4B, 0x24, 0xFF, 0xD1, 0xF6, 0xC1, 0xF9, 0x93, 0xD8, 0x41, 0xAE, 0xC8, 0x87, 0xC4, 0x0F, 0xB8, 0x81, 0xD7, 0xAF, 0xAE, 0x0F, 0x87, 0x37, 0xEF, 0x0F, 0x87, 0x0F, 0xDE, 0xFB, 0x01, 0xC8, 0xFF, 0xE6, 0x70, 0x7F, 0xB8, 0xCB, 0x14, 0x54, 0x76, 0x09, 0x6E, 0x09, 0xBE, 0x88, 0xF6, 0x27, 0xA2, 0x06, 0x2E, 0x9A, 0xA8, 0xEE, 0x57, 0xC5, 0x01, 0x8C, 0x30, 0xB4, 0x6A, 0x52, 0xC3, 0xA8, 0x49, 0x87, 0x31, 0x64, 0xA0, 0x2D, 0xE3, 0x7B, 0xCE, 0x0B, 0xA7, 0x24, 0xE1, 0x69, 0x7C, 0xAA, 0x7E, 0x57, 0x63, 0x2F, 0x1A, 0x9D, 0x1D, 0xC0, 0xE1, 0x01, 0xA9, 0x3E, 0x80, 0xC0, 0xE1, 0xFF, 0xF7, 0x77, 0x87, 0x5F, 0xBE, 0xFF, 0x63, 0x50, 0x88, 0x37, 0x0E, 0xF7, 0x57, 0xAF, 0x5A, 0x9A, 0x8E, 0x28, 0x5D, 0x89, 0xE6, 0xB1, 0xA6, 0xD1, 0x73, 0xF0, 0x35, 0x1B, 0xF0, 0xFD, 0xF5, 0x15, 0x38, 0x80, 0xAB, 0xC3, 0x5B, 0x1F, 0x7C, 0xF5, 0x70, 0x0D, 0x06, 0x50, 0xFA, 0x93, 0xA3, 0x94, 0x86, 0x20, 0x71, 0x4C, 0xE3, 0xE7, 0x12, 0x20, 0x27, 0x9F, 0x32, 0xF0, 0x35, 0xCC, 0x60, 0xC2, 0xA4, 0x81, 0x16, 0xBF, 0x4F, 0x0E, 0xA0, 0x20, 0x7F, 0x38, 0xDC, 0x82, 0x03, 0xB8, 0x79, 0x75, 0x7B, 0xF8, 0xF8, 0xCF, 0x7E, 0x02, 0xF4, 0x5C, 0x03, 0x49, 0xF7, 0x99, 0xE4, 0xA4, 0x26, 0x19, 0x61, 0x05, 0xCA, 0x63, 0xC9, 0x1A, 0xAC, 0x1F, 0x6D, 0xAC, 0x29, 0xB2, 0xE4, 0x00, 0xFE, 0x1E, 0x32, 0x00, 0xF6, 0x7C, 0x32, 0xF2, 0x6B, 0xD4, 0x3C, 0xC1, 0x79, 0x24, 0x78, 0x91, 0x7B, 0xB4, 0x7F, 0x34, 0x3E, 0xCA, 0x0C, 0x9A, 0x88, 0x54, 0x33, 0x80, 0x7C, 0xFB, 0x0A, 0xFC, 0x3D, 0xC6, 0xBD, 0x87, 0xC3, 0xCB, 0xF7, 0x7F, 0x04, 0xBF, 0x9F, 0xC1, 0x35, 0x64, 0x00, 0xCC, 0x87, 0x47, 0x13, 0xCB, 0xCC, 0x89, 0x86, 0x0D, 0xCF, 0xEE, 0x98, 0xC5, 0x9B, 0xFF, 0xBD, 0xBB, 0x7A, 0x00, 0x07, 0x70, 0x7D, 0x78, 0xEB, 0xA3, 0xAF, 0x1E, 0x6E, 0xE0, 0x3F, 0xD3, 0x01, 0xD0, 0x4D, 0x4E, 0x8C, 0xF0, 0x77, 0xF9, 0x59, 0x2A, 0x9F, 0x88, 0xE4, 0x28, 0x10, 0x35, 0x72, 0x9D, 0x00, 0x46, 0x70, 0xDA, 0x0C, 0xA0, 0xD2, 0x8F, 0x19, 0xE0, 0x1B, 0xD0, 0xE7, 0x05, 0xC8, 0x1F, 0x79, 0xF2, 0x90, 0x34, 0xA2, 0x24, 0x8A, 0xCA, 0xD8, 0x99, 0x11, 0xD8, 0x61, 0x62, 0xCE, 0x61, 0xF9, 0x38, 0x30, 0xBC, 0xF1, 0xDA, 0x81, 0xEA, 0xE1, 0xD1, 0xBC, 0xDE, 0xF8, 0xE4, 0x00, 0x78, 0x09, 0xE0, 0x45, 0xEA, 0x53, 0xDC, 0x67, 0x02, 0xAD, 0xC8, 0x31, 0x8A, 0x4F, 0xC3, 0x24, 0x72, 0x00, 0x49, 0xFE, 0x59, 0x8B, 0x31, 0x03, 0x38, 0x3C, 0xDC, 0x1F, 0x5E, 0xBE, 0xF7, 0xA3, 0x94, 0x01, 0x3C, 0x1C, 0x20, 0x03, 0xA0, 0x1F, 0x9D, 0x3A, 0x47, 0x3A, 0x5B, 0x56, 0x0E, 0x4A, 0x4F, 0xA4, 0xE1, 0xA4, 0xF4, 0xDA, 0x11, 0x54, 0x09, 0x5E, 0xBA, 0x5D, 0x5C, 0xA7, 0x3F, 0xBD, 0x76, 0xDD, 0x4F, 0x4C, 0xD5, 0xFB, 0xF4, 0xDC, 0xF9, 0x0E, 0x90, 0x43, 0x03, 0x78, 0x1B, 0x1C, 0xC0, 0x75, 0x72, 0x00, 0x68, 0x04, 0xCA, 0x02, 0x50, 0x41, 0x1A, 0x43, 0x32, 0x1C, 0xC0, 0x94, 0x3C, 0xE6, 0xCA, 0xD1, 0x63, 0xF4, 0x5C, 0x05, 0xB7, 0xF4, 0x46, 0x48, 0x17, 0xFF, 0xBC, 0xC3, 0x0C, 0xE0, 0xEE, 0xEE, 0xF0, 0xD1, 0x7B, 0x90, 0x01, 0x5E, 0xC3, 0x45, 0xD6, 0x08, 0xA2, 0xB7, 0xEA, 0x4B, 0xE3, 0xE7, 0xA4, 0x1A, 0xA5, 0xCE, 0xE4, 0x30, 0x68, 0x3E, 0x29, 0x9F, 0xC4, 0x77, 0xA7, 0xBD, 0x90, 0xC3, 0xFA, 0x22, 0xF0, 0x6D, 0x12, 0xB0, 0x89, 0xF6, 0x8C, 0xAC, 0x3F, 0x3F, 0xB7, 0xA7, 0x8C, 0x46, 0x28, 0x41, 0x59, 0xE6, 0xD1, 0xF8, 0xEA, 0x00, 0x92, 0xF0, 0x8B, 0x05, 0xB4, 0x7F, 0xD3, 0x6D, 0x46, 0xAE, 0x51, 0x64, 0xA9, 0x61, 0xC1, 0xF8, 0x0E, 0xBE, 0xD6, 0x4E, 0x6B, 0x3C, 0x21, 0x9A, 0x50, 0xD0, 0xED, 0xDE, 0x78, 0xD5, 0xB5, 0x59, 0xDB, 0x13, 0x37, 0x1E, 0x40, 0x5A, 0x0F, 0x0F, 0x77, 0x87, 0x97, 0x5F, 0xF9, 0x09, 0x34, 0x63, 0x2E, 0x70, 0x4B, 0x64, 0x11, 0xD0, 0x92, 0x0F, 0x1A, 0xD7, 0x92, 0x8B, 0xCC, 0xDD, 0xA6, 0x3F, 0x5C, 0x14, 0x5C, 0x2D, 0x78, 0xBA, 0x3D, 0xBA, 0x66, 0x82, 0x58, 0x9A, 0x06, 0xFC, 0x62, 0xBC, 0xA8, 0x15, 0xCA, 0x92, 0x84, 0x63, 0xCA, 0x2D, 0x40, 0x2D, 0xE8, 0xFC, 0x1F, 0xDD, 0xDF, 0x1C, 0x9E, 0x43, 0x0D, 0xE0, 0x19, 0x64, 0x02, 0xF9, 0x2E, 0xC1, 0x15, 0x86, 0xCF, 0x6C, 0x4F, 0x20, 0x70, 0x7A, 0x96, 0x87, 0x9C, 0x83, 0xE5, 0x30, 0x57, 0xFE, 0x52, 0xB6, 0x52, 0xBE, 0x0A, 0xFD, 0xB2, 0xC4, 0x9C, 0x0B, 0x5F, 0x3A, 0x82, 0x62, 0x11, 0x19, 0xF8, 0x2D, 0xC8, 0xED, 0x19, 0x38, 0x80, 0x17, 0x20, 0xFF, 0x0C, 0xFF, 0x9E, 0x32, 0x80, 0x9E, 0x98, 0x0C, 0x86, 0x26, 0x4F, 0xF2, 0x36, 0xE4, 0xD5, 0x59, 0x23, 0xDB, 0x92, 0xB2, 0xBE, 0x32, 0x5E, 0x59, 0x37, 0x7B, 0x0F, 0xB3, 0x7D, 0x5A, 0xFE, 0x2C, 0x9B, 0xBC, 0x7E, 0x51, 0xDE, 0x48, 0x5B, 0xBF, 0xC2, 0x5F, 0x64, 0x00, 0x28, 0x75, 0x92, 0x32, 0x0B, 0xA0, 0x48, 0x9B, 0x10, 0x28, 0x0C, 0x45, 0x06, 0x04, 0x5A, 0x52, 0x5C, 0xA7, 0x40, 0x28, 0xC1, 0x93, 0xCC, 0x13, 0xDA, 0x44, 0x6B, 0xF3, 0x5A, 0x89, 0x82, 0xB6, 0x34, 0x94, 0x27, 0xC5, 0x6B, 0x76, 0x79, 0x02, 0x1F, 0xD6, 0x8E, 0x26, 0xC2, 0x2A, 0x0B, 0x10, 0xE3, 0xD0, 0xF0, 0x93, 0xAC, 0xF0, 0x3F, 0xD0, 0xE8, 0x9F, 0x63, 0x04, 0xB8, 0x7A, 0x06, 0xD3, 0xE4, 0x1A, 0x00, 0x16, 0x88, 0x12, 0x96, 0xA4, 0xEC, 0x09, 0x52, 0xA7, 0x48, 0xAD, 0x86, 0x0A, 0x0C, 0x95, 0xEA, 0x66, 0xA4, 0xE4, 0xF0, 0x16, 0xB3, 0xC2, 0x24, 0xAD, 0xF2, 0xCD, 0x75, 0x04, 0x7F, 0x72, 0x30, 0xEB, 0xAD, 0x64, 0x19, 0x10, 0x7A, 0x0F, 0x74, 0x62, 0xDC, 0x7F, 0xE7, 0xA3, 0xAF, 0x25, 0x5A, 0x6F, 0xD2, 0x82, 0x88, 0xE4, 0x2A, 0x3C, 0x48, 0x35, 0x07, 0xA0, 0xC3, 0xD3, 0x0F, 0x76, 0x88, 0x1A, 0x51, 0x53, 0x7F, 0x04, 0x07, 0xA2, 0xF6, 0x44, 0x18, 0xE9, 0x59, 0xD1, 0x0F, 0xD2, 0xA1, 0xA2, 0xA3, 0xC2, 0x20, 0x85, 0xAD, 0x25, 0x12, 0x26, 0xF0, 0xB9, 0xBD, 0x39, 0x1C, 0x9E, 0xBD, 0xBA, 0x4F, 0x0E, 0x00, 0xE9, 0xBE, 0x86, 0x54, 0x27, 0x93, 0x91, 0xE9, 0xCC, 0xC5, 0x42, 0xFC, 0x4D, 0xD7, 0x82, 0xC9, 0x15, 0x6C, 0x2E, 0x2C, 0x32, 0x46, 0xBD, 0x9C, 0xC6, 0xE4, 0xAF, 0xF5, 0xC3, 0x42, 0xDB, 0x22, 0x27, 0x7B, 0xFA, 0x69, 0xFD, 0xD2, 0xF8, 0x31, 0x19, 0xC5, 0x97, 0xFE, 0x09, 0x2E, 0x01, 0x0A, 0x33, 0x49, 0x4B, 0xE4, 0xB5, 0xE4, 0x77, 0xD5, 0x86, 0xDC, 0x63, 0x88, 0xE1, 0x04, 0x4C, 0x52, 0xA0, 0x0D, 0xCA, 0xF2, 0xEC, 0xDA, 0xF0, 0x5C, 0x81, 0x2A, 0x9C, 0xA5, 0x35, 0x38, 0xF8, 0x26, 0x23, 0xBF, 0x87, 0xC2, 0x0F, 0x08, 0xF9, 0x1F, 0xDF, 0xFF, 0xDE, 0xE1, 0x8F, 0x71, 0x17, 0x00, 0x1D, 0x40, 0x62, 0x28, 0x46, 0x43, 0x72, 0x52, 0x49, 0x03, 0x90, 0x4E, 0xEF, 0xBA, 0x22, 0x99, 0xD7, 0x9A, 0x38, 0x34, 0x2B, 0x6C, 0xB9, 0x66, 0x05, 0xA1, 0xEA, 0x73, 0x46, 0x8F, 0x94, 0x8D, 0xF8, 0x20, 0x97, 0x10, 0xA5, 0x00, 0x25, 0x9C, 0x11, 0xF7, 0xD7, 0x4B, 0x8A, 0xEC, 0xAB, 0x32, 0x90, 0xBA, 0xD6, 0xCD, 0x2B, 0x5A, 0xBD, 0xE4, 0xC8, 0x5D, 0x05, 0x43, 0xE0, 0xEF, 0xFB, 0xBB, 0x87, 0xC3, 0x7B, 0x2F, 0xBE, 0x99, 0x96, 0x03, 0x37, 0x24, 0x83, 0xB6, 0xF4, 0x25, 0x99, 0x29, 0xE4, 0xA8, 0xF5, 0x83, 0x75, 0xC4, 0xD3, 0x0F, 0xE5, 0x8F, 0x5D, 0x7D, 0xD3, 0xD3, 0x79, 0x96, 0x20, 0xE7, 0x37, 0x61, 0x93, 0xB2, 0x48, 0x3D, 0xC3, 0x0C, 0x1F, 0x45, 0x0B, 0xB4, 0xE6, 0xE5, 0x0E, 0x2C, 0x81, 0xA0, 0xF0, 0xFF, 0xDF, 0xDF, 0xFF, 0xAB, 0xC3, 0xBF, 0xB9, 0x79, 0x03, 0x76, 0x81, 0x6E, 0x89, 0x97, 0xAD, 0x43, 0x29, 0x7C, 0x15, 0x11, 0xC1, 0x92, 0x03, 0xCB, 0xBB, 0xEA, 0x81, 0xE4, 0x37, 0x3B, 0x94, 0xCA, 0x20, 0x29, 0x9F, 0xB4, 0x4B, 0xE1, 0xC0, 0x67, 0x23, 0xE3, 0xDD, 0x8B, 0x62, 0x06, 0x8D, 0x3E, 0x8D, 0xC3, 0x97, 0x05, 0xCE, 0xC4, 0x09, 0xAC, 0x01, 0x54, 0xDB, 0xA2, 0xAD, 0x12, 0x56, 0xAB, 0xAA, 0xC5, 0xA6, 0x33, 0x2D, 0x5B, 0x2B, 0x45, 0x0D, 0xB3, 0x64, 0xB4, 0x1E, 0x54, 0x35, 0x6D, 0x83, 0x69, 0x26, 0x3A, 0xF7, 0x8E, 0xBC, 0x9E, 0x6C, 0x8F, 0xE0, 0xB3, 0x7E, 0x74, 0xBA, 0x01, 0xF3, 0x25, 0x5A, 0x91, 0xE1, 0x68, 0x00, 0x50, 0xF8, 0xF9, 0xC5, 0x7B, 0x3F, 0x49, 0xDB, 0x80, 0xB7, 0x0F, 0xFF, 0xDA, 0xAA, 0x9F, 0xB0, 0xF9, 0xDA, 0xD0, 0x46, 0x6C, 0x16, 0x8A, 0x61, 0x26, 0xC2, 0x5A, 0xA4, 0x97, 0xF4, 0x7B, 0xF6, 0xD1, 0x43, 0x5B, 0x95, 0x35, 0x76, 0x2C, 0x83, 0x90, 0xFC, 0xC0, 0x79, 0xF0, 0xFF, 0xD7, 0x37, 0x10, 0xFF, 0xC1, 0x28, 0x3E, 0xFF, 0xC1, 0x9F, 0x03, 0xFD, 0x6F, 0x88, 0xE4, 0x4F, 0x70, 0x4D, 0x80, 0x4F, 0xF8, 0xE9, 0xEB, 0x64, 0x46, 0xB9, 0x76, 0xA0, 0x7D, 0x7A, 0xC2, 0xDE, 0x90, 0x6F, 0x1B, 0xED, 0x2A, 0x40, 0x33, 0x0A, 0x92, 0x92, 0x6B, 0xDF, 0x5F, 0xE4, 0x4F, 0xEA, 0xE3, 0xB6, 0x4B, 0x96, 0x25, 0xB2, 0x88, 0x36, 0x94, 0xFD, 0x33, 0x80, 0x02, 0x4B, 0x80, 0x97, 0x90, 0x01, 0xDE, 0x5C, 0xC3, 0x2E, 0xD0, 0x83, 0xD8, 0x05, 0x22, 0xBC, 0xA5, 0x7C, 0xC9, 0xCD, 0x0A, 0xED, 0xD6, 0x46, 0xD7, 0xCB, 0x87, 0xED, 0x63, 0x44, 0x3F, 0x96, 0xC8, 0x7F, 0x0E, 0xFC, 0x8C, 0x43, 0xAF, 0x2F, 0x57, 0xCF, 0x5F, 0x7E, 0xBD, 0x24, 0xD9, 0xFD, 0xBE, 0x71, 0x1D, 0x96, 0x8D, 0xD4, 0xDE, 0x57, 0xAE, 0x01, 0xBC, 0xB2, 0x89, 0xFB, 0x33, 0xD3, 0xF3, 0xD4, 0xBA, 0xBD, 0x87, 0x2F, 0x56, 0x5B, 0x46, 0xFF, 0xCA, 0x26, 0x1B, 0x9E, 0x6E, 0xB7, 0x96, 0xC3, 0x99, 0x06, 0x5C, 0x03, 0x5F, 0xDF, 0xC3, 0x12, 0xE0, 0xF3, 0xDF, 0xAB, 0x0A, 0x60, 0x4B, 0xA1, 0xC8, 0x0F, 0xF1, 0xBF, 0xC3, 0x74, 0xD1, 0x97, 0xA8, 0x6A, 0x89, 0x42, 0x98, 0x06, 0x14, 0xF5, 0x0F, 0x10, 0xEC, 0xF0, 0xEA, 0xFB, 0xB3, 0xF1, 0xE0, 0xA6, 0xD7, 0x33, 0xA0, 0xE4, 0xF9, 0x27, 0xDF, 0x80, 0xF4, 0xFF, 0x0D, 0x91, 0xCD, 0x55, 0x07, 0x60, 0xCD, 0xD6, 0x3A, 0x62, 0x5B, 0x9E, 0x55, 0xD5, 0x7A, 0x7D, 0x69, 0xCF, 0x25, 0xB4, 0xF2, 0x59, 0xAF, 0x5F, 0x95, 0x01, 0x52, 0x3F, 0x28, 0x27, 0x12, 0x81, 0x09, 0xCE, 0x81, 0xC0, 0x12, 0xE0, 0xE6, 0x16, 0x8A, 0xC0, 0x6F, 0x7D, 0x2F, 0x6D, 0x83, 0x3E, 0x60, 0x06, 0x40, 0x19, 0x5F, 0x75, 0x46, 0x2D, 0xFE, 0x7D, 0x98, 0x8A, 0xE4, 0x17, 0x29, 0xCA, 0x5C, 0x79, 0xAF, 0x95, 0xBF, 0xA1, 0x0F, 0x6F, 0x81, 0x03, 0x60, 0x06, 0xB1, 0x89, 0xAB, 0x38, 0x9D, 0x4C, 0xB7, 0x7A, 0x1B, 0xED, 0xEF, 0x8F, 0x7D, 0xCD, 0x4C, 0x1C, 0x9D, 0x47, 0x30, 0x5D, 0x87, 0x15, 0xD1, 0x84, 0xDB, 0x60, 0x78, 0xF8, 0xE5, 0xE7, 0xCF, 0xBF, 0x07, 0xD4, 0x3D, 0x83, 0x6C, 0x00, 0x22, 0xC0, 0x5C, 0xFE, 0x46, 0xF2, 0xDD, 0xBC, 0x3D, 0x46, 0xD0, 0xEB, 0xA1, 0x23, 0xF4, 0x3D, 0xDC, 0x48, 0x35, 0x80, 0x4F, 0xBE, 0x0D, 0xFF, 0x82, 0x4B, 0x4B, 0xE5, 0xFE, 0x1A, 0x24, 0x52, 0xF4, 0x13, 0x6B, 0x3C, 0xCA, 0x9D, 0xA6, 0xE2, 0x3D, 0x45, 0xC7, 0x51, 0x39, 0xE9, 0x68, 0x34, 0x77, 0xDC, 0xD2, 0xFE, 0x99, 0xCC, 0xBB, 0x67, 0xE0, 0x00, 0x41, 0xE4, 0x2F, 0xDE, 0xFA, 0x2E, 0xD0, 0x0E, 0xF4, 0xC3, 0x8E, 0x10, 0x92, 0x9B, 0xD9, 0xD0, 0xC6, 0xFB, 0x2E, 0x93, 0xDC, 0x5C, 0xAE, 0xA7, 0x03, 0x78, 0x95, 0x1D, 0x00, 0xFF, 0xB4, 0xFE, 0x5D, 0xC7, 0xE7, 0xF6, 0xBA, 0x32, 0x2A, 0xDF, 0x2F, 0x89, 0x19, 0x01, 0x9B, 0x7B, 0xAD, 0xE1, 0x8D, 0xC3, 0xAF, 0xDE, 0x9E, 0x35, 0x58, 0xE3, 0xD3, 0xD3, 0x85, 0xE7, 0xBE, 0xE0, 0x2C, 0x0C, 0x38, 0x80, 0xEF, 0xE3, 0x39, 0x38, 0x58, 0x03, 0x3E, 0x05, 0x07, 0x30, 0x4F, 0x51, 0xAC, 0x68, 0xCD, 0x10, 0xD0, 0x01, 0x3C, 0x83, 0x93, 0x80, 0xCF, 0x3F, 0x85, 0x0C, 0x00, 0x8A, 0xA0, 0x5C, 0xF5, 0xC4, 0xBA, 0x88, 0xFC, 0xA9, 0xD9, 0x5D, 0x34, 0x77, 0x24, 0xEF, 0x48, 0x9E, 0xCB, 0xE5, 0x1F, 0xEB, 0x1F, 0x71, 0xA2, 0xD4, 0x74, 0xF0, 0x20, 0x10, 0xD4, 0x00, 0x20, 0x03, 0xFC, 0x18, 0x02, 0x40, 0xD6, 0x9A, 0xBC, 0x0D, 0x28, 0xEA, 0x9F, 0x11, 0xC1, 0x17, 0xD1, 0x0E, 0x0E, 0xE0, 0x1B, 0x20, 0x63, 0xE9, 0x8D, 0xFB, 0x75, 0xC2, 0x34, 0xA5, 0xF1, 0x4A, 0xA4, 0x1D, 0x6F, 0xC1, 0x9F, 0x9A, 0x33, 0xC6, 0xA7, 0xC7, 0x60, 0x7A, 0x0E, 0x6C, 0x4D, 0x11, 0x0D, 0x14, 0xE2, 0x97, 0xFF, 0xEE, 0xFB, 0x87, 0x07, 0x50, 0x86, 0x9C, 0x02, 0xC6, 0x0A, 0x10, 0x75, 0xD9, 0xBA, 0x7D, 0x89, 0x4B, 0x1E, 0xD1, 0xCC, 0x7B, 0x88, 0x7A, 0x90, 0xF8, 0x1E, 0xBE, 0xF0, 0xE9, 0x5F, 0x26, 0x07, 0xC8, 0x3F, 0x69, 0xDD, 0x9E, 0x7E, 0xE4, 0xC1, 0x61, 0x69, 0x62, 0xBD, 0x4B, 0x98, 0xA7, 0x01, 0xB1, 0x3C, 0xB5, 0xBE, 0xB4, 0xB9, 0x88, 0xA6, 0x2E, 0x9A, 0x5D, 0xCC, 0x27, 0x98, 0x79, 0x07, 0x55, 0xCF, 0x67, 0xE0, 0x05, 0x5F, 0xC0, 0x12, 0x30, 0xCB, 0x5D, 0x66, 0x00, 0xD5, 0x22, 0x1A, 0x77, 0x48, 0x19, 0x82, 0xE4, 0x80, 0xCE, 0x0E, 0x8E, 0x29, 0xFF, 0xC8, 0x45, 0x5A, 0xED, 0x9A, 0x5B, 0xDD, 0xA2, 0x03, 0x6B, 0x00, 0x23, 0x0A, 0x73, 0x8C, 0x3E, 0x16, 0xB3, 0x64, 0x1C, 0x89, 0x98, 0x39, 0x8E, 0x53, 0x86, 0xC4, 0xFF, 0xE2, 0xEF, 0x9C, 0x01, 0xC0, 0x49, 0xC0, 0xCF, 0x43, 0x06, 0x80, 0x67, 0xC1, 0x2F, 0x3C, 0x03, 0x60, 0x5E, 0x31, 0x7F, 0xF3, 0x12, 0xE0, 0x1A, 0x1C, 0xC0, 0xB7, 0xD2, 0x41, 0xA0, 0xB2, 0x33, 0x51, 0xB4, 0xC8, 0x56, 0x8B, 0xED, 0x64, 0x32, 0x2E, 0xBD, 0xA9, 0x9E, 0x9D, 0x42, 0x0B, 0x1F, 0x5E, 0x97, 0x3D, 0xF5, 0x28, 0x70, 0xDA, 0x06, 0x86, 0x1F, 0xAC, 0x01, 0xBD, 0x09, 0x24, 0xBE, 0x48, 0x4B, 0xC0, 0x7C, 0x26, 0x64, 0x24, 0x00, 0x6C, 0x83, 0xF5, 0xF9, 0x40, 0xC9, 0x4B, 0x80, 0x6E, 0x7F, 0x1D, 0x98, 0xA4, 0x52, 0xC1, 0x79, 0x28, 0x6F, 0xAC, 0x26, 0xF5, 0xA0, 0x96, 0x83, 0x46, 0xAF, 0x06, 0x39, 0x2E, 0x48, 0xB5, 0xAF, 0x7E, 0x1B, 0x75, 0x20, 0xEF, 0x79, 0x3F, 0x1C, 0x7E, 0x01, 0x0E, 0xE0, 0xEA, 0x1A, 0x6A, 0x00, 0xE8, 0x00, 0x8C, 0x9F, 0x29, 0x05, 0x5B, 0xE2, 0x91, 0xAD, 0x44, 0x59, 0x9A, 0x9A, 0x76, 0x80, 0x8C, 0x12, 0x2F, 0x4D, 0xD3, 0x8E, 0x64, 0xD5, 0xEC, 0xB2, 0x43, 0xA9, 0x0D, 0x3C, 0x92, 0x17, 0x9F, 0x03, 0x78, 0x3B, 0x39, 0x00, 0x3C, 0x0B, 0x2F, 0x44, 0xCE, 0xDB, 0x9E, 0x0E, 0x3F, 0x22, 0xD8, 0x6E, 0xFB, 0xC6, 0x6A, 0x31, 0x8E, 0x07, 0x4D, 0x9C, 0x7E, 0x61, 0x18, 0x47, 0x07, 0x00, 0x19, 0x00, 0xD8, 0x7C, 0x5A, 0x02, 0x24, 0xFD, 0x6F, 0x33, 0x00, 0x0D, 0xBB, 0xC9, 0x7B, 0x04, 0xFF, 0x9B, 0x25, 0x83, 0xB8, 0xDF, 0x6C, 0x07, 0x12, 0x30, 0x79, 0x74, 0x86, 0x77, 0xFD, 0x9A, 0x79, 0x26, 0xC6, 0x4B, 0xF9, 0x23, 0xFE, 0x1A, 0xBE, 0xCE, 0xCB, 0x74, 0x4E, 0xDF, 0xE8, 0x87, 0xD4, 0x9F, 0xEC, 0x00, 0x84, 0xDB, 0x64, 0x64, 0xE1, 0x77, 0x31, 0xA0, 0x23, 0xB4, 0x9B, 0x84, 0x8B, 0x9B, 0x4D, 0xA2, 0x38, 0x39, 0x3F, 0x0A, 0x94, 0xF6, 0xC1, 0x05, 0x95, 0xF2, 0x6C, 0x4A, 0x29, 0x62, 0x16, 0xC2, 0x71, 0x0B, 0x30, 0xD3, 0xF7, 0x12, 0x14, 0x00, 0xCF, 0xC2, 0x5F, 0x72, 0x0D, 0xA0, 0x3A, 0xC2, 0xCA, 0x60, 0x7C, 0x18, 0xE8, 0x06, 0xD2, 0x80, 0x2F, 0xFC, 0xEA, 0x9B, 0xC0, 0x07, 0xF5, 0x2C, 0x80, 0xE5, 0x37, 0xE9, 0x9E, 0xE9, 0xA0, 0x06, 0xF4, 0x43, 0x2B, 0xFC, 0xB8, 0x7C, 0xB3, 0xA0, 0x4C, 0x83, 0x99, 0xF0, 0x00, 0x0C, 0x3F, 0xFD, 0xA6, 0x7D, 0xF6, 0x74, 0xFE, 0x83, 0x1A, 0xF0, 0x59, 0x00, 0xCC, 0x00, 0x3E, 0x32, 0x32, 0x80, 0xC8, 0xE9, 0x8F, 0x3B, 0x9E, 0xF3, 0xEF, 0xA9, 0x8A, 0x80, 0xE7, 0x8F, 0x70, 0x8F, 0xA1, 0x17, 0x56, 0xE4, 0x7D, 0xF1, 0x37, 0x9D, 0x3B, 0xA0, 0x67, 0xBF, 0x60, 0x1B, 0x10, 0x8B, 0x80, 0xF8, 0x38, 0xA8, 0x78, 0x16, 0x80, 0x14, 0x4E, 0x46, 0x78, 0xAD, 0xF8, 0x8D, 0x82, 0x79, 0x8E, 0x8B, 0xFC, 0xAA, 0x34, 0xC0, 0xB9, 0x2B, 0xE0, 0x63, 0x49, 0xE4, 0x1E, 0xCE, 0xBF, 0xE3, 0x36, 0xE8, 0x3B, 0xE8, 0x00, 0x1E, 0x9E, 0xD1, 0x0E, 0x18, 0xA6, 0x17, 0xED, 0x8C, 0x96, 0x31, 0x1C, 0x0B, 0xA7, 0xE3, 0xC1, 0x15, 0x19, 0x00, 0x85, 0xB5, 0xF4, 0x2C, 0x00, 0xD0, 0x8F, 0x35, 0x80, 0xEB, 0xE4, 0x20, 0x44, 0x06, 0x20, 0x88, 0xE6, 0xF3, 0x43, 0x5E, 0xA4, 0xD6, 0xFC, 0x3A, 0x17, 0xF9, 0x8E, 0xF2, 0xD2, 0x76, 0x00, 0x9E, 0x4D, 0x19, 0x0A, 0x3D, 0x3A, 0x51, 0x14, 0xF1, 0x67, 0xC1, 0x11, 0xF8, 0x59, 0x2B, 0x55, 0x3E, 0xC2, 0xC9, 0xEB, 0x7E, 0xB9, 0x0F, 0x9C, 0x0A, 0x4A, 0x30, 0x1E, 0x64, 0x0F, 0xBF, 0x73, 0x0D, 0xE0, 0x06, 0x6A, 0x00, 0x97, 0x9E, 0x01, 0x68, 0xC5, 0xCC, 0xBB, 0x00, 0xD7, 0x87, 0xB7, 0x7F, 0x35, 0x51, 0x03, 0x30, 0xF4, 0xC0, 0xCA, 0x26, 0xA6, 0x64, 0xD7, 0x97, 0x0C, 0x29, 0xF5, 0x9A, 0x51, 0x79, 0x9A, 0x6B, 0x54, 0x3A, 0xFD, 0x95, 0x19, 0x00, 0x1F, 0x66, 0x4A, 0x4B, 0x20, 0x30, 0xFA, 0x8F, 0x53, 0x0D, 0x08, 0x32, 0x42, 0xA3, 0x06, 0x20, 0x32, 0xE5, 0x8B, 0xDD, 0x1C, 0xA0, 0x1A, 0x80, 0xB0, 0x6C, 0x1D, 0xDA, 0xA6, 0x04, 0xA5, 0x39, 0xE4, 0x5D, 0x7B, 0x1A, 0x32, 0xE1, 0x68, 0xD2, 0x90, 0x48, 0x02, 0x5E, 0xAE, 0x96, 0xEE, 0xE7, 0xA5, 0x41, 0x96, 0x9C, 0xCA, 0x06, 0xE0, 0x32, 0x1D, 0xE8, 0x01, 0x6D, 0xF8, 0x18, 0xB6, 0x01, 0x71, 0x1B, 0x2C, 0xAA, 0x01, 0x4C, 0x65, 0x00, 0x53, 0xE4, 0xE9, 0x36, 0x2F, 0x73, 0xE0, 0x7E, 0x56, 0x3D, 0x40, 0xB6, 0x35, 0x94, 0x28, 0xFA, 0xE7, 0x18, 0x0A, 0x9E, 0x84, 0xC4, 0xD2, 0xCA, 0x3B, 0x50, 0x03, 0x78, 0x48, 0xE5, 0x40, 0x62, 0x55, 0x02, 0x22, 0x0B, 0x0D, 0x7D, 0x46, 0x50, 0xEE, 0xCC, 0x95, 0x0F, 0x0F, 0x8C, 0xC6, 0xB1, 0xF0, 0xCB, 0x11, 0x6C, 0x46, 0x4E, 0x71, 0xB3, 0x9C, 0xA1, 0xA6, 0xFB, 0x6E, 0xEE, 0x2E, 0x32, 0x00, 0xAE, 0x01, 0xC0, 0x2E, 0xC0, 0x9B, 0xB0, 0xF1, 0xF3, 0x21, 0x2E, 0x01, 0xB8, 0x06, 0x40, 0x9A, 0xE2, 0x56, 0x03, 0x5D, 0xF8, 0xBD, 0x06, 0x58, 0x72, 0xD6, 0xA6, 0xE4, 0x39, 0x53, 0xE9, 0x34, 0xB5, 0x4C, 0xA7, 0xF4, 0x03, 0xB1, 0x30, 0x1D, 0xAE, 0x40, 0xAF, 0x69, 0x47, 0x13, 0xB1, 0x8B, 0x80, 0xDA, 0x21, 0x50, 0x4E, 0xEC, 0x1A, 0xFC, 0x39, 0xB6, 0x23, 0x75, 0x48, 0x87, 0x10, 0x45, 0xC1, 0x1F, 0x4F, 0xF4, 0x61, 0x15, 0x3C, 0x57, 0x81, 0x9F, 0xBD, 0x76, 0x35, 0x00, 0x88, 0x78, 0x60, 0x5C, 0x37, 0x90, 0x01, 0xE4, 0x1A, 0x00, 0x2C, 0x01, 0x72, 0x59, 0x54, 0xD8, 0x3E, 0xA6, 0x48, 0x59, 0x0F, 0xE4, 0xD9, 0xF7, 0xEE, 0xDC, 0xAF, 0x15, 0x30, 0x46, 0x03, 0x83, 0x90, 0x47, 0xF3, 0xF4, 0x55, 0x37, 0x9E, 0xF4, 0xAB, 0x38, 0x90, 0x71, 0x7D, 0xE3, 0xB3, 0xFC, 0x65, 0xF1, 0x4F, 0xF8, 0xDE, 0x41, 0x0D, 0xE4, 0x19, 0xA4, 0x81, 0x1F, 0x3D, 0xFF, 0x6E, 0x72, 0x7F, 0xF2, 0x8D, 0x40, 0x73, 0xE3, 0x98, 0x17, 0x00, 0x9E, 0xC2, 0xFD, 0xE9, 0x0C, 0x40, 0x7B, 0x6C, 0xCF, 0x83, 0x47, 0x1C, 0x0B, 0xDB, 0xB5, 0x80, 0x95, 0xC7, 0xEF, 0x76, 0x29, 0x74, 0xBB, 0x76, 0x58, 0x78, 0xCD, 0x0E, 0x40, 0xC7, 0x56, 0x7C, 0x0E, 0x20, 0xDF, 0xC3, 0xC3, 0x1F, 0x3F, 0xFF, 0xFC, 0x0F, 0xD2, 0x49, 0x38, 0x7C, 0x1C, 0xD8, 0x23, 0x37, 0x22, 0x5B, 0xB6, 0xCB, 0xD9, 0x2C, 0xB2, 0xE3, 0xF6, 0x3C, 0x6A, 0xC4, 0xAE, 0xB4, 0x82, 0x79, 0x11, 0xC5, 0x2C, 0xF2, 0x52, 0x11, 0xF0, 0x6D, 0x38, 0x08, 0x74, 0x80, 0x0C, 0x28, 0x67, 0x00, 0x9C, 0x31, 0x59, 0xAA, 0x9B, 0xF1, 0x4A, 0x73, 0x78, 0x91, 0xD0, 0x8B, 0xEC, 0xA1, 0xFC, 0x47, 0xE4, 0x39, 0x61, 0x4E, 0x21, 0x3E, 0xA2, 0x03, 0xBF, 0x11, 0x0A, 0x0F, 0x3F, 0xDE, 0xD7, 0x25, 0x40, 0x53, 0x03, 0x88, 0xF6, 0x03, 0x25, 0x38, 0xC1, 0x8E, 0x11, 0x32, 0x63, 0xF9, 0xB3, 0x6E, 0xF6, 0x09, 0xF0, 0x08, 0xFC, 0x5E, 0x6F, 0xF0, 0x31, 0x67, 0xD4, 0x6F, 0x1B, 0x5E, 0xEB, 0x00, 0x22, 0x83, 0x5F, 0xDB, 0x3E, 0x1C, 0x19, 0x1C, 0x0F, 0x3F, 0x30, 0x7F, 0x25, 0xB4, 0xBC, 0xE2, 0xA2, 0xD1, 0xD8, 0x52, 0x03, 0x48, 0x77, 0x61, 0x09, 0x80, 0xCF, 0x02, 0xF0, 0x12, 0x40, 0x2B, 0xD2, 0x84, 0xCE, 0x3D, 0x85, 0xA6, 0x29, 0x07, 0x94, 0xCE, 0x01, 0xA4, 0x0C, 0x40, 0xD4, 0x00, 0xB2, 0x57, 0xAC, 0x99, 0x93, 0xC1, 0x0F, 0xD3, 0xC9, 0x44, 0x7C, 0xF3, 0x0C, 0x74, 0x40, 0x9E, 0xA9, 0x8B, 0x4E, 0xF5, 0x2D, 0xCF, 0xD7, 0xE4, 0xD7, 0x75, 0xC2, 0x44, 0x8E, 0x08, 0x20, 0xFC, 0x78, 0x2F, 0xEE, 0x02, 0xC0, 0x69, 0x60, 0x28, 0x02, 0x7E, 0x17, 0x6A, 0x00, 0x60, 0x20, 0xA2, 0x06, 0x10, 0xA1, 0xFB, 0x14, 0x64, 0x3F, 0x8A, 0xA3, 0xED, 0x00, 0x46, 0x47, 0x7B, 0x02, 0x9C, 0x3B, 0x3E, 0xEA, 0x1F, 0x29, 0x98, 0x39, 0x5E, 0x0E, 0x52, 0x7F, 0xC3, 0x65, 0xDA, 0x05, 0x80, 0xFC, 0x30, 0xED, 0x02, 0xA0, 0x03, 0x10, 0xBB, 0x00, 0x16, 0x38, 0x0F, 0x9A, 0xA5, 0x8B, 0x6C, 0x47, 0x91, 0x7E, 0x7B, 0x64, 0x45, 0xE4, 0x4E, 0xB5, 0xBB, 0x59, 0x80, 0x42, 0x14, 0x8B, 0x60, 0x70, 0x00, 0xF8, 0xF0, 0x16, 0x1D, 0x04, 0x2A, 0x30, 0xCB, 0x3A, 0xC0, 0x16, 0xCA, 0x22, 0x07, 0x10, 0xC9, 0x37, 0x6A, 0x8F, 0x18, 0x32, 0x31, 0x3E, 0xFB, 0x33, 0x02, 0x90, 0x7E, 0xC1, 0x3F, 0xF0, 0xBF, 0xFC, 0x46, 0x20, 0xC8, 0x00, 0xA0, 0x06, 0x34, 0x75, 0x0E, 0x40, 0x46, 0xCE, 0xE4, 0x8B, 0xF8, 0x1F, 0x72, 0x38, 0x7A, 0xCD, 0xAD, 0xFB, 0x97, 0x31, 0x0A, 0xC7, 0x39, 0x19, 0x5E, 0x14, 0x37, 0xB5, 0x9E, 0xCD, 0xC9, 0x14, 0xD4, 0x12, 0xC0, 0x89, 0xBC, 0x11, 0x06, 0x8F, 0xD6, 0x1E, 0xE3, 0x57, 0x9F, 0xCB, 0x36, 0x32, 0x00, 0xA1, 0x00, 0xAF, 0xF7, 0x39, 0x00, 0xA8, 0x01, 0xA4, 0x6D, 0x30, 0x3C, 0x07, 0xF0, 0x2D, 0x3A, 0x07, 0x40, 0xCF, 0xE9, 0x59, 0x19, 0x00, 0xDB, 0xCF, 0xA3, 0xC9, 0x19, 0x0D, 0x95, 0xAC, 0x6D, 0xCE, 0x6F, 0x23, 0x75, 0x2F, 0x19, 0x00, 0x97, 0xC7, 0xD8, 0x01, 0x70, 0x06, 0x00, 0x35, 0xA0, 0xF4, 0x4A, 0x50, 0x23, 0x03, 0xD0, 0xE4, 0x46, 0x7E, 0xEA, 0x29, 0xB6, 0x8F, 0xED, 0x02, 0xAC, 0x16, 0x7C, 0x64, 0xB8, 0x51, 0x7B, 0xA4, 0x10, 0xD6, 0x78, 0xF4, 0xF4, 0xB4, 0xA6, 0x6D, 0x52, 0xC8, 0x1C, 0x01, 0x4A, 0x06, 0xF0, 0xFC, 0x07, 0x93, 0xE7, 0x00, 0xA4, 0xC3, 0x2F, 0xD1, 0xCF, 0x98, 0xAE, 0x11, 0x7E, 0x14, 0xB1, 0x74, 0xBB, 0x77, 0xED, 0x69, 0x60, 0x24, 0x8F, 0x01, 0x4D, 0x7C, 0xA0, 0x73, 0x00, 0xB5, 0x08, 0xC8, 0x35, 0x00, 0xC1, 0xB7, 0x02, 0x87, 0x29, 0x0F, 0x6A, 0x00, 0xA3, 0x29, 0x4F, 0x84, 0x7F, 0xD7, 0x4E, 0x0C, 0x8F, 0xE0, 0xBB, 0xA1, 0x50, 0x32, 0x38, 0xD3, 0xC2, 0xE7, 0x00, 0x70, 0x1B, 0x30, 0xAB, 0x87, 0x3C, 0x07, 0xA0, 0xE6, 0x5B, 0x1A, 0x62, 0xE7, 0xE2, 0xEB, 0xF5, 0xD7, 0xF2, 0x2C, 0xE4, 0x28, 0xC5, 0x29, 0x2F, 0x3D, 0x21, 0x7B, 0x19, 0x98, 0x9F, 0xCE, 0x01, 0x28, 0x40, 0xFA, 0x95, 0x27, 0x5E, 0xD5, 0xC7, 0x43, 0xC4, 0xAD, 0x12, 0x11, 0x46, 0x8B, 0xE1, 0x8B, 0x50, 0x34, 0x79, 0x54, 0x99, 0x5F, 0x52, 0x21, 0x13, 0xB4, 0xFC, 0x37, 0xD7, 0x00, 0xD2, 0xB3, 0x00, 0x69, 0x1B, 0x10, 0x76, 0x01, 0x60, 0x09, 0x70, 0x49, 0xE7, 0x00, 0xA6, 0xEC, 0x8B, 0x75, 0x02, 0x6B, 0x00, 0xD7, 0x50, 0x03, 0x78, 0x37, 0x65, 0x00, 0xB8, 0x18, 0xA8, 0xAF, 0xC5, 0x2E, 0xBB, 0x27, 0xCA, 0x17, 0x14, 0x07, 0xD8, 0x39, 0x18, 0x6F, 0xC6, 0x01, 0x0D, 0x4C, 0x5D, 0x46, 0x3D, 0xE2, 0x7C, 0x78, 0x6D, 0x0D, 0x00, 0x0F, 0xFC, 0xE4, 0x8C, 0x9F, 0xDF, 0x0A, 0xFC, 0xD1, 0x82, 0x1A, 0x40, 0xE4, 0xDF, 0x07, 0xFC, 0xEF, 0xD9, 0x74, 0x69, 0xB7, 0x01, 0x0B, 0x7F, 0xB5, 0x07, 0xDC, 0x58, 0x40, 0x5D, 0x51, 0x67, 0x63, 0xF8, 0x6C, 0xE8, 0xCD, 0xAE, 0xA8, 0xA8, 0x12, 0xC1, 0xFC, 0xE8, 0x00, 0xAE, 0xC0, 0xEB, 0x63, 0x0D, 0xE0, 0x06, 0x9E, 0x05, 0x48, 0x0E, 0x60, 0xE0, 0xA7, 0xC6, 0xC2, 0xDC, 0x79, 0xF4, 0x3A, 0x3B, 0x1F, 0xBF, 0x7F, 0xD4, 0xDE, 0xBB, 0xB2, 0xE9, 0xF9, 0x23, 0x52, 0xF2, 0xB3, 0x00, 0xF0, 0x56, 0xE0, 0x54, 0x03, 0xA8, 0xDB, 0x80, 0x75, 0x2F, 0x50, 0x42, 0xA8, 0xF2, 0xB1, 0x9D, 0xC0, 0xD6, 0xF2, 0xDB, 0x0E, 0x9E, 0x57, 0x03, 0x28, 0x2F, 0x04, 0x91, 0x35, 0x00, 0x21, 0x1F, 0x2D, 0x8F, 0xE8, 0x5A, 0xD7, 0x02, 0xD6, 0xF6, 0xB7, 0x6A, 0x0B, 0x53, 0xFA, 0x96, 0xE7, 0xCB, 0x15, 0x7F, 0x9E, 0x7B, 0x48, 0x3F, 0xDB, 0x73, 0x00, 0x64, 0xF8, 0x3A, 0x42, 0x17, 0x83, 0x55, 0x11, 0xD8, 0x8B, 0xE4, 0xCD, 0x7D, 0x76, 0xF0, 0xE4, 0x7A, 0xEB, 0x22, 0xBD, 0xDD, 0x60, 0xDE, 0xE2, 0x7E, 0x13, 0x20, 0xA4, 0x69, 0x32, 0xDE, 0x6C, 0x85, 0xF5, 0x1C, 0x00, 0x66, 0x00, 0xA3, 0xCF, 0x02, 0x6C, 0xA7, 0x96, 0xD5, 0x78, 0x65, 0xF1, 0xFA, 0x58, 0xF0, 0x65, 0x7C, 0xE6, 0x99, 0xE5, 0x39, 0x00, 0x74, 0x00, 0x65, 0xEB, 0x11, 0x57, 0x4D, 0x69, 0x40, 0x7E, 0x46, 0xCC, 0x3C, 0x02, 0xE7, 0x3E, 0x3C, 0xB6, 0x44, 0x3F, 0x84, 0x5E, 0x34, 0x07, 0x0F, 0x0C, 0xBD, 0xB1, 0x0E, 0x26, 0x48, 0xBD, 0xD1, 0xED, 0x66, 0xFF, 0x0C, 0xB7, 0x64, 0x00, 0x54, 0x03, 0xB0, 0x76, 0x01, 0xCE, 0x37, 0xAF, 0xD9, 0x4E, 0x7F, 0xF2, 0xFB, 0x00, 0x48, 0xE0, 0xC5, 0xE7, 0x77, 0x9A, 0xA8, 0x33, 0x02, 0x15, 0x5F, 0xC2, 0x6D, 0x1A, 0x35, 0x3E, 0xD2, 0x74, 0x1D, 0xBE, 0x22, 0xF8, 0x66, 0xB8, 0xD3, 0x6A, 0x8F, 0x8A, 0x86, 0x0A, 0x9D, 0xCF, 0x01, 0x60, 0xC2, 0x8B, 0x6F, 0x04, 0x7A, 0x99, 0x5E, 0x08, 0xD2, 0x3E, 0x0B, 0xE0, 0x45, 0x4F, 0xCB, 0x1E, 0x0C, 0x37, 0xD3, 0xB0, 0x91, 0x2F, 0xCC, 0x6A, 0xB2, 0x98, 0x48, 0x66, 0x07, 0x7A, 0x7E, 0x2F, 0xFA, 0x6B, 0x0F, 0x6F, 0x47, 0x67, 0x9B, 0x9A, 0x74, 0x12, 0x10, 0x00, 0xBF, 0xFD, 0xE9, 0x37, 0xD3, 0x2E, 0x48, 0xF9, 0x49, 0x93, 0x49, 0xB7, 0xD4, 0x8E, 0x37, 0xE7, 0xF0, 0x1C, 0x45, 0xE3, 0x90, 0x05, 0x9C, 0xAD, 0xF5, 0x2B, 0xDA, 0xB7, 0x6F, 0x76, 0x01, 0xD0, 0x01, 0x40, 0x00, 0x48, 0xBB, 0x00, 0xF9, 0x24, 0x68, 0xA9, 0x01, 0x90, 0xCF, 0xB1, 0x38, 0x36, 0x25, 0x1F, 0xD9, 0x5F, 0x3B, 0x74, 0x2D, 0x7F, 0x4F, 0xB7, 0x34, 0x7C, 0x6F, 0xBE, 0x08, 0xFE, 0xD4, 0x38, 0xCB, 0xA1, 0x09, 0x07, 0xC0, 0x1E, 0xF7, 0x02, 0x7F, 0x27, 0xAE, 0x73, 0xA4, 0xC9, 0x11, 0x0E, 0x03, 0x07, 0xBE, 0x11, 0xA8, 0x39, 0x09, 0xA8, 0xFD, 0x1A, 0x99, 0x42, 0x61, 0xDC, 0xCA, 0x04, 0xC9, 0x4B, 0xAC, 0xB6, 0xBA, 0x2F, 0x1D, 0x42, 0x22, 0x45, 0x47, 0x6A, 0x41, 0x5F, 0xAE, 0x01, 0x5C, 0x1D, 0xBE, 0xF8, 0xCF, 0xDF, 0x86, 0x27, 0x61, 0xA1, 0x0E, 0x5E, 0x5E, 0x8B, 0x9D, 0x87, 0xB5, 0x0E, 0x81, 0xAE, 0xBC, 0x90, 0x78, 0x0E, 0xF7, 0xA5, 0xA5, 0x69, 0xC7, 0xA3, 0xF0, 0xCB, 0x01, 0x00, 0xDE, 0x08, 0x04, 0xFD, 0x3E, 0x7C, 0xFE, 0x57, 0xE9, 0x71, 0x68, 0x33, 0x03, 0x10, 0x8E, 0x2A, 0xD7, 0x12, 0xB2, 0xDE, 0x9C, 0xFA, 0x77, 0x94, 0x08, 0xCD, 0xC1, 0x6F, 0xCC, 0x01, 0x44, 0x9E, 0x5C, 0x2B, 0x40, 0x20, 0x80, 0xE2, 0xB0, 0xBD, 0x4C, 0x20, 0x52, 0xA8, 0x15, 0xF8, 0xF0, 0x9B, 0x6A, 0xEF, 0x41, 0x05, 0x30, 0x02, 0x66, 0x07, 0x00, 0x6F, 0x85, 0x9D, 0x38, 0x07, 0xA0, 0xA3, 0x3C, 0xE3, 0x6F, 0xAD, 0xE9, 0xA5, 0x11, 0x96, 0x76, 0xA2, 0x67, 0x34, 0x8A, 0x58, 0x01, 0xAD, 0xF1, 0xFC, 0x06, 0xDF, 0xDA, 0xC7, 0x9F, 0xBD, 0x38, 0x23, 0x76, 0xD7, 0x28, 0xBF, 0xFF, 0x22, 0xBC, 0x11, 0xE8, 0x9E, 0x9E, 0x05, 0x90, 0x45, 0x8A, 0x42, 0x33, 0x27, 0x4E, 0x44, 0x18, 0x7F, 0x29, 0x68, 0xD6, 0x36, 0x5D, 0xA4, 0x0F, 0x73, 0xE5, 0x69, 0xE9, 0x87, 0x0E, 0xB5, 0xC4, 0x6C, 0x7E, 0xB7, 0x21, 0x1B, 0x30, 0xE3, 0x8D, 0xEF, 0x03, 0xC0, 0xD7, 0x82, 0x7F, 0x08, 0x47, 0x81, 0xF1, 0xC3, 0x30, 0x58, 0x0F, 0xEA, 0x1C, 0xA8, 0x62, 0xA3, 0x96, 0xA7, 0xCB, 0xE5, 0xB9, 0x19, 0xAE, 0x06, 0x64, 0x64, 0x54, 0x4D, 0x4D, 0xC0, 0xD1, 0x27, 0x4B, 0x1F, 0xB5, 0x2F, 0xD7, 0x19, 0x5C, 0x7A, 0x2B, 0x70, 0xCA, 0x8D, 0xF5, 0x03, 0x20, 0x1C, 0x06, 0xE4, 0x59, 0xFA, 0x46, 0x33, 0x71, 0x0C, 0x86, 0x48, 0x99, 0xDC, 0x4A, 0xCC, 0x07, 0xDA, 0x13, 0xE1, 0xD6, 0x78, 0x1A, 0x9B, 0x9A, 0x3D, 0xF8, 0x2C, 0xAE, 0x89, 0xF9, 0x3B, 0xF8, 0x75, 0xBA, 0x5B, 0x18, 0xF6, 0xB9, 0xEB, 0x9B, 0xC3, 0x07, 0x10, 0x01, 0xCA, 0xB3, 0x00, 0xBE, 0xDD, 0x3C, 0xA1, 0x16, 0xF3, 0x01, 0xD6, 0x82, 0x3F, 0x1F, 0x8A, 0xC1, 0x25, 0x10, 0x3E, 0x05, 0xF9, 0xC5, 0x5F, 0x7D, 0x1B, 0x5E, 0x89, 0x9E, 0x5F, 0x99, 0x9F, 0x92, 0x24, 0x66, 0x11, 0x69, 0x4A, 0x7E, 0x45, 0x18, 0xBF, 0xAF, 0x77, 0xD4, 0x63, 0x8F, 0x58, 0x7C, 0xA0, 0x1F, 0x23, 0xFA, 0xE7, 0xEA, 0x8F, 0x35, 0x7F, 0x22, 0xA3, 0xE8, 0xD3, 0x2D, 0x10, 0xFB, 0xC7, 0x50, 0xFC, 0xFD, 0x1F, 0xCF, 0xFF, 0x6B, 0x7A, 0x2A, 0x32, 0x9D, 0x03, 0x78, 0x0D, 0x7F, 0xC8, 0x01, 0xBC, 0x3E, 0x94, 0x27, 0x55, 0x06, 0x67, 0x07, 0xCB, 0x3F, 0x58, 0x02, 0xC0, 0x6B, 0xA1, 0xFF, 0x2D, 0xBD, 0x12, 0xEC, 0x0A, 0x3F, 0x0D, 0xA6, 0xFD, 0xE3, 0xE3, 0xF3, 0xC5, 0x70, 0xFE, 0xDB, 0x23, 0x01, 0xB4, 0xE3, 0x41, 0xA0, 0x67, 0xE0, 0x2B, 0xDE, 0x4A, 0x35, 0x00, 0xFC, 0x2E, 0x80, 0xCC, 0x31, 0xB6, 0x9F, 0xF2, 0x5C, 0x20, 0x26, 0x09, 0x63, 0x0D, 0x00, 0x74, 0xE0, 0x0A, 0x3F, 0x0D, 0xF7, 0xEF, 0x7E, 0x50, 0x4E, 0x02, 0x66, 0x9F, 0xB3, 0x4E, 0x07, 0x22, 0xF9, 0x45, 0xC9, 0x81, 0x4C, 0x6E, 0x98, 0x67, 0x6E, 0x26, 0x19, 0x64, 0x02, 0x32, 0x34, 0x4A, 0xCA, 0x9A, 0x90, 0xF9, 0xA7, 0x7F, 0xFF, 0x9F, 0xE0, 0x5A, 0x09, 0x5F, 0x8F, 0x94, 0xD2, 0x73, 0xD3, 0x73, 0x41, 0x9A, 0x35, 0xDE, 0xCA, 0x45, 0x2C, 0x9D, 0x73, 0xD3, 0x3B, 0x07, 0x7E, 0x27, 0x2F, 0x05, 0x40, 0xE6, 0x4E, 0x4C, 0x69, 0xDA, 0x06, 0xC4, 0x87, 0x60, 0xE1, 0x85, 0x10, 0xEF, 0xFD, 0xF0, 0xF0, 0xE6, 0xF5, 0xE7, 0x0E, 0xAF, 0xEE, 0xF3, 0x87, 0x41, 0xF8, 0xDC, 0xB8, 0xF9, 0x9A, 0xA4, 0x73, 0xD1, 0xE2, 0x05, 0x78, 0x74, 0xA9, 0xDF, 0x0D, 0x78, 0x00, 0xF0, 0x82, 0xEF, 0xBC, 0xF8, 0x7A, 0x2E, 0x02, 0xC2, 0x83, 0x31, 0x6D, 0x2E, 0xC5, 0x9F, 0xCA, 0x52, 0xC7, 0x5F, 0x65, 0x5D, 0x21, 0x73, 0x8C, 0x73, 0x06, 0xFA, 0x2D, 0x52, 0x08, 0x7E, 0x8D, 0x8F, 0x5E, 0xFB, 0x4C, 0xEA, 0x17, 0xC0, 0x6B, 0xC6, 0xD1, 0x75, 0xB7, 0xF0, 0xD5, 0xF3, 0xD8, 0xFA, 0x51, 0x8D, 0x27, 0xB7, 0xE7, 0x84, 0x06, 0xE4, 0x7F, 0x83, 0x6F, 0x05, 0xBE, 0x3F, 0x7C, 0xF8, 0xE5, 0x1F, 0x1D, 0x9E, 0x41, 0x26, 0x78, 0x77, 0x9F, 0x1F, 0x06, 0x2B, 0x5F, 0xE9, 0x59, 0xC0, 0xE3, 0xA7, 0x38, 0xE4, 0xEA, 0x4F, 0xF0, 0xF3, 0xE0, 0x3A, 0x8B, 0x66, 0xC1, 0x4A, 0x41, 0x10, 0x75, 0x49, 0xFE, 0x8D, 0xE0, 0xAB, 0xDC, 0xCB, 0x6D, 0xDD, 0x8E, 0xD7, 0xCD, 0x22, 0x86, 0x14, 0x67, 0x12, 0x7E, 0xAF, 0x57, 0x2E, 0x7C, 0xE9, 0x48, 0x8A, 0xA6, 0x6B, 0x45, 0x22, 0x02, 0xF0, 0x5B, 0x6F, 0xF0, 0x27, 0x46, 0xC0, 0x6B, 0x38, 0x0B, 0xFE, 0x01, 0x7C, 0x1A, 0xEC, 0xCD, 0xAB, 0x3F, 0xCE, 0x9F, 0x06, 0x9B, 0x08, 0x82, 0x0C, 0x76, 0x24, 0x4E, 0x0E, 0x47, 0x81, 0xA8, 0xA3, 0xD2, 0xA8, 0xA8, 0xBB, 0xB5, 0x6D, 0x67, 0xB1, 0x3D, 0xD1, 0x09, 0x27, 0x01, 0xEF, 0xEF, 0xEF, 0x0E, 0x5F, 0xFA, 0x08, 0x1E, 0x07, 0x86, 0x54, 0x18, 0x9F, 0x8C, 0x2B, 0x9F, 0xA7, 0x92, 0xF2, 0xD7, 0x38, 0x14, 0xF9, 0xCF, 0x90, 0xCF, 0x0C, 0xF9, 0xD7, 0x00, 0xAC, 0xE4, 0xC7, 0x78, 0x68, 0xF9, 0x6A, 0xAB, 0xB3, 0x02, 0xB8, 0xD0, 0x6F, 0x7E, 0x2D, 0xD8, 0x2B, 0xA8, 0x01, 0xFC, 0x11, 0xD8, 0xFC, 0xFF, 0xFC, 0x0A, 0xD4, 0x80, 0xD2, 0x97, 0x81, 0xF2, 0x49, 0x40, 0xA9, 0x03, 0x11, 0xBF, 0x9F, 0xA2, 0xC1, 0x77, 0xEC, 0x4A, 0x0E, 0x80, 0x8D, 0x5B, 0xC9, 0xD4, 0x0B, 0xF6, 0xBA, 0xFF, 0xDC, 0xF1, 0x6E, 0x12, 0x61, 0xF8, 0x12, 0xED, 0x9B, 0xE6, 0x5C, 0x9B, 0xBA, 0x41, 0x11, 0x00, 0xFD, 0x3D, 0x3E, 0x24, 0xF9, 0x31, 0x7C, 0x1E, 0x1C, 0x3F, 0x8D, 0x75, 0x77, 0xF8, 0x0C, 0xEE, 0x90, 0x76, 0x27, 0x04, 0x1B, 0xAD, 0x11, 0xA5, 0x0A, 0xB8, 0x5F, 0x34, 0x83, 0xFE, 0x30, 0x82, 0x60, 0x9E, 0x7B, 0x66, 0xBB, 0xB7, 0x9D, 0xD5, 0x95, 0x75, 0x99, 0x51, 0x0A, 0xBE, 0x48, 0x5F, 0xA5, 0xC3, 0xCA, 0xC3, 0xF9, 0xE5, 0xDA, 0x88, 0x3F, 0xDC, 0xC0, 0xFF, 0xC1, 0x56, 0xC0, 0xDB, 0x2F, 0xBE, 0x96, 0x5F, 0x0A, 0x5A, 0xB4, 0x60, 0xC4, 0xC5, 0x35, 0xD4, 0x15, 0x36, 0x47, 0x72, 0xDD, 0xAA, 0x7D, 0xAE, 0xBE, 0x75, 0xBE, 0x03, 0x6E, 0xBC, 0xC2, 0xEF, 0x02, 0x40, 0x06, 0xF4, 0xE1, 0x57, 0x50, 0xFE, 0xB0, 0x0D, 0x8C, 0x19, 0x00, 0x45, 0xB7, 0xCA, 0x2F, 0xF2, 0x07, 0x72, 0x5B, 0x84, 0xB6, 0x01, 0xF0, 0xFB, 0x09, 0x25, 0x4B, 0xF4, 0x82, 0xCE, 0x5C, 0xF9, 0x7B, 0xDB, 0xDD, 0xAE, 0x7E, 0x45, 0x11, 0x42, 0xE8, 0x47, 0xD2, 0x46, 0xFA, 0x06, 0x21, 0xDB, 0x3B, 0xEA, 0x40, 0xFA, 0x36, 0x20, 0xFE, 0x21, 0xD2, 0xB4, 0xF4, 0x27, 0xA5, 0xCB, 0x09, 0x04, 0xB5, 0xCB, 0x97, 0xEC, 0x58, 0xC2, 0x64, 0x9D, 0xEF, 0x32, 0x3F, 0xD9, 0x99, 0x9D, 0x8C, 0x05, 0xBF, 0x9A, 0x4C, 0x67, 0x0A, 0x0D, 0x8F, 0x15, 0x7E, 0x0D, 0x1B, 0x38, 0x42, 0x91, 0x1E, 0x97, 0x8C, 0x85, 0xE8, 0x63, 0x54, 0x72, 0xA9, 0x0C, 0xBE, 0x0E, 0x8B, 0xDF, 0x86, 0x6B, 0x76, 0x01, 0xA4, 0xE9, 0x74, 0x41, 0xC1, 0xC0, 0x4B, 0x7F, 0xFE, 0xAA, 0x4D, 0x24, 0xAC, 0xCF, 0xAD, 0xE9, 0x84, 0x65, 0xFA, 0x3A, 0x82, 0x6F, 0xCF, 0xA7, 0xCB, 0x76, 0x6D, 0x7D, 0x03, 0x66, 0x04, 0x03, 0xB8, 0x87, 0xA8, 0xFF, 0x2E, 0x7C, 0x1D, 0x18, 0xBF, 0x8D, 0x98, 0xCE, 0xC2, 0xE3, 0xCF, 0x54, 0x7A, 0x8E, 0x7C, 0x4F, 0xCE, 0x44, 0xBB, 0x56, 0xB1, 0x72, 0x66, 0x1F, 0x2A, 0xE4, 0xAB, 0x6B, 0xC7, 0x9D, 0x7E, 0x91, 0xDC, 0x19, 0xAA, 0x50, 0xC5, 0x06, 0x25, 0x6B, 0xF7, 0x45, 0xA2, 0x2C, 0x97, 0xEF, 0x46, 0x72, 0x59, 0xB6, 0x37, 0x11, 0x7E, 0xAA, 0x81, 0xDC, 0xDE, 0x1D, 0x3E, 0x80, 0xAF, 0x03, 0xDF, 0xA4, 0xC7, 0x81, 0x79, 0x17, 0x20, 0x3B, 0x47, 0xFE, 0x3E, 0x42, 0xF1, 0xF5, 0x6C, 0x34, 0xA9, 0x5A, 0x52, 0x19, 0xD0, 0xB5, 0x2B, 0xFE, 0xF4, 0xE3, 0xB5, 0xBC, 0x66, 0x5E, 0x77, 0xF0, 0x97, 0xEA, 0x07, 0x89, 0x3A, 0xD7, 0x00, 0x08, 0x6A, 0xB1, 0x32, 0xA1, 0x08, 0xA6, 0x54, 0x74, 0xFF, 0x68, 0x7C, 0xD4, 0xAE, 0xE7, 0x9B, 0x0B, 0x3F, 0xC2, 0x57, 0x29, 0x36, 0x68, 0x31, 0x7A, 0xEF, 0x5B, 0x38, 0xFE, 0xFB, 0xCB, 0xF7, 0x7F, 0x02, 0x29, 0x30, 0x54, 0x03, 0x68, 0x0D, 0xD8, 0xAB, 0x36, 0xDE, 0x99, 0x12, 0x63, 0xEB, 0x30, 0xF2, 0x78, 0x2F, 0xD6, 0x31, 0xF4, 0xAD, 0xDA, 0x35, 0x3C, 0x9E, 0xDB, 0x32, 0xD0, 0x6C, 0x56, 0x1C, 0xB7, 0xF8, 0x1C, 0xC0, 0x17, 0x20, 0x03, 0xC0, 0x5D, 0x90, 0xA4, 0xD3, 0xD2, 0xF2, 0x5C, 0x2B, 0xA4, 0x39, 0xD8, 0xC2, 0x98, 0xDE, 0x59, 0xD7, 0x33, 0xE4, 0x15, 0x7A, 0x05, 0x4B, 0x3E, 0x2D, 0x7C, 0x76, 0x38, 0xD2, 0x41, 0xDC, 0xC1, 0x12, 0xE8, 0xEA, 0xEE, 0xD5, 0xE1, 0x25, 0xC8, 0x1F, 0x0F, 0x45, 0xF1, 0x36, 0x60, 0x2F, 0x3F, 0x89, 0xC0, 0x5C, 0xF9, 0x59, 0xF2, 0xD9, 0x52, 0x3F, 0x22, 0xF8, 0x71, 0x3B, 0x64, 0x00, 0xE8, 0x00, 0x48, 0x67, 0xF1, 0x37, 0x3B, 0x37, 0xE1, 0x0C, 0xF8, 0xF0, 0x43, 0xEA, 0xC7, 0x9E, 0x5D, 0xE8, 0x3D, 0x65, 0xD5, 0x79, 0xB6, 0xA8, 0x9D, 0xE7, 0x18, 0x85, 0x8F, 0x20, 0x29, 0x6B, 0x1D, 0x82, 0xAF, 0xF1, 0xEF, 0xC2, 0x6B, 0xFD, 0x48, 0xC4, 0x1D, 0x54, 0x81, 0x7F, 0xFE, 0xE5, 0x1F, 0x43, 0x34, 0xC4, 0x93, 0x70, 0xF5, 0x8D, 0x40, 0xBD, 0xF9, 0xE8, 0x3B, 0xDA, 0x21, 0x1C, 0xBB, 0x3D, 0x8A, 0x23, 0x72, 0x7E, 0xE9, 0x90, 0xEA, 0x38, 0xED, 0xA6, 0xF8, 0x24, 0x20, 0x66, 0x00, 0xB8, 0x0F, 0x8E, 0x87, 0x82, 0x78, 0xCB, 0xAF, 0x91, 0x67, 0xC4, 0x7F, 0xA3, 0x5D, 0xEB, 0x93, 0x86, 0xD7, 0x38, 0x1A, 0xAD, 0x0F, 0x86, 0xFE, 0x69, 0xC7, 0xA4, 0xF5, 0x6D, 0x72, 0x3E, 0x95, 0x89, 0x70, 0x1A, 0x0C, 0x5F, 0x45, 0x3B, 0x5C, 0xBF, 0x7A, 0x75, 0x78, 0xF1, 0x95, 0xBF, 0x86, 0x6C, 0x00, 0x1D, 0x40, 0x7A, 0x3A, 0x84, 0x40, 0x45, 0x1F, 0x05, 0x8D, 0xE4, 0x1F, 0x69, 0xD0, 0xDA, 0xF1, 0x6B, 0xE1, 0x0B, 0xBD, 0xF8, 0x93, 0xBF, 0xFB, 0x0F, 0x20, 0x7A, 0x3E, 0x09, 0x56, 0xDE, 0x0C, 0x97, 0x4E, 0x86, 0xD5, 0x35, 0x03, 0xBE, 0x49, 0x17, 0x2B, 0xA8, 0xF5, 0x23, 0xA1, 0xE9, 0x9A, 0xD6, 0x14, 0xF5, 0x23, 0x52, 0xE2, 0x23, 0xA2, 0xB4, 0xA6, 0xE0, 0xB5, 0x27, 0xB7, 0x70, 0xFA, 0x54, 0xB6, 0x5C, 0x78, 0x9F, 0xB9, 0x81, 0xCF, 0xCB, 0xB1, 0xBA, 0x66, 0x61, 0xD1, 0xE8, 0xF1, 0x65, 0x6D, 0x4B, 0xE7, 0x18, 0x70, 0x8B, 0x8F, 0xF7, 0xAD, 0x39, 0xE2, 0x95, 0x88, 0x9C, 0xF0, 0xBF, 0x4B, 0x0A, 0x7F, 0x9B, 0x72, 0xD9, 0xDB, 0xC3, 0x3F, 0x7D, 0xE5, 0xBF, 0x41, 0x3E, 0x88, 0xC2, 0xC7, 0x7D, 0x81, 0x4B, 0xF9, 0xE9, 0x33, 0x8C, 0xC4, 0x3F, 0x4E, 0x6D, 0x31, 0xE2, 0xE1, 0x56, 0x28, 0xC4, 0xFE, 0x2F, 0x7F, 0x80, 0x0E, 0x80, 0x52, 0x5E, 0x72, 0xB4, 0xE5, 0xA3, 0xDF, 0xF4, 0x05, 0x92, 0x24, 0x5F, 0x02, 0xC9, 0x19, 0x44, 0x5E, 0x5A, 0x09, 0xF9, 0xA4, 0xF6, 0x9A, 0x61, 0xC8, 0xF6, 0xF4, 0x1D, 0x7A, 0x21, 0xDF, 0x84, 0x4A, 0x02, 0x89, 0xCF, 0xE1, 0xE7, 0xD9, 0xAC, 0xF6, 0x24, 0x3F, 0x59, 0xBB, 0x28, 0xE9, 0x77, 0xEE, 0xCF, 0xED, 0x08, 0x2C, 0x7F, 0xD3, 0xB0, 0xD5, 0x5F, 0x84, 0x9C, 0xE1, 0x57, 0x2F, 0x73, 0x0F, 0x5B, 0xBF, 0x38, 0x1F, 0x68, 0xC1, 0x01, 0x16, 0x3E, 0x87, 0x8F, 0xDE, 0xFF, 0x69, 0x6E, 0xC7, 0x4F, 0xC3, 0x15, 0x4F, 0x12, 0x65, 0x68, 0x6B, 0xF5, 0xE4, 0x31, 0x1C, 0x00, 0xE3, 0x28, 0xD7, 0x74, 0x86, 0x5E, 0xFC, 0x29, 0x14, 0x01, 0x51, 0xFD, 0xD9, 0xB0, 0xF8, 0xED, 0xB0, 0xF5, 0x3A, 0xA7, 0xCB, 0xBA, 0x1D, 0x1F, 0x26, 0x41, 0x8B, 0xC9, 0xCF, 0x91, 0xE5, 0xF1, 0xD8, 0x2F, 0x8D, 0x87, 0x79, 0x70, 0x53, 0x09, 0xBB, 0xE0, 0x27, 0x27, 0x90, 0xE5, 0x65, 0x3C, 0xE1, 0xC0, 0xEF, 0xE5, 0xC7, 0x97, 0x31, 0x68, 0xF8, 0xB8, 0x1A, 0x4B, 0x86, 0xEC, 0xC1, 0x17, 0xED, 0x08, 0x3F, 0xCD, 0x4F, 0x70, 0xF1, 0x78, 0x2F, 0xEA, 0x42, 0xC6, 0x07, 0xD7, 0xF9, 0x59, 0x79, 0x93, 0x71, 0x13, 0x2F, 0x72, 0xFB, 0xE1, 0xF0, 0x06, 0x28, 0xC3, 0x87, 0xEF, 0xFE, 0x08, 0x0B, 0xE2, 0x09, 0x87, 0xA4, 0x48, 0x45, 0xB6, 0xCC, 0xB8, 0xB5, 0xC2, 0x3E, 0x87, 0xF1, 0x32, 0x2D, 0xCB, 0x6E, 0x0E, 0xB9, 0x76, 0x0F, 0xBB, 0x20, 0xEF, 0xBE, 0xFC, 0x4E, 0xE2, 0xD7, 0x0D, 0x54, 0xC5, 0x93, 0x29, 0xD2, 0x02, 0x9F, 0xB7, 0x86, 0x32, 0x5B, 0xDB, 0x4C, 0x22, 0xF3, 0x3B, 0xC3, 0x64, 0xFE, 0xE3, 0x05, 0x3F, 0x8B, 0x56, 0xBF, 0xBC, 0x54, 0xE5, 0xCF, 0x1F, 0x6F, 0x41, 0xF9, 0xE0, 0x38, 0xDE, 0x74, 0xCC, 0xFA, 0x92, 0x85, 0x96, 0xE5, 0xC5, 0xAB, 0x91, 0x8C, 0x67, 0x91, 0x2F, 0xDD, 0xE7, 0xF6, 0x5E, 0xFF, 0xF2, 0xB8, 0x24, 0x7F, 0xD6, 0xE7, 0x84, 0x5F, 0x7E, 0x1F, 0x1E, 0x0B, 0x1F, 0x1D, 0x07, 0xE2, 0x89, 0xD7, 0x9F, 0x03, 0x60, 0xFF, 0xF8, 0xCE, 0x0F, 0x61, 0x09, 0x58, 0xB3, 0x1F, 0x59, 0xEF, 0x5B, 0x2E, 0xB9, 0xB9, 0xBA, 0x73, 0xBA, 0xFE, 0x57, 0xFF, 0xF7, 0x93, 0xBF, 0x01, 0xCE, 0x43, 0x0A, 0x08, 0x0A, 0x90, 0x0E, 0xC7, 0x20, 0x6B, 0x52, 0xB5, 0x2F, 0x3D, 0x2E, 0x93, 0xCD, 0x0B, 0xB7, 0xCE, 0xA0, 0x3D, 0xBD, 0x4B, 0x9F, 0x78, 0x89, 0x46, 0x03, 0xFA, 0x93, 0x18, 0x7E, 0x8F, 0xFD, 0xAF, 0xE1, 0x02, 0xE0, 0x70, 0xFF, 0x04, 0x0F, 0x77, 0x56, 0x48, 0xE0, 0xF8, 0x05, 0x66, 0xA8, 0x39, 0x65, 0x01, 0x75, 0xF0, 0xA1, 0x1F, 0xB6, 0x4F, 0xC0, 0xBF, 0x02, 0xF8, 0x0F, 0x06, 0x7C, 0x36, 0x78, 0x89, 0x0F, 0xC2, 0x47, 0x4F, 0x9F, 0x63, 0x4C, 0x56, 0xF7, 0x14, 0xF1, 0x10, 0x7E, 0xCA, 0x6C, 0x90, 0x4A, 0x8C, 0x01, 0x58, 0x06, 0xCC, 0x78, 0x77, 0x2F, 0x0F, 0xD1, 0xD5, 0xAE, 0x44, 0x47, 0x16, 0x54, 0x32, 0x15, 0xAC, 0x23, 0x50, 0x74, 0xE2, 0x6B, 0xBF, 0x9D, 0xF9, 0x50, 0x2B, 0xC7, 0xED, 0xF8, 0xF1, 0xF6, 0xB1, 0xF9, 0x2B, 0x3C, 0x4E, 0x6B, 0x73, 0x98, 0x4F, 0x6E, 0x39, 0xCB, 0x28, 0x39, 0xBB, 0x8C, 0x0F, 0x72, 0x2A, 0x39, 0x6A, 0xA0, 0x27, 0x7F, 0x85, 0x0D, 0x38, 0x43, 0x19, 0x15, 0x47, 0x66, 0xE4, 0x33, 0xF2, 0x2F, 0x7D, 0x45, 0x10, 0xF5, 0x84, 0xAE, 0x97, 0xC8, 0x1F, 0xE5, 0xCC, 0x55, 0x67, 0xD6, 0xA7, 0x56, 0x3F, 0x32, 0xFE, 0xD8, 0x8F, 0xE1, 0x27, 0xFD, 0x23, 0xFD, 0x41, 0xF4, 0x1B, 0xFD, 0x4B, 0xCE, 0x9B, 0xF5, 0x2F, 0xEB, 0x09, 0x3A, 0xB4, 0xDB, 0xD4, 0x3F, 0xCB, 0x0C, 0x7F, 0xDF, 0xA6, 0x5C, 0x37, 0xBB, 0x99, 0xDB, 0x94, 0xFF, 0x00, 0x07, 0x48, 0x1F, 0x33, 0x9D, 0x99, 0x2F, 0x1C, 0x28, 0xEA, 0xC1, 0xFF, 0x04, 0x42, 0xC8, 0x9F, 0xBA, 0x95, 0x9D, 0xA2, 0x96, 0xDF, 0x69, 0xC6, 0x04, 0xB7, 0x1A, 0x76, 0xB6, 0x03, 0x96, 0x7F, 0x6D, 0x27, 0x69, 0x90, 0x9D, 0xF4, 0xED, 0x2C, 0x3F, 0x1E, 0x9F, 0xE5, 0x3F, 0x06, 0xBF, 0xEA, 0xA3, 0xD6, 0x2F, 0x31, 0xFF, 0xFF, 0xF9, 0xE4, 0x6F, 0x93, 0x2B, 0x4F, 0x5E, 0x92, 0x0D, 0x10, 0xFF, 0xA4, 0x50, 0xC8, 0xBB, 0x03, 0x5C, 0xF9, 0x4D, 0xFB, 0xA8, 0xAA, 0x3F, 0xF7, 0x25, 0x57, 0x5B, 0x78, 0x48, 0x7A, 0x96, 0xFD, 0x6F, 0x76, 0xC3, 0x99, 0x8F, 0x35, 0xCC, 0x96, 0xDD, 0x87, 0x51, 0xF8, 0x69, 0x28, 0xC9, 0xA8, 0x99, 0x4F, 0xC2, 0xA7, 0x3E, 0x45, 0xB9, 0x72, 0x80, 0x29, 0xF3, 0x67, 0x7C, 0xB2, 0xB0, 0x33, 0x2E, 0xE4, 0x00, 0x4A, 0xFC, 0xA7, 0xCE, 0xA9, 0x23, 0x2A, 0x57, 0x3D, 0x2A, 0x41, 0x14, 0x64, 0x60, 0xE2, 0x47, 0x88, 0x3A, 0x33, 0xB2, 0xFC, 0x90, 0x07, 0x5C, 0x79, 0xED, 0xC3, 0xCF, 0x80, 0xC7, 0xE6, 0x67, 0xC6, 0x57, 0x7A, 0x70, 0xFF, 0x1F, 0x65, 0x4A, 0x7B, 0x00, 0x95, 0x03, 0x82, 0x04, 0x49, 0x41, 0x4E, 0xDD, 0xD1, 0x49, 0xE4, 0x49, 0x1B, 0x79, 0x32, 0x8F, 0x85, 0x7C, 0x38, 0xA2, 0x0E, 0xCB, 0x3F, 0x19, 0xB3, 0xD2, 0xC7, 0x86, 0x85, 0xE4, 0xB8, 0x48, 0xA6, 0x85, 0xA2, 0x3C, 0xAC, 0xC8, 0xB8, 0xA3, 0x87, 0xF8, 0x9F, 0x9F, 0x96, 0x47, 0xB9, 0xE7, 0xBC, 0x26, 0xAD, 0xFC, 0xD1, 0xFB, 0xF0, 0x4F, 0x65, 0xA4, 0x92, 0x2E, 0x5F, 0x2A, 0x79, 0x52, 0x7F, 0x97, 0xFF, 0x61, 0xBB, 0x40, 0xBC, 0x60, 0x2F, 0xF5, 0x27, 0x90, 0x6F, 0x04, 0x5F, 0x64, 0x6F, 0x95, 0x3B, 0x15, 0xFE, 0xD5, 0xAF, 0x3F, 0x45, 0x07, 0xF0, 0x3A, 0xFD, 0x30, 0xB9, 0xA4, 0x3A, 0xEA, 0xB2, 0x57, 0x04, 0xAD, 0x11, 0xCE, 0x75, 0xB9, 0xAD, 0x01, 0x6A, 0x09, 0x79, 0x13, 0x7A, 0x1A, 0x38, 0x32, 0x3F, 0x1A, 0x23, 0x59, 0x66, 0x28, 0x4A, 0x0B, 0x3F, 0x3D, 0x48, 0x78, 0xE8, 0x10, 0xDE, 0x53, 0xEB, 0xA0, 0xF8, 0xC9, 0x97, 0x52, 0x7E, 0x89, 0x45, 0xCC, 0x4F, 0x8B, 0xFF, 0x92, 0xDF, 0x23, 0xF2, 0x21, 0x8F, 0xC8, 0x11, 0xA9, 0x18, 0x3A, 0x79, 0xD1, 0xE2, 0x76, 0x27, 0xAE, 0x1B, 0xFD, 0x92, 0xF2, 0x89, 0xF4, 0xCB, 0xC3, 0x9F, 0x48, 0xEC, 0x1C, 0x40, 0x53, 0x72, 0x37, 0x84, 0xAB, 0xDB, 0x23, 0xFA, 0xD7, 0xEA, 0x87, 0xE9, 0x91, 0x95, 0x73, 0x36, 0xF8, 0xE1, 0x7B, 0xF4, 0x69, 0x07, 0x50, 0xFC, 0x7B, 0x9A, 0x97, 0x13, 0xE6, 0xD6, 0xBF, 0xA7, 0x0C, 0x88, 0x0C, 0x2E, 0xF7, 0x87, 0x76, 0xEA, 0xC2, 0x05, 0x51, 0x3E, 0x5C, 0xC1, 0x29, 0x5E, 0x6D, 0xE7, 0xFC, 0x29, 0x8F, 0x74, 0xDB, 0x29, 0xF3, 0xA8, 0xE7, 0x08, 0x32, 0x91, 0x39, 0x01, 0xE4, 0x65, 0x94, 0x8D, 0x5F, 0xEA, 0x21, 0xF8, 0xD6, 0xC6, 0x2C, 0xC6, 0xB5, 0x66, 0x03, 0x8D, 0x88, 0xD2, 0xB8, 0x09, 0x07, 0x10, 0xC9, 0x7B, 0xAE, 0xBC, 0xB4, 0x7E, 0xCC, 0xD5, 0xAF, 0x68, 0xBE, 0x4E, 0xFF, 0x0C, 0x07, 0x40, 0x7D, 0x4A, 0xB6, 0xA2, 0xE4, 0x29, 0xF9, 0x59, 0xAA, 0x59, 0x42, 0xDE, 0xAC, 0x51, 0xE4, 0x36, 0x48, 0x3E, 0xD5, 0x87, 0xD4, 0xF1, 0xB1, 0xBC, 0xAA, 0x3E, 0xE5, 0xCC, 0xC0, 0xD2, 0x8F, 0x2C, 0x7F, 0x09, 0x1F, 0x65, 0x2A, 0xFB, 0xF3, 0x35, 0x2F, 0x20, 0x9C, 0xFE, 0xA8, 0x7F, 0xBF, 0xC6, 0x1A, 0xC0, 0x6B, 0xFD, 0xE3, 0x29, 0xFB, 0x84, 0xA6, 0xAB, 0x2C, 0xB0, 0xAE, 0x0F, 0xA5, 0x0A, 0x08, 0xA6, 0xA6, 0xFE, 0xCA, 0xF1, 0x98, 0x8A, 0x49, 0xE3, 0x4B, 0x7F, 0xE5, 0xD9, 0xD2, 0x7D, 0x8A, 0x4C, 0x62, 0x7D, 0x19, 0xCE, 0x9F, 0x55, 0x32, 0x6B, 0x8C, 0x3B, 0xEF, 0xEB, 0xAA, 0x04, 0xDA, 0x11, 0xCA, 0x6B, 0xFA, 0x5B, 0xCB, 0x2F, 0x92, 0xA7, 0xAB, 0x1F, 0x53, 0x99, 0x95, 0xEB, 0xB1, 0x63, 0xC1, 0x98, 0xFA, 0x32, 0xA1, 0x7F, 0xDC, 0x1F, 0xEB, 0x40, 0xBF, 0x81, 0x1A, 0x00, 0x57, 0xD0, 0x69, 0xF9, 0x55, 0x5E, 0x09, 0x85, 0x0A, 0xC3, 0x3A, 0x57, 0x22, 0x18, 0x39, 0x97, 0xB2, 0xFE, 0x26, 0xD5, 0xE2, 0xE9, 0x9A, 0xFE, 0xA4, 0x72, 0x9B, 0xC1, 0xCF, 0x4E, 0xAE, 0x54, 0xFC, 0xD9, 0xDC, 0xB4, 0x07, 0x2E, 0xF3, 0xF1, 0xFC, 0x0D, 0x72, 0x7C, 0xD3, 0x32, 0x48, 0x69, 0x24, 0x46, 0xBB, 0x16, 0xAC, 0x16, 0x4D, 0xD4, 0xEE, 0x1A, 0x21, 0x03, 0x0A, 0xC2, 0x59, 0x21, 0xDE, 0xD1, 0x89, 0xA8, 0xDD, 0xE3, 0x43, 0x71, 0x2C, 0x79, 0xE7, 0xA6, 0xF2, 0xAF, 0x6E, 0xF0, 0x4E, 0xCA, 0x57, 0xEB, 0x9A, 0xE0, 0x83, 0xAF, 0x0F, 0x99, 0xD6, 0x21, 0xFD, 0x62, 0x78, 0x03, 0xF2, 0x4F, 0xA8, 0x78, 0xF3, 0x37, 0xE3, 0x27, 0xE4, 0x6F, 0x1A, 0x30, 0xC2, 0xAD, 0x91, 0xB5, 0x1E, 0x15, 0xD7, 0xC4, 0x4F, 0xD8, 0x6B, 0xA8, 0x1F, 0x79, 0xAC, 0x77, 0xDA, 0xB2, 0x5B, 0xCE, 0x9B, 0xF2, 0x9C, 0x9A, 0x5F, 0xE2, 0x9F, 0xF9, 0x04, 0x19, 0x00, 0xD7, 0x00, 0x58, 0xF9, 0xAC, 0x84, 0x40, 0x48, 0xA0, 0x29, 0x70, 0x31, 0xB7, 0xF1, 0xB7, 0x37, 0x5E, 0x7B, 0xD4, 0xC7, 0x84, 0xAF, 0x22, 0x68, 0xD1, 0x0E, 0x89, 0xEF, 0x04, 0xC3, 0x5C, 0x06, 0xE7, 0x5A, 0x79, 0x11, 0x48, 0x24, 0xD8, 0xD1, 0x76, 0xAF, 0x5F, 0x74, 0x7F, 0x14, 0xBE, 0x49, 0x6A, 0xE7, 0x3E, 0x8D, 0x5E, 0xA3, 0xF2, 0xB7, 0x26, 0x58, 0x2B, 0x7F, 0x69, 0xD1, 0x96, 0x65, 0x6A, 0xE7, 0x69, 0x25, 0xE4, 0x12, 0xAF, 0xA8, 0x7D, 0x26, 0xF9, 0xCA, 0xE1, 0x98, 0x2C, 0x5E, 0x25, 0x9F, 0xD6, 0xA1, 0xAD, 0x82, 0x6F, 0xE0, 0x01, 0x19, 0xC0, 0xDF, 0x94, 0xE4, 0xD4, 0xA2, 0xE5, 0x5C, 0x70, 0x1F, 0x30, 0xD3, 0xC1, 0x2E, 0x52, 0x21, 0x89, 0xE2, 0x51, 0x22, 0x23, 0x43, 0xF4, 0x30, 0x18, 0x85, 0x1F, 0x8D, 0x3F, 0xCA, 0xFC, 0xD9, 0x20, 0xA6, 0x4C, 0x7C, 0x8A, 0xB1, 0x73, 0x49, 0xF3, 0x82, 0x6B, 0x44, 0xFA, 0xD2, 0xF6, 0x52, 0xCC, 0x2B, 0x76, 0xAF, 0x03, 0x10, 0x86, 0x41, 0x27, 0x7E, 0xE9, 0xFB, 0x53, 0xFD, 0x38, 0xA6, 0x78, 0x3E, 0x70, 0x6A, 0xA1, 0x3D, 0xC2, 0xC4, 0xC8, 0xCF, 0x45, 0xF0, 0x25, 0x7E, 0x32, 0x43, 0xAA, 0x19, 0xC0, 0xA0, 0xFD, 0x74, 0xDD, 0xA6, 0xD6, 0x96, 0x92, 0x63, 0x8F, 0x05, 0x3F, 0x48, 0xA3, 0xBB, 0x0C, 0x86, 0xD5, 0x5F, 0xE3, 0x37, 0x42, 0x97, 0x35, 0x36, 0x8A, 0x30, 0x23, 0xED, 0x96, 0x46, 0x68, 0xC7, 0xC5, 0xF8, 0xCA, 0x2C, 0x27, 0xE2, 0xB1, 0x4C, 0x7B, 0x65, 0xC6, 0xA6, 0x33, 0xA5, 0xA9, 0x6B, 0x4B, 0x13, 0x2D, 0x1C, 0x3C, 0xF8, 0x11, 0x8E, 0x51, 0xBB, 0x86, 0x3B, 0x22, 0xA7, 0x11, 0x7A, 0x24, 0x5D, 0x1A, 0x07, 0x35, 0xBE, 0xC9, 0xD1, 0x85, 0x03, 0x69, 0x86, 0x09, 0x5E, 0x77, 0xE2, 0x54, 0xCB, 0x0F, 0xD3, 0x01, 0x58, 0x4B, 0x14, 0x39, 0xC1, 0x12, 0xF8, 0x92, 0x57, 0xB4, 0x04, 0x5B, 0x57, 0x04, 0xDC, 0x2A, 0x6E, 0x44, 0xA1, 0x2D, 0x72, 0x91, 0x96, 0xC0, 0x2C, 0x45, 0x59, 0x1E, 0x47, 0x9A, 0x91, 0x5D, 0x18, 0x83, 0x1B, 0x4D, 0x1E, 0x25, 0x8D, 0x13, 0xF0, 0x98, 0x5C, 0xD4, 0x19, 0x8A, 0x17, 0x85, 0xC9, 0xD2, 0x4E, 0x7F, 0x98, 0x87, 0x96, 0x84, 0x73, 0x4A, 0xDD, 0x84, 0xE3, 0x99, 0xCB, 0x4E, 0x77, 0xF1, 0xA9, 0xE8, 0x8C, 0x6C, 0x77, 0x76, 0x7B, 0x84, 0xE8, 0x46, 0xFA, 0x17, 0x2D, 0xBA, 0x5D, 0xFE, 0x12, 0x41, 0x5D, 0x3B, 0xEB, 0xC3, 0x46, 0xF2, 0x99, 0x84, 0x0F, 0x38, 0x68, 0xF9, 0x16, 0x3E, 0x93, 0xE3, 0xEA, 0xE4, 0x5F, 0xF5, 0x35, 0xEF, 0x02, 0x94, 0x09, 0x18, 0x61, 0x54, 0x18, 0x04, 0x4C, 0x1D, 0xBB, 0x76, 0x8F, 0x40, 0x45, 0xB0, 0x3B, 0xFE, 0x29, 0xC1, 0x97, 0x0C, 0xB6, 0xE8, 0xD3, 0xED, 0xD1, 0xB5, 0x74, 0x08, 0x5A, 0x40, 0x53, 0xF0, 0x85, 0xF5, 0xB0, 0x40, 0xF5, 0xA9, 0x35, 0xAE, 0xF2, 0x6B, 0xBB, 0x28, 0x0A, 0x30, 0x53, 0x3E, 0x6C, 0xF8, 0xA1, 0xFC, 0x49, 0x9E, 0x73, 0xFB, 0xAF, 0xD5, 0xAF, 0x32, 0x9F, 0x37, 0xBF, 0x36, 0x50, 0xA5, 0xDF, 0x11, 0xBE, 0x11, 0x7E, 0x0D, 0xFF, 0x8F, 0x25, 0x1F, 0xD6, 0xA7, 0xB9, 0xF0, 0x45, 0xB4, 0xF7, 0xE4, 0x8F, 0x45, 0xD8, 0xEC, 0x00, 0x98, 0x81, 0xCC, 0x30, 0xCD, 0x50, 0xDD, 0x1E, 0x79, 0xB8, 0x41, 0x07, 0xD1, 0x09, 0xC0, 0x13, 0x98, 0x8A, 0xB0, 0x8B, 0x15, 0x72, 0x2B, 0xF8, 0x9A, 0x3E, 0xC9, 0x1F, 0x68, 0x6B, 0xF8, 0x69, 0x64, 0x00, 0xAC, 0x38, 0x09, 0x1D, 0xAF, 0x5D, 0x64, 0x30, 0x21, 0xBD, 0x16, 0xBF, 0x45, 0x66, 0xE1, 0x46, 0x10, 0xE6, 0x07, 0x3E, 0x0E, 0xCC, 0x4F, 0xC3, 0x69, 0x07, 0x35, 0x07, 0xBF, 0x88, 0xBF, 0x9E, 0x01, 0x46, 0xFA, 0x15, 0xB5, 0x7B, 0xFA, 0x31, 0xD7, 0x01, 0x8C, 0xE2, 0x3F, 0xCA, 0x6F, 0x9D, 0x01, 0xC8, 0x6B, 0x4B, 0x3E, 0x6B, 0xFB, 0x33, 0x4C, 0x15, 0x01, 0x26, 0xF4, 0x47, 0x65, 0x00, 0xDA, 0x01, 0x08, 0xAF, 0x33, 0xF5, 0xA7, 0x76, 0x20, 0xBA, 0xAF, 0xE7, 0x60, 0x74, 0xA4, 0x72, 0xF0, 0x9F, 0x9D, 0x81, 0x46, 0xF8, 0xB8, 0xF8, 0x49, 0x84, 0x3C, 0x82, 0x47, 0xD7, 0xA0, 0x42, 0xC0, 0xE6, 0xFE, 0xBB, 0xE1, 0xD1, 0x9B, 0x6A, 0x94, 0x6E, 0xD7, 0xF8, 0x68, 0x07, 0x31, 0x21, 0xA0, 0x12, 0x01, 0x22, 0x05, 0x79, 0x64, 0xF9, 0x6B, 0x74, 0x06, 0xD5, 0xAD, 0xEB, 0x16, 0xC9, 0xDB, 0x6D, 0x37, 0x53, 0x25, 0x00, 0x1F, 0x18, 0x90, 0x96, 0xA7, 0xA9, 0xDF, 0x4B, 0xE4, 0xE3, 0xE8, 0x9F, 0x89, 0xFF, 0x5C, 0xF8, 0xB6, 0x3E, 0xE6, 0x6D, 0x40, 0x56, 0x90, 0x28, 0xE5, 0x69, 0x52, 0x4C, 0x11, 0x19, 0x74, 0x2A, 0xEA, 0x79, 0x9C, 0x06, 0x3E, 0xF3, 0x79, 0x22, 0x25, 0x8E, 0xFA, 0x6B, 0x7C, 0xA3, 0xEB, 0xA2, 0x70, 0x41, 0x06, 0x13, 0x29, 0xE2, 0x62, 0x85, 0x73, 0x0C, 0xCC, 0xCD, 0xC0, 0x1C, 0x44, 0xE6, 0xCE, 0x1F, 0xC1, 0xEF, 0xEC, 0x00, 0xF9, 0xB3, 0xB5, 0x7C, 0x7A, 0xBB, 0xCA, 0xD4, 0x8D, 0x2C, 0x89, 0x72, 0xB7, 0x72, 0x90, 0xA9, 0x38, 0x34, 0x15, 0x31, 0x23, 0xFD, 0xED, 0xDA, 0x3D, 0x79, 0xE8, 0x8C, 0x82, 0xE7, 0x0F, 0xE4, 0x17, 0x05, 0x34, 0xCF, 0xE1, 0xCD, 0x96, 0x4F, 0x84, 0x8F, 0x93, 0x11, 0x19, 0xF8, 0xD5, 0x67, 0x01, 0x74, 0x31, 0xB5, 0xBB, 0x26, 0x41, 0x8D, 0x06, 0xB6, 0xD9, 0x47, 0x3A, 0x8F, 0x0D, 0xBF, 0xEA, 0x0F, 0xEB, 0x5D, 0xB7, 0xFD, 0x83, 0x0C, 0x2A, 0xF4, 0xB1, 0x62, 0x1A, 0x8A, 0x6B, 0x06, 0x0E, 0x07, 0x7F, 0x9D, 0x30, 0x68, 0xFE, 0x79, 0x09, 0xC5, 0xEC, 0xFB, 0x01, 0xFF, 0xE6, 0xCA, 0x73, 0x6E, 0x7F, 0xED, 0xAB, 0xB6, 0x96, 0x7F, 0x07, 0x4F, 0xCB, 0x47, 0xD3, 0xBF, 0x50, 0x1E, 0x91, 0x7C, 0xB4, 0x7E, 0x0C, 0xF7, 0x37, 0xF4, 0x8F, 0x79, 0x6C, 0x05, 0xFE, 0xEE, 0xC9, 0xC4, 0x41, 0x3D, 0x9C, 0x89, 0x8F, 0x58, 0x02, 0x08, 0x09, 0x36, 0x0A, 0x2E, 0x23, 0x3D, 0x79, 0x1E, 0x5D, 0xFC, 0xF0, 0x32, 0x88, 0xC9, 0x88, 0x6C, 0x44, 0x98, 0x32, 0xAF, 0x8C, 0x40, 0x56, 0x3F, 0xF2, 0x70, 0x4D, 0x7F, 0x5D, 0xF4, 0x30, 0xC6, 0x15, 0x0F, 0xEC, 0x65, 0x00, 0x3A, 0xA2, 0x30, 0xBD, 0x32, 0x02, 0x09, 0xC5, 0x63, 0x4F, 0x62, 0xAE, 0xB1, 0x85, 0x24, 0x26, 0xDB, 0x05, 0x9E, 0x6E, 0x4D, 0x64, 0xC9, 0xFC, 0x56, 0x0D, 0x81, 0x23, 0x98, 0xC3, 0xBF, 0x48, 0xAE, 0x0D, 0xFF, 0xA6, 0xE4, 0x32, 0x05, 0xDF, 0x31, 0xDC, 0x66, 0x97, 0xC2, 0xCB, 0x40, 0x24, 0xFE, 0x0B, 0xE6, 0x6F, 0xF8, 0xBB, 0xA5, 0x7E, 0x30, 0xBD, 0xF2, 0xF7, 0x16, 0xF0, 0xA7, 0xE0, 0x6E, 0xA0, 0x5F, 0x20, 0xEF, 0xF6, 0x69, 0xC0, 0xE2, 0x65, 0x41, 0x48, 0x29, 0xE5, 0x42, 0x22, 0x28, 0x2C, 0xD6, 0xE7, 0x75, 0xAB, 0xA7, 0x90, 0x5E, 0x39, 0x6A, 0xC7, 0x51, 0x53, 0xFD, 0xA3, 0xF1, 0x51, 0x7B, 0x81, 0x4F, 0xA7, 0xF4, 0x3A, 0xFC, 0x53, 0x87, 0xF6, 0x41, 0x97, 0x39, 0xF8, 0x37, 0xF3, 0x0F, 0xF0, 0x47, 0xE3, 0x9B, 0xF0, 0x11, 0xF3, 0xCB, 0xF6, 0x72, 0xAE, 0xDF, 0x69, 0x67, 0xDA, 0x8A, 0x3C, 0x06, 0xE6, 0x8F, 0xF8, 0xAD, 0xDB, 0x9B, 0x6B, 0x0B, 0xFE, 0x4A, 0xFE, 0x45, 0xF8, 0x44, 0xF2, 0xD5, 0xFC, 0x8B, 0xF0, 0xED, 0xE8, 0x23, 0x9A, 0x92, 0x3E, 0xCF, 0xA5, 0x0F, 0xFB, 0x8B, 0xE0, 0x50, 0x6C, 0xCF, 0xD3, 0x27, 0xA3, 0x7F, 0x47, 0x9F, 0xC2, 0x07, 0x9D, 0x93, 0x97, 0xE5, 0x74, 0xF3, 0xCD, 0x95, 0x3F, 0x05, 0x03, 0x03, 0x7E, 0xBB, 0x04, 0x68, 0x1E, 0x59, 0x2B, 0x16, 0x24, 0xAA, 0xDA, 0x04, 0x88, 0x53, 0x65, 0xF9, 0x40, 0x8A, 0x7C, 0x38, 0x9F, 0x74, 0xC5, 0x54, 0xF8, 0x74, 0x00, 0x99, 0x9C, 0x41, 0xF6, 0x30, 0x36, 0x7C, 0x16, 0x78, 0x29, 0xB8, 0x04, 0xF8, 0xC8, 0x87, 0x6D, 0xE8, 0x6D, 0x35, 0xE4, 0xC1, 0x1C, 0xF8, 0x02, 0x9E, 0x7E, 0x7E, 0xDF, 0xC4, 0x6F, 0xA2, 0x7F, 0x9A, 0x48, 0xE3, 0xC7, 0xD7, 0xF8, 0x0A, 0x8D, 0xF4, 0x8E, 0x23, 0x12, 0xA3, 0x41, 0xFF, 0xDA, 0xF9, 0x23, 0x7E, 0x9A, 0xF8, 0x31, 0xCE, 0x96, 0x3C, 0x84, 0x82, 0x69, 0x79, 0x95, 0x80, 0x20, 0xC6, 0x4B, 0xF8, 0xBA, 0xDD, 0xEA, 0x5F, 0xD6, 0xBC, 0x42, 0x9F, 0x3C, 0x03, 0x77, 0xF5, 0x65, 0x85, 0xFC, 0x4C, 0xFD, 0x60, 0x78, 0x59, 0x25, 0xCD, 0xF3, 0x62, 0x8D, 0xBE, 0x7A, 0xF2, 0x64, 0x6B, 0xE5, 0xDF, 0xC5, 0x58, 0x6A, 0x43, 0x08, 0x7F, 0x82, 0xFF, 0x1A, 0xBC, 0xC9, 0x1F, 0x35, 0x7E, 0x42, 0xBF, 0xC8, 0x01, 0xB0, 0x37, 0x22, 0x83, 0x4C, 0xAF, 0x48, 0x66, 0xC4, 0x15, 0xB6, 0x3A, 0x9D, 0xB5, 0xE8, 0x15, 0xBC, 0xEC, 0xF0, 0x8D, 0x6E, 0x44, 0xF0, 0xA3, 0xF1, 0x7B, 0xFB, 0x91, 0x39, 0x30, 0xA9, 0xBD, 0x0B, 0xE6, 0x36, 0xF4, 0x4B, 0x46, 0xE8, 0x05, 0x10, 0xF7, 0x21, 0xE3, 0x1C, 0xB8, 0xFA, 0x4D, 0x7A, 0x21, 0x88, 0x4C, 0x29, 0xAA, 0xF7, 0x23, 0xFF, 0x5C, 0xA0, 0xF1, 0xB5, 0xFE, 0xCD, 0x1D, 0x46, 0xDB, 0x75, 0xFF, 0xB9, 0xE3, 0xBD, 0x79, 0x3C, 0x7C, 0xA3, 0xF9, 0xB6, 0x6A, 0xD7, 0x6C, 0x8F, 0xF0, 0x99, 0xDB, 0x3F, 0x82, 0xF7, 0x58, 0xED, 0x91, 0xFC, 0x27, 0xF9, 0x29, 0xEC, 0x5D, 0xE3, 0x7B, 0x3C, 0x7E, 0xE4, 0x99, 0xD2, 0xBF, 0xDE, 0xFC, 0x46, 0xE0, 0x31, 0xF9, 0x39, 0x81, 0x7F, 0x81, 0x8F, 0x84, 0xC8, 0x98, 0x4A, 0x84, 0x35, 0xF0, 0x44, 0x99, 0x24, 0x37, 0xF3, 0xAB, 0xE6, 0x02, 0xFB, 0x8B, 0xE6, 0x17, 0x4C, 0x9C, 0xD4, 0x07, 0x8A, 0xEF, 0x57, 0xBF, 0xFD, 0x5F, 0x3F, 0x5B, 0x13, 0xAF, 0xC7, 0x5D, 0xCD, 0x54, 0xCF, 0xAD, 0x83, 0xCA, 0x36, 0x58, 0x3D, 0x02, 0x94, 0x88, 0xF0, 0xA8, 0xFD, 0x11, 0x50, 0x7C, 0xAD, 0xA7, 0xD0, 0xFC, 0x97, 0xD7, 0x3A, 0xB5, 0x37, 0x52, 0x7D, 0xF7, 0x84, 0x1D, 0xF7, 0x25, 0x4F, 0x51, 0x78, 0xCC, 0x40, 0x25, 0xF7, 0xAE, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0xF0, 0xBD, 0x76, 0x2D, 0x8C, 0x29, 0xFD, 0x18, 0xC1, 0x07, 0xDC, 0xCE, 0xFF, 0xFB, 0x97, 0x7F, 0xE0, 0xD5, 0x57, 0x0B, 0x5D, 0x2F, 0xCF, 0x1A, 0x5C, 0x6B, 0x0C, 0x48, 0x2F, 0xB7, 0xEC, 0xDA, 0xB2, 0x47, 0x43, 0x37, 0xD8, 0xB7, 0x73, 0xE7, 0x8C, 0x60, 0x2E, 0x3C, 0xA3, 0xBB, 0x94, 0xC4, 0x57, 0xDF, 0x55, 0x0E, 0xCD, 0x15, 0x37, 0xC5, 0x7F, 0x48, 0xF8, 0x3C, 0xBE, 0x8F, 0x3D, 0x3D, 0xFC, 0x96, 0xCC, 0x8C, 0x9F, 0x9C, 0xDF, 0x60, 0x72, 0xF3, 0x90, 0x7C, 0xCB, 0xF4, 0x68, 0x7C, 0x7A, 0xA3, 0x8B, 0x7E, 0x89, 0x41, 0x33, 0xC5, 0xB4, 0x91, 0xF7, 0xF0, 0x5B, 0x25, 0x99, 0xE6, 0x9F, 0xC5, 0x7F, 0xA0, 0x35, 0x81, 0xB0, 0xF8, 0xD7, 0xC7, 0x82, 0xE9, 0xF9, 0x19, 0xBE, 0xC8, 0x20, 0x15, 0xFB, 0xE6, 0xC9, 0x9F, 0x06, 0x8B, 0xF7, 0x1A, 0xB4, 0xF2, 0xEF, 0x73, 0xBF, 0x16, 0xBE, 0xC4, 0x7F, 0x29, 0x7D, 0x9E, 0x7E, 0x4C, 0x78, 0xC2, 0x61, 0x3F, 0x3D, 0xDC, 0x51, 0x21, 0x51, 0xB3, 0x82, 0x5E, 0x3B, 0x59, 0xBF, 0x6C, 0xFC, 0xAA, 0xFC, 0x9C, 0xF6, 0xDF, 0x92, 0x03, 0x68, 0xDE, 0x58, 0xE3, 0x3A, 0x3A, 0x99, 0x54, 0x08, 0x0F, 0x31, 0xD7, 0x91, 0x45, 0x8E, 0x6E, 0xCA, 0xD1, 0x56, 0xDF, 0x52, 0xCB, 0x14, 0x4B, 0xE7, 0x67, 0x58, 0xDE, 0x78, 0xE6, 0x99, 0x17, 0x08, 0x3A, 0x47, 0x2D, 0xBD, 0xE6, 0x00, 0x7F, 0x46, 0xE0, 0x4B, 0x9D, 0xD7, 0xFD, 0xA3, 0x40, 0x12, 0xD1, 0xA7, 0x7D, 0xEE, 0x12, 0xF8, 0x52, 0x1E, 0x73, 0xC7, 0x7B, 0xFC, 0x4B, 0x70, 0x2C, 0xFE, 0x19, 0x51, 0x69, 0x2A, 0xD0, 0x6D, 0x41, 0x5F, 0x04, 0x5F, 0xC6, 0x1C, 0x49, 0xBF, 0xB6, 0xB7, 0xDE, 0x37, 0xE5, 0x1E, 0x23, 0x81, 0xDA, 0xD3, 0xBF, 0x6E, 0xFC, 0x7C, 0xFE, 0xC0, 0x12, 0x20, 0x67, 0x00, 0x4D, 0xD9, 0xD3, 0xDB, 0x0F, 0xEE, 0x30, 0x26, 0xEC, 0x1B, 0x04, 0x85, 0xC6, 0x6A, 0x38, 0x96, 0x82, 0x94, 0xEE, 0x32, 0xB2, 0x0B, 0x05, 0xB0, 0x14, 0x8C, 0xF1, 0x7D, 0x54, 0xF8, 0x42, 0x82, 0x25, 0x2C, 0x49, 0x29, 0x5B, 0x12, 0x96, 0xFC, 0x89, 0xDA, 0x3D, 0x8D, 0x01, 0x18, 0x53, 0x0E, 0x68, 0x53, 0xFE, 0x29, 0x05, 0x6A, 0x0C, 0x68, 0x0B, 0xF9, 0x10, 0x0C, 0x53, 0x6E, 0x11, 0x7F, 0xA2, 0x76, 0x69, 0x89, 0x84, 0xF8, 0xA3, 0xEA, 0x87, 0x90, 0x9F, 0x95, 0xCC, 0x76, 0xAF, 0x84, 0x13, 0xC1, 0xD4, 0x4C, 0x0C, 0x26, 0xDA, 0x4D, 0x7D, 0x18, 0x91, 0x8F, 0xEC, 0x93, 0xFF, 0xCE, 0x35, 0x80, 0x86, 0x51, 0x98, 0x22, 0xC2, 0x0C, 0x52, 0xB1, 0x2E, 0xFA, 0x9A, 0xBC, 0xF0, 0xC9, 0xE8, 0x3D, 0xF5, 0xFC, 0x6B, 0xE5, 0x7D, 0x6A, 0xFC, 0xA3, 0xF9, 0xA3, 0xF6, 0x53, 0xD3, 0x1F, 0xE1, 0x17, 0xB5, 0x47, 0xF8, 0x4F, 0x8F, 0xCF, 0x19, 0x80, 0xE9, 0xB1, 0xF4, 0x40, 0xFF, 0xBA, 0x14, 0x50, 0x13, 0x1C, 0x8D, 0x90, 0x78, 0x1C, 0xDE, 0x99, 0xA7, 0x1D, 0xDF, 0xCF, 0x73, 0x6A, 0xF8, 0x6B, 0xF9, 0xD3, 0x8E, 0xEF, 0xF9, 0x33, 0xAF, 0x3D, 0xE2, 0xCF, 0xFC, 0xF6, 0x88, 0xBE, 0xB5, 0xF2, 0x39, 0x36, 0xFC, 0x48, 0x3F, 0x1E, 0x77, 0xFE, 0xF9, 0xFC, 0x8F, 0xF8, 0x1B, 0xE1, 0x1F, 0xB6, 0xE3, 0x51, 0x94, 0xF2, 0xB0, 0x67, 0xAB, 0x7F, 0x57, 0xB5, 0x06, 0xE0, 0x18, 0xB8, 0x91, 0x59, 0x35, 0x13, 0xBE, 0xEE, 0xED, 0x72, 0x8D, 0xBE, 0xD2, 0x91, 0x4E, 0x3F, 0x9B, 0xB0, 0xCB, 0x67, 0xE7, 0x0F, 0x06, 0xD8, 0xF1, 0xC0, 0x1C, 0x3A, 0x06, 0x5C, 0x5D, 0x16, 0x07, 0x60, 0x2D, 0x41, 0x75, 0x91, 0x46, 0x5E, 0x0B, 0x3C, 0x78, 0x49, 0x5E, 0x0A, 0x1A, 0x1A, 0x16, 0x5D, 0xEB, 0x25, 0xA5, 0xB9, 0x94, 0x36, 0xE8, 0x73, 0xC0, 0x75, 0xB7, 0xCD, 0x52, 0x84, 0xE8, 0x35, 0x55, 0x4B, 0x19, 0x99, 0x23, 0x82, 0xDF, 0xC0, 0x10, 0x8E, 0xB6, 0xE1, 0x8F, 0x51, 0x22, 0x31, 0xDB, 0x0D, 0x84, 0x66, 0xCD, 0xAF, 0xE5, 0x33, 0x42, 0xA0, 0xEC, 0xA3, 0xF1, 0x8F, 0xF0, 0x19, 0x80, 0xAF, 0xF1, 0xF7, 0xE4, 0xCF, 0xFC, 0x68, 0xDA, 0xC5, 0x92, 0x98, 0xA7, 0x5A, 0xC5, 0x0F, 0x03, 0x9E, 0x26, 0x61, 0x2E, 0x7C, 0x2D, 0xFF, 0xC8, 0x1E, 0x06, 0x58, 0xD6, 0x77, 0xD1, 0x0E, 0x40, 0x07, 0x60, 0x71, 0x6D, 0xF2, 0x4F, 0xE9, 0x5F, 0x9C, 0x01, 0x6C, 0xEC, 0x71, 0xB6, 0xF6, 0x60, 0x21, 0xBC, 0x28, 0x43, 0x79, 0xEA, 0xF4, 0xAD, 0xC5, 0x3F, 0xE2, 0x4F, 0xD4, 0x1E, 0xCD, 0x1F, 0x8D, 0x8F, 0xDA, 0x23, 0xF8, 0x7B, 0x7B, 0xFF, 0x52, 0xD3, 0x19, 0x99, 0x68, 0x72, 0x00, 0xBC, 0x74, 0xE7, 0x94, 0x41, 0xAF, 0x49, 0x4E, 0x7A, 0xCD, 0x91, 0x4C, 0x47, 0xCE, 0x47, 0xBC, 0xD6, 0xA9, 0xD4, 0x49, 0xF9, 0xC1, 0x91, 0xF9, 0x11, 0xE9, 0x5F, 0x45, 0xEF, 0x19, 0xC8, 0x6F, 0x15, 0xFE, 0x4F, 0x8D, 0xDF, 0x33, 0xF1, 0x8D, 0x33, 0x80, 0xDD, 0x43, 0xAF, 0xF2, 0xB0, 0x61, 0x86, 0xB2, 0x47, 0xB0, 0x9D, 0xBF, 0x33, 0x22, 0xF6, 0xD6, 0xFA, 0x54, 0x33, 0x00, 0xF2, 0xD4, 0x3C, 0x41, 0xFA, 0xF4, 0x35, 0x9D, 0xF2, 0x6B, 0x8A, 0xFB, 0xC2, 0xC3, 0xE8, 0x35, 0x9C, 0xB7, 0xC6, 0x37, 0xEF, 0x13, 0x9C, 0xE2, 0x5F, 0x34, 0x5C, 0xDD, 0xAE, 0xD7, 0x36, 0x46, 0x7B, 0x9B, 0xC9, 0xD8, 0xF8, 0x57, 0xFA, 0xFA, 0xDD, 0x4E, 0x33, 0x03, 0x12, 0x6B, 0xE9, 0x96, 0x0F, 0x3D, 0xFC, 0x76, 0x7C, 0xD4, 0xCE, 0x0C, 0xEF, 0x97, 0x79, 0x0D, 0x1D, 0x33, 0xE6, 0xE7, 0x48, 0xD7, 0xFC, 0xD6, 0x11, 0x58, 0x5C, 0x7B, 0xC7, 0x3D, 0xF2, 0xF8, 0xF5, 0xFC, 0x9B, 0x86, 0xEF, 0xEC, 0x36, 0x17, 0x3D, 0x88, 0xF9, 0xA7, 0x77, 0xA7, 0xB5, 0xFC, 0xBC, 0xF6, 0xDC, 0x6F, 0x63, 0xF8, 0x5E, 0xA6, 0x33, 0x91, 0x01, 0x79, 0x6B, 0xF4, 0x26, 0x63, 0x31, 0xC6, 0x33, 0xFE, 0xFC, 0xA8, 0xFE, 0x64, 0x06, 0x6F, 0x04, 0x70, 0xA9, 0x1F, 0x9B, 0x6C, 0x03, 0x8E, 0x54, 0x1B, 0xB7, 0xF6, 0x5C, 0x3B, 0x3C, 0xED, 0x19, 0xF6, 0xEB, 0x5D, 0x0F, 0xD1, 0xB1, 0xCD, 0xD3, 0x83, 0x09, 0x07, 0xB0, 0x76, 0xBF, 0x7A, 0xEE, 0x78, 0xDD, 0x7F, 0xEE, 0x78, 0x2F, 0x54, 0x7A, 0x0C, 0x89, 0xE6, 0xDB, 0x7A, 0xFE, 0x68, 0xBE, 0xA7, 0x8E, 0xFF, 0x42, 0xFA, 0x38, 0x3D, 0xEC, 0x14, 0x77, 0x6B, 0xFE, 0x47, 0xFC, 0x8D, 0xF0, 0x8F, 0xDA, 0x23, 0xF8, 0xC7, 0x6E, 0x8F, 0xF0, 0xB3, 0xDB, 0x8F, 0x5F, 0x03, 0x88, 0x6A, 0x08, 0x73, 0xDA, 0xB9, 0xAF, 0x5C, 0x53, 0xCC, 0x19, 0xBF, 0x64, 0xAD, 0xB5, 0x16, 0xFE, 0x3E, 0x3E, 0x73, 0xC0, 0x8B, 0x4C, 0x1E, 0x7F, 0x22, 0xBE, 0x31, 0xBC, 0xA8, 0xDF, 0xDA, 0xF6, 0x28, 0xA2, 0xAE, 0x85, 0x7F, 0xEC, 0xF1, 0x0D, 0xFE, 0x70, 0x51, 0xBE, 0x2E, 0x9D, 0x1D, 0xD2, 0xD3, 0x72, 0x00, 0x96, 0x01, 0x9B, 0x0C, 0x84, 0xD7, 0x82, 0xE1, 0x4B, 0x4D, 0xAC, 0x73, 0x0C, 0xFA, 0xA4, 0xE2, 0x16, 0x02, 0x40, 0x26, 0xE3, 0xCF, 0x30, 0x7E, 0xC2, 0x20, 0xB6, 0x98, 0x7F, 0x89, 0x81, 0x3D, 0x96, 0x01, 0x3D, 0x75, 0xFA, 0x2E, 0xCA, 0x01, 0xF4, 0x8E, 0xF8, 0x38, 0x35, 0x00, 0x2B, 0x52, 0x47, 0x8C, 0xDC, 0xDB, 0xF7, 0x6A, 0xF8, 0x92, 0x0C, 0x6D, 0xD7, 0x9B, 0x55, 0x7A, 0x63, 0x9E, 0x03, 0x68, 0xAA, 0x8C, 0xA2, 0x3A, 0xEF, 0x15, 0x59, 0xEC, 0x7D, 0xD6, 0xBA, 0xE6, 0xB0, 0xCF, 0x3A, 0x47, 0xED, 0x14, 0x51, 0x39, 0xB0, 0x0A, 0x41, 0x73, 0x95, 0x9A, 0x1F, 0x5A, 0x5A, 0x05, 0xDF, 0xA0, 0x6F, 0x19, 0x7C, 0x7F, 0x0D, 0xA6, 0xE1, 0xE9, 0xA3, 0xD4, 0x76, 0x15, 0x37, 0xE2, 0x8F, 0x6E, 0x77, 0xFA, 0x17, 0xFE, 0x0D, 0xF6, 0x2F, 0x7C, 0xF6, 0xFB, 0x8F, 0x9D, 0x8B, 0x98, 0x8B, 0xBF, 0xCE, 0xA0, 0x06, 0xE7, 0x3F, 0x82, 0x7E, 0x44, 0x55, 0xF8, 0x6D, 0xF4, 0xE3, 0x91, 0xF4, 0x3B, 0x90, 0x7F, 0xCD, 0x00, 0xA2, 0x54, 0x2D, 0xF2, 0xB4, 0x6B, 0xC7, 0x9F, 0x3B, 0xFC, 0x63, 0xD3, 0x17, 0xD1, 0x7F, 0xEE, 0xED, 0xA7, 0xE6, 0xCF, 0xA9, 0xE7, 0x3F, 0x77, 0xF9, 0x38, 0xF8, 0x1D, 0x67, 0x09, 0xD0, 0x6C, 0x98, 0x3B, 0x6B, 0xE3, 0xA5, 0x1F, 0x3E, 0x30, 0x22, 0x94, 0x9D, 0x99, 0xE8, 0x88, 0xEC, 0xE1, 0xB1, 0x14, 0xBF, 0x08, 0xBE, 0x9F, 0x11, 0x8C, 0x6D, 0x57, 0xCD, 0x85, 0xFF, 0xD8, 0xF4, 0x45, 0xF3, 0x1D, 0x1B, 0xFF, 0x53, 0xCF, 0x1F, 0xD1, 0x17, 0xE1, 0x17, 0xB5, 0x3B, 0xF0, 0x8B, 0xA3, 0x5B, 0x3B, 0x7F, 0x1E, 0x3F, 0xDF, 0x01, 0xB8, 0xDB, 0x36, 0x11, 0x41, 0x7B, 0xFB, 0x98, 0xE1, 0xEF, 0x7C, 0xDA, 0xF9, 0xD4, 0x17, 0xEB, 0xCC, 0x5D, 0x94, 0x0D, 0x6A, 0x6D, 0x1B, 0x9E, 0x03, 0x10, 0x8B, 0x69, 0xF3, 0x28, 0x9A, 0xBF, 0xC6, 0x1B, 0x8B, 0xE0, 0x73, 0x23, 0x6A, 0xD4, 0xDF, 0x6B, 0xD7, 0x74, 0x8C, 0x66, 0x08, 0xA3, 0xF3, 0x79, 0xF0, 0xA3, 0xF1, 0x11, 0xFF, 0xA2, 0xF1, 0x6B, 0xE5, 0x33, 0x0A, 0x5F, 0x2C, 0xCA, 0xCD, 0xA3, 0x80, 0x5E, 0xFB, 0x5A, 0xF8, 0x8F, 0x45, 0xDF, 0xB1, 0xF5, 0xE3, 0x71, 0xF9, 0x77, 0xFE, 0xDB, 0x80, 0xD1, 0xDA, 0x2A, 0x5A, 0xFB, 0x45, 0xED, 0xC7, 0x86, 0x1F, 0xCD, 0xFF, 0xD4, 0xDB, 0x2F, 0x96, 0x7F, 0x83, 0x29, 0xF6, 0x5A, 0xF9, 0x1D, 0x9B, 0x7F, 0x01, 0xFC, 0xFE, 0x7D, 0x00, 0x7A, 0x80, 0x26, 0x50, 0x5C, 0x8F, 0x3C, 0x6F, 0x8C, 0xE0, 0xCC, 0x1F, 0x9E, 0x47, 0x38, 0x3C, 0xBD, 0x6F, 0x3F, 0xF9, 0x3C, 0xB8, 0x18, 0xDF, 0xC0, 0x8F, 0xF0, 0x17, 0xED, 0x8B, 0xF0, 0x9F, 0x01, 0xDF, 0x3E, 0x87, 0xA0, 0x22, 0xF9, 0x04, 0x7F, 0x27, 0x9F, 0x27, 0xD7, 0xF4, 0xAF, 0xBD, 0xF6, 0x14, 0x79, 0x14, 0x3F, 0x63, 0x7E, 0xFD, 0xAC, 0x88, 0x29, 0xA7, 0xB9, 0x06, 0xB4, 0x14, 0x9F, 0x51, 0xFA, 0x22, 0xF9, 0x7A, 0xF3, 0x6F, 0x05, 0x3F, 0x9A, 0x3F, 0x6A, 0x8F, 0xF8, 0xA3, 0xC6, 0xCF, 0xAF, 0x01, 0x44, 0x1E, 0x6B, 0x6F, 0x5F, 0xB5, 0x2F, 0x3B, 0xF7, 0x2C, 0xF7, 0xDE, 0xDF, 0x5B, 0xA2, 0xED, 0xF7, 0x47, 0x6A, 0x29, 0x13, 0xE7, 0x00, 0x62, 0x06, 0x5E, 0x43, 0x41, 0x10, 0x3F, 0x22, 0x96, 0x7E, 0x8E, 0x55, 0xD5, 0x77, 0xE0, 0x5F, 0xC3, 0x7C, 0xF7, 0x14, 0x62, 0xEC, 0x73, 0x00, 0x1A, 0x7F, 0x27, 0xA5, 0x2B, 0x19, 0x48, 0xB4, 0x06, 0x8D, 0xF9, 0x31, 0xCD, 0x70, 0x7F, 0x7E, 0x9B, 0x7F, 0x83, 0x29, 0x68, 0x71, 0xB8, 0x73, 0xE1, 0xCF, 0xA5, 0x67, 0x2E, 0xFC, 0x8D, 0xF0, 0x1F, 0xA0, 0x2F, 0x6F, 0x3A, 0x6D, 0x3D, 0x1F, 0xF1, 0xC7, 0xD5, 0xEF, 0x8D, 0xE6, 0xDB, 0xCC, 0x7E, 0x1C, 0x79, 0x06, 0xF8, 0xEF, 0x19, 0xC0, 0x9E, 0xB1, 0xEC, 0x19, 0xCB, 0x6B, 0x7C, 0x02, 0x71, 0xE8, 0x24, 0xE0, 0x58, 0x95, 0x7E, 0x30, 0xE2, 0x46, 0x1E, 0xFD, 0x68, 0xED, 0x51, 0x84, 0x8F, 0xDA, 0x23, 0xFA, 0xA2, 0xF1, 0x6B, 0xDB, 0x8F, 0x3D, 0xFF, 0xA5, 0xC3, 0x3F, 0x35, 0x7D, 0xD1, 0xFC, 0xA7, 0x69, 0x37, 0x32, 0x80, 0x28, 0xB5, 0xE1, 0x76, 0xAF, 0xDF, 0xDA, 0xF6, 0x28, 0x35, 0xDD, 0x0A, 0xFE, 0xB1, 0xF0, 0x5F, 0x8B, 0xDF, 0xB9, 0x8F, 0x2F, 0x6B, 0x26, 0xF5, 0x46, 0x0F, 0x7D, 0xFF, 0xA9, 0xF2, 0xF7, 0xB1, 0xE8, 0xF3, 0xF4, 0xFC, 0x71, 0xE5, 0x9F, 0x1C, 0x40, 0xBB, 0x86, 0xD6, 0x08, 0x78, 0x91, 0xAB, 0xDE, 0x6F, 0xCF, 0x46, 0x1F, 0x8B, 0x80, 0x08, 0x2F, 0x4F, 0x01, 0x63, 0xFC, 0xDB, 0x67, 0x1F, 0xE6, 0xE2, 0x1F, 0xC1, 0xF7, 0xF0, 0x1E, 0x1D, 0xE7, 0x45, 0x86, 0x08, 0xEE, 0x53, 0x83, 0x1F, 0xC9, 0x2F, 0x92, 0x7F, 0xD4, 0x7E, 0x2A, 0xF8, 0x91, 0xFC, 0x22, 0xBC, 0xE4, 0x78, 0x7C, 0xCA, 0x15, 0x5E, 0xF0, 0x3F, 0x79, 0xCE, 0xC6, 0xD3, 0x5F, 0x9B, 0x3F, 0xF1, 0x39, 0x80, 0x92, 0x92, 0x47, 0x91, 0x39, 0x2A, 0x42, 0xF4, 0xED, 0x6D, 0x11, 0x71, 0x7B, 0xF8, 0x8B, 0x8A, 0x72, 0x7A, 0x09, 0x52, 0x8A, 0x28, 0x73, 0xF1, 0x1B, 0xCD, 0xA4, 0x82, 0x48, 0xE0, 0xCE, 0x1F, 0xC1, 0x8F, 0xF0, 0xA5, 0xF1, 0xC7, 0xA6, 0xEF, 0xD8, 0xF0, 0x5D, 0xFD, 0x8C, 0xE8, 0x8B, 0xF8, 0x37, 0xD8, 0x1E, 0xD1, 0x17, 0xB5, 0x2F, 0xC6, 0x9F, 0xE4, 0xBB, 0x58, 0x3F, 0x32, 0x7D, 0xF3, 0xCF, 0x01, 0x08, 0x84, 0xA3, 0x7D, 0xF4, 0xD1, 0x7D, 0x70, 0xFD, 0x34, 0x9C, 0x7E, 0x5A, 0x2E, 0xD1, 0xE8, 0x31, 0x4A, 0xE8, 0xB9, 0xD9, 0x6F, 0x42, 0x00, 0xE6, 0x3E, 0xB5, 0x9E, 0x87, 0xC7, 0x7B, 0x70, 0xC4, 0x7D, 0x73, 0x37, 0x22, 0x52, 0x80, 0x73, 0x69, 0x9F, 0x43, 0x9F, 0xFC, 0xD2, 0xCC, 0xB9, 0xE0, 0x3F, 0xA1, 0x1F, 0x91, 0xFE, 0x5C, 0x62, 0xBB, 0xF8, 0xC0, 0x72, 0x96, 0x90, 0xC3, 0x9F, 0x7D, 0x17, 0x60, 0x6D, 0x86, 0xB3, 0x8F, 0xDF, 0x77, 0x11, 0x9E, 0xF0, 0x2E, 0x42, 0xBF, 0x0B, 0x10, 0x79, 0x74, 0x23, 0x42, 0x46, 0xDF, 0x15, 0x18, 0x39, 0x90, 0x10, 0x46, 0x78, 0x9D, 0x79, 0x4C, 0x5C, 0xCF, 0x9A, 0x8F, 0x33, 0x08, 0xB1, 0x8F, 0x6C, 0xBF, 0xDF, 0x20, 0x4A, 0xB9, 0xFC, 0x94, 0xDB, 0x7E, 0x7E, 0x5C, 0xA7, 0xA8, 0x35, 0xE5, 0x9C, 0x3C, 0xD7, 0x70, 0x86, 0xF2, 0xD1, 0x11, 0x66, 0xEC, 0x5C, 0x46, 0xB4, 0x44, 0xA9, 0xED, 0x11, 0xFF, 0x66, 0xE9, 0xDF, 0x06, 0xFC, 0x9B, 0xD4, 0x2F, 0x03, 0x7E, 0x24, 0x4F, 0x7D, 0x8E, 0x61, 0x52, 0xFF, 0xE6, 0x06, 0x1C, 0x43, 0xBF, 0x65, 0xCD, 0xAB, 0xAF, 0x01, 0x44, 0x0C, 0xDA, 0xDB, 0x27, 0x53, 0xAA, 0xB2, 0x62, 0xD8, 0x53, 0xD2, 0xFD, 0x15, 0x69, 0xA7, 0x78, 0x45, 0x5C, 0xE4, 0x20, 0x94, 0xFD, 0x76, 0xDF, 0x05, 0xC0, 0xF1, 0x8D, 0x47, 0x1F, 0xBD, 0x2E, 0x9A, 0x4F, 0x72, 0x67, 0x44, 0xF4, 0xFD, 0x09, 0x78, 0x93, 0x67, 0xFF, 0x37, 0x80, 0x6F, 0xD6, 0x24, 0x04, 0x5C, 0xFE, 0x53, 0xBF, 0x97, 0xBF, 0xB9, 0x6F, 0xE0, 0x7F, 0x05, 0xE9, 0xCB, 0x03, 0xBC, 0x6C, 0x71, 0xF4, 0xD9, 0x05, 0x13, 0xBE, 0xE0, 0xD7, 0xDC, 0xF9, 0x17, 0xC9, 0x6B, 0x81, 0x7C, 0x26, 0xF9, 0xA7, 0xE1, 0xCD, 0x80, 0xAF, 0x5F, 0x1F, 0xB1, 0x88, 0x9E, 0x63, 0xEB, 0x47, 0x44, 0xDF, 0xDA, 0x76, 0xAD, 0x87, 0x06, 0xBC, 0x51, 0xFD, 0x9A, 0xC3, 0x3F, 0xA8, 0x01, 0xFC, 0xAC, 0xD8, 0xBC, 0x61, 0x0B, 0xFB, 0xAD, 0x9D, 0x03, 0x3B, 0x07, 0x2E, 0x98, 0x03, 0xBB, 0x03, 0xB8, 0x60, 0xE1, 0xEE, 0xA4, 0xED, 0x1C, 0x88, 0x38, 0xB0, 0x3B, 0x80, 0x88, 0x43, 0x7B, 0xFB, 0xCE, 0x81, 0x33, 0xE7, 0x00, 0x1C, 0x0F, 0xAA, 0x0F, 0xE5, 0x31, 0xAE, 0xE6, 0xCD, 0x9E, 0x90, 0xDD, 0x01, 0x9C, 0xB9, 0x70, 0x77, 0xF4, 0xCE, 0x81, 0x03, 0x5C, 0xCD, 0x3B, 0x07, 0x5C, 0xB6, 0xC5, 0x61, 0x77, 0x00, 0xDB, 0xF2, 0x73, 0x87, 0xB6, 0x73, 0xE0, 0x49, 0x71, 0x60, 0x77, 0x00, 0x33, 0x53, 0xA6, 0xC5, 0xD2, 0xBD, 0xDC, 0x20, 0xB2, 0x98, 0x25, 0xFB, 0xC0, 0xD3, 0x73, 0x60, 0x77, 0x00, 0xA7, 0x97, 0xC1, 0x8E, 0xC1, 0xCE, 0x81, 0x93, 0x71, 0x60, 0x77, 0x00, 0x23, 0xAC, 0xDF, 0x20, 0x7A, 0x0F, 0xD6, 0x64, 0x46, 0xB0, 0xB9, 0xD0, 0x3E, 0xA7, 0xE4, 0xD0, 0x29, 0xE7, 0x3E, 0xAD, 0x38, 0x77, 0x07, 0x70, 0x5A, 0xFE, 0xEF, 0xB3, 0xEF, 0x1C, 0x38, 0x29, 0x07, 0x76, 0x07, 0x70, 0x52, 0xF6, 0xEF, 0x93, 0xEF, 0x1C, 0x38, 0x2D, 0x07, 0x76, 0x07, 0x70, 0x5A, 0xFE, 0xEF, 0xB3, 0xEF, 0x1C, 0x38, 0x29, 0x07, 0x76, 0x07, 0x70, 0x52, 0xF6, 0xEF, 0x93, 0xEF, 0x1C, 0x38, 0x2D, 0x07, 0x76, 0x07, 0x70, 0x5A, 0xFE, 0xEF, 0xB3, 0xEF, 0x1C, 0x38, 0x29, 0x07, 0x76, 0x07, 0x70, 0x52, 0xF6, 0xEF, 0x93, 0xEF, 0x1C, 0x38, 0x2D, 0x07, 0x76, 0x07, 0x30, 0xCA, 0xFF, 0xD7, 0x77, 0xA7, 0x68, 0x94, 0x43, 0x7B, 0xBF, 0x15, 0x1C, 0xD8, 0x60, 0xA7, 0x79, 0xD1, 0xEC, 0xBB, 0x03, 0x58, 0xC4, 0xB6, 0x7D, 0xD0, 0xCE, 0x81, 0xCB, 0xE0, 0xC0, 0xEE, 0x00, 0x2E, 0x43, 0x8E, 0x3B, 0x15, 0x3B, 0x07, 0x16, 0x71, 0x60, 0x77, 0x00, 0x8B, 0xD8, 0xB6, 0x0F, 0xDA, 0x39, 0x70, 0x19, 0x1C, 0xD8, 0x1D, 0xC0, 0x65, 0xC8, 0x71, 0xA7, 0x62, 0xE7, 0xC0, 0x22, 0x0E, 0xEC, 0x0E, 0x60, 0x11, 0xDB, 0xF6, 0x41, 0x3B, 0x07, 0x2E, 0x83, 0x03, 0xC7, 0x73, 0x00, 0x7B, 0xD5, 0xFC, 0x32, 0x34, 0x64, 0xA7, 0xE2, 0xA2, 0x39, 0x70, 0x3C, 0x07, 0x70, 0xD1, 0x6C, 0xDB, 0x89, 0xDB, 0x39, 0x70, 0x19, 0x1C, 0xD8, 0x1D, 0xC0, 0x65, 0xC8, 0x71, 0xA7, 0x62, 0xE7, 0xC0, 0x22, 0x0E, 0xEC, 0x0E, 0x60, 0x11, 0xDB, 0xF6, 0x41, 0x3B, 0x07, 0x2E, 0x83, 0x03, 0x8E, 0x03, 0xD8, 0x17, 0xF0, 0x97, 0x21, 0xDE, 0x9D, 0x8A, 0x9D, 0x03, 0xD3, 0x1C, 0xD8, 0x33, 0x80, 0x5D, 0x43, 0x76, 0x0E, 0xBC, 0xC6, 0x1C, 0xD8, 0x1D, 0xC0, 0x6B, 0x2C, 0xFC, 0x9D, 0xF4, 0x9D, 0x03, 0xBB, 0x03, 0xD8, 0x75, 0x60, 0xE7, 0xC0, 0x6B, 0xCC, 0x81, 0xDD, 0x01, 0xBC, 0xC6, 0xC2, 0xDF, 0x49, 0xDF, 0x39, 0xB0, 0x3B, 0x80, 0x5D, 0x07, 0x76, 0x0E, 0xBC, 0xC6, 0x1C, 0xD8, 0x1D, 0xC0, 0x6B, 0x21, 0xFC, 0x53, 0x3D, 0x6D, 0xFE, 0x5A, 0x30, 0xF7, 0x49, 0x13, 0xB9, 0x3B, 0x80, 0x27, 0x2D, 0xBE, 0x1D, 0xF9, 0x9D, 0x03, 0xEB, 0x38, 0xB0, 0x3B, 0x80, 0x75, 0xFC, 0xDB, 0x47, 0x9F, 0x80, 0x03, 0x7B, 0x3E, 0xB3, 0x1D, 0xD3, 0x77, 0x07, 0xB0, 0x1D, 0x2F, 0x77, 0x48, 0x3B, 0x07, 0x9E, 0x1C, 0x07, 0x76, 0x07, 0xF0, 0xE4, 0x44, 0xB6, 0x23, 0x7C, 0x1C, 0x0E, 0xBC, 0x9E, 0x79, 0xC5, 0xEE, 0x00, 0x8E, 0xA3, 0x4D, 0x3B, 0xD4, 0x9D, 0x03, 0x4F, 0x82, 0x03, 0xBB, 0x03, 0x78, 0x12, 0x62, 0xDA, 0x91, 0xDC, 0x39, 0x70, 0x1C, 0x0E, 0xEC, 0x0E, 0xE0, 0x38, 0x7C, 0xDD, 0xA1, 0xEE, 0x1C, 0x78, 0x12, 0x1C, 0xD8, 0x1D, 0xC0, 0x93, 0x10, 0xD3, 0x8E, 0xE4, 0xCE, 0x81, 0xE3, 0x70, 0x60, 0x77, 0x00, 0xC7, 0xE1, 0xEB, 0x0E, 0x75, 0xE7, 0xC0, 0x93, 0xE0, 0xC0, 0xE3, 0x3B, 0x80, 0xD7, 0xB3, 0xD8, 0xFA, 0x24, 0x94, 0x61, 0x47, 0x72, 0x06, 0x07, 0x2E, 0xE4, 0x95, 0x19, 0x8F, 0xEF, 0x00, 0x26, 0x78, 0x7C, 0x21, 0x3C, 0x9D, 0xA1, 0x45, 0x7B, 0xD7, 0x9D, 0x03, 0xA7, 0xE5, 0xC0, 0x59, 0x39, 0x80, 0xD3, 0xB2, 0x62, 0x9F, 0x7D, 0xE7, 0xC0, 0xEB, 0xC7, 0x81, 0xDD, 0x01, 0x5C, 0xA8, 0xCC, 0xF7, 0x6C, 0xEA, 0x42, 0x05, 0xBB, 0x31, 0x59, 0x9B, 0x38, 0x80, 0x5D, 0xD9, 0x36, 0x96, 0xCA, 0x0E, 0x6E, 0xE7, 0xC0, 0x23, 0x71, 0x60, 0x13, 0x07, 0xF0, 0x48, 0xB8, 0xEE, 0xD3, 0x5C, 0x38, 0x07, 0xF6, 0x40, 0xF2, 0xF8, 0x02, 0xDE, 0x1D, 0xC0, 0xE3, 0xF3, 0x7C, 0x9F, 0x71, 0xE7, 0xC0, 0xD9, 0x70, 0x60, 0x77, 0x00, 0x67, 0x23, 0x8A, 0x1D, 0x91, 0x9D, 0x03, 0x8F, 0xCF, 0x81, 0xDD, 0x01, 0x3C, 0x3E, 0xCF, 0xF7, 0x19, 0x77, 0x0E, 0x9C, 0x0D, 0x07, 0x76, 0x07, 0x70, 0x36, 0xA2, 0xD8, 0x11, 0xD9, 0x39, 0xF0, 0xF8, 0x1C, 0xD8, 0x1D, 0xC0, 0xE3, 0xF3, 0x7C, 0x9F, 0x71, 0xE7, 0xC0, 0xD9, 0x70, 0x60, 0x77, 0x00, 0x67, 0x23, 0x0A, 0x1B, 0x91, 0xFD, 0xE4, 0xF4, 0x29, 0x04, 0xF4, 0xFA, 0x70, 0xFD, 0x84, 0x0E, 0x60, 0xDF, 0xF4, 0x39, 0x85, 0x6A, 0xEF, 0x73, 0x2E, 0xE4, 0xC0, 0x85, 0xAA, 0xEB, 0x09, 0x1D, 0xC0, 0x42, 0x41, 0xEC, 0xC3, 0x76, 0x0E, 0x9C, 0x8C, 0x03, 0x97, 0x97, 0x19, 0x5C, 0xAE, 0x03, 0xB8, 0x50, 0x8F, 0x7D, 0x32, 0xDD, 0xDF, 0x27, 0xBE, 0x48, 0x0E, 0x5C, 0xFD, 0xF6, 0x7F, 0xFF, 0xEC, 0xE1, 0x70, 0xBF, 0x8C, 0xB6, 0xCB, 0xF3, 0x87, 0xCB, 0xF8, 0xB0, 0x8F, 0xDA, 0x39, 0xF0, 0x54, 0x39, 0x70, 0xB9, 0x19, 0xC0, 0x53, 0x95, 0xC8, 0x8E, 0xF7, 0xCE, 0x81, 0x47, 0xE4, 0xC0, 0xEE, 0x00, 0x1E, 0x91, 0xD9, 0xFB, 0x54, 0x3B, 0x07, 0xCE, 0x8D, 0x03, 0xBB, 0x03, 0x38, 0x37, 0x89, 0xEC, 0xF8, 0x6C, 0xC8, 0x81, 0xBD, 0x10, 0x14, 0x31, 0x73, 0x77, 0x00, 0x11, 0x87, 0xF6, 0xF6, 0x9D, 0x03, 0x17, 0xCC, 0x81, 0xCD, 0x1C, 0xC0, 0xEE, 0x6B, 0x2F, 0x58, 0x4B, 0x76, 0xD2, 0x2E, 0x96, 0x03, 0x9B, 0x39, 0x80, 0x8B, 0xE5, 0xD0, 0x4E, 0xD8, 0xCE, 0x81, 0x0B, 0xE6, 0xC0, 0xEB, 0xED, 0x00, 0xF6, 0x7D, 0xCC, 0x0B, 0x56, 0xED, 0x9D, 0xB4, 0x11, 0x0E, 0xBC, 0xDE, 0x0E, 0x60, 0x84, 0x43, 0x7B, 0x9F, 0x9D, 0x03, 0x17, 0xCC, 0x01, 0x70, 0x00, 0xFF, 0xF0, 0x70, 0xE0, 0x48, 0x38, 0xEB, 0xF7, 0xC3, 0xE1, 0x70, 0x05, 0x03, 0xE0, 0x57, 0x3B, 0x9E, 0xEF, 0x7B, 0xED, 0xBA, 0xFF, 0xD6, 0xD7, 0xD1, 0xFC, 0x5B, 0xB5, 0x47, 0x78, 0x2F, 0xE5, 0xCF, 0xB1, 0xF9, 0x16, 0xD1, 0x1F, 0xD1, 0x35, 0xDA, 0x1E, 0xD1, 0xB1, 0xB4, 0x3D, 0xC2, 0x7F, 0xB4, 0x7D, 0x94, 0x0E, 0x4F, 0xBF, 0x97, 0x8E, 0x5F, 0x3B, 0x2E, 0xE2, 0x1B, 0xC3, 0x1F, 0xD3, 0xBF, 0x15, 0x0E, 0x20, 0x22, 0x64, 0x14, 0xD1, 0x08, 0x8E, 0xD7, 0x1E, 0xC1, 0x8F, 0xDA, 0xA3, 0x79, 0xD7, 0x8E, 0x3F, 0x35, 0xFC, 0x53, 0xCF, 0x1F, 0xF1, 0x2F, 0x6A, 0x5F, 0x8B, 0xFF, 0x5A, 0xF8, 0x6B, 0xE7, 0x8F, 0xC6, 0x9F, 0xBA, 0x3D, 0xF3, 0xE7, 0xEA, 0xB7, 0xFF, 0x02, 0x19, 0x00, 0xFE, 0x74, 0x91, 0x9C, 0x10, 0xE4, 0xF4, 0xC7, 0x6B, 0x8F, 0xEE, 0x47, 0xE3, 0xA3, 0xF6, 0xB5, 0xF0, 0xA3, 0xF1, 0x51, 0x7B, 0x84, 0x5F, 0xD4, 0x1E, 0xC1, 0x8F, 0xDA, 0x23, 0xF8, 0x51, 0xFB, 0xA5, 0xC3, 0x3F, 0x77, 0xFA, 0x22, 0xFC, 0xA2, 0xF6, 0x48, 0xBE, 0x51, 0x7B, 0x00, 0x7F, 0x95, 0x03, 0x48, 0x2B, 0x80, 0x13, 0x13, 0x80, 0xF4, 0xA7, 0x95, 0xCB, 0x84, 0x03, 0x9B, 0x6C, 0x9F, 0xC0, 0xBF, 0x59, 0xE1, 0x2C, 0x80, 0xBF, 0x15, 0x7F, 0x22, 0xFA, 0x56, 0x39, 0xF0, 0x48, 0x81, 0x06, 0xF8, 0x7B, 0xD4, 0xF9, 0x23, 0xFD, 0x8A, 0xDA, 0x07, 0xE8, 0xF3, 0xF0, 0x67, 0xF9, 0xAF, 0xA5, 0xCF, 0x93, 0xDF, 0x28, 0xFC, 0x48, 0xFE, 0x51, 0xBB, 0x89, 0x3F, 0xF1, 0x65, 0xC1, 0x12, 0x20, 0x4A, 0xAD, 0xD6, 0xB6, 0x47, 0xA9, 0xD1, 0x5A, 0xF8, 0xFB, 0x78, 0xBB, 0x76, 0x23, 0x2C, 0xDD, 0xAC, 0xED, 0x9C, 0x5B, 0xBB, 0x27, 0xC7, 0x5D, 0xBE, 0x73, 0xE4, 0x9B, 0x1C, 0x80, 0x1D, 0xA9, 0x34, 0x23, 0xFD, 0xEB, 0x3C, 0x3E, 0xEA, 0xAF, 0x0D, 0x3B, 0xEA, 0x5F, 0xDB, 0x23, 0xF8, 0x11, 0xFE, 0x63, 0xE3, 0xA3, 0xF9, 0x7C, 0xFC, 0x8F, 0x3D, 0xFF, 0x53, 0x87, 0x6F, 0x16, 0x99, 0xAF, 0x80, 0xDF, 0x0F, 0xB2, 0x88, 0x3C, 0xAA, 0x5F, 0xDC, 0xCF, 0x93, 0x17, 0xD4, 0xB4, 0x81, 0x61, 0xBD, 0x3E, 0x46, 0xFA, 0x17, 0xC9, 0x37, 0xC2, 0x2F, 0x82, 0xEF, 0x3B, 0x26, 0xAD, 0x9F, 0xF6, 0x75, 0x84, 0x5F, 0x6D, 0xD7, 0xFA, 0x32, 0x05, 0xBF, 0x66, 0x00, 0x4D, 0xAA, 0x44, 0xC2, 0x99, 0xB5, 0x2B, 0x10, 0x45, 0xEE, 0x23, 0xB7, 0x47, 0xA9, 0xDE, 0x11, 0x53, 0xC5, 0x65, 0xBB, 0x28, 0x8A, 0x1F, 0x11, 0xFE, 0xA2, 0x7D, 0x68, 0x69, 0xA1, 0xE9, 0x9D, 0x01, 0x7F, 0x11, 0x3D, 0xC7, 0x86, 0x7F, 0x6A, 0xF9, 0x1D, 0x9B, 0xBE, 0x13, 0xC1, 0x9F, 0x91, 0x01, 0xCC, 0x35, 0xE0, 0xB5, 0xA9, 0x58, 0x34, 0x9F, 0x8E, 0x00, 0x91, 0x07, 0xF6, 0xE1, 0x4D, 0x7A, 0x4C, 0x57, 0x30, 0x6B, 0xE9, 0x3B, 0xF6, 0xF8, 0x71, 0xFE, 0xD9, 0x06, 0x1F, 0xE1, 0x77, 0x6C, 0xF8, 0x51, 0x86, 0x38, 0x1E, 0xF1, 0xD6, 0xD2, 0x17, 0x65, 0x60, 0x47, 0x85, 0xBF, 0x58, 0xFF, 0xC6, 0xF8, 0xB3, 0xA0, 0x06, 0x10, 0x09, 0x7E, 0x6F, 0x5F, 0x14, 0x41, 0xA3, 0x08, 0xB7, 0xB7, 0xAB, 0xF3, 0x26, 0xBB, 0x9E, 0x6D, 0xA1, 0x67, 0x13, 0x0E, 0x20, 0x8A, 0x00, 0x91, 0x87, 0x9E, 0x3B, 0x7E, 0x6E, 0x04, 0xDF, 0x1A, 0xBE, 0x5E, 0x5B, 0xE2, 0x35, 0xE0, 0x84, 0xEB, 0x54, 0x73, 0x29, 0x34, 0x77, 0xFE, 0x88, 0x5F, 0x4C, 0x7F, 0xBF, 0xC6, 0x7D, 0xDC, 0xF9, 0x35, 0x1E, 0x9E, 0xA1, 0x79, 0xF4, 0x9C, 0x0A, 0x7F, 0x4B, 0x7E, 0xD6, 0x41, 0xB5, 0x73, 0xA7, 0xEF, 0x71, 0xF9, 0x17, 0x6F, 0x03, 0xAE, 0x8D, 0x3C, 0xC7, 0x5E, 0xDB, 0xAC, 0xC5, 0x2F, 0x1A, 0xFF, 0xD4, 0xF1, 0x3F, 0x35, 0x7D, 0x5B, 0xF2, 0xEF, 0x06, 0x80, 0xDD, 0xCD, 0x8C, 0xFC, 0x5B, 0xCE, 0xFF, 0x94, 0x6A, 0x62, 0x91, 0xDC, 0xA9, 0xFD, 0xE9, 0x3B, 0x00, 0x23, 0x70, 0x36, 0x11, 0x33, 0x52, 0x80, 0x09, 0x46, 0x45, 0xFB, 0xB4, 0xD1, 0x39, 0x81, 0xB6, 0xBD, 0xCF, 0x18, 0x22, 0xF8, 0x89, 0x8E, 0x08, 0xFF, 0xE1, 0x76, 0x27, 0x63, 0x19, 0x1E, 0xDF, 0x1B, 0x5E, 0x8B, 0xFF, 0xF6, 0xF0, 0xED, 0x23, 0xE6, 0xFE, 0xDA, 0x96, 0xFB, 0xF3, 0x9A, 0x7D, 0x94, 0xBF, 0x73, 0xF7, 0xE9, 0x8F, 0x0D, 0xBF, 0xA1, 0x63, 0x40, 0xBF, 0xC7, 0xF0, 0xEF, 0x6B, 0x66, 0x48, 0xC7, 0x5E, 0x03, 0x18, 0xF4, 0x94, 0xEE, 0x49, 0xC9, 0x7D, 0xFC, 0xBE, 0x36, 0x7F, 0xC2, 0x99, 0x41, 0x9C, 0x01, 0x0C, 0x47, 0x88, 0x85, 0x11, 0x20, 0x32, 0xA0, 0x32, 0x7F, 0xB4, 0xE6, 0xF6, 0x53, 0xC3, 0xC9, 0x6D, 0xB3, 0x63, 0xC3, 0x2F, 0xF4, 0x1D, 0x89, 0x3F, 0x6B, 0xF9, 0x17, 0xC9, 0x57, 0x2C, 0x49, 0xCD, 0x5A, 0xC4, 0x06, 0xFC, 0x1B, 0x2B, 0x66, 0x45, 0xFC, 0x8B, 0xDA, 0x1D, 0xFD, 0x88, 0xE8, 0xDF, 0x80, 0xBE, 0x48, 0xFF, 0x72, 0x04, 0xEF, 0x23, 0xF4, 0x50, 0x06, 0xB8, 0x58, 0x3E, 0x79, 0xE0, 0x9E, 0x01, 0x44, 0x06, 0xB4, 0xB7, 0xEF, 0x11, 0xFE, 0x09, 0x47, 0xF8, 0x28, 0x73, 0x5D, 0x71, 0x0E, 0x20, 0x8A, 0xC8, 0xE7, 0xD4, 0x0E, 0x2F, 0x2C, 0x7B, 0x80, 0xEA, 0x91, 0x5E, 0xB4, 0x2F, 0x3E, 0xF2, 0x0A, 0xB4, 0x25, 0xC7, 0x30, 0x76, 0x92, 0xAD, 0x3C, 0xAC, 0x40, 0xFD, 0xED, 0x93, 0x89, 0x3A, 0x42, 0xCD, 0xE5, 0x9F, 0xEE, 0x3F, 0x77, 0xBC, 0x9C, 0x7F, 0x09, 0x7D, 0xC7, 0xC6, 0x7F, 0x4B, 0xFA, 0x52, 0xC8, 0x75, 0x1E, 0x67, 0xD7, 0x8B, 0xEE, 0xD1, 0xEB, 0x88, 0xFE, 0x63, 0xE3, 0x1F, 0xC1, 0xB7, 0xDB, 0x8D, 0x0C, 0x20, 0x62, 0x4C, 0x54, 0x85, 0x15, 0x39, 0x89, 0x69, 0x60, 0x5B, 0xC1, 0xF7, 0xF0, 0x88, 0xE0, 0x8F, 0xB6, 0x7B, 0xFD, 0xA2, 0xF1, 0xA3, 0xFC, 0x39, 0x16, 0xFE, 0xC7, 0x9E, 0x7F, 0x14, 0xFE, 0x52, 0xFE, 0xAD, 0xD5, 0x9F, 0x48, 0x3E, 0x51, 0xFB, 0x28, 0x7D, 0x4B, 0xE5, 0x77, 0x2E, 0xF0, 0xC5, 0x12, 0xA0, 0x5D, 0xA3, 0x44, 0x02, 0x88, 0x3C, 0xE2, 0xD2, 0xF1, 0x91, 0x07, 0x35, 0xCA, 0xA1, 0x93, 0x0E, 0x26, 0x52, 0xC0, 0xDA, 0x3E, 0x8F, 0xFE, 0x88, 0xBE, 0xBE, 0xBD, 0x8D, 0xF8, 0x5E, 0xFB, 0xE5, 0xD2, 0x37, 0xEF, 0x85, 0x31, 0xF3, 0xF9, 0xD7, 0x66, 0x58, 0xF3, 0xE5, 0x33, 0x86, 0x9F, 0x86, 0x3B, 0xAE, 0x5F, 0x11, 0xFC, 0x53, 0xEA, 0xDF, 0xFA, 0x22, 0x20, 0xF0, 0x61, 0xB2, 0x88, 0x33, 0x5C, 0x64, 0x59, 0x5B, 0xA4, 0x89, 0x3C, 0xEB, 0xC2, 0xF6, 0xB5, 0xF8, 0x9F, 0x3B, 0x7F, 0xD6, 0xD2, 0x77, 0xEC, 0xF1, 0x11, 0xFF, 0xA2, 0xF6, 0x63, 0xE3, 0x17, 0xC1, 0x8F, 0xF0, 0x8B, 0xDA, 0x23, 0xF8, 0x51, 0x7B, 0x00, 0x7F, 0xBD, 0x03, 0x88, 0x10, 0x78, 0x0D, 0xDA, 0x79, 0x1F, 0xD6, 0xAC, 0xF6, 0xBE, 0x06, 0xF4, 0x27, 0x12, 0x3D, 0x45, 0x7B, 0x6A, 0xF4, 0x6B, 0x7C, 0xB7, 0xC6, 0xFF, 0x8C, 0xE0, 0xEF, 0xE7, 0x00, 0x2E, 0xB8, 0xBA, 0x1B, 0x55, 0x7F, 0x1F, 0xB3, 0xFD, 0x1A, 0xF8, 0x7C, 0x1F, 0x45, 0xBA, 0xBD, 0xFD, 0x24, 0xBB, 0x2D, 0x71, 0x06, 0x10, 0x09, 0x26, 0xF2, 0x90, 0x7A, 0xFC, 0x11, 0xFA, 0x2F, 0x7A, 0x3C, 0x96, 0xF1, 0x32, 0xF0, 0xB1, 0x9F, 0x0E, 0x5C, 0xB8, 0x84, 0x28, 0x4B, 0x47, 0x67, 0xCD, 0x28, 0x96, 0xFE, 0x63, 0xFB, 0xE1, 0x33, 0xF1, 0x18, 0x80, 0xBF, 0x96, 0x7F, 0x4B, 0xDF, 0xB8, 0x34, 0x4A, 0xEF, 0xD8, 0xAE, 0xC9, 0x4C, 0xBE, 0x44, 0x7A, 0x2D, 0xF4, 0x43, 0xD3, 0x37, 0x97, 0x5F, 0x63, 0xE7, 0x00, 0x2A, 0xFE, 0xC7, 0x86, 0x2F, 0x6B, 0x26, 0xFB, 0x39, 0x80, 0x51, 0x45, 0xD8, 0xFB, 0x9D, 0x24, 0x42, 0x3D, 0x66, 0xA6, 0x32, 0xEA, 0x90, 0x2E, 0xA9, 0x5F, 0x73, 0x0E, 0x20, 0xF2, 0x3C, 0x5E, 0xBB, 0x7D, 0xBF, 0xAF, 0xB2, 0x47, 0xF0, 0x3D, 0xC6, 0x4E, 0xC2, 0x37, 0x8A, 0xE7, 0xF6, 0xBE, 0x3B, 0x6D, 0xFB, 0x1A, 0x86, 0xBC, 0x0C, 0x7E, 0xEF, 0xB1, 0x9B, 0x33, 0xE2, 0x62, 0x9E, 0x88, 0xEE, 0x65, 0xFC, 0xF3, 0xAA, 0xD0, 0x2A, 0x12, 0xBA, 0x19, 0x00, 0x8D, 0x1F, 0xE0, 0x9F, 0x3E, 0x63, 0xAF, 0xE5, 0xB4, 0x0C, 0xFF, 0x3E, 0x62, 0x47, 0xFA, 0xE5, 0xD5, 0x58, 0xEC, 0x08, 0x3D, 0x4E, 0xDF, 0x2A, 0xF9, 0x44, 0xFC, 0x15, 0x9B, 0x07, 0xDE, 0x49, 0x4A, 0x3B, 0x83, 0x8A, 0xF0, 0xA7, 0x89, 0x0D, 0xF9, 0x35, 0xF4, 0x18, 0xF8, 0x71, 0x46, 0x85, 0x6F, 0x4E, 0x5A, 0x71, 0x0E, 0x60, 0xED, 0x36, 0x48, 0x94, 0xB2, 0x1D, 0x0B, 0xFE, 0x56, 0xDB, 0x44, 0x1E, 0xFE, 0xA3, 0xF0, 0x8F, 0x35, 0x5E, 0x6B, 0x84, 0x9E, 0x67, 0x2D, 0x7E, 0xC7, 0x86, 0x3F, 0x8A, 0xDF, 0xB1, 0xF4, 0x63, 0x3D, 0x7D, 0xD7, 0x60, 0x58, 0xB5, 0xE6, 0x11, 0xE1, 0x79, 0x5A, 0xF9, 0x98, 0x4B, 0x80, 0xB1, 0x35, 0x57, 0x14, 0x81, 0xA2, 0xF6, 0xA5, 0x0E, 0x20, 0x12, 0xD0, 0xFC, 0xF6, 0x79, 0xFB, 0xB0, 0x11, 0xDE, 0x75, 0xFE, 0xFC, 0x6E, 0xBA, 0xC8, 0xD0, 0x97, 0xB6, 0xFB, 0x19, 0x8D, 0xCE, 0x80, 0xB6, 0x79, 0x9F, 0x80, 0xA7, 0xA8, 0x4B, 0xF1, 0x8F, 0xF4, 0x63, 0xBC, 0x3D, 0xCA, 0x40, 0x96, 0xA5, 0xEC, 0xFC, 0x6E, 0x41, 0x8F, 0xCF, 0x11, 0x7E, 0x91, 0x9E, 0xF4, 0x19, 0x72, 0xF4, 0xF4, 0xE3, 0x3C, 0x3A, 0xC6, 0xE0, 0x6F, 0xF8, 0x42, 0x90, 0xB9, 0x0A, 0x32, 0xCE, 0xA0, 0xF3, 0x54, 0xE0, 0x53, 0xE3, 0x7F, 0xEC, 0xF9, 0x01, 0x3E, 0xFF, 0x6C, 0xF2, 0x42, 0x94, 0xB9, 0xF8, 0x46, 0x06, 0xB6, 0xB6, 0x7D, 0x2E, 0x3E, 0xE7, 0xA6, 0xDF, 0xDB, 0xE0, 0xDF, 0xEC, 0x02, 0x24, 0x4F, 0xCA, 0x42, 0xD7, 0xFC, 0x85, 0x50, 0x96, 0x22, 0x9A, 0xD1, 0x9E, 0x6E, 0x19, 0x4F, 0x33, 0x31, 0xBC, 0x21, 0xFD, 0x11, 0xF0, 0x75, 0x7F, 0x86, 0xCF, 0xF3, 0x37, 0xFB, 0xEE, 0xA3, 0x01, 0x48, 0xC3, 0x17, 0xF4, 0xD9, 0xF0, 0x7D, 0x7A, 0xE5, 0xFC, 0x85, 0x1D, 0x1D, 0xBF, 0xF4, 0xA3, 0x02, 0x15, 0x9E, 0xC6, 0xBF, 0xE1, 0x9F, 0x91, 0xC0, 0x98, 0x76, 0x18, 0xCE, 0x77, 0x0D, 0xF2, 0xBA, 0x17, 0xF2, 0x0A, 0xE6, 0x8F, 0xF4, 0x7B, 0x85, 0x7C, 0x32, 0x7D, 0xD1, 0xA3, 0x13, 0x36, 0x7E, 0x95, 0xBF, 0x31, 0xFF, 0x1A, 0xFD, 0x10, 0xF4, 0x68, 0xFE, 0xD9, 0xF8, 0x28, 0xF8, 0x7A, 0x7C, 0xA8, 0x3F, 0x33, 0xE9, 0xDB, 0x1C, 0xBE, 0xFF, 0x68, 0xC3, 0x94, 0x7E, 0x2F, 0xA8, 0x01, 0xCC, 0xF5, 0xBC, 0x51, 0xFF, 0x6D, 0x3C, 0x59, 0xAD, 0x16, 0x87, 0x9A, 0x16, 0x49, 0x6A, 0x6F, 0x6F, 0x3C, 0xF7, 0x09, 0xF9, 0x99, 0xDE, 0x00, 0xA4, 0x6B, 0x02, 0xC7, 0xC6, 0x27, 0xF2, 0x84, 0x51, 0xFB, 0xB1, 0xF1, 0xDB, 0x16, 0xBE, 0x70, 0x00, 0x1E, 0x60, 0xAF, 0x28, 0x33, 0x8A, 0x48, 0x34, 0x3E, 0x2A, 0xFA, 0x18, 0x21, 0x51, 0x1F, 0xBD, 0x6B, 0xCA, 0xEF, 0xBA, 0x7F, 0x04, 0x7F, 0x29, 0x7E, 0xA3, 0x8A, 0x79, 0xAA, 0xF9, 0x3D, 0x3E, 0x8C, 0xF2, 0x27, 0xA2, 0xEF, 0xD8, 0xF0, 0x4F, 0x3D, 0x7F, 0x44, 0x5F, 0xD4, 0xBE, 0x16, 0x7F, 0x4F, 0xEF, 0x47, 0xE5, 0x17, 0xF5, 0xCB, 0xF8, 0x89, 0x25, 0x00, 0x21, 0x5C, 0x72, 0x2E, 0xC7, 0xD3, 0xBD, 0x6E, 0xED, 0x3A, 0xC7, 0xBF, 0x34, 0xFA, 0x8F, 0x4D, 0xDF, 0xA9, 0xE1, 0xAF, 0x9D, 0x3F, 0x1A, 0x1F, 0xB5, 0xE3, 0x9A, 0xD9, 0x5C, 0x33, 0x0E, 0xDA, 0xD7, 0x5A, 0xF8, 0xC1, 0x78, 0xC8, 0x00, 0x7E, 0xD6, 0x7E, 0x1E, 0x9C, 0x2B, 0x6E, 0x05, 0x71, 0x85, 0x28, 0xBF, 0xA6, 0x24, 0xAD, 0xF9, 0x19, 0x3A, 0xFC, 0xF6, 0xFA, 0xEB, 0xFB, 0xAE, 0x01, 0xD1, 0x3C, 0x1A, 0xFE, 0x28, 0x5C, 0xEE, 0x17, 0xC2, 0xC7, 0x0E, 0x58, 0xEC, 0x20, 0xFC, 0x67, 0xC1, 0x67, 0x82, 0x61, 0xD0, 0x24, 0x7F, 0x26, 0xDA, 0xD3, 0x38, 0x9E, 0xDF, 0xC3, 0x43, 0xDC, 0x6F, 0xE8, 0x19, 0x9D, 0x1F, 0xE5, 0x21, 0x23, 0x90, 0x96, 0x8F, 0x07, 0x9F, 0x78, 0x83, 0xC4, 0x0D, 0xC9, 0x9F, 0xAB, 0x35, 0xA3, 0xF0, 0x0D, 0xFC, 0x13, 0x7D, 0x12, 0x1F, 0x82, 0x39, 0x29, 0x97, 0x29, 0xFC, 0xA7, 0xE4, 0xEB, 0xE1, 0x2B, 0xF0, 0x6F, 0xF0, 0x99, 0x2B, 0x9F, 0x01, 0x7B, 0x58, 0x0D, 0x3F, 0xE0, 0xCF, 0x4C, 0xFB, 0xCC, 0x0E, 0xA0, 0xB1, 0x64, 0xE1, 0xB1, 0xF4, 0x7D, 0xA6, 0x4F, 0xF0, 0x51, 0x90, 0x5C, 0xFF, 0x1C, 0x6A, 0xD7, 0x16, 0x2B, 0x20, 0x0D, 0x8D, 0x37, 0x67, 0xCE, 0x37, 0x9B, 0x93, 0x15, 0x46, 0xBF, 0x4D, 0xE0, 0x47, 0xF3, 0x33, 0x1E, 0x13, 0xF3, 0x7B, 0x78, 0x98, 0x55, 0xD0, 0x05, 0xFC, 0x39, 0x35, 0x7C, 0x8F, 0x45, 0x67, 0x21, 0x9F, 0x01, 0xFD, 0x3B, 0x35, 0xFF, 0xA2, 0xF9, 0x27, 0xF9, 0xAB, 0xF5, 0x4F, 0xD0, 0x2B, 0x32, 0x92, 0xB6, 0x08, 0xD8, 0x18, 0xB8, 0x15, 0x52, 0xC9, 0xBA, 0x46, 0x15, 0x94, 0xBF, 0xFF, 0xA6, 0x10, 0xED, 0xF6, 0x6D, 0x4B, 0x7B, 0x9E, 0xD3, 0x6F, 0xA7, 0x8E, 0xC1, 0xFC, 0x8F, 0x0B, 0x5F, 0x86, 0xAA, 0xCC, 0x9F, 0xE9, 0xF9, 0x31, 0x01, 0x50, 0xE7, 0x03, 0xB4, 0x20, 0x87, 0xF9, 0x4B, 0x91, 0x2B, 0x8D, 0x47, 0x3C, 0xA2, 0xF9, 0xD7, 0xF0, 0x6F, 0x3B, 0xF8, 0xB6, 0x83, 0xAE, 0xF0, 0xDB, 0xF6, 0x39, 0xFC, 0x95, 0xF4, 0x71, 0x86, 0x27, 0xD3, 0x54, 0x8B, 0xFE, 0xA5, 0xF0, 0x7D, 0x07, 0x6F, 0xCB, 0x7F, 0x6B, 0xFE, 0xE9, 0x40, 0xA7, 0xF9, 0x67, 0xE1, 0x47, 0x7D, 0x4A, 0x06, 0x9A, 0xDE, 0x0A, 0x2C, 0x96, 0x00, 0x9D, 0x47, 0x99, 0x1B, 0x2A, 0x75, 0xFF, 0x60, 0x7C, 0xE1, 0x54, 0x3B, 0x71, 0x19, 0xA5, 0xDB, 0xA3, 0xEB, 0xB9, 0xF8, 0x87, 0xF0, 0xE6, 0xD2, 0xEF, 0x59, 0xB2, 0xE3, 0xAA, 0x3B, 0xFA, 0xA3, 0xF9, 0xCE, 0x0C, 0x7E, 0x39, 0xA0, 0xD1, 0x44, 0x0E, 0x2F, 0x2E, 0x19, 0xF7, 0xE7, 0xD2, 0x3B, 0x03, 0xF4, 0x50, 0xD7, 0xB9, 0xFA, 0x19, 0xE9, 0xB7, 0x6A, 0x77, 0xF4, 0xBB, 0xA0, 0x76, 0x6C, 0xF9, 0x0F, 0xC8, 0x87, 0x96, 0x00, 0x9E, 0x82, 0xCA, 0x08, 0xB3, 0x40, 0x7E, 0xA7, 0x96, 0x6F, 0xA4, 0x04, 0x11, 0x7E, 0x51, 0x7B, 0x04, 0x7F, 0x6D, 0xFB, 0xDA, 0xF9, 0xA3, 0xF1, 0x51, 0x7B, 0x84, 0x7F, 0x34, 0x3E, 0x6A, 0x8F, 0xE0, 0xAF, 0x6D, 0x3F, 0xF6, 0xFC, 0x6B, 0xE1, 0x47, 0xE3, 0xA3, 0xF6, 0x88, 0x3F, 0x03, 0xE3, 0xAF, 0x7E, 0xF3, 0xE9, 0xDF, 0xC2, 0x1B, 0x89, 0x39, 0x7D, 0x40, 0x88, 0x94, 0x86, 0x07, 0xB6, 0x3F, 0x33, 0x16, 0xCD, 0x8D, 0xCD, 0x8F, 0xDE, 0x3F, 0xE2, 0xE5, 0x5C, 0x7A, 0x07, 0x78, 0x3F, 0x77, 0xCA, 0xA6, 0xFF, 0xB9, 0xC1, 0x9F, 0x8B, 0x4F, 0xD4, 0x7F, 0x6E, 0x7B, 0xD4, 0x7F, 0xAE, 0xFC, 0xD6, 0x2A, 0xE0, 0x5C, 0x7C, 0xE6, 0x2A, 0xC3, 0x56, 0xF0, 0xAF, 0x7E, 0xFD, 0xC9, 0xDF, 0xB4, 0xBB, 0x00, 0x7A, 0x49, 0x84, 0x98, 0xF1, 0x6C, 0xD1, 0x6F, 0x9D, 0x09, 0xAE, 0xED, 0xEF, 0x65, 0x96, 0x33, 0x33, 0xB1, 0x06, 0x7F, 0x86, 0x69, 0x55, 0x99, 0x99, 0xD6, 0xEA, 0x07, 0xFB, 0x6A, 0xB8, 0x1C, 0x6F, 0xD1, 0x3B, 0xA7, 0x5D, 0xF3, 0x47, 0xCF, 0x1F, 0xF1, 0x33, 0x9A, 0x3F, 0x82, 0x7F, 0x8E, 0xF2, 0x99, 0xA3, 0x7F, 0x73, 0xF5, 0xC3, 0xE2, 0x87, 0xD6, 0xEF, 0x29, 0xF9, 0x8D, 0xC8, 0x67, 0x4B, 0xF9, 0x5B, 0xF2, 0xD9, 0x12, 0x3E, 0x9A, 0x76, 0x71, 0x00, 0x09, 0x70, 0xB5, 0xAC, 0x6B, 0x10, 0xC4, 0x7D, 0xBA, 0x45, 0xF7, 0x78, 0xFB, 0x8A, 0x8B, 0x4D, 0xA2, 0xE6, 0x90, 0x86, 0x4E, 0xD4, 0x0C, 0x6B, 0xBB, 0xB0, 0xDC, 0x32, 0x7E, 0x02, 0x3E, 0x36, 0x69, 0x82, 0x25, 0x3E, 0x52, 0x20, 0x0A, 0xFF, 0x5A, 0x13, 0x93, 0xDE, 0x42, 0xCD, 0xAF, 0xE1, 0x4F, 0x5D, 0x5B, 0xF0, 0x53, 0xFF, 0x41, 0xF8, 0xEE, 0x78, 0x22, 0xD0, 0xE2, 0x9F, 0xC4, 0xC7, 0xA5, 0x4F, 0xF0, 0x68, 0x64, 0x7B, 0x53, 0xF2, 0xD3, 0x82, 0x2F, 0xB7, 0x47, 0xB5, 0xC2, 0x33, 0xEF, 0x47, 0xE5, 0x1D, 0x8D, 0x97, 0xFA, 0x35, 0x29, 0x3F, 0x49, 0x23, 0x29, 0x8E, 0xC9, 0x2F, 0x26, 0x48, 0x6C, 0x63, 0xCA, 0xA1, 0x52, 0x56, 0x5A, 0xFF, 0xF4, 0xFC, 0xCD, 0x38, 0x43, 0xBF, 0x75, 0xFB, 0x5A, 0xFD, 0x58, 0x22, 0xFF, 0x29, 0xFD, 0x8B, 0xF0, 0xA7, 0xF9, 0xAE, 0x7E, 0xFD, 0x29, 0x64, 0x00, 0xE2, 0x07, 0x6A, 0xD8, 0x60, 0x3B, 0xCC, 0x40, 0xBC, 0x42, 0xDB, 0xAE, 0x5D, 0x4A, 0x3B, 0x11, 0x3C, 0xDD, 0x9E, 0x6A, 0xE2, 0xCD, 0xF8, 0xD6, 0x60, 0xE2, 0xF6, 0xD2, 0xBF, 0x30, 0x68, 0x30, 0xFC, 0x33, 0x81, 0x33, 0xE7, 0xD7, 0xF8, 0xCE, 0xC5, 0x3F, 0x1A, 0xBF, 0x2D, 0xFF, 0xB6, 0x97, 0x4F, 0x84, 0x5F, 0xEF, 0xF0, 0xD8, 0x1B, 0x64, 0x25, 0x8A, 0xE8, 0x6F, 0xE5, 0x19, 0xE1, 0x1F, 0xC1, 0x13, 0x06, 0x4F, 0x3A, 0x3C, 0x3C, 0xBF, 0xD3, 0x5F, 0xEB, 0x67, 0xA4, 0xAF, 0xD1, 0x7C, 0x67, 0xDF, 0xFE, 0xEB, 0x4F, 0xFE, 0xB6, 0x2E, 0x01, 0xF8, 0x89, 0x8D, 0x24, 0x53, 0x2B, 0xC4, 0x93, 0x4B, 0x4F, 0x36, 0x28, 0xFC, 0x46, 0x63, 0x93, 0x70, 0xD1, 0xB4, 0xAB, 0x6B, 0xF6, 0x5A, 0x12, 0xBE, 0xEC, 0x9F, 0xA2, 0xCC, 0x5A, 0xF8, 0xE4, 0xB1, 0xD9, 0xB1, 0x95, 0xA7, 0x9C, 0x70, 0x6B, 0x48, 0xC0, 0x77, 0x33, 0x0C, 0x31, 0x7F, 0xE9, 0x4F, 0x8A, 0xAE, 0xF1, 0x6B, 0xDA, 0x93, 0x05, 0x28, 0xFC, 0x99, 0xFE, 0xA2, 0x71, 0xD4, 0xCE, 0x7D, 0xC9, 0x53, 0x31, 0x3F, 0x1A, 0xFC, 0x04, 0x82, 0x9D, 0x38, 0xC4, 0x96, 0x0E, 0xDB, 0x60, 0x43, 0x0F, 0xD1, 0xDA, 0x45, 0x74, 0x45, 0x7F, 0xF9, 0xFC, 0x39, 0x7B, 0x4C, 0x85, 0x4F, 0x12, 0x39, 0x8C, 0xF1, 0xE6, 0x27, 0x95, 0x68, 0x33, 0x2E, 0xA5, 0x3F, 0x8D, 0x7C, 0x99, 0x3F, 0x2C, 0x1C, 0x86, 0x2F, 0x26, 0xD0, 0xFA, 0x53, 0xBA, 0x2A, 0xF9, 0x15, 0xF9, 0x0A, 0x79, 0x77, 0xFA, 0x63, 0xE9, 0x9F, 0xEC, 0x4F, 0x04, 0xB8, 0x19, 0x2D, 0x67, 0x1C, 0xA4, 0xE4, 0x9D, 0xFE, 0x30, 0x3F, 0xB5, 0x7C, 0x0D, 0xF9, 0x30, 0xAF, 0x1A, 0x79, 0xCD, 0x80, 0xDF, 0xC9, 0x57, 0x00, 0xEC, 0x32, 0x08, 0xE6, 0xD5, 0x94, 0x7E, 0xC9, 0x25, 0x80, 0xCC, 0x03, 0xD8, 0xA0, 0x75, 0xB0, 0x6D, 0x0C, 0xCA, 0x73, 0x00, 0xA4, 0xD8, 0x4D, 0x5E, 0x21, 0x84, 0xAD, 0x15, 0xE6, 0x31, 0xAE, 0xD5, 0xF4, 0xE1, 0xEE, 0x88, 0x47, 0xB7, 0xA5, 0x70, 0x1A, 0xF6, 0x1C, 0x7A, 0x3C, 0x3E, 0xEB, 0xFB, 0x5E, 0xD2, 0xB3, 0x76, 0xBC, 0x47, 0xCF, 0xE8, 0xFC, 0xD1, 0x78, 0x8B, 0x37, 0x16, 0x7F, 0x22, 0xF9, 0x44, 0xED, 0x91, 0xBC, 0xA2, 0xF1, 0x5E, 0x7B, 0xC4, 0xDF, 0x88, 0xFE, 0x68, 0x7C, 0xD4, 0x7E, 0x6C, 0xF8, 0xE8, 0x1B, 0x73, 0x0D, 0x00, 0x3D, 0x3C, 0xBB, 0x10, 0x11, 0x39, 0xD8, 0x52, 0x8E, 0xD5, 0xAE, 0x8F, 0xC4, 0xEA, 0xF9, 0xBA, 0x76, 0xF6, 0xB2, 0x1E, 0xBE, 0xC2, 0x0B, 0x27, 0x72, 0xA8, 0xDF, 0x10, 0xFE, 0xC2, 0x71, 0x71, 0x04, 0xE2, 0xC8, 0x57, 0x22, 0x12, 0xB9, 0x60, 0xD3, 0x40, 0x84, 0x0B, 0x1E, 0x1A, 0xCF, 0x7C, 0x36, 0x1C, 0xE6, 0xD0, 0x78, 0x03, 0x5F, 0x4E, 0x3F, 0x26, 0xC7, 0x6B, 0xF9, 0x32, 0x1C, 0x43, 0xFE, 0x11, 0xFF, 0x66, 0xCB, 0x87, 0xA3, 0x28, 0x45, 0xE0, 0xC2, 0xC7, 0xAD, 0xF4, 0x2F, 0xD2, 0x0F, 0x11, 0xC5, 0x05, 0xB9, 0xDD, 0xC1, 0x24, 0x93, 0x7F, 0xC2, 0x4B, 0x1C, 0x45, 0x3E, 0x1A, 0x7E, 0x24, 0xDF, 0xA8, 0x5D, 0xEB, 0x97, 0x6D, 0xDF, 0xD9, 0x01, 0x0C, 0x97, 0xF9, 0x9D, 0xD0, 0xD0, 0x1D, 0x7D, 0x52, 0xFD, 0x22, 0x03, 0xD4, 0xF3, 0x77, 0xFD, 0x49, 0x61, 0x86, 0xF1, 0x0C, 0x5C, 0xA7, 0x07, 0xDF, 0x8B, 0x7C, 0x97, 0x72, 0x5F, 0xB3, 0xA5, 0x18, 0x30, 0xF3, 0x57, 0x39, 0x50, 0x2F, 0x55, 0xDA, 0x5C, 0x3E, 0x11, 0x83, 0x3B, 0xC4, 0x95, 0x07, 0x09, 0x52, 0x8D, 0xD1, 0x0C, 0x2A, 0x42, 0xE3, 0xD1, 0xDB, 0x39, 0x80, 0x69, 0x87, 0xB9, 0xDD, 0x35, 0x38, 0x00, 0xA8, 0x01, 0xAC, 0xFD, 0x89, 0x52, 0xB0, 0xA8, 0x3D, 0x4A, 0xD1, 0xBC, 0xF1, 0xF0, 0xCD, 0xCF, 0xB4, 0x55, 0xD1, 0xB4, 0xEB, 0xC5, 0x90, 0x06, 0xDE, 0xB9, 0x7E, 0x02, 0x60, 0x78, 0x78, 0x1D, 0x51, 0x9B, 0x0C, 0xC5, 0xF0, 0xD8, 0xE9, 0x96, 0x17, 0x61, 0xB9, 0xBF, 0x97, 0x61, 0x79, 0xF0, 0xBC, 0x08, 0x3D, 0x3A, 0x7F, 0x84, 0x8F, 0xC0, 0xCB, 0xCC, 0xF8, 0x22, 0xFE, 0x1A, 0xF0, 0x27, 0xF5, 0x69, 0x54, 0x3E, 0x33, 0x94, 0xB2, 0xC9, 0xD0, 0x0C, 0xF8, 0x5A, 0x3F, 0x64, 0x4D, 0xC3, 0x9A, 0x46, 0xC3, 0xD3, 0xFD, 0xCD, 0x8C, 0x50, 0x47, 0xD8, 0xB9, 0xF2, 0x79, 0x2C, 0xF9, 0xB7, 0xF2, 0xB2, 0x1D, 0x80, 0x26, 0xD0, 0x94, 0x85, 0x91, 0xF2, 0x96, 0x0A, 0x58, 0x20, 0x3C, 0x13, 0xBE, 0x07, 0x4F, 0x1B, 0xAC, 0x56, 0x58, 0x6F, 0x2E, 0xCB, 0xD0, 0xA9, 0x6F, 0x74, 0x04, 0x33, 0x72, 0x58, 0x5B, 0xB7, 0x77, 0x11, 0x8A, 0x53, 0x62, 0x87, 0xB6, 0xD5, 0xF3, 0xAB, 0x94, 0x5B, 0x47, 0xFA, 0xC9, 0x8C, 0xCE, 0x70, 0x48, 0x93, 0x07, 0x2D, 0x0C, 0x79, 0x45, 0xF2, 0x67, 0x47, 0x3A, 0xA9, 0x4F, 0x9E, 0x7C, 0x11, 0x38, 0x39, 0xE2, 0x66, 0xBC, 0x95, 0x02, 0x33, 0x6E, 0x8A, 0xA1, 0xAB, 0xF9, 0x9B, 0xE3, 0x80, 0xFB, 0x73, 0x46, 0xF0, 0x45, 0x0D, 0x40, 0x78, 0xFA, 0x66, 0x8D, 0x33, 0xB1, 0x66, 0xD4, 0x6B, 0x64, 0xF3, 0x5A, 0x8C, 0x1F, 0x6A, 0xD7, 0xFD, 0xE7, 0x5E, 0x0B, 0x05, 0x8D, 0xD6, 0xB0, 0x9E, 0xE2, 0xEA, 0x71, 0xDE, 0x12, 0x26, 0x82, 0xEF, 0x19, 0x92, 0x37, 0x2E, 0xAC, 0x81, 0x90, 0xE6, 0xCC, 0x1D, 0xAF, 0x0D, 0x21, 0x5A, 0x92, 0x2D, 0xA5, 0xDF, 0x1B, 0xD7, 0xDC, 0x9F, 0x21, 0x9F, 0x21, 0x78, 0x73, 0xF5, 0x63, 0xA2, 0xBF, 0xC7, 0xFF, 0x70, 0x89, 0xAA, 0x1C, 0xEA, 0x22, 0xFE, 0x4D, 0xF0, 0x65, 0xAD, 0xFE, 0x4D, 0xF0, 0xB1, 0x2D, 0x02, 0x96, 0x35, 0x0E, 0xAF, 0x3D, 0xF4, 0x6F, 0xF2, 0x6C, 0x7A, 0xED, 0xB8, 0xF8, 0xDA, 0x5B, 0xE3, 0xE8, 0xFB, 0x5B, 0xAF, 0x85, 0x3C, 0xFA, 0xE6, 0xDC, 0x1F, 0x10, 0xD8, 0x0C, 0x05, 0xBE, 0x86, 0x22, 0xEC, 0xFD, 0x8C, 0xFE, 0xFD, 0x2B, 0xD0, 0x22, 0x43, 0x18, 0xC1, 0x57, 0xCB, 0xD7, 0x93, 0x3F, 0xF7, 0xF3, 0xF4, 0x41, 0xB7, 0xAF, 0xBD, 0x5E, 0x2B, 0x7F, 0x4F, 0x9F, 0x22, 0xFD, 0x9E, 0xA3, 0x0F, 0x4B, 0x03, 0xDD, 0x40, 0xE0, 0x35, 0xF5, 0x62, 0x44, 0x9E, 0x31, 0xFE, 0xDB, 0xD4, 0x00, 0x82, 0x8C, 0xFF, 0xBC, 0x9B, 0x65, 0x2A, 0x29, 0x53, 0x42, 0x99, 0xBA, 0x2A, 0x0A, 0x74, 0x26, 0xA3, 0x09, 0x74, 0x53, 0x68, 0xEA, 0x38, 0x3B, 0x82, 0x5B, 0xF3, 0xCB, 0xCC, 0xCC, 0x6B, 0x77, 0x52, 0xD1, 0x26, 0x05, 0xE5, 0x94, 0x79, 0x63, 0x29, 0x45, 0x4B, 0xFD, 0x8D, 0xA7, 0x5B, 0x0E, 0xCE, 0x58, 0x4A, 0x74, 0xF2, 0x55, 0x3C, 0x2A, 0x81, 0x12, 0xF9, 0x6B, 0xE4, 0xFA, 0xA3, 0xFA, 0xD1, 0xE9, 0x89, 0xA7, 0x1F, 0x0B, 0xF5, 0x6F, 0x00, 0xBE, 0x72, 0x00, 0x5A, 0x6A, 0x5B, 0x5D, 0x8F, 0xAE, 0xE3, 0xA3, 0x02, 0x9D, 0x85, 0x4F, 0x24, 0x7A, 0x6B, 0xC1, 0x25, 0xD7, 0x89, 0xD1, 0xF8, 0x4B, 0x6F, 0x97, 0xCA, 0xBD, 0x95, 0xBC, 0xA5, 0xF3, 0x5C, 0x02, 0x3F, 0xD2, 0x17, 0xAB, 0x9D, 0x0D, 0x51, 0xCF, 0x87, 0xB8, 0x68, 0x1D, 0x88, 0x16, 0xE1, 0x97, 0x2E, 0xF3, 0x4A, 0xDF, 0x19, 0x67, 0x00, 0x73, 0x43, 0x88, 0xDF, 0x3F, 0x8B, 0xDB, 0x28, 0x32, 0x5A, 0xA9, 0x55, 0xD1, 0x5D, 0x8A, 0xB0, 0x3C, 0x8E, 0x5F, 0xB1, 0xD5, 0xB5, 0xD3, 0x8D, 0xB0, 0xDD, 0x49, 0xF5, 0x42, 0x78, 0x84, 0xB7, 0x78, 0xED, 0x7A, 0xD9, 0xB7, 0x46, 0xFC, 0x43, 0x7C, 0xE5, 0x78, 0x36, 0x05, 0x99, 0x12, 0x2F, 0xCD, 0x00, 0xE6, 0xCA, 0x67, 0xAE, 0x51, 0x6D, 0x05, 0xDF, 0x80, 0xA3, 0x23, 0xB8, 0x5C, 0xC2, 0x72, 0xBD, 0xA4, 0xF3, 0x85, 0xAC, 0x0F, 0x2C, 0x6F, 0x92, 0xA7, 0xD6, 0x8F, 0xE2, 0x9B, 0x74, 0xFF, 0xA5, 0xD7, 0x9E, 0xFC, 0x79, 0xFE, 0x51, 0xFD, 0xB3, 0xE7, 0x3F, 0xD3, 0x0C, 0x60, 0x6E, 0x04, 0x91, 0x69, 0x98, 0x15, 0x01, 0xA4, 0xF2, 0x19, 0x0A, 0x0F, 0x6F, 0x2E, 0x4A, 0x2F, 0x2F, 0x4A, 0x3C, 0x85, 0x67, 0x17, 0x84, 0x82, 0xF0, 0x4B, 0x8D, 0xAE, 0xC0, 0x00, 0x6B, 0x7B, 0xDF, 0xBF, 0x8E, 0x07, 0x38, 0x06, 0xBC, 0xBE, 0x3D, 0x3F, 0x23, 0xC1, 0xF3, 0x35, 0xF0, 0xF9, 0x7E, 0x69, 0xD7, 0xF3, 0xE1, 0xB5, 0x1E, 0xCF, 0xF8, 0x03, 0x54, 0xC0, 0xBF, 0xA5, 0x47, 0x8E, 0x47, 0xFC, 0x72, 0x3B, 0xFE, 0xE4, 0x73, 0xE0, 0x4B, 0x7E, 0xBC, 0x88, 0xAB, 0xB3, 0xAB, 0xC6, 0xDA, 0xB4, 0xD6, 0xAE, 0xB8, 0x8E, 0xE6, 0xCF, 0xD4, 0x89, 0x58, 0xE7, 0x10, 0x89, 0x86, 0x51, 0xF9, 0x81, 0x17, 0x85, 0x7F, 0xCC, 0x47, 0x91, 0x30, 0xA4, 0x3F, 0x3B, 0xFD, 0x50, 0xF2, 0x21, 0xAE, 0x4A, 0x7D, 0x8A, 0xF5, 0x43, 0xE8, 0x97, 0x3B, 0x9E, 0xF5, 0x65, 0x4A, 0xFE, 0xAC, 0x7F, 0x13, 0xFA, 0x55, 0xF4, 0x03, 0xE0, 0xA4, 0xF7, 0x01, 0x18, 0x62, 0x60, 0xC7, 0x26, 0xC5, 0x19, 0x25, 0xD3, 0x96, 0xE8, 0x2D, 0xAE, 0x27, 0xB1, 0x28, 0x87, 0x24, 0x1F, 0x27, 0xB4, 0x44, 0x2B, 0xE1, 0xE4, 0xF6, 0xCC, 0x8C, 0xF6, 0x27, 0x53, 0x92, 0xE1, 0xE7, 0x09, 0x24, 0xCE, 0x8D, 0x6B, 0x50, 0x1F, 0x3A, 0xA9, 0xFD, 0x8E, 0x93, 0x1E, 0x1E, 0x07, 0xEA, 0x12, 0xC3, 0x9D, 0x1E, 0x53, 0xF0, 0x24, 0xA5, 0xF0, 0x93, 0x67, 0x56, 0x6F, 0x76, 0x24, 0xE2, 0x31, 0x08, 0x92, 0x0F, 0xFE, 0xCA, 0x0F, 0xC3, 0xD4, 0xB6, 0x62, 0x96, 0x02, 0xBE, 0xC6, 0x28, 0x32, 0x5B, 0x96, 0x7F, 0x86, 0xEE, 0xCD, 0x9F, 0xEF, 0xCF, 0x97, 0xFF, 0xF6, 0x3C, 0x3D, 0x67, 0x88, 0xC9, 0x01, 0xF8, 0x9E, 0xB2, 0xE4, 0x33, 0x82, 0x06, 0xCB, 0xA3, 0x4F, 0x45, 0xE0, 0x91, 0x08, 0xA0, 0xC7, 0xCB, 0x79, 0x3D, 0x15, 0xD4, 0x70, 0x19, 0xC5, 0xC0, 0xD4, 0xF8, 0xE1, 0x17, 0x8A, 0x0E, 0x0F, 0x74, 0x9D, 0x46, 0x59, 0x68, 0x38, 0xD2, 0x2B, 0xF5, 0x95, 0xA0, 0xBD, 0x60, 0x09, 0x7F, 0x74, 0xF0, 0x8B, 0x35, 0xF4, 0xAB, 0xD4, 0x6E, 0xD9, 0xAA, 0xE6, 0x89, 0xE6, 0xB7, 0xC7, 0x0B, 0x53, 0x94, 0xEC, 0xE3, 0x4C, 0x83, 0x9C, 0x62, 0x9D, 0x4A, 0x9A, 0x6E, 0x14, 0x71, 0xA7, 0xDA, 0xB5, 0x3C, 0x79, 0x06, 0x4F, 0xBF, 0xA2, 0xF6, 0x29, 0x41, 0x4D, 0xE9, 0x9B, 0x64, 0x22, 0xB9, 0x11, 0x29, 0x7F, 0x21, 0x8F, 0x88, 0xFF, 0x51, 0x59, 0xA1, 0x93, 0x8F, 0xEF, 0x49, 0xB3, 0xA3, 0xB2, 0xF4, 0x63, 0x82, 0xCC, 0xB9, 0xFD, 0x3D, 0x7C, 0xE9, 0x28, 0xB0, 0x64, 0x4C, 0xC6, 0x34, 0x7B, 0x56, 0xFD, 0x28, 0x6F, 0xDB, 0xAF, 0xD2, 0x24, 0x85, 0x5F, 0xB1, 0x66, 0xEF, 0x6F, 0x3C, 0x4A, 0x36, 0x00, 0xBF, 0x46, 0x8F, 0x76, 0xBC, 0x07, 0xBF, 0x89, 0xEF, 0x46, 0xCC, 0x31, 0xDA, 0x41, 0xE1, 0xF1, 0x4B, 0xAE, 0x98, 0x9E, 0xDD, 0x0B, 0x01, 0x95, 0xB4, 0x3F, 0x09, 0x26, 0x4B, 0xE6, 0x41, 0xD4, 0x0B, 0x52, 0xBA, 0x4E, 0xD9, 0x45, 0xE2, 0x08, 0x65, 0x1B, 0xE9, 0xCD, 0x4A, 0x09, 0x1E, 0xA5, 0x37, 0x1C, 0xE5, 0xD0, 0xC5, 0xB2, 0x80, 0xE1, 0x37, 0xB7, 0x73, 0xB7, 0x32, 0x3F, 0x2F, 0x32, 0xCA, 0x7C, 0x99, 0x0C, 0x9E, 0xAF, 0x64, 0x35, 0xDC, 0x4E, 0xE2, 0x28, 0xED, 0xBC, 0xA8, 0x50, 0xAF, 0x04, 0xAF, 0xF0, 0xE5, 0xFB, 0x4D, 0xC4, 0x7B, 0x60, 0x8A, 0x53, 0x94, 0x9C, 0xCE, 0x0B, 0x94, 0xFC, 0xA3, 0x8D, 0xBB, 0x46, 0xFF, 0x1A, 0x8D, 0xB3, 0xBE, 0xD4, 0xFE, 0xD3, 0xF2, 0xE0, 0xD8, 0xED, 0x8F, 0xF7, 0xE4, 0x5F, 0xF1, 0x99, 0xD2, 0x2F, 0xCE, 0x0E, 0x5A, 0xF8, 0x8C, 0x23, 0xA5, 0xD0, 0xD0, 0x78, 0x43, 0xF2, 0xBA, 0x63, 0x74, 0xE9, 0x9A, 0xE5, 0x9D, 0x3E, 0xA1, 0x4D, 0xF2, 0xCB, 0x95, 0xA4, 0xAB, 0x03, 0x6E, 0xD9, 0xE6, 0xF6, 0x6C, 0xB8, 0x9E, 0x7E, 0x14, 0x8E, 0xB8, 0xF2, 0xE4, 0xF1, 0xB4, 0xAC, 0xE8, 0xE4, 0xA7, 0xE0, 0x6B, 0xFD, 0x60, 0x8E, 0x7B, 0xFA, 0x40, 0xF8, 0x59, 0xFA, 0x95, 0xF5, 0x14, 0xE0, 0xFF, 0x06, 0xDE, 0x07, 0x80, 0x8A, 0xAB, 0x23, 0x55, 0xBD, 0xC6, 0x37, 0xD8, 0xD2, 0xDA, 0xA3, 0x78, 0x2A, 0xDD, 0xBF, 0xA6, 0xDA, 0xD9, 0x4E, 0xA6, 0xE0, 0x91, 0xBD, 0x90, 0x5A, 0xE5, 0x37, 0xE4, 0x72, 0x7F, 0x7E, 0xA3, 0xAE, 0x35, 0x9E, 0xD6, 0x34, 0x4D, 0xFF, 0x6C, 0xA0, 0x69, 0x7C, 0x9A, 0x17, 0xC7, 0x83, 0x70, 0x90, 0x30, 0x0D, 0x3F, 0xF5, 0x63, 0xB5, 0xB8, 0x47, 0x31, 0x92, 0x8B, 0xBB, 0x3E, 0xFC, 0xEB, 0xE1, 0xEE, 0xF0, 0x26, 0xF7, 0x87, 0x16, 0xFC, 0xA2, 0x1E, 0x7C, 0x59, 0x2F, 0xFD, 0xC6, 0xB5, 0xF6, 0x3D, 0xFC, 0x87, 0xD7, 0x28, 0x7E, 0x74, 0x18, 0xB7, 0xD0, 0x17, 0xBF, 0x5A, 0x75, 0x8F, 0x0E, 0x04, 0xFE, 0xBB, 0x83, 0xF6, 0x1B, 0xEC, 0x0F, 0x73, 0xDF, 0xE0, 0x75, 0xBA, 0x8F, 0xA7, 0x94, 0x33, 0x9C, 0x3B, 0xF8, 0xCD, 0xED, 0xD8, 0x3F, 0xDF, 0xA7, 0xF1, 0x57, 0xD8, 0x5F, 0xC2, 0x17, 0xED, 0xD8, 0xEF, 0x01, 0xAF, 0xDB, 0xF6, 0xDB, 0x04, 0xAF, 0xCE, 0xCF, 0xED, 0x08, 0xF7, 0x06, 0xE0, 0x65, 0xBC, 0xB3, 0xBA, 0x5E, 0x13, 0x7C, 0x76, 0xE8, 0xF2, 0xFB, 0x8E, 0x99, 0x47, 0x70, 0x96, 0x3A, 0x39, 0xB3, 0xAC, 0xE5, 0x69, 0x7D, 0x8B, 0x72, 0x4E, 0xE3, 0x49, 0xC3, 0x1A, 0xF9, 0x68, 0xFE, 0x4E, 0xC9, 0xB3, 0x46, 0xB6, 0x58, 0xBF, 0xC8, 0x39, 0x91, 0xA3, 0x9C, 0xDD, 0x9F, 0xE4, 0x9B, 0x05, 0x2F, 0xF5, 0x87, 0x01, 0x66, 0x83, 0xAD, 0xED, 0xD7, 0x64, 0x6E, 0x37, 0x20, 0xCF, 0x87, 0xC3, 0xB3, 0x74, 0x95, 0x9B, 0x8B, 0x7C, 0xE8, 0xFA, 0x16, 0xE0, 0x3D, 0xA3, 0xA5, 0x0C, 0xCA, 0x3F, 0xCB, 0x13, 0xBE, 0x5A, 0x56, 0xE4, 0x93, 0xE5, 0xC9, 0xFC, 0x2E, 0xF2, 0x51, 0xF2, 0xB3, 0xF5, 0xA3, 0xEA, 0x0F, 0xCE, 0x9F, 0xE0, 0xC3, 0x7C, 0x09, 0x3E, 0x08, 0x41, 0xCB, 0x1F, 0xE5, 0x87, 0x5F, 0x4B, 0xBB, 0x26, 0x3B, 0x6B, 0xF4, 0x8B, 0xE4, 0xEF, 0xEA, 0x5F, 0xD1, 0x6B, 0x18, 0x4F, 0xF8, 0x5F, 0xFD, 0xEE, 0x77, 0xBF, 0x27, 0xF7, 0x2E, 0x42, 0x60, 0xD6, 0x81, 0xE0, 0xC7, 0xE8, 0xDF, 0xDC, 0xD2, 0xED, 0x1B, 0xC0, 0x6F, 0x30, 0x1A, 0x83, 0xA7, 0x63, 0x18, 0x83, 0x48, 0x44, 0xC3, 0x3F, 0x6F, 0xFF, 0xF2, 0x2F, 0x0E, 0x6F, 0x82, 0xFB, 0xBF, 0x7B, 0xB8, 0x01, 0xE3, 0xB9, 0x01, 0xA3, 0xBE, 0x4B, 0x62, 0x27, 0x5F, 0x9F, 0x0D, 0x84, 0x7E, 0x92, 0x99, 0xB0, 0x77, 0x41, 0x23, 0x03, 0x36, 0xB2, 0xDA, 0x70, 0x41, 0x2F, 0x01, 0xA5, 0x2A, 0x92, 0xAC, 0x40, 0x70, 0xCC, 0xCC, 0x2F, 0x5B, 0x41, 0x43, 0xCB, 0x4E, 0x55, 0x7C, 0x6E, 0x35, 0xCF, 0x4B, 0xEB, 0x84, 0x1C, 0x94, 0x2B, 0x8D, 0x25, 0xE6, 0x8A, 0xF9, 0xB3, 0x18, 0x6B, 0x8C, 0x2B, 0xAF, 0xD7, 0x48, 0x9D, 0xEB, 0x8C, 0xF5, 0xB5, 0x1B, 0xD9, 0xA9, 0x21, 0x45, 0xC9, 0x51, 0x00, 0xAD, 0x9F, 0x7C, 0xE9, 0x27, 0x05, 0x8C, 0x2C, 0x86, 0x17, 0x5B, 0x71, 0xB5, 0x20, 0xE2, 0x7F, 0xD4, 0xBE, 0x40, 0xBF, 0x16, 0xC8, 0xDF, 0x9D, 0x05, 0x9C, 0xEE, 0x03, 0xC8, 0xFC, 0xAD, 0x5F, 0xFC, 0x39, 0x38, 0x7F, 0xE0, 0xC5, 0x3D, 0xB8, 0xE8, 0x6B, 0x30, 0xBB, 0x7B, 0x30, 0x6B, 0x22, 0x9E, 0xB3, 0x3F, 0x29, 0xFF, 0xF4, 0xB9, 0x55, 0x21, 0x3F, 0x99, 0x53, 0x15, 0xFD, 0xC0, 0x01, 0x49, 0xBE, 0xAD, 0x7E, 0x70, 0x10, 0xF1, 0xE4, 0x8F, 0xE3, 0x31, 0xA8, 0x24, 0x3D, 0x20, 0xFD, 0xC8, 0xD9, 0xB8, 0xD0, 0x47, 0xC0, 0x3B, 0x17, 0x8E, 0x73, 0x10, 0x93, 0xFA, 0xA7, 0xE1, 0xE3, 0xB5, 0xC6, 0xEF, 0x1E, 0xC6, 0xA3, 0xC0, 0x8B, 0xFE, 0xFD, 0x3E, 0x39, 0x00, 0xF2, 0x01, 0x89, 0x52, 0x6D, 0x32, 0xE7, 0x72, 0x4D, 0x16, 0x3B, 0x1B, 0x3F, 0xAD, 0x02, 0x99, 0xC1, 0xC9, 0xCC, 0xAF, 0xAF, 0x0F, 0x5F, 0xFE, 0xF0, 0xEB, 0x87, 0x9B, 0xFB, 0x5C, 0x39, 0xBF, 0xC6, 0x68, 0xCF, 0xE4, 0x12, 0x27, 0xF4, 0xDB, 0x90, 0xB2, 0x9F, 0xCF, 0x1C, 0x2B, 0x59, 0x82, 0x74, 0x10, 0x82, 0x97, 0xDD, 0xDB, 0x60, 0x48, 0x71, 0x1A, 0x87, 0x42, 0xF0, 0xF0, 0x1E, 0xCE, 0x8F, 0x82, 0xD1, 0xED, 0xF2, 0x3A, 0x73, 0x21, 0xE3, 0x50, 0xE7, 0xCF, 0x82, 0xAE, 0xF3, 0x49, 0xC1, 0x67, 0x5C, 0x53, 0x74, 0x4A, 0x0A, 0x46, 0xFE, 0x09, 0xAC, 0xFD, 0xB3, 0xDB, 0x57, 0x87, 0x4F, 0xBE, 0xF2, 0xD3, 0xBC, 0xCC, 0x28, 0xF1, 0x6F, 0xC4, 0x30, 0x59, 0x16, 0xE7, 0xAA, 0x2F, 0x52, 0x9F, 0x33, 0x3D, 0xEC, 0xD0, 0xF8, 0xAF, 0xC4, 0xC3, 0xEB, 0x37, 0x0E, 0x5F, 0xFA, 0xE0, 0x3F, 0x1F, 0x3E, 0xF7, 0xF0, 0xEC, 0xF0, 0x0A, 0x78, 0xF0, 0x0C, 0x3A, 0xDD, 0x0A, 0xFE, 0x33, 0x27, 0x18, 0x9A, 0x29, 0x9F, 0xE2, 0x90, 0xAB, 0xC3, 0x9E, 0xA3, 0x1F, 0x94, 0x83, 0xA5, 0xA9, 0x18, 0x7E, 0x95, 0x1E, 0x1B, 0x3E, 0x63, 0x9D, 0x5B, 0x24, 0x7C, 0x5E, 0xA8, 0x65, 0x9F, 0xDF, 0xEB, 0x0F, 0xF7, 0x67, 0xF8, 0x98, 0x85, 0x54, 0xD7, 0x0C, 0x1A, 0x93, 0x33, 0x00, 0xE9, 0xEF, 0x85, 0x05, 0x74, 0x4A, 0xA1, 0xFB, 0x2D, 0xBD, 0x96, 0xAC, 0x6D, 0xBD, 0x54, 0x75, 0x40, 0xAD, 0xD8, 0xB4, 0x18, 0xC7, 0xAF, 0xAB, 0xF9, 0x64, 0x23, 0x41, 0x4E, 0x61, 0x9A, 0x77, 0x75, 0xB8, 0x81, 0xF4, 0xFA, 0xDD, 0x8F, 0xBE, 0x96, 0xD2, 0x2E, 0x0A, 0xBC, 0x64, 0xBE, 0x6C, 0x50, 0xBD, 0x31, 0x54, 0x45, 0x8A, 0x0C, 0x65, 0xBA, 0x3D, 0x82, 0xE3, 0xB5, 0xCF, 0x91, 0x14, 0x9B, 0x27, 0x2B, 0xB0, 0x74, 0xE5, 0x78, 0xEC, 0xF8, 0x1A, 0x32, 0x80, 0x97, 0xEF, 0xFF, 0x34, 0xAB, 0x14, 0x46, 0x86, 0xC9, 0xA0, 0x6D, 0xC9, 0x49, 0x63, 0xE9, 0xE9, 0x83, 0x96, 0xF7, 0x63, 0x5E, 0xB7, 0x72, 0x60, 0xF9, 0xA7, 0xAC, 0xE8, 0xFE, 0xFA, 0xF0, 0x85, 0x17, 0x7F, 0x71, 0x78, 0x23, 0x2D, 0xCB, 0xA4, 0xDE, 0xFB, 0x16, 0xE1, 0x61, 0xEE, 0x69, 0xF4, 0x28, 0xA5, 0x5A, 0x5B, 0xB6, 0x90, 0x7F, 0x4B, 0x51, 0x3B, 0x03, 0xC3, 0x07, 0x07, 0xF0, 0xBB, 0xA4, 0x1F, 0x5E, 0xAA, 0x2C, 0xCD, 0x07, 0x3B, 0xB1, 0xA1, 0x68, 0x84, 0x99, 0xB1, 0xD3, 0xED, 0x35, 0xC5, 0xB5, 0xC7, 0x47, 0xED, 0xED, 0xFC, 0x5A, 0x5F, 0xC3, 0xCA, 0x78, 0x9A, 0x94, 0x48, 0x87, 0x74, 0xEF, 0x0A, 0xD2, 0xBD, 0x77, 0x3F, 0xFA, 0x06, 0xAC, 0xEF, 0x58, 0x01, 0xEA, 0x3A, 0x30, 0x32, 0xD0, 0x75, 0xE6, 0x7F, 0xFC, 0xD1, 0x7D, 0x0C, 0xCC, 0x73, 0x36, 0x4E, 0xE0, 0xE1, 0xF6, 0xF0, 0xF3, 0xF7, 0xFF, 0x9A, 0x16, 0xFC, 0x30, 0xA2, 0x30, 0xD4, 0xF6, 0x04, 0x5C, 0x6F, 0xB1, 0xB0, 0xB7, 0xE4, 0xDF, 0xCB, 0x27, 0x92, 0xEF, 0x48, 0x3B, 0xCB, 0xB0, 0xF5, 0x57, 0x43, 0xF3, 0x27, 0xE9, 0x67, 0xC9, 0x5E, 0xC3, 0x72, 0x0F, 0x17, 0x43, 0xEF, 0x7E, 0xF8, 0xB5, 0xC3, 0x9B, 0xB0, 0x14, 0xB8, 0x83, 0x45, 0x75, 0xFB, 0x7A, 0xFC, 0x4C, 0xA5, 0x76, 0x9E, 0xC7, 0x97, 0xDC, 0xE3, 0xCE, 0x90, 0x32, 0x00, 0x2E, 0xDC, 0x55, 0x15, 0x11, 0xEA, 0x93, 0xCB, 0x9C, 0xED, 0x2A, 0x41, 0xE2, 0x18, 0x59, 0x5D, 0x34, 0x7E, 0x3A, 0xEC, 0x90, 0xCA, 0x7A, 0xEA, 0x8C, 0xCD, 0x13, 0x5E, 0x69, 0x82, 0x97, 0x48, 0x34, 0xAE, 0xA0, 0xBF, 0xF0, 0x11, 0x2C, 0x01, 0x52, 0xE5, 0x0B, 0xE1, 0x90, 0xC8, 0x95, 0xE6, 0x46, 0x24, 0x58, 0xED, 0x12, 0xC4, 0x31, 0xDA, 0x1B, 0xD2, 0x60, 0xB2, 0x52, 0xB4, 0x9B, 0xD2, 0x9F, 0xB2, 0xC8, 0x47, 0xEC, 0xA0, 0xF8, 0x74, 0x7F, 0x7B, 0xF8, 0xC5, 0x57, 0x7E, 0x5C, 0x0A, 0x63, 0x59, 0x14, 0x9D, 0xD9, 0x0A, 0x4B, 0x93, 0x11, 0x9E, 0x27, 0x9A, 0x4C, 0x1B, 0xB2, 0x7C, 0xA6, 0xF4, 0x27, 0xD4, 0xF7, 0x01, 0xF8, 0x5E, 0xD4, 0x29, 0x2E, 0xAF, 0xD7, 0x9F, 0x2B, 0xA8, 0x81, 0x60, 0x34, 0x43, 0xF9, 0x63, 0x81, 0x8F, 0x17, 0x41, 0x1C, 0xE1, 0x9A, 0x59, 0x53, 0xC5, 0x5C, 0x2E, 0x06, 0x5B, 0xA4, 0x23, 0x12, 0x97, 0xB4, 0x47, 0xFA, 0xA3, 0x4D, 0x30, 0xB3, 0x98, 0x5F, 0x90, 0xA1, 0x9C, 0xA3, 0x21, 0x82, 0x92, 0xCF, 0xFD, 0xFE, 0xF7, 0xB9, 0x08, 0x58, 0x44, 0xAB, 0xB2, 0x38, 0xAA, 0x25, 0xF5, 0xED, 0x8C, 0x81, 0x91, 0x05, 0x26, 0x3D, 0x63, 0xFF, 0x29, 0xB6, 0x98, 0xD2, 0xA4, 0x46, 0x96, 0x58, 0xFB, 0x0B, 0x44, 0x26, 0xE0, 0x37, 0xD9, 0x1A, 0x06, 0xAE, 0x32, 0x9F, 0x22, 0xC4, 0xD0, 0x9D, 0x54, 0xD8, 0x41, 0xDF, 0x9F, 0x52, 0xE0, 0x07, 0xC8, 0x00, 0xBE, 0x95, 0x90, 0xAA, 0x05, 0x14, 0x9C, 0xB8, 0x1D, 0x68, 0xA9, 0x60, 0x23, 0x20, 0x52, 0xB4, 0xAA, 0x22, 0xED, 0x6A, 0x5C, 0xEB, 0xF8, 0x94, 0x19, 0x71, 0x84, 0x66, 0x99, 0x30, 0x36, 0x92, 0x1D, 0x1A, 0x43, 0x1E, 0x93, 0x79, 0xDE, 0x5E, 0x55, 0x33, 0x45, 0x2F, 0x51, 0x31, 0x41, 0x03, 0xF8, 0xEC, 0xEE, 0xB3, 0xC3, 0x3F, 0x41, 0x0D, 0x20, 0x6F, 0x69, 0xA6, 0xF2, 0x56, 0x5A, 0x47, 0x96, 0x4C, 0x8F, 0x88, 0xDC, 0x4A, 0x3E, 0x4B, 0xE5, 0xEF, 0xE9, 0x13, 0xAB, 0x98, 0xD6, 0x07, 0x55, 0xFB, 0x6A, 0xD8, 0x8F, 0xBB, 0x44, 0x89, 0x4B, 0xA9, 0x08, 0x0A, 0x19, 0xC0, 0x47, 0xDF, 0x84, 0x00, 0x90, 0xF9, 0x96, 0xE9, 0xCF, 0x59, 0x42, 0x9B, 0xED, 0xF4, 0x3C, 0x9D, 0x96, 0x7F, 0xD5, 0xA0, 0x54, 0x70, 0x25, 0x0C, 0xAA, 0x1B, 0xD2, 0xD5, 0xA1, 0x5C, 0x3F, 0x28, 0x1B, 0xAF, 0xCA, 0x60, 0xF3, 0xEC, 0xF9, 0xA6, 0xCC, 0x48, 0xAC, 0xEC, 0x84, 0x75, 0x80, 0x37, 0xF0, 0xAB, 0xC8, 0x05, 0x7C, 0xA1, 0x26, 0x57, 0xBF, 0xFB, 0x3D, 0x2C, 0x01, 0x9A, 0x80, 0x4F, 0x43, 0xC9, 0xB0, 0x8A, 0x22, 0x96, 0x6B, 0x95, 0x2A, 0x29, 0xEB, 0x68, 0x02, 0xB2, 0xA1, 0x8B, 0x45, 0x98, 0x86, 0xE1, 0x26, 0xDB, 0x44, 0x32, 0xA5, 0xC3, 0x1E, 0x81, 0xAF, 0xAD, 0x65, 0x6A, 0x3C, 0x11, 0x8F, 0x0A, 0x70, 0x77, 0x77, 0x7F, 0x78, 0xEF, 0xE5, 0x37, 0x0F, 0xB7, 0xD0, 0xFF, 0x59, 0x3A, 0x5A, 0xAB, 0x26, 0xF7, 0x82, 0x4D, 0x49, 0x82, 0xC9, 0x00, 0x00, 0x12, 0x12, 0x49, 0x44, 0x41, 0x54, 0x4F, 0x71, 0x9F, 0x49, 0x26, 0xFD, 0x4F, 0x69, 0x47, 0xCF, 0xA4, 0x3A, 0x48, 0x0B, 0xF7, 0xD6, 0x54, 0xA5, 0x8F, 0xD2, 0x04, 0x6D, 0xDF, 0x3A, 0xFB, 0x49, 0xE3, 0xC4, 0x98, 0xC6, 0x72, 0x73, 0x53, 0xED, 0xF2, 0x0C, 0x70, 0xBB, 0x3D, 0x7C, 0xF0, 0xFE, 0x0F, 0x0E, 0x6F, 0x00, 0x2F, 0xEA, 0x6E, 0x07, 0x29, 0x9A, 0x94, 0x77, 0x53, 0x19, 0x11, 0x34, 0x5B, 0xBE, 0xA6, 0xB7, 0x8C, 0x96, 0x47, 0x62, 0x4C, 0x91, 0x37, 0xC9, 0xAF, 0x93, 0x7F, 0x04, 0x5F, 0x90, 0x6B, 0x48, 0xC1, 0xBC, 0xC5, 0x20, 0x9F, 0xC1, 0x12, 0xE0, 0x0F, 0x77, 0x77, 0x20, 0xFF, 0x6F, 0x24, 0xC6, 0xA4, 0x02, 0x5C, 0x19, 0x91, 0xBC, 0x00, 0x65, 0x2F, 0x5A, 0x21, 0x2B, 0x8B, 0xEB, 0x3B, 0x27, 0x89, 0x27, 0x5A, 0x2F, 0x4C, 0xF9, 0x48, 0xB4, 0x48, 0x3F, 0xE4, 0xB8, 0x06, 0x6B, 0xC1, 0x4C, 0x23, 0xD0, 0x9A, 0xF3, 0x4F, 0x8E, 0xD7, 0x0A, 0x0D, 0x6E, 0xE7, 0xF7, 0x50, 0x03, 0x98, 0x8A, 0x48, 0x1E, 0x63, 0x7B, 0x50, 0xBD, 0x9C, 0x2D, 0xDB, 0x98, 0x23, 0xA8, 0x09, 0x3B, 0xEE, 0x16, 0x0E, 0xB6, 0xAD, 0x6A, 0xAE, 0x55, 0x03, 0xB8, 0xBA, 0x86, 0x9D, 0x5F, 0x28, 0x82, 0xBD, 0x0B, 0xBB, 0x00, 0x8D, 0x02, 0xD0, 0xA4, 0xBD, 0x07, 0xB5, 0xE9, 0xF3, 0x7C, 0x41, 0xBD, 0x5F, 0xB5, 0xD8, 0xA2, 0x47, 0x7A, 0x7E, 0x29, 0x07, 0x4B, 0x27, 0xBC, 0x76, 0x4B, 0x7E, 0x93, 0x7C, 0x4E, 0x28, 0xA1, 0xD1, 0xDF, 0x1D, 0x3E, 0xFE, 0xF2, 0x8F, 0x0F, 0x37, 0xCF, 0x20, 0x1A, 0x82, 0x31, 0xAC, 0xF9, 0xF1, 0x7C, 0xE5, 0x52, 0x98, 0x73, 0xF5, 0x2B, 0xEA, 0xCF, 0x78, 0x64, 0x69, 0xC0, 0xBE, 0xFE, 0xCD, 0x9B, 0x87, 0x57, 0x0F, 0xAF, 0x0E, 0xEF, 0x7E, 0x00, 0x4B, 0xC0, 0x94, 0x3A, 0x03, 0x3F, 0x52, 0x45, 0x3F, 0x1B, 0x7F, 0xF5, 0xE1, 0x9C, 0x19, 0xB4, 0x4B, 0x80, 0x39, 0xF2, 0xE1, 0xB9, 0x8F, 0x25, 0xFF, 0x08, 0x7E, 0x6E, 0xAF, 0xF5, 0x2D, 0xD9, 0xFF, 0xEA, 0xB3, 0xCF, 0x3E, 0x2B, 0x2A, 0x5F, 0x6B, 0x01, 0xA4, 0xB4, 0x89, 0xCA, 0x9A, 0x68, 0x74, 0xB5, 0x02, 0xD5, 0x9E, 0xB9, 0x36, 0xA3, 0x3F, 0x21, 0x56, 0x95, 0x64, 0x24, 0x7C, 0x8C, 0xA6, 0x07, 0x52, 0xE4, 0x15, 0xA7, 0x62, 0xC6, 0x30, 0x15, 0x7A, 0xFD, 0xB7, 0x3F, 0xFD, 0x26, 0x14, 0x03, 0x71, 0x0F, 0x18, 0xFB, 0xD3, 0xFC, 0xFC, 0x0B, 0x08, 0x6E, 0x0E, 0x35, 0x79, 0x8E, 0xBE, 0xDC, 0xA7, 0x34, 0x8B, 0x1D, 0xBB, 0xE1, 0xE0, 0x39, 0xB0, 0x24, 0x5D, 0xF3, 0xE0, 0x7B, 0xE3, 0x55, 0x7F, 0x4D, 0x61, 0x42, 0x1B, 0xFE, 0xA9, 0x4E, 0xA5, 0xAA, 0x29, 0x1F, 0xE6, 0xCA, 0x49, 0x07, 0x98, 0x3E, 0x10, 0x7C, 0x05, 0x06, 0xF0, 0xF3, 0xCF, 0xFF, 0xF0, 0x70, 0x9D, 0x0A, 0x60, 0xF9, 0x40, 0x50, 0x3E, 0x44, 0x43, 0xEE, 0x4F, 0xA6, 0x6B, 0x56, 0x9E, 0x5D, 0xC4, 0x45, 0x2E, 0xC8, 0xD4, 0x07, 0x21, 0x5D, 0xA2, 0xAB, 0x77, 0x0A, 0xAC, 0x82, 0xD8, 0x21, 0x2B, 0x6B, 0x49, 0x57, 0xBA, 0x6B, 0x21, 0x4B, 0x3D, 0x9F, 0xA9, 0x4F, 0x0C, 0x4F, 0xC8, 0x97, 0x24, 0x8D, 0xCB, 0x9D, 0xB7, 0x3F, 0xFD, 0x56, 0x3A, 0xCC, 0x95, 0xCB, 0x00, 0xC8, 0x93, 0xBC, 0x1B, 0xC2, 0x87, 0xC6, 0xE4, 0x36, 0x9B, 0xC9, 0xEF, 0xAA, 0x35, 0xEE, 0xCA, 0x43, 0x3A, 0x8B, 0x56, 0xFE, 0x3C, 0x8F, 0x58, 0x82, 0x4B, 0x78, 0x9D, 0xFE, 0xB4, 0xDB, 0x82, 0x2E, 0x3E, 0x8E, 0xFE, 0x98, 0x16, 0xF1, 0xD9, 0x1F, 0xC0, 0x01, 0xE4, 0x43, 0x71, 0xEA, 0x27, 0xA3, 0x3D, 0xEA, 0x59, 0xF5, 0xBA, 0x99, 0xAF, 0xFB, 0xF1, 0x32, 0xB6, 0xB6, 0x7B, 0x92, 0x79, 0xBE, 0x36, 0x15, 0xEB, 0xAF, 0xD9, 0x84, 0xB3, 0x93, 0x62, 0x68, 0x42, 0xCD, 0x08, 0x6F, 0x9F, 0x59, 0xD8, 0x37, 0x7F, 0xF6, 0xEC, 0x70, 0x78, 0xFF, 0xD3, 0xFF, 0x92, 0x4E, 0x74, 0xD5, 0x22, 0x47, 0xCB, 0x06, 0xDE, 0x1F, 0x67, 0xFF, 0xCF, 0xB3, 0x0A, 0x35, 0x6D, 0xD4, 0x8E, 0x5C, 0x67, 0xB9, 0xC7, 0xD7, 0xD2, 0x05, 0xF1, 0x0C, 0x66, 0x56, 0x27, 0xA6, 0x6F, 0x23, 0x7B, 0xBE, 0xEA, 0x94, 0x29, 0x51, 0x5B, 0xB1, 0xF1, 0xDA, 0x35, 0x5E, 0x78, 0xCA, 0xEC, 0x0D, 0x38, 0x14, 0xF0, 0xE1, 0x5B, 0xDF, 0x4F, 0xA7, 0xCA, 0xF8, 0xF8, 0x64, 0x0E, 0x80, 0x5A, 0x6A, 0x92, 0xBB, 0x2A, 0x55, 0x0E, 0xD5, 0xDE, 0xD2, 0x2D, 0x62, 0xBE, 0xB9, 0x7E, 0xB2, 0xD4, 0xD4, 0xD7, 0x4F, 0x5B, 0x6B, 0x19, 0x3E, 0xF3, 0xA5, 0xD5, 0x0E, 0xBE, 0x8B, 0xB5, 0x8F, 0xF7, 0x3E, 0xFD, 0x4E, 0xDE, 0x02, 0xA4, 0xC0, 0xA5, 0x56, 0xCA, 0x13, 0xFC, 0xCE, 0x30, 0x2D, 0xF9, 0xEA, 0x4C, 0x4D, 0x62, 0xE1, 0xE9, 0x87, 0xD4, 0xA7, 0x68, 0x7C, 0xD4, 0xDE, 0xAC, 0x02, 0x0D, 0x7D, 0x6A, 0xF4, 0xAF, 0x66, 0x00, 0x9E, 0xA0, 0x2E, 0xF0, 0x3E, 0x05, 0x1A, 0xCC, 0x00, 0xDE, 0xF9, 0xD5, 0x5F, 0x82, 0x01, 0xC0, 0x72, 0xE0, 0x3E, 0x7B, 0x7E, 0x59, 0xED, 0xAD, 0x27, 0xE8, 0xD8, 0xF4, 0x94, 0x28, 0xC9, 0x70, 0xAA, 0x69, 0xCE, 0x6C, 0x27, 0xC3, 0x75, 0xC7, 0x9B, 0xAE, 0x25, 0x8E, 0x80, 0x2D, 0xBC, 0xEA, 0xDB, 0xB2, 0x24, 0x53, 0xEA, 0x91, 0x0E, 0x17, 0xE3, 0xE6, 0xE7, 0x8B, 0xE7, 0xDF, 0xAD, 0x05, 0x50, 0x72, 0x84, 0xBE, 0xF9, 0x5F, 0x8E, 0x2E, 0x64, 0x43, 0x84, 0x73, 0x00, 0xBF, 0xFA, 0x16, 0x2C, 0x01, 0x60, 0x4B, 0x90, 0x0E, 0xF4, 0x94, 0x22, 0xA0, 0xC8, 0x78, 0x5A, 0x47, 0xCD, 0xA9, 0xB4, 0xE7, 0xDA, 0x7B, 0xF9, 0x2C, 0x96, 0x6F, 0x24, 0xFF, 0x41, 0xFD, 0x99, 0x9A, 0x5F, 0x2C, 0x01, 0xAA, 0x47, 0x9B, 0x48, 0xB2, 0xDD, 0x8C, 0x40, 0x47, 0x1E, 0xCB, 0x8F, 0x4F, 0xB1, 0x4C, 0x7B, 0x46, 0xED, 0x5D, 0xA3, 0xF6, 0xA8, 0xBF, 0x9E, 0xFB, 0x01, 0xD2, 0xBD, 0x6B, 0xAC, 0x02, 0xFF, 0xEA, 0x3B, 0x58, 0x02, 0xCA, 0x86, 0x81, 0xFF, 0xAA, 0x0A, 0x64, 0x8D, 0x77, 0xE8, 0x1D, 0x52, 0x07, 0x22, 0xAD, 0x62, 0x54, 0x8F, 0x01, 0x37, 0xBE, 0xB5, 0x58, 0xCB, 0xDA, 0x76, 0x6D, 0xC2, 0xED, 0xB5, 0x85, 0x8F, 0x2C, 0xF6, 0x69, 0xA3, 0xCD, 0x0E, 0x20, 0x93, 0x71, 0x7F, 0xF8, 0xF8, 0xF9, 0x0F, 0xC0, 0x01, 0x02, 0x86, 0x94, 0x6A, 0x37, 0x7C, 0x4A, 0x0E, 0xB1, 0xD6, 0x3E, 0xF4, 0x76, 0x96, 0xEC, 0x1B, 0x45, 0x36, 0x2D, 0x9F, 0xB9, 0xD7, 0x73, 0xE5, 0xCF, 0xF0, 0x2D, 0x5D, 0xE6, 0x2C, 0x0E, 0xE9, 0x79, 0xF7, 0xD3, 0x6F, 0x03, 0xED, 0xF9, 0x19, 0x14, 0x52, 0x80, 0x2A, 0x5F, 0x52, 0xEA, 0x3E, 0x53, 0xD3, 0x8F, 0xA2, 0x4F, 0xE7, 0x72, 0xAE, 0xFC, 0x8B, 0xA7, 0x1D, 0xCD, 0x05, 0x97, 0xE8, 0x97, 0x76, 0x58, 0x14, 0x04, 0xC8, 0xC1, 0x75, 0x0E, 0xE0, 0x72, 0x7C, 0xBC, 0x4F, 0x49, 0xE2, 0x7B, 0xDA, 0xFA, 0x3A, 0x40, 0x06, 0xF0, 0x6D, 0x50, 0xF2, 0xBC, 0x27, 0x4C, 0x1A, 0x40, 0xD5, 0x5F, 0xF2, 0x9B, 0x79, 0xB1, 0xDE, 0x2C, 0xD6, 0x8A, 0xB8, 0x8A, 0x00, 0x75, 0xCC, 0xA4, 0xEB, 0xA3, 0xB5, 0x0B, 0x1F, 0x94, 0xD0, 0xAE, 0xF3, 0x25, 0x65, 0x4E, 0xEE, 0x8C, 0xF1, 0x96, 0x05, 0x2D, 0x76, 0x70, 0x78, 0xE4, 0x39, 0x6F, 0xFD, 0xBD, 0xFC, 0xFC, 0xF7, 0xE8, 0x24, 0x64, 0x74, 0x12, 0xF0, 0x72, 0x34, 0x23, 0xD9, 0x3A, 0xD5, 0x37, 0x50, 0xFE, 0xA9, 0x06, 0x40, 0xFB, 0xFC, 0x59, 0x37, 0xB2, 0xE3, 0x6B, 0x53, 0x69, 0x0A, 0x10, 0x82, 0x0D, 0xD5, 0x29, 0x69, 0x79, 0xFB, 0xF2, 0xC9, 0x71, 0x26, 0xD2, 0x0F, 0x35, 0x5E, 0xE8, 0x9F, 0x38, 0x79, 0x2C, 0x56, 0xDD, 0x73, 0xF5, 0x4F, 0xF8, 0xB8, 0x57, 0x54, 0x04, 0x8C, 0x7C, 0x50, 0xEB, 0x37, 0x6C, 0x65, 0xD0, 0x30, 0x16, 0xAB, 0x8C, 0xA6, 0x47, 0x03, 0x8A, 0xDA, 0x9D, 0x89, 0x25, 0x7E, 0xE9, 0x1C, 0x00, 0x3A, 0x00, 0x88, 0x00, 0xD9, 0x64, 0xD8, 0xFE, 0xAB, 0xE1, 0xF0, 0x92, 0x20, 0x2B, 0x0B, 0x6A, 0x05, 0x18, 0x09, 0x9F, 0x6B, 0x10, 0x0A, 0xE2, 0x2E, 0x14, 0x19, 0xCF, 0xA3, 0xFC, 0x6E, 0xF1, 0xAC, 0x9B, 0xD8, 0x88, 0x27, 0xF9, 0x2B, 0x93, 0x4F, 0x94, 0x01, 0xA0, 0xF9, 0xDF, 0xBF, 0x3A, 0xFC, 0xE2, 0xAD, 0x1F, 0x51, 0x98, 0xCF, 0x0A, 0x5E, 0x02, 0xA1, 0xD0, 0xC1, 0x6E, 0x4D, 0x19, 0xF1, 0x3F, 0x6A, 0x5F, 0xAC, 0x18, 0xDA, 0x30, 0x92, 0xA7, 0xEB, 0x7F, 0xD4, 0xFC, 0x3A, 0x0B, 0xC8, 0x03, 0x72, 0xD4, 0x47, 0xF9, 0xA3, 0x4C, 0xAB, 0x88, 0x90, 0x3F, 0xE4, 0x05, 0x58, 0x25, 0xD8, 0x21, 0x78, 0x7A, 0x78, 0x14, 0xF9, 0x56, 0x3F, 0x71, 0x4C, 0xFD, 0x6A, 0x32, 0x00, 0x57, 0x6E, 0x91, 0x40, 0x23, 0x87, 0xE6, 0x38, 0xC8, 0xC2, 0xCF, 0x41, 0x07, 0x56, 0xBA, 0x39, 0xF3, 0x95, 0x6D, 0xD7, 0x89, 0xF9, 0x92, 0x82, 0xC3, 0x3F, 0xF9, 0x20, 0x10, 0xD6, 0x00, 0xB0, 0x0A, 0x4C, 0x6B, 0x40, 0x6C, 0xC2, 0x48, 0x20, 0x04, 0x9A, 0x23, 0x01, 0x5B, 0x14, 0x29, 0x9C, 0x14, 0x38, 0x9B, 0x0C, 0xBB, 0xE6, 0xCE, 0x31, 0x64, 0x83, 0xE4, 0x22, 0x5B, 0xD9, 0x5F, 0x2E, 0xFD, 0xAD, 0x76, 0x39, 0xCF, 0xBC, 0xF1, 0x9C, 0xCE, 0xF2, 0x23, 0xD2, 0xEC, 0xB0, 0x38, 0x91, 0xC9, 0x78, 0xE4, 0x1A, 0x00, 0x3E, 0x12, 0xF5, 0xF2, 0xF9, 0xF7, 0x09, 0xBD, 0x9A, 0x01, 0x44, 0xE2, 0x66, 0xB9, 0x75, 0x62, 0x23, 0x36, 0x75, 0x01, 0x8E, 0xED, 0x96, 0xDB, 0x95, 0x1D, 0xBB, 0xFD, 0x1D, 0xFB, 0xF6, 0x02, 0xE8, 0x08, 0xDE, 0x2C, 0xFF, 0x5C, 0xD5, 0x81, 0x1A, 0x00, 0xEC, 0x02, 0xA1, 0xFC, 0x29, 0x67, 0xA2, 0x77, 0x35, 0xB4, 0x0E, 0xA0, 0x97, 0xDF, 0x72, 0xF9, 0x1C, 0x5B, 0xFE, 0x63, 0xF0, 0xAB, 0x3E, 0x5F, 0x71, 0x06, 0xB0, 0xD6, 0x29, 0x9F, 0xC5, 0xF8, 0x40, 0x03, 0xE4, 0x6A, 0xF9, 0x01, 0x9E, 0x04, 0x3C, 0xE0, 0x39, 0x00, 0xA8, 0x02, 0xA7, 0x22, 0x10, 0xEF, 0x93, 0x16, 0x07, 0xC0, 0xEB, 0x42, 0x1A, 0xE5, 0xA5, 0x48, 0x32, 0x23, 0xD0, 0xDB, 0x57, 0x3A, 0x32, 0x44, 0xED, 0xE5, 0x4D, 0x24, 0xB8, 0xF0, 0xA6, 0xB0, 0xD3, 0x64, 0x1C, 0x7C, 0x5F, 0x3A, 0x14, 0xEE, 0x27, 0xCC, 0xB2, 0x71, 0x38, 0xEC, 0x40, 0x84, 0xD5, 0x25, 0xFD, 0xC5, 0x3A, 0x00, 0x3C, 0x0B, 0xF0, 0x1C, 0x33, 0x00, 0xCC, 0x6C, 0x64, 0x06, 0x50, 0xF7, 0x56, 0x8A, 0xC1, 0x58, 0x91, 0xD6, 0x13, 0xBA, 0x27, 0x87, 0x11, 0x0B, 0x3D, 0xB2, 0x22, 0x55, 0x31, 0xE2, 0xD6, 0xDF, 0xFD, 0xE1, 0x8B, 0x29, 0x03, 0xC8, 0xDB, 0x80, 0xB9, 0x8D, 0xE5, 0x4D, 0x7C, 0x2D, 0x0E, 0x1E, 0x11, 0xA3, 0xD1, 0x5C, 0x18, 0x49, 0xF4, 0x68, 0x07, 0x2D, 0xE4, 0xA1, 0xDB, 0x13, 0x6D, 0x5E, 0xBB, 0x03, 0x5F, 0xCE, 0x2F, 0xDF, 0x54, 0xD3, 0x05, 0x90, 0x14, 0xBD, 0x7A, 0xBD, 0x61, 0x7E, 0x26, 0xD4, 0x65, 0x3B, 0xA1, 0xF2, 0xBA, 0xED, 0x02, 0x24, 0x85, 0x2E, 0x72, 0xBB, 0x86, 0x14, 0xF0, 0x5B, 0x10, 0x10, 0xE1, 0x1C, 0x00, 0x19, 0x40, 0xAE, 0x06, 0xA3, 0x73, 0x80, 0xCD, 0x21, 0x6D, 0xC0, 0xD1, 0xB5, 0x0E, 0x8D, 0x9D, 0x03, 0x50, 0xA1, 0x6F, 0x6E, 0xFB, 0xC0, 0xFC, 0xA9, 0x3C, 0xC5, 0x0E, 0xDE, 0xF8, 0xCD, 0x91, 0x0E, 0x33, 0x00, 0x7C, 0xA5, 0xC5, 0xCB, 0xCF, 0x7F, 0x3F, 0xBD, 0x1B, 0x00, 0x0F, 0x45, 0x2D, 0x7D, 0xAE, 0xE2, 0xC8, 0x36, 0xBB, 0x11, 0x78, 0x5E, 0xE8, 0x91, 0x81, 0x27, 0x3B, 0xCC, 0xBB, 0x00, 0x29, 0x03, 0x28, 0x35, 0x80, 0xBE, 0x68, 0x26, 0x1D, 0x83, 0xB9, 0x9C, 0x88, 0xE4, 0xD2, 0xA5, 0x4A, 0x32, 0x83, 0xC8, 0x86, 0xD8, 0x2C, 0x65, 0x46, 0xE1, 0x6D, 0xA0, 0x3F, 0x69, 0x09, 0x10, 0xC1, 0xD1, 0x12, 0x88, 0xFA, 0xCB, 0x76, 0x4F, 0x7A, 0xD6, 0x12, 0x9A, 0xFC, 0x63, 0x36, 0x50, 0xC1, 0x17, 0x0B, 0x9E, 0x0E, 0xC8, 0x8D, 0xA3, 0x73, 0x26, 0x2D, 0x63, 0x00, 0x60, 0x7A, 0x1C, 0x18, 0xFA, 0x7D, 0xE1, 0xD3, 0xBF, 0x2C, 0x0E, 0x20, 0x09, 0x57, 0x1D, 0xDD, 0x6D, 0x22, 0xA0, 0x27, 0x18, 0x8F, 0xC8, 0x28, 0xE2, 0x1D, 0xA5, 0x3D, 0xBB, 0xB8, 0x7C, 0x9E, 0x9D, 0x57, 0x1E, 0xEC, 0xF6, 0x88, 0xB3, 0xD0, 0x90, 0xCE, 0xFD, 0x41, 0x06, 0xF0, 0x8B, 0x94, 0x01, 0xE0, 0x45, 0x7E, 0xF1, 0x49, 0x3E, 0x2A, 0xDF, 0x9F, 0xAE, 0x98, 0xB2, 0x42, 0x57, 0x3E, 0x13, 0xF4, 0x79, 0xF2, 0xF3, 0xE4, 0x38, 0xAA, 0x2F, 0x1A, 0xCF, 0x6A, 0xB0, 0x99, 0x07, 0x1C, 0xE1, 0xD3, 0xFB, 0x1F, 0xE0, 0xEA, 0x1D, 0x90, 0x7F, 0xFA, 0x0B, 0x83, 0xA3, 0xA0, 0xBC, 0xE5, 0x58, 0x7B, 0x1A, 0x65, 0x8A, 0x17, 0x4D, 0xDB, 0x56, 0xF2, 0xF5, 0xE0, 0x6C, 0x00, 0xFF, 0xB5, 0xDB, 0x05, 0x60, 0x83, 0x4E, 0xBB, 0x00, 0x58, 0x03, 0xC0, 0x35, 0x20, 0xBC, 0x18, 0x22, 0x9D, 0x03, 0x48, 0x06, 0x60, 0xD5, 0x00, 0x92, 0x45, 0x55, 0x4F, 0xED, 0x7A, 0xE8, 0x62, 0x71, 0xAA, 0xBF, 0x77, 0x7F, 0x14, 0x6E, 0xD4, 0xAF, 0xC2, 0x6F, 0x6B, 0x00, 0x79, 0xBB, 0x4F, 0x66, 0x04, 0x5C, 0x8B, 0xC8, 0x19, 0x00, 0xEC, 0x02, 0x40, 0x0D, 0x20, 0xBF, 0x5E, 0x4C, 0x9E, 0x04, 0xB4, 0x6B, 0x6B, 0xC3, 0x8A, 0xFF, 0x48, 0x1D, 0x23, 0xFD, 0xB7, 0xD0, 0x28, 0x0E, 0x1D, 0x33, 0x25, 0x3C, 0x09, 0xF8, 0x2B, 0x78, 0x18, 0x88, 0x1E, 0xD7, 0xC9, 0x59, 0xB2, 0x75, 0x64, 0x96, 0x1C, 0xC0, 0x6C, 0xB9, 0xB3, 0xDC, 0x1E, 0x4F, 0xFE, 0x63, 0x7A, 0x5A, 0xF5, 0xA9, 0xD4, 0x00, 0xDC, 0x25, 0x2E, 0xE9, 0xBD, 0xE5, 0x59, 0x8B, 0x97, 0x14, 0xF4, 0x69, 0x0F, 0xAE, 0xED, 0xC6, 0xF3, 0xF0, 0x1E, 0xFC, 0xA5, 0xE3, 0x3D, 0x1D, 0x2C, 0xF0, 0xD2, 0xD9, 0x5F, 0x38, 0x07, 0x00, 0x11, 0x00, 0x0F, 0x02, 0x95, 0xC8, 0xBF, 0xCA, 0x01, 0x78, 0x86, 0x1A, 0x29, 0xC0, 0x96, 0xED, 0x00, 0x2B, 0x29, 0x2A, 0x5A, 0x3E, 0xFE, 0xA2, 0x5A, 0x46, 0x21, 0x3C, 0x7B, 0x04, 0xAE, 0x01, 0xBC, 0x7C, 0x0E, 0x47, 0x81, 0x53, 0x3F, 0x72, 0x80, 0x25, 0x4E, 0xE6, 0xC7, 0x83, 0x90, 0x4B, 0xAD, 0x03, 0xC9, 0x0A, 0x61, 0x6E, 0x47, 0xB9, 0x06, 0x42, 0x7C, 0x61, 0xA1, 0x18, 0xFA, 0xA2, 0x23, 0x67, 0x03, 0x5F, 0x0B, 0x53, 0xB3, 0x2B, 0x82, 0x57, 0xC6, 0xCB, 0x73, 0x7E, 0x10, 0xF5, 0x21, 0xEC, 0xE3, 0x12, 0xF0, 0x00, 0xEF, 0x03, 0xE0, 0x53, 0xCF, 0xBC, 0x14, 0x94, 0x53, 0xE6, 0x60, 0x91, 0xF9, 0xB9, 0x2C, 0x55, 0x8F, 0xE4, 0x1B, 0x39, 0xF8, 0xA8, 0x3D, 0x82, 0xEF, 0xB7, 0x3F, 0xE9, 0x0C, 0xA0, 0x54, 0xFD, 0x67, 0x44, 0x1C, 0x76, 0x5A, 0xF8, 0xEA, 0x2F, 0x7C, 0xE1, 0x22, 0xEE, 0x02, 0x70, 0x0D, 0xA0, 0x2C, 0x01, 0x44, 0xFE, 0x27, 0xF7, 0x83, 0x8F, 0xB9, 0x1D, 0x33, 0xCB, 0x73, 0x0B, 0x43, 0xD2, 0xE3, 0xF4, 0x2E, 0x00, 0x9F, 0x0B, 0x20, 0xBB, 0xCE, 0x6B, 0xDD, 0xA4, 0x0F, 0xA8, 0xF4, 0xB7, 0x87, 0x8F, 0x53, 0x0D, 0x00, 0x5F, 0x15, 0x36, 0x7F, 0x17, 0x60, 0x06, 0xDB, 0xCF, 0xA0, 0x6B, 0x5B, 0x03, 0x48, 0x4B, 0x00, 0x59, 0x03, 0xC0, 0x45, 0x53, 0xB2, 0xF1, 0xFE, 0xA4, 0x9F, 0x3E, 0xA0, 0xDE, 0x11, 0x13, 0x39, 0xBE, 0x33, 0x6E, 0x77, 0x77, 0x01, 0xA2, 0x35, 0xDA, 0xA4, 0x44, 0x97, 0xE4, 0x66, 0x81, 0x8A, 0xAC, 0xC2, 0xC7, 0x8A, 0x20, 0x54, 0x5D, 0xFD, 0x12, 0x54, 0x81, 0xF3, 0x96, 0x20, 0x39, 0x77, 0xB5, 0x9D, 0x57, 0x1C, 0x40, 0x94, 0xDA, 0x4C, 0x2E, 0x11, 0x96, 0x7B, 0xE8, 0x7E, 0x5B, 0x07, 0x11, 0x21, 0x06, 0x9B, 0x8A, 0x95, 0x33, 0x80, 0xFA, 0xA6, 0x64, 0x5A, 0xE2, 0xA7, 0xEA, 0x33, 0x67, 0x06, 0xF9, 0xCD, 0xB6, 0x57, 0xF8, 0x4A, 0x30, 0xC8, 0x00, 0x72, 0xB1, 0x33, 0xAF, 0x96, 0xD9, 0xF7, 0xF1, 0xDA, 0x39, 0x5D, 0x13, 0xFA, 0x5C, 0xC0, 0x9E, 0xED, 0x08, 0xB7, 0x36, 0x7F, 0x4F, 0xBF, 0x34, 0x3F, 0x44, 0xC0, 0xCE, 0x74, 0x30, 0x21, 0x44, 0x14, 0x5C, 0xE2, 0x2E, 0x00, 0xD6, 0x43, 0xF0, 0xAD, 0xCD, 0xEC, 0x00, 0x32, 0xBA, 0x75, 0x92, 0xE2, 0x00, 0x66, 0xCC, 0xDB, 0x90, 0x7C, 0xCE, 0x0E, 0xE0, 0x28, 0xBB, 0x00, 0x47, 0x70, 0x00, 0x23, 0x3A, 0x34, 0x32, 0x2D, 0x2B, 0x34, 0x9F, 0x03, 0x78, 0x17, 0x77, 0x01, 0xF0, 0xD1, 0x60, 0x51, 0x03, 0xA8, 0x0A, 0xAF, 0x52, 0x3F, 0x57, 0x90, 0x6C, 0xE0, 0x9E, 0xA1, 0x47, 0xED, 0x9C, 0xE2, 0xCD, 0x1D, 0xDF, 0xC3, 0xB5, 0x32, 0x80, 0x62, 0xD8, 0x64, 0xE8, 0x29, 0x03, 0x48, 0xE7, 0xDF, 0x1E, 0x0E, 0x1F, 0xC1, 0xB3, 0x00, 0x59, 0xF9, 0x37, 0xCC, 0x00, 0x46, 0x04, 0x31, 0x22, 0xD0, 0x8D, 0xFB, 0xB0, 0x73, 0xCB, 0x5E, 0x0E, 0xFF, 0xC1, 0x1A, 0x10, 0xC8, 0x3F, 0x73, 0x80, 0xCE, 0x52, 0x19, 0x47, 0x67, 0x8B, 0xDC, 0x4B, 0xA5, 0x70, 0x66, 0x8D, 0xA7, 0xCA, 0x35, 0xD7, 0x64, 0x22, 0x39, 0xB3, 0x3E, 0x44, 0x7A, 0xE1, 0xB5, 0x1B, 0xF0, 0xD9, 0xA9, 0xA9, 0x93, 0xAD, 0x9B, 0x65, 0x00, 0x73, 0x23, 0xF4, 0xAA, 0xFE, 0x82, 0xBE, 0xA5, 0x3A, 0x82, 0xE7, 0x00, 0xAE, 0xC0, 0xE8, 0xB1, 0x0A, 0x7C, 0x0D, 0x0E, 0xA0, 0x6C, 0x03, 0x51, 0x11, 0x88, 0xE1, 0x16, 0x5D, 0xF1, 0xCA, 0xD0, 0x6D, 0xB0, 0xD0, 0xC1, 0xE3, 0xE8, 0xD7, 0x09, 0xAD, 0xC6, 0xE0, 0x58, 0xCD, 0x6B, 0xFD, 0xBB, 0x22, 0x81, 0x7F, 0xD5, 0x1A, 0x00, 0xEE, 0x02, 0x7C, 0x9C, 0x32, 0x00, 0x54, 0x6C, 0x99, 0x01, 0xF4, 0xE7, 0x00, 0xF4, 0x9A, 0x5F, 0xAF, 0xD1, 0x1B, 0x79, 0x4E, 0x39, 0x00, 0x2A, 0x2C, 0xAC, 0x92, 0xFF, 0x80, 0xD0, 0x3D, 0xF8, 0xE5, 0x3E, 0x1F, 0x05, 0xFF, 0x24, 0x3B, 0x80, 0x5A, 0xD7, 0x98, 0xE0, 0x9B, 0x37, 0xAF, 0xA6, 0x77, 0xF4, 0x5A, 0x07, 0x14, 0xA9, 0x74, 0x12, 0x8D, 0x51, 0x78, 0x73, 0xC7, 0x03, 0xDC, 0x27, 0x5D, 0x03, 0x18, 0xD0, 0x83, 0xAE, 0x4B, 0x31, 0x0F, 0x24, 0x9E, 0x23, 0x00, 0x16, 0x01, 0xF1, 0x7D, 0xD9, 0x14, 0x21, 0xCB, 0x73, 0xF1, 0x5E, 0x91, 0xA1, 0x13, 0x1C, 0xDD, 0xF0, 0x32, 0x84, 0xC9, 0x94, 0x5D, 0x78, 0x10, 0x77, 0xBC, 0x43, 0xA9, 0x61, 0x68, 0xF5, 0x1C, 0x00, 0xBF, 0xD6, 0x4A, 0x6C, 0x5E, 0x24, 0xC7, 0x99, 0xE9, 0xE4, 0x93, 0x80, 0xB9, 0x06, 0xC0, 0xE7, 0x00, 0xC8, 0x3F, 0x50, 0x60, 0x59, 0xC2, 0xDF, 0xF3, 0x1E, 0x23, 0xB6, 0xF3, 0x50, 0xFE, 0x90, 0x0A, 0x7D, 0x01, 0x9F, 0x06, 0x35, 0xCE, 0x01, 0x64, 0xA9, 0x64, 0x06, 0x5B, 0x35, 0x80, 0x21, 0x07, 0xE6, 0x39, 0x42, 0x4F, 0x7F, 0x34, 0xF3, 0xCA, 0x78, 0x05, 0x28, 0x72, 0x1C, 0x5E, 0xBB, 0x01, 0xBF, 0xD9, 0x05, 0xF0, 0x82, 0x19, 0xC5, 0x0D, 0x4E, 0x22, 0xD2, 0xEF, 0x66, 0x8D, 0x38, 0xF3, 0x5A, 0x3B, 0xB7, 0xA5, 0xF0, 0xD8, 0x98, 0xE5, 0x78, 0xCF, 0x09, 0xCA, 0xFB, 0xF8, 0x37, 0x16, 0x01, 0x31, 0xF1, 0x4B, 0xE7, 0x00, 0x44, 0x0A, 0x68, 0x9E, 0x03, 0x38, 0x6F, 0xAD, 0x6E, 0xB0, 0x6B, 0x12, 0x95, 0x92, 0x29, 0x29, 0x4E, 0xA5, 0xA3, 0xC0, 0xE8, 0x0C, 0xF0, 0x1C, 0xC0, 0x0F, 0x9B, 0x5D, 0x03, 0x7E, 0x2D, 0xBE, 0x8E, 0x83, 0x53, 0xC1, 0x6F, 0xA9, 0xFC, 0x58, 0xDF, 0x8E, 0x39, 0xDE, 0xB2, 0xA9, 0x34, 0x1F, 0xB0, 0xA4, 0x9C, 0x03, 0x80, 0x62, 0x60, 0xB5, 0x99, 0xF6, 0xBD, 0x7B, 0x19, 0xB7, 0xFE, 0x1C, 0xC0, 0x90, 0x03, 0x78, 0x02, 0x7A, 0x33, 0xF9, 0x2C, 0xC0, 0xB1, 0x32, 0x0F, 0xCF, 0x48, 0xD7, 0xCE, 0xE7, 0x3A, 0x50, 0xD1, 0x90, 0x4C, 0x01, 0x23, 0x20, 0x3F, 0x0B, 0x80, 0xE7, 0x00, 0xAE, 0xE0, 0x1C, 0x00, 0x6F, 0x83, 0x89, 0x6D, 0xC0, 0xD9, 0x27, 0x01, 0xBD, 0x08, 0xFE, 0x88, 0xF7, 0x79, 0x8D, 0xD9, 0x7E, 0x2E, 0x8D, 0x8B, 0x82, 0xC5, 0x23, 0xA4, 0x8F, 0x99, 0xC1, 0x67, 0x30, 0xA0, 0x08, 0x08, 0x8F, 0x03, 0x27, 0x67, 0x30, 0xBF, 0x06, 0xB0, 0x56, 0x5E, 0x73, 0xC7, 0x8F, 0xC8, 0x57, 0xF6, 0xB1, 0xE0, 0xA7, 0x76, 0x52, 0x02, 0x34, 0x6B, 0x7C, 0x23, 0x94, 0x75, 0x0E, 0x20, 0x77, 0x23, 0xC7, 0x99, 0x00, 0x71, 0x86, 0x98, 0x67, 0x68, 0x96, 0x5E, 0x8F, 0x28, 0xDF, 0x59, 0xBB, 0x45, 0x03, 0x78, 0x75, 0x35, 0x00, 0xBD, 0xD4, 0x1D, 0x75, 0x62, 0xA3, 0x1E, 0x71, 0x2D, 0xFC, 0x68, 0xBC, 0xCE, 0x4C, 0x8A, 0xB0, 0x88, 0x90, 0x32, 0x9E, 0xAC, 0xFB, 0xDD, 0x4F, 0x72, 0x0D, 0xA0, 0xBC, 0x07, 0x60, 0xE4, 0x24, 0xA0, 0xA7, 0x89, 0xC3, 0x29, 0x9F, 0x02, 0xE0, 0x8D, 0x1B, 0x65, 0x7E, 0x23, 0x68, 0x4E, 0x5B, 0xB9, 0x36, 0x00, 0xD7, 0xAC, 0xC0, 0xA5, 0x8C, 0x9F, 0xA3, 0x1A, 0x1E, 0xFF, 0xFD, 0x39, 0xD5, 0x00, 0x98, 0xFE, 0xAC, 0xF2, 0xAA, 0x06, 0xC0, 0x0A, 0x4F, 0xBF, 0x8B, 0x0D, 0x09, 0xFC, 0x22, 0xB9, 0x70, 0x57, 0xAF, 0x9F, 0x55, 0x62, 0xD1, 0x19, 0x9E, 0xA5, 0xCF, 0x1E, 0x5C, 0xA9, 0x8F, 0xF5, 0x6F, 0x79, 0x0E, 0x80, 0x9E, 0x06, 0xE4, 0x1A, 0x40, 0xA1, 0xB1, 0xAF, 0x01, 0xE4, 0xF1, 0xA3, 0x39, 0x91, 0x21, 0xB4, 0x48, 0xBE, 0x5B, 0xB5, 0x47, 0xFA, 0x67, 0xA1, 0x26, 0x8F, 0x02, 0x8B, 0x3C, 0xA8, 0xA9, 0x72, 0x76, 0x4B, 0x61, 0x25, 0x09, 0xFD, 0x14, 0x5E, 0x59, 0xF2, 0x72, 0xC0, 0x51, 0xBF, 0xBD, 0x76, 0xC6, 0x6F, 0xEA, 0x2C, 0xBB, 0x3E, 0xD9, 0x36, 0x79, 0xAD, 0x14, 0x97, 0xA3, 0x3F, 0xCA, 0x32, 0x9D, 0x7F, 0x06, 0x44, 0xBE, 0x08, 0x6B, 0xC0, 0x07, 0x4C, 0x01, 0x49, 0xBE, 0x49, 0xD0, 0xE5, 0x54, 0x08, 0x79, 0x7E, 0x32, 0x8A, 0x5A, 0x23, 0xC0, 0xFB, 0xC2, 0xB0, 0xBA, 0xFE, 0x3A, 0x72, 0x20, 0x03, 0xD2, 0x74, 0x14, 0x49, 0x8E, 0x79, 0x9D, 0xE7, 0x61, 0xBE, 0xB0, 0xDE, 0x56, 0x23, 0xC8, 0xF4, 0xDD, 0xA7, 0x03, 0x42, 0xF0, 0x42, 0x10, 0x7C, 0x1F, 0x00, 0xBE, 0x13, 0x90, 0xDE, 0x88, 0x64, 0xE9, 0x79, 0xD1, 0x2B, 0x47, 0xEE, 0x5B, 0xC9, 0x4B, 0xCB, 0x5F, 0x97, 0x4E, 0x8A, 0xFE, 0x12, 0x1E, 0x73, 0xE6, 0x6D, 0x42, 0x36, 0x85, 0x6F, 0xE4, 0xD1, 0xBB, 0xFF, 0x0C, 0xEF, 0x03, 0xA0, 0xEF, 0xC1, 0x75, 0xA9, 0xBE, 0x74, 0x9C, 0xEC, 0xF5, 0x52, 0x80, 0x58, 0x29, 0xDF, 0x70, 0x7C, 0xA0, 0x5F, 0x5A, 0xDF, 0xE6, 0xEA, 0x9F, 0xD0, 0xE7, 0x26, 0x03, 0x98, 0xE3, 0x85, 0x8B, 0xB0, 0x0C, 0x23, 0xDB, 0xCC, 0xCB, 0xA3, 0x8D, 0x89, 0x90, 0xAE, 0xB6, 0xE8, 0x8B, 0x4D, 0x21, 0x2E, 0x32, 0xF2, 0x5B, 0xF3, 0xEB, 0x88, 0x90, 0x5F, 0x08, 0xF2, 0x00, 0xFB, 0xC0, 0xDF, 0xC9, 0x6B, 0xBC, 0xE2, 0xE0, 0xDB, 0x1C, 0xA2, 0x79, 0x23, 0x50, 0x77, 0x0C, 0x8C, 0x67, 0xB6, 0x62, 0x95, 0x30, 0x78, 0x16, 0x78, 0x62, 0x5A, 0xAB, 0x40, 0xF9, 0x0B, 0xC3, 0xCB, 0xC7, 0xE7, 0x9A, 0x85, 0x54, 0xC8, 0x2C, 0x99, 0x44, 0x05, 0x1B, 0x4A, 0x33, 0x2B, 0x39, 0x00, 0xB8, 0x77, 0x0F, 0x35, 0x80, 0x5F, 0xC2, 0x4B, 0x41, 0xAF, 0xF8, 0xA5, 0xA0, 0x75, 0x48, 0x17, 0x0B, 0xB4, 0xBC, 0xE5, 0x35, 0xFF, 0x3D, 0xA6, 0x3F, 0xED, 0xBB, 0x1A, 0x1D, 0xCA, 0x35, 0xA7, 0x9A, 0xEB, 0x48, 0xBF, 0x2C, 0x7C, 0x98, 0x1D, 0x45, 0x02, 0x94, 0x01, 0xBE, 0x03, 0xF2, 0x97, 0xAF, 0x04, 0x6F, 0xE5, 0xED, 0xC9, 0xB7, 0x83, 0xC6, 0x53, 0x76, 0xF2, 0x6D, 0xE4, 0x53, 0x25, 0x93, 0x39, 0xAD, 0x1D, 0x8C, 0x6E, 0xEF, 0xB8, 0xD0, 0xEA, 0x66, 0x95, 0x34, 0x73, 0x51, 0x66, 0x29, 0x64, 0x3C, 0xE5, 0x96, 0xFD, 0xB6, 0xC3, 0xD7, 0x6E, 0x17, 0x40, 0x2A, 0x07, 0x7E, 0x3A, 0x3B, 0x65, 0x00, 0x68, 0x82, 0x72, 0x17, 0xA0, 0x68, 0x37, 0x85, 0x52, 0xBA, 0x96, 0x4E, 0x44, 0x48, 0xBC, 0xFC, 0xA9, 0xDB, 0xAD, 0x6B, 0xCB, 0x70, 0x22, 0x03, 0x92, 0x0A, 0xAF, 0x0D, 0x51, 0xA7, 0xC5, 0x2D, 0x5E, 0xBA, 0x78, 0x55, 0x43, 0xE7, 0x1D, 0x64, 0x3D, 0x37, 0x90, 0x01, 0xBC, 0x78, 0xFE, 0xBD, 0xFA, 0x2C, 0x80, 0x45, 0xD4, 0x85, 0xDE, 0x4B, 0x75, 0x0F, 0x90, 0x3F, 0x9E, 0x03, 0x49, 0x8F, 0x03, 0x27, 0x9B, 0xC6, 0x40, 0x50, 0xBF, 0x06, 0xDD, 0x17, 0xFF, 0x32, 0xFF, 0x22, 0x3D, 0xA8, 0x2C, 0x5B, 0x9B, 0xDB, 0xB7, 0x26, 0x1E, 0x39, 0xBE, 0x39, 0xFA, 0xC7, 0x2E, 0xAC, 0x38, 0x80, 0x92, 0x1E, 0x23, 0x89, 0x18, 0x24, 0xB8, 0x47, 0xFA, 0x60, 0x42, 0xFD, 0xA8, 0x66, 0xF2, 0x89, 0x4D, 0xBB, 0x88, 0xBE, 0x44, 0x6F, 0x41, 0xA4, 0xB5, 0x9F, 0x12, 0x55, 0xA4, 0x7D, 0xA5, 0x74, 0x9C, 0x6E, 0x68, 0x76, 0xAD, 0x65, 0x9F, 0x3F, 0x1E, 0x29, 0xE2, 0xF7, 0x01, 0x7C, 0xFB, 0x70, 0x53, 0x6A, 0x00, 0xD1, 0x8C, 0x4F, 0xDF, 0x1A, 0xB2, 0x5C, 0xF1, 0x24, 0x20, 0x2A, 0xFB, 0x2B, 0x78, 0x1C, 0x98, 0x4E, 0x02, 0xAE, 0x59, 0xE3, 0x3A, 0x6C, 0xD1, 0x71, 0xA9, 0xBB, 0x0E, 0xF4, 0x63, 0x6B, 0x6E, 0x57, 0xE9, 0xD6, 0x4F, 0x77, 0xA7, 0x73, 0x20, 0xF0, 0x38, 0x78, 0x25, 0x5F, 0x46, 0xD1, 0xAD, 0x31, 0x38, 0x3F, 0x78, 0xE9, 0xE3, 0xA0, 0xCD, 0xB1, 0x51, 0x12, 0x4A, 0x79, 0x67, 0x3D, 0x3E, 0x38, 0x02, 0x16, 0xDF, 0x5F, 0x8B, 0xE5, 0x6C, 0xCA, 0x2A, 0xD9, 0x51, 0x78, 0xFD, 0x6B, 0x7B, 0x53, 0x60, 0xF0, 0x0A, 0x0F, 0xAB, 0xEE, 0xD7, 0xBD, 0x6F, 0xCD, 0xF2, 0x94, 0xF9, 0x01, 0xEC, 0x67, 0x70, 0x10, 0xE8, 0xF6, 0x16, 0x1E, 0x06, 0x7A, 0xF9, 0xF5, 0xFC, 0x2C, 0xC0, 0x1D, 0x9E, 0x05, 0xAF, 0x2F, 0xC4, 0x96, 0x91, 0x35, 0x47, 0x07, 0x82, 0x44, 0x0E, 0xAB, 0x3D, 0x7C, 0x43, 0xED, 0xA4, 0x3B, 0xC9, 0x01, 0x4E, 0x78, 0x33, 0xB7, 0x3D, 0x79, 0xD7, 0x09, 0x6F, 0x48, 0xED, 0x7A, 0xBC, 0x99, 0x69, 0xE8, 0xF4, 0xBF, 0x18, 0x1B, 0xF6, 0x86, 0xAF, 0x22, 0x25, 0x04, 0xE1, 0x85, 0x20, 0xF0, 0x61, 0x90, 0x37, 0x6F, 0xE0, 0xF3, 0xD8, 0xF8, 0x3E, 0x00, 0x55, 0x00, 0xF5, 0xD5, 0xD5, 0x4B, 0xF6, 0xF3, 0xFD, 0xB2, 0x73, 0xCE, 0x7A, 0x53, 0x36, 0xD2, 0x24, 0x7F, 0xB7, 0xD5, 0x87, 0xAC, 0x9F, 0x8C, 0x71, 0x1F, 0xA3, 0xB5, 0x3C, 0x91, 0xE6, 0x7F, 0xBD, 0xBD, 0x3B, 0x7C, 0x11, 0xE4, 0x8F, 0xE7, 0x00, 0xF0, 0x9D, 0x28, 0xF8, 0x71, 0xB4, 0xB4, 0x04, 0x50, 0xE4, 0x95, 0x7A, 0x8A, 0x06, 0xAF, 0x32, 0xEE, 0xD4, 0x6C, 0xE8, 0x47, 0x23, 0x2F, 0x2F, 0x65, 0xB3, 0xBC, 0xE5, 0x5A, 0xF8, 0x5A, 0x9F, 0x24, 0x7E, 0xAC, 0x66, 0xE5, 0xEB, 0xC0, 0xD9, 0x32, 0x98, 0x86, 0x2A, 0x7B, 0x3E, 0x21, 0x26, 0xDA, 0xB5, 0x62, 0x78, 0xEA, 0x90, 0xE6, 0x13, 0xE3, 0xEB, 0x91, 0x0A, 0xC1, 0x25, 0xA9, 0x74, 0xC2, 0x68, 0xF2, 0x37, 0xFC, 0xEA, 0x78, 0x53, 0x19, 0xA3, 0x83, 0x3A, 0xC6, 0x20, 0x26, 0x03, 0x85, 0xFE, 0x87, 0xC3, 0xAB, 0xC3, 0xBF, 0xFF, 0xF0, 0xDB, 0xF0, 0x4D, 0x78, 0x38, 0x13, 0x50, 0x32, 0x11, 0x69, 0x81, 0x6D, 0xF5, 0xD7, 0x4B, 0xB1, 0x2C, 0x39, 0x31, 0xEF, 0x7B, 0x3F, 0xD0, 0x6B, 0x80, 0xE6, 0x5F, 0x46, 0xBB, 0x5D, 0x2B, 0x33, 0x29, 0x9E, 0x5F, 0xD1, 0x0A, 0x2E, 0xD3, 0xD7, 0x0C, 0xBF, 0x6A, 0x18, 0xFE, 0x7D, 0x0B, 0x9A, 0xFA, 0x06, 0xF0, 0xFE, 0x1F, 0xDF, 0xFB, 0xDE, 0xE1, 0x0D, 0xF8, 0x4A, 0x0E, 0xBC, 0x20, 0xB0, 0xBE, 0x0C, 0x33, 0xEB, 0x71, 0xF3, 0x93, 0xE0, 0xC3, 0x3F, 0xF9, 0xDB, 0x81, 0x95, 0x13, 0x75, 0xF7, 0x80, 0xF0, 0x55, 0x7A, 0x22, 0xE5, 0x2F, 0x94, 0x2A, 0x61, 0xA4, 0xF5, 0x23, 0x5B, 0x8F, 0x0D, 0x5F, 0x8B, 0x72, 0x48, 0x3F, 0x26, 0xE4, 0x8F, 0x5B, 0x7F, 0x7F, 0x00, 0x2E, 0xFC, 0xD9, 0x87, 0xDF, 0x4A, 0xEF, 0x86, 0xC8, 0x5B, 0xA1, 0x39, 0xD0, 0xB5, 0x1E, 0xA0, 0x0F, 0x57, 0x2C, 0xDB, 0x2C, 0xA5, 0x96, 0x57, 0x23, 0xD7, 0x2C, 0x5F, 0x1E, 0x39, 0x4F, 0xFE, 0x32, 0x8F, 0x69, 0xE2, 0x12, 0x69, 0x4D, 0x84, 0x7F, 0xDB, 0x5E, 0x3E, 0x0F, 0x4E, 0xA3, 0x7B, 0xC9, 0x4B, 0x26, 0x6A, 0xEA, 0x3A, 0xA9, 0x18, 0x9A, 0x63, 0x5A, 0xAE, 0x73, 0x33, 0x82, 0x3F, 0x07, 0xD6, 0xC4, 0x14, 0x49, 0x6A, 0xC9, 0x79, 0x5C, 0xC1, 0xC7, 0x21, 0xBF, 0x06, 0x7F, 0x63, 0x04, 0x60, 0x95, 0x6F, 0x55, 0xBF, 0xB8, 0x45, 0xCF, 0xFA, 0x79, 0x9E, 0x53, 0xB5, 0xEB, 0x68, 0xC5, 0xA6, 0x45, 0xF7, 0xB5, 0x3B, 0xCB, 0x8E, 0xE5, 0xBE, 0x7E, 0x17, 0xE0, 0xFD, 0x1F, 0xA5, 0x93, 0x80, 0xF7, 0x98, 0x01, 0x50, 0x31, 0xB4, 0xFD, 0x08, 0xD6, 0x1C, 0x05, 0x58, 0x29, 0xA0, 0xA3, 0xCB, 0xBF, 0x3E, 0xD7, 0x8F, 0xF5, 0x1F, 0xDC, 0xF8, 0x78, 0xE7, 0xC5, 0xD7, 0xD2, 0x53, 0x11, 0xE5, 0xF5, 0xE7, 0xB4, 0xBE, 0x95, 0x1F, 0xC5, 0x4D, 0x86, 0xBE, 0x91, 0x7C, 0x0B, 0x98, 0x8D, 0xE0, 0x15, 0x8E, 0x0B, 0x78, 0xE9, 0xCF, 0x41, 0xF8, 0xE5, 0xDB, 0x80, 0x0C, 0x88, 0x77, 0x14, 0xD0, 0x19, 0xB3, 0x33, 0x6F, 0x82, 0x74, 0x49, 0x25, 0xB3, 0xA6, 0x25, 0x99, 0x09, 0x9B, 0x69, 0x82, 0xF2, 0x92, 0xF6, 0xC0, 0x87, 0x78, 0x41, 0xBF, 0xE0, 0x2F, 0xC6, 0x5B, 0x59, 0x55, 0xE9, 0x87, 0x4B, 0x80, 0xFB, 0xBB, 0xC3, 0x97, 0x3F, 0x82, 0x8F, 0x43, 0x82, 0x03, 0x28, 0x4F, 0x03, 0xAA, 0xD8, 0x57, 0xF3, 0xA2, 0x95, 0xCA, 0xAD, 0x05, 0xA2, 0xC1, 0xCD, 0x6D, 0x8F, 0x04, 0x6C, 0xA2, 0x5B, 0x2D, 0x2C, 0x7F, 0x0D, 0x07, 0x9E, 0x05, 0x78, 0xEF, 0xA7, 0xB0, 0x0D, 0x28, 0x32, 0x35, 0x8A, 0x04, 0xF5, 0x4B, 0x48, 0xF5, 0x4C, 0x40, 0x32, 0x04, 0x29, 0x1F, 0x0A, 0xD6, 0x4D, 0x06, 0x24, 0xF5, 0x43, 0xF7, 0xB7, 0xC6, 0x6B, 0xFD, 0x91, 0xF2, 0xA3, 0xC9, 0x74, 0x86, 0xA5, 0xB3, 0x93, 0x71, 0x17, 0x25, 0x1C, 0x40, 0xFA, 0x2C, 0x0A, 0x7C, 0x1D, 0xFA, 0xC3, 0xAF, 0x01, 0x4D, 0x78, 0x26, 0x94, 0x23, 0xBD, 0x53, 0xE4, 0x8B, 0xE4, 0x13, 0xC9, 0x33, 0x1A, 0x1F, 0xB5, 0xAF, 0x54, 0x3F, 0xAF, 0x72, 0xD9, 0x66, 0x00, 0x6B, 0x27, 0x79, 0x02, 0xE3, 0x8B, 0x53, 0x48, 0xDB, 0x80, 0x10, 0x01, 0x20, 0x03, 0x40, 0x05, 0x08, 0x1D, 0x40, 0x64, 0x70, 0x3A, 0x8F, 0x0B, 0xAE, 0x9B, 0x7D, 0x7A, 0x9D, 0xB5, 0x6D, 0x70, 0xCD, 0xBB, 0x83, 0xE5, 0xAD, 0xC6, 0x62, 0x61, 0x8B, 0xA8, 0x61, 0x11, 0x34, 0x7F, 0x1C, 0x14, 0x32, 0x80, 0x1B, 0x78, 0x29, 0x2A, 0x38, 0x43, 0xBD, 0x6D, 0xF8, 0x04, 0xC4, 0x39, 0x13, 0xC5, 0xBA, 0x2B, 0x92, 0x6B, 0x06, 0xF0, 0x34, 0x20, 0xC8, 0x3F, 0x7F, 0x1C, 0x94, 0x8B, 0xDB, 0x18, 0xF9, 0x6A, 0x7D, 0x4B, 0xD7, 0x03, 0x78, 0x42, 0x57, 0x7E, 0xA5, 0x83, 0xF0, 0x76, 0x52, 0x9E, 0xD4, 0x1E, 0x8D, 0x8F, 0xDA, 0x3B, 0x83, 0x56, 0xFA, 0xE9, 0xD6, 0x2D, 0x14, 0x7E, 0xA7, 0x77, 0x00, 0x47, 0x4F, 0xFB, 0x5A, 0x1D, 0x69, 0x1C, 0x00, 0x70, 0xE9, 0x5D, 0xCC, 0x00, 0x52, 0xEA, 0x2B, 0xC2, 0x99, 0xC0, 0x49, 0x66, 0x41, 0xDD, 0xF2, 0x70, 0x03, 0x43, 0xED, 0x14, 0x6C, 0xA6, 0x23, 0xF1, 0x0A, 0x56, 0x25, 0x4A, 0xAA, 0xEC, 0x2C, 0xF7, 0xCF, 0xCF, 0x02, 0xA4, 0x73, 0x00, 0xEF, 0xFD, 0x04, 0x76, 0xC1, 0xF2, 0x47, 0x31, 0xA5, 0x0E, 0x4D, 0x45, 0xD9, 0x99, 0x56, 0x77, 0x56, 0xDD, 0x59, 0xFE, 0xC9, 0x15, 0x80, 0x77, 0x7C, 0xF7, 0xC3, 0x6F, 0xD0, 0x87, 0x41, 0xDA, 0x0C, 0xA0, 0x41, 0x9A, 0x54, 0x43, 0xD6, 0xA5, 0x3B, 0x03, 0xCD, 0x2F, 0x15, 0x18, 0xAF, 0x6F, 0x47, 0x8E, 0x62, 0xA5, 0x1E, 0x14, 0xFC, 0x03, 0x38, 0xA7, 0x77, 0x00, 0x8F, 0xAC, 0x1E, 0x49, 0x01, 0xD2, 0xF2, 0x1F, 0x0A, 0x3F, 0x70, 0x02, 0xEC, 0x9D, 0x17, 0x5F, 0x4D, 0x92, 0x2B, 0x07, 0x81, 0xCA, 0x1E, 0x67, 0x46, 0xAC, 0xAB, 0x01, 0x78, 0xA9, 0xDA, 0x5A, 0x81, 0xD1, 0xF8, 0x4E, 0xB1, 0x3C, 0x45, 0xD1, 0x7C, 0x53, 0xE3, 0xCB, 0xF9, 0x20, 0x5A, 0xCA, 0xC9, 0x88, 0x90, 0x32, 0x80, 0xF4, 0x46, 0x20, 0xC8, 0x00, 0xDE, 0xFF, 0x71, 0x2E, 0x87, 0x88, 0x93, 0x80, 0x8F, 0xEC, 0x93, 0x1F, 0x51, 0x03, 0xEA, 0x12, 0x20, 0xE5, 0x7F, 0xF8, 0x46, 0xA0, 0x8F, 0xFE, 0xA2, 0x7F, 0x16, 0x80, 0x18, 0xC0, 0xCB, 0x4D, 0xE9, 0xF8, 0x99, 0x8F, 0x4B, 0x33, 0x38, 0x57, 0xBE, 0x91, 0x9C, 0x97, 0xEA, 0x97, 0x82, 0xAB, 0xF1, 0x37, 0x1D, 0x80, 0x56, 0x80, 0xB5, 0x0A, 0x11, 0x8D, 0x8F, 0xDA, 0x47, 0x35, 0x44, 0xC2, 0x99, 0x82, 0x99, 0x9D, 0x40, 0x2E, 0x7C, 0xBD, 0x07, 0x19, 0xC0, 0x7D, 0x7A, 0x2D, 0x38, 0xDE, 0xEC, 0xE3, 0x5E, 0x71, 0x00, 0xA3, 0x48, 0x9C, 0x49, 0xBF, 0xA2, 0x2F, 0xE4, 0x00, 0xDA, 0x94, 0x31, 0xBF, 0x15, 0xF8, 0x1A, 0xE8, 0x7F, 0xF1, 0xDE, 0x8F, 0x0F, 0xD7, 0x37, 0xB0, 0x1C, 0xE0, 0x17, 0xA2, 0x90, 0xDB, 0xF3, 0x0B, 0x81, 0x67, 0x42, 0xA0, 0x44, 0x63, 0x48, 0x81, 0x30, 0xE7, 0xC9, 0x21, 0x1A, 0xBB, 0xA7, 0x4F, 0xA3, 0x82, 0xD0, 0xBF, 0x04, 0x35, 0x80, 0x74, 0x10, 0x2C, 0x9D, 0x77, 0xC1, 0xE4, 0x88, 0x74, 0xE0, 0xD8, 0x6B, 0xF2, 0x33, 0x61, 0xE3, 0xFF, 0x07, 0x02, 0x99, 0x5C, 0xA3, 0xDE, 0x1A, 0x25, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
+constexpr unsigned char data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x5C, 0x72, 0xA8, 0x66, 0x00, 0x00, 0x39, 0xA6, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0x7D, 0xC9, 0xB6, 0x25, 0xB7, 0x91, 0x58, 0x20, 0xEF, 0xAB, 0x6A, 0xC9, 0xBF, 0x21, 0xED, 0xDC, 0x55, 0x64, 0x55, 0x91, 0xAC, 0x62, 0x1F, 0x7F, 0x8C, 0xD5, 0x5B, 0xF7, 0x11, 0x8B, 0x83, 0xC8, 0xE3, 0x1F, 0xF0, 0x69, 0xCE, 0x54, 0x2F, 0xFC, 0x1B, 0xE2, 0x4A, 0xC3, 0xCE, 0x0B, 0xD9, 0x35, 0x93, 0x5D, 0x8F, 0xBD, 0xEC, 0xEE, 0x43, 0xB5, 0xB7, 0x32, 0xB9, 0x95, 0xEA, 0xDD, 0x9B, 0x30, 0x80, 0x04, 0x32, 0x31, 0x23, 0x80, 0x04, 0xEE, 0xF4, 0x80, 0x3A, 0x64, 0xBE, 0xBC, 0xC8, 0x0C, 0x20, 0x11, 0x81, 0x40, 0x4C, 0x08, 0x90, 0x9F, 0xFF, 0xF6, 0x17, 0x14, 0x08, 0x2C, 0x85, 0xB2, 0xFF, 0x7C, 0xF7, 0xD8, 0xDF, 0x53, 0x25, 0x17, 0x4E, 0xEA, 0xF7, 0xD0, 0xD5, 0x78, 0x8E, 0xFD, 0x40, 0xA9, 0xF8, 0x5D, 0x5C, 0xD8, 0xFD, 0x96, 0xFD, 0xBD, 0x61, 0x37, 0x4F, 0xEF, 0x7F, 0x0E, 0x17, 0xE4, 0x26, 0xEC, 0xE8, 0xAB, 0xE5, 0xB9, 0x33, 0x29, 0x84, 0xFD, 0xA3, 0x40, 0x8D, 0x7B, 0x90, 0xF7, 0x3B, 0xF6, 0xE7, 0x0D, 0xBA, 0x81, 0xD7, 0x9F, 0xBE, 0xC3, 0x7E, 0x1D, 0x60, 0xA0, 0xDA, 0xA7, 0x13, 0x98, 0x9F, 0xB3, 0xC7, 0x95, 0xE4, 0xD2, 0x05, 0x0A, 0x3F, 0xED, 0xE0, 0x29, 0x7C, 0xF3, 0x71, 0x10, 0xE3, 0xC1, 0x7E, 0xE0, 0xF7, 0x57, 0x03, 0xC0, 0xCD, 0x11, 0xE0, 0xD1, 0xFD, 0xCF, 0x18, 0xFE, 0x37, 0x30, 0xC2, 0x6E, 0x79, 0x5F, 0x1B, 0x06, 0x6A, 0x0E, 0xA8, 0xF5, 0xC3, 0x89, 0xD3, 0x07, 0xC7, 0xE7, 0xCC, 0x00, 0x30, 0x03, 0x1A, 0x1A, 0x88, 0x5A, 0x08, 0x8B, 0x0D, 0x34, 0x41, 0x3C, 0xAF, 0xFF, 0xBE, 0xCC, 0xF9, 0xA5, 0x42, 0x5C, 0x26, 0x2A, 0x66, 0xB8, 0x87, 0x71, 0xDC, 0xC1, 0xB7, 0x0F, 0xBE, 0x64, 0x03, 0x71, 0x03, 0x46, 0x72, 0xB5, 0x37, 0xE4, 0xEE, 0x83, 0x8E, 0x62, 0x43, 0xC4, 0xCB, 0x38, 0x10, 0xC6, 0x00, 0x08, 0xBC, 0xF6, 0xE8, 0x1D, 0x18, 0xD8, 0x04, 0x98, 0x9F, 0x57, 0x83, 0x46, 0xC3, 0x70, 0xB3, 0x3F, 0x20, 0x17, 0xFF, 0xA5, 0x1F, 0x0C, 0xEE, 0x47, 0x4F, 0x9F, 0x23, 0x19, 0x00, 0x59, 0x1E, 0xDC, 0x32, 0x06, 0xB0, 0xB9, 0xDA, 0xC2, 0xB3, 0xBF, 0xFB, 0x8A, 0xFD, 0x34, 0xB0, 0x5F, 0x47, 0xF9, 0xFD, 0x0B, 0xA3, 0xA4, 0x67, 0x34, 0xF7, 0xBD, 0xFD, 0x17, 0x0C, 0xE0, 0x77, 0xBF, 0xA0, 0xD1, 0x95, 0x36, 0xB5, 0x72, 0x63, 0x9F, 0x2F, 0x95, 0x0C, 0x72, 0xE1, 0x27, 0x24, 0x00, 0xF5, 0xE5, 0x3B, 0xB1, 0xEE, 0x51, 0x78, 0xFE, 0xE0, 0x0B, 0x76, 0xBD, 0x60, 0xF7, 0xAF, 0x5C, 0x02, 0x3A, 0x09, 0x2C, 0xE2, 0x1F, 0x24, 0xDA, 0xFF, 0x77, 0x84, 0x32, 0x06, 0x30, 0xC0, 0x6B, 0x4F, 0xDE, 0x81, 0x0D, 0x04, 0x18, 0x80, 0xE2, 0x9B, 0xF3, 0x4A, 0xDA, 0x10, 0xFF, 0x58, 0xC9, 0x22, 0xB3, 0x7D, 0x53, 0x02, 0xD0, 0x18, 0x80, 0x90, 0x80, 0x00, 0x9E, 0x32, 0xFC, 0x83, 0x60, 0x10, 0xBB, 0xA9, 0x59, 0x2F, 0xFF, 0xD3, 0x17, 0x90, 0x86, 0x9C, 0x3D, 0xF4, 0x3E, 0x49, 0x30, 0x4A, 0x6C, 0xBF, 0x3C, 0xAB, 0x42, 0x58, 0x02, 0x38, 0xE4, 0x35, 0xB6, 0x72, 0xE4, 0x4A, 0x18, 0xFA, 0x52, 0xA0, 0xE4, 0x1E, 0x98, 0x24, 0x00, 0xA0, 0x23, 0x3C, 0xBF, 0xFF, 0x85, 0x90, 0x00, 0x28, 0x5C, 0x05, 0x45, 0x67, 0x8C, 0x28, 0x45, 0xA9, 0x4B, 0x27, 0xFA, 0xC4, 0xA1, 0x11, 0x04, 0xCE, 0x8B, 0x57, 0x44, 0x12, 0x22, 0xB1, 0x7A, 0xFB, 0xB9, 0xA8, 0x56, 0x35, 0xD5, 0xEC, 0x08, 0x11, 0x13, 0xE0, 0x75, 0xC6, 0x00, 0x06, 0xC1, 0x00, 0x88, 0x97, 0x01, 0x10, 0x63, 0x22, 0x65, 0x4A, 0x7A, 0xB9, 0x78, 0x2C, 0x9D, 0x58, 0x59, 0xF4, 0x20, 0x19, 0x20, 0x97, 0x00, 0x76, 0x3B, 0x78, 0x72, 0x9F, 0x49, 0x80, 0xC3, 0xA0, 0x28, 0x42, 0x7E, 0xEF, 0x42, 0x2F, 0xC6, 0xEB, 0x3A, 0x19, 0x81, 0x35, 0x2E, 0xD4, 0xC4, 0x4F, 0xAC, 0x7E, 0x7E, 0x4C, 0x63, 0xB0, 0x06, 0xC3, 0x42, 0xD4, 0x43, 0xA2, 0x7D, 0xB0, 0xDF, 0x57, 0x68, 0x0B, 0x32, 0x00, 0x30, 0xC5, 0x67, 0xE3, 0x6F, 0xED, 0x65, 0x12, 0xA9, 0x4F, 0xBD, 0xEF, 0xD4, 0x13, 0x0F, 0xD7, 0x8E, 0xA9, 0x18, 0xD8, 0xF7, 0xED, 0xE6, 0x89, 0xCB, 0x00, 0x28, 0xE5, 0xFA, 0xE0, 0x0E, 0x9E, 0xBF, 0xFD, 0x15, 0xFB, 0x89, 0xCB, 0x02, 0x5B, 0x09, 0x96, 0x68, 0x00, 0xB4, 0xD1, 0xD3, 0xEF, 0xF5, 0x51, 0xF4, 0xD5, 0x0B, 0x6C, 0xE4, 0xD4, 0xA7, 0xEE, 0x11, 0xF0, 0x67, 0x04, 0x11, 0xBF, 0xFA, 0xA4, 0x13, 0x0E, 0xFF, 0x5A, 0x46, 0xF3, 0x7F, 0x33, 0x6E, 0xE0, 0xF6, 0xD3, 0x77, 0xE0, 0x82, 0x0E, 0xF2, 0x57, 0xEA, 0x4C, 0x7C, 0x63, 0xAE, 0xD3, 0x80, 0x0A, 0x40, 0x0A, 0xF1, 0x1F, 0xAA, 0x4F, 0x89, 0xF7, 0x39, 0xF4, 0x65, 0xCF, 0x60, 0x59, 0xB6, 0x6C, 0x9C, 0x2E, 0x18, 0x03, 0x78, 0xFA, 0xF6, 0x57, 0xF2, 0xE7, 0x51, 0x7E, 0xA3, 0xDB, 0x98, 0xA1, 0x10, 0x84, 0xF0, 0xE5, 0xCC, 0xC6, 0x08, 0x7E, 0x0C, 0x6E, 0x80, 0xB9, 0x8F, 0xE3, 0x9F, 0xCC, 0x13, 0x3B, 0xF2, 0xBE, 0xD3, 0xBE, 0x7C, 0x7D, 0x91, 0x00, 0x08, 0x68, 0x90, 0x2C, 0x85, 0xCF, 0x1E, 0x50, 0xD9, 0x40, 0x8C, 0x4A, 0xA8, 0xA5, 0x30, 0x2A, 0xF8, 0x46, 0xE7, 0x3D, 0xF5, 0x76, 0xFB, 0x06, 0x5B, 0x25, 0x01, 0xF8, 0xF6, 0x4A, 0x42, 0xFD, 0x4B, 0x34, 0x91, 0x08, 0x26, 0x13, 0x42, 0xB9, 0x41, 0xE8, 0x05, 0x5F, 0x01, 0xC8, 0x05, 0x6B, 0xE6, 0x4A, 0x8E, 0x17, 0x01, 0x47, 0x15, 0x4E, 0x18, 0x3B, 0xC3, 0x0B, 0x14, 0x35, 0x4C, 0x6F, 0xEE, 0x73, 0x38, 0x39, 0x39, 0x05, 0x3F, 0x29, 0x52, 0x3B, 0x9F, 0x40, 0x61, 0x64, 0xDF, 0xC9, 0xD7, 0xFD, 0xBB, 0x4F, 0x1E, 0x8A, 0x6F, 0xDD, 0x08, 0x85, 0xC8, 0x5D, 0x46, 0x96, 0xE9, 0x40, 0x24, 0xED, 0x78, 0xE8, 0x83, 0xD2, 0x08, 0xE3, 0xF6, 0xD0, 0x07, 0xB6, 0x7E, 0x5E, 0xA6, 0x74, 0xFA, 0xB0, 0x2D, 0x75, 0x1A, 0x41, 0x63, 0x6C, 0x4B, 0x4A, 0x05, 0xD8, 0x00, 0x5C, 0x5C, 0x8D, 0x82, 0x01, 0xF0, 0xEF, 0x1E, 0x08, 0x95, 0x4D, 0x13, 0x49, 0x2E, 0x54, 0x5E, 0x89, 0xC3, 0x53, 0x17, 0xB0, 0x54, 0x62, 0x37, 0x8E, 0x5F, 0x92, 0x59, 0x8F, 0x31, 0x71, 0x61, 0xE1, 0xDB, 0xFD, 0x73, 0x78, 0xE5, 0xCF, 0x7E, 0xFB, 0x0B, 0x9A, 0x34, 0xEE, 0xD1, 0xC4, 0x7D, 0x74, 0xC0, 0x11, 0xD6, 0x5E, 0x8A, 0xB0, 0x5C, 0x51, 0x44, 0xFF, 0x30, 0x2B, 0x07, 0xC8, 0x49, 0x3E, 0x0E, 0x8C, 0xAE, 0x28, 0xFC, 0xF1, 0xC1, 0x27, 0xF0, 0x53, 0xEE, 0x05, 0xE0, 0x0C, 0x40, 0x3C, 0x38, 0x68, 0x04, 0x45, 0x34, 0x86, 0xE7, 0xBB, 0x5F, 0x3A, 0xB9, 0x30, 0xD7, 0x89, 0x60, 0x17, 0x91, 0x59, 0x31, 0x14, 0x3A, 0x33, 0x17, 0xF5, 0xBC, 0xAD, 0x63, 0x4F, 0x56, 0x76, 0x1D, 0x9E, 0xF9, 0xBC, 0xAD, 0x52, 0x10, 0xA7, 0x7D, 0x22, 0xBB, 0x45, 0x1D, 0x95, 0x83, 0x18, 0xAB, 0xD1, 0xF4, 0xF2, 0xB8, 0xA3, 0x70, 0xFF, 0xE9, 0xFB, 0x42, 0x1D, 0xD8, 0xCC, 0x46, 0x7F, 0x8A, 0x62, 0x28, 0x41, 0xFC, 0xC6, 0xE8, 0xA5, 0x54, 0xB4, 0xC7, 0xDE, 0xDB, 0x9D, 0xD1, 0xE9, 0x66, 0x94, 0xA8, 0x15, 0x2B, 0x26, 0x11, 0x53, 0xE3, 0xC6, 0x0E, 0xE0, 0x7F, 0x3D, 0xF8, 0x47, 0xF8, 0x4F, 0x9B, 0x1B, 0xB0, 0xA3, 0x5B, 0xF9, 0xA0, 0xC9, 0x50, 0xE6, 0x71, 0xD5, 0x56, 0x04, 0x1F, 0x1E, 0x1C, 0xBC, 0x50, 0x73, 0xF5, 0x8F, 0xE3, 0x3F, 0x0C, 0xDF, 0xA6, 0x9F, 0x85, 0x4F, 0xEA, 0xF0, 0xF0, 0xF0, 0x75, 0x79, 0x46, 0x8C, 0x04, 0x97, 0x00, 0x96, 0x67, 0xE9, 0xAC, 0x0B, 0xAA, 0x46, 0xD4, 0x47, 0xF8, 0xC7, 0xDE, 0x7A, 0x3E, 0x6E, 0x90, 0x75, 0xE7, 0x72, 0x12, 0x7E, 0xD0, 0xC0, 0x1F, 0x85, 0x1F, 0x94, 0x28, 0xA9, 0xFC, 0x70, 0x3E, 0x20, 0x7C, 0x02, 0xC0, 0x0E, 0xBE, 0xB9, 0xFF, 0x95, 0x70, 0x03, 0x6E, 0xE9, 0x5F, 0x1D, 0x1A, 0xB2, 0x70, 0xE8, 0xB4, 0x60, 0x23, 0x61, 0x8D, 0x25, 0xCC, 0x4F, 0xCB, 0x75, 0x2D, 0x6D, 0x54, 0x23, 0xF1, 0x61, 0xC3, 0xD6, 0x7F, 0x36, 0x29, 0x6E, 0x3D, 0xFA, 0x07, 0xF6, 0xFD, 0x37, 0x4C, 0x31, 0xD2, 0x03, 0x7E, 0xAE, 0x27, 0x71, 0xFC, 0x1B, 0xE3, 0xEF, 0xC1, 0xAF, 0x79, 0xA5, 0x60, 0xF9, 0x69, 0x1C, 0xFA, 0x30, 0x88, 0xDE, 0xC6, 0xBF, 0xA6, 0xF1, 0xA4, 0xE8, 0xC3, 0x90, 0x1C, 0x38, 0xEE, 0x2F, 0xD8, 0x53, 0x4C, 0x05, 0x78, 0xCE, 0x24, 0xC0, 0xCD, 0x70, 0x03, 0x46, 0xAA, 0x79, 0x81, 0x24, 0x60, 0x1D, 0xBF, 0x76, 0x7F, 0x31, 0xF8, 0xA7, 0xDA, 0x0A, 0x9C, 0xC2, 0x5F, 0x09, 0xFE, 0x73, 0xE0, 0x87, 0xE0, 0x91, 0xDB, 0xCF, 0xDF, 0xA5, 0x44, 0x13, 0x26, 0xA8, 0x57, 0xFC, 0x8B, 0xFB, 0x95, 0x69, 0xE2, 0xDE, 0x16, 0x56, 0x68, 0x04, 0xFE, 0x3A, 0x78, 0x76, 0xBD, 0x4F, 0x1D, 0x9E, 0xBE, 0x81, 0xEB, 0xC0, 0xC3, 0xC8, 0x54, 0x80, 0x5B, 0x9F, 0x2C, 0x04, 0x90, 0x58, 0x91, 0x88, 0xF0, 0x1E, 0x50, 0x18, 0x56, 0x3B, 0xE3, 0xAA, 0x2F, 0x79, 0x68, 0xB6, 0x32, 0xBB, 0x01, 0xD9, 0xEF, 0x17, 0xEC, 0x4B, 0x6E, 0xBF, 0x7C, 0x8F, 0x89, 0xFF, 0x37, 0x2C, 0x07, 0x7F, 0xDC, 0x1B, 0x1B, 0xC6, 0x8F, 0x2B, 0x9C, 0xDA, 0xF4, 0x42, 0x21, 0x26, 0x70, 0xAE, 0xA5, 0xAF, 0xB0, 0x70, 0xBC, 0x78, 0x01, 0x26, 0xC1, 0x98, 0xAB, 0x00, 0x9B, 0xED, 0x08, 0xCF, 0x5F, 0xFB, 0x44, 0xB8, 0x41, 0x29, 0x97, 0x00, 0x24, 0x37, 0x09, 0xCD, 0x87, 0xFA, 0x6E, 0x80, 0x5C, 0x7C, 0xD7, 0x86, 0xCF, 0x7E, 0x79, 0x8D, 0x31, 0x00, 0x98, 0x3F, 0xD4, 0xC7, 0xCF, 0xF5, 0x01, 0x3C, 0x84, 0x5B, 0x20, 0xC7, 0xEC, 0x4C, 0xD0, 0xEE, 0x13, 0xEE, 0x06, 0xE3, 0xC1, 0x2F, 0x2F, 0x6E, 0x7F, 0xC2, 0xAA, 0x2F, 0xD8, 0x84, 0xB8, 0x3A, 0x01, 0x67, 0x6F, 0xBA, 0x83, 0x18, 0x4F, 0x92, 0x60, 0x00, 0x3C, 0x10, 0x8A, 0xDB, 0x00, 0x5E, 0x7E, 0x28, 0x1C, 0xA2, 0x93, 0x3D, 0x47, 0xB7, 0x67, 0x99, 0xAB, 0x4B, 0x98, 0x3E, 0x72, 0xF1, 0x53, 0xFB, 0xFD, 0xB2, 0xF6, 0x76, 0x17, 0x8C, 0x01, 0x32, 0x94, 0x3F, 0x7D, 0xED, 0x63, 0x11, 0x07, 0xC0, 0x3D, 0x42, 0xB3, 0xF1, 0xD3, 0x5A, 0xEF, 0xCF, 0x28, 0xF6, 0xC7, 0xA5, 0x8B, 0x89, 0x01, 0x40, 0xC4, 0xBC, 0x8A, 0x11, 0xBC, 0x73, 0x0C, 0x06, 0x58, 0x78, 0x78, 0xF8, 0x0B, 0xB7, 0x0F, 0xC1, 0x77, 0xE1, 0xF0, 0xB8, 0xAF, 0x81, 0x70, 0x06, 0xF0, 0x29, 0x8F, 0x83, 0x63, 0x3A, 0xE0, 0xD5, 0xF9, 0x45, 0x7A, 0x79, 0x56, 0x6B, 0xD0, 0x18, 0xC0, 0x05, 0xDD, 0xC0, 0xED, 0x4B, 0x26, 0x01, 0x90, 0x8B, 0xD9, 0xEA, 0x49, 0x28, 0x0D, 0x3A, 0x66, 0xD2, 0xAD, 0xAD, 0xA1, 0x97, 0x72, 0xFC, 0xA7, 0xEF, 0x75, 0xE5, 0x7A, 0xBA, 0xDD, 0xF2, 0x40, 0x28, 0x26, 0x01, 0x3E, 0x63, 0x0B, 0x80, 0x34, 0x8B, 0xC6, 0xED, 0x15, 0xE7, 0xCB, 0x00, 0xDE, 0xA3, 0xAE, 0x05, 0x27, 0x2F, 0x82, 0x27, 0xA5, 0x89, 0xA4, 0xF5, 0x9A, 0x58, 0x9B, 0xE9, 0xFE, 0xB8, 0x3D, 0x88, 0xB7, 0x41, 0x15, 0xDB, 0x60, 0x04, 0xF1, 0xED, 0xDF, 0x7E, 0x0A, 0x74, 0x20, 0x52, 0x04, 0x4C, 0x13, 0x40, 0x2D, 0x97, 0x75, 0x89, 0xD0, 0x86, 0x9D, 0x62, 0x98, 0x32, 0x12, 0xEE, 0xFD, 0xA7, 0x70, 0xE7, 0xF2, 0x57, 0x82, 0x01, 0x1A, 0x7A, 0xBB, 0x97, 0x65, 0xE8, 0xA3, 0x67, 0xB6, 0x94, 0x47, 0x01, 0xB5, 0xE9, 0x2B, 0x5D, 0x6F, 0x19, 0x2E, 0xA6, 0x05, 0x60, 0xC3, 0x24, 0x00, 0xC6, 0x05, 0x9F, 0x32, 0x15, 0x70, 0xFA, 0x5D, 0x97, 0x00, 0x02, 0x82, 0x23, 0x59, 0xEC, 0xBF, 0x18, 0x15, 0x69, 0x1F, 0x76, 0xCF, 0xD5, 0x4A, 0xE6, 0x6D, 0x43, 0x02, 0x38, 0xBC, 0x40, 0x1B, 0x8B, 0xF8, 0x5D, 0xDB, 0x12, 0xD1, 0x1C, 0x23, 0x93, 0x04, 0x40, 0xE1, 0xF9, 0xAD, 0x4F, 0x85, 0x0E, 0x38, 0x9E, 0xB9, 0x04, 0xE0, 0xD8, 0x00, 0xC8, 0xE4, 0xFA, 0xBB, 0x73, 0xF9, 0x81, 0x08, 0x04, 0x9A, 0x2D, 0xC7, 0x86, 0xC5, 0x6F, 0xBD, 0x96, 0xBB, 0xEF, 0x6F, 0x24, 0xE0, 0x0B, 0x07, 0x58, 0x42, 0x81, 0x95, 0x9F, 0x9F, 0xDB, 0x80, 0x6E, 0xF2, 0x48, 0x40, 0xA1, 0x02, 0x4E, 0x31, 0x21, 0x67, 0x2F, 0xEF, 0x07, 0x55, 0x00, 0xC7, 0xBF, 0xBE, 0x76, 0x53, 0x4C, 0xE5, 0x91, 0x5C, 0x02, 0xB5, 0xD0, 0x64, 0xA0, 0x1B, 0x7D, 0x6C, 0xB2, 0xA0, 0x44, 0x05, 0xBD, 0x50, 0xF8, 0x86, 0x31, 0x00, 0x32, 0x5C, 0x4C, 0x0C, 0x60, 0x0F, 0x1C, 0x19, 0xE3, 0xF9, 0x0C, 0x19, 0xB5, 0x74, 0x97, 0xB8, 0x1E, 0xB0, 0x53, 0x26, 0x01, 0x4C, 0x71, 0x00, 0xAF, 0x0B, 0x06, 0x30, 0x98, 0x73, 0xDE, 0x06, 0x5A, 0x00, 0xFF, 0xB8, 0xB8, 0x87, 0xBB, 0x17, 0x64, 0x3B, 0x30, 0x09, 0x80, 0xCD, 0x79, 0xA1, 0x02, 0x08, 0x7A, 0x37, 0x25, 0x00, 0x9F, 0x1C, 0x31, 0x7F, 0x3F, 0xC2, 0x61, 0x6F, 0xB8, 0x03, 0x15, 0x0C, 0x3B, 0xB2, 0x32, 0x62, 0xA8, 0xB1, 0xDF, 0xD7, 0xF1, 0x1F, 0xAC, 0x0F, 0xD0, 0x8F, 0x37, 0x14, 0x42, 0xD1, 0xCF, 0xC4, 0x00, 0x5C, 0xC4, 0x38, 0x01, 0x54, 0x95, 0xEB, 0x53, 0x84, 0x81, 0x87, 0xAF, 0xF9, 0xDD, 0xB5, 0xE7, 0x8D, 0x90, 0x4D, 0x7D, 0x33, 0x88, 0x64, 0x70, 0xA3, 0xAC, 0x7B, 0xCE, 0x08, 0x80, 0xC7, 0xC2, 0x9F, 0xB3, 0x0D, 0xC0, 0x37, 0x69, 0xF9, 0x66, 0xA0, 0x0D, 0x13, 0x03, 0xEE, 0x7C, 0xF7, 0x3E, 0x10, 0x7B, 0x2F, 0x40, 0x64, 0xDC, 0x49, 0x21, 0xFE, 0x6D, 0x82, 0x5F, 0xFB, 0x3E, 0x56, 0xD1, 0x98, 0xDD, 0xBE, 0xCA, 0x65, 0xA7, 0x6C, 0x00, 0x64, 0x92, 0x00, 0x9E, 0x78, 0x24, 0x80, 0xB5, 0xB6, 0xF7, 0x13, 0x36, 0x02, 0x9E, 0x8B, 0xA0, 0x1B, 0x12, 0x06, 0x41, 0xDB, 0x0B, 0x30, 0xDD, 0xBF, 0xE0, 0x2A, 0x00, 0x6C, 0x26, 0x2F, 0x00, 0x2C, 0x8F, 0x50, 0xEA, 0x9F, 0x44, 0x58, 0x5B, 0x36, 0xF6, 0xFE, 0x50, 0x65, 0x1C, 0x06, 0xE1, 0x06, 0xBD, 0xCB, 0x19, 0x00, 0xBD, 0x90, 0xF6, 0x31, 0xEA, 0x9D, 0xF0, 0x25, 0x12, 0xC6, 0x51, 0xD2, 0x88, 0x16, 0x58, 0x23, 0xF6, 0x02, 0xB0, 0xEF, 0xE7, 0x36, 0x80, 0x41, 0x30, 0x88, 0xD1, 0x0C, 0x81, 0x96, 0x1F, 0xAD, 0xE2, 0x87, 0x82, 0x9C, 0x95, 0xAE, 0xB3, 0x70, 0x1C, 0x27, 0x03, 0x88, 0xB0, 0xBC, 0x2A, 0x1F, 0x58, 0x71, 0xD7, 0x94, 0x77, 0xEA, 0xCF, 0xBA, 0x1E, 0x35, 0x25, 0x00, 0x58, 0x42, 0x5A, 0x47, 0x21, 0x42, 0x4D, 0x36, 0x80, 0x0D, 0x39, 0x7F, 0x09, 0xC0, 0xC6, 0xDB, 0xE4, 0x05, 0x18, 0xE0, 0xF5, 0xEF, 0x22, 0x36, 0x80, 0x88, 0x04, 0x90, 0xB3, 0x12, 0x3B, 0xEF, 0x65, 0x8E, 0xF3, 0x9A, 0x8D, 0xA5, 0xB6, 0x04, 0xA0, 0x82, 0x99, 0x84, 0x0A, 0xC4, 0x26, 0xFD, 0x33, 0x61, 0x03, 0x62, 0x12, 0xA1, 0xC7, 0x06, 0x80, 0xDD, 0xAB, 0x74, 0x06, 0x36, 0x00, 0x58, 0xB7, 0x4B, 0x6B, 0x5F, 0xBB, 0xBC, 0xB0, 0x0A, 0xBA, 0x16, 0x92, 0x6B, 0x06, 0xF3, 0x2B, 0x95, 0x01, 0xA6, 0x80, 0x1E, 0xCA, 0xDD, 0x40, 0x9F, 0x0A, 0x37, 0x58, 0xCA, 0x06, 0x10, 0x93, 0x00, 0x62, 0xDD, 0x8F, 0x8A, 0xA6, 0x91, 0x09, 0xE3, 0x7B, 0xDF, 0x71, 0x68, 0xDA, 0x3A, 0x66, 0xC6, 0x44, 0xE1, 0x91, 0x90, 0x7C, 0x65, 0xBB, 0x7B, 0xF9, 0x01, 0x7B, 0x6F, 0xA3, 0x02, 0xA0, 0xCD, 0xBD, 0x1E, 0xC1, 0x2D, 0xC5, 0x85, 0xF8, 0xC9, 0x9A, 0x59, 0xC4, 0x0C, 0xB9, 0x0E, 0x73, 0x7A, 0x84, 0x01, 0xC6, 0x63, 0x03, 0xD8, 0x50, 0xB8, 0xB9, 0x05, 0x78, 0xCC, 0x55, 0x00, 0x65, 0x03, 0x80, 0x78, 0x5C, 0x5E, 0x8E, 0x6E, 0x10, 0x8B, 0x78, 0x4F, 0x31, 0xD3, 0xD8, 0x9E, 0x37, 0x8A, 0xA0, 0x2F, 0x2C, 0x6C, 0xCD, 0x06, 0x40, 0xBC, 0xFB, 0xC0, 0xDD, 0x7D, 0xAD, 0xA7, 0x54, 0x4F, 0xAC, 0xF8, 0x55, 0xD3, 0xC8, 0xC9, 0xBD, 0x00, 0x7C, 0xDD, 0xE3, 0x56, 0xE0, 0x8B, 0x6B, 0x67, 0x03, 0x60, 0x2B, 0x1E, 0x9B, 0x5C, 0x1B, 0x26, 0x01, 0x4C, 0x36, 0x80, 0x8B, 0x25, 0x14, 0x6C, 0x9E, 0xFB, 0x81, 0xD8, 0xF4, 0x26, 0xF1, 0x39, 0x48, 0xFC, 0xDA, 0x13, 0x1F, 0x01, 0x6F, 0xD9, 0x53, 0xA1, 0xAC, 0x67, 0xD3, 0x65, 0x37, 0xB0, 0xAF, 0x66, 0x62, 0xE0, 0x93, 0xDB, 0x1F, 0x0B, 0xF6, 0xA7, 0x67, 0x04, 0xCA, 0x5D, 0xC7, 0xCE, 0x57, 0x02, 0x40, 0xAD, 0xB4, 0x50, 0xBE, 0x1F, 0x1C, 0xCD, 0xC9, 0x03, 0x08, 0x8F, 0xC2, 0x27, 0xD6, 0x73, 0xA6, 0x17, 0x60, 0xFA, 0x65, 0x84, 0x17, 0xB7, 0x3E, 0x93, 0xA9, 0x41, 0xB6, 0xD9, 0x0B, 0x57, 0xE9, 0xDE, 0xA7, 0x78, 0xBD, 0x1B, 0x85, 0x86, 0x25, 0x48, 0x92, 0x63, 0x64, 0x95, 0x46, 0xC0, 0xD7, 0x2F, 0xDF, 0x63, 0xF5, 0x17, 0x52, 0x02, 0xA0, 0xF1, 0x15, 0x59, 0xA9, 0x54, 0x25, 0x9B, 0xB6, 0x6A, 0xD0, 0x17, 0xF6, 0xFB, 0x7C, 0x0C, 0x61, 0xD6, 0x19, 0x65, 0x46, 0x28, 0x1E, 0xFC, 0x38, 0x2E, 0x2A, 0x00, 0xF5, 0x44, 0x02, 0x62, 0x55, 0xD0, 0x9C, 0x69, 0xB0, 0x96, 0x3E, 0xF2, 0x87, 0x79, 0x94, 0xF4, 0xED, 0xAF, 0xF7, 0x7B, 0x01, 0x5A, 0xDD, 0xAF, 0x5D, 0x11, 0x10, 0xED, 0x51, 0x8D, 0x54, 0x89, 0xC7, 0x08, 0x38, 0xDB, 0x00, 0xA4, 0x65, 0xE0, 0x19, 0xDF, 0x0B, 0xA0, 0x54, 0x80, 0x6B, 0x66, 0x03, 0x98, 0x24, 0x00, 0xCD, 0x06, 0x60, 0x0C, 0x60, 0x86, 0x0D, 0xA0, 0x79, 0x74, 0x4B, 0xC2, 0x2D, 0x1D, 0x49, 0xDE, 0xA7, 0x6C, 0x00, 0xFA, 0x76, 0x70, 0x22, 0xBD, 0x00, 0x17, 0x3C, 0x0E, 0xE0, 0xD6, 0xC7, 0x8C, 0x01, 0x0C, 0xD7, 0xDC, 0x0B, 0xD0, 0x2A, 0x95, 0x51, 0x6B, 0x43, 0x3F, 0xFA, 0x25, 0xD7, 0x06, 0x30, 0xCA, 0x38, 0x00, 0xE1, 0x05, 0x20, 0x17, 0x86, 0x17, 0x20, 0x07, 0x5A, 0x68, 0x15, 0xCE, 0xE1, 0x87, 0x6B, 0xE7, 0x53, 0x89, 0x91, 0x8E, 0x1B, 0xC1, 0x2E, 0xD8, 0xF5, 0x35, 0x19, 0x08, 0x44, 0x1C, 0x1B, 0x40, 0x06, 0xFC, 0xA3, 0xC4, 0xBF, 0xBE, 0x20, 0xB8, 0x36, 0x80, 0x29, 0x23, 0xD0, 0x28, 0x6C, 0x40, 0xB1, 0x38, 0x00, 0x6F, 0x20, 0x39, 0xC2, 0xFF, 0x8E, 0xD1, 0xD5, 0x6B, 0x25, 0x54, 0x5A, 0xF3, 0x9C, 0xA5, 0x02, 0xA4, 0x74, 0xAB, 0x43, 0x5F, 0xD3, 0xFD, 0x5B, 0xF6, 0x65, 0x7B, 0x24, 0x00, 0x2B, 0x29, 0xE8, 0xF5, 0x8D, 0x03, 0x20, 0x42, 0x04, 0x9E, 0xE2, 0x00, 0x3E, 0x90, 0x71, 0x00, 0x11, 0x09, 0xC0, 0x93, 0x9A, 0xEA, 0x28, 0xAF, 0xA1, 0x94, 0x19, 0x1E, 0x15, 0x60, 0xA7, 0x24, 0x00, 0x86, 0x7F, 0x91, 0x12, 0xD4, 0x23, 0x01, 0x74, 0x1B, 0xC0, 0xBE, 0x8D, 0x3C, 0x55, 0xE1, 0x13, 0x2B, 0x91, 0x47, 0x40, 0x02, 0xB8, 0xFD, 0x59, 0x34, 0x0E, 0xC0, 0x3B, 0x91, 0x7C, 0x89, 0x89, 0x5A, 0x88, 0xC4, 0x6B, 0x59, 0x7D, 0x6C, 0x65, 0x94, 0x71, 0x00, 0x8B, 0x11, 0x10, 0x96, 0x8C, 0x40, 0x8E, 0x04, 0xA0, 0x6F, 0xA4, 0xDD, 0x87, 0x0A, 0x98, 0x32, 0x02, 0xE6, 0xB6, 0xE7, 0xD9, 0x0C, 0x26, 0xE3, 0x00, 0xB8, 0x0D, 0x60, 0x02, 0xAF, 0xC7, 0x01, 0x04, 0x54, 0x8E, 0xDC, 0x25, 0xB6, 0xD6, 0x7D, 0x90, 0x7E, 0xAC, 0x07, 0xE7, 0xA4, 0x27, 0x78, 0xF8, 0xF3, 0x76, 0x60, 0x27, 0xCD, 0x52, 0x34, 0x9B, 0x65, 0x20, 0xBB, 0x21, 0xF6, 0x8B, 0x8A, 0xE1, 0xDB, 0x29, 0x74, 0xC2, 0x23, 0x44, 0xE7, 0xFF, 0xFB, 0x6D, 0x00, 0x62, 0x2F, 0x00, 0x9D, 0x76, 0x83, 0x5D, 0x30, 0x15, 0xE0, 0x9C, 0x24, 0x00, 0xCC, 0xE6, 0x5B, 0x6E, 0x03, 0x18, 0xE8, 0x00, 0xF7, 0x84, 0x04, 0x70, 0x01, 0xA0, 0xA5, 0xC5, 0xD6, 0x25, 0x00, 0x7B, 0xF3, 0x4B, 0x5E, 0x8B, 0xAD, 0x8D, 0x4A, 0xE9, 0x7B, 0xD3, 0x06, 0x40, 0x66, 0xB2, 0x53, 0x59, 0x81, 0x9F, 0x14, 0xD8, 0x00, 0xCE, 0x49, 0x22, 0x30, 0xDD, 0x80, 0x41, 0xA3, 0x4B, 0x65, 0x04, 0xB5, 0x86, 0x1F, 0x31, 0x02, 0xAA, 0xF6, 0x77, 0x42, 0xD5, 0x1D, 0x85, 0x0D, 0x60, 0x33, 0x48, 0x06, 0x80, 0x9C, 0x5C, 0x21, 0xDD, 0x2F, 0x76, 0x0F, 0x10, 0xCF, 0x9A, 0x95, 0xAA, 0xCF, 0xC9, 0x97, 0x8A, 0xB5, 0x01, 0x70, 0xD3, 0xDF, 0xB4, 0x17, 0xE0, 0xC2, 0x52, 0x01, 0x68, 0xD0, 0xA8, 0x46, 0xDA, 0x58, 0xF9, 0xDA, 0x32, 0x00, 0x6F, 0x1C, 0x80, 0x4C, 0x08, 0xA2, 0xDB, 0x00, 0xA0, 0x3C, 0xAA, 0x33, 0x85, 0xCF, 0x9A, 0xF8, 0x0F, 0xBF, 0x3F, 0x59, 0xFC, 0xB3, 0xDE, 0x37, 0xE3, 0x00, 0x12, 0xD7, 0x54, 0x52, 0x34, 0x6F, 0xBD, 0xBE, 0xA2, 0x90, 0xB6, 0x57, 0x03, 0xFF, 0xBE, 0xFD, 0xE0, 0xE0, 0xC4, 0x01, 0x3C, 0xCB, 0xB0, 0x01, 0x1C, 0x2F, 0x99, 0xE3, 0x25, 0xEF, 0xD9, 0x06, 0xA0, 0xC5, 0x01, 0x0C, 0x42, 0x02, 0x70, 0xE3, 0x00, 0x48, 0x2A, 0x00, 0xC7, 0x11, 0xD1, 0x4B, 0xE8, 0x23, 0x54, 0xEF, 0xA1, 0x9B, 0x5C, 0xF8, 0x11, 0x7A, 0x9C, 0x25, 0x00, 0x69, 0x03, 0xA0, 0x08, 0x1B, 0xC0, 0xA9, 0xE2, 0x3F, 0x76, 0x3F, 0xE5, 0x03, 0xF0, 0x66, 0xE3, 0xCD, 0x71, 0xC3, 0x64, 0xD6, 0x67, 0xEB, 0x3C, 0x25, 0xBB, 0x13, 0x3D, 0x71, 0x58, 0x92, 0x31, 0x50, 0x69, 0x03, 0xE0, 0x19, 0x81, 0x9E, 0xDF, 0x76, 0xF7, 0x02, 0xE4, 0x18, 0xA3, 0xB1, 0xD6, 0xDF, 0x50, 0xDE, 0xBA, 0xD0, 0x6A, 0x61, 0xD7, 0x61, 0xDB, 0x47, 0x5B, 0xC7, 0x79, 0x24, 0x20, 0x3F, 0x17, 0xE0, 0xF2, 0x7D, 0xE1, 0x05, 0x31, 0x1B, 0xA3, 0x49, 0x09, 0xA8, 0xAE, 0xCD, 0x63, 0x25, 0x7D, 0x61, 0x3B, 0xA0, 0x2F, 0x00, 0xC2, 0x0B, 0x30, 0x45, 0x82, 0xCE, 0x36, 0x00, 0x58, 0x93, 0x95, 0xC2, 0xEF, 0xFD, 0xC1, 0xBE, 0x8F, 0xDD, 0x33, 0x82, 0x8D, 0x2B, 0xC0, 0x7A, 0x1D, 0x34, 0x06, 0x70, 0xC4, 0xD6, 0xDD, 0x2A, 0x07, 0x8D, 0x2C, 0x2B, 0x00, 0x95, 0xF4, 0xC4, 0x33, 0x02, 0x19, 0x91, 0x80, 0x29, 0xCD, 0x76, 0xA5, 0x80, 0xB4, 0x0F, 0x01, 0x88, 0xC4, 0x56, 0x6A, 0xC7, 0x06, 0x40, 0xE0, 0x8D, 0x7F, 0xF9, 0x90, 0x49, 0xBF, 0x83, 0xD8, 0x17, 0x61, 0x1D, 0x9D, 0x10, 0xF6, 0x67, 0x1E, 0xE3, 0x35, 0xA3, 0xBF, 0xD3, 0x02, 0x40, 0x78, 0x26, 0x44, 0x78, 0x7C, 0xFB, 0x1F, 0xC5, 0x76, 0x68, 0xAF, 0x04, 0x60, 0xC7, 0x97, 0x1C, 0x08, 0xAF, 0x2D, 0xE9, 0x0C, 0xC7, 0x00, 0x5A, 0x59, 0xAB, 0x6B, 0x3D, 0x9F, 0xD1, 0x1F, 0x95, 0xA9, 0x76, 0x64, 0xFF, 0x06, 0xAA, 0x18, 0xC0, 0x8D, 0xA8, 0x04, 0xE0, 0xAC, 0xB2, 0x9E, 0x54, 0xF4, 0x34, 0xF3, 0xF9, 0x5C, 0x51, 0xC3, 0x5E, 0x30, 0x7D, 0x67, 0xE0, 0x61, 0x6C, 0x00, 0x8B, 0x93, 0x64, 0x02, 0xF2, 0xC6, 0xE5, 0xAF, 0xD8, 0xB7, 0x4F, 0x7B, 0x01, 0xEC, 0xE4, 0x39, 0x00, 0xEE, 0xF9, 0x08, 0xA4, 0xC5, 0x49, 0x4F, 0x35, 0xBC, 0x07, 0x81, 0xA5, 0x4E, 0xE5, 0x36, 0x34, 0x26, 0xB4, 0xCC, 0x07, 0xC0, 0xD3, 0x82, 0x3F, 0xBE, 0xFD, 0xB1, 0x38, 0x18, 0x86, 0x24, 0x24, 0x00, 0x1F, 0x3E, 0x8B, 0x25, 0x9E, 0x15, 0xF8, 0x8F, 0xD1, 0x53, 0xAE, 0x4D, 0x42, 0xD4, 0xDF, 0x56, 0x5E, 0x00, 0x7B, 0x03, 0xC8, 0x7C, 0x22, 0x49, 0x24, 0x39, 0x37, 0x59, 0x59, 0x1F, 0x13, 0x4E, 0x74, 0x0A, 0x2C, 0xA2, 0xA8, 0x80, 0x70, 0xAE, 0x08, 0x80, 0x5D, 0x7F, 0x32, 0x6C, 0xE0, 0x11, 0x5B, 0x01, 0x42, 0x12, 0xC0, 0x69, 0x16, 0xEF, 0x06, 0x56, 0x6D, 0xC4, 0x54, 0x80, 0x28, 0x15, 0xBB, 0x20, 0xDF, 0xF8, 0xEE, 0x43, 0x31, 0x16, 0x03, 0x78, 0x56, 0x3F, 0x50, 0x29, 0xC2, 0x88, 0xB1, 0x9F, 0x72, 0xFD, 0x0A, 0x80, 0xA0, 0x0F, 0x0C, 0xFD, 0x05, 0xE9, 0x27, 0xA0, 0x06, 0x6A, 0xED, 0x6D, 0xD9, 0xEF, 0x3F, 0x1D, 0x2E, 0xE0, 0x7F, 0xDF, 0xFE, 0x1F, 0x62, 0x57, 0xA4, 0x88, 0x03, 0xB8, 0x86, 0xE5, 0xA0, 0x29, 0xC1, 0x0E, 0xE3, 0x22, 0xE3, 0x36, 0x00, 0xCA, 0x26, 0x3C, 0x57, 0x01, 0x46, 0x78, 0xFE, 0x9F, 0x65, 0x4A, 0x30, 0xB2, 0xCD, 0xCA, 0x6C, 0xD8, 0xDA, 0x85, 0xD7, 0xB4, 0xD0, 0x29, 0x16, 0xFE, 0x62, 0xE4, 0x91, 0x80, 0xDC, 0x06, 0x70, 0x43, 0xF3, 0x98, 0x9C, 0x3B, 0xFE, 0xA5, 0x0D, 0x80, 0xD1, 0x00, 0xE1, 0x47, 0xC3, 0xFD, 0xED, 0x67, 0xB3, 0x17, 0x40, 0x3F, 0x88, 0xA3, 0x15, 0xFE, 0x72, 0x84, 0x1E, 0x48, 0x49, 0x92, 0x88, 0x43, 0x91, 0x92, 0x2C, 0xF3, 0xE7, 0xBF, 0xFB, 0x7B, 0x1A, 0xCC, 0x6A, 0x90, 0xB3, 0x23, 0x86, 0x04, 0x76, 0x48, 0x60, 0x2C, 0x62, 0x29, 0xF8, 0xF6, 0x50, 0xA5, 0x0E, 0x02, 0x35, 0x14, 0x3E, 0xF3, 0x67, 0x3A, 0xBB, 0x01, 0xA9, 0x48, 0x8A, 0xF9, 0xF4, 0xFE, 0xE7, 0x70, 0x73, 0xF8, 0x09, 0x5C, 0x8D, 0x7F, 0x95, 0x0B, 0x0F, 0x91, 0x07, 0x88, 0x9C, 0x57, 0xFC, 0x97, 0x23, 0xFA, 0x6D, 0x18, 0x07, 0x60, 0x5C, 0xF0, 0xEE, 0xD3, 0x77, 0x27, 0x23, 0xE0, 0x38, 0xBA, 0x89, 0xE0, 0xA9, 0x2B, 0x76, 0xFA, 0x4E, 0x5A, 0xF6, 0x4B, 0x59, 0x91, 0x68, 0x29, 0xCC, 0x16, 0xDF, 0xA4, 0x87, 0xC1, 0xA3, 0x98, 0x7B, 0xE8, 0x83, 0x82, 0x7E, 0x2A, 0x92, 0x3A, 0x31, 0x87, 0xE1, 0x7F, 0xC3, 0xB3, 0x02, 0x8F, 0xF0, 0xF8, 0xAD, 0x2F, 0xE0, 0x82, 0x49, 0x82, 0xBB, 0x71, 0x3B, 0xE3, 0x9F, 0xD2, 0xEB, 0xB3, 0x26, 0x92, 0x9F, 0xF1, 0xE3, 0xC1, 0x43, 0x13, 0x8E, 0x06, 0x62, 0x84, 0x7C, 0x13, 0xD2, 0xA1, 0x34, 0xCF, 0x66, 0x75, 0xC8, 0x81, 0x9F, 0x62, 0x24, 0x88, 0xF6, 0x7D, 0x04, 0x48, 0xA7, 0x75, 0x9E, 0xAF, 0x80, 0xC3, 0x6E, 0x84, 0x47, 0x0F, 0x3E, 0x81, 0x9B, 0xE4, 0xA7, 0xD3, 0xD1, 0x60, 0x34, 0x3D, 0x81, 0x68, 0xCD, 0x55, 0x20, 0x93, 0xC7, 0x60, 0x9C, 0x25, 0x51, 0xDD, 0x51, 0x07, 0x32, 0x30, 0xB1, 0x77, 0xDC, 0xC1, 0x9B, 0x4F, 0xDE, 0x17, 0x39, 0x11, 0xF9, 0xCE, 0x38, 0x1A, 0xCA, 0xAB, 0x06, 0x2B, 0xF1, 0x93, 0x81, 0xFF, 0xEC, 0x7A, 0x8C, 0x9B, 0xC2, 0x3A, 0x26, 0x8B, 0x5F, 0xAF, 0x06, 0x0A, 0x7F, 0xC3, 0xE6, 0xFC, 0xFF, 0x79, 0xFB, 0x13, 0xC6, 0x00, 0xF8, 0xC1, 0x30, 0x63, 0x30, 0x21, 0xC8, 0xF9, 0x33, 0x80, 0xC6, 0x36, 0xB8, 0x43, 0x9C, 0x0E, 0x1E, 0xDC, 0x2E, 0x2B, 0x57, 0x80, 0xAD, 0xD0, 0x94, 0x29, 0x3C, 0xBB, 0xFF, 0x85, 0x38, 0x1A, 0x6B, 0x07, 0xAF, 0x40, 0xDF, 0x2F, 0x1E, 0xF7, 0x4B, 0x83, 0x27, 0xD1, 0x04, 0x84, 0x77, 0xA5, 0x61, 0xEB, 0x83, 0x89, 0x28, 0x6C, 0xF3, 0x6D, 0xA0, 0x7D, 0x2B, 0x0D, 0xAA, 0xB9, 0x18, 0x6B, 0x07, 0xBB, 0x90, 0x49, 0xFF, 0x26, 0x7C, 0x3B, 0xF0, 0xD3, 0x87, 0x53, 0x52, 0x50, 0x0A, 0x19, 0x2C, 0xAE, 0x2D, 0xFE, 0x5B, 0xDA, 0x8C, 0x55, 0xB9, 0xE2, 0xE7, 0x02, 0x30, 0x09, 0xE8, 0xF1, 0xDB, 0x1C, 0xFF, 0x4C, 0x05, 0x1C, 0xB5, 0x93, 0x81, 0xE6, 0xF1, 0x5A, 0x24, 0xC6, 0x85, 0x99, 0x4C, 0x0F, 0x10, 0x5D, 0x4A, 0x0C, 0x32, 0xAD, 0x5C, 0xFA, 0x40, 0x86, 0x20, 0xA3, 0x57, 0x08, 0xB3, 0x7F, 0x53, 0xEE, 0x43, 0x6A, 0x90, 0xD5, 0x74, 0x36, 0xA0, 0xEF, 0xA0, 0x5F, 0xEA, 0x09, 0xAB, 0xF7, 0x24, 0x69, 0x41, 0xC5, 0xC9, 0x5B, 0x0F, 0x05, 0xE1, 0x63, 0x90, 0xE7, 0x3B, 0x9F, 0xD3, 0xFA, 0x66, 0xEB, 0x18, 0x38, 0x23, 0xC4, 0x55, 0xC1, 0x9D, 0x4C, 0x65, 0x23, 0x53, 0x01, 0xBE, 0x14, 0x47, 0x63, 0x2D, 0x5E, 0x00, 0x73, 0xAD, 0x4F, 0x33, 0xBD, 0xDC, 0xE3, 0xAE, 0x72, 0x83, 0x35, 0x72, 0xDF, 0x27, 0xDA, 0x99, 0x7D, 0xD4, 0x48, 0x8D, 0x6D, 0x2C, 0x89, 0x6C, 0x02, 0x8C, 0x6C, 0xD5, 0xBF, 0xF7, 0xE4, 0xA1, 0x38, 0x1B, 0x51, 0xF9, 0xC1, 0x53, 0x84, 0x46, 0x52, 0x0B, 0x6F, 0xF8, 0xFC, 0xD4, 0x60, 0x3D, 0x3A, 0xE2, 0x2E, 0x65, 0xFD, 0xF6, 0x1C, 0x65, 0xEF, 0x78, 0x4F, 0x14, 0xFE, 0xB9, 0x0D, 0x64, 0xBB, 0x83, 0x47, 0x6F, 0x7F, 0x05, 0x1B, 0x11, 0x0A, 0x3C, 0x2E, 0x46, 0x52, 0xB2, 0x9C, 0x8F, 0x90, 0x8D, 0x8F, 0xC2, 0x6D, 0x0B, 0xE8, 0x7B, 0x07, 0x7E, 0x29, 0x7D, 0x18, 0x36, 0x80, 0x54, 0xDA, 0x56, 0x48, 0xA4, 0x69, 0x45, 0xA4, 0x7D, 0x6D, 0x0A, 0x3F, 0xE3, 0x5E, 0x72, 0x5A, 0x71, 0x3E, 0x1C, 0xBD, 0x82, 0x6F, 0x1F, 0x7C, 0xC5, 0x44, 0xE0, 0x0D, 0xD0, 0x71, 0x5B, 0x68, 0xBA, 0x41, 0x1F, 0x85, 0xDA, 0xA0, 0x3E, 0xD6, 0x1F, 0xFB, 0x0B, 0xCC, 0x33, 0xF2, 0x54, 0x1C, 0xC0, 0x1D, 0x26, 0x01, 0x70, 0x2F, 0x88, 0x3C, 0x2D, 0x25, 0x9E, 0x97, 0x1C, 0x8D, 0x9F, 0x86, 0xF8, 0x0B, 0xF5, 0x27, 0x92, 0x9D, 0x53, 0x31, 0x1C, 0xFD, 0xFD, 0x1D, 0x53, 0x81, 0xC8, 0xEE, 0x0A, 0x9E, 0x33, 0xFC, 0x53, 0xB1, 0xA2, 0x8F, 0x08, 0x53, 0x5C, 0x0D, 0xFC, 0xB4, 0xC6, 0x7F, 0xDE, 0x3D, 0x93, 0x00, 0xFE, 0x9E, 0x7A, 0xE9, 0xD8, 0x95, 0x7A, 0xE6, 0x7A, 0xE3, 0xD4, 0xDC, 0xDC, 0x7B, 0x0F, 0x32, 0xA3, 0xF0, 0x0B, 0xDA, 0x8F, 0xCF, 0xCB, 0x25, 0x45, 0xF8, 0x8E, 0xEE, 0xE0, 0xC5, 0x5B, 0x5F, 0xB2, 0x99, 0xC0, 0x23, 0xE1, 0xB6, 0x0D, 0x6D, 0xBD, 0xAD, 0x6C, 0xC5, 0x29, 0x6B, 0x85, 0x1B, 0xC3, 0x3F, 0x1F, 0x80, 0x2B, 0x23, 0x01, 0xB9, 0x04, 0xC0, 0xFD, 0xE0, 0x9C, 0x19, 0x28, 0x97, 0x5F, 0xD6, 0xF8, 0x7B, 0xEA, 0xED, 0x06, 0x53, 0xF8, 0xCF, 0x0D, 0x92, 0x4F, 0xE1, 0xDB, 0x4B, 0x1F, 0x00, 0xF3, 0xF1, 0xD8, 0xFC, 0x3B, 0x29, 0xE3, 0x79, 0xC3, 0xD5, 0x15, 0x3C, 0x7D, 0xFB, 0x9F, 0x44, 0x8A, 0x74, 0x22, 0xDC, 0x80, 0xC4, 0xBB, 0xAA, 0xD6, 0xDF, 0x0E, 0x74, 0xE8, 0x04, 0x0A, 0x1A, 0x5D, 0xFC, 0xEC, 0xB7, 0xFF, 0x95, 0xF2, 0x0D, 0x04, 0x53, 0x24, 0x98, 0x76, 0x48, 0x28, 0xA1, 0x9A, 0xCE, 0x40, 0x8C, 0x7A, 0xA2, 0xEE, 0x65, 0x3D, 0xF1, 0x1D, 0x22, 0x2A, 0x59, 0xAE, 0xAA, 0x57, 0x35, 0x6A, 0x60, 0x67, 0x97, 0x8B, 0x17, 0xBE, 0x12, 0xDD, 0x89, 0x21, 0x8A, 0x81, 0xE7, 0xFD, 0xB9, 0x7D, 0xA9, 0xA3, 0x50, 0x62, 0x1E, 0x62, 0x49, 0xAD, 0x10, 0x30, 0xCA, 0xB4, 0x7D, 0x4E, 0xF0, 0x5B, 0xD1, 0xC0, 0x16, 0xFE, 0xF9, 0xED, 0xFF, 0xC9, 0x96, 0x43, 0x8E, 0xFC, 0xDD, 0x99, 0xD9, 0xFC, 0xCD, 0x15, 0x64, 0x19, 0x6E, 0xA9, 0xC3, 0x72, 0x57, 0x28, 0x5B, 0xFB, 0xDF, 0x7A, 0xF4, 0x70, 0xD6, 0x79, 0x17, 0x73, 0x87, 0x1C, 0x3F, 0xAA, 0x9D, 0xA5, 0x34, 0x8B, 0xDF, 0x01, 0xFC, 0xE8, 0xCC, 0xD5, 0xAA, 0x27, 0x16, 0x7E, 0x67, 0xFD, 0x53, 0xEC, 0xC3, 0x0F, 0xD7, 0x43, 0x80, 0xBE, 0x14, 0xBD, 0xA8, 0x7A, 0xA5, 0x93, 0xDB, 0xF5, 0x74, 0x86, 0xBF, 0x70, 0x91, 0x91, 0x8C, 0xF2, 0x94, 0x67, 0x02, 0x4C, 0xF1, 0x81, 0x27, 0x0F, 0x7E, 0x2D, 0x6D, 0x43, 0x5B, 0x6D, 0xEC, 0x5A, 0x67, 0x04, 0xD8, 0x07, 0x03, 0x88, 0x39, 0x05, 0x35, 0xBA, 0xF8, 0xF9, 0xEF, 0x7E, 0x21, 0x78, 0x9F, 0x1A, 0x78, 0x95, 0x1D, 0x76, 0xB9, 0x27, 0xC6, 0xC4, 0x55, 0xF5, 0xA3, 0x54, 0xE2, 0x2E, 0xE4, 0x54, 0xA3, 0x12, 0xF5, 0x03, 0xC0, 0x1C, 0x6B, 0xCF, 0x1F, 0xE1, 0xA9, 0x26, 0x46, 0xFD, 0x7D, 0xD9, 0xF6, 0x18, 0x81, 0x3F, 0x0A, 0x18, 0x11, 0xF8, 0x5A, 0xFD, 0x46, 0xD5, 0x93, 0x59, 0xB5, 0x05, 0x4A, 0xD5, 0xF3, 0x13, 0x7C, 0xB0, 0xEC, 0x00, 0x92, 0xD6, 0xE1, 0x06, 0x23, 0x86, 0xC7, 0xF7, 0xBE, 0xE0, 0x06, 0xF1, 0x89, 0x6C, 0x89, 0x79, 0x1E, 0xEE, 0xA9, 0x66, 0xC1, 0xF7, 0x9A, 0xC1, 0x2D, 0x57, 0x2D, 0x1F, 0xB5, 0x71, 0x37, 0xC2, 0xBD, 0xE7, 0x1F, 0x89, 0xF1, 0xD8, 0x0C, 0x92, 0x75, 0x53, 0xB5, 0x8B, 0x4E, 0xDF, 0x47, 0x47, 0x1C, 0x9B, 0x88, 0x3D, 0xFE, 0xFA, 0x5E, 0x34, 0xAA, 0x9D, 0x31, 0xA0, 0xF0, 0xAF, 0x0E, 0x6F, 0x31, 0xF1, 0xAF, 0x9E, 0x57, 0xAE, 0x57, 0x97, 0xFE, 0x66, 0xFC, 0x2A, 0xE7, 0x45, 0x90, 0xFE, 0x64, 0x3D, 0xD1, 0xDE, 0xA7, 0xD3, 0xF1, 0x67, 0xC6, 0xBE, 0x40, 0x32, 0xF5, 0x93, 0xDF, 0xFF, 0x84, 0x01, 0xFB, 0xE3, 0xDD, 0xCF, 0x99, 0x0A, 0xA8, 0x2F, 0x74, 0x95, 0xC6, 0xBB, 0x38, 0x91, 0xF9, 0x7E, 0x9F, 0x27, 0xFF, 0xF7, 0xE5, 0x6F, 0xD8, 0x58, 0x31, 0x11, 0x70, 0x90, 0xC1, 0x31, 0x20, 0x73, 0xEA, 0x13, 0xB1, 0x5D, 0x66, 0x5E, 0x09, 0x08, 0xAB, 0x1F, 0xE9, 0x62, 0x49, 0xE7, 0x93, 0x86, 0xD1, 0x8F, 0x18, 0xF0, 0x91, 0x3F, 0x3F, 0x8C, 0x3C, 0xCB, 0xC4, 0xFC, 0xBC, 0x80, 0x37, 0x2E, 0x34, 0xC7, 0x4F, 0x60, 0x1E, 0x47, 0x35, 0x41, 0x6D, 0xF8, 0xB2, 0x3E, 0x02, 0x9F, 0x0C, 0xDC, 0x4D, 0xE5, 0xC2, 0x57, 0x13, 0x5E, 0x7F, 0x9E, 0xC3, 0xE7, 0x9C, 0x7E, 0x31, 0x7D, 0xC9, 0x15, 0x4F, 0x9E, 0x05, 0x30, 0x91, 0xDD, 0x4E, 0x5C, 0x79, 0x48, 0x30, 0xEF, 0xB7, 0x93, 0x3C, 0xC4, 0x6B, 0xCD, 0xD1, 0xA4, 0x1C, 0x42, 0xB4, 0x30, 0x53, 0xBA, 0xEC, 0x39, 0xF7, 0xD6, 0xAB, 0x71, 0xD0, 0x4E, 0x27, 0x28, 0xAC, 0xC7, 0xB5, 0x6F, 0x3E, 0xBF, 0x58, 0x8F, 0xC6, 0x65, 0x75, 0x27, 0x8B, 0x54, 0x36, 0xCA, 0x89, 0xC6, 0x57, 0xCB, 0x89, 0x01, 0x13, 0x71, 0x6E, 0xA2, 0xC0, 0xBB, 0x5C, 0x99, 0x07, 0xA1, 0x32, 0x4D, 0x3B, 0x28, 0xD5, 0x44, 0xDE, 0xD1, 0x32, 0xFC, 0x8F, 0x9A, 0x52, 0xAE, 0xF0, 0x6D, 0xD2, 0x07, 0xCC, 0x67, 0x37, 0x2C, 0xF8, 0xA7, 0x73, 0xBD, 0x43, 0x1F, 0x93, 0x4B, 0x43, 0xB6, 0x3F, 0xD1, 0x09, 0x67, 0x68, 0xDB, 0x71, 0x3A, 0xFF, 0x11, 0xE4, 0xF7, 0x6C, 0xA9, 0x4A, 0x8F, 0xC9, 0x24, 0x40, 0x21, 0xFF, 0xC8, 0x63, 0xE2, 0xE6, 0xEF, 0x0C, 0xED, 0x44, 0xB4, 0xF1, 0xBF, 0x78, 0x0A, 0x66, 0xD9, 0x14, 0x59, 0x4F, 0xB5, 0xFB, 0x30, 0xFE, 0xEB, 0xC0, 0xF7, 0xD1, 0x83, 0xD3, 0xFE, 0x7F, 0xBC, 0xFC, 0x9A, 0xEA, 0x09, 0x21, 0x35, 0x77, 0xF9, 0xF4, 0x20, 0x35, 0x5D, 0xAE, 0x2A, 0xBD, 0x92, 0xFE, 0x3C, 0xB5, 0xF4, 0x31, 0xDD, 0xF2, 0x6E, 0x44, 0x74, 0x82, 0xF5, 0x7C, 0x01, 0x7C, 0x12, 0xB2, 0xF4, 0x53, 0xD7, 0xC7, 0x4E, 0x00, 0x9C, 0xFC, 0x21, 0x4B, 0x84, 0xB1, 0x4C, 0x10, 0x41, 0xA4, 0xDC, 0x41, 0x02, 0x91, 0xFD, 0xD2, 0x45, 0x61, 0x67, 0xED, 0x0D, 0xF3, 0xD8, 0x36, 0x06, 0x9B, 0x3A, 0xED, 0xDB, 0x47, 0xAA, 0x4F, 0x99, 0x71, 0x89, 0x3C, 0x2A, 0xCD, 0x1C, 0x9F, 0x00, 0x04, 0x39, 0xAE, 0x63, 0x2B, 0xFC, 0xC3, 0x32, 0xDE, 0xC6, 0x61, 0x3E, 0xD4, 0xB2, 0x63, 0x5B, 0x76, 0x45, 0xAA, 0xE5, 0xF3, 0x9B, 0xFB, 0xE7, 0xC1, 0xE8, 0xA0, 0xE4, 0x1F, 0x42, 0xE7, 0x43, 0x62, 0xB9, 0x4A, 0x18, 0x5F, 0x2C, 0x23, 0xF8, 0x31, 0xB3, 0x8D, 0x17, 0xD4, 0xDB, 0x89, 0x08, 0x33, 0xF1, 0x9B, 0x82, 0x9F, 0xB8, 0x27, 0xDF, 0x5F, 0x7E, 0x7D, 0xCD, 0xCE, 0x43, 0xB5, 0x26, 0x43, 0x72, 0x7F, 0x2E, 0xD2, 0x1C, 0x6D, 0x3C, 0xEF, 0x31, 0xC6, 0x05, 0xEB, 0x53, 0xE2, 0x1A, 0xE6, 0x1E, 0x96, 0x34, 0xE8, 0xB9, 0xDF, 0x9F, 0x97, 0x60, 0xFC, 0x4C, 0xF0, 0x4F, 0xC2, 0x2A, 0x32, 0x50, 0x77, 0x05, 0x89, 0x8E, 0x77, 0x25, 0xFA, 0xC8, 0x7A, 0x7F, 0x2D, 0x7C, 0xCD, 0x2D, 0xEE, 0x30, 0x00, 0xC3, 0xA4, 0xEB, 0x1B, 0x3F, 0xAB, 0xBE, 0xF5, 0xE1, 0x77, 0x6B, 0x37, 0x52, 0x3B, 0xEF, 0xC7, 0x19, 0x80, 0x9D, 0x1D, 0x97, 0x18, 0x86, 0x44, 0x98, 0x0D, 0x4A, 0x54, 0x12, 0x00, 0xD1, 0xF4, 0x4D, 0x65, 0x65, 0x5E, 0xEA, 0xB5, 0xBC, 0x44, 0x46, 0x1C, 0x82, 0x27, 0x79, 0xB9, 0x5D, 0x6F, 0xBC, 0x4F, 0x0D, 0x33, 0x28, 0xCC, 0x6A, 0x9A, 0xBF, 0x7F, 0xD4, 0xFA, 0x6E, 0x93, 0xE7, 0x87, 0xCC, 0xE8, 0xFA, 0x78, 0x91, 0x8A, 0xE3, 0x9D, 0x8B, 0xCF, 0x4C, 0xFA, 0xCA, 0xA6, 0x37, 0x0F, 0x03, 0x70, 0xE2, 0x04, 0x4C, 0x7C, 0x9A, 0xF8, 0xA1, 0xD6, 0x3D, 0xF1, 0xEF, 0x04, 0xB5, 0xE2, 0x4E, 0x62, 0xF4, 0x94, 0xC6, 0x3F, 0x04, 0xF7, 0xC8, 0x05, 0xE9, 0x45, 0xA3, 0xCF, 0xE0, 0xF3, 0x9C, 0xFE, 0xBE, 0xE7, 0x36, 0x80, 0x6B, 0x5D, 0x0A, 0x56, 0x62, 0xAF, 0x54, 0x15, 0x59, 0xD9, 0x53, 0xF5, 0x36, 0x27, 0xB2, 0xF5, 0x77, 0xB0, 0xE4, 0x6D, 0x47, 0xBF, 0xC7, 0xC2, 0x4F, 0xA5, 0x98, 0xB8, 0xCE, 0xF8, 0x8F, 0xAC, 0x9C, 0xF6, 0xF8, 0xA2, 0xF0, 0x0D, 0x5E, 0xFB, 0x11, 0x8A, 0x31, 0x15, 0x6D, 0x1F, 0x8E, 0xC0, 0x0F, 0xF5, 0x9F, 0xDB, 0x81, 0xFE, 0xF4, 0xF2, 0x6B, 0xEA, 0x9C, 0x37, 0xAF, 0x01, 0x24, 0xE0, 0x39, 0x8F, 0x5E, 0xDF, 0xB5, 0x09, 0x5E, 0x57, 0xBB, 0x59, 0x5F, 0x0B, 0x7E, 0x69, 0xFB, 0x5E, 0xEF, 0x58, 0x41, 0xD6, 0xBE, 0xB5, 0xEE, 0xFD, 0xB5, 0xCB, 0xE3, 0xFC, 0xF1, 0x85, 0xF5, 0xA1, 0x71, 0xD0, 0xC2, 0x31, 0xCD, 0xF1, 0x25, 0x79, 0xE3, 0x9B, 0xC2, 0xBF, 0x71, 0x9F, 0x81, 0xFF, 0x0C, 0xFA, 0xB3, 0x7F, 0x8C, 0xD3, 0x5F, 0x00, 0xFF, 0xC1, 0xB8, 0x1C, 0xEA, 0x67, 0xC0, 0xD5, 0xE8, 0xC3, 0xB5, 0x69, 0xA1, 0xDE, 0x47, 0x87, 0x0A, 0x53, 0xF3, 0xC4, 0x2C, 0xA1, 0x02, 0xBC, 0xFC, 0x3A, 0xB2, 0x85, 0x0F, 0xD3, 0x42, 0x2C, 0x29, 0x16, 0xA6, 0xBE, 0x25, 0x7C, 0x92, 0xD0, 0x7D, 0x49, 0x06, 0x87, 0xD5, 0xC1, 0x4B, 0x67, 0xE5, 0xA1, 0x0E, 0x41, 0xCD, 0x46, 0x7C, 0xAC, 0x9E, 0xAE, 0x6C, 0x28, 0xB5, 0x4D, 0x6A, 0x2D, 0xFE, 0x63, 0xF5, 0xA9, 0x2D, 0x86, 0xB9, 0xC7, 0xAF, 0x56, 0xC6, 0xCF, 0xB1, 0xD5, 0xFB, 0x4E, 0x7A, 0xFA, 0x13, 0x53, 0x01, 0xAA, 0xA4, 0x28, 0x3F, 0x50, 0x7D, 0x15, 0x91, 0xAF, 0xD5, 0x04, 0xDD, 0x03, 0x02, 0xD7, 0xC3, 0xA7, 0x59, 0xBC, 0x64, 0x6D, 0xD3, 0xFB, 0xA6, 0x2F, 0x17, 0xBF, 0x34, 0x5C, 0xBF, 0xE6, 0xA8, 0x9D, 0x14, 0x0F, 0x5C, 0xFB, 0x91, 0x29, 0x3E, 0x47, 0xF3, 0x48, 0x7E, 0x96, 0x90, 0x16, 0x09, 0xA0, 0xB6, 0x95, 0x2E, 0x95, 0xA6, 0xB0, 0x15, 0x7C, 0x8C, 0x98, 0x8D, 0xB1, 0x03, 0x60, 0xDA, 0xF5, 0xBD, 0xBB, 0x76, 0x05, 0xCA, 0x5D, 0x69, 0x73, 0x03, 0x42, 0x42, 0x94, 0x9D, 0x6B, 0x65, 0xCB, 0x4D, 0x43, 0x59, 0xDB, 0x2A, 0x5C, 0xDA, 0xFE, 0x5A, 0xFA, 0xA0, 0xDE, 0x83, 0x66, 0xDC, 0xD7, 0x62, 0xF5, 0x21, 0xCB, 0x73, 0xE4, 0x19, 0xA8, 0x01, 0xDF, 0xDD, 0xEC, 0xB1, 0xD2, 0x08, 0x58, 0x6B, 0xDD, 0x58, 0x2B, 0xE3, 0xA6, 0xDE, 0xAB, 0x2C, 0x67, 0xA0, 0xB3, 0xDA, 0xA6, 0x0E, 0x32, 0x09, 0x6C, 0x36, 0x41, 0x2F, 0x9B, 0x01, 0xF8, 0xF6, 0xF6, 0xE0, 0x54, 0xD6, 0xE7, 0xEA, 0xEB, 0x7C, 0x4D, 0x69, 0x8D, 0xB6, 0xA7, 0xBF, 0x5C, 0xFC, 0x25, 0xB7, 0xE8, 0x85, 0xD2, 0x94, 0x17, 0xE2, 0x27, 0x0A, 0xDF, 0xF3, 0xBE, 0x4D, 0x5F, 0x0E, 0xFC, 0x05, 0xDE, 0xC4, 0x00, 0x9C, 0x0E, 0x43, 0x20, 0x2A, 0x2E, 0x91, 0x77, 0x1D, 0x9D, 0xB7, 0xFD, 0x94, 0xE0, 0x43, 0x20, 0x3F, 0x40, 0xA8, 0x3E, 0x75, 0x4F, 0x23, 0x08, 0x8C, 0xC1, 0xF7, 0x58, 0x75, 0xA3, 0xED, 0xFB, 0x8C, 0x9E, 0x99, 0xE3, 0x87, 0x1E, 0xAF, 0xC2, 0xE7, 0xD7, 0xE2, 0x27, 0xD9, 0x7E, 0x68, 0x42, 0x22, 0xFB, 0x9B, 0x75, 0xEE, 0x45, 0x2B, 0xFC, 0x94, 0xC2, 0xC7, 0xD1, 0x9F, 0x64, 0x00, 0xA9, 0x15, 0x26, 0xC4, 0x91, 0xB0, 0x03, 0x8E, 0xBD, 0xAF, 0x05, 0x3F, 0x97, 0x20, 0xD6, 0xF6, 0xDF, 0x76, 0x55, 0x80, 0x27, 0x1D, 0x79, 0x24, 0xED, 0x51, 0xB5, 0xF1, 0xB3, 0x12, 0x98, 0x24, 0xE1, 0xAB, 0x7B, 0xBE, 0x1D, 0x78, 0x77, 0x40, 0xFC, 0xA4, 0xE8, 0xAB, 0x94, 0xFE, 0x72, 0x19, 0xC0, 0x9A, 0xF1, 0xF7, 0x8D, 0xF7, 0xBE, 0x9F, 0x0F, 0x48, 0x46, 0x11, 0xF8, 0x96, 0x04, 0x50, 0x28, 0xD1, 0x95, 0x5A, 0x82, 0x4A, 0xB7, 0x43, 0x97, 0x6A, 0x14, 0xC9, 0xF7, 0x31, 0x3A, 0x2B, 0x56, 0x07, 0xC5, 0xEA, 0x9C, 0x10, 0xC8, 0x8E, 0x9B, 0xFA, 0x9E, 0x10, 0x81, 0xC4, 0xE0, 0xA7, 0x08, 0x64, 0xCF, 0xF8, 0xAF, 0xA5, 0x41, 0x14, 0x6B, 0x28, 0xC8, 0x9C, 0x42, 0xCE, 0x19, 0x96, 0x04, 0xF1, 0x7D, 0x25, 0xF8, 0x69, 0x89, 0x7F, 0x3F, 0x3D, 0x4E, 0x46, 0xC0, 0xD0, 0xD1, 0x5D, 0x29, 0x91, 0x35, 0x75, 0x04, 0x58, 0x54, 0xA4, 0x0A, 0x3D, 0x9F, 0x01, 0xBF, 0xF8, 0xE8, 0xB0, 0x14, 0x07, 0x6D, 0xAC, 0x12, 0xEF, 0xDB, 0x34, 0x5E, 0x72, 0x9A, 0x6E, 0x75, 0xFC, 0x40, 0xE2, 0xC0, 0x96, 0x98, 0xC8, 0x1A, 0xD2, 0x99, 0xD7, 0x1E, 0x45, 0x86, 0xD5, 0xB9, 0xA1, 0x4E, 0x7E, 0x8F, 0x6A, 0xF8, 0x49, 0x3D, 0x1F, 0xA0, 0x77, 0x5F, 0xF6, 0xF5, 0x39, 0x14, 0x38, 0x69, 0x0C, 0x4E, 0x84, 0x68, 0x3A, 0x0C, 0x2A, 0x37, 0xA4, 0xB3, 0x35, 0x7C, 0xC0, 0x6D, 0x93, 0xB6, 0xE1, 0xA3, 0x93, 0xD5, 0x05, 0xFA, 0x83, 0x3C, 0xC0, 0x62, 0xFD, 0xB5, 0xF2, 0x78, 0x1F, 0x1B, 0xFE, 0x9D, 0xFA, 0x00, 0xE3, 0x49, 0xC1, 0xCB, 0x75, 0x7E, 0xA4, 0xE8, 0x63, 0x0D, 0xFC, 0x79, 0x47, 0x56, 0x0D, 0xFA, 0xCB, 0xED, 0x3F, 0xA8, 0x40, 0x20, 0xA5, 0x02, 0x84, 0x38, 0x4E, 0x28, 0x15, 0x73, 0xEC, 0x39, 0xCC, 0xB5, 0x06, 0x7C, 0xF0, 0xA4, 0x8E, 0x8E, 0xBC, 0x97, 0xAB, 0xE3, 0x39, 0x1C, 0x33, 0x47, 0xC7, 0xC6, 0xD6, 0xC7, 0x8C, 0x34, 0x31, 0xAB, 0x7F, 0x89, 0x0D, 0x21, 0xB4, 0x22, 0xC4, 0x56, 0xEA, 0x48, 0xFF, 0x93, 0x78, 0x87, 0xC8, 0x99, 0x5A, 0x05, 0xF0, 0xD7, 0xB6, 0x9F, 0x3C, 0x7C, 0xB4, 0x94, 0x3E, 0x4A, 0xBE, 0xAF, 0xC0, 0xC8, 0xED, 0x35, 0x0A, 0xAE, 0xA0, 0x2F, 0x1E, 0x0A, 0x6C, 0x6C, 0x06, 0xD2, 0xF3, 0xAB, 0xEB, 0xFB, 0x3F, 0x01, 0xC0, 0x7B, 0x70, 0x1C, 0xA5, 0xF8, 0xFA, 0xD4, 0xF3, 0xD5, 0xE0, 0xCB, 0x28, 0x3D, 0xA7, 0xFF, 0xDA, 0x60, 0x95, 0xC0, 0x37, 0xEA, 0x11, 0xE3, 0xE3, 0xDC, 0x5B, 0xED, 0x53, 0x1A, 0x26, 0x86, 0x24, 0xBC, 0xD6, 0xF8, 0xA1, 0xF5, 0xC7, 0x6F, 0x35, 0xFE, 0x63, 0xED, 0x7B, 0xFA, 0xEB, 0xB4, 0x6F, 0x25, 0x45, 0xC9, 0xFA, 0x3E, 0x2D, 0xFE, 0x18, 0x3D, 0x7E, 0x09, 0x7C, 0x3A, 0x49, 0x5A, 0x08, 0x42, 0x8A, 0x29, 0x9D, 0x9F, 0x61, 0xF8, 0xA6, 0x0A, 0x60, 0xC4, 0x42, 0xFB, 0x02, 0x0D, 0x42, 0xC7, 0x76, 0x69, 0x7E, 0xEC, 0x14, 0xC1, 0x63, 0xE1, 0x7B, 0x03, 0x17, 0x62, 0xCF, 0xEB, 0xF5, 0x34, 0x60, 0x95, 0x0F, 0x3C, 0x6F, 0xB3, 0xCB, 0xE4, 0xE6, 0x8F, 0x58, 0x18, 0x98, 0xFD, 0xFC, 0x06, 0x64, 0x8E, 0x23, 0x3C, 0xBC, 0xDC, 0xF6, 0x53, 0xE3, 0x59, 0x65, 0xFC, 0x02, 0xF8, 0x45, 0xE3, 0x3F, 0x82, 0x5F, 0x12, 0x99, 0x80, 0xD5, 0xC6, 0x03, 0xF9, 0x7D, 0x49, 0x1B, 0x4B, 0x0A, 0x7E, 0x28, 0xD6, 0x23, 0x07, 0x7E, 0xA2, 0x7F, 0xC9, 0xFE, 0x50, 0xCF, 0x06, 0x18, 0xFF, 0xF3, 0x92, 0x01, 0x58, 0x99, 0x13, 0xE9, 0xA8, 0x75, 0x1C, 0x1B, 0x34, 0x51, 0xCB, 0xA2, 0x5B, 0x72, 0x14, 0x78, 0x2F, 0xFB, 0x2B, 0x8D, 0xF3, 0xE3, 0xD9, 0x2B, 0x5C, 0x2F, 0x6D, 0xB1, 0xF9, 0x27, 0x9D, 0x01, 0x58, 0xF8, 0x28, 0xB4, 0x2B, 0x14, 0x07, 0x99, 0xD6, 0xB2, 0x9B, 0xAD, 0xB5, 0x0B, 0x96, 0xDE, 0xA7, 0x1C, 0x80, 0xB5, 0x53, 0x1B, 0x1C, 0xEA, 0x7E, 0xD5, 0x78, 0x47, 0xE8, 0xAB, 0xDD, 0x78, 0xD8, 0xA9, 0xB1, 0x3C, 0xCF, 0x7B, 0x16, 0x9E, 0xDC, 0xFE, 0x07, 0xB3, 0x11, 0xFB, 0xE0, 0x39, 0x99, 0xD2, 0x97, 0x6C, 0xD5, 0x49, 0xF8, 0xB4, 0xC2, 0xF8, 0x28, 0x73, 0xD9, 0x9F, 0xFF, 0xF5, 0xF7, 0x87, 0xE7, 0xB5, 0xD7, 0xE1, 0x0C, 0xA6, 0x26, 0xFE, 0xC4, 0x5E, 0xF6, 0x8B, 0x9F, 0xD8, 0x79, 0x10, 0xB1, 0xF3, 0x21, 0x7C, 0xD6, 0x75, 0x88, 0x3C, 0x1F, 0xAA, 0xCF, 0xA1, 0x0F, 0x4C, 0x7F, 0xD8, 0x2F, 0xFF, 0xEF, 0xDF, 0xFE, 0x40, 0xBD, 0xCD, 0xF8, 0xB6, 0x46, 0x7B, 0x0E, 0x85, 0x13, 0xC9, 0x29, 0xC1, 0xF7, 0x50, 0xA8, 0xDE, 0xE4, 0x45, 0x84, 0x98, 0x19, 0x4A, 0xEC, 0x41, 0x20, 0x56, 0xFE, 0x3F, 0x3F, 0x7C, 0x7B, 0x1F, 0x7C, 0x0C, 0xBE, 0xAD, 0x71, 0x90, 0x68, 0xBD, 0xBB, 0x09, 0xDD, 0xCA, 0xA9, 0x96, 0x78, 0x5F, 0x9D, 0x46, 0x1C, 0x85, 0x1F, 0x41, 0xB2, 0x0B, 0x9F, 0x64, 0x8C, 0x5F, 0x00, 0x3F, 0xDA, 0x26, 0xF9, 0x64, 0xFF, 0xA3, 0xED, 0xEB, 0xEF, 0xC7, 0xFA, 0x8F, 0xC5, 0xBF, 0x7A, 0x69, 0xB9, 0x37, 0xF1, 0x9F, 0xFA, 0x3E, 0x97, 0xD8, 0xF3, 0xBF, 0x2F, 0x54, 0x5F, 0x83, 0x4F, 0x17, 0x32, 0xF4, 0xD8, 0x49, 0x4D, 0x33, 0x7D, 0xA5, 0xE8, 0x27, 0x50, 0xFF, 0x67, 0xC9, 0x00, 0x82, 0xBB, 0x9B, 0x0C, 0x46, 0xE2, 0x39, 0x3A, 0x86, 0x14, 0x30, 0x32, 0x6C, 0x7D, 0x8A, 0x91, 0xB5, 0x86, 0x9F, 0xCD, 0xC8, 0x6D, 0xA3, 0x15, 0x59, 0x0F, 0x9F, 0xAE, 0x58, 0x48, 0x30, 0xE3, 0xB7, 0x16, 0x7E, 0xD5, 0x85, 0x2E, 0x45, 0x5F, 0x34, 0x41, 0x9F, 0x07, 0x18, 0xBF, 0xD0, 0xFB, 0xBE, 0x05, 0xB5, 0x36, 0xFD, 0x85, 0xE6, 0x67, 0x46, 0xFF, 0x99, 0x0A, 0xF0, 0x07, 0xF7, 0x88, 0xDD, 0x90, 0x3F, 0xD8, 0x81, 0xE8, 0xDB, 0xCE, 0x18, 0xF2, 0xB7, 0xA6, 0x10, 0x84, 0x85, 0xAF, 0xAF, 0x64, 0xFB, 0x84, 0x1F, 0xF1, 0xB3, 0xA6, 0x28, 0x24, 0x1A, 0x8A, 0x0B, 0xF9, 0xDB, 0x49, 0x9B, 0x8D, 0x9F, 0x45, 0x40, 0x4D, 0xE0, 0x43, 0xD8, 0x9F, 0x5D, 0x65, 0xFC, 0xCE, 0x88, 0xFE, 0xA2, 0x29, 0xE8, 0xEC, 0x7B, 0x0C, 0x7C, 0xD7, 0xD0, 0x37, 0xD9, 0x00, 0x52, 0xB9, 0xD0, 0xCF, 0xFA, 0x1E, 0x02, 0x81, 0x2F, 0xD7, 0xA5, 0xFD, 0x73, 0x1F, 0xBF, 0xD6, 0xFD, 0x5B, 0x0B, 0xBF, 0x75, 0xFF, 0xE3, 0xEF, 0x4F, 0x12, 0xC0, 0xCA, 0x50, 0x54, 0x33, 0x96, 0xC5, 0xED, 0x80, 0x77, 0x2F, 0x45, 0x71, 0xFD, 0xFE, 0xE1, 0x37, 0x09, 0xD9, 0x2D, 0xAE, 0x5F, 0xFB, 0x7D, 0x6B, 0xF1, 0x5B, 0x7F, 0xFC, 0xEA, 0xE2, 0xFF, 0xD0, 0xED, 0xEF, 0x1F, 0x3F, 0xC9, 0x2B, 0x0F, 0x45, 0xD9, 0x85, 0x18, 0xC0, 0x6C, 0x03, 0xA8, 0xE4, 0xE3, 0xBB, 0x6E, 0xF5, 0xAD, 0xAF, 0x7D, 0xFC, 0x7B, 0x7D, 0x43, 0xFA, 0x5B, 0x18, 0x40, 0x81, 0x13, 0x3B, 0xB2, 0xCB, 0x30, 0x6A, 0xCC, 0xB4, 0x19, 0x51, 0xF4, 0xB9, 0x52, 0x63, 0x29, 0x76, 0xD7, 0x66, 0x45, 0xF8, 0x21, 0x15, 0x31, 0x84, 0xC0, 0x68, 0xFD, 0xDA, 0xF6, 0xD7, 0x3A, 0x11, 0x73, 0x77, 0x99, 0x16, 0x8C, 0x5F, 0x14, 0x7E, 0x68, 0x7C, 0x6A, 0x8D, 0x47, 0x83, 0xE7, 0xA3, 0xF3, 0xA7, 0x56, 0xC9, 0x08, 0xC2, 0xC0, 0xD0, 0x5F, 0x5A, 0x02, 0x38, 0xF5, 0xEB, 0xA1, 0x57, 0xF0, 0x53, 0x1F, 0x9F, 0xB5, 0xE3, 0x77, 0xEC, 0x12, 0xD6, 0x35, 0xBF, 0x0A, 0x06, 0x10, 0xCD, 0x58, 0x75, 0xE8, 0x7B, 0x48, 0x64, 0xD4, 0xDA, 0xC3, 0x7D, 0x46, 0x82, 0x95, 0x7E, 0x7F, 0x84, 0xF8, 0xEB, 0xF7, 0xE1, 0xFB, 0xF5, 0x36, 0x80, 0x7E, 0xED, 0xD7, 0x7E, 0x3D, 0x03, 0x09, 0x00, 0xCC, 0xB3, 0x07, 0xC5, 0xD1, 0xC1, 0x32, 0xCA, 0x2A, 0x95, 0xE8, 0x25, 0xA5, 0xE3, 0xC7, 0xB6, 0xF5, 0xCF, 0xFC, 0x25, 0x00, 0xDF, 0x17, 0x84, 0x18, 0xAA, 0x37, 0x57, 0x1A, 0x7F, 0xFF, 0xED, 0x9D, 0x91, 0x34, 0xB5, 0x42, 0x05, 0xFB, 0xEF, 0xC2, 0x37, 0xDF, 0x4F, 0xD5, 0x43, 0xFA, 0x24, 0xA7, 0xCC, 0xF6, 0x53, 0xDB, 0xD2, 0xBD, 0x09, 0x7D, 0x32, 0xE1, 0xE7, 0x8C, 0x1F, 0x2A, 0xAD, 0x43, 0xB0, 0xFF, 0xE9, 0xF1, 0x2B, 0xCA, 0xD9, 0x1A, 0xA1, 0x8F, 0x55, 0xF0, 0x21, 0x9C, 0x09, 0x2C, 0xF5, 0xBE, 0x37, 0x7C, 0x21, 0x22, 0x41, 0xD9, 0x09, 0x50, 0x50, 0xF4, 0x15, 0x68, 0xBF, 0x8A, 0x1B, 0xB0, 0x5F, 0xFB, 0xB5, 0x5F, 0x4F, 0x55, 0x02, 0x08, 0x32, 0x80, 0xDA, 0x01, 0x0B, 0x87, 0x0E, 0x98, 0x38, 0xED, 0x80, 0x8D, 0xE3, 0x87, 0x5F, 0xD8, 0xBE, 0xFA, 0xED, 0xE8, 0xE9, 0xEF, 0xD0, 0xF4, 0xD9, 0xA6, 0xFF, 0xED, 0x6D, 0x00, 0x35, 0xFD, 0xA0, 0xA9, 0x58, 0xEC, 0x63, 0xEF, 0x7F, 0xAF, 0xC7, 0xD7, 0x63, 0xF1, 0x76, 0x68, 0x3F, 0xFB, 0x49, 0xC5, 0x09, 0x78, 0x0E, 0x07, 0x3D, 0x29, 0x06, 0x80, 0xAE, 0x1F, 0xA6, 0xA4, 0x26, 0xDE, 0x7A, 0x8B, 0x13, 0xD6, 0x68, 0x3F, 0xE7, 0xC4, 0xAD, 0x5E, 0x7F, 0x5E, 0x81, 0x36, 0x27, 0xDE, 0xFF, 0x36, 0x36, 0x80, 0xE8, 0xA6, 0x88, 0x7E, 0xED, 0xD7, 0x7E, 0x3D, 0xEA, 0x38, 0x00, 0x7B, 0xA5, 0x2C, 0xF3, 0x8B, 0xA7, 0xDE, 0x47, 0xC2, 0x8F, 0x58, 0xD9, 0xAB, 0xC0, 0xAF, 0xD6, 0xFF, 0xB0, 0xCE, 0xE5, 0xAF, 0xAF, 0xFD, 0x7D, 0x81, 0xE7, 0xE7, 0xC7, 0x91, 0xCF, 0xE7, 0xF6, 0xBF, 0x19, 0xFE, 0xF7, 0x3D, 0x7E, 0xB9, 0x71, 0x0C, 0xC7, 0xDB, 0x7F, 0x3F, 0x7C, 0x7F, 0x7F, 0x16, 0x09, 0xA0, 0xB5, 0x28, 0x74, 0xEC, 0x11, 0x7D, 0x3D, 0x62, 0xED, 0xB4, 0x23, 0x2E, 0x3B, 0x7E, 0x8E, 0x48, 0x05, 0x68, 0xB4, 0xEB, 0xED, 0xB4, 0xE0, 0xE7, 0x5A, 0x8D, 0xFB, 0xF8, 0x9D, 0x17, 0xFD, 0x35, 0xEA, 0xBF, 0x13, 0x38, 0xB3, 0x0E, 0x7E, 0x3E, 0x03, 0x08, 0xBA, 0x6D, 0xFA, 0xB5, 0x5F, 0xFB, 0x75, 0xAF, 0xD7, 0x0A, 0xB6, 0xB6, 0x8A, 0x71, 0x00, 0x19, 0x67, 0xC2, 0x1D, 0xC4, 0xCF, 0x8D, 0xBD, 0x2F, 0xED, 0xFF, 0x5A, 0xF8, 0xE7, 0xF2, 0x7D, 0x87, 0xF2, 0xC3, 0x1F, 0x1A, 0x7F, 0xA7, 0x39, 0x7E, 0xC7, 0xEF, 0x06, 0x3C, 0x75, 0xF8, 0xDD, 0x4D, 0x76, 0xA2, 0xDF, 0x87, 0x14, 0xB1, 0x4F, 0x9C, 0xBE, 0xDD, 0x7C, 0x00, 0x95, 0xF7, 0x1B, 0x53, 0xC4, 0x7E, 0x69, 0x3B, 0x56, 0x3D, 0x0A, 0x3F, 0xB5, 0xDF, 0x3A, 0x63, 0x80, 0x8A, 0xFA, 0xDF, 0x9A, 0x00, 0x53, 0xDF, 0x87, 0x7D, 0xBE, 0x14, 0x7E, 0xC5, 0x43, 0x16, 0xB0, 0xF8, 0xAF, 0x32, 0x3E, 0x0D, 0xE8, 0xE3, 0x20, 0xF0, 0xF7, 0x7C, 0xE8, 0x46, 0xDF, 0x0B, 0xD0, 0xAF, 0xFD, 0xDA, 0xE3, 0x00, 0xCA, 0x72, 0x92, 0x0D, 0x64, 0x3A, 0xF5, 0xAE, 0xA6, 0x55, 0x12, 0x6B, 0xF5, 0x1C, 0xD8, 0xFD, 0x88, 0xF4, 0xF3, 0xA7, 0xE0, 0xDB, 0x7E, 0xD2, 0x36, 0x56, 0xDE, 0x5C, 0xAB, 0x6E, 0x25, 0xAF, 0xC1, 0x81, 0xF0, 0xB3, 0x37, 0xAF, 0x47, 0x10, 0x7F, 0x95, 0xAC, 0xF8, 0x27, 0x83, 0x9F, 0xB2, 0xFE, 0x77, 0x09, 0xA0, 0x5F, 0xFB, 0xB5, 0x4B, 0x00, 0xF1, 0x48, 0xA3, 0xE3, 0xD8, 0xED, 0x74, 0xEC, 0xBB, 0xBD, 0x4E, 0x3D, 0xFD, 0xF6, 0xB9, 0xC3, 0x3F, 0xF7, 0xDD, 0x80, 0x65, 0xF5, 0x1E, 0x09, 0x00, 0x0B, 0x38, 0x37, 0xE3, 0x03, 0xB6, 0x1E, 0x2B, 0x4A, 0xAD, 0x85, 0xDF, 0xAA, 0xFF, 0xE7, 0x5E, 0x7F, 0xEE, 0xE3, 0xB7, 0xAF, 0xEF, 0x3B, 0xD4, 0xFC, 0x32, 0xEB, 0x05, 0x03, 0xF0, 0xE7, 0x3D, 0xC7, 0xA6, 0x6E, 0xB1, 0x63, 0x97, 0x5B, 0x7D, 0x40, 0x29, 0xFC, 0x74, 0xFF, 0xDB, 0xC2, 0x4F, 0x5D, 0x6B, 0xB5, 0x7F, 0xEA, 0xF0, 0xCF, 0xF5, 0xFB, 0x6A, 0xD2, 0x37, 0xDF, 0xE5, 0xBA, 0xAB, 0x0A, 0xBF, 0x7D, 0x56, 0xE0, 0x88, 0x1B, 0xC2, 0x34, 0x22, 0xEE, 0x3B, 0x06, 0x1C, 0xC9, 0x89, 0x5B, 0xC3, 0x2F, 0x6E, 0xBF, 0x92, 0x51, 0xAF, 0x8F, 0x5F, 0xDB, 0xEF, 0x5B, 0xFB, 0xFD, 0xCD, 0xE2, 0x18, 0x6C, 0x06, 0xD0, 0xC0, 0x8F, 0x8E, 0xF5, 0x63, 0x46, 0xBD, 0x10, 0xD8, 0xF7, 0xD7, 0xF6, 0x3F, 0xF5, 0x3E, 0x02, 0xBE, 0xD7, 0x1B, 0x71, 0x2A, 0x81, 0x30, 0x39, 0xDF, 0xA7, 0x9F, 0x34, 0xD3, 0x03, 0xA5, 0x8E, 0xB2, 0x9E, 0x84, 0x0E, 0xCC, 0xEE, 0x71, 0x00, 0xFD, 0xDA, 0xAF, 0xFD, 0x1A, 0xF6, 0x02, 0xE4, 0x8A, 0x2C, 0x90, 0xCE, 0xFB, 0xBE, 0x56, 0x85, 0xC8, 0xCD, 0x2B, 0x5F, 0x06, 0x1F, 0xBF, 0x3F, 0x3C, 0x57, 0xA4, 0xF3, 0xEF, 0xEF, 0x0E, 0xA5, 0x45, 0x4E, 0xEF, 0xEF, 0x3E, 0x36, 0xFC, 0xD8, 0xFD, 0xA9, 0x7D, 0xD6, 0x5D, 0x6A, 0xFC, 0xB2, 0xBE, 0xAF, 0xC2, 0xF8, 0x55, 0x1D, 0x8F, 0x5C, 0xFA, 0xAB, 0x40, 0xDF, 0xF1, 0xBD, 0x00, 0x5D, 0xA4, 0xEA, 0xF5, 0xBD, 0xFE, 0xDA, 0xEC, 0xCD, 0x70, 0xCE, 0x05, 0x40, 0xC7, 0xDE, 0x67, 0xE4, 0xB5, 0xB7, 0x77, 0x2D, 0x66, 0xED, 0x2D, 0xA8, 0x08, 0xBF, 0x55, 0xFF, 0x79, 0x76, 0x79, 0xCA, 0x46, 0x11, 0xBB, 0x77, 0x21, 0x2A, 0x71, 0xB5, 0xFA, 0xBE, 0xB5, 0x67, 0x3D, 0x36, 0x84, 0xEF, 0x3D, 0x2B, 0xF2, 0x00, 0xF4, 0x77, 0xD0, 0x7B, 0xC4, 0x5E, 0x89, 0x55, 0xE3, 0x13, 0x64, 0x00, 0xFF, 0xFA, 0xFB, 0xE2, 0xF3, 0x23, 0x7B, 0xE9, 0xA5, 0x97, 0xD3, 0x2E, 0x9D, 0x01, 0xF4, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0xCB, 0xA9, 0x96, 0x01, 0xB4, 0x78, 0x9A, 0xE8, 0x8F, 0x9D, 0x01, 0xF4, 0xD2, 0x4B, 0xC9, 0x3A, 0x09, 0x91, 0xCC, 0x06, 0x5D, 0x02, 0xE8, 0xA5, 0x97, 0x5E, 0x3A, 0x03, 0x38, 0x43, 0x39, 0xAA, 0x2F, 0x22, 0xBD, 0x74, 0x06, 0xD0, 0x4B, 0x2F, 0xBD, 0x74, 0x06, 0xD0, 0x55, 0xC0, 0x63, 0x16, 0x30, 0xBA, 0x08, 0xD6, 0xB1, 0xD3, 0x19, 0x40, 0x2F, 0xBD, 0xF4, 0xD2, 0x19, 0x40, 0x2F, 0xBD, 0xF4, 0xD2, 0x19, 0x40, 0x2F, 0xBD, 0xF4, 0xD2, 0x19, 0x40, 0x2F, 0xBD, 0xF4, 0xD2, 0x19, 0x40, 0x2F, 0xBD, 0xF4, 0xD2, 0x19, 0x40, 0x2F, 0xBD, 0xF4, 0xD2, 0x19, 0x40, 0x7E, 0xE9, 0x7E, 0xBC, 0x5E, 0x5A, 0x4E, 0x44, 0x38, 0x4C, 0x9C, 0x58, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0x25, 0x80, 0x5E, 0x7A, 0xE9, 0xA5, 0x33, 0x80, 0x5E, 0x7A, 0xE9, 0xA5, 0x33, 0x80, 0x5E, 0x7A, 0xE9, 0xA5, 0x33, 0x80, 0x5E, 0x7A, 0xE9, 0xA5, 0x33, 0x80, 0xC2, 0xD2, 0xAD, 0xE6, 0xBD, 0xF4, 0xD2, 0x25, 0x80, 0x5E, 0x7A, 0xE9, 0xA5, 0x33, 0x80, 0x5E, 0x7A, 0xE9, 0xA5, 0x33, 0x80, 0x5E, 0x7A, 0xE9, 0xE5, 0x04, 0x18, 0x40, 0x57, 0xE0, 0x7B, 0xE9, 0xA5, 0x4B, 0x00, 0xBD, 0xF4, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0x9C, 0x04, 0x9A, 0xA1, 0x9F, 0x4A, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0x4B, 0x67, 0x00, 0xBD, 0x74, 0x79, 0xA6, 0x97, 0xCE, 0x00, 0x7A, 0xE9, 0xA5, 0x33, 0x80, 0xCE, 0x00, 0x7A, 0xE9, 0xE5, 0xFA, 0xCA, 0x15, 0x9D, 0x01, 0xF4, 0xD2, 0x4B, 0x97, 0x00, 0x7A, 0xE9, 0xA5, 0x97, 0xCE, 0x00, 0x7A, 0xE9, 0xA5, 0x97, 0xCE, 0x00, 0x7A, 0xE9, 0xA5, 0x97, 0xCE, 0x00, 0x7A, 0xE9, 0xA5, 0x97, 0xCE, 0x00, 0x6A, 0xB7, 0x08, 0xDD, 0x89, 0xDB, 0xCB, 0xE9, 0x97, 0x33, 0x49, 0x99, 0x71, 0x54, 0x12, 0x40, 0x4F, 0x43, 0xD2, 0x4B, 0x2F, 0x5D, 0x05, 0xE8, 0xA5, 0x97, 0x5E, 0x3A, 0x03, 0xE8, 0xA5, 0x4B, 0x53, 0xBD, 0x9C, 0x04, 0x03, 0xE8, 0xC4, 0xD6, 0x4B, 0x2F, 0x5D, 0x02, 0xE8, 0xA5, 0x97, 0xBE, 0x90, 0x74, 0x06, 0xD0, 0x4B, 0x2F, 0xBD, 0x74, 0x06, 0xD0, 0x4B, 0x2F, 0xBD, 0x74, 0x06, 0xD0, 0x4B, 0x2F, 0xBD, 0x74, 0x06, 0xD0, 0x4B, 0x2F, 0xBD, 0x74, 0x06, 0xD0, 0x4B, 0x2F, 0xBD, 0x74, 0x06, 0xD0, 0x0B, 0x1E, 0x41, 0xD0, 0x23, 0xA7, 0xFB, 0xA8, 0x9F, 0x25, 0x03, 0xE8, 0x4E, 0x9F, 0x5E, 0x4E, 0xA8, 0x9C, 0x29, 0xB9, 0x76, 0x09, 0xA0, 0x97, 0x5E, 0xAE, 0xB1, 0x64, 0x70, 0xBE, 0x0C, 0xA0, 0x0B, 0x18, 0xBD, 0xF4, 0x82, 0x60, 0x00, 0xFF, 0xCE, 0x18, 0x40, 0xE1, 0x44, 0xE9, 0xFA, 0x69, 0x2F, 0xBD, 0x74, 0x09, 0xA0, 0x97, 0x5E, 0x7A, 0xE9, 0x0C, 0xA0, 0x97, 0x5E, 0x7A, 0xE9, 0x0C, 0xA0, 0x97, 0x5E, 0x8E, 0xA6, 0x74, 0x43, 0x50, 0x67, 0x00, 0xBD, 0xF4, 0xD2, 0x4B, 0x7B, 0x06, 0xD0, 0x79, 0x6D, 0x2F, 0xBD, 0x74, 0x09, 0xA0, 0x97, 0x5E, 0x7A, 0xE9, 0x0C, 0xE0, 0x54, 0xBE, 0x1E, 0xBA, 0x1F, 0xB3, 0x97, 0xCE, 0x00, 0xFA, 0x30, 0xF4, 0xD2, 0xCB, 0xB5, 0x65, 0x00, 0x7F, 0xA0, 0xF3, 0x4A, 0x98, 0x75, 0x65, 0x7F, 0x10, 0x12, 0xF9, 0x3D, 0x54, 0xDF, 0xFA, 0x9A, 0x6A, 0xBF, 0x56, 0x7D, 0xAB, 0xF1, 0x69, 0x3D, 0x6E, 0xFB, 0xC2, 0x4F, 0x0A, 0x7E, 0x69, 0xFD, 0xBE, 0xF0, 0x57, 0xDA, 0xEF, 0x7D, 0xD1, 0x77, 0x1D, 0xFA, 0x5B, 0xC1, 0x00, 0x0E, 0x3D, 0x50, 0x6B, 0x09, 0xEC, 0xD8, 0xFB, 0x7F, 0x2C, 0x84, 0x74, 0xAA, 0xF8, 0x39, 0x77, 0xFC, 0xD5, 0xE9, 0x3F, 0xF9, 0xF3, 0xBF, 0xFD, 0x61, 0x52, 0x01, 0x42, 0x0F, 0xAA, 0x52, 0xDA, 0x50, 0xEA, 0xFD, 0xD6, 0xF0, 0xD7, 0x5E, 0x5B, 0xF7, 0xFF, 0xD8, 0xC7, 0xEF, 0xD8, 0xE1, 0x77, 0xFA, 0x5B, 0xD5, 0xFE, 0x2A, 0x06, 0xA0, 0x24, 0x89, 0x43, 0x23, 0x40, 0x31, 0xB4, 0xA2, 0xFA, 0xC8, 0xD5, 0x60, 0xF0, 0x05, 0xF0, 0x6B, 0x8D, 0x4F, 0xAA, 0xFD, 0x55, 0xE3, 0x7B, 0xEC, 0xED, 0x1F, 0x70, 0x02, 0x29, 0xFC, 0xB7, 0x1A, 0x3F, 0x2C, 0xFC, 0x55, 0xF4, 0x1D, 0x82, 0x5F, 0x6E, 0x03, 0x68, 0xA5, 0xDB, 0x1D, 0x4B, 0xFB, 0xBD, 0xFE, 0x34, 0xEA, 0x4B, 0x75, 0xFC, 0x5E, 0xAF, 0xD7, 0x0B, 0x06, 0xE0, 0x5F, 0xA9, 0x3C, 0x4B, 0x60, 0xE0, 0x7E, 0x7A, 0x3F, 0xF5, 0x7C, 0x3B, 0xF8, 0xA9, 0xFE, 0xE3, 0xDE, 0x4F, 0x3D, 0x9F, 0x82, 0xDF, 0xAE, 0xFD, 0x53, 0x87, 0xEF, 0x1D, 0x3F, 0xC2, 0xFE, 0xA0, 0x25, 0xF8, 0x77, 0x19, 0x80, 0x5D, 0x4F, 0xD8, 0x95, 0x56, 0x9C, 0x28, 0x6B, 0xE9, 0x2F, 0xD5, 0x5E, 0x1D, 0xFC, 0x84, 0x25, 0xCF, 0x18, 0xFC, 0x45, 0x02, 0x30, 0x44, 0x05, 0x89, 0x9C, 0x53, 0x32, 0x6A, 0x5C, 0x23, 0x5D, 0x15, 0xA5, 0x5A, 0x74, 0x5D, 0xBF, 0xDB, 0x4A, 0x10, 0xEF, 0x67, 0x48, 0x00, 0xC7, 0x6B, 0x05, 0x5E, 0xDB, 0xFF, 0x28, 0xC7, 0x0C, 0x0E, 0xFC, 0xB1, 0x8B, 0x7A, 0xA7, 0x6E, 0xA5, 0xCF, 0x5D, 0x41, 0xC3, 0x2B, 0xDE, 0xDA, 0xEF, 0x2B, 0xA3, 0xAF, 0x4A, 0xF0, 0x8B, 0xE9, 0x0F, 0x37, 0x3E, 0x0D, 0xDD, 0x80, 0xFD, 0xDA, 0xAF, 0xFD, 0x7A, 0xEC, 0xD7, 0x08, 0x03, 0xA8, 0xA7, 0xC3, 0x9F, 0x86, 0xB1, 0xC4, 0xA7, 0x63, 0x42, 0x44, 0x15, 0x6A, 0x35, 0x3E, 0xD8, 0x40, 0x9D, 0x63, 0xC3, 0x4F, 0x58, 0x47, 0xDF, 0x4F, 0xFF, 0xF7, 0xD5, 0xFE, 0xA9, 0xC3, 0xCF, 0x8D, 0x03, 0x38, 0x75, 0x3F, 0xFA, 0x75, 0xEF, 0xFF, 0x39, 0xE9, 0xB6, 0x1B, 0xF6, 0xDF, 0xAE, 0xE3, 0xAF, 0xAE, 0x04, 0x70, 0xEA, 0x0C, 0xC0, 0xC3, 0x40, 0x6B, 0xC1, 0x4F, 0xF9, 0x69, 0x53, 0x71, 0x02, 0x66, 0xBD, 0xCB, 0xB1, 0x6B, 0xF9, 0x99, 0x71, 0xF5, 0x81, 0x15, 0xA3, 0x9A, 0x9F, 0xBC, 0x3E, 0xFC, 0xD4, 0x8A, 0x17, 0x32, 0x86, 0xDA, 0x0B, 0x68, 0x6D, 0x3F, 0x7D, 0x6B, 0xF8, 0x21, 0xFA, 0x0A, 0xD1, 0x37, 0x0E, 0xBE, 0x6B, 0x33, 0x23, 0x04, 0xBA, 0x0D, 0xA0, 0x5F, 0xFB, 0xF5, 0x7A, 0xDB, 0x00, 0xD6, 0x86, 0x02, 0xAF, 0x5D, 0x01, 0xD0, 0x12, 0x44, 0xB9, 0x55, 0x3A, 0xEA, 0x36, 0x6B, 0x0D, 0x3F, 0xA5, 0xB3, 0xED, 0xCD, 0x3D, 0x56, 0xDE, 0x7E, 0xEB, 0xF1, 0x5B, 0xE5, 0x55, 0x68, 0x2D, 0x81, 0xEC, 0x81, 0xFE, 0x6C, 0x09, 0xD1, 0x78, 0xBE, 0x19, 0x7E, 0xBA, 0x17, 0xA0, 0x5F, 0xFB, 0xB5, 0x4B, 0x00, 0xE5, 0x71, 0x00, 0xA7, 0x54, 0x3F, 0xB0, 0xEB, 0xAE, 0xA2, 0x15, 0x9C, 0xCA, 0x2B, 0x29, 0xB2, 0x5A, 0xD7, 0xF1, 0x53, 0xB7, 0xB4, 0xF2, 0x97, 0x7C, 0xDF, 0xBE, 0xAC, 0xFC, 0x87, 0xF6, 0x12, 0x1D, 0xBB, 0x17, 0x26, 0xD7, 0x0B, 0xE0, 0x48, 0x00, 0xB5, 0x02, 0x40, 0x0E, 0xB5, 0x1F, 0xFB, 0xD0, 0xB1, 0xE6, 0xE7, 0xBE, 0x97, 0xA2, 0x35, 0xFE, 0x0F, 0x1D, 0xEB, 0x7F, 0xEE, 0xDB, 0x9C, 0x3D, 0xF9, 0x00, 0x4C, 0x09, 0xA0, 0xD4, 0x0F, 0xD9, 0xDA, 0x8F, 0x99, 0x4B, 0x20, 0xF8, 0xFA, 0xBC, 0xEF, 0x2F, 0x85, 0x9F, 0x8A, 0x65, 0x3F, 0xDF, 0xEF, 0xDB, 0x0F, 0xFC, 0x76, 0xED, 0xB7, 0x86, 0x7F, 0x48, 0xFC, 0x1C, 0x7F, 0x3E, 0x80, 0x1E, 0x63, 0x7E, 0xBD, 0xEB, 0x0F, 0x8D, 0xBF, 0x33, 0xA7, 0xBF, 0x8A, 0x5E, 0x80, 0xEB, 0x5B, 0xBF, 0x2A, 0x0E, 0xA1, 0xD7, 0x1F, 0x57, 0x7D, 0xEA, 0xFE, 0x8C, 0xE0, 0xF7, 0x38, 0x80, 0x7E, 0xDD, 0xCB, 0x75, 0x60, 0xD7, 0xB1, 0x8F, 0xC3, 0x99, 0x46, 0x02, 0xE6, 0x8A, 0x20, 0x0D, 0x9E, 0x2F, 0xDA, 0x1E, 0x1B, 0x81, 0x9F, 0xDA, 0x5F, 0x5D, 0xE6, 0x07, 0x0E, 0xFB, 0xA9, 0x4B, 0x33, 0x16, 0x55, 0xC9, 0x98, 0x54, 0x61, 0xFC, 0x9A, 0xF6, 0x1F, 0xED, 0x35, 0xD9, 0xDF, 0xF8, 0xE5, 0x8E, 0x17, 0x2E, 0x0E, 0x60, 0x7F, 0xF0, 0x7B, 0x1C, 0x40, 0xBF, 0xF6, 0x6B, 0xBF, 0xBA, 0x71, 0x00, 0x29, 0xCE, 0x93, 0x8A, 0xBD, 0x4E, 0xED, 0xD7, 0x2F, 0x5D, 0x69, 0x52, 0xFB, 0xA5, 0xFD, 0x3A, 0x38, 0xBE, 0xFD, 0x32, 0xF8, 0x81, 0xD8, 0xF0, 0x02, 0x09, 0xA2, 0x6C, 0xFC, 0x90, 0x2B, 0x62, 0x62, 0x05, 0xC0, 0x8C, 0xDF, 0xBE, 0xF0, 0x8F, 0x1D, 0x5F, 0xDC, 0x0A, 0x9A, 0x4F, 0x1F, 0x6B, 0xE9, 0x2F, 0x2F, 0x5F, 0xC5, 0x5A, 0xFC, 0x84, 0x6D, 0x50, 0x76, 0x24, 0x61, 0x68, 0x7C, 0xC8, 0xBA, 0x38, 0x80, 0x53, 0xCD, 0xAB, 0xDF, 0x3A, 0xAF, 0xFC, 0xA1, 0xDF, 0xEF, 0xF8, 0x39, 0xF4, 0xF7, 0x0D, 0xEC, 0xF7, 0x11, 0x0D, 0xE7, 0xB0, 0xFD, 0xF7, 0xAA, 0x00, 0x6D, 0x22, 0xD5, 0x8E, 0x35, 0xE0, 0x27, 0xD7, 0x0F, 0x8B, 0xEF, 0xFF, 0x94, 0x9B, 0xAE, 0xDD, 0xF8, 0xC5, 0x57, 0xAE, 0xEB, 0x93, 0xDC, 0xB2, 0x55, 0x46, 0x2B, 0x85, 0xBF, 0xD6, 0x19, 0xB3, 0x0E, 0x09, 0xBF, 0x62, 0x42, 0x90, 0xD3, 0x65, 0x00, 0xA7, 0xD9, 0xFF, 0x3D, 0x44, 0x94, 0xA9, 0xB2, 0x97, 0xFE, 0xEF, 0x3B, 0xD4, 0xF7, 0xBA, 0x44, 0xFC, 0x01, 0xFE, 0x60, 0x10, 0x7B, 0x7F, 0xB2, 0xBD, 0x9F, 0x5D, 0x70, 0x44, 0x4F, 0x7D, 0x6C, 0xBF, 0x31, 0x1E, 0xDF, 0x0B, 0x7C, 0x2F, 0x1D, 0xDA, 0xF5, 0x6B, 0xE1, 0x7B, 0xFA, 0x6F, 0xD6, 0x87, 0xBF, 0xD7, 0x9B, 0xB2, 0x2D, 0x19, 0x7A, 0x9D, 0x6E, 0xDF, 0xAB, 0xF3, 0x85, 0xE6, 0x61, 0xB2, 0xBD, 0x81, 0xDD, 0x8F, 0xA8, 0xF1, 0xC3, 0xC1, 0x2F, 0xC7, 0x4F, 0x6C, 0xFC, 0x52, 0xE3, 0xB3, 0x80, 0xCF, 0xC4, 0x5F, 0x84, 0x8F, 0xA5, 0xE8, 0x7B, 0x2F, 0xDF, 0x57, 0x1D, 0x7E, 0x78, 0x3E, 0xC4, 0xE8, 0xBB, 0xC0, 0x06, 0x50, 0x2F, 0x99, 0x63, 0x1B, 0x4E, 0xD9, 0xEF, 0xCF, 0xE6, 0x5E, 0x64, 0x00, 0xC2, 0x86, 0x00, 0x1F, 0xCB, 0xA6, 0xA2, 0xD3, 0xBA, 0xD7, 0x18, 0x40, 0x6E, 0xEC, 0xF3, 0xDA, 0x1C, 0x6D, 0x6B, 0xF7, 0x0E, 0xB4, 0x8E, 0x0D, 0x5F, 0x0B, 0xFF, 0xD0, 0xED, 0x9F, 0x3A, 0xFC, 0x63, 0xFF, 0xBE, 0x7D, 0xEF, 0x1D, 0x48, 0xBD, 0x97, 0xFB, 0x9C, 0xA3, 0x02, 0x20, 0xD3, 0x10, 0x5F, 0xB7, 0x7A, 0x8F, 0x88, 0xDE, 0xBF, 0xEF, 0x84, 0xE0, 0xAF, 0x6D, 0xBF, 0x35, 0xFC, 0xD6, 0xE3, 0x97, 0x78, 0x9F, 0x49, 0x00, 0xBF, 0x37, 0x55, 0x00, 0x75, 0x13, 0xF4, 0x5B, 0x12, 0x0D, 0x60, 0x83, 0xC8, 0x3E, 0x1B, 0x7E, 0x93, 0xCD, 0x13, 0xA4, 0x10, 0x3E, 0x59, 0x80, 0x47, 0xFB, 0x4F, 0xD3, 0x70, 0x9C, 0xEC, 0xC3, 0xBE, 0x7A, 0xFB, 0x7B, 0xB0, 0xED, 0x43, 0x21, 0xFC, 0x5C, 0xFC, 0x6B, 0x5A, 0x66, 0x69, 0xFF, 0x6D, 0x7C, 0x64, 0x8D, 0x5F, 0x28, 0xF6, 0x3D, 0xF2, 0xDD, 0xDE, 0xFE, 0x86, 0xDE, 0x2F, 0x19, 0x3F, 0x68, 0x0C, 0xBF, 0xEE, 0xFC, 0x9C, 0x18, 0x80, 0xF1, 0xA4, 0x1D, 0x39, 0xE0, 0x29, 0xB6, 0x75, 0xA5, 0xA8, 0xFE, 0xD4, 0xE1, 0x23, 0xEA, 0x43, 0xCF, 0xD5, 0xAA, 0x6F, 0xDD, 0xFE, 0x5A, 0xF8, 0x47, 0x8D, 0x1F, 0x44, 0xFB, 0x67, 0x85, 0x1F, 0x7F, 0xE4, 0x90, 0x69, 0x04, 0x8C, 0x0E, 0x10, 0x5D, 0x2A, 0xD1, 0x1F, 0x20, 0x8F, 0x18, 0xB3, 0xAB, 0x6D, 0xBF, 0xA4, 0xC5, 0xA6, 0xC2, 0xF5, 0xB8, 0x01, 0xDA, 0x2F, 0x7C, 0xFB, 0x41, 0x92, 0x68, 0x1F, 0xDC, 0xF8, 0x80, 0x2A, 0x04, 0x82, 0x69, 0x7F, 0xCD, 0xF8, 0xD5, 0x83, 0x8F, 0xA3, 0xAF, 0x90, 0x3D, 0x1B, 0xDB, 0xBE, 0x76, 0xAE, 0x43, 0xB4, 0x7F, 0xA5, 0xF0, 0x0F, 0x3D, 0x7E, 0xE1, 0xFE, 0x87, 0xDF, 0xA7, 0x66, 0x07, 0x1D, 0x15, 0x60, 0x35, 0xAB, 0x4D, 0xDD, 0x87, 0x46, 0x2A, 0x00, 0xD5, 0xAE, 0x4F, 0xDD, 0xE7, 0xF6, 0x3F, 0x09, 0xAF, 0xF1, 0x52, 0x94, 0xDD, 0xDE, 0x91, 0xC1, 0xCF, 0xC5, 0x77, 0x36, 0xFC, 0xD6, 0x65, 0xED, 0xF8, 0x25, 0xEE, 0x53, 0xF4, 0x79, 0x04, 0xF8, 0x91, 0x2A, 0x40, 0x63, 0x51, 0xF8, 0x58, 0xCB, 0xB1, 0xF7, 0x7F, 0x6D, 0xFB, 0xAD, 0xBF, 0xEF, 0xDC, 0xC7, 0xEF, 0xDC, 0xF1, 0xC3, 0x1F, 0xF9, 0xD3, 0xE5, 0xD7, 0x94, 0x1A, 0x5C, 0x48, 0x8A, 0xC9, 0x8D, 0x79, 0xF9, 0xB1, 0x3D, 0x7F, 0x6A, 0xB4, 0x7F, 0x6C, 0xF0, 0x5B, 0xAF, 0x5D, 0x07, 0x97, 0x3D, 0x32, 0x5F, 0x38, 0x15, 0xFC, 0x93, 0xEF, 0x5F, 0xFE, 0x86, 0x96, 0x85, 0x82, 0xEE, 0xE1, 0xF9, 0x52, 0x4D, 0x23, 0x06, 0x3F, 0x66, 0x15, 0xD5, 0x8C, 0xA8, 0x28, 0x2F, 0x43, 0x0A, 0xFE, 0xDA, 0xF6, 0x73, 0xC7, 0xA7, 0xC6, 0xF7, 0x1D, 0x1A, 0x3F, 0x2D, 0xDB, 0xCF, 0x1D, 0x3F, 0x1F, 0x3C, 0xB2, 0x47, 0xFC, 0xAF, 0xA5, 0x3F, 0x04, 0x7D, 0x2D, 0x0C, 0xC0, 0xFA, 0xD2, 0x81, 0x5D, 0x46, 0xA5, 0xA7, 0x00, 0xF5, 0xBB, 0x51, 0x7C, 0x1D, 0xF6, 0xD8, 0x74, 0x96, 0x7A, 0xDF, 0xFB, 0x11, 0xF8, 0x5E, 0x78, 0xDA, 0xF3, 0x60, 0x1B, 0x72, 0x23, 0xF0, 0x7D, 0xF5, 0x39, 0x29, 0x95, 0x82, 0xEF, 0x23, 0xE1, 0xB7, 0x68, 0xDF, 0xF7, 0xFD, 0x29, 0xF7, 0x66, 0x0A, 0xBE, 0xFE, 0x7E, 0x0A, 0x7F, 0x29, 0x7C, 0xE7, 0xE0, 0x3F, 0x8A, 0x3F, 0x8F, 0x21, 0xCB, 0xFB, 0x3D, 0x21, 0x37, 0x63, 0x01, 0x7D, 0x80, 0xA7, 0x59, 0x92, 0xB1, 0x2E, 0xE7, 0xD2, 0x47, 0x6D, 0xFA, 0x4B, 0xF5, 0x5F, 0xB9, 0x01, 0xBF, 0xBF, 0xFC, 0x0D, 0x35, 0x9B, 0xE0, 0xF1, 0xC2, 0xCB, 0x84, 0x9C, 0x40, 0x52, 0xB7, 0x7E, 0xBE, 0x8B, 0xD5, 0xBB, 0xF7, 0x76, 0x27, 0x53, 0xF5, 0x8E, 0xDF, 0x13, 0xCB, 0xEE, 0xD5, 0x07, 0x66, 0xB6, 0xBF, 0xB6, 0xFF, 0x79, 0xF7, 0x6B, 0xC7, 0xAF, 0x3E, 0x7E, 0x52, 0xEF, 0xA7, 0x96, 0x43, 0x74, 0xFF, 0x51, 0xF4, 0x95, 0xEE, 0x5F, 0x71, 0xFB, 0xB9, 0xF4, 0x57, 0x05, 0xDF, 0x47, 0x78, 0xFF, 0xFD, 0xCB, 0xAF, 0x35, 0x2F, 0x80, 0x16, 0x2D, 0x44, 0x23, 0x2C, 0x9D, 0x80, 0x65, 0x3D, 0xD7, 0xC7, 0xC8, 0xAE, 0xB7, 0xEE, 0x89, 0xB6, 0xD2, 0x78, 0xEB, 0xED, 0xF6, 0x4B, 0xE0, 0xDB, 0x38, 0x24, 0xFE, 0xEF, 0x0B, 0x4A, 0x18, 0xBE, 0xFE, 0x04, 0xC6, 0xC7, 0xA8, 0xD7, 0xDB, 0xF7, 0xB8, 0x65, 0xBC, 0x12, 0x13, 0x35, 0xC7, 0x83, 0xD8, 0x81, 0x36, 0x10, 0x87, 0xAF, 0xB7, 0xEF, 0x3D, 0x0A, 0xCA, 0x5E, 0xD1, 0xED, 0x40, 0x2B, 0xCB, 0xED, 0x46, 0xAC, 0xFE, 0x18, 0xE3, 0xE7, 0xFB, 0x3E, 0x08, 0xC3, 0xCF, 0xC2, 0x0F, 0x0D, 0xE3, 0x57, 0x1F, 0x84, 0x14, 0x7D, 0xE4, 0xB6, 0x3F, 0xD3, 0x63, 0x0C, 0x3F, 0x72, 0x9C, 0xBC, 0xF4, 0x43, 0xF0, 0xF8, 0x59, 0x0B, 0xDF, 0xC1, 0x6F, 0xAA, 0x9E, 0x24, 0xE8, 0xCB, 0xB6, 0x01, 0x84, 0x74, 0xA6, 0x94, 0xFB, 0x22, 0xD7, 0x22, 0xD3, 0x4A, 0x87, 0x6C, 0xD5, 0x7E, 0x6D, 0x0B, 0x55, 0x2D, 0x9D, 0xF7, 0xD0, 0x3A, 0xF3, 0xBE, 0xC6, 0x6F, 0xDF, 0x16, 0xC0, 0x7D, 0xDA, 0x1C, 0x0E, 0x09, 0x7F, 0x61, 0x00, 0x89, 0x1C, 0x56, 0xAD, 0xEE, 0x53, 0x39, 0xB4, 0x9C, 0x7A, 0x9B, 0x01, 0xD9, 0xF0, 0xED, 0x0F, 0x44, 0xE6, 0xE8, 0x42, 0x6D, 0xC2, 0xB0, 0x23, 0xA9, 0x20, 0x10, 0x90, 0x81, 0x7D, 0xDF, 0xD3, 0xAE, 0xD1, 0xFF, 0x56, 0xED, 0xA3, 0x73, 0x46, 0x35, 0xC0, 0x8F, 0xBA, 0x07, 0x7F, 0xE8, 0xEB, 0x6A, 0xFA, 0xC2, 0xB6, 0x4F, 0x0A, 0xC6, 0xAF, 0x35, 0x7E, 0x52, 0x13, 0xB8, 0x0D, 0xFE, 0x27, 0x06, 0x50, 0x27, 0x6D, 0x2B, 0xBE, 0x3E, 0xFB, 0x79, 0x35, 0x40, 0xA5, 0xEE, 0x05, 0xEB, 0x3E, 0x49, 0x90, 0x67, 0x7A, 0x0D, 0x32, 0xC8, 0xD0, 0xB0, 0x65, 0x8E, 0xDF, 0xC1, 0xDD, 0x45, 0x81, 0xA5, 0xBC, 0xB4, 0xD9, 0x83, 0x5F, 0x49, 0xF9, 0x9E, 0x18, 0x6C, 0x52, 0x50, 0x61, 0x03, 0x38, 0x36, 0xA7, 0x38, 0x56, 0xC4, 0x1B, 0x60, 0x72, 0x55, 0x84, 0x62, 0x9E, 0xA3, 0xE6, 0xD0, 0x90, 0x79, 0x3C, 0xC2, 0x51, 0xED, 0x15, 0xC4, 0xDB, 0xBF, 0xD0, 0x0A, 0x1B, 0xAA, 0x4F, 0xC1, 0x5B, 0xDB, 0x7E, 0xAA, 0x3F, 0x9E, 0x71, 0x49, 0xF5, 0xDF, 0xA7, 0x97, 0x53, 0x94, 0x99, 0x3C, 0x03, 0x3F, 0xB9, 0xF4, 0x92, 0xC2, 0xA7, 0xDD, 0xDF, 0x0C, 0x78, 0xDE, 0xF1, 0xAE, 0x45, 0x1F, 0xFB, 0xC6, 0xBF, 0x23, 0x01, 0x7C, 0x4D, 0xE3, 0x03, 0x80, 0x40, 0x14, 0xEA, 0xF9, 0x14, 0x7C, 0x6C, 0xA2, 0xF9, 0x35, 0x13, 0x3D, 0x60, 0xC3, 0x70, 0xEA, 0x0F, 0xAC, 0xC3, 0x26, 0x43, 0x48, 0xD7, 0xB6, 0x4F, 0x22, 0xB1, 0xF6, 0x50, 0x9A, 0xC6, 0x16, 0xEF, 0xD7, 0x4A, 0xE1, 0x7F, 0x15, 0x7E, 0x49, 0x02, 0x1E, 0x3D, 0x3E, 0xFC, 0x1F, 0xB0, 0x5E, 0xB3, 0x01, 0x40, 0x3A, 0x91, 0x40, 0x4A, 0xC7, 0xA8, 0x92, 0x90, 0x61, 0xED, 0x35, 0xD5, 0x7F, 0xC4, 0x19, 0x5E, 0xC5, 0x3A, 0x30, 0x26, 0x8F, 0x75, 0x41, 0x7D, 0x15, 0xF8, 0x05, 0x2B, 0x44, 0xEE, 0xF7, 0xD7, 0xC6, 0xCF, 0xBE, 0xAF, 0xB9, 0xE3, 0x5B, 0x75, 0xFC, 0x10, 0xF3, 0xA2, 0x01, 0x7E, 0x4C, 0x23, 0x60, 0x70, 0xBF, 0x7A, 0xA8, 0x7E, 0xED, 0x3D, 0x62, 0x3F, 0x74, 0x13, 0x5D, 0xA8, 0x31, 0xA3, 0x29, 0xB8, 0x0E, 0xEC, 0x3A, 0x36, 0x6D, 0x1F, 0xF3, 0x3C, 0x16, 0xFF, 0xFB, 0xD6, 0x55, 0xD7, 0xC2, 0x2F, 0xA5, 0xEF, 0x7D, 0xD0, 0x07, 0x62, 0xE1, 0x6D, 0x48, 0x7F, 0x75, 0x6C, 0x00, 0x27, 0x5D, 0x42, 0xC6, 0x26, 0xF0, 0x38, 0xAC, 0x2D, 0xBF, 0xB8, 0x1D, 0x0F, 0x91, 0x2B, 0x62, 0xA3, 0x57, 0xF0, 0x00, 0xFC, 0x64, 0x3D, 0x20, 0xF6, 0x93, 0x93, 0xB6, 0xC3, 0x7A, 0x52, 0xF8, 0xF7, 0x79, 0x09, 0x22, 0x36, 0x85, 0x28, 0xFE, 0x11, 0xF4, 0x11, 0xDA, 0x17, 0x8C, 0xC2, 0x6F, 0x1D, 0xF8, 0x16, 0x03, 0x28, 0x3D, 0x72, 0x34, 0x75, 0x9F, 0xAB, 0x27, 0xE6, 0x3C, 0x5F, 0x62, 0xA1, 0x24, 0x19, 0xEF, 0x9F, 0x7B, 0x69, 0x81, 0xEF, 0xD6, 0xF4, 0xE2, 0xAB, 0xA7, 0x11, 0xE6, 0xBD, 0x36, 0x70, 0xE0, 0x8C, 0xB1, 0x7F, 0xBC, 0x12, 0x40, 0xEE, 0x12, 0x12, 0x7E, 0x7E, 0x09, 0x37, 0x4D, 0x9C, 0xA5, 0xE4, 0xCB, 0xF3, 0xAD, 0x47, 0x52, 0x79, 0xEB, 0xB1, 0xF7, 0x90, 0xC8, 0xE1, 0x86, 0x6C, 0x3F, 0xF9, 0xBE, 0xDD, 0x5F, 0xFD, 0x5E, 0x75, 0x81, 0xC4, 0x13, 0x66, 0x1C, 0xC5, 0x12, 0x5F, 0x0B, 0x3E, 0x62, 0x05, 0x27, 0x24, 0x23, 0xB2, 0xCE, 0x06, 0x9B, 0x8B, 0x9F, 0xDC, 0xFB, 0x10, 0xFC, 0x54, 0xFF, 0x70, 0xF7, 0x47, 0x2A, 0x01, 0x94, 0xC0, 0x47, 0x8A, 0xEF, 0x3E, 0xA2, 0x22, 0x74, 0x4A, 0x5E, 0x04, 0x32, 0x56, 0x5A, 0xF7, 0x93, 0xCA, 0xA4, 0x46, 0x84, 0x52, 0xAD, 0xDE, 0x7D, 0x9E, 0xE8, 0x69, 0xDA, 0x50, 0xF5, 0x53, 0x4C, 0xF6, 0x52, 0xAF, 0xC1, 0x57, 0xBF, 0xCF, 0xF5, 0x36, 0x3C, 0xDF, 0xFB, 0xAA, 0x9E, 0x5A, 0xF7, 0xF6, 0xFB, 0x30, 0xD7, 0x83, 0x62, 0x06, 0xC5, 0x13, 0x2B, 0x26, 0x41, 0xD0, 0x88, 0xD3, 0xBD, 0x06, 0xFE, 0x53, 0xED, 0x43, 0x84, 0x2E, 0xAC, 0xEF, 0xD0, 0xC6, 0x03, 0xF4, 0xF1, 0xD4, 0xAE, 0xA0, 0x45, 0x12, 0xBB, 0xF4, 0x61, 0xE1, 0x07, 0xF4, 0x0D, 0xB6, 0x58, 0xFA, 0xA0, 0x88, 0xF7, 0x29, 0x02, 0xFF, 0x08, 0xFA, 0xD2, 0xE1, 0x89, 0x7C, 0x00, 0xBE, 0x61, 0x9B, 0x37, 0xD3, 0x84, 0xA7, 0x5A, 0xC8, 0xE9, 0x42, 0xD3, 0x43, 0x6E, 0x84, 0x3D, 0xDB, 0x10, 0x50, 0xEF, 0xCB, 0x8F, 0xF3, 0x71, 0x7B, 0xAA, 0x73, 0xB8, 0x10, 0xA9, 0x58, 0x07, 0x7F, 0x2C, 0xCF, 0xB5, 0x11, 0x0F, 0x4F, 0x45, 0xE8, 0x24, 0x1E, 0xFC, 0xFB, 0x85, 0xE7, 0x25, 0x6F, 0x84, 0x1F, 0xFF, 0x6A, 0x34, 0x09, 0x60, 0xE8, 0x0B, 0x32, 0xA6, 0x2D, 0xAE, 0x7D, 0x77, 0xDC, 0x71, 0xF8, 0xBF, 0x66, 0x2A, 0x00, 0x67, 0x00, 0xF1, 0x15, 0xB4, 0x24, 0xD0, 0xB8, 0x44, 0xA7, 0xCB, 0x81, 0x9F, 0x13, 0xFD, 0x67, 0x53, 0x0F, 0x31, 0x36, 0x61, 0x50, 0x79, 0xEF, 0xD8, 0x53, 0xCA, 0xB2, 0x99, 0x05, 0xED, 0x70, 0x5E, 0xD7, 0x33, 0x58, 0x2B, 0x0B, 0xD4, 0x6B, 0x3F, 0x1E, 0xEC, 0x63, 0xA3, 0x43, 0xAE, 0x14, 0x72, 0x52, 0x94, 0xAD, 0xB8, 0xB4, 0x22, 0xFE, 0x31, 0xF4, 0x91, 0xBA, 0x27, 0x09, 0x35, 0xC2, 0x83, 0xFF, 0x98, 0xD9, 0x20, 0x35, 0xBE, 0x99, 0xA1, 0x26, 0xFB, 0x7E, 0x3E, 0x18, 0xD4, 0x39, 0x85, 0x02, 0xBB, 0x5F, 0xA6, 0x0E, 0xA9, 0xA2, 0xC1, 0x51, 0x20, 0xD6, 0x6A, 0xE0, 0xB6, 0xA2, 0xB8, 0xBF, 0x2F, 0x48, 0x23, 0x0D, 0x3F, 0xF4, 0x7E, 0x08, 0x7E, 0x81, 0x28, 0x29, 0x4F, 0x72, 0xE5, 0xE2, 0xD0, 0xA8, 0x8B, 0x79, 0x74, 0xE1, 0x13, 0x44, 0x8E, 0xB4, 0x7E, 0x86, 0x3A, 0x91, 0xF7, 0xC4, 0xD2, 0xA7, 0xA8, 0x56, 0x6F, 0x9C, 0xBE, 0x22, 0xE1, 0x2D, 0x1B, 0xEE, 0xD4, 0xF3, 0xD3, 0x63, 0x73, 0xFB, 0x6A, 0x55, 0x9B, 0xDB, 0x5B, 0x9E, 0xF7, 0xB5, 0xBF, 0x68, 0x30, 0xEA, 0x5E, 0x0A, 0x7D, 0x96, 0x5E, 0xBB, 0xC0, 0xD7, 0xA7, 0x86, 0x26, 0x66, 0x52, 0xE2, 0xD9, 0xD4, 0x46, 0x35, 0xF5, 0xC0, 0x1F, 0x64, 0xE3, 0xC7, 0x3F, 0x6E, 0xFC, 0x89, 0x21, 0xED, 0xF9, 0x77, 0x9E, 0xC6, 0xE8, 0x27, 0x5D, 0xEF, 0xEB, 0x9F, 0x46, 0xDF, 0x74, 0x1A, 0xFF, 0x8D, 0x1C, 0xCF, 0x1D, 0x59, 0x66, 0x96, 0x3E, 0xDE, 0x44, 0xD2, 0x07, 0x95, 0xF8, 0xE1, 0x3D, 0x1F, 0x34, 0xFC, 0x10, 0xB9, 0x72, 0x84, 0xF0, 0x43, 0x40, 0xAF, 0xB7, 0xF1, 0xA9, 0xA5, 0xB7, 0xD0, 0xE0, 0x13, 0xEB, 0x98, 0x3D, 0xD0, 0xF0, 0x6B, 0xD0, 0x87, 0x0D, 0xDF, 0xA6, 0x87, 0x08, 0x7D, 0x81, 0xFC, 0x2E, 0x26, 0x01, 0xFC, 0x46, 0xA4, 0x04, 0x0B, 0xBB, 0x4C, 0xE5, 0xCA, 0xA0, 0x44, 0x39, 0x75, 0xB6, 0xB8, 0xF1, 0x3C, 0xB1, 0xEE, 0x69, 0x46, 0x48, 0x00, 0xD1, 0x9E, 0x27, 0x91, 0xF7, 0x25, 0x49, 0x1A, 0xCF, 0x6B, 0xEF, 0xAB, 0x7E, 0xB0, 0xAF, 0xF2, 0xC2, 0x57, 0x13, 0x4E, 0xD4, 0x8C, 0x1C, 0x8D, 0x72, 0x00, 0x07, 0xF8, 0x2B, 0xEC, 0xE0, 0xA6, 0x46, 0x36, 0xFC, 0x44, 0xBD, 0x41, 0x5E, 0x39, 0xA1, 0x8C, 0xEC, 0xDF, 0x20, 0xDB, 0xE7, 0x0C, 0x63, 0x0B, 0xD3, 0xA9, 0x55, 0x23, 0x67, 0x20, 0xEC, 0xDF, 0x8E, 0xD5, 0x6F, 0xF8, 0xF3, 0xAC, 0xED, 0x0D, 0xBF, 0x17, 0xBF, 0xC3, 0x0C, 0x67, 0x07, 0x74, 0xAE, 0xE7, 0xCF, 0x4F, 0xBF, 0xCB, 0xF7, 0x09, 0x7F, 0x5E, 0x87, 0xAF, 0xD5, 0xF3, 0x2B, 0x1D, 0xAC, 0xF6, 0x07, 0xD6, 0x3E, 0x35, 0xDA, 0x57, 0xF5, 0xFC, 0xF9, 0x8D, 0x7C, 0x5F, 0xE9, 0x78, 0x0A, 0xBE, 0x22, 0x17, 0x57, 0xEC, 0x1D, 0xA5, 0xAA, 0x34, 0x51, 0xA1, 0xB2, 0x09, 0x2A, 0x9D, 0x72, 0x3E, 0x29, 0x77, 0xC6, 0x0F, 0xCD, 0xC0, 0x67, 0x2E, 0xFE, 0x57, 0x3C, 0x6F, 0x64, 0x5A, 0x36, 0xE9, 0xC3, 0x67, 0xA0, 0xE3, 0x78, 0x9F, 0xA6, 0xDB, 0x46, 0x8C, 0xE7, 0x85, 0x66, 0x26, 0x5E, 0xC6, 0x7F, 0xBA, 0xDF, 0x52, 0x5E, 0x3F, 0x8D, 0x1B, 0xC7, 0xFF, 0x4E, 0x8E, 0xFF, 0x6E, 0xC6, 0xCF, 0xF4, 0xBC, 0x83, 0x1F, 0x0B, 0x7F, 0x7E, 0xFA, 0x58, 0xE8, 0x67, 0x86, 0x4F, 0x25, 0x7C, 0xE2, 0xE2, 0x9F, 0x88, 0x7A, 0xFE, 0xDC, 0x34, 0x4F, 0x0C, 0xFA, 0x92, 0xF8, 0x0F, 0xD2, 0xDF, 0x4C, 0xD7, 0x53, 0x14, 0x3D, 0xFF, 0x9D, 0xFC, 0xF0, 0xC3, 0x8F, 0xB4, 0x4C, 0x0B, 0xF2, 0x3C, 0xEF, 0xF8, 0x97, 0xF7, 0x99, 0xF1, 0x34, 0xEE, 0xE4, 0xA2, 0x01, 0x3B, 0xC4, 0xEB, 0xDF, 0xFE, 0x12, 0x6E, 0xEE, 0xF8, 0xA0, 0x6E, 0xD8, 0xE0, 0x6D, 0xD8, 0xA4, 0xDA, 0x69, 0xEB, 0xDF, 0x30, 0x4D, 0x10, 0x5D, 0xE2, 0x98, 0xAD, 0xC5, 0x0B, 0x11, 0x81, 0x66, 0xB0, 0x9B, 0xD9, 0x39, 0xA1, 0xCE, 0x1A, 0xB4, 0x24, 0x5B, 0x91, 0x86, 0x1C, 0x6D, 0x0D, 0x9B, 0xD7, 0x5D, 0x29, 0xD7, 0x51, 0x02, 0xDE, 0xF7, 0x41, 0x6B, 0x1F, 0x24, 0xD9, 0xD9, 0x6B, 0x1E, 0x55, 0x29, 0xD9, 0x25, 0x7C, 0xA2, 0xAD, 0xF9, 0xA3, 0xFC, 0x22, 0xC1, 0x28, 0xD8, 0xB7, 0xBE, 0x7C, 0xF3, 0xAB, 0x19, 0x4C, 0x28, 0xDE, 0xA6, 0x25, 0x7E, 0xE0, 0x50, 0xF0, 0x19, 0x53, 0xA4, 0x0C, 0xE7, 0xAF, 0x7D, 0xF3, 0x0F, 0x8C, 0xF9, 0xB3, 0xB1, 0x18, 0xD9, 0x14, 0x19, 0xD8, 0xB4, 0x1B, 0x77, 0x8B, 0xA4, 0x66, 0xC9, 0xD9, 0x6A, 0x71, 0xD0, 0xF1, 0xA7, 0x8F, 0x14, 0xD1, 0xF0, 0x37, 0xE1, 0xDF, 0xA4, 0x8F, 0x21, 0x81, 0x7F, 0x01, 0x5F, 0x36, 0xAE, 0xC3, 0x27, 0x3A, 0x3D, 0x0A, 0x66, 0xCE, 0xEB, 0xC7, 0x24, 0xFC, 0xC1, 0xD3, 0xBF, 0x91, 0x4E, 0xD3, 0x7F, 0x6E, 0xFF, 0x47, 0xC1, 0x00, 0x22, 0xCA, 0xE9, 0xD1, 0xDC, 0xA7, 0x74, 0x4E, 0x8A, 0xF4, 0xF1, 0x4F, 0x30, 0xC4, 0x34, 0x1F, 0x06, 0x78, 0xEB, 0xF1, 0xBB, 0xB0, 0x19, 0x27, 0xCB, 0xF9, 0xC0, 0x57, 0x7B, 0xE2, 0x73, 0x1F, 0x9A, 0x4A, 0x0F, 0x9D, 0xA7, 0x9F, 0x94, 0x12, 0x0C, 0x95, 0x24, 0x92, 0x7D, 0x45, 0x22, 0xC6, 0xAE, 0x57, 0xBF, 0x0C, 0x81, 0x7A, 0xB3, 0x7D, 0x98, 0xDF, 0x59, 0xDA, 0x37, 0x09, 0xC5, 0xD6, 0x7F, 0xA9, 0x5A, 0x9D, 0x04, 0x01, 0x48, 0xE6, 0xC2, 0x88, 0xFB, 0xD5, 0xF6, 0x0A, 0x5E, 0xBE, 0xFD, 0x6B, 0xA9, 0x03, 0x63, 0xDD, 0x6E, 0xC7, 0x4A, 0x1F, 0x71, 0xE5, 0xDD, 0x1C, 0x0D, 0x39, 0xEE, 0xC3, 0x0D, 0x78, 0xF3, 0xD1, 0x7F, 0x83, 0x9F, 0xD0, 0x0B, 0xB8, 0x62, 0x95, 0x17, 0xAC, 0x6A, 0x4B, 0x68, 0xD0, 0x28, 0xE9, 0xC5, 0x8F, 0x96, 0x58, 0xA6, 0x84, 0x3E, 0x40, 0x5B, 0x62, 0x86, 0x99, 0x31, 0x84, 0x3D, 0x0A, 0x36, 0x7C, 0x5B, 0x95, 0xB3, 0xFB, 0x07, 0x16, 0x7D, 0x8D, 0x84, 0x1A, 0x06, 0x6F, 0x29, 0x01, 0xAC, 0x0D, 0xD4, 0x69, 0x72, 0x7E, 0x57, 0xA5, 0x7B, 0x8F, 0x6D, 0x83, 0x4C, 0x4A, 0xC0, 0x86, 0x89, 0x57, 0xF7, 0x9E, 0x3C, 0x14, 0x62, 0x17, 0xA5, 0xA6, 0x76, 0x19, 0x72, 0x90, 0x35, 0xF4, 0x4E, 0xA3, 0xEA, 0x73, 0x43, 0xA4, 0x42, 0xDB, 0x64, 0x46, 0x11, 0x7E, 0xBC, 0x83, 0xE7, 0x0F, 0x7E, 0x2D, 0x57, 0x8D, 0x31, 0xB1, 0xA8, 0x1E, 0x0B, 0x3E, 0x4B, 0xF1, 0xAF, 0x8D, 0x81, 0x92, 0xAE, 0xC6, 0x01, 0xEE, 0x3C, 0xFD, 0x25, 0xDC, 0x10, 0x6A, 0x14, 0x41, 0x8D, 0x73, 0x4D, 0xFC, 0xB4, 0xC6, 0x3F, 0x06, 0x3E, 0x63, 0x00, 0x3F, 0x50, 0xCC, 0xBA, 0xE9, 0x64, 0xF2, 0x2A, 0xAA, 0xD7, 0x44, 0xA4, 0xA2, 0xFA, 0x44, 0x22, 0xA2, 0x94, 0x65, 0x5C, 0xFF, 0x74, 0x26, 0xEE, 0x11, 0x26, 0xEE, 0xDD, 0x7B, 0xF2, 0x1E, 0xD3, 0xEF, 0x14, 0x01, 0x50, 0x94, 0xFD, 0xF8, 0x14, 0x0A, 0x45, 0xAC, 0xDF, 0x23, 0xDD, 0xC2, 0x8B, 0x07, 0xFF, 0x24, 0x15, 0x7E, 0x1A, 0xC9, 0x03, 0xA0, 0xC6, 0x77, 0x2D, 0x7E, 0xD6, 0xE2, 0x5F, 0x31, 0x6A, 0xEA, 0x67, 0x6E, 0xA8, 0x44, 0x55, 0x13, 0x66, 0x07, 0xA6, 0xEE, 0xF1, 0xB5, 0xF7, 0xDE, 0xE3, 0x87, 0x70, 0x93, 0xA9, 0x02, 0xBB, 0xC1, 0xDF, 0x76, 0xCA, 0x25, 0x7D, 0xF2, 0x6E, 0x40, 0x2E, 0x01, 0x28, 0xC3, 0x5B, 0xD0, 0xDF, 0x00, 0x34, 0x42, 0x51, 0x08, 0x7F, 0x58, 0xEC, 0xFD, 0xEA, 0xA7, 0xEB, 0x20, 0x27, 0x08, 0x99, 0xCC, 0x80, 0x77, 0x9E, 0x30, 0x15, 0x40, 0x58, 0xBE, 0xF4, 0xBC, 0x81, 0xF9, 0x43, 0x00, 0x34, 0xE2, 0x7F, 0x6E, 0x50, 0x6F, 0x0F, 0x11, 0xA1, 0x08, 0x8D, 0xD8, 0x88, 0x78, 0x1C, 0x60, 0x37, 0x6E, 0xE1, 0x9B, 0xB7, 0xBF, 0xF4, 0x1C, 0xA5, 0x65, 0xF5, 0xC4, 0x0E, 0x0E, 0xC8, 0x3D, 0xFD, 0x09, 0xE8, 0x0A, 0x75, 0xBD, 0x89, 0x3F, 0x94, 0xBD, 0x36, 0x88, 0xF7, 0x38, 0xFE, 0x2F, 0xA6, 0xB5, 0x70, 0x89, 0x1F, 0x71, 0xCC, 0x59, 0x64, 0x0E, 0xA4, 0x29, 0xF9, 0xC4, 0x16, 0xF4, 0xE3, 0x7F, 0x5F, 0x99, 0x2E, 0xF1, 0xF4, 0x45, 0x7E, 0xFC, 0xF1, 0x47, 0x13, 0xB5, 0x76, 0xC6, 0x10, 0xBA, 0xCC, 0x0D, 0xEC, 0x36, 0xEE, 0x25, 0x5F, 0x81, 0xE6, 0x4F, 0x83, 0xF0, 0x36, 0x72, 0x23, 0xBF, 0x41, 0x81, 0x94, 0xE7, 0x7D, 0x3F, 0xB0, 0x19, 0x86, 0xC8, 0xD1, 0x18, 0xE5, 0x0E, 0xBC, 0x7B, 0x4F, 0x3E, 0x98, 0xDC, 0x81, 0x7A, 0x36, 0x64, 0xC7, 0xDD, 0xE8, 0x0F, 0x80, 0x32, 0x57, 0x07, 0x3B, 0x9B, 0x2E, 0x45, 0x89, 0x71, 0x3E, 0x01, 0x1B, 0x12, 0x56, 0x90, 0x98, 0x68, 0x1F, 0x92, 0xE5, 0x88, 0x15, 0x75, 0xC3, 0x27, 0xC0, 0xAB, 0xDD, 0x2B, 0xF8, 0xE7, 0xB7, 0x7F, 0x2D, 0x5D, 0x9A, 0xA3, 0xE1, 0x12, 0xA4, 0x0D, 0xF0, 0x53, 0x8A, 0xFF, 0x10, 0x3D, 0xA1, 0xB5, 0x54, 0x03, 0xFF, 0x74, 0xFE, 0x7E, 0x6E, 0x10, 0xBB, 0xF7, 0xE4, 0x7D, 0xB6, 0x00, 0xC0, 0xCC, 0x00, 0xE6, 0x08, 0x39, 0x43, 0x1A, 0xF1, 0x65, 0x1F, 0x8E, 0xE1, 0x7F, 0xA9, 0x1F, 0xA5, 0xC7, 0x08, 0x20, 0x95, 0x8B, 0x58, 0x73, 0xBC, 0x7A, 0x33, 0xDF, 0x9B, 0xFA, 0x3C, 0x89, 0xD2, 0x87, 0x8F, 0xFE, 0x4C, 0xC7, 0xEE, 0x3C, 0x27, 0x7F, 0xF8, 0xF1, 0x07, 0x6A, 0xAE, 0x76, 0xCB, 0x44, 0xF0, 0x27, 0xC4, 0xB5, 0x44, 0xA5, 0x58, 0x80, 0x82, 0x87, 0x16, 0xED, 0x04, 0xBD, 0x76, 0x22, 0x13, 0x8D, 0x09, 0xE3, 0xE1, 0xC7, 0x6C, 0x40, 0x9E, 0x5C, 0x0F, 0x93, 0x85, 0x97, 0xAD, 0x80, 0xBB, 0x11, 0xEE, 0x3F, 0x7F, 0x1F, 0xB6, 0x94, 0x1B, 0x80, 0xCC, 0x15, 0x20, 0xBA, 0xF8, 0xA0, 0x0F, 0x6F, 0xF4, 0xAC, 0x4E, 0xBE, 0x3C, 0xFE, 0x21, 0x39, 0x1D, 0x02, 0xAC, 0x1B, 0x02, 0xF0, 0x9D, 0xE3, 0xA3, 0x89, 0x77, 0x31, 0x9F, 0x1E, 0xB9, 0x60, 0xFF, 0x6D, 0xE1, 0xD1, 0x83, 0xCF, 0xE0, 0x06, 0xD1, 0xBD, 0x1D, 0x8B, 0x27, 0x61, 0xC6, 0xB7, 0x2D, 0x72, 0x63, 0x0E, 0xC9, 0x88, 0xD5, 0xDB, 0xF8, 0x0E, 0xE1, 0x3F, 0x05, 0xBF, 0xC0, 0x19, 0xA0, 0x40, 0x5E, 0x30, 0x15, 0xE0, 0x2F, 0xBB, 0x1D, 0xC3, 0xFF, 0x7B, 0x93, 0x4A, 0x40, 0x75, 0x7B, 0x3C, 0x35, 0xCF, 0x19, 0xA0, 0x34, 0x8E, 0xDF, 0xD4, 0x36, 0x64, 0x08, 0xE9, 0x11, 0x9E, 0xF7, 0x43, 0xCB, 0x4C, 0xE8, 0x1C, 0x84, 0xAC, 0xF7, 0xDD, 0xC1, 0x23, 0x3F, 0xFE, 0xF0, 0x03, 0x2D, 0x10, 0xEC, 0x56, 0x27, 0x86, 0xCD, 0x15, 0xFC, 0xCA, 0xDA, 0x73, 0x47, 0x65, 0x66, 0x00, 0xC3, 0x05, 0x1B, 0xBB, 0x1D, 0xD3, 0x01, 0xDF, 0x35, 0x09, 0x80, 0x82, 0xC1, 0xCF, 0x31, 0x87, 0xB1, 0xC4, 0x57, 0xF4, 0x85, 0x8A, 0x43, 0xF5, 0xA6, 0xA5, 0x37, 0xDF, 0xC4, 0x46, 0x73, 0xC7, 0x5B, 0x00, 0xE5, 0x93, 0x7E, 0x07, 0xCF, 0xDE, 0xFA, 0x12, 0x36, 0x17, 0x6C, 0x35, 0xDC, 0xED, 0xD6, 0xE9, 0x92, 0x50, 0x37, 0x94, 0xB6, 0x55, 0x62, 0x68, 0xE5, 0x09, 0xB8, 0xD8, 0xDC, 0x84, 0x2B, 0x7A, 0x05, 0xF7, 0x1E, 0xBD, 0x2B, 0x7C, 0xF3, 0x62, 0x3C, 0xC4, 0x64, 0xA2, 0x66, 0x9A, 0x48, 0xA2, 0x24, 0x03, 0x5A, 0x74, 0x18, 0x4F, 0x9A, 0x7E, 0xD6, 0xE3, 0x3F, 0x05, 0x5F, 0xA7, 0x3F, 0x07, 0xDE, 0xAB, 0x57, 0xAF, 0x66, 0x92, 0x5F, 0x6C, 0x01, 0xB6, 0xCC, 0x6E, 0xD7, 0xEB, 0xBA, 0x61, 0xF8, 0x3E, 0xF9, 0x7C, 0xD1, 0xF2, 0x91, 0x7B, 0x1A, 0x6B, 0xE0, 0xE4, 0x14, 0xE9, 0xF6, 0x7B, 0xFD, 0xF2, 0x7D, 0x20, 0xC2, 0x07, 0xAC, 0xD5, 0xCF, 0xA2, 0xA9, 0x15, 0x74, 0x92, 0xBC, 0xAA, 0x60, 0x0D, 0x64, 0xBE, 0x93, 0x10, 0xFC, 0x60, 0x9E, 0x0A, 0xF3, 0x79, 0x2F, 0x33, 0x22, 0xE6, 0x86, 0xA2, 0xD9, 0xED, 0x25, 0x83, 0xB9, 0x40, 0xE2, 0x64, 0xC7, 0x3E, 0x98, 0xB0, 0x09, 0xF0, 0xE2, 0xD6, 0xE7, 0x30, 0x08, 0x03, 0xD8, 0x38, 0x37, 0x38, 0x0B, 0x90, 0xBA, 0xB8, 0xE6, 0x3D, 0x56, 0x06, 0x3C, 0x1B, 0x07, 0x02, 0xE7, 0x21, 0x44, 0xD5, 0x75, 0xEA, 0x8A, 0x87, 0x68, 0xF8, 0x48, 0x71, 0xC3, 0xC2, 0x3F, 0x91, 0xEA, 0xCE, 0xEB, 0x97, 0x1F, 0x88, 0x60, 0x9C, 0xE9, 0x07, 0x3E, 0x26, 0xA3, 0xB6, 0x30, 0x9B, 0x93, 0x13, 0xE3, 0x0F, 0x41, 0x05, 0xAF, 0x17, 0xE7, 0x59, 0x41, 0xF6, 0x87, 0x84, 0x8F, 0x85, 0x70, 0x66, 0xC4, 0xAB, 0xBF, 0xBC, 0xA2, 0x32, 0x28, 0xCE, 0x3B, 0x71, 0xF0, 0x2B, 0x3B, 0x09, 0xBA, 0xDD, 0x7C, 0xBA, 0x8E, 0x5B, 0xAF, 0xFB, 0xB2, 0x17, 0xC2, 0x70, 0xEF, 0x4D, 0x5D, 0xD7, 0x0D, 0x26, 0xB6, 0x83, 0x27, 0xFC, 0x24, 0x31, 0xCA, 0x9B, 0x07, 0x97, 0xFF, 0x5D, 0x44, 0x44, 0x05, 0x75, 0x46, 0xCD, 0x6F, 0x6C, 0xEA, 0x63, 0xF5, 0x22, 0xE5, 0x31, 0xEA, 0xAC, 0x1D, 0xDE, 0x4A, 0x32, 0xEB, 0x6D, 0xB8, 0x3C, 0xCA, 0xEC, 0xC6, 0x48, 0xE1, 0xF1, 0x6B, 0x9F, 0x8A, 0xA8, 0x32, 0x3D, 0x6C, 0x98, 0x46, 0xB1, 0x6C, 0x89, 0xCA, 0xA5, 0x7B, 0x32, 0x1A, 0xD5, 0x93, 0xA4, 0x2D, 0x64, 0xF9, 0x95, 0xDB, 0x3E, 0xEE, 0x5F, 0x7E, 0x34, 0x79, 0x80, 0x66, 0xE3, 0x9F, 0xA1, 0x29, 0xA3, 0x77, 0xBE, 0xA4, 0xF6, 0x3E, 0xE6, 0xE0, 0x3F, 0xF5, 0x7E, 0x12, 0xBE, 0x7D, 0x98, 0x56, 0xAC, 0xBD, 0x45, 0x02, 0xB8, 0x46, 0x45, 0x2E, 0x34, 0x5C, 0x02, 0xB8, 0xFB, 0xDD, 0xAF, 0xD8, 0x04, 0x60, 0xEA, 0xC0, 0x38, 0x2E, 0x71, 0xDA, 0xBA, 0xE1, 0x0C, 0xA8, 0x67, 0xDF, 0x99, 0xB9, 0x02, 0x15, 0xD7, 0x1B, 0xA2, 0x59, 0x41, 0xC0, 0x4B, 0x60, 0x05, 0x34, 0xE1, 0xD9, 0x88, 0x9F, 0x96, 0x86, 0x51, 0x06, 0x11, 0x3F, 0xBD, 0xFD, 0xF1, 0x62, 0x00, 0x05, 0xEA, 0xCD, 0xA2, 0x7D, 0xA6, 0x24, 0x20, 0xC4, 0xFE, 0x3B, 0xDF, 0x7D, 0xC0, 0x54, 0x80, 0xCD, 0x1C, 0xD0, 0xA3, 0x6F, 0xBB, 0x0D, 0x8D, 0x1F, 0x1A, 0x5F, 0x48, 0xFC, 0xAF, 0xBD, 0x5F, 0x43, 0x5F, 0x0E, 0x03, 0x68, 0x79, 0x88, 0x4C, 0x7C, 0x6B, 0x49, 0xD8, 0xFA, 0x5D, 0x74, 0x0E, 0x65, 0x62, 0x25, 0xA6, 0x4C, 0xDC, 0x1B, 0xB8, 0x15, 0xF8, 0xBB, 0x8F, 0xE4, 0xBE, 0x00, 0xB5, 0x3B, 0x8C, 0x06, 0xD6, 0xBB, 0xF0, 0x91, 0x55, 0xD4, 0xD9, 0x9A, 0x4C, 0xAB, 0xD6, 0xE7, 0xEE, 0x8B, 0x0F, 0x1E, 0xA3, 0xA8, 0x31, 0x80, 0xE9, 0x33, 0x46, 0x78, 0x76, 0xFB, 0x33, 0xC6, 0x00, 0xE9, 0xEC, 0x5F, 0x37, 0xA0, 0x5A, 0xEE, 0xC5, 0xD0, 0xB9, 0xAC, 0x39, 0x41, 0x49, 0xA5, 0xF7, 0xA5, 0xF0, 0xC2, 0x7A, 0xFB, 0xA4, 0xA2, 0xDE, 0xBB, 0xFC, 0x50, 0xEE, 0x21, 0x01, 0xD7, 0x02, 0x19, 0x5C, 0x49, 0xF3, 0xF0, 0x15, 0x7C, 0xDE, 0x71, 0xAF, 0x96, 0xB9, 0x5A, 0xE2, 0xFD, 0x71, 0x17, 0x04, 0x63, 0x14, 0xAE, 0xA3, 0x04, 0x40, 0xA4, 0xF8, 0xC7, 0xAF, 0x77, 0xBF, 0xFB, 0x90, 0x11, 0xF9, 0xA0, 0x21, 0xDE, 0xCC, 0xC4, 0x42, 0x3C, 0xCA, 0x94, 0x3B, 0xC1, 0x42, 0x7B, 0x2D, 0x5B, 0xD5, 0xDB, 0x14, 0xBE, 0x3C, 0xBF, 0x6C, 0xCC, 0xD2, 0x76, 0x94, 0x81, 0xB9, 0x51, 0x0B, 0xC4, 0xC6, 0x94, 0xC9, 0xF5, 0xF7, 0xFC, 0xD6, 0x27, 0x32, 0x12, 0x72, 0xBC, 0x36, 0x9B, 0xE2, 0x89, 0x66, 0x6F, 0xE0, 0xF8, 0x17, 0x36, 0x00, 0x4A, 0xDD, 0x84, 0x29, 0x06, 0xBE, 0x69, 0xD0, 0xC2, 0x90, 0x3C, 0x80, 0x24, 0x84, 0x4F, 0x2C, 0x7E, 0x35, 0xFA, 0x33, 0x8E, 0xB4, 0xAC, 0x40, 0x3F, 0xE4, 0x4A, 0x32, 0x00, 0x4C, 0x28, 0x61, 0x83, 0x23, 0x1D, 0xDA, 0xA8, 0x87, 0x88, 0xFE, 0x8D, 0x32, 0x10, 0xE8, 0x2E, 0x5B, 0x01, 0x0C, 0xEE, 0xE8, 0x6C, 0xE5, 0x55, 0xF7, 0xFC, 0x66, 0xD4, 0x0E, 0xD3, 0x84, 0x03, 0x5F, 0x7D, 0x29, 0xA2, 0x16, 0x3F, 0xB9, 0x91, 0x51, 0xCA, 0x27, 0x01, 0xF0, 0xE9, 0x3F, 0x5E, 0xC1, 0x37, 0xAF, 0x7D, 0xB1, 0x44, 0x02, 0x62, 0x75, 0xCA, 0xD6, 0xFB, 0x80, 0xB0, 0xF4, 0x81, 0x4A, 0x7A, 0x1A, 0x9E, 0xB4, 0x7C, 0x7C, 0x38, 0xFE, 0x81, 0x1A, 0xE6, 0x52, 0x27, 0x55, 0x1A, 0x35, 0x32, 0x06, 0x15, 0x58, 0x03, 0x8F, 0xF8, 0x6A, 0x48, 0x00, 0x41, 0xBC, 0xE5, 0x9E, 0xC0, 0x94, 0x62, 0x48, 0x48, 0x9F, 0x4F, 0x2E, 0x03, 0x0D, 0x9E, 0x58, 0xE5, 0x71, 0x03, 0x4E, 0x81, 0x40, 0xDC, 0x06, 0xC0, 0xAD, 0xC0, 0x9B, 0x59, 0xF4, 0x9F, 0xF6, 0x52, 0x83, 0x15, 0x08, 0x15, 0x31, 0xD7, 0x82, 0x7D, 0xDA, 0xAE, 0xD7, 0x2C, 0x1F, 0xD9, 0xE3, 0xEA, 0xAB, 0x2F, 0x7F, 0x5F, 0x89, 0xB3, 0x6A, 0x8B, 0xB4, 0xCB, 0x10, 0x16, 0x1B, 0x00, 0xDF, 0x12, 0xF5, 0xFC, 0xF6, 0xA7, 0xF2, 0xF5, 0x31, 0x8D, 0xA7, 0x14, 0xDA, 0x12, 0xE3, 0x1F, 0x3C, 0x53, 0x36, 0xB5, 0x80, 0x22, 0xE9, 0x0D, 0xD3, 0x6F, 0xA2, 0xFD, 0x8F, 0x2F, 0x01, 0x77, 0x2E, 0xDF, 0x17, 0xF8, 0x9F, 0x45, 0x65, 0x5F, 0xAE, 0x44, 0x52, 0x1B, 0xBF, 0xED, 0xF0, 0x9F, 0x5B, 0x3F, 0x4B, 0x00, 0xE7, 0x23, 0xDB, 0xC7, 0x25, 0x80, 0xF9, 0xB1, 0x81, 0x8B, 0x7D, 0x3B, 0xA6, 0x03, 0x7E, 0x34, 0x19, 0x81, 0x34, 0x02, 0xA0, 0x72, 0xE0, 0x88, 0x71, 0x7C, 0x73, 0xC8, 0x64, 0x4B, 0xC2, 0x79, 0xB4, 0x9C, 0x95, 0x2A, 0x51, 0x6F, 0x27, 0xA2, 0xD3, 0x33, 0x93, 0x58, 0x2B, 0xBC, 0x89, 0x60, 0xEA, 0x3F, 0x3E, 0xDD, 0xE9, 0x9F, 0xC6, 0xAF, 0x84, 0x6B, 0x70, 0x0B, 0x2F, 0x6E, 0x7F, 0x21, 0x25, 0x1B, 0xBF, 0x6F, 0x85, 0x94, 0xAC, 0xE8, 0xC8, 0x95, 0xF9, 0x10, 0x85, 0x6A, 0x06, 0x40, 0xFE, 0xDD, 0x6F, 0x08, 0x09, 0x60, 0xD0, 0xA2, 0x5D, 0xA9, 0xB5, 0xEC, 0x5B, 0xD1, 0x4A, 0xE0, 0x24, 0xE0, 0x0B, 0xE3, 0xC3, 0x39, 0x7E, 0x1D, 0x22, 0xEF, 0x07, 0xE0, 0x1B, 0x49, 0x4A, 0x43, 0xF8, 0x0F, 0xD1, 0x8F, 0xFD, 0xE1, 0xD4, 0xE9, 0xDF, 0xB5, 0xB3, 0x01, 0x10, 0x5D, 0xAC, 0x63, 0x44, 0x70, 0xF7, 0xF2, 0x03, 0x36, 0xD1, 0x37, 0x13, 0xE7, 0x57, 0x46, 0x40, 0x11, 0x27, 0x3E, 0x1A, 0x49, 0x59, 0xAB, 0x9E, 0x61, 0x59, 0xEB, 0xCC, 0x4C, 0xCF, 0xFB, 0x4B, 0x52, 0x95, 0x50, 0xD2, 0x63, 0x2A, 0x43, 0x54, 0xA7, 0x94, 0x10, 0xCF, 0x6F, 0x7D, 0x2A, 0x72, 0x03, 0xF0, 0xA0, 0xA8, 0xD2, 0x7D, 0x15, 0xA7, 0x82, 0x79, 0x23, 0xE3, 0xA4, 0x98, 0x07, 0x93, 0x17, 0x40, 0x48, 0x00, 0x94, 0x1A, 0x0E, 0x5F, 0xD7, 0x0B, 0x10, 0xB1, 0x01, 0xEC, 0x8B, 0x3E, 0x6A, 0x9F, 0xB9, 0xAA, 0x18, 0x40, 0xAE, 0x27, 0x37, 0xA7, 0xDD, 0x14, 0x27, 0x4E, 0x9D, 0xEC, 0x96, 0x7B, 0x32, 0x60, 0x2A, 0x0B, 0x9C, 0xB1, 0x1D, 0x98, 0xFD, 0x79, 0xE7, 0xF2, 0x57, 0x33, 0x03, 0x70, 0x42, 0x81, 0xED, 0x15, 0xB0, 0xF0, 0x70, 0xDA, 0xFD, 0xD6, 0x2F, 0x39, 0x03, 0xF4, 0x6C, 0x4A, 0xB6, 0x0D, 0x40, 0xC4, 0xFD, 0x31, 0x09, 0xE0, 0x1B, 0x21, 0x01, 0x4C, 0x1E, 0x01, 0x00, 0xA5, 0xEB, 0xC6, 0x53, 0xB5, 0xC5, 0xE8, 0xC1, 0x18, 0xEB, 0x48, 0xFF, 0x73, 0xED, 0x49, 0xB9, 0x27, 0x01, 0xBA, 0xFA, 0xFF, 0x22, 0xDB, 0xA8, 0x05, 0x80, 0x2B, 0x41, 0x77, 0x19, 0xFE, 0xC5, 0x5F, 0x7A, 0x56, 0x65, 0xF0, 0x25, 0x30, 0xA3, 0x65, 0xAB, 0x4D, 0x0D, 0xFC, 0x96, 0x4A, 0x54, 0x88, 0xFA, 0xEB, 0x29, 0x01, 0x10, 0xE9, 0x05, 0xE0, 0x36, 0x00, 0xAE, 0x03, 0x0E, 0x37, 0xA6, 0x38, 0x80, 0xA0, 0x0D, 0x00, 0xCB, 0x51, 0xB1, 0x47, 0x9D, 0xD5, 0xBE, 0x92, 0x80, 0x0D, 0x80, 0xB8, 0x12, 0x80, 0x7C, 0x6E, 0x94, 0x3B, 0xC7, 0xB8, 0x0D, 0x60, 0x4A, 0x2F, 0xA6, 0x47, 0x02, 0x9E, 0x58, 0x06, 0xE3, 0x02, 0xFC, 0x4F, 0x1E, 0x1E, 0x02, 0xAF, 0x7F, 0xF7, 0xBE, 0x50, 0x01, 0x17, 0x29, 0x39, 0xC2, 0x00, 0x8A, 0x8F, 0x2E, 0x3B, 0xDE, 0xA3, 0xD3, 0x92, 0x5E, 0x00, 0xD4, 0x4A, 0x6B, 0xBB, 0x27, 0x56, 0xAC, 0xE0, 0xB5, 0xDE, 0x4F, 0xC2, 0x25, 0xD3, 0x04, 0xB8, 0x77, 0x39, 0x05, 0x02, 0x2D, 0x19, 0x41, 0xD6, 0x30, 0x80, 0x56, 0x04, 0x92, 0x53, 0xEF, 0x37, 0x0A, 0xDA, 0xDE, 0x03, 0x65, 0x03, 0x78, 0x7E, 0xFB, 0x73, 0x99, 0x5F, 0x6E, 0x74, 0x6C, 0x00, 0x2A, 0x77, 0x1C, 0x09, 0x9F, 0x33, 0x52, 0x2C, 0x02, 0xDB, 0xF4, 0x62, 0xCF, 0x52, 0x6C, 0xBD, 0xFD, 0xF9, 0xA9, 0xE9, 0xBF, 0xC4, 0xF9, 0x0D, 0x62, 0x67, 0x20, 0x57, 0x01, 0x81, 0x6E, 0x16, 0x87, 0x8A, 0x2F, 0x27, 0xC0, 0x9C, 0xE8, 0xB5, 0x54, 0xD4, 0x3E, 0x34, 0x03, 0x08, 0xD7, 0x9F, 0xB4, 0x04, 0x50, 0xA2, 0xB2, 0x2E, 0x6E, 0x40, 0x10, 0x09, 0x17, 0xB9, 0x17, 0xC0, 0x51, 0x01, 0x74, 0x03, 0xF0, 0x31, 0xBA, 0x6F, 0x22, 0x04, 0x68, 0x7B, 0x01, 0x54, 0x5C, 0x80, 0x6E, 0xCD, 0x9E, 0x32, 0x14, 0x73, 0xA2, 0xDF, 0xC2, 0x33, 0x61, 0x03, 0x90, 0xB9, 0xE2, 0x32, 0xBD, 0x00, 0xA7, 0x6C, 0x03, 0xA0, 0x12, 0xFF, 0xB3, 0x0D, 0x40, 0xED, 0x80, 0xF4, 0x44, 0xCE, 0x25, 0x55, 0x80, 0x53, 0x76, 0x03, 0x86, 0xBC, 0x00, 0xAB, 0x7C, 0xFA, 0x0D, 0x28, 0xA8, 0x6A, 0x86, 0x1E, 0xB2, 0xC4, 0xBC, 0xBD, 0x79, 0xF9, 0xA1, 0x74, 0x09, 0x82, 0xC9, 0x00, 0x6C, 0x09, 0x20, 0x25, 0x9A, 0xEC, 0x53, 0x02, 0xB0, 0x67, 0xAA, 0xC7, 0x6D, 0xB4, 0x30, 0x00, 0x6D, 0xFF, 0x82, 0x26, 0x01, 0x88, 0x8C, 0xB0, 0x3C, 0x25, 0x18, 0x93, 0x00, 0x88, 0x66, 0xA5, 0x0E, 0xC5, 0x01, 0xD0, 0x35, 0x12, 0xD1, 0xBE, 0x64, 0x7F, 0xAF, 0x51, 0x54, 0xFF, 0x0E, 0xE2, 0x44, 0xFA, 0x71, 0x2F, 0x00, 0xB7, 0x87, 0x88, 0xAC, 0xBC, 0x14, 0xC0, 0x77, 0x54, 0x88, 0xA3, 0x02, 0x94, 0xEA, 0xEA, 0xC7, 0x1E, 0x07, 0x70, 0x50, 0xE5, 0x6C, 0x4F, 0xCD, 0xDA, 0x71, 0x00, 0xF7, 0xB8, 0x17, 0x60, 0xB8, 0x30, 0x6C, 0x00, 0x0B, 0xC1, 0x5B, 0xA2, 0x1F, 0xFA, 0xB8, 0x71, 0xA8, 0xB5, 0xFD, 0x2B, 0xB5, 0x3D, 0xD0, 0xF9, 0xDD, 0x27, 0x01, 0x98, 0xC6, 0x4C, 0x29, 0x01, 0x88, 0xF8, 0x37, 0x0A, 0x4F, 0x6E, 0x7F, 0x2C, 0x89, 0xBF, 0xA2, 0x04, 0x70, 0xA4, 0x22, 0x04, 0x71, 0x0C, 0x01, 0x64, 0xF2, 0x02, 0xC9, 0xA4, 0xDC, 0xA6, 0x0D, 0x80, 0x78, 0x26, 0x30, 0x5D, 0xCD, 0xC0, 0xD5, 0x2E, 0xD0, 0x3C, 0x5B, 0x51, 0x2E, 0xDD, 0x84, 0xF2, 0x04, 0xB8, 0xF4, 0x52, 0x4D, 0x02, 0xD8, 0xEB, 0xF3, 0x68, 0x9D, 0x2F, 0x02, 0x6F, 0x60, 0x3A, 0x20, 0x9B, 0xF4, 0xDC, 0x0A, 0x3C, 0x0C, 0x17, 0x8B, 0x1B, 0xC8, 0xB3, 0xEF, 0x3B, 0xFB, 0x30, 0xA2, 0x3D, 0xDE, 0xBB, 0xD6, 0xF6, 0x50, 0x76, 0x47, 0x33, 0x13, 0xC7, 0x74, 0x40, 0x28, 0x53, 0x01, 0x84, 0x04, 0x40, 0x93, 0x71, 0x00, 0xB6, 0xCE, 0x1F, 0xB2, 0xF9, 0x24, 0x19, 0x80, 0x34, 0x2C, 0x1C, 0x8A, 0xBE, 0xA8, 0x26, 0x0D, 0x88, 0x50, 0xF0, 0x97, 0x13, 0x03, 0x58, 0xBE, 0xA9, 0xE0, 0x24, 0xE9, 0x96, 0x1B, 0x68, 0x5A, 0xDE, 0xF7, 0x38, 0x00, 0xB9, 0x02, 0x70, 0x23, 0xE0, 0x48, 0x9D, 0xD3, 0x62, 0x09, 0x89, 0x64, 0xEC, 0x31, 0x10, 0x17, 0x13, 0xC9, 0x6B, 0xD4, 0xE3, 0x57, 0x5A, 0xE3, 0x70, 0x95, 0xF9, 0x30, 0x14, 0x6B, 0x2F, 0x80, 0xF4, 0x02, 0x70, 0x45, 0xE0, 0x99, 0x11, 0x07, 0x00, 0x67, 0xBE, 0x1B, 0x50, 0xD3, 0xE5, 0xC9, 0x94, 0x0F, 0xE0, 0x0E, 0xDF, 0x0D, 0xEA, 0x89, 0x03, 0x58, 0xAC, 0x06, 0x7E, 0x1B, 0x00, 0x8A, 0x21, 0xA1, 0x55, 0x06, 0xE4, 0x5E, 0x8F, 0x94, 0xCA, 0x51, 0x40, 0x3F, 0x86, 0x17, 0x20, 0xC4, 0x2C, 0x1C, 0x5D, 0x6A, 0xE5, 0x7D, 0x2D, 0xF8, 0xB1, 0x04, 0xD0, 0xF1, 0x8C, 0x30, 0x93, 0x11, 0x90, 0x0B, 0x7E, 0x22, 0x0E, 0x40, 0x13, 0x01, 0xBD, 0x71, 0x00, 0x27, 0x54, 0xFC, 0x92, 0xA1, 0x1B, 0x07, 0x30, 0x8A, 0x4F, 0xE5, 0x71, 0x00, 0x9F, 0x1B, 0x5E, 0x03, 0x42, 0x93, 0xEB, 0x5D, 0x74, 0x7D, 0x3C, 0xB6, 0xFB, 0xD8, 0x02, 0x30, 0xC7, 0x01, 0xD0, 0xC1, 0xD8, 0x0B, 0xE0, 0x3B, 0xC8, 0xAE, 0x88, 0x01, 0x9C, 0x02, 0x4B, 0x8C, 0xED, 0x05, 0x38, 0xB5, 0x7B, 0x0C, 0x03, 0x76, 0xF6, 0x02, 0xF0, 0x38, 0x00, 0x72, 0x63, 0x71, 0x83, 0x69, 0x6E, 0x40, 0x72, 0x82, 0x56, 0x5D, 0x23, 0xD3, 0x90, 0x27, 0x2E, 0x60, 0x89, 0x03, 0xE0, 0x96, 0x6F, 0xEE, 0x06, 0xFC, 0x6C, 0xDA, 0x0C, 0x5D, 0x63, 0x2F, 0xC0, 0x11, 0xE0, 0x37, 0xD5, 0x3F, 0x9D, 0x08, 0xF8, 0x3F, 0x9E, 0x11, 0xCA, 0x17, 0x07, 0xA0, 0xFB, 0x0D, 0x7C, 0x49, 0x66, 0x0D, 0xD5, 0xEB, 0x9C, 0xBC, 0x00, 0xA5, 0x79, 0xF1, 0xB1, 0xCF, 0xAF, 0x85, 0x8F, 0x89, 0x4F, 0x00, 0x88, 0xEF, 0x9E, 0x57, 0xDB, 0x81, 0xF9, 0xDD, 0xBD, 0x97, 0x93, 0x0D, 0x80, 0x6A, 0x71, 0x00, 0x90, 0xB2, 0x01, 0xAC, 0xB5, 0x02, 0xD7, 0x36, 0x9A, 0xD9, 0x5E, 0x00, 0x65, 0xD0, 0x72, 0x62, 0xD1, 0x97, 0x25, 0x7E, 0x8A, 0x03, 0xD8, 0xC1, 0x0B, 0x69, 0x03, 0xA0, 0x31, 0x1B, 0x00, 0x84, 0x23, 0xF0, 0x72, 0xF1, 0xBA, 0xF6, 0x48, 0x91, 0x92, 0x7A, 0x6A, 0x7D, 0x97, 0x9E, 0x0F, 0x60, 0xB6, 0x01, 0x80, 0xB5, 0x17, 0x40, 0x1B, 0x5C, 0xFF, 0xEF, 0x15, 0x8D, 0xA2, 0x07, 0x8C, 0x18, 0x34, 0x42, 0x81, 0x43, 0x9C, 0x22, 0x78, 0x14, 0x71, 0x60, 0x17, 0x9E, 0xFD, 0xBB, 0x7D, 0x0D, 0xD5, 0xCF, 0xE0, 0x23, 0xB1, 0xEC, 0x59, 0x57, 0x08, 0x6C, 0xDE, 0x9B, 0x4F, 0x63, 0x25, 0xF0, 0x06, 0xD3, 0x01, 0x29, 0x1D, 0x66, 0xD1, 0x97, 0x78, 0xF3, 0x58, 0xDB, 0x6E, 0x34, 0x6B, 0x62, 0x91, 0x40, 0xDE, 0xF4, 0x50, 0x7D, 0xD3, 0x7B, 0xF0, 0x6E, 0x07, 0x36, 0x8E, 0xC6, 0x12, 0x7E, 0x7F, 0x3E, 0x01, 0x46, 0x78, 0xC6, 0xF3, 0x01, 0xF0, 0x9C, 0x80, 0xE3, 0x88, 0x57, 0x45, 0x13, 0xF8, 0x2D, 0xBD, 0xDA, 0xF8, 0x0F, 0x4A, 0x24, 0x05, 0xED, 0x1B, 0x4B, 0xB6, 0xFC, 0x9B, 0xD7, 0xDD, 0xFB, 0x97, 0x0F, 0x61, 0x18, 0x89, 0x5F, 0xD4, 0x0F, 0xE1, 0x73, 0x2D, 0x7E, 0x93, 0xEF, 0x27, 0xE8, 0x6B, 0x2D, 0x7C, 0x8D, 0x9E, 0x0D, 0x09, 0xA0, 0xF4, 0x34, 0xF7, 0xDA, 0x07, 0x81, 0x39, 0x89, 0x19, 0x2C, 0xCB, 0x73, 0x69, 0xCE, 0x34, 0x3B, 0x1F, 0x1C, 0x47, 0xF6, 0x1B, 0x97, 0x1F, 0xC9, 0x23, 0x99, 0xFD, 0x32, 0x04, 0x41, 0x59, 0x2F, 0x02, 0xF2, 0x46, 0xEA, 0x20, 0x05, 0xA2, 0x4E, 0xF8, 0x2D, 0x7F, 0xDF, 0x45, 0xB8, 0xF6, 0x15, 0x1E, 0xDB, 0xA2, 0x6E, 0x03, 0xE0, 0x27, 0x03, 0x7D, 0x7B, 0x8B, 0x49, 0x00, 0x2A, 0x29, 0x68, 0xA1, 0x81, 0x3A, 0x0F, 0xBF, 0x6E, 0x16, 0x5C, 0x48, 0x8F, 0x64, 0x16, 0xFD, 0x40, 0x42, 0x6A, 0x99, 0x4F, 0x0D, 0x06, 0x1E, 0x09, 0xF8, 0x91, 0x91, 0x12, 0x9C, 0x54, 0xC9, 0x57, 0x95, 0xC2, 0x9F, 0xB5, 0xA0, 0xA0, 0xE1, 0x63, 0x33, 0x4F, 0x02, 0xB8, 0xA7, 0xC5, 0xF8, 0xB3, 0x1D, 0x5E, 0xCF, 0x9C, 0x80, 0x72, 0xA8, 0xF8, 0x51, 0xCE, 0x42, 0x02, 0xE0, 0x53, 0x50, 0xF7, 0x02, 0x38, 0x4B, 0x11, 0x4E, 0xCD, 0xC9, 0x3D, 0xA9, 0x10, 0xAB, 0xE6, 0x94, 0x1B, 0x7C, 0xDD, 0xD3, 0x87, 0xE7, 0xCD, 0x40, 0x4C, 0xEA, 0xD9, 0x10, 0x9E, 0x13, 0xF0, 0x93, 0x65, 0x2F, 0xC0, 0x35, 0x2A, 0xC2, 0xEE, 0xC1, 0xF0, 0x7F, 0x4F, 0x84, 0x02, 0x0F, 0x33, 0xBE, 0x89, 0x36, 0x0E, 0x34, 0x30, 0x7E, 0x78, 0xF5, 0xB5, 0x4E, 0xE6, 0x94, 0xDC, 0x85, 0x13, 0x43, 0x7F, 0xAA, 0xF5, 0x99, 0x01, 0xF8, 0x72, 0x5B, 0xA8, 0x65, 0xD8, 0x38, 0xB1, 0xC4, 0xA9, 0xF7, 0xE7, 0x8C, 0xC3, 0x9E, 0xE5, 0x67, 0xE7, 0x98, 0xDB, 0x4F, 0x5E, 0xD9, 0xE9, 0xAC, 0xDC, 0x29, 0x1F, 0xC0, 0x87, 0xB0, 0x99, 0x6D, 0x00, 0xE7, 0x9F, 0x13, 0x4B, 0xF9, 0xC0, 0x77, 0x42, 0xEA, 0xB9, 0x82, 0xE7, 0xB7, 0x3E, 0x37, 0xF3, 0x1E, 0xD4, 0x6E, 0x2B, 0x66, 0xB1, 0x27, 0xB8, 0x73, 0x58, 0x6A, 0xF6, 0x67, 0xB1, 0x80, 0x4C, 0x47, 0x6B, 0x8B, 0x38, 0x10, 0xB2, 0xB1, 0x8E, 0x26, 0xBA, 0x3E, 0x45, 0x1C, 0x0E, 0x6A, 0x84, 0x8D, 0x3A, 0x96, 0xE4, 0xD0, 0xD5, 0xF3, 0xBC, 0x76, 0x46, 0xBA, 0xF7, 0x3D, 0xA0, 0x89, 0xC4, 0xD5, 0xF5, 0x4E, 0x1F, 0x0E, 0xDA, 0x43, 0x24, 0x67, 0xBA, 0x18, 0x06, 0xD8, 0x6E, 0x47, 0xB8, 0xF7, 0xFC, 0xDD, 0x69, 0x2F, 0xC0, 0x8E, 0x06, 0xCF, 0x00, 0xB0, 0xA9, 0x37, 0x70, 0xC8, 0x4A, 0xEA, 0x10, 0x96, 0x74, 0xBD, 0x4F, 0x97, 0x41, 0xB4, 0xEF, 0xE5, 0xF4, 0xB6, 0xF8, 0x3F, 0x4F, 0xB6, 0xE9, 0x60, 0xE9, 0x9D, 0x00, 0xB0, 0x85, 0x17, 0x6F, 0x7D, 0x09, 0x37, 0x37, 0x17, 0x70, 0xC5, 0xE3, 0x00, 0xD0, 0x1B, 0x2B, 0xE2, 0xE3, 0xEF, 0xD0, 0x81, 0x27, 0x4D, 0xBB, 0xEF, 0xEC, 0x82, 0x35, 0x57, 0xA2, 0x9D, 0xF0, 0x1C, 0x3A, 0x10, 0x46, 0xFF, 0x95, 0x7F, 0xF3, 0x5F, 0xB7, 0x3B, 0x78, 0x83, 0xE1, 0x9F, 0xC7, 0x01, 0xF0, 0x9C, 0x28, 0xD3, 0x51, 0xDE, 0x34, 0x6C, 0x4F, 0x49, 0xE9, 0xC2, 0x31, 0xFC, 0x94, 0xE6, 0x17, 0x5F, 0x03, 0x3F, 0xC0, 0x7D, 0xF5, 0xEA, 0xE5, 0x74, 0x60, 0x42, 0xFC, 0xA2, 0x82, 0xB2, 0x0E, 0x13, 0x52, 0x24, 0xA2, 0x50, 0xED, 0x7D, 0x9D, 0x10, 0x82, 0x47, 0x27, 0xCD, 0x67, 0x44, 0x10, 0xE3, 0x7D, 0x3F, 0xFB, 0x4A, 0x04, 0xEA, 0x04, 0x19, 0x00, 0x08, 0xA4, 0xFF, 0x05, 0xAE, 0xE0, 0xBF, 0x3C, 0xFE, 0x10, 0xB6, 0x3C, 0x26, 0x80, 0x82, 0x95, 0xF2, 0xC1, 0xB6, 0x01, 0xE0, 0x6D, 0x22, 0xF1, 0xFA, 0x50, 0x46, 0x7F, 0x08, 0x9E, 0xE5, 0x96, 0x1B, 0x54, 0x66, 0x8B, 0xAF, 0xF6, 0xE6, 0x16, 0xFE, 0xF7, 0x96, 0x5D, 0x6F, 0xB0, 0xB1, 0xFB, 0xE3, 0xFD, 0x4F, 0xE0, 0xC6, 0xE6, 0x26, 0xA3, 0xFE, 0xD1, 0xB0, 0xB9, 0x78, 0xE3, 0x2A, 0x88, 0x3A, 0x3B, 0x50, 0xB3, 0x28, 0x50, 0xF3, 0x34, 0x3A, 0x9B, 0x4E, 0xA8, 0x97, 0x7E, 0x3C, 0xEF, 0x13, 0xCD, 0x3A, 0xEB, 0x81, 0xEF, 0xE2, 0x11, 0x41, 0x1F, 0x11, 0xFC, 0x6F, 0x04, 0xFE, 0xB7, 0xF0, 0x77, 0x8F, 0x3F, 0x10, 0xB9, 0x21, 0x06, 0xD0, 0x5C, 0xA5, 0x08, 0xFC, 0x60, 0xA5, 0xD6, 0x30, 0x7D, 0x94, 0xE2, 0xDF, 0x7D, 0xCF, 0xEC, 0x4F, 0xAA, 0xFF, 0x16, 0xE3, 0x54, 0x0C, 0x60, 0x2F, 0xEE, 0x8A, 0xB5, 0x2A, 0x53, 0x35, 0x11, 0x18, 0xE6, 0x44, 0x9F, 0xF7, 0x9E, 0x3C, 0x64, 0x7F, 0x6F, 0x26, 0x1B, 0x80, 0x87, 0xF4, 0x49, 0xAE, 0x85, 0x6A, 0xDF, 0xF7, 0xF6, 0x6A, 0xA5, 0x1E, 0xD3, 0xEE, 0xC1, 0x90, 0x8B, 0x88, 0xD8, 0xE8, 0x3B, 0x9F, 0x0B, 0xF0, 0xE0, 0x0B, 0x11, 0x09, 0x38, 0x72, 0x09, 0x40, 0x1A, 0x43, 0x69, 0x34, 0x8C, 0x86, 0xB6, 0x45, 0x0E, 0x6D, 0x8B, 0x7D, 0xB5, 0xA9, 0x87, 0xDB, 0x7F, 0xB8, 0xE3, 0xE3, 0xEE, 0xD3, 0x87, 0x62, 0x24, 0x88, 0xB5, 0x19, 0x8C, 0xD8, 0xE3, 0x57, 0x09, 0x5F, 0x36, 0x7E, 0x5A, 0xD0, 0x07, 0xCD, 0xE8, 0xEF, 0x7C, 0x36, 0xA0, 0xB1, 0xA8, 0x2E, 0xC6, 0x62, 0x5D, 0x08, 0x70, 0x17, 0x5D, 0x92, 0xB0, 0x9B, 0x95, 0xD4, 0xA7, 0x78, 0x4C, 0xEA, 0x34, 0x72, 0x48, 0x47, 0x89, 0x89, 0xBF, 0xB9, 0x0A, 0x30, 0xEE, 0xE0, 0xAD, 0x27, 0xEF, 0x09, 0x06, 0x30, 0x38, 0x12, 0x40, 0xD8, 0x58, 0x57, 0x6C, 0x75, 0x24, 0x15, 0xEB, 0x8B, 0x12, 0x24, 0x2C, 0xA3, 0x33, 0xAA, 0xBD, 0x00, 0xF7, 0x7F, 0x0D, 0x22, 0x3D, 0x62, 0x30, 0x0E, 0xC0, 0x7F, 0xEA, 0xAD, 0xD7, 0xD0, 0x8C, 0xD0, 0xEB, 0x9D, 0xF7, 0x23, 0xF8, 0x4F, 0x1D, 0x9B, 0x9D, 0xCF, 0x43, 0x34, 0x06, 0x20, 0xD8, 0x1F, 0x85, 0x7B, 0x8F, 0x1F, 0xCA, 0x48, 0xD0, 0x70, 0x46, 0x20, 0xFC, 0xF8, 0xAE, 0xC0, 0x4F, 0xEB, 0xD0, 0xC2, 0x00, 0x7C, 0x53, 0x02, 0xB8, 0x0E, 0x46, 0x0F, 0x35, 0x1E, 0x6A, 0x33, 0xC8, 0x93, 0x89, 0x00, 0x92, 0x0C, 0xA0, 0xD4, 0x47, 0x15, 0x8D, 0xD8, 0x83, 0xA6, 0x11, 0x81, 0x46, 0x56, 0x63, 0xED, 0x81, 0xE9, 0x0C, 0x20, 0x75, 0x38, 0x28, 0x93, 0x00, 0x36, 0x1B, 0xA0, 0xE3, 0xF5, 0xDA, 0x0B, 0x30, 0xD9, 0x0C, 0x88, 0xC0, 0xFF, 0x46, 0x9E, 0x8D, 0x37, 0x6F, 0x06, 0x8A, 0xE1, 0x47, 0xD3, 0x8C, 0xC9, 0x0A, 0x9F, 0x77, 0x35, 0xF8, 0x81, 0xFB, 0xA0, 0xDD, 0xC2, 0x96, 0x00, 0x0E, 0xCE, 0x00, 0xF6, 0x4C, 0x6D, 0x06, 0x03, 0x60, 0xA3, 0x74, 0xEF, 0xC9, 0x7B, 0xA0, 0xD2, 0x43, 0x39, 0xDB, 0x3D, 0xC1, 0x94, 0x82, 0xC8, 0xC9, 0x84, 0x02, 0xFB, 0x8D, 0xDA, 0x7A, 0x40, 0xCC, 0x1C, 0x07, 0x70, 0xFF, 0xAB, 0x69, 0x67, 0x24, 0x1D, 0x83, 0x1E, 0xE5, 0x73, 0x5C, 0x00, 0x04, 0x2B, 0x20, 0x5C, 0x02, 0x78, 0x4F, 0x1E, 0x0C, 0xE2, 0xEE, 0x05, 0x00, 0x4B, 0xD2, 0x89, 0x32, 0xF0, 0x29, 0xA9, 0x40, 0x8E, 0x9D, 0xBA, 0x68, 0xE1, 0xA8, 0x0D, 0xFF, 0x7A, 0x4A, 0x00, 0x32, 0x27, 0x20, 0x8F, 0x00, 0xBB, 0xFB, 0xF4, 0x1D, 0x81, 0xB9, 0x39, 0x10, 0xC8, 0xCE, 0x08, 0x14, 0x1A, 0xC8, 0x3C, 0xC3, 0x78, 0xB9, 0x64, 0x90, 0xD9, 0x7E, 0x2A, 0xE2, 0x52, 0x3D, 0x3A, 0x65, 0x04, 0x62, 0x12, 0xC0, 0x83, 0x2F, 0xA7, 0xFA, 0x71, 0xBC, 0x3E, 0x12, 0x80, 0xDC, 0x09, 0xCA, 0xFD, 0xFF, 0x77, 0x9E, 0xFC, 0xD2, 0xDD, 0x0B, 0xE0, 0x1B, 0x37, 0xCF, 0xF8, 0x92, 0x9A, 0xF8, 0x4D, 0xE1, 0xB9, 0x12, 0x23, 0xB0, 0xFB, 0xEF, 0x65, 0x00, 0xB9, 0xFE, 0xF8, 0xB5, 0x8B, 0x7C, 0x2D, 0x82, 0x23, 0x11, 0xEB, 0xAC, 0xCB, 0x04, 0x26, 0xC3, 0xD7, 0x7D, 0x26, 0x01, 0x8C, 0x44, 0x31, 0x00, 0x1A, 0x5C, 0x31, 0x4E, 0xAD, 0xD8, 0x91, 0xA2, 0xB6, 0x4F, 0x93, 0x2F, 0x58, 0x03, 0xFB, 0xFE, 0xA7, 0xF7, 0xBF, 0x84, 0x61, 0x33, 0x2C, 0x09, 0x51, 0x2C, 0x1B, 0xC0, 0xC9, 0x70, 0xF5, 0x64, 0x77, 0xC7, 0x79, 0x89, 0xE6, 0x8F, 0x0B, 0x1B, 0x00, 0x43, 0xFA, 0x9B, 0x8F, 0x1F, 0x4E, 0x81, 0x60, 0x32, 0x1A, 0x90, 0x10, 0xBA, 0x1F, 0x9D, 0xFC, 0x48, 0xCA, 0xFF, 0x07, 0x02, 0x99, 0x5C, 0xA3, 0x1C, 0x53, 0x53, 0x85, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82};
 
 constexpr std::size_t size = sizeof(data);
 
@@ -4,8 +4,7 @@
 
 #include <cstddef>    // for std::size_t
 #include <format>     // for std::format
-#include <stdexcept>  // for std::runtime_error, std::out_of_range
-#include <string>     // for std::string
+#include <stdexcept>  // for std::runtime_error
 #include <utility>    // for std::move
 
 #include <SFML/Audio/SoundBuffer.hpp>
@@ -15,36 +14,44 @@
 
 namespace assets::sounds {
 
-void SoundManager::load(const std::string &identifier,
+void SoundManager::load(const SoundId id,
                         const EmbeddedSound &embedded_sound)
 {
-    // SPDLOG_DEBUG("Loading sound buffer with identifier: {}", identifier);
+    // SPDLOG_DEBUG("Loading sound buffer with id: {}", static_cast<std::size_t>(id));
 
     // Load the sound buffer from memory
     sf::SoundBuffer sound_buffer;
     if (!sound_buffer.loadFromMemory(embedded_sound.data, embedded_sound.size)) {
-        throw std::runtime_error(std::format("Failed to load sound buffer from memory for identifier: {}", identifier));
+        throw std::runtime_error(std::format("Failed to load sound buffer from memory for id: {}", static_cast<std::size_t>(id)));
     }
 
     // Store the sound buffer
-    this->sound_buffers_.insert_or_assign(identifier, std::move(sound_buffer));
-    SPDLOG_DEBUG("Sound buffer '{}' loaded, exiting!", identifier);
+    this->sound_buffers_[static_cast<std::size_t>(id)] = std::move(sound_buffer);
+    SPDLOG_DEBUG("Sound buffer '{}' loaded, exiting!", static_cast<std::size_t>(id));
 }
 
-const sf::SoundBuffer &SoundManager::get(const std::string &identifier) const
+void SoundManager::load(const SoundId id,
+                        sf::SoundBuffer sound_buffer)
 {
-    // SPDLOG_DEBUG("Retrieving sound buffer with identifier: {}", identifier);
-    if (!this->sound_buffers_.contains(identifier)) {
-        throw std::out_of_range(std::format("Sound buffer identifier not found: {}", identifier));
+    // Reject empty buffers, which is what a failed "loadFromMemory()" on a worker thread leaves behind
+    if (sound_buffer.getSampleCount() == 0) [[unlikely]] {
+        throw std::runtime_error(std::format("Cannot store empty sound buffer for id: {}", static_cast<std::size_t>(id)));
     }
-    SPDLOG_DEBUG("Sound buffer '{}' found, returning it!", identifier);
-    return this->sound_buffers_.at(identifier);
+
+    this->sound_buffers_[static_cast<std::size_t>(id)] = std::move(sound_buffer);
+    SPDLOG_DEBUG("Pre-decoded sound buffer '{}' stored, exiting!", static_cast<std::size_t>(id));
+}
+
+const sf::SoundBuffer &SoundManager::get(const SoundId id) const
+{
+    // SPDLOG_TRACE("Retrieving sound buffer with id: {}", static_cast<std::size_t>(id));
+    return this->sound_buffers_[static_cast<std::size_t>(id)];
 }
 
 std::size_t SoundManager::size() const
 {
-    // SPDLOG_TRACE("Returning size of SoundManager: '{}'!", this->size_);
-    return this->sound_buffers_.size();
+    // SPDLOG_TRACE("Returning size of SoundManager: '{}'!", sound_count);
+    return sound_count;
 }
 
 }  // namespace assets::sounds
@@ -6,18 +6,41 @@
 
 #pragma once
 
-#include <cstddef>        // for std::size_t
-#include <string>         // for std::string
-#include <unordered_map>  // for std::unordered_map
+#include <array>    // for std::array
+#include <cstddef>  // for std::size_t
 
 #include <SFML/Audio.hpp>
 
 namespace assets::sounds {
 
+/**
+ * @brief Enum of all embedded sounds, used as compile-time-checked indices into the SoundManager.
+ *
+ * The enumerators mirror the embedded assets loaded by "assets::builder"; "Count" must remain last, as it doubles as the array size.
+ */
+enum class SoundId : std::size_t {
+    // Car sounds
+    Engine,
+    Tires,
+    Hit,
+    // UI sounds
+    Ok,
+    Other,
+    // Sentinel, keep last
+    Count
+};
+
+/**
+ * @brief Number of embedded sounds, derived from the sentinel enumerator.
+ */
+inline constexpr std::size_t sound_count = static_cast<std::size_t>(SoundId::Count);
+
 /**
  * @brief Class that loads and manages embedded SFML sound buffers.
  *
  * On construction, the class does nothing. Use the "load()" method to load sound buffers from memory.
+ *
+ * All storage is indexed by "SoundId", so lookups are plain array accesses with no string hashing or heap-allocated keys.
  */
 class SoundManager final {
   public:
@@ -42,33 +65,48 @@ class SoundManager final {
     SoundManager() = default;
 
     /**
-     * @brief Load a sound buffer from memory and store it at the given identifier.
+     * @brief Load a sound buffer from memory and store it at the given id.
      *
-     * @param identifier Unique identifier for the sound buffer (e.g., "engine").
+     * @param id Sound id to store the buffer at (e.g., "SoundId::Engine").
      * @param embedded_sound Embedded sound data to load from memory.
      *
      * @throws std::runtime_error if failed to load the sound buffer from memory.
      *
-     * @note If the identifier already exists, the previous sound buffer is overwritten, mirroring "operator[]" on the map.
+     * @note If the id was already loaded, the previous sound buffer is overwritten.
      */
-    void load(const std::string &identifier,
+    void load(const SoundId id,
               const EmbeddedSound &embedded_sound);
 
     /**
-     * @brief Get a sound buffer by its identifier.
+     * @brief Store an already-loaded sound buffer at the given id.
      *
-     * @param identifier Unique identifier for the sound buffer (e.g., "engine").
+     * This overload lets callers decode audio on worker threads (the expensive part), then store the results cheaply from a single thread.
      *
-     * @return Const reference to the sound buffer.
+     * @param id Sound id to store the buffer at (e.g., "SoundId::Engine").
+     * @param sound_buffer Loaded sound buffer to store.
+     *
+     * @throws std::runtime_error if the sound buffer contains no samples (e.g., decoding failed on the worker thread).
      *
-     * @throws std::out_of_range if the identifier is not found.
+     * @note If the id was already loaded, the previous sound buffer is overwritten.
+     */
+    void load(const SoundId id,
+              sf::SoundBuffer sound_buffer);
+
+    /**
+     * @brief Get a sound buffer by its id.
+     *
+     * This is a plain array access; invalid ids are impossible as long as callers use named "SoundId" enumerators.
+     *
+     * @param id Sound id to look up (e.g., "SoundId::Engine").
+     *
+     * @return Const reference to the sound buffer.
      */
-    [[nodiscard]] const sf::SoundBuffer &get(const std::string &identifier) const;
+    [[nodiscard]] const sf::SoundBuffer &get(const SoundId id) const;
 
     /**
      * @brief Get the number (size) of stored sound buffers.
      *
-     * @return Number of sound buffers (e.g., "4").
+     * @return Number of sound buffers (e.g., "5"); always equal to "sound_count".
      */
     [[nodiscard]] std::size_t size() const;
 
@@ -82,9 +120,9 @@ class SoundManager final {
 
   private:
     /**
-     * @brief Map of loaded sound buffers, where the key is a unique identifier (e.g., "engine") and the value is the loaded sound buffer.
+     * @brief Sound buffers indexed by "SoundId". Unloaded slots hold empty buffers.
      */
-    std::unordered_map<std::string, sf::SoundBuffer> sound_buffers_;
+    std::array<sf::SoundBuffer, sound_count> sound_buffers_;
 };
 
 }  // namespace assets::sounds
@@ -2,12 +2,13 @@
  * @file textures.cpp
  */
 
+#include <algorithm>  // for std::max
 #include <cstddef>    // for std::size_t
 #include <format>     // for std::format
-#include <stdexcept>  // for std::runtime_error, std::out_of_range
-#include <string>     // for std::string
+#include <stdexcept>  // for std::runtime_error
 #include <utility>    // for std::move
 
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <spdlog/spdlog.h>
 
@@ -15,37 +16,103 @@
 
 namespace assets::textures {
 
-void TextureManager::load(const std::string &identifier,
+void TextureManager::load(const TextureId id,
                           const EmbeddedTexture &embedded_texture)
 {
-    // SPDLOG_DEBUG("Loading texture with identifier: {}", identifier);
+    // SPDLOG_DEBUG("Loading texture with id: {}", static_cast<std::size_t>(id));
 
-    // Load the texture from memory
-    sf::Texture texture;
-    if (!texture.loadFromMemory(embedded_texture.data, embedded_texture.size)) {
-        throw std::runtime_error(std::format("Failed to load texture from memory for identifier: {}", identifier));
+    // Decode the image from memory; the GPU texture is only created later in "pack()"
+    sf::Image image;
+    if (!image.loadFromMemory(embedded_texture.data, embedded_texture.size)) {
+        throw std::runtime_error(std::format("Failed to load texture from memory for id: {}", static_cast<std::size_t>(id)));
     }
 
-    // Set the texture smoothing option, then store it
-    texture.setSmooth(true);
-    this->textures_.insert_or_assign(identifier, std::move(texture));
-    SPDLOG_DEBUG("Texture '{}' loaded, exiting!", identifier);
+    this->staged_images_[static_cast<std::size_t>(id)] = std::move(image);
+    SPDLOG_DEBUG("Image '{}' decoded and staged for packing, exiting!", static_cast<std::size_t>(id));
 }
 
-const sf::Texture &TextureManager::get(const std::string &identifier) const
+void TextureManager::load(const TextureId id,
+                          sf::Image image)
 {
-    // SPDLOG_DEBUG("Retrieving texture with identifier: {}", identifier);
-    if (!this->textures_.contains(identifier)) {
-        throw std::out_of_range(std::format("Texture identifier not found: {}", identifier));
+    // Reject empty images, which is what a failed "loadFromMemory()" on a worker thread leaves behind
+    if (image.getSize() == sf::Vector2u{0, 0}) [[unlikely]] {
+        throw std::runtime_error(std::format("Cannot stage empty image for id: {}", static_cast<std::size_t>(id)));
     }
-    SPDLOG_DEBUG("Texture '{}' found, returning it!", identifier);
-    return this->textures_.at(identifier);
+
+    this->staged_images_[static_cast<std::size_t>(id)] = std::move(image);
+    SPDLOG_DEBUG("Pre-decoded image '{}' staged for packing, exiting!", static_cast<std::size_t>(id));
+}
+
+void TextureManager::pack()
+{
+    // Every id must be staged; an empty image means "load()" was never called for that slot
+    for (std::size_t index = 0; index < texture_count; ++index) {
+        if (this->staged_images_[index].getSize() == sf::Vector2u{0, 0}) [[unlikely]] {
+            throw std::runtime_error(std::format("Cannot pack texture atlas: texture id '{}' was not staged", index));
+        }
+    }
+
+    // Maximum shelf width before wrapping to the next row; kept modest so the atlas stays well below common GPU texture size limits
+    constexpr unsigned int maximum_atlas_width = 2048;
+
+    // Transparent gutter between neighboring regions, so linear filtering ("setSmooth") does not sample pixels from an adjacent image
+    constexpr unsigned int padding = 2;
+
+    // First pass: assign each image a position using simple shelf packing
+    unsigned int cursor_x = padding;
+    unsigned int cursor_y = padding;
+    unsigned int shelf_height = 0;
+    unsigned int atlas_width = 0;
+    for (std::size_t index = 0; index < texture_count; ++index) {
+        const sf::Vector2u image_size = this->staged_images_[index].getSize();
+
+        // Wrap to a new shelf if this image would exceed the maximum width
+        if (cursor_x + image_size.x + padding > maximum_atlas_width) {
+            cursor_x = padding;
+            cursor_y += shelf_height + padding;
+            shelf_height = 0;
+        }
+
+        this->regions_[index] = sf::IntRect{{static_cast<int>(cursor_x), static_cast<int>(cursor_y)},
+                                            {static_cast<int>(image_size.x), static_cast<int>(image_size.y)}};
+
+        cursor_x += image_size.x + padding;
+        shelf_height = std::max(shelf_height, image_size.y);
+        atlas_width = std::max(atlas_width, cursor_x);
+    }
+    const unsigned int atlas_height = cursor_y + shelf_height + padding;
+
+    // Second pass: blit every staged image into one big image, then upload it as a single texture
+    sf::Image atlas_image(sf::Vector2u{atlas_width, atlas_height}, sf::Color::Transparent);
+    for (std::size_t index = 0; index < texture_count; ++index) {
+        const sf::IntRect &rect = this->regions_[index];
+        if (!atlas_image.copy(this->staged_images_[index], {static_cast<unsigned int>(rect.position.x), static_cast<unsigned int>(rect.position.y)})) [[unlikely]] {
+            throw std::runtime_error(std::format("Failed to copy image into texture atlas for id: {}", index));
+        }
+    }
+    if (!this->atlas_texture_.loadFromImage(atlas_image)) [[unlikely]] {
+        throw std::runtime_error(std::format("Failed to create '{}x{}' texture atlas", atlas_width, atlas_height));
+    }
+
+    // Set the texture smoothing option, then drop the staged images; they are no longer needed
+    this->atlas_texture_.setSmooth(true);
+    for (sf::Image &image : this->staged_images_) {
+        image = sf::Image();
+    }
+    SPDLOG_DEBUG("Texture atlas of '{}x{}' pixels packed from '{}' images, exiting!", atlas_width, atlas_height, texture_count);
+}
+
+TextureManager::AtlasRegion TextureManager::get_region(const TextureId id) const
+{
+    // SPDLOG_TRACE("Retrieving texture region with id: {}", static_cast<std::size_t>(id));
+    return AtlasRegion{.texture = &this->atlas_texture_,
+                       .rect = this->regions_[static_cast<std::size_t>(id)]};
 }
 
 std::size_t TextureManager::size() const
 {
-    // SPDLOG_TRACE("Returning size of TextureManager: '{}'!", this->size_);
-    return this->textures_.size();
+    // SPDLOG_TRACE("Returning size of TextureManager: '{}'!", texture_count);
+    return texture_count;
 }
 
 }  // namespace assets::textures
@@ -1,23 +1,51 @@
 /**
  * @file textures.hpp
  *
- * @brief Load and manage embedded SFML textures.
+ * @brief Load embedded SFML textures and pack them into a single atlas.
  */
 
 #pragma once
 
-#include <cstddef>        // for std::size_t
-#include <string>         // for std::string
-#include <unordered_map>  // for std::unordered_map
+#include <array>    // for std::array
+#include <cstddef>  // for std::size_t
 
 #include <SFML/Graphics.hpp>
 
 namespace assets::textures {
 
 /**
- * @brief Class that loads and manages embedded SFML textures.
+ * @brief Enum of all embedded textures, used as compile-time-checked indices into the TextureManager.
  *
- * On construction, the class does nothing. Use the "load()" method to load textures from memory.
+ * The enumerators mirror the embedded assets loaded by "assets::builder"; "Count" must remain last, as it doubles as the array size.
+ */
+enum class TextureId : std::size_t {
+    // Road textures
+    TopLeft,
+    TopRight,
+    BottomRight,
+    BottomLeft,
+    Vertical,
+    Horizontal,
+    HorizontalFinish,
+    // Car texture; a single grayscale base, tinted per car via vertex color at draw time
+    Car,
+    // Sentinel, keep last
+    Count
+};
+
+/**
+ * @brief Number of embedded textures, derived from the sentinel enumerator.
+ */
+inline constexpr std::size_t texture_count = static_cast<std::size_t>(TextureId::Count);
+
+/**
+ * @brief Class that loads embedded images and packs them into a single atlas texture.
+ *
+ * On construction, the class does nothing. Use the "load()" method to stage images, then call "pack()" once to build the atlas. Afterwards, "get_region()" hands out sub-rectangles of the shared atlas texture.
+ *
+ * All storage is indexed by "TextureId", so lookups are plain array accesses with no string hashing or heap-allocated keys.
+ *
+ * Because every region shares one texture, sprites and vertex batches built from different identifiers can be drawn without texture bind changes between them.
  */
 class TextureManager final {
   public:
@@ -36,39 +64,82 @@ class TextureManager final {
         std::size_t size;
     };
 
+    /**
+     * @brief Struct that represents a sub-rectangle of the shared atlas texture.
+     */
+    struct AtlasRegion final {
+        /**
+         * @brief Pointer to the atlas texture owned by the manager.
+         *
+         * @note This remains valid for the lifetime of the TextureManager.
+         */
+        const sf::Texture *texture;
+
+        /**
+         * @brief Pixel rectangle of this region within the atlas.
+         */
+        sf::IntRect rect;
+    };
+
     /**
      * @brief Default constructor.
      */
     TextureManager() = default;
 
     /**
-     * @brief Load a texture from memory and store it at the given identifier.
+     * @brief Decode an image from memory and stage it at the given id.
      *
-     * @param identifier Unique identifier for the texture (e.g., "car_black").
+     * @param id Texture id to stage the image at (e.g., "TextureId::Car").
      * @param embedded_texture Embedded texture data to load from memory.
      *
-     * @throws std::runtime_error if failed to load the texture from memory.
+     * @throws std::runtime_error if failed to decode the image from memory.
      *
-     * @note If the identifier already exists, the previous texture is overwritten, mirroring "operator[]" on the map.
+     * @note If the id was already staged, the previous image is overwritten. Call "pack()" after all images are staged.
      */
-    void load(const std::string &identifier,
+    void load(const TextureId id,
               const EmbeddedTexture &embedded_texture);
 
     /**
-     * @brief Get a texture by its identifier.
+     * @brief Stage an already-decoded image at the given id.
      *
-     * @param identifier Unique identifier for the texture (e.g., "car_black").
+     * This overload lets callers decode images on worker threads (the expensive part), then stage the results cheaply from a single thread.
      *
-     * @return Const reference to the texture.
+     * @param id Texture id to stage the image at (e.g., "TextureId::Car").
+     * @param image Decoded image to stage.
      *
-     * @throws std::out_of_range if the identifier is not found.
+     * @throws std::runtime_error if the image is empty (e.g., decoding failed on the worker thread).
+     *
+     * @note If the id was already staged, the previous image is overwritten. Call "pack()" after all images are staged.
+     */
+    void load(const TextureId id,
+              sf::Image image);
+
+    /**
+     * @brief Pack all staged images into the single atlas texture.
+     *
+     * Images are laid out on horizontal shelves with a small transparent gutter between neighbors, so linear filtering does not bleed between regions.
+     *
+     * @throws std::runtime_error if any texture id was not staged or the atlas texture could not be created.
+     *
+     * @note Call this exactly once, after every "TextureId" has been staged via "load()".
      */
-    [[nodiscard]] const sf::Texture &get(const std::string &identifier) const;
+    void pack();
 
     /**
-     * @brief Get the number (size) of stored textures.
+     * @brief Get an atlas region by its id.
+     *
+     * This is a plain array access; invalid ids are impossible as long as callers use named "TextureId" enumerators.
      *
-     * @return Number of textures (e.g., "4").
+     * @param id Texture id to look up (e.g., "TextureId::Car").
+     *
+     * @return Region pointing into the shared atlas texture.
+     */
+    [[nodiscard]] AtlasRegion get_region(const TextureId id) const;
+
+    /**
+     * @brief Get the number (size) of stored regions.
+     *
+     * @return Number of regions (e.g., "8"); always equal to "texture_count".
      */
     [[nodiscard]] std::size_t size() const;
 
@@ -82,9 +153,19 @@ class TextureManager final {
 
   private:
     /**
-     * @brief Map of loaded textures, where the key is a unique identifier (e.g., "car_black") and the value is the loaded texture.
+     * @brief Decoded images staged by "load()", consumed and cleared by "pack()". Unstaged slots hold empty images.
+     */
+    std::array<sf::Image, texture_count> staged_images_;
+
+    /**
+     * @brief Single atlas texture shared by all regions, built by "pack()".
+     */
+    sf::Texture atlas_texture_;
+
+    /**
+     * @brief Pixel rectangles within the atlas, indexed by "TextureId", assigned by "pack()".
      */
-    std::unordered_map<std::string, sf::Texture> textures_;
+    std::array<sf::IntRect, texture_count> regions_;
 };
 
 }  // namespace assets::textures
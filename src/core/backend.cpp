@@ -2,10 +2,13 @@
  * @file backend.cpp
  */
 
-#include <algorithm>  // for std::min
-#include <cstddef>    // for std::size_t
-#include <format>     // for std::format
-#include <string>     // for std::string
+#include <algorithm>   // for std::clamp, std::max, std::min
+#include <chrono>      // for std::chrono
+#include <cstddef>     // for std::size_t
+#include <format>      // for std::format
+#include <stop_token>  // for std::stop_token
+#include <string>      // for std::string
+#include <thread>      // for std::jthread, std::this_thread
 
 #include <SFML/System/Clock.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -20,6 +23,235 @@
 
 namespace core::backend {
 
+void FramePacer::set_target_fps(const unsigned fps)
+{
+    if (fps == 0) {
+        this->frame_interval_ = {};
+        SPDLOG_DEBUG("Frame pacer disabled (target FPS is '0')");
+        return;
+    }
+    this->frame_interval_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>{1.0 / static_cast<double>(fps)});
+    this->next_deadline_ = std::chrono::steady_clock::now() + this->frame_interval_;
+    SPDLOG_DEBUG("Frame pacer set to '{}' FPS ('{}' us per frame)", fps, std::chrono::duration_cast<std::chrono::microseconds>(this->frame_interval_).count());
+}
+
+void FramePacer::set_idle(const bool idle)
+{
+    if (idle == this->idle_) {
+        return;
+    }
+    this->idle_ = idle;
+    // The interval just changed, so restart the schedule from "now" instead of honoring a deadline computed at the old rate
+    this->next_deadline_ = std::chrono::steady_clock::now();
+    SPDLOG_DEBUG("Frame pacer idle cap '{}'", idle ? "enabled" : "disabled");
+}
+
+void FramePacer::pace()
+{
+    // While idle, cap at the idle rate even if the configured limit is higher or unlimited; a menu never needs more
+    const auto idle_interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>{1.0 / static_cast<double>(FramePacer::idle_fps_)});
+    const auto interval = this->idle_ ? std::max(this->frame_interval_, idle_interval) : this->frame_interval_;
+
+    // If pacing is disabled, do nothing
+    if (interval == std::chrono::steady_clock::duration{}) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= this->next_deadline_) {
+        // The frame overran its whole interval; reset the schedule instead of stacking missed deadlines into a burst of un-paced frames
+        this->next_deadline_ = now + interval;
+        return;
+    }
+
+    if (settings::current::low_power_pacing || this->idle_) {
+        // Battery mode or a static screen: sleep the whole way and accept the scheduler's overshoot
+        std::this_thread::sleep_until(this->next_deadline_);
+    }
+    else {
+        // Sleep until shortly before the deadline, then spin-wait the rest on the monotonic clock for microsecond-accurate delivery
+        if (this->next_deadline_ - now > spin_window_) {
+            std::this_thread::sleep_until(this->next_deadline_ - spin_window_);
+        }
+        while (std::chrono::steady_clock::now() < this->next_deadline_) {
+            // Busy-wait; the window is at most "spin_window_" long
+        }
+    }
+
+    // Advance by an exact interval so overshoot in this frame shortens the next one instead of accumulating
+    this->next_deadline_ += interval;
+}
+
+void ResolutionScaler::update(const float dt)
+{
+    if (!settings::current::world_render_auto_scale) {
+        return;
+    }
+
+    // Exponential smoothing; a single slow frame (e.g., a track rebuild) must not tank the resolution
+    constexpr float smoothing_factor = 0.1f;
+    this->smoothed_frame_time_ += (dt - this->smoothed_frame_time_) * smoothing_factor;
+
+    this->cooldown_remaining_ -= dt;
+    if (this->cooldown_remaining_ > 0.0f) {
+        return;
+    }
+
+    // Budget implied by the FPS limit; under vsync or an unlimited cap, assume a 60 Hz display
+    const unsigned fps_limit = settings::constants::fps_values[settings::current::fps_idx];
+    const float budget_seconds = (settings::current::vsync || fps_limit == 0) ? (1.0f / 60.0f) : (1.0f / static_cast<float>(fps_limit));
+
+    float &scale = settings::current::world_render_scale;
+    if (this->smoothed_frame_time_ > budget_seconds * auto_scale_lower_threshold_ && scale > settings::constants::min_world_render_scale) {
+        scale = std::max(scale - auto_scale_step_, settings::constants::min_world_render_scale);
+        this->cooldown_remaining_ = auto_scale_cooldown_seconds_;
+        SPDLOG_DEBUG("Frame time '{}' s exceeds budget '{}' s, lowered world render scale to '{}'", this->smoothed_frame_time_, budget_seconds, scale);
+    }
+    else if (this->smoothed_frame_time_ < budget_seconds * auto_scale_raise_threshold_ && scale < 1.0f) {
+        scale = std::min(scale + auto_scale_step_, 1.0f);
+        this->cooldown_remaining_ = auto_scale_cooldown_seconds_;
+        SPDLOG_DEBUG("Frame time '{}' s is well under budget '{}' s, raised world render scale to '{}'", this->smoothed_frame_time_, budget_seconds, scale);
+    }
+}
+
+sf::RenderTexture *ResolutionScaler::begin_world_pass(const sf::Vector2u &window_size,
+                                                      const sf::View &camera_view,
+                                                      const sf::Color &clear_color)
+{
+    // Snapshot the scale for this frame, so begin and end agree even if the settings change mid-frame
+    this->applied_scale_ = std::clamp(settings::current::world_render_scale, settings::constants::min_world_render_scale, 1.0f);
+    if (this->applied_scale_ >= 1.0f) {
+        // Native resolution: the caller should draw directly into the window
+        return nullptr;
+    }
+
+    // Recreate the texture only when the required size changes (window resize or scale adjustment)
+    const sf::Vector2u scaled_size{std::max(1u, static_cast<unsigned>(static_cast<float>(window_size.x) * this->applied_scale_)),
+                                   std::max(1u, static_cast<unsigned>(static_cast<float>(window_size.y) * this->applied_scale_))};
+    if (scaled_size != this->texture_size_) {
+        // Keep the world's anti-aliasing level; the savings come from fill, not from dropping MSAA
+        const sf::ContextSettings context_settings{.antiAliasingLevel = settings::constants::anti_aliasing_values[settings::current::anti_aliasing_idx]};
+        if (!this->texture_.resize(scaled_size, context_settings)) {
+            SPDLOG_WARN("Failed to resize world render texture to '{}x{}', falling back to native resolution!", scaled_size.x, scaled_size.y);
+            this->texture_size_ = {};
+            this->applied_scale_ = 1.0f;
+            return nullptr;
+        }
+        this->texture_.setSmooth(true);  // Bilinear filtering hides the upscale at racing speed
+        this->texture_size_ = scaled_size;
+        SPDLOG_DEBUG("World render texture resized to '{}x{}' (scale '{}')", scaled_size.x, scaled_size.y, this->applied_scale_);
+    }
+
+    // Views use normalized viewports, so the camera view maps onto the smaller texture unchanged
+    this->texture_.setView(camera_view);
+    this->texture_.clear(clear_color);
+    return &this->texture_;
+}
+
+void ResolutionScaler::end_world_pass(sf::RenderTarget &window)
+{
+    this->texture_.display();
+
+    // Blit in window pixel coordinates, then put the camera view back for whoever draws next
+    this->saved_view_ = window.getView();
+    window.setView(window.getDefaultView());
+    sf::Sprite sprite{this->texture_.getTexture()};
+    // Derive the scale from the actual sizes rather than "applied_scale_"; integer truncation of the texture size would otherwise leave a sliver of uncovered window edge
+    const sf::Vector2f target_size = to_vector2f(window.getSize());
+    sprite.setScale({target_size.x / static_cast<float>(this->texture_size_.x),
+                     target_size.y / static_cast<float>(this->texture_size_.y)});
+    window.draw(sprite);
+    window.setView(this->saved_view_);
+}
+
+bool QualityGovernor::update(const float dt)
+{
+    if (!settings::current::auto_quality) {
+        // Hand the user their settings back if the governor had degraded them before being switched off
+        bool anti_aliasing_changed = false;
+        while (this->level_ > 0) {
+            anti_aliasing_changed = anti_aliasing_changed || this->level_ == max_level_;
+            this->restore_one();
+        }
+        return anti_aliasing_changed;
+    }
+
+    // Same exponential smoothing as the resolution scaler; a single slow frame (e.g., a track rebuild) must not drop a rung
+    constexpr float smoothing_factor = 0.1f;
+    this->smoothed_frame_time_ += (dt - this->smoothed_frame_time_) * smoothing_factor;
+
+    this->cooldown_remaining_ -= dt;
+    if (this->cooldown_remaining_ > 0.0f) {
+        return false;
+    }
+
+    // Budget implied by the FPS limit; under vsync or an unlimited cap, assume a 60 Hz display
+    const unsigned fps_limit = settings::constants::fps_values[settings::current::fps_idx];
+    const float budget_seconds = (settings::current::vsync || fps_limit == 0) ? (1.0f / 60.0f) : (1.0f / static_cast<float>(fps_limit));
+
+    // The continuous render scale is the first responder; only take a rung once it has bottomed out (or its auto mode is off)
+    const bool scale_exhausted = !settings::current::world_render_auto_scale ||
+                                 settings::current::world_render_scale <= settings::constants::min_world_render_scale;
+
+    if (this->smoothed_frame_time_ > budget_seconds * degrade_threshold_ && scale_exhausted && this->level_ < max_level_) {
+        this->degrade();
+        this->cooldown_remaining_ = degrade_cooldown_seconds_;
+        SPDLOG_DEBUG("Frame time '{}' s exceeds budget '{}' s with the render scale exhausted, degraded quality to level '{}'", this->smoothed_frame_time_, budget_seconds, this->level_);
+        return this->level_ == max_level_;  // The last rung is anti-aliasing, which needs a window recreate
+    }
+    if (this->smoothed_frame_time_ < budget_seconds * restore_threshold_ && this->level_ > 0) {
+        const bool anti_aliasing_changed = this->level_ == max_level_;
+        this->restore_one();
+        this->cooldown_remaining_ = restore_cooldown_seconds_;
+        SPDLOG_DEBUG("Frame time '{}' s is well under budget '{}' s, restored quality to level '{}'", this->smoothed_frame_time_, budget_seconds, this->level_);
+        return anti_aliasing_changed;
+    }
+    return false;
+}
+
+void QualityGovernor::degrade()
+{
+    ++this->level_;
+    switch (this->level_) {
+    case 1:
+        this->saved_tire_marks_rate_ = settings::current::tire_marks_rate;
+        settings::current::tire_marks_rate = std::min(settings::current::tire_marks_rate, degraded_tire_marks_rate_);
+        break;
+    case 2:
+        this->saved_particles_ = settings::current::particles;
+        settings::current::particles = false;
+        break;
+    case 3:
+        this->saved_tire_marks_ = settings::current::tire_marks;
+        settings::current::tire_marks = false;
+        break;
+    default:
+        this->saved_anti_aliasing_idx_ = settings::current::anti_aliasing_idx;
+        settings::current::anti_aliasing_idx = 0;
+        break;
+    }
+}
+
+void QualityGovernor::restore_one()
+{
+    // Each rung restores the exact value snapshotted by "degrade()", so turning the governor off leaves no trace in the user's settings
+    switch (this->level_) {
+    case 1:
+        settings::current::tire_marks_rate = this->saved_tire_marks_rate_;
+        break;
+    case 2:
+        settings::current::particles = this->saved_particles_;
+        break;
+    case 3:
+        settings::current::tire_marks = this->saved_tire_marks_;
+        break;
+    default:
+        settings::current::anti_aliasing_idx = this->saved_anti_aliasing_idx_;
+        break;
+    }
+    --this->level_;
+}
+
 Window::Window()
 {
     this->create();
@@ -32,24 +264,123 @@ void Window::recreate()
     SPDLOG_DEBUG("Window recreated successfully");
 }
 
+void Window::apply_settings()
+{
+    // Anti-aliasing is baked into the GL context at creation time; there is no in-place path for it
+    if (settings::current::anti_aliasing_idx != this->applied_anti_aliasing_idx_) {
+        SPDLOG_DEBUG("Anti-aliasing changed from index '{}' to '{}', recreating the window (the sample count lives in the GL context)", this->applied_anti_aliasing_idx_, settings::current::anti_aliasing_idx);
+        this->create();
+        return;
+    }
+
+    // SFML can only enter or leave fullscreen (or switch fullscreen resolutions) through "create()", so these also pay the full rebuild
+    if (settings::current::fullscreen != this->applied_fullscreen_ ||
+        (settings::current::fullscreen && settings::current::mode_idx != this->applied_mode_idx_)) {
+        SPDLOG_DEBUG("Fullscreen state or resolution changed, recreating the window");
+        this->create();
+        return;
+    }
+
+    // Everything else (V-sync, FPS cap) applies to the live window; no context drop, no stall, no flicker
+    this->apply_frame_rate_settings();
+    SPDLOG_DEBUG("Window settings applied in place, no recreation needed");
+}
+
 void Window::run(const event_callback_type &on_event,
+                 const fixed_update_callback_type &on_fixed_update,
                  const update_callback_type &on_update,
                  const render_callback_type &on_render)
 {
     SPDLOG_INFO("Starting main window loop!");
     sf::Clock clock;
+    float accumulator = 0.0f;
     while (this->window_.isOpen()) {
         // Allow user of this call to explicitly handle events themselves
         this->window_.handleEvents(on_event);
+
         // Prevent extreme dt by clamping to 0.1 seconds
         constexpr float dt_max = 0.1f;
         const float dt = std::min(clock.restart().asSeconds(), dt_max);
+
+        // Accumulate frame time and step the simulation at a fixed rate
+        // This keeps physics behavior identical regardless of the display refresh rate
+        accumulator += dt;
+        unsigned steps_performed = 0;
+        while (accumulator >= settings::constants::physics_timestep_seconds &&
+               steps_performed < settings::constants::max_physics_steps_per_frame) {
+            on_fixed_update(settings::constants::physics_timestep_seconds);
+            accumulator -= settings::constants::physics_timestep_seconds;
+            ++steps_performed;
+        }
+        // If the step cap was hit, drop the remaining time to avoid a death spiral
+        if (accumulator >= settings::constants::physics_timestep_seconds) [[unlikely]] {
+            SPDLOG_WARN("Physics step cap of '{}' reached, dropping '{}' seconds of simulation time!", settings::constants::max_physics_steps_per_frame, accumulator);
+            accumulator = 0.0f;
+        }
+
+        // Per-frame updates (UI, audio, widgets) run exactly once per frame
         on_update(dt);
-        on_render(this->window_);
+
+        // Interpolation alpha in [0, 1] describes how far we are between the previous and current physics states
+        const float interpolation_alpha = accumulator / settings::constants::physics_timestep_seconds;
+        on_render(this->window_, interpolation_alpha);
+
+        // Hold the frame until the target interval has elapsed (no-op under vsync or an unlimited cap)
+        this->frame_pacer_.pace();
     }
     SPDLOG_INFO("Main window loop ended!");
 }
 
+void Window::run_decoupled(const event_callback_type &on_event,
+                           const fixed_update_callback_type &on_fixed_update,
+                           const update_callback_type &on_update,
+                           const render_callback_type &on_render)
+{
+    SPDLOG_INFO("Starting decoupled window loop (simulation on a dedicated thread)!");
+
+    // Simulation thread: steps at the fixed timestep on the monotonic clock, independent of how long the GPU takes to finish a frame
+    std::jthread simulation_thread{[&on_fixed_update](const std::stop_token stop_token) {
+        const auto step_interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>{settings::constants::physics_timestep_seconds});
+        auto next_step = std::chrono::steady_clock::now() + step_interval;
+        while (!stop_token.stop_requested()) {
+            on_fixed_update(settings::constants::physics_timestep_seconds);
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now < next_step) {
+                std::this_thread::sleep_until(next_step);
+                next_step += step_interval;
+            }
+            else [[unlikely]] {
+                // The step overran the timestep; reset the schedule so the simulation slows down instead of fast-forwarding through a burst of catch-up steps
+                next_step = now + step_interval;
+            }
+        }
+    }};
+
+    // Window thread: events, per-frame updates, and rendering at the display's pace
+    sf::Clock clock;
+    while (this->window_.isOpen()) {
+        this->window_.handleEvents(on_event);
+
+        // Prevent extreme dt by clamping to 0.1 seconds
+        constexpr float dt_max = 0.1f;
+        const float dt = std::min(clock.restart().asSeconds(), dt_max);
+
+        on_update(dt);
+
+        // Alpha is fixed at 1.0; in this mode the renderer interpolates between snapshots itself
+        on_render(this->window_, 1.0f);
+
+        // Hold the frame until the target interval has elapsed (no-op under vsync or an unlimited cap)
+        this->frame_pacer_.pace();
+    }
+
+    // Stop and join the simulation thread before the callbacks go out of scope
+    simulation_thread.request_stop();
+    simulation_thread.join();
+    SPDLOG_INFO("Decoupled window loop ended!");
+}
+
 void Window::create()
 {
     // Create context settings with the current anti-aliasing level
@@ -107,30 +438,41 @@ void Window::create()
     this->window_.setMinimumSize(sf::Vector2u{settings::constants::windowed_min_width,
                                               settings::constants::windowed_min_height});
 
-    // Set FPS/vsync settings
+    // Set FPS/vsync settings; this is shared with "apply_settings()", which uses it as the in-place path
+    this->apply_frame_rate_settings();
+
+    // Remember what this window was created with, so "apply_settings()" can tell which changes need a rebuild
+    this->applied_anti_aliasing_idx_ = settings::current::anti_aliasing_idx;
+    this->applied_fullscreen_ = settings::current::fullscreen;
+    this->applied_mode_idx_ = settings::current::mode_idx;
+
+    // Log the successful creation of the window
+    SPDLOG_DEBUG("Window created successfully with mode '{}x{}', title '{}', state '{}', and context settings (anti-aliasing level: {})", mode.size.x, mode.size.y, window_title, state == sf::State::Fullscreen ? "fullscreen" : "windowed", settings.antiAliasingLevel);
+}
+
+void Window::apply_frame_rate_settings()
+{
+    // The frame pacer replaces SFML's "setFramerateLimit()", whose coarse sleeps cause visible pacing jitter at high refresh rates
     if (settings::current::vsync) {
-        // If vsync is enabled, disable FPS limit (0 = disabled)
-        this->window_.setFramerateLimit(0u);
+        // If vsync is enabled, the display drives the pace, so disable the pacer
+        this->frame_pacer_.set_target_fps(0u);
         // Then, enable vsync
         this->window_.setVerticalSyncEnabled(true);
-        SPDLOG_DEBUG("Disabled FPS limit and enabled V-sync");
+        SPDLOG_DEBUG("Disabled frame pacer and enabled V-sync");
     }
     else {
         // If vsync is disabled, disable vsync
         this->window_.setVerticalSyncEnabled(false);
-        // Then, get the FPS limit and enable it
+        // Then, get the FPS limit and hand it to the pacer
         const unsigned fps_limit = settings::constants::fps_values[settings::current::fps_idx];
 
         if (fps_limit == 0) {
             SPDLOG_WARN("FPS limit is set to '0', which means no limit!");
         }
 
-        this->window_.setFramerateLimit(fps_limit);
-        SPDLOG_DEBUG("Enabled '{}' FPS limit and disabled V-sync", fps_limit);
+        this->frame_pacer_.set_target_fps(fps_limit);
+        SPDLOG_DEBUG("Enabled '{}' FPS frame pacer and disabled V-sync", fps_limit);
     }
-
-    // Log the successful creation of the window
-    SPDLOG_DEBUG("Window created successfully with mode '{}x{}', title '{}', state '{}', and context settings (anti-aliasing level: {})", mode.size.x, mode.size.y, window_title, state == sf::State::Fullscreen ? "fullscreen" : "windowed", settings.antiAliasingLevel);
 }
 
 sf::Vector2f to_vector2f(const sf::Vector2u &vector)
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <chrono>      // for std::chrono
 #include <functional>  // for std::function
 #include <vector>      // for std::vector
 
@@ -13,25 +14,332 @@
 
 namespace core::backend {
 
+/**
+ * @brief Class that paces the main loop to a target frame rate with a hybrid sleep/spin wait.
+ *
+ * SFML's "setFramerateLimit()" relies on coarse OS sleeps, which overshoot by a scheduler quantum and produce visible pacing jitter at high refresh rates. This pacer instead sleeps for most of the frame interval and spin-waits the last fraction on a monotonic clock, delivering frames within microseconds of the target. When "settings::current::low_power_pacing" is enabled, the spin-wait is skipped and the pacer sleeps the whole interval, trading pacing precision for battery life.
+ *
+ * @note Deadlines advance by exact multiples of the frame interval, so occasional overshoot in one frame is absorbed by the next instead of accumulating drift. If a frame overruns its whole interval, the schedule resets to "now" rather than trying to catch up.
+ */
+class FramePacer final {
+  public:
+    /**
+     * @brief Set the target frame rate.
+     *
+     * @param fps Target frames per second; "0" disables pacing entirely (e.g., vsync or an unlimited FPS cap).
+     */
+    void set_target_fps(const unsigned fps);
+
+    /**
+     * @brief Enable or disable the idle mode used while a near-static screen (menu, pause) is shown.
+     *
+     * While idle, the pacer caps the frame rate at "idle_fps_" regardless of the configured FPS limit (including unlimited and vsync-driven configurations) and sleeps the whole interval instead of spin-waiting, since a static screen gains nothing from microsecond-accurate delivery.
+     *
+     * @param idle Whether the idle cap should be active.
+     */
+    void set_idle(const bool idle);
+
+    /**
+     * @brief Block until the next frame deadline, then advance the schedule by one frame interval.
+     *
+     * This sleeps until shortly before the deadline and spin-waits the remainder, unless "settings::current::low_power_pacing" is enabled, in which case it sleeps the whole way. If pacing is disabled or the deadline has already passed, it returns immediately.
+     *
+     * @note Call this once per frame, after the frame has been presented (i.e., after "display()").
+     */
+    void pace();
+
+  private:
+    /**
+     * @brief How long before the deadline the pacer stops sleeping and starts spin-waiting.
+     *
+     * 2 ms comfortably covers the sleep overshoot of desktop schedulers (~1 ms timer resolution on Windows, similar on Linux) without burning a meaningful share of the frame.
+     */
+    static constexpr std::chrono::microseconds spin_window_{2000};
+
+    /**
+     * @brief Frame rate the pacer drops to while idle; plenty for menu hover feedback, and a fraction of the power draw of an uncapped loop.
+     */
+    static constexpr unsigned idle_fps_ = 30;
+
+    /**
+     * @brief Duration of one frame at the target rate; zero means pacing is disabled.
+     */
+    std::chrono::steady_clock::duration frame_interval_{};
+
+    /**
+     * @brief Whether the idle cap is active; set per frame by the application based on the game state.
+     */
+    bool idle_ = false;
+
+    /**
+     * @brief Deadline for the frame currently being produced.
+     */
+    std::chrono::steady_clock::time_point next_deadline_{};
+};
+
+/**
+ * @brief Class that renders the world pass at a reduced resolution and upscales it to the window.
+ *
+ * On large displays, native-resolution fill for the world pass (track, cars, effects) is the GPU bottleneck. When "settings::current::world_render_scale" is below "1.0", the world is drawn into a proportionally smaller render texture and blitted to the window as a single smoothed quad, cutting fill cost roughly quadratically; UI and ImGui keep rendering at native resolution on top. An optional auto mode ("settings::current::world_render_auto_scale") lowers the scale when the frame time exceeds the budget implied by the FPS limit and raises it back when there is headroom.
+ *
+ * @note The render texture is created lazily with the current anti-aliasing level and only recreated when the required size changes, so steady-state frames perform no allocation.
+ */
+class ResolutionScaler final {
+  public:
+    /**
+     * @brief Default constructor.
+     */
+    explicit ResolutionScaler() = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~ResolutionScaler() = default;
+
+    // Disable copy semantics - manages a GPU texture
+    ResolutionScaler(const ResolutionScaler &) = delete;
+    ResolutionScaler &operator=(const ResolutionScaler &) = delete;
+
+    // Disable move semantics - created once and used in place
+    ResolutionScaler(ResolutionScaler &&) = delete;
+    ResolutionScaler &operator=(ResolutionScaler &&) = delete;
+
+    /**
+     * @brief Adjust the render scale based on the smoothed frame time, if the auto mode is enabled.
+     *
+     * The scale is stepped down when the smoothed frame time exceeds the budget implied by the current FPS limit, and stepped back up when it sits comfortably below it. A short cooldown between adjustments prevents oscillation.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     *
+     * @note Call this once per frame. Does nothing when "settings::current::world_render_auto_scale" is disabled.
+     */
+    void update(const float dt);
+
+    /**
+     * @brief Begin a reduced-resolution world pass, if the current scale calls for one.
+     *
+     * This sizes the internal render texture to the window size multiplied by the current scale (recreating it only when that size changes), applies the provided camera view, and clears it with the provided color.
+     *
+     * @param window_size Current window size in pixels.
+     * @param camera_view Camera view to apply to the world pass; views use normalized viewports, so the same view works at any texture size.
+     * @param clear_color Color the world pass is cleared with.
+     *
+     * @return Pointer to the render texture the world should be drawn into, or "nullptr" if the world should be drawn directly into the window (scale is "1.0", or the texture could not be created).
+     *
+     * @note When this returns a texture, finish the pass with "end_world_pass()" after drawing into it.
+     */
+    [[nodiscard]] sf::RenderTexture *begin_world_pass(const sf::Vector2u &window_size,
+                                                      const sf::View &camera_view,
+                                                      const sf::Color &clear_color);
+
+    /**
+     * @brief Finish the world pass started by "begin_world_pass()" and upscale it into the window.
+     *
+     * This flushes the render texture and draws it as a single quad covering the whole window, then restores the view the window had before the blit.
+     *
+     * @param window Window to composite the world pass into.
+     */
+    void end_world_pass(sf::RenderTarget &window);
+
+    /**
+     * @brief Get the scale that the current world pass is rendered at.
+     *
+     * @return Scale factor in the range ["settings::constants::min_world_render_scale", 1.0].
+     */
+    [[nodiscard]] float get_scale() const { return this->applied_scale_; }
+
+  private:
+    /**
+     * @brief Step size for automatic scale adjustments.
+     */
+    static constexpr float auto_scale_step_ = 0.05f;
+
+    /**
+     * @brief Seconds between automatic scale adjustments; long enough for the smoothed frame time to reflect the previous step.
+     */
+    static constexpr float auto_scale_cooldown_seconds_ = 0.5f;
+
+    /**
+     * @brief The scale is lowered when the smoothed frame time exceeds this fraction of the budget.
+     */
+    static constexpr float auto_scale_lower_threshold_ = 1.05f;
+
+    /**
+     * @brief The scale is raised when the smoothed frame time drops below this fraction of the budget; the gap to the lower threshold is the hysteresis that prevents flip-flopping.
+     */
+    static constexpr float auto_scale_raise_threshold_ = 0.70f;
+
+    /**
+     * @brief Render texture the world pass is drawn into when the scale is below "1.0".
+     */
+    sf::RenderTexture texture_;
+
+    /**
+     * @brief Size the render texture was last created at; "{0, 0}" until first use.
+     */
+    sf::Vector2u texture_size_{};
+
+    /**
+     * @brief Scale the current world pass is rendered at; snapshotted in "begin_world_pass()" so a mid-frame settings change cannot desync begin and end.
+     */
+    float applied_scale_ = 1.0f;
+
+    /**
+     * @brief View the window had before the upscale blit; restored by "end_world_pass()".
+     */
+    sf::View saved_view_;
+
+    /**
+     * @brief Exponentially smoothed frame time in seconds, used by the auto mode.
+     */
+    float smoothed_frame_time_ = 0.0f;
+
+    /**
+     * @brief Seconds remaining until the auto mode may adjust the scale again.
+     */
+    float cooldown_remaining_ = 0.0f;
+};
+
+/**
+ * @brief Class that steps effect density and anti-aliasing down (and back up) to hold a frame-time budget.
+ *
+ * The resolution scaler handles the continuous, cheap knob; this governor owns the discrete ladder behind it. When "settings::current::auto_quality" is enabled and the smoothed frame time stays over the budget implied by the FPS limit even though the render scale has bottomed out, it degrades one rung at a time: tire mark rate, then particles, then tire marks, then anti-aliasing. Recovery walks the same ladder in reverse with a much larger headroom requirement and a longer cooldown, so the quality level cannot flip-flop around the budget. The user's own settings are snapshotted before the first step and restored exactly when the ladder returns to the top.
+ */
+class QualityGovernor final {
+  public:
+    /**
+     * @brief Default constructor.
+     */
+    explicit QualityGovernor() = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~QualityGovernor() = default;
+
+    // Disable copy semantics
+    QualityGovernor(const QualityGovernor &) = delete;
+    QualityGovernor &operator=(const QualityGovernor &) = delete;
+
+    // Disable move semantics
+    QualityGovernor(QualityGovernor &&) = delete;
+    QualityGovernor &operator=(QualityGovernor &&) = delete;
+
+    /**
+     * @brief Compare the smoothed frame time against the budget and step the quality ladder if needed.
+     *
+     * @param dt Frame time of the current frame in seconds.
+     *
+     * @return True if the anti-aliasing index changed (the caller must call "Window::apply_settings()", because the sample count lives in the GL context); false otherwise.
+     *
+     * @note Call this once per frame. Does nothing when "settings::current::auto_quality" is disabled, except restore the snapshotted settings if the governor had degraded them.
+     */
+    [[nodiscard]] bool update(const float dt);
+
+    /**
+     * @brief Get the current rung of the quality ladder.
+     *
+     * @return "0" at full (user-configured) quality, up to "4" with every knob stepped down. Intended for telemetry and diagnostics.
+     */
+    [[nodiscard]] int get_level() const { return this->level_; }
+
+  private:
+    /**
+     * @brief Apply one rung of the ladder in the degrade direction.
+     */
+    void degrade();
+
+    /**
+     * @brief Undo one rung of the ladder, restoring the snapshotted user value for that knob.
+     */
+    void restore_one();
+
+    /**
+     * @brief Number of rungs on the ladder: tire mark rate, particles, tire marks, anti-aliasing.
+     */
+    static constexpr int max_level_ = 4;
+
+    /**
+     * @brief Quality is degraded when the smoothed frame time exceeds this fraction of the budget; above the scaler's lower threshold, so the render scale always reacts first.
+     */
+    static constexpr float degrade_threshold_ = 1.10f;
+
+    /**
+     * @brief Quality is restored when the smoothed frame time drops below this fraction of the budget; the wide gap to the degrade threshold is the hysteresis that keeps the ladder from oscillating.
+     */
+    static constexpr float restore_threshold_ = 0.60f;
+
+    /**
+     * @brief Seconds between degrade steps; long enough for the smoothed frame time to reflect the previous step.
+     */
+    static constexpr float degrade_cooldown_seconds_ = 2.0f;
+
+    /**
+     * @brief Seconds between restore steps; deliberately longer than the degrade cooldown, so recovering quality is slow and losing it is fast.
+     */
+    static constexpr float restore_cooldown_seconds_ = 5.0f;
+
+    /**
+     * @brief Tire mark spawn rate applied on the first rung, in Hz; capped at the user's own value.
+     */
+    static constexpr int degraded_tire_marks_rate_ = 30;
+
+    /**
+     * @brief Exponentially smoothed frame time in seconds; mirrors the resolution scaler's smoothing, so one slow frame cannot drop a rung.
+     */
+    float smoothed_frame_time_ = 0.0f;
+
+    /**
+     * @brief Seconds remaining until the next step may be taken.
+     */
+    float cooldown_remaining_ = 0.0f;
+
+    /**
+     * @brief Current rung of the ladder; "0" means every setting holds the user's own value.
+     */
+    int level_ = 0;
+
+    /**
+     * @brief User's tire mark rate before the governor touched it.
+     */
+    int saved_tire_marks_rate_ = 0;
+
+    /**
+     * @brief User's particles toggle before the governor touched it.
+     */
+    bool saved_particles_ = true;
+
+    /**
+     * @brief User's tire marks toggle before the governor touched it.
+     */
+    bool saved_tire_marks_ = true;
+
+    /**
+     * @brief User's anti-aliasing index before the governor touched it.
+     */
+    int saved_anti_aliasing_idx_ = 0;
+};
+
 /**
  * @brief SFML window abstraction class with automatic settings management.
  *
  * On construction, the window is created based on the settings defined in "settings.hpp".
  *
- * @note To apply setting changes at runtime, modify the values in "settings.hpp" and call "recreate()".
+ * @note To apply setting changes at runtime, modify the values in "settings.hpp" and call "apply_settings()"; it applies what it can in place and only recreates the window when the change requires a new GL context.
  */
 class Window {
   public:
     using event_callback_type = std::function<void(const sf::Event &)>;
+    using fixed_update_callback_type = std::function<void(const float)>;
     using update_callback_type = std::function<void(const float)>;
-    using render_callback_type = std::function<void(sf::RenderWindow &)>;
+    using render_callback_type = std::function<void(sf::RenderWindow &, const float)>;
 
     /**
      * @brief Construct a new SFML window based on current settings.
      *
      * This reads configuration from "settings.hpp" and creates the window with appropriate video mode, anti-aliasing, frame rate settings, and window constraints.
      *
-     * @note The window is immediately ready for use. To change settings later, modify values in "settings.hpp" and call "recreate()".
+     * @note The window is immediately ready for use. To change settings later, modify values in "settings.hpp" and call "apply_settings()".
      */
     explicit Window();
 
@@ -55,10 +363,26 @@ class Window {
      *
      * @note This causes a brief window flicker during recreation, as the old window is closed and a new one is created.
      *
-     * @details This is an alias for the "create()" method. The goal is to make the class more intuitive to use.
+     * @details This is an alias for the "create()" method. The goal is to make the class more intuitive to use. Prefer "apply_settings()", which only falls back to recreation when the change actually requires it.
      */
     void recreate();
 
+    /**
+     * @brief Apply the current settings from "settings.hpp" to the live window, recreating it only when unavoidable.
+     *
+     * The settings are diffed against the state the window was last created with. V-sync and the FPS cap are applied in place ("setVerticalSyncEnabled()" plus the frame pacer), which is the common case for in-game tweaks. Entering or leaving fullscreen and switching fullscreen resolutions go through SFML's "create()", which has no in-place path, and an anti-aliasing change always rebuilds the window because the sample count lives in the GL context.
+     *
+     * @note Full recreation drops the GL context, stalls for hundreds of milliseconds, and flickers; this method exists so a change as small as the FPS cap does not pay that cost.
+     */
+    void apply_settings();
+
+    /**
+     * @brief Enable or disable the frame pacer's idle cap; see "FramePacer::set_idle()".
+     *
+     * @param idle Whether the idle cap should be active.
+     */
+    void set_idle(const bool idle) { this->frame_pacer_.set_idle(idle); }
+
     /**
      * @brief Get direct access to the underlying SFML RenderWindow.
      *
@@ -76,16 +400,39 @@ class Window {
     /**
      * @brief Run the main application loop with provided callbacks.
      *
+     * Frame time is accumulated and the simulation is stepped at the fixed rate defined by "settings::constants::physics_timestep_seconds" (e.g., 120Hz), so physics behavior does not depend on the display refresh rate. The render callback receives an interpolation alpha in the range [0, 1] describing how far the current frame sits between the previous and current physics states.
+     *
      * @param on_event Callback function for handling SFML events.
-     * @param on_update Callback function for updating game state (receives delta time).
-     * @param on_render Callback function for rendering (receives render window reference).
+     * @param on_fixed_update Callback function for stepping the simulation (receives the fixed timestep). May be called zero or multiple times per frame.
+     * @param on_update Callback function for per-frame updates such as UI and audio (receives the variable frame delta time). Called exactly once per frame.
+     * @param on_render Callback function for rendering (receives the render window reference and the interpolation alpha).
      *
-     * @note The loop continues until the window is closed. Delta time is clamped to prevent extreme values.
+     * @note The loop continues until the window is closed. Frame delta time is clamped to prevent extreme values, and the number of fixed steps per frame is capped to avoid a death spiral on slow machines.
      */
     void run(const event_callback_type &on_event,
+             const fixed_update_callback_type &on_fixed_update,
              const update_callback_type &on_update,
              const render_callback_type &on_render);
 
+    /**
+     * @brief Run the main application loop with the simulation decoupled onto a dedicated thread.
+     *
+     * Unlike "run()", the fixed update callback is driven by its own thread at a steady "settings::constants::physics_timestep_seconds" cadence, so a slow GPU frame (or anything else that stalls the window thread) never delays a physics step. The window thread keeps event handling, per-frame updates, and rendering, because SFML requires events to be polled on the thread that created the window and ImGui state is single-threaded.
+     *
+     * The two sides must not share mutable state directly: the fixed update callback should publish a compact draw snapshot (entity transforms, effect instances, camera) through a "core::snapshot::TripleBuffer", and the update/render callbacks should read only from that channel. Anything the callbacks touch from both threads outside such a channel is a data race.
+     *
+     * @param on_event Callback function for handling SFML events. Runs on the window thread.
+     * @param on_fixed_update Callback function for stepping the simulation (receives the fixed timestep). Runs on the dedicated simulation thread at a steady cadence.
+     * @param on_update Callback function for per-frame updates such as UI and audio (receives the variable frame delta time). Runs on the window thread, exactly once per frame.
+     * @param on_render Callback function for rendering (receives the render window reference and an interpolation alpha that is always "1.0"; in this mode, interpolation between the two newest snapshots is the renderer's job, using whatever timing data the snapshots carry).
+     *
+     * @note The loop continues until the window is closed; the simulation thread is stopped and joined before this method returns. If a simulation step overruns the timestep, the schedule resets instead of bursting catch-up steps, so a long stall slows the simulation down rather than fast-forwarding it.
+     */
+    void run_decoupled(const event_callback_type &on_event,
+                       const fixed_update_callback_type &on_fixed_update,
+                       const update_callback_type &on_update,
+                       const render_callback_type &on_render);
+
     /**
      * @brief Reference to all available fullscreen video modes (resolutions).
      *
@@ -106,12 +453,41 @@ class Window {
      */
     void create();
 
+    /**
+     * @brief Configure V-sync and the frame pacer from the current settings.
+     *
+     * Called by "create()" after the window exists and by "apply_settings()" for in-place changes.
+     */
+    void apply_frame_rate_settings();
+
     /**
      * @brief The underlying SFML RenderWindow instance.
      *
      * @note This can be accessed using the "raw()" method.
      */
     sf::RenderWindow window_;
+
+    /**
+     * @brief Frame pacer used instead of SFML's "setFramerateLimit()".
+     *
+     * @note Configured by "create()" from the current FPS/vsync settings, and invoked at the end of each iteration of "run()".
+     */
+    FramePacer frame_pacer_;
+
+    /**
+     * @brief Anti-aliasing index the window was last created with; a mismatch forces full recreation, because the sample count lives in the GL context.
+     */
+    int applied_anti_aliasing_idx_ = 0;
+
+    /**
+     * @brief Fullscreen state the window was last created with; toggling it has no in-place path in SFML.
+     */
+    bool applied_fullscreen_ = false;
+
+    /**
+     * @brief Fullscreen mode index the window was last created with; only compared while fullscreen, because windowed mode uses a fixed resolution.
+     */
+    int applied_mode_idx_ = 0;
 };
 
 /**
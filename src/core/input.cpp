@@ -21,85 +21,121 @@ Gamepad::Gamepad(const unsigned int id,
     SPDLOG_DEBUG("Initialized Gamepad with ID '{}' and deadzone '{}'", this->id_, this->deadzone_);
 }
 
-bool Gamepad::is_connected() const
+void Gamepad::poll()
 {
-    return sf::Joystick::isConnected(this->id_);
-}
+    // Start from a neutral snapshot, so a disconnected gamepad reads as no input everywhere
+    this->snapshot_ = {};
+    this->snapshot_.connected = sf::Joystick::isConnected(this->id_);
+    if (!this->snapshot_.connected) {
+        // Axis availability can change across a reconnect (or a different pad), so the mapping must be re-resolved then
+        this->mapping_valid_ = false;
+        return;
+    }
 
-float Gamepad::get_gas() const
-{
-    // Cast to axis from settings
-    const sf::Joystick::Axis gas_axis = static_cast<sf::Joystick::Axis>(settings::current::gamepad_gas_axis);
+    // Re-bake the axis mapping only when the settings changed; the steady-state path is a few integer compares
+    this->refresh_mapping_if_changed();
 
-    // If not available, exit early
-    if (!sf::Joystick::hasAxis(this->id_, gas_axis)) {
-        return 0.0f;
+    this->snapshot_.button_count = sf::Joystick::getButtonCount(this->id_);
+
+    if (this->mapping_.gas_available) {
+        // Take only negative values and flip them, then normalize, apply deadzone, and honor the inversion setting
+        const float axis_value = sf::Joystick::getAxisPosition(this->id_, this->mapping_.gas_axis);
+        const float normalized_value = this->apply_deadzone(std::max(0.0f, -axis_value) / 100.0f);
+        this->snapshot_.gas = this->mapping_.invert_gas ? (1.0f - normalized_value) : normalized_value;
     }
 
-    // Get the axis value, take only negative values and flip it
-    const float axis_value = sf::Joystick::getAxisPosition(this->id_, gas_axis);
-    float normalized_value = std::max(0.0f, -axis_value) / 100.0f;
+    if (this->mapping_.brake_available) {
+        // Take only positive values, then normalize, apply deadzone, and honor the inversion setting
+        const float axis_value = sf::Joystick::getAxisPosition(this->id_, this->mapping_.brake_axis);
+        const float normalized_value = this->apply_deadzone(std::max(0.0f, axis_value) / 100.0f);
+        this->snapshot_.brake = this->mapping_.invert_brake ? (1.0f - normalized_value) : normalized_value;
+    }
 
-    // Apply deadzone to prevent accidental input
-    normalized_value = this->apply_deadzone(normalized_value);
+    if (this->mapping_.steering_available) {
+        // Take the full signed range, then normalize, apply deadzone, and honor the inversion setting
+        const float axis_value = sf::Joystick::getAxisPosition(this->id_, this->mapping_.steering_axis);
+        const float normalized_value = this->apply_deadzone(std::clamp(axis_value / 100.0f, -1.0f, 1.0f));
+        this->snapshot_.steer = this->mapping_.invert_steering ? -normalized_value : normalized_value;
+    }
 
-    // If flipped in settings, flip the value again
-    return settings::current::gamepad_invert_gas ? (1.0f - normalized_value) : normalized_value;
+    this->snapshot_.handbrake = this->snapshot_.button_count > this->mapping_.handbrake_button &&
+                                sf::Joystick::isButtonPressed(this->id_, this->mapping_.handbrake_button);
 }
 
-float Gamepad::get_brake() const
+bool Gamepad::is_connected() const
 {
-    // Cast to axis from settings
-    const sf::Joystick::Axis brake_axis = static_cast<sf::Joystick::Axis>(settings::current::gamepad_brake_axis);
-
-    // If not available, exit early
-    if (!sf::Joystick::hasAxis(this->id_, brake_axis)) {
-        return 0.0f;
-    }
-
-    // Get the axis value, take only positive values
-    const float axis_value = sf::Joystick::getAxisPosition(this->id_, brake_axis);
-    float normalized_value = std::max(0.0f, axis_value) / 100.0f;
+    return this->snapshot_.connected;
+}
 
-    // Apply deadzone to prevent accidental input
-    normalized_value = this->apply_deadzone(normalized_value);
+float Gamepad::get_gas() const
+{
+    return this->snapshot_.gas;
+}
 
-    // If flipped in settings, flip the value
-    return settings::current::gamepad_invert_brake ? (1.0f - normalized_value) : normalized_value;
+float Gamepad::get_brake() const
+{
+    return this->snapshot_.brake;
 }
 
 float Gamepad::get_steer() const
 {
-    // Cast to axis from settings
-    const sf::Joystick::Axis steering_axis = static_cast<sf::Joystick::Axis>(settings::current::gamepad_steering_axis);
-
-    // If not available, exit early
-    if (!sf::Joystick::hasAxis(this->id_, steering_axis)) {
-        return 0.0f;
-    }
-
-    // Get the axis value, take all values
-    const float percent = sf::Joystick::getAxisPosition(this->id_, steering_axis);
-    float normalized_value = std::clamp(percent / 100.0f, -1.0f, 1.0f);
-
-    // Apply deadzone to prevent accidental input
-    normalized_value = this->apply_deadzone(normalized_value);
-
-    // If flipped in settings, flip the value
-    return settings::current::gamepad_invert_steering ? -normalized_value : normalized_value;
+    return this->snapshot_.steer;
 }
 
 bool Gamepad::get_handbrake() const
 {
-    // Cast to unsigned int from settings
-    const unsigned int button_index = static_cast<unsigned int>(settings::current::gamepad_handbrake_button);
-    return sf::Joystick::getButtonCount(this->id_) > button_index &&
-           sf::Joystick::isButtonPressed(this->id_, button_index);
+    return this->snapshot_.handbrake;
 }
 
 unsigned int Gamepad::get_button_count() const
 {
-    return sf::Joystick::getButtonCount(this->id_);
+    return this->snapshot_.button_count;
+}
+
+void Gamepad::refresh_mapping_if_changed()
+{
+    // Cheap change detection against the raw settings values the mapping was resolved from
+    if (this->mapping_valid_ &&
+        this->mapping_source_.steering_axis == settings::current::gamepad_steering_axis &&
+        this->mapping_source_.gas_axis == settings::current::gamepad_gas_axis &&
+        this->mapping_source_.brake_axis == settings::current::gamepad_brake_axis &&
+        this->mapping_source_.handbrake_button == settings::current::gamepad_handbrake_button &&
+        this->mapping_source_.invert_steering == settings::current::gamepad_invert_steering &&
+        this->mapping_source_.invert_gas == settings::current::gamepad_invert_gas &&
+        this->mapping_source_.invert_brake == settings::current::gamepad_invert_brake) {
+        return;
+    }
+
+    // Remember what the mapping was resolved from
+    this->mapping_source_.steering_axis = settings::current::gamepad_steering_axis;
+    this->mapping_source_.gas_axis = settings::current::gamepad_gas_axis;
+    this->mapping_source_.brake_axis = settings::current::gamepad_brake_axis;
+    this->mapping_source_.handbrake_button = settings::current::gamepad_handbrake_button;
+    this->mapping_source_.invert_steering = settings::current::gamepad_invert_steering;
+    this->mapping_source_.invert_gas = settings::current::gamepad_invert_gas;
+    this->mapping_source_.invert_brake = settings::current::gamepad_invert_brake;
+
+    // Bake the casts and the axis availability, so "poll()" never touches the settings or "hasAxis()" again until something changes
+    this->mapping_.steering_axis = static_cast<sf::Joystick::Axis>(this->mapping_source_.steering_axis);
+    this->mapping_.gas_axis = static_cast<sf::Joystick::Axis>(this->mapping_source_.gas_axis);
+    this->mapping_.brake_axis = static_cast<sf::Joystick::Axis>(this->mapping_source_.brake_axis);
+    this->mapping_.handbrake_button = static_cast<unsigned int>(this->mapping_source_.handbrake_button);
+    this->mapping_.invert_steering = this->mapping_source_.invert_steering;
+    this->mapping_.invert_gas = this->mapping_source_.invert_gas;
+    this->mapping_.invert_brake = this->mapping_source_.invert_brake;
+    this->mapping_.steering_available = sf::Joystick::hasAxis(this->id_, this->mapping_.steering_axis);
+    this->mapping_.gas_available = sf::Joystick::hasAxis(this->id_, this->mapping_.gas_axis);
+    this->mapping_.brake_available = sf::Joystick::hasAxis(this->id_, this->mapping_.brake_axis);
+    this->mapping_valid_ = true;
+
+    SPDLOG_DEBUG("Resolved gamepad mapping: steering axis '{}' (available: '{}'), gas axis '{}' (available: '{}'), brake axis '{}' (available: '{}'), handbrake button '{}'",
+                 this->mapping_source_.steering_axis,
+                 this->mapping_.steering_available,
+                 this->mapping_source_.gas_axis,
+                 this->mapping_.gas_available,
+                 this->mapping_source_.brake_axis,
+                 this->mapping_.brake_available,
+                 this->mapping_source_.handbrake_button);
 }
 
 float Gamepad::apply_deadzone(const float value) const
@@ -6,14 +6,16 @@
 
 #pragma once
 
+#include <SFML/Window/Joystick.hpp>
+
 namespace core::input {
 
 /**
  * @brief Xbox controller abstraction with configurable axes and buttons.
  *
- * On construction, the member variables are initialized. Use the "is_connected()" method, then, if available, retrieve inputs using the provided methods. The values themselves can be modified in the "settings.hpp" file.
-
- * @note Always run "is_connected()" once per frame in the main game loop before using any input methods.
+ * On construction, the member variables are initialized. Call "poll()" once per frame to take a single snapshot of the joystick state; all getters then serve from that snapshot instead of querying sf::Joystick per call (joystick queries are not cheap on every platform, and the game reads four inputs per frame). The axis and button mapping from "settings.hpp" is baked into a resolved table that is only rebuilt when the settings actually change, not re-read per call.
+ *
+ * @note Always run "poll()" once per frame in the main game loop before using any of the getters.
  */
 class Gamepad {
   public:
@@ -38,48 +40,198 @@ class Gamepad {
     Gamepad &operator=(Gamepad &&) = delete;
 
     /**
-     * @brief Check if the gamepad is currently connected.
+     * @brief Take one snapshot of the joystick state (connection, axes, handbrake button, button count).
+     *
+     * This is the only method that touches sf::Joystick; every getter below reads the snapshot. The resolved axis mapping is refreshed first if the gamepad settings changed since the last poll.
+     *
+     * @note Call this once per frame, before any of the getters.
+     */
+    void poll();
+
+    /**
+     * @brief Check if the gamepad was connected at the last "poll()".
      *
      * @return True if the gamepad is connected, false otherwise.
      */
     [[nodiscard]] bool is_connected() const;
 
     /**
-     * @brief Get the gas input from the configured axis.
+     * @brief Get the gas input snapshotted by the last "poll()".
      *
      * @return Value in the [0.0, 1.0] range, where "0" is no throttle and "1" is full throttle.
      */
     [[nodiscard]] float get_gas() const;
 
     /**
-     * @brief Get the brake input from the configured axis.
+     * @brief Get the brake input snapshotted by the last "poll()".
      *
      * @return Value in the [0.0, 1.0] range, where "0" is no braking and "1" is full brake.
      */
     [[nodiscard]] float get_brake() const;
 
     /**
-     * @brief Get steering input from the configured axis.
+     * @brief Get the steering input snapshotted by the last "poll()".
      *
      * @return Value in the range [-1.0, 1.0] where "-1" is full left, "0" is center, and "1" is full right.
      */
     [[nodiscard]] float get_steer() const;
 
     /**
-     * @brief Get handbrake input from the configured button.
+     * @brief Get the handbrake input snapshotted by the last "poll()".
      *
      * @return True if the button is pressed, false otherwise.
      */
     [[nodiscard]] bool get_handbrake() const;
 
     /**
-     * @brief Get the number of available buttons on the gamepad.
+     * @brief Get the number of buttons reported at the last "poll()".
      *
      * @return Number of supported buttons.
      */
     [[nodiscard]] unsigned int get_button_count() const;
 
   private:
+    /**
+     * @brief Plain per-frame snapshot of the processed joystick state, mirroring the shape of the car input struct.
+     *
+     * Deadzone, normalization, and inversion are already applied, so the getters are straight field reads.
+     */
+    struct InputSnapshot final {
+        /**
+         * @brief Whether the gamepad was connected when the snapshot was taken.
+         */
+        bool connected = false;
+
+        /**
+         * @brief Gas input in the [0.0, 1.0] range.
+         */
+        float gas = 0.0f;
+
+        /**
+         * @brief Brake input in the [0.0, 1.0] range.
+         */
+        float brake = 0.0f;
+
+        /**
+         * @brief Steering input in the [-1.0, 1.0] range.
+         */
+        float steer = 0.0f;
+
+        /**
+         * @brief Whether the handbrake button was pressed.
+         */
+        bool handbrake = false;
+
+        /**
+         * @brief Number of buttons the gamepad reports.
+         */
+        unsigned int button_count = 0;
+    };
+
+    /**
+     * @brief Axis and button mapping resolved from "settings.hpp" once per settings change.
+     *
+     * The raw setting integers are cast to SFML types and the per-axis availability is queried here, so "poll()" does no casting, no settings reads, and no "hasAxis()" calls on the steady-state path.
+     */
+    struct ResolvedMapping final {
+        /**
+         * @brief Axis used for steering.
+         */
+        sf::Joystick::Axis steering_axis = sf::Joystick::Axis::X;
+
+        /**
+         * @brief Axis used for gas.
+         */
+        sf::Joystick::Axis gas_axis = sf::Joystick::Axis::X;
+
+        /**
+         * @brief Axis used for braking.
+         */
+        sf::Joystick::Axis brake_axis = sf::Joystick::Axis::X;
+
+        /**
+         * @brief Whether the gamepad reports the steering axis.
+         */
+        bool steering_available = false;
+
+        /**
+         * @brief Whether the gamepad reports the gas axis.
+         */
+        bool gas_available = false;
+
+        /**
+         * @brief Whether the gamepad reports the brake axis.
+         */
+        bool brake_available = false;
+
+        /**
+         * @brief Button index used for the handbrake.
+         */
+        unsigned int handbrake_button = 0;
+
+        /**
+         * @brief Whether the steering value is flipped.
+         */
+        bool invert_steering = false;
+
+        /**
+         * @brief Whether the gas value is flipped.
+         */
+        bool invert_gas = false;
+
+        /**
+         * @brief Whether the brake value is flipped.
+         */
+        bool invert_brake = false;
+    };
+
+    /**
+     * @brief Raw settings values the current mapping was resolved from, used to detect changes cheaply.
+     */
+    struct MappingSource final {
+        /**
+         * @brief Value of "settings::current::gamepad_steering_axis" at resolve time.
+         */
+        int steering_axis = -1;
+
+        /**
+         * @brief Value of "settings::current::gamepad_gas_axis" at resolve time.
+         */
+        int gas_axis = -1;
+
+        /**
+         * @brief Value of "settings::current::gamepad_brake_axis" at resolve time.
+         */
+        int brake_axis = -1;
+
+        /**
+         * @brief Value of "settings::current::gamepad_handbrake_button" at resolve time.
+         */
+        int handbrake_button = -1;
+
+        /**
+         * @brief Value of "settings::current::gamepad_invert_steering" at resolve time.
+         */
+        bool invert_steering = false;
+
+        /**
+         * @brief Value of "settings::current::gamepad_invert_gas" at resolve time.
+         */
+        bool invert_gas = false;
+
+        /**
+         * @brief Value of "settings::current::gamepad_invert_brake" at resolve time.
+         */
+        bool invert_brake = false;
+    };
+
+    /**
+     * @brief Rebuild the resolved mapping if the gamepad settings changed since the last resolve.
+     *
+     * This compares a handful of integers against the cached settings values, so the steady-state cost is negligible; the actual rebake (casts plus "hasAxis()" queries) only runs on a settings change or reconnection.
+     */
+    void refresh_mapping_if_changed();
+
     /**
      * @brief Apply deadzone to analog input.
      *
@@ -98,6 +250,26 @@ class Gamepad {
      * @brief Deadzone threshold for all analog inputs.
      */
     const float deadzone_;
+
+    /**
+     * @brief Snapshot of the processed joystick state taken by the last "poll()".
+     */
+    InputSnapshot snapshot_;
+
+    /**
+     * @brief Axis and button mapping resolved from the settings.
+     */
+    ResolvedMapping mapping_;
+
+    /**
+     * @brief Settings values the mapping was resolved from.
+     */
+    MappingSource mapping_source_;
+
+    /**
+     * @brief True while "mapping_" matches "mapping_source_" and the gamepad stayed connected; cleared on disconnect so a reconnect re-queries axis availability.
+     */
+    bool mapping_valid_ = false;
 };
 
 }  // namespace core::input
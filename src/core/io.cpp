@@ -4,14 +4,20 @@
 
 #include <algorithm>   // for std::clamp, std::max
 #include <array>       // for std::size
+#include <chrono>      // for std::chrono
 #include <cstdlib>     // for std::getenv
 #include <exception>   // for std::exception
 #include <filesystem>  // for std::filesystem
 #include <format>      // for std::format
 #include <fstream>     // for std::ofstream
 #include <ios>         // for std::ios
+#include <mutex>       // for std::lock_guard, std::unique_lock
+#include <sstream>     // for std::ostringstream
 #include <stdexcept>   // for std::runtime_error
+#include <stop_token>  // for std::stop_token
 #include <string>      // for std::string
+#include <thread>      // for std::jthread
+#include <utility>     // for std::move
 
 #include <spdlog/spdlog.h>
 #include <toml++/toml.hpp>
@@ -93,6 +99,14 @@ ConfigContext::ConfigContext(const std::string &filename)
             const int loaded_fps_idx = tbl["fps_idx"].value_or(settings::current::fps_idx);
             settings::current::fps_idx = std::clamp(loaded_fps_idx, 0, static_cast<int>(std::size(settings::constants::fps_values)) - 1);
 
+            settings::current::low_power_pacing = tbl["low_power_pacing"].value_or(settings::current::low_power_pacing);
+
+            // Clamp world_render_scale to valid range to keep hand-edited configs from requesting absurd render targets
+            const float loaded_world_render_scale = tbl["world_render_scale"].value_or(settings::current::world_render_scale);
+            settings::current::world_render_scale = std::clamp(loaded_world_render_scale, settings::constants::min_world_render_scale, 1.0f);
+            settings::current::world_render_auto_scale = tbl["world_render_auto_scale"].value_or(settings::current::world_render_auto_scale);
+            settings::current::auto_quality = tbl["auto_quality"].value_or(settings::current::auto_quality);
+
             // Clamp mode_idx to be non-negative (upper bound is checked in backend.cpp)
             const int loaded_mode_idx = tbl["mode_idx"].value_or(settings::current::mode_idx);
             settings::current::mode_idx = std::max(loaded_mode_idx, 0);
@@ -103,6 +117,18 @@ ConfigContext::ConfigContext(const std::string &filename)
 
             settings::current::tire_marks = tbl["tire_marks"].value_or(settings::current::tire_marks);
             settings::current::tire_marks_rate = tbl["tire_marks_rate"].value_or(settings::current::tire_marks_rate);
+            settings::current::particles = tbl["particles"].value_or(settings::current::particles);
+
+            // Clamp ai_car_count to valid range to keep hand-edited configs from spawning absurd grids
+            const int loaded_ai_car_count = tbl["ai_car_count"].value_or(settings::current::ai_car_count);
+            settings::current::ai_car_count = std::clamp(loaded_ai_car_count, settings::constants::min_ai_cars, settings::constants::max_ai_cars);
+
+            // Clamp player_count to valid range to keep hand-edited configs from requesting impossible viewport layouts
+            const int loaded_player_count = tbl["player_count"].value_or(settings::current::player_count);
+            settings::current::player_count = std::clamp(loaded_player_count, settings::constants::min_players, settings::constants::max_players);
+
+            settings::current::deterministic = tbl["deterministic"].value_or(settings::current::deterministic);
+            settings::current::track_seed = tbl["track_seed"].value_or(settings::current::track_seed);
 
             settings::current::prefer_gamepad = tbl["prefer_gamepad"].value_or(settings::current::prefer_gamepad);
             settings::current::gamepad_steering_axis = tbl["gamepad_steering_axis"].value_or(settings::current::gamepad_steering_axis);
@@ -117,45 +143,66 @@ ConfigContext::ConfigContext(const std::string &filename)
             settings::current::tire_screech_volume = tbl["tire_screech_volume"].value_or(settings::current::tire_screech_volume);
             settings::current::wall_hit_volume = tbl["wall_hit_volume"].value_or(settings::current::wall_hit_volume);
             settings::current::ui_volume = tbl["ui_volume"].value_or(settings::current::ui_volume);
+            settings::current::music_volume = tbl["music_volume"].value_or(settings::current::music_volume);
 
             SPDLOG_DEBUG("Config was loaded successfully!");
         }
         else {
-            this->save();
+            this->save_if_dirty();
             SPDLOG_DEBUG("Config file was missing, created with default values!");
         }
     }
     catch (const toml::parse_error &err) {
         SPDLOG_ERROR("Failed to parse TOML file '{}': {}", this->path_.string(), err.description());
-        this->save();
+        this->save_if_dirty();
     }
     catch (const std::exception &e) {
         SPDLOG_ERROR("Failed to loa TOML file '{}': {}", this->path_.string(), e.what());
-        this->save();
+        this->save_if_dirty();
     }
+
+    // Write the normalized state back once (e.g., clamped values), which also seeds the dirty detection baseline
+    this->save_if_dirty();
+
+    // All further saves happen on this thread; the game loop never touches the disk for the config again
+    this->autosave_thread_ = std::jthread([this](const std::stop_token stop_token) { this->autosave_loop(stop_token); });
 }
 
 ConfigContext::~ConfigContext() noexcept
 {
     try {
-        this->save();
+        // The stop request interrupts the autosave wait immediately, so shutdown never sits out a full interval
+        this->autosave_thread_.request_stop();
+        if (this->autosave_thread_.joinable()) {
+            this->autosave_thread_.join();
+        }
+
+        // Flush anything the last autosave pass missed; when nothing changed this is a string compare, so exit is no longer delayed by an unconditional write
+        this->save_if_dirty();
     }
     catch (...) {
     }
 }
 
-void ConfigContext::save() const noexcept
+std::string ConfigContext::serialize()
 {
-    //     SPDLOG_DEBUG("Now saving config to '{}'", this->path_.string());
-
     toml::table tbl;
     tbl.insert_or_assign("fullscreen", settings::current::fullscreen);
     tbl.insert_or_assign("vsync", settings::current::vsync);
     tbl.insert_or_assign("fps_idx", settings::current::fps_idx);
+    tbl.insert_or_assign("low_power_pacing", settings::current::low_power_pacing);
+    tbl.insert_or_assign("world_render_scale", settings::current::world_render_scale);
+    tbl.insert_or_assign("world_render_auto_scale", settings::current::world_render_auto_scale);
+    tbl.insert_or_assign("auto_quality", settings::current::auto_quality);
     tbl.insert_or_assign("mode_idx", settings::current::mode_idx);
     tbl.insert_or_assign("anti_aliasing_idx", settings::current::anti_aliasing_idx);
     tbl.insert_or_assign("tire_marks", settings::current::tire_marks);
     tbl.insert_or_assign("tire_marks_rate", settings::current::tire_marks_rate);
+    tbl.insert_or_assign("particles", settings::current::particles);
+    tbl.insert_or_assign("ai_car_count", settings::current::ai_car_count);
+    tbl.insert_or_assign("player_count", settings::current::player_count);
+    tbl.insert_or_assign("deterministic", settings::current::deterministic);
+    tbl.insert_or_assign("track_seed", settings::current::track_seed);
     tbl.insert_or_assign("prefer_gamepad", settings::current::prefer_gamepad);
     tbl.insert_or_assign("gamepad_steering_axis", settings::current::gamepad_steering_axis);
     tbl.insert_or_assign("gamepad_gas_axis", settings::current::gamepad_gas_axis);
@@ -168,14 +215,107 @@ void ConfigContext::save() const noexcept
     tbl.insert_or_assign("tire_screech_volume", settings::current::tire_screech_volume);
     tbl.insert_or_assign("wall_hit_volume", settings::current::wall_hit_volume);
     tbl.insert_or_assign("ui_volume", settings::current::ui_volume);
+    tbl.insert_or_assign("music_volume", settings::current::music_volume);
+
+    std::ostringstream oss;
+    oss << tbl;
+    return std::move(oss).str();
+}
 
-    std::ofstream ofs(this->path_, std::ios::trunc);
-    if (!ofs) {
-        SPDLOG_ERROR("Cannot open config file for writing: '{}'", this->path_.string());
+void ConfigContext::publish_snapshot()
+{
+    // Until the autosave interval elapses, this is a single clock read per frame
+    const auto now = std::chrono::steady_clock::now();
+    if (now - this->last_publish_time_ < ConfigContext::autosave_interval_) {
         return;
     }
-    ofs << tbl;
-    SPDLOG_DEBUG("Config was sucessfully saved to '{}'", this->path_.string());
+    this->last_publish_time_ = now;
+
+    // Serialize here, on the game thread that owns the settings; the autosave thread only ever sees the finished string
+    std::string serialized = ConfigContext::serialize();
+    {
+        const std::lock_guard<std::mutex> lock(this->mutex_);
+        this->pending_snapshot_ = std::move(serialized);
+    }
+    this->autosave_wakeup_.notify_one();
+}
+
+void ConfigContext::save_if_dirty() noexcept
+{
+    try {
+        this->save_snapshot_if_dirty(ConfigContext::serialize());
+    }
+    catch (const std::exception &e) {
+        SPDLOG_ERROR("Failed to save config file '{}': {}", this->path_.string(), e.what());
+    }
+}
+
+void ConfigContext::save_snapshot_if_dirty(std::string serialized) noexcept
+{
+    try {
+        // Nothing changed since the last successful save, don't touch the disk
+        if (serialized == this->last_saved_) {
+            return;
+        }
+
+        if (this->save_atomic(serialized)) {
+            this->last_saved_ = std::move(serialized);
+        }
+    }
+    catch (const std::exception &e) {
+        SPDLOG_ERROR("Failed to save config file '{}': {}", this->path_.string(), e.what());
+    }
+}
+
+bool ConfigContext::save_atomic(const std::string &serialized) const noexcept
+{
+    try {
+        // Write the full document to a temporary sibling first; the real file is only ever replaced by a complete one
+        std::filesystem::path temp_path = this->path_;
+        temp_path += ".tmp";
+        {
+            std::ofstream ofs(temp_path, std::ios::trunc);
+            if (!ofs) {
+                SPDLOG_ERROR("Cannot open temporary config file for writing: '{}'", temp_path.string());
+                return false;
+            }
+            ofs << serialized;
+            ofs.close();
+            if (!ofs) {
+                SPDLOG_ERROR("Failed to write temporary config file: '{}'", temp_path.string());
+                return false;
+            }
+        }
+
+        // Atomic on POSIX and done with MOVEFILE_REPLACE_EXISTING on Windows, so a power cut leaves either the old config or the new one, never a truncated file
+        std::filesystem::rename(temp_path, this->path_);
+        SPDLOG_DEBUG("Config was sucessfully saved to '{}'", this->path_.string());
+        return true;
+    }
+    catch (const std::exception &e) {
+        SPDLOG_ERROR("Failed to save config file '{}': {}", this->path_.string(), e.what());
+        return false;
+    }
+}
+
+void ConfigContext::autosave_loop(const std::stop_token stop_token)
+{
+    // This thread never reads the live settings (that would race the game thread's unsynchronized writes); it only consumes snapshots the game thread serialized and published via "publish_snapshot()"
+    std::unique_lock lock(this->mutex_);
+    while (!stop_token.stop_requested()) {
+        // Returns when a snapshot is pending or immediately on a stop request
+        this->autosave_wakeup_.wait(lock, stop_token, [this] { return !this->pending_snapshot_.empty(); });
+        if (stop_token.stop_requested()) {
+            break;
+        }
+        std::string snapshot = std::move(this->pending_snapshot_);
+        this->pending_snapshot_.clear();
+
+        // Drop the lock for the disk write, so a slow disk never blocks the game thread's next publish
+        lock.unlock();
+        this->save_snapshot_if_dirty(std::move(snapshot));
+        lock.lock();
+    }
 }
 
 }  // namespace core::io
@@ -6,8 +6,13 @@
 
 #pragma once
 
-#include <filesystem>  // for std::filesystem
-#include <string>      // for std::string
+#include <chrono>              // for std::chrono
+#include <condition_variable>  // for std::condition_variable_any
+#include <filesystem>          // for std::filesystem
+#include <mutex>               // for std::mutex
+#include <stop_token>          // for std::stop_token
+#include <string>              // for std::string
+#include <thread>              // for std::jthread
 
 #include "generated.hpp"
 
@@ -36,12 +41,12 @@ namespace core::io {
  *
  * On construction, the class attempts to load a TOML configuration file from a platform-specific application data directory, creating default values if the file is missing.
  *
- * The file is saved automatically on destruction.
+ * A background thread then autosaves the file, but only when the settings actually changed since the last save (dirty detection compares the serialized TOML text). The game thread owns the settings, so it serializes them itself via "publish_snapshot()" once per interval; the background thread only compares and writes the published snapshot. Every save writes to a temporary sibling file and renames it over the real one, so a crash or power cut leaves either the old config or the new one, never a truncated file. The game loop is never blocked by a save; the destructor only stops the thread and flushes the final dirty check, which is a cheap string compare when the last autosave already caught everything.
  */
 class ConfigContext {
   public:
     /**
-     * @brief Attempt to load a TOML configuration file from the platform-specific application data directory, creating default values if the file is missing.
+     * @brief Attempt to load a TOML configuration file from the platform-specific application data directory, creating default values if the file is missing, then start the background autosave thread.
      *
      * @param filename Name of the configuration file (default: "config.toml"). This filename will be appended to the platform-specific application data directory path (e.g., "~/Library/Application Support/MyApp/config.toml").
      */
@@ -50,7 +55,7 @@ class ConfigContext {
     /**
      * @brief Destroy the ConfigContext object.
      *
-     * On destruction, save the current configuration state to the TOML file.
+     * On destruction, stop the background autosave thread and save the current configuration state to the TOML file if it changed since the last autosave.
      */
     ~ConfigContext() noexcept;
 
@@ -58,22 +63,100 @@ class ConfigContext {
     ConfigContext(const ConfigContext &) = delete;
     ConfigContext &operator=(const ConfigContext &) = delete;
 
-    // Allow move construction but disable move assignment (due to const members)
-    ConfigContext(ConfigContext &&) = default;
+    // Disable move semantics - owns a background thread and synchronization primitives
+    ConfigContext(ConfigContext &&) = delete;
     ConfigContext &operator=(ConfigContext &&) = delete;
 
+    /**
+     * @brief Serialize the current settings on the calling thread and hand the snapshot to the autosave thread.
+     *
+     * The settings in "settings.hpp" are plain scalars written by the game thread without locking, so only the game thread may read them; reading them from the autosave thread would be a data race. Call this once per frame from the game loop: it is a clock read until the autosave interval elapses, then one serialization pass whose result the autosave thread compares and writes without ever touching the live settings.
+     */
+    void publish_snapshot();
+
   private:
     /**
-     * @brief Save the current configuration state to the TOML file.
+     * @brief Serialize the current configuration state ("settings::current") to TOML text.
+     *
+     * @return Serialized TOML document as a string.
+     */
+    [[nodiscard]] static std::string serialize();
+
+    /**
+     * @brief Save the current configuration state to the TOML file if it changed since the last successful save.
+     *
+     * Serializes the settings, compares against the last-saved text, and only touches the disk on a mismatch. Failures are logged only, so callers can stay noexcept.
      *
-     * Failures are logged only, so callers can stay noexcept.
+     * @note Serializing reads the live settings, so this may only run where no other thread mutates them: during construction (before the autosave thread starts) and during destruction (after it is joined). The autosave thread itself goes through "save_snapshot_if_dirty()" with a snapshot the game thread published.
      */
-    void save() const noexcept;
+    void save_if_dirty() noexcept;
+
+    /**
+     * @brief Save an already-serialized snapshot to the TOML file if it differs from the last successful save.
+     *
+     * Compares against the last-saved text and only touches the disk on a mismatch. Failures are logged only, so callers can stay noexcept.
+     *
+     * @param serialized Serialized TOML document produced by the game thread.
+     */
+    void save_snapshot_if_dirty(std::string serialized) noexcept;
+
+    /**
+     * @brief Write the serialized TOML text to disk atomically (write to a temporary file, then rename it over the real one).
+     *
+     * The rename is atomic on every platform we ship on, so a crash mid-save can never leave a truncated config file. Failures are logged only, so callers can stay noexcept.
+     *
+     * @param serialized Serialized TOML document to write.
+     *
+     * @return True if the file was written and renamed successfully, false otherwise.
+     */
+    [[nodiscard]] bool save_atomic(const std::string &serialized) const noexcept;
+
+    /**
+     * @brief Body of the background autosave thread; sleeps until the game thread publishes a snapshot, then runs "save_snapshot_if_dirty()" on it.
+     *
+     * @param stop_token Token that interrupts the wait immediately when the destructor requests a stop.
+     */
+    void autosave_loop(const std::stop_token stop_token);
+
+    /**
+     * @brief How long the autosave thread sleeps between dirty checks.
+     */
+    static constexpr std::chrono::seconds autosave_interval_{5};
 
     /**
      * @brief Path to the configuration TOML file.
      */
     const std::filesystem::path path_;
+
+    /**
+     * @brief Serialized TOML text of the last successful save, used for dirty detection; only touched by the autosave thread and, before it starts or after it is joined, the constructor and destructor.
+     */
+    std::string last_saved_;
+
+    /**
+     * @brief Snapshot published by the game thread and not yet consumed by the autosave thread; guarded by "mutex_", empty when nothing is pending.
+     */
+    std::string pending_snapshot_;
+
+    /**
+     * @brief When the game thread last published a snapshot; only touched by the game thread.
+     */
+    std::chrono::steady_clock::time_point last_publish_time_ = std::chrono::steady_clock::now();
+
+    /**
+     * @brief Mutex guarding "pending_snapshot_" and the autosave thread's interruptible wait.
+     */
+    std::mutex mutex_;
+
+    /**
+     * @brief Condition variable the autosave thread waits on; signaled when a snapshot is published and through the stop token on shutdown.
+     */
+    std::condition_variable_any autosave_wakeup_;
+
+    /**
+     * @brief Background autosave thread; declared last so it is stopped and joined before the members it uses are destroyed.
+     */
+    std::jthread autosave_thread_;
 };
 
 }  // namespace core::io
@@ -0,0 +1,147 @@
+/**
+ * @file jobs.cpp
+ */
+
+#include <algorithm>           // for std::max
+#include <atomic>              // for std::memory_order_relaxed
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <memory>              // for std::make_unique
+#include <mutex>               // for std::unique_lock, std::lock_guard, std::scoped_lock
+#include <thread>              // for std::jthread
+#include <utility>             // for std::move
+
+#include <spdlog/spdlog.h>
+
+#include "jobs.hpp"
+
+namespace core::jobs {
+
+JobSystem::JobSystem(const unsigned worker_count)
+{
+    // Default to one worker less than the hardware concurrency, so the main thread keeps a core for itself
+    const unsigned hardware_concurrency = std::max(std::jthread::hardware_concurrency(), 2u);
+    const std::size_t resolved_worker_count = worker_count > 0
+                                                  ? worker_count
+                                                  : hardware_concurrency - 1u;
+
+    // Create all queues before spawning any worker, so "try_obtain_job()" never sees a resizing vector
+    this->queues_.reserve(resolved_worker_count);
+    for (std::size_t index = 0; index < resolved_worker_count; ++index) {
+        this->queues_.emplace_back(std::make_unique<WorkerQueue>());
+    }
+
+    this->workers_.reserve(resolved_worker_count);
+    for (std::size_t index = 0; index < resolved_worker_count; ++index) {
+        this->workers_.emplace_back([this, index](std::stop_token stop_token) {
+            this->worker_loop(std::move(stop_token), index);
+        });
+    }
+    SPDLOG_DEBUG("Job system started with '{}' worker threads!", resolved_worker_count);
+}
+
+JobSystem::~JobSystem()
+{
+    // Finish outstanding jobs so no submitted work is silently dropped
+    this->wait();
+
+    // Request stop on all workers, then wake them so they can observe the request; std::jthread joins automatically
+    for (auto &worker : this->workers_) {
+        worker.request_stop();
+    }
+    {
+        // The notify must happen under the wake mutex, like "execute_job()" does with the done mutex: a worker that just evaluated its wait predicate (stop not yet requested) while holding the mutex would otherwise miss both the flag and the notify and sleep through shutdown forever
+        const std::lock_guard<std::mutex> lock(this->wake_mutex_);
+        this->wake_signal_.notify_all();
+    }
+    SPDLOG_DEBUG("Job system shutting down, joining worker threads...");
+}
+
+void JobSystem::submit(job_type job)
+{
+    // Distribute jobs round-robin across the per-worker queues
+    const std::size_t queue_index = this->next_queue_index_.fetch_add(1, std::memory_order_relaxed) % this->queues_.size();
+    {
+        const std::lock_guard<std::mutex> lock(this->queues_[queue_index]->mutex);
+        this->queues_[queue_index]->pending_jobs.emplace_back(std::move(job));
+    }
+    this->pending_count_.fetch_add(1, std::memory_order_release);
+    this->wake_signal_.notify_one();
+}
+
+void JobSystem::wait()
+{
+    // Help execute pending jobs instead of just sleeping, so the frame barrier does not waste the calling core
+    job_type job;
+    while (this->pending_count_.load(std::memory_order_acquire) > 0) {
+        if (this->try_obtain_job(0, job)) {
+            this->execute_job(job);
+            continue;
+        }
+        // All queues are empty but some jobs are still executing on workers; sleep until the counter reaches zero
+        std::unique_lock<std::mutex> lock(this->done_mutex_);
+        this->done_signal_.wait(lock, [this]() {
+            return this->pending_count_.load(std::memory_order_acquire) == 0;
+        });
+    }
+}
+
+std::size_t JobSystem::get_worker_count() const
+{
+    return this->workers_.size();
+}
+
+bool JobSystem::try_obtain_job(const std::size_t worker_index,
+                               job_type &job)
+{
+    // Check the worker's own queue first (back = most recently pushed, keeps caches warm)
+    {
+        const std::lock_guard<std::mutex> lock(this->queues_[worker_index]->mutex);
+        if (!this->queues_[worker_index]->pending_jobs.empty()) {
+            job = std::move(this->queues_[worker_index]->pending_jobs.back());
+            this->queues_[worker_index]->pending_jobs.pop_back();
+            return true;
+        }
+    }
+
+    // Steal from the front of the other queues (opposite end to minimize contention with the owner)
+    for (std::size_t offset = 1; offset < this->queues_.size(); ++offset) {
+        const std::size_t victim_index = (worker_index + offset) % this->queues_.size();
+        const std::lock_guard<std::mutex> lock(this->queues_[victim_index]->mutex);
+        if (!this->queues_[victim_index]->pending_jobs.empty()) {
+            job = std::move(this->queues_[victim_index]->pending_jobs.front());
+            this->queues_[victim_index]->pending_jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::execute_job(const job_type &job)
+{
+    job();
+    // Notify waiters when the last pending job finishes
+    if (this->pending_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        const std::lock_guard<std::mutex> lock(this->done_mutex_);
+        this->done_signal_.notify_all();
+    }
+}
+
+void JobSystem::worker_loop(std::stop_token stop_token,
+                            const std::size_t worker_index)
+{
+    job_type job;
+    while (!stop_token.stop_requested()) {
+        if (this->try_obtain_job(worker_index, job)) {
+            this->execute_job(job);
+            continue;
+        }
+        // No work available; sleep until a job is submitted or shutdown starts
+        std::unique_lock<std::mutex> lock(this->wake_mutex_);
+        this->wake_signal_.wait(lock, [this, &stop_token]() {
+            return stop_token.stop_requested() || this->pending_count_.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+}  // namespace core::jobs
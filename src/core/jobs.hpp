@@ -0,0 +1,170 @@
+/**
+ * @file jobs.hpp
+ *
+ * @brief Work-stealing job system for parallel per-frame work.
+ */
+
+#pragma once
+
+#include <atomic>              // for std::atomic
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <deque>               // for std::deque
+#include <functional>          // for std::function
+#include <memory>              // for std::unique_ptr
+#include <mutex>               // for std::mutex
+#include <thread>              // for std::jthread
+#include <vector>              // for std::vector
+
+namespace core::jobs {
+
+/**
+ * @brief Class that distributes small independent jobs across worker threads.
+ *
+ * On construction, worker threads are spawned, each with its own job queue. Jobs submitted via "submit()" are distributed round-robin across the queues; idle workers steal from the queues of busy workers, so uneven job costs still balance out.
+ *
+ * The intended per-frame usage is: submit all jobs for the frame, then call "wait()" as a barrier before using the results (e.g., before drawing).
+ *
+ * @note Jobs must be independent of each other; the job system provides no ordering guarantees between jobs submitted in the same batch.
+ */
+class JobSystem final {
+  public:
+    /**
+     * @brief Type-erased job; any callable taking no arguments and returning nothing.
+     */
+    using job_type = std::function<void()>;
+
+    /**
+     * @brief Construct a new JobSystem object and spawn the worker threads.
+     *
+     * @param worker_count Number of worker threads to spawn (default: "0", meaning one less than the hardware concurrency, clamped to at least one).
+     */
+    explicit JobSystem(const unsigned worker_count = 0);
+
+    /**
+     * @brief Destroy the JobSystem object.
+     *
+     * On destruction, all remaining jobs are completed, then the worker threads are stopped and joined.
+     */
+    ~JobSystem();
+
+    // Disable copy semantics - manages unique thread resources
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    // Disable move semantics - worker threads capture "this"
+    JobSystem(JobSystem &&) = delete;
+    JobSystem &operator=(JobSystem &&) = delete;
+
+    /**
+     * @brief Submit a job for asynchronous execution.
+     *
+     * The job is appended to one of the worker queues (round-robin) and a sleeping worker is woken up.
+     *
+     * @param job Callable to execute on a worker thread.
+     */
+    void submit(job_type job);
+
+    /**
+     * @brief Block until all submitted jobs have completed.
+     *
+     * The calling thread helps execute pending jobs instead of just sleeping, so a frame barrier on the main thread does not waste a core.
+     *
+     * @note Call this once per frame after submitting the per-frame jobs, before using their results.
+     */
+    void wait();
+
+    /**
+     * @brief Get the number of worker threads.
+     *
+     * @return Number of worker threads (e.g., "3").
+     */
+    [[nodiscard]] std::size_t get_worker_count() const;
+
+  private:
+    /**
+     * @brief Per-worker job queue with its own lock, so workers rarely contend with each other.
+     */
+    struct WorkerQueue final {
+        /**
+         * @brief Mutex protecting "pending_jobs".
+         */
+        std::mutex mutex;
+
+        /**
+         * @brief Jobs waiting to be executed; the owning worker pops from the back, thieves steal from the front.
+         */
+        std::deque<job_type> pending_jobs;
+    };
+
+    /**
+     * @brief Try to obtain a job, first from the worker's own queue, then by stealing from the other queues.
+     *
+     * @param worker_index Index of the queue to check first.
+     * @param job Output parameter receiving the obtained job.
+     *
+     * @return True if a job was obtained, false if all queues are empty.
+     */
+    [[nodiscard]] bool try_obtain_job(const std::size_t worker_index,
+                                      job_type &job);
+
+    /**
+     * @brief Execute the provided job, then decrement the pending counter and notify waiters if it reached zero.
+     *
+     * @param job Job to execute.
+     */
+    void execute_job(const job_type &job);
+
+    /**
+     * @brief Main loop of a worker thread; executes jobs until stop is requested.
+     *
+     * @param stop_token Stop token of the owning std::jthread.
+     * @param worker_index Index of this worker's queue.
+     */
+    void worker_loop(std::stop_token stop_token,
+                     const std::size_t worker_index);
+
+    /**
+     * @brief Per-worker job queues.
+     *
+     * @note Stored via unique_ptr because WorkerQueue contains a mutex and is therefore not movable.
+     */
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+
+    /**
+     * @brief Worker threads; joined automatically on destruction.
+     */
+    std::vector<std::jthread> workers_;
+
+    /**
+     * @brief Number of submitted jobs that have not finished executing yet.
+     */
+    std::atomic<std::size_t> pending_count_ = 0;
+
+    /**
+     * @brief Round-robin cursor for distributing submitted jobs across the queues.
+     */
+    std::atomic<std::size_t> next_queue_index_ = 0;
+
+    /**
+     * @brief Mutex used together with "wake_signal_" to put idle workers to sleep.
+     */
+    std::mutex wake_mutex_;
+
+    /**
+     * @brief Condition variable used to wake sleeping workers when jobs arrive or shutdown starts.
+     */
+    std::condition_variable wake_signal_;
+
+    /**
+     * @brief Mutex used together with "done_signal_" by "wait()".
+     */
+    std::mutex done_mutex_;
+
+    /**
+     * @brief Condition variable notified when the pending job counter reaches zero.
+     */
+    std::condition_variable done_signal_;
+};
+
+}  // namespace core::jobs
@@ -0,0 +1,151 @@
+/**
+ * @file math.hpp
+ *
+ * @brief Fast transcendental approximations for the simulation hot path.
+ */
+
+#pragma once
+
+#include <cmath>    // for std::floor, std::sqrt, std::copysign
+#include <numbers>  // for std::numbers
+
+namespace core::math {
+
+/**
+ * @brief Struct that holds the sine and cosine of one angle, evaluated together.
+ */
+struct SinCos final {
+    /**
+     * @brief Sine of the angle.
+     */
+    float sin;
+
+    /**
+     * @brief Cosine of the angle.
+     */
+    float cos;
+};
+
+namespace detail {
+
+/**
+ * @brief Minimax polynomial for atan on [-1, 1]; shared by the "fast_atan2()" octant reduction.
+ *
+ * @param z Ratio in [-1, 1].
+ *
+ * @return Approximate atan(z) in radians.
+ */
+[[nodiscard]] constexpr float atan_unit(const float z)
+{
+    // Degree-11 odd minimax fit; the error bound quoted on "fast_atan2()" comes from this polynomial
+    const float z2 = z * z;
+    return z * (0.99997726f + z2 * (-0.33262347f + z2 * (0.19354346f + z2 * (-0.11643287f + z2 * (0.05265332f + z2 * -0.01172120f)))));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Compute the sine and cosine of an angle with one shared range reduction.
+ *
+ * The angle is reduced to [-pi/4, pi/4] plus a quadrant, then both results come from short odd/even polynomials, replacing two libm calls (which redo the reduction twice and carry precision far beyond what game simulation can observe) with a handful of multiply-adds.
+ *
+ * @param radians Angle in radians.
+ *
+ * @return Sine and cosine of the angle.
+ *
+ * @note Maximum absolute error is below 5e-6 for wrapped angles and below 3e-5 within a few hundred radians of zero; the single-precision reduction loses further accuracy for huge inputs, but headings and steering angles are wrapped and never get there.
+ */
+[[nodiscard]] inline SinCos fast_sincos(const float radians)
+{
+    // Split the angle into a quadrant count and a remainder in [-pi/4, pi/4]
+    constexpr float two_over_pi = 2.0f / std::numbers::pi_v<float>;
+    constexpr float half_pi = 0.5f * std::numbers::pi_v<float>;
+    const float quadrant_f = std::floor(radians * two_over_pi + 0.5f);
+    const float r = radians - quadrant_f * half_pi;
+
+    // Short Taylor-like minimax polynomials; plenty on an interval this small
+    const float r2 = r * r;
+    const float s = r * (1.0f + r2 * (-1.6666656e-1f + r2 * (8.3330251e-3f + r2 * -1.9807418e-4f)));
+    const float c = 1.0f + r2 * (-0.5f + r2 * (4.1664787e-2f + r2 * -1.3888397e-3f));
+
+    // Two's-complement "& 3" maps negative quadrant counts to the correct positive residue
+    switch (static_cast<int>(quadrant_f) & 3) {
+    case 0:
+        return {.sin = s, .cos = c};
+    case 1:
+        return {.sin = c, .cos = -s};
+    case 2:
+        return {.sin = -s, .cos = -c};
+    default:
+        return {.sin = -c, .cos = s};
+    }
+}
+
+/**
+ * @brief Compute the signed angle of a vector with a polynomial approximation.
+ *
+ * An octant reduction brings the ratio into [-1, 1] and a single odd polynomial does the rest; no division-free trickery, just the removal of libm's argument checking and extended precision.
+ *
+ * @param y Vertical component of the vector.
+ * @param x Horizontal component of the vector.
+ *
+ * @return Angle of the vector in radians, in [-pi, pi]; "0.0" when both components are zero.
+ *
+ * @note Maximum absolute error is below 1e-4 radians, far under the steering thresholds the AI compares these angles against.
+ */
+[[nodiscard]] inline float fast_atan2(const float y,
+                                      const float x)
+{
+    constexpr float pi = std::numbers::pi_v<float>;
+    constexpr float half_pi = 0.5f * pi;
+
+    const float ax = x < 0.0f ? -x : x;
+    const float ay = y < 0.0f ? -y : y;
+    if (ax == 0.0f && ay == 0.0f) [[unlikely]] {
+        return 0.0f;
+    }
+
+    // Evaluate on the smaller ratio, so the polynomial argument stays in [-1, 1]
+    float angle = detail::atan_unit(ay < ax ? ay / ax : ax / ay);
+    if (ay >= ax) {
+        angle = half_pi - angle;
+    }
+    if (x < 0.0f) {
+        angle = pi - angle;
+    }
+    return std::copysign(angle, y);
+}
+
+/**
+ * @brief Wrap an angle into [-pi, pi).
+ *
+ * Replaces "std::remainder(angle, 2 * pi)" in the hot path; one floor and one fused multiply-add instead of a libm call with exact-halfway semantics nothing here depends on.
+ *
+ * @param radians Angle in radians.
+ *
+ * @return Equivalent angle in [-pi, pi).
+ */
+[[nodiscard]] inline float wrap_angle(const float radians)
+{
+    constexpr float pi = std::numbers::pi_v<float>;
+    constexpr float two_pi = 2.0f * pi;
+    return radians - two_pi * std::floor((radians + pi) * (1.0f / two_pi));
+}
+
+/**
+ * @brief Compute the length of a 2D vector.
+ *
+ * Replaces "std::hypot()", whose overflow/underflow-safe scaling costs several times a plain square root; at game-world magnitudes (pixels and pixels per second) the naive form cannot overflow.
+ *
+ * @param x Horizontal component of the vector.
+ * @param y Vertical component of the vector.
+ *
+ * @return Euclidean length of the vector.
+ */
+[[nodiscard]] inline float fast_length(const float x,
+                                       const float y)
+{
+    return std::sqrt(x * x + y * y);
+}
+
+}  // namespace core::math
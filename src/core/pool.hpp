@@ -0,0 +1,165 @@
+/**
+ * @file pool.hpp
+ *
+ * @brief Fixed-capacity object pool for transient effects.
+ */
+
+#pragma once
+
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+namespace core::pool {
+
+/**
+ * @brief Class that recycles a fixed number of pre-constructed objects through a free list.
+ *
+ * All storage (the slots, the free list, and the dense index of alive slots) is allocated once at construction and never grows, so the worst-case memory and per-frame cost of whatever the pool holds is a compile-time-decidable constant. Acquiring and releasing a slot is O(1) and allocation-free, and slots never move, so objects carrying their own heap state (e.g., "sf::CircleShape" geometry) are configured in place instead of being copied or compacted.
+ *
+ * Alive slots are iterated through "get_alive_indices()", a dense vector maintained with swap-removal; the iteration order is therefore unspecified, which suits effects with no meaningful draw order.
+ *
+ * @tparam T Type of the pooled objects; must be default-constructible, since every slot is constructed up front.
+ */
+template <typename T>
+class FixedPool final {
+  public:
+    /**
+     * @brief Sentinel returned by "acquire()" when the pool is exhausted.
+     */
+    static constexpr std::size_t invalid_index = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Construct a new FixedPool object, allocating every slot up front.
+     *
+     * @param capacity Maximum number of simultaneously alive objects (e.g., "256").
+     */
+    explicit FixedPool(const std::size_t capacity)
+        : slots_(capacity),
+          alive_positions_(capacity, FixedPool::invalid_index)
+    {
+        // Every slot starts on the free list; popping from the back hands out low indices first
+        this->free_indices_.reserve(capacity);
+        for (std::size_t index = capacity; index > 0; --index) {
+            this->free_indices_.push_back(index - 1);
+        }
+        this->alive_indices_.reserve(capacity);
+    }
+
+    /**
+     * @brief Take a slot from the free list and mark it alive.
+     *
+     * The slot keeps whatever state its previous occupant left behind; the caller is expected to reconfigure it.
+     *
+     * @return Index of the acquired slot, or "invalid_index" if every slot is alive.
+     */
+    [[nodiscard]] std::size_t acquire()
+    {
+        if (this->free_indices_.empty()) {
+            return FixedPool::invalid_index;
+        }
+        const std::size_t index = this->free_indices_.back();
+        this->free_indices_.pop_back();
+        this->alive_positions_[index] = this->alive_indices_.size();
+        this->alive_indices_.push_back(index);
+        return index;
+    }
+
+    /**
+     * @brief Return an alive slot to the free list.
+     *
+     * The dense alive index is compacted by swapping the last entry into the released slot's position, so releasing is O(1) but reorders the iteration sequence.
+     *
+     * @param index Index previously returned by "acquire()"; releasing a slot that is not alive is a no-op.
+     */
+    void release(const std::size_t index)
+    {
+        const std::size_t position = this->alive_positions_[index];
+        if (position == FixedPool::invalid_index) {
+            return;
+        }
+        const std::size_t last_index = this->alive_indices_.back();
+        this->alive_indices_[position] = last_index;
+        this->alive_positions_[last_index] = position;
+        this->alive_indices_.pop_back();
+        this->alive_positions_[index] = FixedPool::invalid_index;
+        this->free_indices_.push_back(index);
+    }
+
+    /**
+     * @brief Release every alive slot without touching the stored objects.
+     */
+    void clear()
+    {
+        for (const std::size_t index : this->alive_indices_) {
+            this->alive_positions_[index] = FixedPool::invalid_index;
+            this->free_indices_.push_back(index);
+        }
+        this->alive_indices_.clear();
+    }
+
+    /**
+     * @brief Access the object in a slot.
+     *
+     * @param index Index previously returned by "acquire()".
+     *
+     * @return Reference to the stored object.
+     */
+    [[nodiscard]] T &operator[](const std::size_t index) { return this->slots_[index]; }
+
+    /**
+     * @brief Access the object in a slot (const overload).
+     *
+     * @param index Index previously returned by "acquire()".
+     *
+     * @return Const reference to the stored object.
+     */
+    [[nodiscard]] const T &operator[](const std::size_t index) const { return this->slots_[index]; }
+
+    /**
+     * @brief Get the dense list of alive slot indices, for iteration.
+     *
+     * Iterate this by position and use "release()" freely during a backwards walk: releasing the entry at the current position only disturbs entries at or after it, which a backwards walk has already visited.
+     *
+     * @return Const reference to the alive indices in unspecified order.
+     */
+    [[nodiscard]] const std::vector<std::size_t> &get_alive_indices() const { return this->alive_indices_; }
+
+    /**
+     * @brief Get the number of currently alive slots.
+     *
+     * @return Alive count (e.g., "0" right after construction or "clear()").
+     */
+    [[nodiscard]] std::size_t size() const { return this->alive_indices_.size(); }
+
+    /**
+     * @brief Get the fixed slot count chosen at construction.
+     *
+     * @return Maximum number of simultaneously alive objects.
+     */
+    [[nodiscard]] std::size_t capacity() const { return this->slots_.size(); }
+
+  private:
+    /**
+     * @brief Pre-constructed object slots; never resized, so slot addresses stay stable for the pool's lifetime.
+     */
+    std::vector<T> slots_;
+
+    /**
+     * @brief Position of each slot in "alive_indices_", or "invalid_index" for free slots.
+     *
+     * This makes "release()" O(1): the slot's dense position is looked up here instead of searched for.
+     */
+    std::vector<std::size_t> alive_positions_;
+
+    /**
+     * @brief LIFO free list of slot indices available for "acquire()".
+     */
+    std::vector<std::size_t> free_indices_;
+
+    /**
+     * @brief Dense list of alive slot indices in unspecified order, for allocation-free iteration.
+     */
+    std::vector<std::size_t> alive_indices_;
+};
+
+}  // namespace core::pool
@@ -0,0 +1,281 @@
+/**
+ * @file profiler.cpp
+ */
+
+#include <algorithm>   // for std::max
+#include <chrono>      // for std::chrono
+#include <cstddef>     // for std::size_t, std::ptrdiff_t
+#include <cstring>     // for std::strcmp
+#include <exception>   // for std::exception
+#include <filesystem>  // for std::filesystem
+#include <format>      // for std::format, std::format_to
+#include <fstream>     // for std::ofstream
+#include <future>      // for std::async, std::launch
+#include <ios>         // for std::ios
+#include <iterator>    // for std::back_inserter
+#include <string>      // for std::string
+#include <utility>     // for std::move
+#include <vector>      // for std::vector
+
+#include <spdlog/spdlog.h>
+
+#include "profiler.hpp"
+
+namespace core::profiler {
+
+namespace {
+
+/**
+ * @brief Serialize the provided events (in chronological order) into the chrome://tracing JSON format.
+ *
+ * @param events Events to serialize.
+ *
+ * @return JSON document that can be opened in chrome://tracing or Perfetto.
+ */
+[[nodiscard]] std::string serialize_chrome_trace(const std::vector<TraceEvent> &events)
+{
+    std::string json;
+    // Rough per-event size estimate to avoid re-allocations while appending
+    json.reserve(events.size() * 96 + 32);
+
+    json += "{\"traceEvents\":[";
+    bool first = true;
+    for (const TraceEvent &event : events) {
+        if (!first) {
+            json += ',';
+        }
+        first = false;
+        if (event.is_counter) {
+            // Counter event; chrome://tracing plots these as a stacked graph per name
+            std::format_to(std::back_inserter(json),
+                           R"({{"name":"{}","ph":"C","ts":{},"pid":0,"tid":0,"args":{{"value":{}}}}})",
+                           event.name,
+                           event.timestamp_us,
+                           event.counter_value);
+        }
+        else {
+            // Complete event; "X" carries both start timestamp and duration in one record
+            std::format_to(std::back_inserter(json),
+                           R"({{"name":"{}","ph":"X","ts":{},"dur":{},"pid":0,"tid":0}})",
+                           event.name,
+                           event.timestamp_us,
+                           event.duration_us);
+        }
+    }
+    json += "]}";
+    return json;
+}
+
+}  // namespace
+
+void FrameProfiler::add_sample(const char *name,
+                               const float seconds)
+{
+    // Forward the raw sample to the attached trace recorder, if any
+    if (this->recorder_ != nullptr) {
+        this->recorder_->record_phase(name, seconds);
+    }
+
+    // Find the phase by name; the phase count is tiny (one entry per instrumented section), so a linear scan beats any map here
+    for (std::size_t index = 0; index < this->stats_.size(); ++index) {
+        // Compare the pointers first; all call sites pass string literals, so this almost always hits without touching the characters
+        if (this->stats_[index].name == name || std::strcmp(this->stats_[index].name, name) == 0) {
+            this->accumulated_seconds_[index] += seconds;
+            return;
+        }
+    }
+
+    // First sample for this phase; register it at the end so the display order follows the frame's execution order
+    this->stats_.emplace_back(PhaseStats{.name = name, .current_ms = 0.f, .average_ms = 0.f});
+    this->accumulated_seconds_.emplace_back(seconds);
+}
+
+void FrameProfiler::end_frame()
+{
+    for (std::size_t index = 0; index < this->stats_.size(); ++index) {
+        const float frame_ms = this->accumulated_seconds_[index] * 1000.f;
+        PhaseStats &stats = this->stats_[index];
+        stats.current_ms = frame_ms;
+
+        // Seed the moving average with the first measurement, then blend subsequent frames in
+        if (stats.average_ms == 0.f) {
+            stats.average_ms = frame_ms;
+        }
+        else {
+            stats.average_ms += (frame_ms - stats.average_ms) * this->smoothing_factor_;
+        }
+
+        // Reset the accumulator for the next frame
+        this->accumulated_seconds_[index] = 0.f;
+    }
+}
+
+const std::vector<PhaseStats> &FrameProfiler::get_stats() const
+{
+    return this->stats_;
+}
+
+void FrameProfiler::set_recorder(TraceRecorder *recorder)
+{
+    this->recorder_ = recorder;
+}
+
+TraceRecorder::TraceRecorder(const float seconds_to_keep)
+    : capacity_(std::max<std::size_t>(1, static_cast<std::size_t>(seconds_to_keep * static_cast<float>(TraceRecorder::events_per_second_estimate_)))),
+      epoch_(std::chrono::steady_clock::now())
+{
+    // Allocate the whole ring up front, so recording never allocates on the hot path
+    this->events_.reserve(this->capacity_);
+    SPDLOG_DEBUG("TraceRecorder created with capacity for '{}' events (~'{}' seconds of history), exiting constructor!", this->capacity_, seconds_to_keep);
+}
+
+void TraceRecorder::record_phase(const char *name,
+                                 const float seconds)
+{
+    const long long duration_us = static_cast<long long>(seconds * 1'000'000.f);
+    this->append(TraceEvent{.name = name,
+                            // The phase ended now, so reconstruct its start by subtracting the duration
+                            .timestamp_us = this->now_us() - duration_us,
+                            .duration_us = duration_us,
+                            .counter_value = 0.f,
+                            .is_counter = false});
+}
+
+void TraceRecorder::record_counter(const char *name,
+                                   const float value)
+{
+    this->append(TraceEvent{.name = name,
+                            .timestamp_us = this->now_us(),
+                            .duration_us = 0,
+                            .counter_value = value,
+                            .is_counter = true});
+}
+
+void TraceRecorder::dump(const std::filesystem::path &directory)
+{
+    // If the previous dump is still being written, skip; overlapping writes would fight over disk bandwidth anyway
+    if (this->dump_future_.valid() &&
+        this->dump_future_.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+        SPDLOG_WARN("Previous telemetry dump is still being written, skipping this dump request!");
+        return;
+    }
+
+    // Snapshot the ring in chronological order (oldest first); this is a flat copy, cheap enough for a hotkey
+    std::vector<TraceEvent> snapshot;
+    snapshot.reserve(this->events_.size());
+    if (this->events_.size() == this->capacity_) {
+        // Buffer has wrapped; the oldest event sits at the next write position
+        snapshot.insert(snapshot.end(), this->events_.cbegin() + static_cast<std::ptrdiff_t>(this->next_index_), this->events_.cend());
+        snapshot.insert(snapshot.end(), this->events_.cbegin(), this->events_.cbegin() + static_cast<std::ptrdiff_t>(this->next_index_));
+    }
+    else {
+        snapshot = this->events_;
+    }
+
+    // Name the file after the current wall-clock time, so repeated dumps do not overwrite each other
+    const long long unix_timestamp = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    const std::filesystem::path file_path = directory / std::format("trace_{}.json", unix_timestamp);
+
+    // Serialization and disk IO happen off the hot path, on a background thread
+    this->dump_future_ = std::async(std::launch::async, [snapshot = std::move(snapshot), file_path]() {
+        std::filesystem::create_directories(file_path.parent_path());
+        const std::string json = serialize_chrome_trace(snapshot);
+        std::ofstream ofs(file_path, std::ios::trunc);
+        if (!ofs) {
+            SPDLOG_ERROR("Cannot open telemetry trace file for writing: '{}'", file_path.string());
+            return;
+        }
+        ofs << json;
+        SPDLOG_INFO("Telemetry trace with '{}' events was successfully saved to '{}'", snapshot.size(), file_path.string());
+    });
+}
+
+std::size_t TraceRecorder::size() const
+{
+    return this->events_.size();
+}
+
+std::size_t TraceRecorder::get_capacity() const
+{
+    return this->capacity_;
+}
+
+void TraceRecorder::append(const TraceEvent &event)
+{
+    if (this->events_.size() < this->capacity_) {
+        // Still filling the preallocated buffer
+        this->events_.emplace_back(event);
+        return;
+    }
+
+    // Buffer is full; overwrite the oldest event
+    this->events_[this->next_index_] = event;
+    this->next_index_ = (this->next_index_ + 1) % this->capacity_;
+}
+
+long long TraceRecorder::now_us() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->epoch_).count();
+}
+
+StartupTimeline::StartupTimeline()
+    : epoch_(std::chrono::steady_clock::now()),
+      last_mark_(this->epoch_)
+{
+}
+
+void StartupTimeline::mark(const char *name)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const std::chrono::duration<float, std::milli> elapsed = now - this->last_mark_;
+    this->last_mark_ = now;
+    this->milestones_.emplace_back(Milestone{.name = name, .duration_ms = elapsed.count()});
+    SPDLOG_INFO("Startup milestone '{}' completed in '{:.1f}' ms!", name, elapsed.count());
+}
+
+void StartupTimeline::append_report(const std::filesystem::path &directory,
+                                    const char *version) const
+{
+    const std::chrono::duration<float, std::milli> total = std::chrono::steady_clock::now() - this->epoch_;
+    SPDLOG_INFO("Startup completed in '{:.1f}' ms across '{}' milestones!", total.count(), this->milestones_.size());
+
+    try {
+        // One "key=value" line per launch; the unix timestamp and version let the fleet telemetry bucket the lines by release and by day
+        const long long unix_timestamp = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        std::string line = std::format("ts={} version={} total_ms={:.1f}", unix_timestamp, version, total.count());
+        for (const Milestone &milestone : this->milestones_) {
+            std::format_to(std::back_inserter(line), " {}_ms={:.1f}", milestone.name, milestone.duration_ms);
+        }
+        line += '\n';
+
+        std::filesystem::create_directories(directory);
+        const std::filesystem::path file_path = directory / "startup_report.log";
+        std::ofstream ofs(file_path, std::ios::app);
+        if (!ofs) {
+            SPDLOG_ERROR("Cannot open startup report file for appending: '{}'", file_path.string());
+            return;
+        }
+        ofs << line;
+        SPDLOG_DEBUG("Startup report line appended to '{}'!", file_path.string());
+    }
+    catch (const std::exception &e) {
+        // The report is telemetry, not gameplay; failing to persist it must never block startup
+        SPDLOG_ERROR("Failed to append startup report: {}", e.what());
+    }
+}
+
+ScopedTimer::ScopedTimer(FrameProfiler &profiler,
+                         const char *name)
+    : profiler_(profiler),
+      name_(name),
+      start_(std::chrono::steady_clock::now())
+{
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    const std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - this->start_;
+    this->profiler_.add_sample(this->name_, elapsed.count());
+}
+
+}  // namespace core::profiler
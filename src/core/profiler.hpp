@@ -0,0 +1,397 @@
+/**
+ * @file profiler.hpp
+ *
+ * @brief Scoped frame profiler that aggregates named phase timings per frame.
+ */
+
+#pragma once
+
+#include <chrono>      // for std::chrono
+#include <cstddef>     // for std::size_t
+#include <filesystem>  // for std::filesystem
+#include <future>      // for std::future
+#include <vector>      // for std::vector
+
+namespace core::profiler {
+
+/**
+ * @brief Struct that represents the aggregated timing statistics for one named phase of the frame.
+ */
+struct PhaseStats final {
+    /**
+     * @brief Phase name (e.g., "Input", "Car Updates").
+     *
+     * @note This points at the string literal passed to "ScopedTimer", which has static storage duration.
+     */
+    const char *name;
+
+    /**
+     * @brief Time spent in this phase during the most recently completed frame, in milliseconds.
+     */
+    float current_ms;
+
+    /**
+     * @brief Exponential moving average of the per-frame time, in milliseconds.
+     */
+    float average_ms;
+};
+
+/**
+ * @brief Struct that represents one recorded telemetry event: either a timed phase or a counter sample.
+ */
+struct TraceEvent final {
+    /**
+     * @brief Event name (e.g., "Track Draw", "Cars Updated").
+     *
+     * @note This points at a string literal with static storage duration; only the pointer is stored.
+     */
+    const char *name;
+
+    /**
+     * @brief Start of the event, in microseconds since the recorder was constructed.
+     */
+    long long timestamp_us;
+
+    /**
+     * @brief Duration of the event in microseconds; only meaningful for phase events.
+     */
+    long long duration_us;
+
+    /**
+     * @brief Sampled value; only meaningful for counter events.
+     */
+    float counter_value;
+
+    /**
+     * @brief Whether this event is a counter sample ("true") or a timed phase ("false").
+     */
+    bool is_counter;
+};
+
+/**
+ * @brief Class that keeps the most recent telemetry events (phase timings and counters) in a preallocated ring buffer and can dump them as a Chrome trace.
+ *
+ * Recording overwrites the oldest events once the buffer is full, so memory usage is fixed and the buffer always holds roughly the last few seconds of frames. "dump()" writes the events as a chrome://tracing JSON file; serialization and disk IO run on a background thread, so dumping from a hotkey does not hitch the frame that triggered it.
+ *
+ * @note Recording is not thread-safe; all events are expected to be recorded from the main thread, which is where the instrumented phases run.
+ */
+class TraceRecorder final {
+  public:
+    /**
+     * @brief Construct a new TraceRecorder object and preallocate the ring buffer.
+     *
+     * @param seconds_to_keep Approximate number of seconds of history to keep (default: "10.0"). The buffer is sized from a generous per-second event estimate, so the actual history is usually longer.
+     */
+    explicit TraceRecorder(const float seconds_to_keep = 10.0f);
+
+    /**
+     * @brief Default destructor.
+     *
+     * @note If a dump is still being written in the background, its future blocks here until the file is finished.
+     */
+    ~TraceRecorder() = default;
+
+    // Disable copy semantics - owns a pending dump future
+    TraceRecorder(const TraceRecorder &) = delete;
+    TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+    // Disable move semantics - the FrameProfiler holds a pointer to this recorder
+    TraceRecorder(TraceRecorder &&) = delete;
+    TraceRecorder &operator=(TraceRecorder &&) = delete;
+
+    /**
+     * @brief Record a timed phase that just finished.
+     *
+     * The phase is assumed to have ended now, so its start timestamp is reconstructed by subtracting the duration.
+     *
+     * @param name Phase name; must be a string literal (or otherwise outlive the recorder).
+     * @param seconds Duration of the phase, in seconds.
+     */
+    void record_phase(const char *name,
+                      const float seconds);
+
+    /**
+     * @brief Record a counter sample (e.g., number of cars updated this frame) timestamped now.
+     *
+     * @param name Counter name; must be a string literal (or otherwise outlive the recorder).
+     * @param value Sampled value.
+     */
+    void record_counter(const char *name,
+                        const float value);
+
+    /**
+     * @brief Dump the recorded events as a chrome://tracing JSON file into the provided directory.
+     *
+     * The events are snapshotted on the calling thread (a cheap copy), then serialized and written to "trace_<unix timestamp>.json" on a background thread. If a previous dump is still being written, this call logs a warning and does nothing.
+     *
+     * @param directory Directory to write the trace file into (e.g., from "core::io::get_application_storage_location()"); created if it does not exist.
+     */
+    void dump(const std::filesystem::path &directory);
+
+    /**
+     * @brief Get the number of events currently held in the ring buffer.
+     *
+     * @return Number of recorded events, at most "get_capacity()".
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Get the maximum number of events the ring buffer can hold.
+     *
+     * @return Capacity of the ring buffer, in events.
+     */
+    [[nodiscard]] std::size_t get_capacity() const;
+
+  private:
+    /**
+     * @brief Append an event to the ring buffer, overwriting the oldest event if the buffer is full.
+     *
+     * @param event Event to append.
+     */
+    void append(const TraceEvent &event);
+
+    /**
+     * @brief Get the time elapsed since the recorder was constructed, in microseconds.
+     *
+     * @return Microseconds since construction.
+     */
+    [[nodiscard]] long long now_us() const;
+
+    /**
+     * @brief Estimated number of recorded events per second, used to size the ring buffer.
+     *
+     * @note A frame records roughly a dozen events (phases plus counters, with the fixed-update phases possibly repeating), so 8192 comfortably covers even uncapped frame rates.
+     */
+    static constexpr std::size_t events_per_second_estimate_ = 8192;
+
+    /**
+     * @brief Maximum number of events the ring buffer can hold.
+     */
+    std::size_t capacity_;
+
+    /**
+     * @brief Ring buffer of recorded events; grows up to "capacity_", then wraps around.
+     */
+    std::vector<TraceEvent> events_;
+
+    /**
+     * @brief Index of the slot that the next event will be written to once the buffer is full.
+     */
+    std::size_t next_index_ = 0;
+
+    /**
+     * @brief Time point captured on construction; all event timestamps are relative to this.
+     */
+    std::chrono::steady_clock::time_point epoch_;
+
+    /**
+     * @brief Future of the background dump task; checked before starting a new dump.
+     */
+    std::future<void> dump_future_;
+};
+
+/**
+ * @brief Class that aggregates scoped phase timings into per-frame statistics.
+ *
+ * Instrumented code sections record their elapsed time via "ScopedTimer"; multiple samples with the same name within one frame are summed (e.g., a phase inside the fixed update, which may run several times per frame). Calling "end_frame()" once per frame folds the accumulated times into the per-phase statistics and resets the accumulators for the next frame.
+ *
+ * Phases are displayed in the order they were first sampled, so the statistics follow the frame's actual execution order.
+ */
+class FrameProfiler final {
+  public:
+    /**
+     * @brief Construct a new FrameProfiler object.
+     *
+     * No phases are registered up front; each phase is registered automatically the first time it is sampled.
+     */
+    FrameProfiler() = default;
+
+    /**
+     * @brief Add a timing sample for the named phase to the current frame.
+     *
+     * If the phase was sampled before, the time is added to its accumulator; otherwise, the phase is registered at the end of the phase list.
+     *
+     * @param name Phase name; must be a string literal (or otherwise outlive the profiler), because only the pointer is stored.
+     * @param seconds Time spent in the phase, in seconds.
+     *
+     * @note This is called by "ScopedTimer" and is not usually called directly.
+     */
+    void add_sample(const char *name,
+                    const float seconds);
+
+    /**
+     * @brief Close the current frame: fold the accumulated phase times into the statistics, then reset the accumulators.
+     *
+     * @note Call this exactly once per frame, after all instrumented sections have run (i.e., at the end of rendering).
+     */
+    void end_frame();
+
+    /**
+     * @brief Get the per-phase statistics of the most recently completed frame.
+     *
+     * @return Statistics for each phase, in the order the phases were first sampled.
+     */
+    [[nodiscard]] const std::vector<PhaseStats> &get_stats() const;
+
+    /**
+     * @brief Attach a trace recorder that will additionally receive every phase sample, or detach it.
+     *
+     * @param recorder Recorder to forward samples to, or "nullptr" to detach (default behavior). The recorder must outlive the profiler (or be detached first).
+     */
+    void set_recorder(TraceRecorder *recorder);
+
+  private:
+    /**
+     * @brief Smoothing factor for the exponential moving average; lower values smooth more.
+     *
+     * @note At 0.05, roughly the last ~20 frames dominate the average, which is stable enough to read off a screen while still tracking load changes within a second.
+     */
+    static constexpr float smoothing_factor_ = 0.05f;
+
+    /**
+     * @brief Time accumulated for each phase during the frame currently being measured, in seconds.
+     *
+     * @note Indices match "stats_"; both vectors grow together when a new phase is registered.
+     */
+    std::vector<float> accumulated_seconds_;
+
+    /**
+     * @brief Per-phase statistics of the most recently completed frame.
+     */
+    std::vector<PhaseStats> stats_;
+
+    /**
+     * @brief Optional trace recorder that receives every phase sample; "nullptr" when detached.
+     */
+    TraceRecorder *recorder_ = nullptr;
+};
+
+/**
+ * @brief RAII guard that measures the time between its construction and destruction, then reports it to a FrameProfiler.
+ *
+ * Intended usage is to create one at the top of a scoped block wrapping the phase to measure:
+ *
+ * @code
+ * {
+ *     const core::profiler::ScopedTimer timer{frame_profiler, "Car Updates"};
+ *     // ...work to measure...
+ * }
+ * @endcode
+ */
+class ScopedTimer final {
+  public:
+    /**
+     * @brief Construct a new ScopedTimer object and start measuring.
+     *
+     * @param profiler Profiler that will receive the elapsed time on destruction.
+     * @param name Phase name; must be a string literal (or otherwise outlive the profiler).
+     */
+    explicit ScopedTimer(FrameProfiler &profiler,
+                         const char *name);
+
+    /**
+     * @brief Destroy the ScopedTimer object and report the elapsed time to the profiler.
+     */
+    ~ScopedTimer();
+
+    // Disable copy semantics - the elapsed time must be reported exactly once
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    // Disable move semantics - the guard is meant to live on the stack for exactly one scope
+    ScopedTimer(ScopedTimer &&) = delete;
+    ScopedTimer &operator=(ScopedTimer &&) = delete;
+
+  private:
+    /**
+     * @brief Profiler that will receive the elapsed time on destruction.
+     */
+    FrameProfiler &profiler_;
+
+    /**
+     * @brief Phase name to report the elapsed time under.
+     */
+    const char *name_;
+
+    /**
+     * @brief Time point captured on construction.
+     */
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Class that times the named milestones of cold start and persists them as one report line per launch.
+ *
+ * Construct it first thing in the startup path, call "mark()" after each milestone (config load, window creation, asset decoding, and so on), and call "append_report()" once everything is up. Each milestone is logged through spdlog as it completes, and the report file accumulates one "key=value" line per launch, so fleet telemetry can trend startup regressions across releases and hardware without attaching a profiler.
+ */
+class StartupTimeline final {
+  public:
+    /**
+     * @brief Construct a new StartupTimeline object and capture the start timestamp.
+     */
+    StartupTimeline();
+
+    /**
+     * @brief Default destructor.
+     */
+    ~StartupTimeline() = default;
+
+    // Disable copy semantics
+    StartupTimeline(const StartupTimeline &) = delete;
+    StartupTimeline &operator=(const StartupTimeline &) = delete;
+
+    // Disable move semantics - the timeline is meant to live on the stack for the whole startup path
+    StartupTimeline(StartupTimeline &&) = delete;
+    StartupTimeline &operator=(StartupTimeline &&) = delete;
+
+    /**
+     * @brief Record that the named milestone just completed; its duration is the time since the previous mark (or since construction for the first one).
+     *
+     * @param name Milestone name used as the report key (e.g., "config", "window"); must be a string literal (or otherwise outlive the timeline).
+     */
+    void mark(const char *name);
+
+    /**
+     * @brief Log the total startup time and append one report line for this launch to "startup_report.log" in the provided directory.
+     *
+     * The line has the form "ts=<unix timestamp> version=<version> total_ms=<total> <milestone>_ms=<duration>...", one token per milestone in mark order. The write is synchronous: it is a couple hundred bytes once per launch, before the frame loop exists.
+     *
+     * @param directory Directory to append the report file in (e.g., from "core::io::get_application_storage_location()"); created if it does not exist.
+     * @param version Version string recorded with the line (e.g., the project version), so regressions can be attributed to a release.
+     */
+    void append_report(const std::filesystem::path &directory,
+                       const char *version) const;
+
+  private:
+    /**
+     * @brief Struct that represents one completed startup milestone.
+     */
+    struct Milestone final {
+        /**
+         * @brief Milestone name; points at the string literal passed to "mark()".
+         */
+        const char *name;
+
+        /**
+         * @brief Time between the previous mark and this one, in milliseconds.
+         */
+        float duration_ms;
+    };
+
+    /**
+     * @brief Time point captured on construction; the total startup time is measured from here.
+     */
+    std::chrono::steady_clock::time_point epoch_;
+
+    /**
+     * @brief Time point of the most recent "mark()", from which the next milestone's duration is measured.
+     */
+    std::chrono::steady_clock::time_point last_mark_;
+
+    /**
+     * @brief Completed milestones in mark order.
+     */
+    std::vector<Milestone> milestones_;
+};
+
+}  // namespace core::profiler
@@ -2,9 +2,14 @@
  * @file sfx.cpp
  */
 
-#include <algorithm>  // for std::clamp
-#include <cmath>      // for std::lerp
-#include <cstddef>    // for std::size_t
+#include <algorithm>     // for std::clamp, std::min, std::partial_sort
+#include <array>         // for std::array
+#include <cmath>         // for std::lerp, std::sqrt
+#include <cstddef>       // for std::ptrdiff_t, std::size_t
+#include <filesystem>    // for std::filesystem
+#include <span>          // for std::span
+#include <system_error>  // for std::error_code
+#include <utility>       // for std::move, std::pair
 
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Audio/SoundSource.hpp>
@@ -15,118 +20,199 @@
 
 namespace core::sfx {
 
-EngineSound::EngineSound(const sf::SoundBuffer &sound_buffer)
-    : engine_sound_(sound_buffer)
+EngineMixer::EngineMixer(const sf::SoundBuffer &sound_buffer)
 {
-    this->engine_sound_.setLooping(true);
-    this->engine_sound_.setPitch(this->idle_pitch_);  // Start with idle pitch
+    // Preallocate every voice up front; "update()" only assigns cars to them and never allocates
+    this->voices_.reserve(voice_count_);
+    for (std::size_t index = 0; index < voice_count_; ++index) {
+        sf::Sound voice{sound_buffer};
+        voice.setLooping(true);
+        voice.setPitch(idle_pitch_);  // Start with idle pitch
+        this->voices_.push_back(std::move(voice));
+    }
+    this->voice_cars_.fill(no_car_);
+    this->ranked_.reserve(voice_count_);
+
+    SPDLOG_DEBUG("EngineMixer created with '{}' voices, audible radius '{}', idle pitch '{}', min pitch '{}', max pitch '{}'",
+                 voice_count_,
+                 audible_radius_,
+                 idle_pitch_,
+                 min_pitch_,
+                 max_pitch_);
+}
 
-    SPDLOG_DEBUG("EngineSound created with idle pitch '{}', min pitch '{}', max pitch '{}', min RPM '{}', max RPM '{}'",
-                 this->idle_pitch_,
-                 this->min_pitch_,
-                 this->max_pitch_,
-                 this->min_rpm_,
-                 this->max_rpm_);
+void EngineMixer::update(const sf::Vector2f listener_position,
+                         const std::span<const EngineSource> sources)
+{
+    // Apply volume from settings (already in 0.0-1.0 range, convert to SFML's 0-100 range)
+    const float master_volume = std::clamp(settings::current::engine_volume * 100.0f, 0.0f, 100.0f);
+
+    // Rank every car by its attenuated loudness at the listener; the scratch vector is reused, so the steady state allocates nothing
+    this->ranked_.clear();
+    for (std::size_t index = 0; index < sources.size(); ++index) {
+        const sf::Vector2f offset = sources[index].position - listener_position;
+        const float distance = std::sqrt(offset.x * offset.x + offset.y * offset.y);
+
+        // Squared falloff approximates inverse-distance loudness while guaranteeing exact silence at the audible radius
+        const float falloff = std::clamp(1.0f - distance / audible_radius_, 0.0f, 1.0f);
+        const float gain = falloff * falloff;
+        if (gain > 0.001f) {
+            this->ranked_.emplace_back(gain, index);
+        }
+    }
+
+    // Only the loudest few cars get real voices; everything else stays virtual until it ranks high enough again
+    const std::size_t audible_count = std::min(this->ranked_.size(), voice_count_);
+    std::partial_sort(this->ranked_.begin(),
+                      this->ranked_.begin() + static_cast<std::ptrdiff_t>(audible_count),
+                      this->ranked_.end(),
+                      [](const std::pair<float, std::size_t> &left, const std::pair<float, std::size_t> &right) { return left.first > right.first; });
+
+    // First pass: keep cars that stay audible on their current voices, so promotions and demotions never restart a neighbor's engine loop
+    std::array<std::size_t, voice_count_> slot_voices;
+    slot_voices.fill(no_car_);
+    for (std::size_t voice_index = 0; voice_index < voice_count_; ++voice_index) {
+        const std::size_t assigned_car = this->voice_cars_[voice_index];
+        if (assigned_car == no_car_) {
+            continue;
+        }
+        bool still_audible = false;
+        for (std::size_t slot = 0; slot < audible_count; ++slot) {
+            if (this->ranked_[slot].second == assigned_car) {
+                slot_voices[slot] = voice_index;
+                still_audible = true;
+                break;
+            }
+        }
+        if (!still_audible) {
+            // The car fell out of the audible set; its voice is reclaimed and the car becomes virtual (parameters only)
+            this->voice_cars_[voice_index] = no_car_;
+        }
+    }
+
+    // Second pass: revive newly audible cars onto the reclaimed voices
+    for (std::size_t slot = 0; slot < audible_count; ++slot) {
+        if (slot_voices[slot] != no_car_) {
+            continue;
+        }
+        for (std::size_t voice_index = 0; voice_index < voice_count_; ++voice_index) {
+            if (this->voice_cars_[voice_index] == no_car_) {
+                this->voice_cars_[voice_index] = this->ranked_[slot].second;
+                slot_voices[slot] = voice_index;
+
+                // Offset the loop start per car, so a grid of identical engines doesn't phase-lock into one droning chorus
+                sf::Sound &voice = this->voices_[voice_index];
+                const float loop_fraction = static_cast<float>((this->ranked_[slot].second * 61) % 100) / 100.0f;
+                voice.setPlayingOffset(voice.getBuffer().getDuration() * loop_fraction);
+                break;
+            }
+        }
+    }
+
+    // Third pass: apply per-voice pitch (pure function of the car's speed) and attenuated volume, and make sure audible voices are playing
+    for (std::size_t slot = 0; slot < audible_count; ++slot) {
+        sf::Sound &voice = this->voices_[slot_voices[slot]];
+        voice.setPitch(EngineMixer::calculate_pitch(sources[this->ranked_[slot].second].speed));
+        voice.setVolume(this->ranked_[slot].first * master_volume);
+        if (voice.getStatus() != sf::SoundSource::Status::Playing) {
+            voice.play();
+        }
+    }
+
+    // Stop any voice left without a car, so idle voices don't burn mixer time
+    for (std::size_t voice_index = 0; voice_index < voice_count_; ++voice_index) {
+        if (this->voice_cars_[voice_index] == no_car_ && this->voices_[voice_index].getStatus() == sf::SoundSource::Status::Playing) {
+            this->voices_[voice_index].stop();
+        }
+    }
+}
+
+void EngineMixer::stop()
+{
+    bool was_playing = false;
+    for (std::size_t voice_index = 0; voice_index < voice_count_; ++voice_index) {
+        if (this->voices_[voice_index].getStatus() == sf::SoundSource::Status::Playing) {
+            this->voices_[voice_index].stop();
+            was_playing = true;
+        }
+        this->voice_cars_[voice_index] = no_car_;
+    }
+    if (was_playing) {
+        SPDLOG_DEBUG("Engine voices stopped");
+    }
 }
-void EngineSound::update(const float speed)
+
+float EngineMixer::calculate_pitch(const float speed)
 {
     // Determine current gear based on speed thresholds
-    const std::size_t new_gear = this->determine_gear(speed);
-    if (new_gear != this->current_gear_) {
-        this->current_gear_ = new_gear;
-        // SPDLOG_DEBUG("Engine gear shifted to gear '{}'", this->current_gear_);
-    }
+    const std::size_t gear = EngineMixer::determine_gear(speed);
 
     // Calculate fake RPM based on current speed and gear selection
-    const float rpm = this->calculate_rpm(speed);
+    const float rpm = EngineMixer::calculate_rpm(speed, gear);
 
     // Map RPM to pitch using linear interpolation between min and max pitch values
-    const float rpm_ratio = std::clamp((rpm - this->min_rpm_) / (this->max_rpm_ - this->min_rpm_), 0.0f, 1.0f);
-    float pitch = std::lerp(this->min_pitch_, this->max_pitch_, rpm_ratio);
+    const float rpm_ratio = std::clamp((rpm - min_rpm_) / (max_rpm_ - min_rpm_), 0.0f, 1.0f);
+    float pitch = std::lerp(min_pitch_, max_pitch_, rpm_ratio);
 
     // Add smooth gear transition blending to prevent abrupt pitch changes during gear shifts
-    if (this->current_gear_ < this->gear_count_ && speed > 0.0f) {
-        const float next_gear_threshold = this->gear_shift_speeds_[this->current_gear_];
+    if (gear < gear_count_ && speed > 0.0f) {
+        const float next_gear_threshold = gear_shift_speeds_[gear];
 
         // Check if we're approaching a gear shift within the blending zone
-        if (speed > (next_gear_threshold - this->gear_blend_zone_) && speed < next_gear_threshold) {
+        if (speed > (next_gear_threshold - gear_blend_zone_) && speed < next_gear_threshold) {
             // Calculate the pitch that the next gear would produce for smooth blending
-            const float gear_rpm_range = (this->max_rpm_ - this->min_rpm_) / static_cast<float>(this->gear_count_);
-            const float next_gear_rpm = this->min_rpm_ + gear_rpm_range * this->next_gear_rpm_multiplier_;
-            const float next_gear_rpm_ratio = std::clamp((next_gear_rpm - this->min_rpm_) / (this->max_rpm_ - this->min_rpm_), 0.0f, 1.0f);
-            const float next_gear_pitch = std::lerp(this->min_pitch_, this->max_pitch_, next_gear_rpm_ratio);
+            const float gear_rpm_range = (max_rpm_ - min_rpm_) / static_cast<float>(gear_count_);
+            const float next_gear_rpm = min_rpm_ + gear_rpm_range * next_gear_rpm_multiplier_;
+            const float next_gear_rpm_ratio = std::clamp((next_gear_rpm - min_rpm_) / (max_rpm_ - min_rpm_), 0.0f, 1.0f);
+            const float next_gear_pitch = std::lerp(min_pitch_, max_pitch_, next_gear_rpm_ratio);
 
             // Blend between current gear pitch and next gear pitch based on position in blending zone
-            const float blend_factor = (speed - (next_gear_threshold - this->gear_blend_zone_)) / this->gear_blend_zone_;
+            const float blend_factor = (speed - (next_gear_threshold - gear_blend_zone_)) / gear_blend_zone_;
             pitch = std::lerp(pitch, next_gear_pitch, blend_factor);
         }
     }
 
     // When at very low speeds, blend between idle pitch and calculated driving pitch for smooth startup
-    if (speed < this->idle_blend_speed_) {
-        const float blend_factor = speed / this->idle_blend_speed_;
-        pitch = std::lerp(this->idle_pitch_, pitch, blend_factor);
-    }
-
-    // Apply the calculated pitch to the engine sound
-    this->engine_sound_.setPitch(pitch);
-
-    // Apply volume from settings (already in 0.0-1.0 range, convert to SFML's 0-100 range
-    this->engine_sound_.setVolume(std::clamp(settings::current::engine_volume * 100.0f, 0.0f, 100.0f));
-}
-
-void EngineSound::start()
-{
-    if (this->engine_sound_.getStatus() != sf::SoundSource::Status::Playing) {
-        this->engine_sound_.play();
-        SPDLOG_DEBUG("Engine sound started");
+    if (speed < idle_blend_speed_) {
+        const float blend_factor = speed / idle_blend_speed_;
+        pitch = std::lerp(idle_pitch_, pitch, blend_factor);
     }
-}
 
-void EngineSound::stop()
-{
-    if (this->engine_sound_.getStatus() == sf::SoundSource::Status::Playing) {
-        this->engine_sound_.stop();
-        SPDLOG_DEBUG("Engine sound stopped");
-    }
+    return pitch;
 }
 
-bool EngineSound::is_playing() const
-{
-    return this->engine_sound_.getStatus() == sf::SoundSource::Status::Playing;
-}
-
-float EngineSound::calculate_rpm(const float speed) const
+float EngineMixer::calculate_rpm(const float speed,
+                                 const std::size_t gear)
 {
     // Start with base idle RPM as the minimum engine speed
-    float rpm = this->min_rpm_;
+    float rpm = min_rpm_;
 
     // Add RPM based on speed within the current gear's operating range
-    if (this->current_gear_ > 0 && this->current_gear_ <= this->gear_count_) {
+    if (gear > 0 && gear <= gear_count_) {
         // Get the speed range for the current gear (minimum speed for this gear)
-        const float gear_min_speed = this->gear_shift_speeds_[this->current_gear_ - 1];
+        const float gear_min_speed = gear_shift_speeds_[gear - 1];
 
         // Determine maximum speed for current gear (either next gear threshold or absolute max speed)
-        const float gear_max_speed = (this->current_gear_ < this->gear_count_) ? this->gear_shift_speeds_[this->current_gear_] : this->max_car_speed_;
+        const float gear_max_speed = (gear < gear_count_) ? gear_shift_speeds_[gear] : max_car_speed_;
 
         // Calculate how far we are through the current gear's speed range (0.0 to 1.0)
         const float speed_in_gear = std::clamp((speed - gear_min_speed) / (gear_max_speed - gear_min_speed), 0.0f, 1.0f);
 
         // Calculate the RPM range that each gear covers and add proportional RPM
-        const float gear_rpm_range = (this->max_rpm_ - this->min_rpm_) / static_cast<float>(this->gear_count_);
-        rpm += speed_in_gear * gear_rpm_range * this->gear_overlap_multiplier_;
+        const float gear_rpm_range = (max_rpm_ - min_rpm_) / static_cast<float>(gear_count_);
+        rpm += speed_in_gear * gear_rpm_range * gear_overlap_multiplier_;
     }
 
     // Ensure RPM stays within realistic engine limits
-    return std::clamp(rpm, this->min_rpm_, this->max_rpm_);
+    return std::clamp(rpm, min_rpm_, max_rpm_);
 }
 
-std::size_t EngineSound::determine_gear(const float speed) const
+std::size_t EngineMixer::determine_gear(const float speed)
 {
     // Find the appropriate gear by checking speed thresholds from highest to lowest gear
     // This ensures we select the highest gear that the current speed can support
-    for (std::size_t gear = this->gear_count_; gear >= 1; --gear) {
-        if (speed >= this->gear_shift_speeds_[gear - 1]) {
+    for (std::size_t gear = gear_count_; gear >= 1; --gear) {
+        if (speed >= gear_shift_speeds_[gear - 1]) {
             return gear;
         }
     }
@@ -198,12 +284,59 @@ void TireScreechSound::stop()
     }
 }
 
-WallHitSound::WallHitSound(const sf::SoundBuffer &sound_buffer)
-    : wall_hit_sound_(sound_buffer)
+VoicePool::VoicePool(const sf::SoundBuffer &initial_buffer)
+{
+    // Preallocate every voice up front; "play()" only rebinds buffers and never allocates
+    this->voices_.reserve(this->voice_count_);
+    for (std::size_t index = 0; index < this->voice_count_; ++index) {
+        this->voices_.push_back(Voice{.sound = sf::Sound{initial_buffer}});
+    }
+
+    SPDLOG_DEBUG("VoicePool created with '{}' preallocated voices", this->voice_count_);
+}
+
+void VoicePool::play(const sf::SoundBuffer &buffer,
+                     const float volume,
+                     const float pitch,
+                     const int priority)
 {
-    this->wall_hit_sound_.setPitch(this->base_pitch_);
-    this->wall_hit_sound_.setVolume(0.0f);  // Start silent, volume set in play()
+    // Prefer a voice that already finished; otherwise remember the least important (oldest on ties) playing voice as the steal candidate
+    Voice *candidate = nullptr;
+    bool candidate_is_free = false;
+    for (Voice &voice : this->voices_) {
+        if (voice.sound.getStatus() != sf::SoundSource::Status::Playing) {
+            candidate = &voice;
+            candidate_is_free = true;
+            break;
+        }
+        if (candidate == nullptr ||
+            voice.priority < candidate->priority ||
+            (voice.priority == candidate->priority && voice.sequence < candidate->sequence)) {
+            candidate = &voice;
+        }
+    }
+
+    // Every voice is busy with something strictly more important, so dropping the new sound is the right call
+    if (!candidate_is_free && candidate->priority > priority) [[unlikely]] {
+        return;
+    }
+
+    // Rebind the buffer only if the voice held a different one; same-buffer steals (e.g., rapid wall hits) skip this entirely
+    if (&candidate->sound.getBuffer() != &buffer) {
+        candidate->sound.setBuffer(buffer);
+    }
+    candidate->sound.setVolume(volume);
+    candidate->sound.setPitch(pitch);
+    candidate->sound.play();
+    candidate->priority = priority;
+    candidate->sequence = this->next_sequence_++;
+}
 
+WallHitSound::WallHitSound(VoicePool &voice_pool,
+                           const sf::SoundBuffer &sound_buffer)
+    : voice_pool_(voice_pool),
+      sound_buffer_(sound_buffer)
+{
     SPDLOG_DEBUG("WallHitSound created with base pitch '{}', max pitch '{}', minimum impact speed '{}', max volume impact speed '{}'",
                  this->base_pitch_,
                  this->max_pitch_,
@@ -225,19 +358,19 @@ void WallHitSound::play(const float impact_speed)
     const float pitch_ratio = std::clamp(impact_speed / this->max_volume_impact_speed_pixels_per_second_, 0.0f, 1.0f);
     const float pitch = std::lerp(this->base_pitch_, this->max_pitch_, pitch_ratio);
 
-    // Apply volume from settings and calculated ratio
+    // Apply volume from settings and calculated ratio, then play through the pool; the priority scales with the volume ratio, so loud hits steal voices from quiet ones
     const float final_volume = std::clamp(settings::current::wall_hit_volume * volume_ratio * 100.0f, 0.0f, 100.0f);
-    this->wall_hit_sound_.setVolume(final_volume);
-    this->wall_hit_sound_.setPitch(pitch);
-    this->wall_hit_sound_.play();  // play() restarts if already playing in SFML 3
+    this->voice_pool_.play(this->sound_buffer_, final_volume, pitch, static_cast<int>(volume_ratio * static_cast<float>(this->max_priority_)));
 
     // SPDLOG_DEBUG("Wall hit sound played with impact speed '{}', volume ratio '{}', final volume '{}', pitch '{}'", impact_speed, volume_ratio, final_volume, pitch);
 }
 
-UiSound::UiSound(const sf::SoundBuffer &ok_sound_buffer,
+UiSound::UiSound(VoicePool &voice_pool,
+                 const sf::SoundBuffer &ok_sound_buffer,
                  const sf::SoundBuffer &other_sound_buffer)
-    : ok_sound_(ok_sound_buffer),
-      other_sound_(other_sound_buffer)
+    : voice_pool_(voice_pool),
+      ok_sound_buffer_(ok_sound_buffer),
+      other_sound_buffer_(other_sound_buffer)
 {
     SPDLOG_DEBUG("UiSound created with '{}' volume", settings::current::ui_volume * 100.0f);
 }
@@ -246,8 +379,7 @@ void UiSound::play_ok()
 {
     // Apply volume from settings (convert from 0.0-1.0 to 0-100 range for SFML)
     const float final_volume = std::clamp(settings::current::ui_volume * 100.0f, 0.0f, 100.0f);
-    this->ok_sound_.setVolume(final_volume);
-    this->ok_sound_.play();  // play() restarts if already playing in SFML 3
+    this->voice_pool_.play(this->ok_sound_buffer_, final_volume, 1.0f, this->ui_priority_);
 
     // SPDLOG_DEBUG("UI 'ok' sound played with volume '{}'", final_volume);
 }
@@ -255,10 +387,122 @@ void UiSound::play_ok()
 void UiSound::play_other()
 {
     const float final_volume = std::clamp(settings::current::ui_volume * 100.0f, 0.0f, 100.0f);
-    this->other_sound_.setVolume(final_volume);
-    this->other_sound_.play();  // play() restarts if already playing in SFML 3
+    this->voice_pool_.play(this->other_sound_buffer_, final_volume, 1.0f, this->ui_priority_);
 
     // SPDLOG_DEBUG("UI 'other' sound played with volume '{}'", final_volume);
 }
 
+MusicPlayer::MusicPlayer(const std::filesystem::path &music_directory)
+{
+    // One base name per context, in "MusicContext" order; the first existing file with a supported extension wins
+    constexpr std::array<const char *, 2> base_names = {"menu", "race"};
+    constexpr std::array<const char *, 4> extensions = {".ogg", ".flac", ".wav", ".mp3"};
+    for (std::size_t context_index = 0; context_index < base_names.size(); ++context_index) {
+        for (const char *extension : extensions) {
+            std::filesystem::path candidate = music_directory / base_names[context_index];
+            candidate += extension;
+            std::error_code ec;  // Ignore lookup errors (e.g., the directory does not exist); a missing track just means silence
+            if (std::filesystem::exists(candidate, ec)) {
+                this->sources_[context_index].path = std::move(candidate);
+                break;
+            }
+        }
+        if (this->sources_[context_index].available()) {
+            SPDLOG_DEBUG("Music track for context '{}' found at '{}'", base_names[context_index], this->sources_[context_index].path.string());
+        }
+        else {
+            SPDLOG_DEBUG("No music track for context '{}' in '{}', this context will be silent", base_names[context_index], music_directory.string());
+        }
+    }
+}
+
+void MusicPlayer::set_embedded(const MusicContext context,
+                               const unsigned char *data,
+                               const std::size_t size)
+{
+    TrackSource &source = this->sources_[static_cast<std::size_t>(context)];
+    source.embedded_data = data;
+    source.embedded_size = size;
+    SPDLOG_DEBUG("Embedded music track of '{}' bytes registered for context '{}'", size, static_cast<std::size_t>(context));
+}
+
+void MusicPlayer::set_context(const MusicContext context)
+{
+    // Repeated requests for the current context are the common case (called once per frame); bail out before touching any stream
+    if (this->context_requested_ && context == this->context_) {
+        return;
+    }
+    this->context_ = context;
+    this->context_requested_ = true;
+
+    const TrackSource &source = this->sources_[static_cast<std::size_t>(context)];
+    const std::size_t incoming_slot = 1 - this->active_slot_;
+
+    // A context without a track (or one whose file vanished) fades the current music out; the active slot stays put and "update()" drives its volume to zero
+    if (!source.available() || !this->open_into_slot(incoming_slot, source)) {
+        // Cut any previous outgoing track immediately; only the active one gets the fade
+        if (this->slot_open_[incoming_slot]) {
+            this->slots_[incoming_slot].stop();
+            this->slot_open_[incoming_slot] = false;
+        }
+        if (this->slot_open_[this->active_slot_]) {
+            this->fade_progress_ = 0.0f;
+        }
+        return;
+    }
+
+    // The incoming track starts silent and ramps up while the previous one ramps down
+    this->active_slot_ = incoming_slot;
+    this->fade_progress_ = 0.0f;
+}
+
+void MusicPlayer::update(const float dt)
+{
+    this->fade_progress_ = std::min(this->fade_progress_ + dt / this->crossfade_seconds_, 1.0f);
+
+    // Apply volume from settings every frame, so slider changes take effect immediately (convert from 0.0-1.0 to 0-100 range for SFML)
+    const float master_volume = std::clamp(settings::current::music_volume * 100.0f, 0.0f, 100.0f);
+
+    const std::size_t outgoing_slot = 1 - this->active_slot_;
+    if (this->slot_open_[this->active_slot_]) {
+        // When the active context has no track, the active slot is the one fading out
+        const bool fading_out = !this->sources_[static_cast<std::size_t>(this->context_)].available();
+        this->slots_[this->active_slot_].setVolume(master_volume * (fading_out ? 1.0f - this->fade_progress_ : this->fade_progress_));
+        if (fading_out && this->fade_progress_ >= 1.0f) {
+            this->slots_[this->active_slot_].stop();
+            this->slot_open_[this->active_slot_] = false;
+        }
+    }
+    if (this->slot_open_[outgoing_slot]) {
+        this->slots_[outgoing_slot].setVolume(master_volume * (1.0f - this->fade_progress_));
+        if (this->fade_progress_ >= 1.0f) {
+            this->slots_[outgoing_slot].stop();
+            this->slot_open_[outgoing_slot] = false;
+        }
+    }
+}
+
+bool MusicPlayer::open_into_slot(const std::size_t slot,
+                                 const TrackSource &source)
+{
+    sf::Music &music = this->slots_[slot];
+    music.stop();
+
+    // Embedded data takes priority; both paths only read headers here, decoding happens chunk by chunk on SFML's streaming thread
+    const bool opened = source.embedded_data != nullptr
+                            ? music.openFromMemory(source.embedded_data, source.embedded_size)
+                            : music.openFromFile(source.path);
+    if (!opened) {
+        SPDLOG_WARN("Failed to open music track '{}'", source.path.string());
+        this->slot_open_[slot] = false;
+        return false;
+    }
+
+    music.setLooping(true);
+    music.setVolume(0.0f);  // Starts silent; "update()" ramps it up over the crossfade
+    music.play();
+    this->slot_open_[slot] = true;
+    return true;
+}
+
 }  // namespace core::sfx
@@ -6,94 +6,142 @@
 
 #pragma once
 
-#include <array>    // for std::array
-#include <cstddef>  // for std::size_t
+#include <array>       // for std::array
+#include <cstddef>     // for std::size_t
+#include <cstdint>     // for std::uint64_t
+#include <filesystem>  // for std::filesystem
+#include <span>        // for std::span
+#include <utility>     // for std::pair
+#include <vector>      // for std::vector
 
 #include <SFML/Audio.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "memory.hpp"
 
 namespace core::sfx {
 
 /**
- * @brief Class that manages engine sound playback based on car speed.
- *
- * Simulates a 5-gear transmission by calculating fake RPM from speed and adjusting pitch accordingly.
+ * @brief Parameter struct for one car's contribution to the engine mix. Holds the car's position and speed.
  */
-class EngineSound final {
-  public:
+struct EngineSource final {
     /**
-     * @brief Construct a new EngineSound object.
-     *
-     * @param sound_buffer Reference to the engine sound buffer to be played in a loop.
+     * @brief Car position in world coordinates (pixels).
      */
-    explicit EngineSound(const sf::SoundBuffer &sound_buffer);
+    sf::Vector2f position;
 
     /**
-     * @brief Default destructor.
+     * @brief Car speed in pixels per second.
      */
-    ~EngineSound() = default;
+    float speed;
+};
 
+/**
+ * @brief Class that mixes per-car engine sounds with distance attenuation and voice virtualization.
+ *
+ * Simulates a 5-gear transmission by calculating fake RPM from speed and adjusting pitch accordingly, for every car on the grid. Each frame, cars are ranked by their attenuated loudness at the listener (the camera center); only the loudest few occupy real looping "sf::Sound" voices, while the rest stay virtual, tracked by parameters alone. Because pitch and volume are pure functions of a car's speed and distance, a virtual car revives seamlessly onto a free voice the moment it ranks high enough — the audio analog of view culling, so engine audio scales to 100-car grids without a mixer channel per car.
+ */
+class EngineMixer final {
+  public:
     /**
-     * @brief Update engine sound based on current car speed.
+     * @brief Construct a new EngineMixer object, preallocating all voices.
      *
-     * @param speed Current car speed in pixels per second.
-     *
-     * @note This calculates fake RPM, determines the appropriate gear, and adjusts pitch and volume accordingly.
+     * @param sound_buffer Reference to the engine sound buffer to be played in a loop on every voice.
      */
-    void update(const float speed);
+    explicit EngineMixer(const sf::SoundBuffer &sound_buffer);
 
     /**
-     * @brief Start playing the engine sound loop.
+     * @brief Default destructor.
      */
-    void start();
+    ~EngineMixer() = default;
 
     /**
-     * @brief Stop playing the engine sound.
+     * @brief Update the engine mix: rank all cars by loudness at the listener, assign the loudest to real voices, and set per-voice pitch and volume.
+     *
+     * Cars that stay audible keep their voice across frames, so promotions and demotions of other cars never restart a neighbor's engine loop.
+     *
+     * @param listener_position Listener position in world coordinates (pixels), typically the camera center.
+     * @param sources Position and speed of every car on the grid.
+     *
+     * @note Call this once per frame while racing; call "stop()" when leaving the playing state.
      */
-    void stop();
+    void update(const sf::Vector2f listener_position,
+                const std::span<const EngineSource> sources);
 
     /**
-     * @brief Check if the engine sound is currently playing.
-     *
-     * @return True if the sound is playing, false otherwise.
+     * @brief Stop all engine voices and release their car assignments.
      */
-    [[nodiscard]] bool is_playing() const;
+    void stop();
 
     // Allow move semantics
-    EngineSound(EngineSound &&) = default;
-    EngineSound &operator=(EngineSound &&) = default;
+    EngineMixer(EngineMixer &&) = default;
+    EngineMixer &operator=(EngineMixer &&) = default;
 
     // Disable copy semantics
-    EngineSound(const EngineSound &) = delete;
-    EngineSound &operator=(const EngineSound &) = delete;
+    EngineMixer(const EngineMixer &) = delete;
+    EngineMixer &operator=(const EngineMixer &) = delete;
 
   private:
     /**
-     * @brief Calculate fake RPM based on current speed and gear.
+     * @brief Calculate the playback pitch for a car moving at the given speed.
+     *
+     * Determines the gear from the speed thresholds, maps the fake RPM to the pitch range, and applies the gear shift and idle blending. This is a pure function, which is what makes virtual cars free to track: no per-car audio state survives between frames.
+     *
+     * @param speed Car speed in pixels per second.
+     *
+     * @return Pitch multiplier to apply to the engine loop.
+     */
+    [[nodiscard]] static float calculate_pitch(const float speed);
+
+    /**
+     * @brief Calculate fake RPM based on speed and gear.
      *
-     * @param speed Current car speed in pixels per second.
+     * @param speed Car speed in pixels per second.
+     * @param gear Current gear (1-5).
      *
      * @return Calculated RPM value.
      */
-    [[nodiscard]] float calculate_rpm(const float speed) const;
+    [[nodiscard]] static float calculate_rpm(const float speed,
+                                             const std::size_t gear);
 
     /**
      * @brief Determine the current gear based on speed.
      *
-     * @param speed Current car speed in pixels per second.
+     * @param speed Car speed in pixels per second.
      *
      * @return Current gear (1-5).
      */
-    [[nodiscard]] std::size_t determine_gear(const float speed) const;
+    [[nodiscard]] static std::size_t determine_gear(const float speed);
+
+    /**
+     * @brief Number of real voices; only this many cars are audible at once, everything further away is virtual.
+     */
+    static constexpr std::size_t voice_count_ = 8;
+
+    /**
+     * @brief Distance from the listener at which an engine becomes inaudible, in pixels.
+     */
+    static constexpr float audible_radius_ = 3000.0f;
 
     /**
-     * @brief SFML Sound object for engine sound playback.
+     * @brief Sentinel marking a voice with no car assigned.
      */
-    sf::Sound engine_sound_;
+    static constexpr std::size_t no_car_ = static_cast<std::size_t>(-1);
 
     /**
-     * @brief Current gear (1-5).
+     * @brief Preallocated looping voices, filled once in the constructor and never resized afterwards.
      */
-    std::size_t current_gear_ = 1;
+    memory::TrackedVector<sf::Sound, memory::Tag::Sfx> voices_;
+
+    /**
+     * @brief Source index currently assigned to each voice, or "no_car_" when the voice is idle.
+     */
+    std::array<std::size_t, voice_count_> voice_cars_;
+
+    /**
+     * @brief Scratch vector of (gain, source index) pairs reused every frame, so ranking allocates nothing in the steady state.
+     */
+    memory::TrackedVector<std::pair<float, std::size_t>, memory::Tag::Sfx> ranked_;
 
     /**
      * @brief Number of gears in the transmission.
@@ -258,19 +306,100 @@ class TireScreechSound final {
     float current_actual_volume_ = 0.0f;
 };
 
+/**
+ * @brief Class that manages a fixed pool of preallocated voices shared by all one-shot sound effects.
+ *
+ * Every voice (an "sf::Sound") is created up front, so playing an effect never allocates and never reloads a buffer; an event either reuses a voice that already finished or steals the least important playing one. Stealing compares priorities: a voice is only taken from a sound of equal or lower priority (oldest first on ties), so rapid events like wall hits in 100-car stress mode overlap or recycle each other instead of cutting off more important sounds or being dropped outright. A new sound is only dropped when every voice is busy with something strictly more important.
+ */
+class VoicePool final {
+  public:
+    /**
+     * @brief Construct a new VoicePool object, preallocating all voices.
+     *
+     * @param initial_buffer Reference to any sound buffer used to construct the voices (SFML sounds cannot exist without one); each "play()" rebinds the buffer as needed.
+     */
+    explicit VoicePool(const sf::SoundBuffer &initial_buffer);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~VoicePool() = default;
+
+    /**
+     * @brief Play a one-shot sound on a free voice, stealing the least important playing voice if none is free.
+     *
+     * @param buffer Sound buffer to play; only rebound if the chosen voice holds a different buffer.
+     * @param volume Playback volume in SFML's [0, 100] range.
+     * @param pitch Playback pitch multiplier (e.g., "1.0" for unchanged).
+     * @param priority Importance of this sound; voices playing a higher priority are never stolen for it.
+     *
+     * @note If every voice is playing something of strictly higher priority, the sound is dropped.
+     */
+    void play(const sf::SoundBuffer &buffer,
+              const float volume,
+              const float pitch,
+              const int priority);
+
+    // Allow move semantics
+    VoicePool(VoicePool &&) = default;
+    VoicePool &operator=(VoicePool &&) = default;
+
+    // Disable copy semantics
+    VoicePool(const VoicePool &) = delete;
+    VoicePool &operator=(const VoicePool &) = delete;
+
+  private:
+    /**
+     * @brief One preallocated voice with the bookkeeping needed for priority-based stealing.
+     */
+    struct Voice final {
+        /**
+         * @brief SFML Sound object for this voice's playback.
+         */
+        sf::Sound sound;
+
+        /**
+         * @brief Priority of the sound currently (or last) played on this voice.
+         */
+        int priority = 0;
+
+        /**
+         * @brief Monotonic counter value of the last "play()" on this voice, used to steal the oldest voice among equal priorities.
+         */
+        std::uint64_t sequence = 0;
+    };
+
+    /**
+     * @brief Number of preallocated voices; enough for overlapping wall hits plus UI feedback without an audible shortage.
+     */
+    static constexpr std::size_t voice_count_ = 8;
+
+    /**
+     * @brief Preallocated voices, filled once in the constructor and never resized afterwards.
+     */
+    memory::TrackedVector<Voice, memory::Tag::Sfx> voices_;
+
+    /**
+     * @brief Monotonic counter stamped onto a voice at every "play()".
+     */
+    std::uint64_t next_sequence_ = 0;
+};
+
 /**
  * @brief Class that manages wall hit sound playback when the car collides with track boundaries.
  *
- * Plays a wall hit sound effect with volume adjusted based on collision impact speed.
+ * Plays a wall hit sound effect with volume adjusted based on collision impact speed. Playback goes through the shared "VoicePool", so rapid consecutive hits overlap on separate voices instead of restarting one sound.
  */
 class WallHitSound final {
   public:
     /**
      * @brief Construct a new WallHitSound object.
      *
+     * @param voice_pool Reference to the shared voice pool to play through.
      * @param sound_buffer Reference to the wall hit sound buffer to be played.
      */
-    explicit WallHitSound(const sf::SoundBuffer &sound_buffer);
+    WallHitSound(VoicePool &voice_pool,
+                 const sf::SoundBuffer &sound_buffer);
 
     /**
      * @brief Default destructor.
@@ -286,9 +415,9 @@ class WallHitSound final {
      */
     void play(const float impact_speed);
 
-    // Allow move semantics
+    // Allow move construction but disable move assignment (due to reference members)
     WallHitSound(WallHitSound &&) = default;
-    WallHitSound &operator=(WallHitSound &&) = default;
+    WallHitSound &operator=(WallHitSound &&) = delete;
 
     // Disable copy semantics
     WallHitSound(const WallHitSound &) = delete;
@@ -296,9 +425,19 @@ class WallHitSound final {
 
   private:
     /**
-     * @brief SFML Sound object for wall hit sound playback.
+     * @brief Shared voice pool the wall hit sound plays through.
+     */
+    VoicePool &voice_pool_;
+
+    /**
+     * @brief Wall hit sound buffer passed to the pool on every "play()".
+     */
+    const sf::SoundBuffer &sound_buffer_;
+
+    /**
+     * @brief Priority of a wall hit at maximum impact speed; scaled down with the volume ratio so loud hits steal voices from quiet ones.
      */
-    sf::Sound wall_hit_sound_;
+    static constexpr int max_priority_ = 100;
 
     /**
      * @brief Minimum impact speed required to trigger wall hit sound in pixels per second.
@@ -324,17 +463,19 @@ class WallHitSound final {
 /**
  * @brief Class that manages UI sound playback for menu interactions.
  *
- * Plays UI sound effects for various interface interactions like button clicks and menu navigation.
+ * Plays UI sound effects for various interface interactions like button clicks and menu navigation. Playback goes through the shared "VoicePool" at a priority above every in-game effect, so UI feedback is never stolen by collision noise.
  */
 class UiSound final {
   public:
     /**
      * @brief Construct a new UiSound object.
      *
+     * @param voice_pool Reference to the shared voice pool to play through.
      * @param ok_sound_buffer Reference to the 'ok' sound buffer to be played for confirmations.
      * @param other_sound_buffer Reference to the 'other' sound buffer to be played for misc actions.
      */
-    UiSound(const sf::SoundBuffer &ok_sound_buffer,
+    UiSound(VoicePool &voice_pool,
+            const sf::SoundBuffer &ok_sound_buffer,
             const sf::SoundBuffer &other_sound_buffer);
 
     /**
@@ -356,9 +497,9 @@ class UiSound final {
      */
     void play_other();
 
-    // Allow move semantics
+    // Allow move construction but disable move assignment (due to reference members)
     UiSound(UiSound &&) = default;
-    UiSound &operator=(UiSound &&) = default;
+    UiSound &operator=(UiSound &&) = delete;
 
     // Disable copy semantics
     UiSound(const UiSound &) = delete;
@@ -366,14 +507,177 @@ class UiSound final {
 
   private:
     /**
-     * @brief SFML Sound object for 'ok' sound playback.
+     * @brief Shared voice pool the UI sounds play through.
+     */
+    VoicePool &voice_pool_;
+
+    /**
+     * @brief 'Ok' sound buffer passed to the pool by "play_ok()".
+     */
+    const sf::SoundBuffer &ok_sound_buffer_;
+
+    /**
+     * @brief 'Other' sound buffer passed to the pool by "play_other()".
+     */
+    const sf::SoundBuffer &other_sound_buffer_;
+
+    /**
+     * @brief Priority of UI sounds; above the maximum wall hit priority, so menu feedback is never stolen by collisions.
+     */
+    static constexpr int ui_priority_ = 200;
+};
+
+/**
+ * @brief Enum of the music contexts the player crossfades between.
+ */
+enum class MusicContext : std::size_t {
+    /**
+     * @brief Main menu, pause, and settings screens.
+     */
+    Menu,
+
+    /**
+     * @brief Active racing.
+     */
+    Race,
+};
+
+/**
+ * @brief Class that streams looping background music and crossfades between contexts.
+ *
+ * Unlike the short effects, which are fully decoded into "sf::SoundBuffer" at startup, music goes through "sf::Music": the file is decoded in small chunks on SFML's streaming thread while it plays, so a multi-minute track costs kilobytes of resident memory instead of tens of megabytes and adds nothing to startup time. Tracks come from optional files in a music directory (one per context) or from embedded data registered via "set_embedded()"; a missing track simply fades the current one out, so the game works silently without any music installed.
+ */
+class MusicPlayer final {
+  public:
+    /**
+     * @brief Construct a new MusicPlayer object and look up the per-context track files.
+     *
+     * For each context, the first existing file among "menu"/"race" with a supported extension (".ogg", ".flac", ".wav", ".mp3") in the given directory is used. Nothing plays until "set_context()" is called.
+     *
+     * @param music_directory Directory to look up track files in; may not exist, in which case no file-based tracks are available.
+     */
+    explicit MusicPlayer(const std::filesystem::path &music_directory);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~MusicPlayer() = default;
+
+    /**
+     * @brief Register an embedded track for a context, taking priority over any file found on disk.
+     *
+     * The data is streamed in place, not copied; the caller must keep it alive for the lifetime of this object (embedded assets are static, so this is free).
+     *
+     * @param context Context the track plays in.
+     * @param data Pointer to the encoded audio data in memory.
+     * @param size Size (in bytes) of the encoded audio data.
+     */
+    void set_embedded(const MusicContext context,
+                      const unsigned char *data,
+                      const std::size_t size);
+
+    /**
+     * @brief Switch to a context's track, crossfading from whatever is playing.
+     *
+     * A repeated call with the current context is a no-op; a context without a track fades the current music out to silence.
+     *
+     * @param context Context whose track should play.
+     */
+    void set_context(const MusicContext context);
+
+    /**
+     * @brief Advance the crossfade and apply the music volume from settings.
+     *
+     * @param dt Delta time in seconds since the last call.
+     *
+     * @note Call this once per frame, even on frames the idle governor skips, so fades finish and volume changes apply while a menu is idle.
+     */
+    void update(const float dt);
+
+    // Disable copy and move semantics ("sf::Music" owns a streaming thread and cannot be moved)
+    MusicPlayer(const MusicPlayer &) = delete;
+    MusicPlayer &operator=(const MusicPlayer &) = delete;
+    MusicPlayer(MusicPlayer &&) = delete;
+    MusicPlayer &operator=(MusicPlayer &&) = delete;
+
+  private:
+    /**
+     * @brief Parameter struct for one context's track source. Holds the on-disk path and the optional embedded data that overrides it.
+     */
+    struct TrackSource final {
+        /**
+         * @brief Path of the track file; empty when no file was found.
+         */
+        std::filesystem::path path;
+
+        /**
+         * @brief Pointer to embedded encoded audio; null unless "set_embedded()" was called.
+         */
+        const unsigned char *embedded_data = nullptr;
+
+        /**
+         * @brief Size (in bytes) of the embedded encoded audio.
+         */
+        std::size_t embedded_size = 0;
+
+        /**
+         * @brief Check whether this context has any track to play.
+         *
+         * @return True if either an embedded track or a file is available; false otherwise.
+         */
+        [[nodiscard]] bool available() const { return this->embedded_data != nullptr || !this->path.empty(); }
+    };
+
+    /**
+     * @brief Open a context's track into a streaming slot and start it silently.
+     *
+     * @param slot Index of the streaming slot to open into.
+     * @param source Track source to stream from.
+     *
+     * @return True if the stream opened and started; false otherwise (e.g., the file was deleted after construction).
+     */
+    [[nodiscard]] bool open_into_slot(const std::size_t slot,
+                                      const TrackSource &source);
+
+    /**
+     * @brief Track sources indexed by "MusicContext".
+     */
+    std::array<TrackSource, 2> sources_;
+
+    /**
+     * @brief Two streaming slots; one plays the active track while the other fades the previous one out during a crossfade.
+     */
+    std::array<sf::Music, 2> slots_;
+
+    /**
+     * @brief Whether each slot currently holds an open stream.
+     */
+    std::array<bool, 2> slot_open_ = {false, false};
+
+    /**
+     * @brief Index of the slot holding the active (fading-in) track.
+     */
+    std::size_t active_slot_ = 0;
+
+    /**
+     * @brief Context most recently requested via "set_context()".
+     */
+    MusicContext context_ = MusicContext::Menu;
+
+    /**
+     * @brief Whether "set_context()" has been called at least once; nothing plays before that.
+     */
+    bool context_requested_ = false;
+
+    /**
+     * @brief Crossfade progress in "[0, 1]"; "1" means the fade is complete and only the active slot is audible.
      */
-    sf::Sound ok_sound_;
+    float fade_progress_ = 1.0f;
 
     /**
-     * @brief SFML Sound object for 'other' sound playback.
+     * @brief Duration of a full crossfade in seconds.
      */
-    sf::Sound other_sound_;
+    static constexpr float crossfade_seconds_ = 2.0f;
 };
 
 }  // namespace core::sfx
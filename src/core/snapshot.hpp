@@ -0,0 +1,144 @@
+/**
+ * @file snapshot.hpp
+ *
+ * @brief Triple-buffered snapshot channel for handing state between threads.
+ */
+
+#pragma once
+
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint64_t
+#include <mutex>    // for std::mutex, std::lock_guard
+#include <utility>  // for std::swap
+
+namespace core::snapshot {
+
+/**
+ * @brief Single-producer, single-consumer channel that hands immutable snapshots from one thread to another.
+ *
+ * The producer fills the back slot in place and publishes it; the consumer always reads the most recently published snapshot. Three slots ("write", "pending", "front") mean neither side ever waits for the other: the producer can publish while the consumer is still reading, and the consumer simply re-reads the same snapshot when nothing new has arrived. Slots are swapped by index under a mutex held only for a few pointer-sized writes, so neither operation can stall its thread.
+ *
+ * This is the handoff primitive for decoupling simulation from rendering: the simulation thread publishes a compact draw snapshot each step, and the render thread consumes whichever one is newest when it starts a frame.
+ *
+ * @tparam T Snapshot type; it is default-constructed three times up front and then reused, so give it reusable storage (e.g., vectors that keep their capacity) rather than reallocating per fill.
+ */
+template <typename T>
+class TripleBuffer final {
+  public:
+    /**
+     * @brief Construct a new TripleBuffer object with three default-constructed slots.
+     */
+    explicit TripleBuffer() = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TripleBuffer() = default;
+
+    // Disable copy semantics - slots are handed out by reference
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    // Disable move semantics - created once and shared between two threads
+    TripleBuffer(TripleBuffer &&) = delete;
+    TripleBuffer &operator=(TripleBuffer &&) = delete;
+
+    /**
+     * @brief Get the slot the producer should fill for the next publish.
+     *
+     * The slot retains whatever the producer left in it two publishes ago, so containers inside it keep their capacity; overwrite the contents rather than assuming they are empty.
+     *
+     * @return Mutable reference to the write slot.
+     *
+     * @note Producer thread only. The reference is invalidated by "publish()".
+     */
+    [[nodiscard]] T &write()
+    {
+        return this->slots_[this->write_index_];
+    }
+
+    /**
+     * @brief Publish the write slot, making it the snapshot that the next "read()" returns.
+     *
+     * If the consumer has not picked up the previous publish yet, that snapshot is silently replaced; the consumer always sees the newest state, never a backlog.
+     *
+     * @note Producer thread only.
+     */
+    void publish()
+    {
+        const std::lock_guard<std::mutex> lock{this->mutex_};
+        std::swap(this->write_index_, this->pending_index_);
+        this->fresh_ = true;
+        ++this->published_count_;
+    }
+
+    /**
+     * @brief Get the most recently published snapshot.
+     *
+     * If a new snapshot was published since the last call, the front slot is swapped for it first; otherwise the same snapshot is returned again.
+     *
+     * @return Read-only reference to the newest published snapshot.
+     *
+     * @note Consumer thread only. The reference stays valid until the next "read()". Before the first "publish()", this returns a default-constructed snapshot.
+     */
+    [[nodiscard]] const T &read()
+    {
+        const std::lock_guard<std::mutex> lock{this->mutex_};
+        if (this->fresh_) {
+            std::swap(this->front_index_, this->pending_index_);
+            this->fresh_ = false;
+        }
+        return this->slots_[this->front_index_];
+    }
+
+    /**
+     * @brief Get the number of snapshots published so far.
+     *
+     * The difference between this and the number of distinct snapshots the consumer observed is how many were dropped because the producer outpaced the consumer.
+     *
+     * @return Total number of "publish()" calls.
+     */
+    [[nodiscard]] std::uint64_t get_published_count() const
+    {
+        const std::lock_guard<std::mutex> lock{this->mutex_};
+        return this->published_count_;
+    }
+
+  private:
+    /**
+     * @brief The three snapshot slots; roles rotate by index, the storage never moves.
+     */
+    T slots_[3] = {};
+
+    /**
+     * @brief Slot the producer is currently filling; only the producer touches this index.
+     */
+    std::size_t write_index_ = 0;
+
+    /**
+     * @brief Slot holding the newest published snapshot, waiting for the consumer; guarded by "mutex_".
+     */
+    std::size_t pending_index_ = 1;
+
+    /**
+     * @brief Slot the consumer is currently reading; only the consumer touches this index.
+     */
+    std::size_t front_index_ = 2;
+
+    /**
+     * @brief True when the pending slot is newer than the front slot; guarded by "mutex_".
+     */
+    bool fresh_ = false;
+
+    /**
+     * @brief Total number of "publish()" calls; guarded by "mutex_".
+     */
+    std::uint64_t published_count_ = 0;
+
+    /**
+     * @brief Protects the index swaps; held only for a few pointer-sized writes, so neither thread can stall the other.
+     */
+    mutable std::mutex mutex_;
+};
+
+}  // namespace core::snapshot
@@ -2,11 +2,11 @@
  * @file widgets.cpp
  */
 
-#include <algorithm>    // for std::clamp
-#include <cstddef>      // for std::size_t
+#include <algorithm>    // for std::clamp, std::copy_n, std::max, std::min, std::nth_element
+#include <cfloat>       // for FLT_MAX
+#include <cstddef>      // for std::ptrdiff_t, std::size_t
 #include <format>       // for std::format
 #include <functional>   // for std::function
-#include <ranges>       // for std::ranges
 #include <stdexcept>    // for std::runtime_error
 #include <string>       // for std::string
 #include <type_traits>  // for std::underlying_type_t
@@ -137,6 +137,116 @@ void FpsCounter::draw() const
     ImGui::End();
 }
 
+FrameTimeHistogram::FrameTimeHistogram(sf::RenderTarget &window,
+                                       const Corner corner)
+    : window_(window),
+      pivot_(compute_pivot(corner)),
+      offset_(compute_offset(this->pivot_))
+{
+    SPDLOG_DEBUG("Frame time histogram created at corner '{}', set pivot point to ('{}', '{}') and padding offset to ('{}', '{}') px successfully, exiting constructor!",
+                 static_cast<std::underlying_type_t<Corner>>(corner),
+                 this->pivot_.x,
+                 this->pivot_.y,
+                 this->offset_.x,
+                 this->offset_.y);
+}
+
+void FrameTimeHistogram::update_and_draw(const float dt)
+{
+    // If disabled, do nothing
+    if (!this->enabled) {
+        return;
+    }
+
+    // The dt is already clamped to [0.001, 0.1] in the main loop, so we can safely use it here
+
+    this->update(dt);
+    this->draw();
+}
+
+void FrameTimeHistogram::update(const float dt)
+{
+    const float frame_time_ms = dt * 1000.0f;
+
+    // Once the ring is full, the incoming sample evicts the oldest one; keep the bins in sync by moving that one count instead of rebuilding the whole histogram
+    if (this->sample_count_ == sample_capacity_) {
+        this->bin_counts_[bin_of(this->samples_[this->next_index_])] -= 1.0f;
+    }
+    else {
+        ++this->sample_count_;
+    }
+    this->samples_[this->next_index_] = frame_time_ms;
+    this->bin_counts_[bin_of(frame_time_ms)] += 1.0f;
+    this->next_index_ = (this->next_index_ + 1) % sample_capacity_;
+
+    // If the accumulated time exceeds the update rate, recompute the percentile figures
+    this->accumulation_ += dt;
+    if (this->accumulation_ >= this->update_rate_) {
+        this->recompute_percentiles();
+        this->accumulation_ -= this->update_rate_;  // Keep any overshoot
+    }
+}
+
+void FrameTimeHistogram::recompute_percentiles()
+{
+    if (this->sample_count_ == 0) {
+        return;
+    }
+
+    // Copy into the member scratch buffer; "std::nth_element" reorders its input and the ring must stay chronological
+    std::copy_n(this->samples_.cbegin(), this->sample_count_, this->scratch_.begin());
+    const auto begin = this->scratch_.begin();
+    const auto end = begin + static_cast<std::ptrdiff_t>(this->sample_count_);
+
+    // 95th percentile, then the 99th within the upper partition left behind by the first pass
+    const auto p95_it = begin + static_cast<std::ptrdiff_t>((this->sample_count_ * 95) / 100);
+    std::nth_element(begin, p95_it, end);
+    this->p95_ms_ = *p95_it;
+    const auto p99_it = begin + static_cast<std::ptrdiff_t>((this->sample_count_ * 99) / 100);
+    std::nth_element(p95_it, p99_it, end);
+    this->p99_ms_ = *p99_it;
+
+    // 1% low: average of the worst 1% of frame times (at least one), expressed as FPS
+    const std::size_t worst_count = std::max<std::size_t>(1, this->sample_count_ / 100);
+    const auto worst_begin = end - static_cast<std::ptrdiff_t>(worst_count);
+    std::nth_element(p99_it, worst_begin, end);
+    float worst_sum_ms = 0.0f;
+    for (auto it = worst_begin; it != end; ++it) {
+        worst_sum_ms += *it;
+    }
+    this->one_percent_low_fps_ = 1000.0f * static_cast<float>(worst_count) / worst_sum_ms;
+}
+
+void FrameTimeHistogram::draw() const
+{
+    // Get the current window size
+    const auto [width, height] = this->window_.getSize();
+
+    // Use pivot_.x and pivot_.y to decide how much of the window size to add
+    ImGui::SetNextWindowPos({this->pivot_.x * static_cast<float>(width) + this->offset_.x,
+                             this->pivot_.y * static_cast<float>(height) + this->offset_.y},
+                            ImGuiCond_Always,
+                            this->pivot_);  // Corner of the window
+    ImGui::Begin("Frame Times",
+                 nullptr,
+                 base_overlay_flags |
+                     ImGuiWindowFlags_AlwaysAutoResize  // Always resize the window to fit its contents
+    );
+
+    const std::string overlay = std::format("0-{} ms", static_cast<int>(static_cast<float>(bin_count_) * bin_width_ms_));
+    ImGui::PlotHistogram("##frame_time_bins",
+                         this->bin_counts_.data(),
+                         static_cast<int>(bin_count_),
+                         0,                       // No offset; bins are positional, not chronological
+                         overlay.c_str(),         // Overlay text showing the covered range
+                         0.0f,                    // Scale minimum
+                         FLT_MAX,                 // Auto-scale the maximum to the tallest bin
+                         ImVec2{240.0f, 60.0f});  // Plot size in px
+    ImGui::Text("p95: %.1f ms / p99: %.1f ms", static_cast<double>(this->p95_ms_), static_cast<double>(this->p99_ms_));
+    ImGui::Text("1%% low: %.0f FPS", static_cast<double>(this->one_percent_low_fps_));
+    ImGui::End();
+}
+
 Speedometer::Speedometer(sf::RenderTarget &window,
                          const Corner corner)
     : window_(window),
@@ -185,19 +295,23 @@ void Speedometer::update_and_draw(const float speed) const
 
 Minimap::Minimap(sf::RenderTarget &window,
                  const sf::Color &background_color,
-                 GameEntitiesDrawer game_entities_drawer,
+                 GameEntitiesDrawer track_drawer,
+                 GameEntitiesDrawer marker_drawer,
                  const Corner corner)
     : resolution_(default_resolution_),
       window_(window),
       background_color_(background_color),
-      game_entities_drawer_(std::move(game_entities_drawer)),
+      track_drawer_(std::move(track_drawer)),
+      marker_drawer_(std::move(marker_drawer)),
       pivot_(compute_pivot(corner)),
       offset_(compute_offset(this->pivot_)),
-      render_texture_(this->resolution_)
+      render_texture_(this->resolution_),
+      track_cache_texture_(track_cache_resolution_)
 {
     // Prepare view and texture
-    this->view_.setSize(this->capture_size_);  // Set how much of the world to capture (zoom factor, basicallly)
-    this->render_texture_.setSmooth(true);     // Enable bilinear filtering for the texture
+    this->view_.setSize(this->capture_size_);    // Set how much of the world to capture (zoom factor, basicallly)
+    this->render_texture_.setSmooth(true);       // Enable bilinear filtering for the texture
+    this->track_cache_texture_.setSmooth(true);  // The cache is sampled at arbitrary scales, so filter it too
 
     SPDLOG_DEBUG("Minimap created at corner '{}', set pivot point to ('{}', '{}') and padding offset to ('{}', '{}') px successfully, exiting constructor!",
                  static_cast<std::underlying_type_t<Corner>>(corner),
@@ -221,6 +335,27 @@ void Minimap::update_and_draw(const float dt,
     this->draw();
 }
 
+void Minimap::invalidate_track_cache(const sf::FloatRect &track_bounds)
+{
+    this->track_bounds_ = track_bounds;
+    this->track_cache_dirty_ = true;
+    SPDLOG_DEBUG("Minimap track cache invalidated for bounds ('{}', '{}') px!", track_bounds.size.x, track_bounds.size.y);
+}
+
+void Minimap::bake_track_cache()
+{
+    // Render every track tile once into the cache; refreshes afterwards blit the result as a single quad
+    sf::View bake_view;
+    bake_view.setCenter(this->track_bounds_.getCenter());
+    bake_view.setSize(this->track_bounds_.size);
+    this->track_cache_texture_.setView(bake_view);
+    this->track_cache_texture_.clear(sf::Color::Transparent);
+    this->track_drawer_(this->track_cache_texture_);
+    this->track_cache_texture_.display();
+    this->track_cache_dirty_ = false;
+    this->track_cache_valid_ = true;
+}
+
 void Minimap::update(const float dt,
                      const sf::Vector2f &center)
 {
@@ -229,13 +364,25 @@ void Minimap::update(const float dt,
 
     // If the accumulated time exceeds the update rate, refresh the minimap texture
     if (this->accumulation_ >= this->refresh_interval) {
+        // Re-bake the track cache if a new layout was announced since the last refresh
+        if (this->track_cache_dirty_ && this->track_bounds_.size.x > 0.f && this->track_bounds_.size.y > 0.f) {
+            this->bake_track_cache();
+        }
+
         // Set the view to the center of the minimap
         this->view_.setCenter(center);
         this->render_texture_.setView(this->view_);
-
-        // Draw the game entities onto the render texture
         this->render_texture_.clear(this->background_color_);
-        this->game_entities_drawer_(this->render_texture_);
+
+        // Blit the cached track as one world-space quad; the moving markers are the only per-refresh geometry
+        if (this->track_cache_valid_) {
+            sf::Sprite track_sprite{this->track_cache_texture_.getTexture()};
+            track_sprite.setPosition(this->track_bounds_.position);
+            track_sprite.setScale({this->track_bounds_.size.x / static_cast<float>(track_cache_resolution_.x),
+                                   this->track_bounds_.size.y / static_cast<float>(track_cache_resolution_.y)});
+            this->render_texture_.draw(track_sprite);
+        }
+        this->marker_drawer_(this->render_texture_);
         this->render_texture_.display();
 
         this->accumulation_ -= this->refresh_interval;  // Keep any overshoot
@@ -296,7 +443,7 @@ Leaderboard::Leaderboard(sf::RenderTarget &window,
 }
 
 void Leaderboard::update_and_draw(const float dt,
-                                  const std::function<std::vector<LeaderboardEntry>()> &data_collector)
+                                  const std::function<arena::FrameVector<LeaderboardEntry>()> &data_collector)
 {
     // If disabled, do nothing
     if (!this->enabled) {
@@ -308,21 +455,17 @@ void Leaderboard::update_and_draw(const float dt,
 }
 
 void Leaderboard::update(const float dt,
-                         const std::function<std::vector<LeaderboardEntry>()> &data_collector)
+                         const std::function<arena::FrameVector<LeaderboardEntry>()> &data_collector)
 {
     // Accumulate the delta time
     this->accumulation_ += dt;
 
     // If the accumulated time exceeds the update rate, refresh the leaderboard data
     if (this->accumulation_ >= this->update_rate_) {
-        // Collect fresh data only when throttle interval is reached
-        this->cached_entries_ = data_collector();
-
-        // Sort the cached entries for display (highest score first)
-        std::ranges::sort(this->cached_entries_,
-                          [](const LeaderboardEntry &a, const LeaderboardEntry &b) {
-                              return a.drift_score > b.drift_score;  // Descending order
-                          });
+        // Collect fresh data only when throttle interval is reached; the collected vector lives in the frame arena, so copy it into the persistent cache, whose capacity is reused across refreshes
+        // Entries arrive already in race order (the physics system maintains the standings incrementally), so no per-refresh sort happens here
+        const arena::FrameVector<LeaderboardEntry> collected = data_collector();
+        this->cached_entries_.assign(collected.begin(), collected.end());
 
         this->accumulation_ -= this->update_rate_;  // Keep any overshoot
     }
@@ -340,18 +483,19 @@ void Leaderboard::draw() const
                             this->pivot_);  // Corner of the window
     ImGui::SetNextWindowSize(this->window_size_, ImGuiCond_Always);
 
-    ImGui::Begin("Drift Scores",
+    ImGui::Begin("Race Standings",
                  nullptr,
                  base_overlay_flags |
                      ImGuiWindowFlags_NoResize  // Prevent manual resizing
     );
 
     // Display header
-    ImGui::Text("Drift Scores");
+    ImGui::Text("Race Standings");
     ImGui::Separator();
 
-    // Display cached entries with position numbers
-    for (std::size_t i = 0; i < this->cached_entries_.size(); ++i) {
+    // Display cached entries with position numbers, capped so stress-test grids do not overflow the window
+    const std::size_t visible_count = std::min(this->cached_entries_.size(), this->max_visible_entries_);
+    for (std::size_t i = 0; i < visible_count; ++i) {
         const auto &entry = this->cached_entries_[i];
 
         // Set yellow color for player entries
@@ -359,10 +503,11 @@ void Leaderboard::draw() const
             ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(255, 255, 0, 255));  // Yellow
         }
 
-        // Format score as integer (no decimals)
-        // const int display_score = static_cast<int>(entry.drift_score);
-        const std::string display_score = std::format("{:.0f} pts", entry.drift_score);
-        ImGui::Text("%zu. %s: %s", i + 1, entry.car_name.c_str(), display_score.c_str());
+        // Lap, best lap time (dashes until a lap is completed), and drift score in one compact row
+        const std::string race_info = entry.best_lap_time > 0.0f
+                                          ? std::format("L{} {:.1f}s {:.0f} pts", entry.lap, entry.best_lap_time, entry.drift_score)
+                                          : std::format("L{} --.-s {:.0f} pts", entry.lap, entry.drift_score);
+        ImGui::Text("%zu. %s: %s", i + 1, entry.car_name.c_str(), race_info.c_str());
 
         // Reset color for player entries
         if (entry.is_player) {
@@ -370,6 +515,11 @@ void Leaderboard::draw() const
         }
     }
 
+    // Summarize the cars that did not fit the window
+    if (this->cached_entries_.size() > visible_count) {
+        ImGui::Text("...and %zu more", this->cached_entries_.size() - visible_count);
+    }
+
     // If no entries, show placeholder
     if (this->cached_entries_.empty()) {
         ImGui::Text("No cars detected");
@@ -378,4 +528,257 @@ void Leaderboard::draw() const
     ImGui::End();
 }
 
+ProfilerOverlay::ProfilerOverlay(sf::RenderTarget &window,
+                                 const Corner corner)
+    : window_(window),
+      pivot_(compute_pivot(corner)),
+      offset_(compute_offset(this->pivot_))
+{
+    // Shift away from the horizontal edge, so the overlay does not cover the FPS counter when both sit in the same corner
+    this->offset_.y += (this->pivot_.y < 0.5f) ? this->fps_counter_clearance_ : -this->fps_counter_clearance_;
+
+    SPDLOG_DEBUG("ProfilerOverlay created at corner '{}', set pivot point to ('{}', '{}') and padding offset to ('{}', '{}') px successfully, exiting constructor!",
+                 static_cast<std::underlying_type_t<Corner>>(corner),
+                 this->pivot_.x,
+                 this->pivot_.y,
+                 this->offset_.x,
+                 this->offset_.y);
+}
+
+void ProfilerOverlay::update_and_draw(const float dt,
+                                      const std::function<arena::FrameVector<ProfilerEntry>()> &data_collector)
+{
+    // If disabled, do nothing
+    if (!this->enabled) {
+        return;
+    }
+
+    this->update(dt, data_collector);
+    this->draw();
+}
+
+void ProfilerOverlay::update(const float dt,
+                             const std::function<arena::FrameVector<ProfilerEntry>()> &data_collector)
+{
+    // Accumulate the delta time
+    this->accumulation_ += dt;
+
+    // If the accumulated time exceeds the update rate, refresh the timing data
+    if (this->accumulation_ >= this->update_rate_) {
+        // Collect fresh data only when throttle interval is reached; the collector already returns phases in execution order, so no sorting is needed
+        // The collected vector lives in the frame arena, so copy it into the persistent cache, whose capacity is reused across refreshes
+        const arena::FrameVector<ProfilerEntry> collected = data_collector();
+        this->cached_entries_.assign(collected.begin(), collected.end());
+
+        this->accumulation_ -= this->update_rate_;  // Keep any overshoot
+    }
+}
+
+void ProfilerOverlay::draw() const
+{
+    // Get the current window size
+    const auto [width, height] = this->window_.getSize();
+
+    // Use pivot_.x and pivot_.y to decide how much of the window size to add
+    ImGui::SetNextWindowPos({this->pivot_.x * static_cast<float>(width) + this->offset_.x,
+                             this->pivot_.y * static_cast<float>(height) + this->offset_.y},
+                            ImGuiCond_Always,
+                            this->pivot_);  // Corner of the window
+    ImGui::SetNextWindowSize(this->window_size_, ImGuiCond_Always);
+
+    ImGui::Begin("Profiler",
+                 nullptr,
+                 base_overlay_flags |
+                     ImGuiWindowFlags_NoResize  // Prevent manual resizing
+    );
+
+    // Display header
+    ImGui::Text("Frame Profiler");
+    ImGui::Separator();
+
+    // Display cached phase timings in execution order
+    for (const auto &entry : this->cached_entries_) {
+        ImGui::Text("%s: %.2f ms (avg %.2f ms)", entry.phase_name.c_str(), static_cast<double>(entry.current_ms), static_cast<double>(entry.average_ms));
+    }
+
+    // If no entries, show placeholder
+    if (this->cached_entries_.empty()) {
+        ImGui::Text("No samples yet");
+    }
+
+    ImGui::End();
+}
+
+MemoryOverlay::MemoryOverlay(sf::RenderTarget &window,
+                             const Corner corner)
+    : window_(window),
+      pivot_(compute_pivot(corner)),
+      offset_(compute_offset(this->pivot_))
+{
+    // Shift away from the horizontal edge, so the overlay does not cover the FPS counter and profiler overlay when they share the corner
+    this->offset_.y += (this->pivot_.y < 0.5f) ? this->overlay_clearance_ : -this->overlay_clearance_;
+
+    SPDLOG_DEBUG("MemoryOverlay created at corner '{}', set pivot point to ('{}', '{}') and padding offset to ('{}', '{}') px successfully, exiting constructor!",
+                 static_cast<std::underlying_type_t<Corner>>(corner),
+                 this->pivot_.x,
+                 this->pivot_.y,
+                 this->offset_.x,
+                 this->offset_.y);
+}
+
+void MemoryOverlay::update_and_draw(const float dt)
+{
+    // If disabled, do nothing
+    if (!this->enabled) {
+        return;
+    }
+
+    this->update(dt);
+    this->draw();
+}
+
+void MemoryOverlay::update(const float dt)
+{
+    // Accumulate the delta time
+    this->accumulation_ += dt;
+
+    // If the accumulated time exceeds the update rate, re-read the counters; they are plain atomics, so this is a handful of relaxed loads
+    if (this->accumulation_ >= this->update_rate_) {
+        this->cached_stats_ = memory::get_stats();
+
+        this->accumulation_ -= this->update_rate_;  // Keep any overshoot
+    }
+}
+
+void MemoryOverlay::draw() const
+{
+    // Get the current window size
+    const auto [width, height] = this->window_.getSize();
+
+    // Use pivot_.x and pivot_.y to decide how much of the window size to add
+    ImGui::SetNextWindowPos({this->pivot_.x * static_cast<float>(width) + this->offset_.x,
+                             this->pivot_.y * static_cast<float>(height) + this->offset_.y},
+                            ImGuiCond_Always,
+                            this->pivot_);  // Corner of the window
+    ImGui::SetNextWindowSize(this->window_size_, ImGuiCond_Always);
+
+    ImGui::Begin("Memory",
+                 nullptr,
+                 base_overlay_flags |
+                     ImGuiWindowFlags_NoResize  // Prevent manual resizing
+    );
+
+    // Display header
+    ImGui::Text("Memory Budgets");
+    ImGui::Separator();
+
+    if constexpr (!memory::tracking_enabled) {
+        ImGui::TextWrapped("Tracking is compiled out; rebuild with ENABLE_MEMORY_TRACKING");
+    }
+    else {
+        // One line per subsystem: live / budget, peak, and allocations during the last frame; over-budget subsystems are painted red
+        constexpr float bytes_per_mib = 1024.0f * 1024.0f;
+        for (const memory::TagStats &stats : this->cached_stats_) {
+            const bool over_budget = stats.live_bytes > stats.budget_bytes;
+            if (over_budget) {
+                ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(255, 80, 80, 255));
+            }
+            ImGui::Text("%s: %.2f / %.0f MiB (peak %.2f, %zu allocs/frame)",
+                        stats.name,
+                        static_cast<double>(static_cast<float>(stats.live_bytes) / bytes_per_mib),
+                        static_cast<double>(static_cast<float>(stats.budget_bytes) / bytes_per_mib),
+                        static_cast<double>(static_cast<float>(stats.peak_bytes) / bytes_per_mib),
+                        stats.allocations_last_frame);
+            if (over_budget) {
+                ImGui::PopStyleColor();
+            }
+        }
+    }
+
+    ImGui::End();
+}
+
+LatencyOverlay::LatencyOverlay(sf::RenderTarget &window,
+                               const Corner corner)
+    : window_(window),
+      pivot_(compute_pivot(corner)),
+      offset_(compute_offset(this->pivot_))
+{
+    // Shift away from the horizontal edge, so the overlay does not cover the other debug overlays when they share the corner
+    this->offset_.y += (this->pivot_.y < 0.5f) ? this->overlay_clearance_ : -this->overlay_clearance_;
+
+    SPDLOG_DEBUG("LatencyOverlay created at corner '{}', set pivot point to ('{}', '{}') and padding offset to ('{}', '{}') px successfully, exiting constructor!",
+                 static_cast<std::underlying_type_t<Corner>>(corner),
+                 this->pivot_.x,
+                 this->pivot_.y,
+                 this->offset_.x,
+                 this->offset_.y);
+}
+
+void LatencyOverlay::record(const float latency_seconds)
+{
+    // A handful of float operations; cheap enough to run even while the overlay is hidden, so enabling it shows figures immediately
+    this->sample_sum_seconds_ += latency_seconds;
+    this->sample_max_seconds_ = std::max(this->sample_max_seconds_, latency_seconds);
+    ++this->sample_count_;
+}
+
+void LatencyOverlay::update_and_draw(const float dt)
+{
+    // If disabled, do nothing
+    if (!this->enabled) {
+        return;
+    }
+
+    this->update(dt);
+    this->draw();
+}
+
+void LatencyOverlay::update(const float dt)
+{
+    this->accumulation_ += dt;
+    if (this->accumulation_ < this->update_rate_ || this->sample_count_ == 0) {
+        return;
+    }
+
+    this->displayed_average_ms_ = this->sample_sum_seconds_ / static_cast<float>(this->sample_count_) * 1000.0f;
+    this->displayed_max_ms_ = this->sample_max_seconds_ * 1000.0f;
+    this->has_figures_ = true;
+
+    this->accumulation_ = 0.0f;
+    this->sample_sum_seconds_ = 0.0f;
+    this->sample_max_seconds_ = 0.0f;
+    this->sample_count_ = 0;
+}
+
+void LatencyOverlay::draw() const
+{
+    // Get the current window size
+    const auto [width, height] = this->window_.getSize();
+
+    // Use pivot_.x and pivot_.y to decide how much of the window size to add
+    ImGui::SetNextWindowPos({this->pivot_.x * static_cast<float>(width) + this->offset_.x,
+                             this->pivot_.y * static_cast<float>(height) + this->offset_.y},
+                            ImGuiCond_Always,
+                            this->pivot_);  // Corner of the window
+    ImGui::SetNextWindowSize(this->window_size_, ImGuiCond_Always);
+
+    ImGui::Begin("Latency",
+                 nullptr,
+                 base_overlay_flags |
+                     ImGuiWindowFlags_NoResize);
+
+    ImGui::TextUnformatted("Input to Present");
+    if (this->has_figures_) {
+        ImGui::Text("avg %.1f ms / max %.1f ms", static_cast<double>(this->displayed_average_ms_), static_cast<double>(this->displayed_max_ms_));
+    }
+    else {
+        ImGui::TextUnformatted("Waiting for input...");
+    }
+    // The display's own queue is invisible from here, so the true wheel-to-photon figure is higher by the display buffering
+    ImGui::TextDisabled("excludes display queue");
+
+    ImGui::End();
+}
+
 }  // namespace core::widgets
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <array>       // for std::array
+#include <cstddef>     // for std::size_t
 #include <cstdint>     // for std::uint32_t
 #include <functional>  // for std::function
 #include <string>      // for std::string
@@ -13,6 +15,9 @@
 
 #include <SFML/Graphics.hpp>
 
+#include "arena.hpp"   // Frame-scoped storage for the transient vectors handed over by data collectors
+#include "memory.hpp"  // Per-subsystem allocation counters read by the memory overlay
+
 namespace core::widgets {
 
 /**
@@ -160,6 +165,174 @@ class FpsCounter final : public IWidget {
     std::uint32_t fps_ = 144;
 };
 
+/**
+ * @brief Class that displays a frame-time histogram with percentile statistics in an ImGui overlay.
+ *
+ * An averaged FPS number hides stutter; this widget keeps a fixed ring of recent frame times and shows their distribution plus the 95th/99th percentile and the 1%-low figure, which is what players actually feel. The histogram bins are maintained incrementally as samples enter and leave the ring, and the percentiles are recomputed at a throttled rate from a fixed scratch buffer, so the widget never allocates after construction.
+ */
+class FrameTimeHistogram final : public IWidget {
+  public:
+    /**
+     * @brief Construct a new FrameTimeHistogram object.
+     *
+     * This calculates the pivot point and padding offset based on the provided corner, but does not record anything until "update_and_draw()" is called.
+     *
+     * @param window Target window where the histogram will be drawn.
+     * @param corner Corner of the window where the histogram will be displayed (default: "BottomLeft").
+     */
+    explicit FrameTimeHistogram(sf::RenderTarget &window,
+                                const Corner corner = Corner::BottomLeft);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~FrameTimeHistogram() = default;
+
+    // Disable copy semantics - holds reference to external resource
+    FrameTimeHistogram(const FrameTimeHistogram &) = delete;
+    FrameTimeHistogram &operator=(const FrameTimeHistogram &) = delete;
+
+    // Allow move construction but disable move assignment (due to reference members)
+    FrameTimeHistogram(FrameTimeHistogram &&) = default;
+    FrameTimeHistogram &operator=(FrameTimeHistogram &&) = delete;
+
+    /**
+     * @brief Record the frame time and draw the histogram on the provided target as long as "enabled" is true. If "enabled" is false, do nothing.
+     *
+     * The sample ring and histogram bins are updated every frame; the percentile figures are recomputed at a throttled rate.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     *
+     * @note Call this once per frame, before ImGui is rendered to the screen (i.e., before "render()").
+     */
+    void update_and_draw(const float dt);
+
+  private:
+    /**
+     * @brief Record one frame time into the ring and bins, recomputing the percentiles when the throttle interval elapses.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this method once each frame. The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void update(const float dt);
+
+    /**
+     * @brief Draw the histogram and percentile figures in the corner provided during construction.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this after "update()" and before ImGui is rendered to the screen (i.e., before "render()"). The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void draw() const;
+
+    /**
+     * @brief Recompute the 95th/99th percentile and 1%-low figures from the ring samples.
+     *
+     * This partially sorts a fixed scratch copy of the samples with "std::nth_element", so the cost is linear in the sample count and no allocation happens.
+     */
+    void recompute_percentiles();
+
+    /**
+     * @brief Map a frame time to its histogram bin index.
+     *
+     * @param frame_time_ms Frame time in milliseconds.
+     *
+     * @return Bin index; times beyond the covered range land in the last bin.
+     */
+    [[nodiscard]] static constexpr std::size_t bin_of(const float frame_time_ms)
+    {
+        const std::size_t index = static_cast<std::size_t>(frame_time_ms / bin_width_ms_);
+        return index < bin_count_ ? index : bin_count_ - 1;
+    }
+
+    /**
+     * @brief Number of frame-time samples kept in the ring.
+     *
+     * 512 samples cover several seconds at typical frame rates, enough for the 1%-low figure to mean something (five worst frames) without smearing stutter over a long history.
+     */
+    static constexpr std::size_t sample_capacity_ = 512;
+
+    /**
+     * @brief Number of histogram bins.
+     */
+    static constexpr std::size_t bin_count_ = 40;
+
+    /**
+     * @brief Width of one histogram bin, in milliseconds; 40 bins of 1 ms cover everything up to 25 FPS, with slower frames collapsing into the last bin.
+     */
+    static constexpr float bin_width_ms_ = 1.0f;
+
+    /**
+     * @brief How often to recompute the percentile figures, in seconds.
+     *
+     * @note The ring and bins are updated every frame regardless; only the "std::nth_element" passes are throttled.
+     */
+    static constexpr float update_rate_ = 0.5f;
+
+    /**
+     * @brief Target window where the histogram will be drawn.
+     */
+    const sf::RenderTarget &window_;
+
+    /**
+     * @brief Pivot point for the histogram window.
+     *
+     * @note This is basically the corner of the window where the histogram will be displayed. The "x" and "y" values are in the range "[0, 1]", where "(0, 0)" is the top-left corner and "(1, 1)" is the bottom-right corner.
+     */
+    ImVec2 pivot_;
+
+    /**
+     * @brief Padding offset based on the pivot point.
+     */
+    ImVec2 offset_;
+
+    /**
+     * @brief Ring of recent frame times in milliseconds; "next_index_" marks the slot overwritten next.
+     */
+    std::array<float, sample_capacity_> samples_{};
+
+    /**
+     * @brief Scratch buffer for the percentile computation; a member, so the partial sorts never allocate.
+     */
+    std::array<float, sample_capacity_> scratch_{};
+
+    /**
+     * @brief Histogram bin counts, maintained incrementally as samples enter and leave the ring.
+     *
+     * @note Stored as floats because that is what "ImGui::PlotHistogram" consumes directly.
+     */
+    std::array<float, bin_count_> bin_counts_{};
+
+    /**
+     * @brief Ring slot that the next sample overwrites.
+     */
+    std::size_t next_index_ = 0;
+
+    /**
+     * @brief Number of valid samples in the ring; grows to "sample_capacity_" and stays there.
+     */
+    std::size_t sample_count_ = 0;
+
+    /**
+     * @brief Accumulated time since the last percentile recomputation.
+     */
+    float accumulation_ = 0.0f;
+
+    /**
+     * @brief Most recently computed 95th percentile frame time, in milliseconds.
+     */
+    float p95_ms_ = 0.0f;
+
+    /**
+     * @brief Most recently computed 99th percentile frame time, in milliseconds.
+     */
+    float p99_ms_ = 0.0f;
+
+    /**
+     * @brief Most recently computed 1%-low figure: the FPS equivalent of the average of the worst 1% of frame times.
+     */
+    float one_percent_low_fps_ = 0.0f;
+};
+
 /**
  * @brief Class that displays the current car speed in an ImGui overlay.
  *
@@ -209,7 +382,7 @@ class Speedometer final : public IWidget {
     /**
      * @brief Pixel-to-kilometer per hour conversion factor.
      *
-     * @note The original factor was roughly modeled after the Nissan Silvia S14 real-world dimensions ({4.5f, 1.7f}) vs. in-game player car sprite (car_black_1), resulting in "0.1008f". However, that was deemed too high, so it was adjusted to "0.07f" for better scaling.
+     * @note The original factor was roughly modeled after the Nissan Silvia S14 real-world dimensions ({4.5f, 1.7f}) vs. in-game player car sprite (car_base_1), resulting in "0.1008f". However, that was deemed too high, so it was adjusted to "0.07f" for better scaling.
      */
     static constexpr float px_to_kph_factor_ = 0.07f;
 
@@ -240,6 +413,8 @@ class Speedometer final : public IWidget {
  * @brief Class that displays the minimap in an ImGui overlay.
  *
  * The minimap renders the supplied scene into an internal texture at a configurable refresh rate and draws that texture inside an ImGui window.
+ *
+ * The static track view is baked into a separate cache texture only when "invalidate_track_cache()" reports a layout change, so each refresh pays for one textured quad plus the moving position markers instead of re-rendering every track tile.
  */
 class Minimap final : public IWidget {
   public:
@@ -255,7 +430,8 @@ class Minimap final : public IWidget {
      *
      * @param window Target window where the minimap will be drawn.
      * @param background_color Background color of the minimap.
-     * @param game_entities_drawer Function that draws the game entities (e.g., sprites) onto an `sf::RenderTarget`.
+     * @param track_drawer Function that draws the static track onto an `sf::RenderTarget`; only called when the track cache is rebuilt after "invalidate_track_cache()".
+     * @param marker_drawer Function that draws the moving position markers (e.g., car blips) onto an `sf::RenderTarget`; called on every refresh.
      * @param corner Corner of the window where the minimap will be displayed (default: "BottomLeft").
      */
     explicit Minimap(sf::RenderTarget &window,
@@ -263,7 +439,8 @@ class Minimap final : public IWidget {
                      // TODO: Check if the below is true; I'd prefer to use "const" wherever possible.
                      // Cannot use "const" here, because that would copy the callable once when passed in, and again when assigning to the data member. Plus, the const blocks you from moving it.
                      // You can either pass by value and "std::move" it into the member, or use "GameEntitiesDrawer&&"" and std::forward.
-                     GameEntitiesDrawer game_entities_drawer,
+                     GameEntitiesDrawer track_drawer,
+                     GameEntitiesDrawer marker_drawer,
                      const Corner corner = Corner::BottomLeft);
 
     /**
@@ -311,7 +488,25 @@ class Minimap final : public IWidget {
      */
     [[nodiscard]] sf::Vector2u get_resolution() const;
 
+    /**
+     * @brief Mark the cached track view as stale and record the new track bounds.
+     *
+     * The cache is re-baked lazily on the next refresh, so calling this is cheap even when the minimap is disabled.
+     *
+     * @param track_bounds World-space rectangle enclosing the track, typically "Track::get_world_bounds()".
+     *
+     * @note Call this once after construction and again whenever a new track layout is swapped in.
+     */
+    void invalidate_track_cache(const sf::FloatRect &track_bounds);
+
   private:
+    /**
+     * @brief Render the full track once into the cache texture.
+     *
+     * @note This is called by "update()" when the cache is stale; afterwards every refresh blits the cache as a single quad.
+     */
+    void bake_track_cache();
+
     /**
      * @brief Update the minimap texture.
      *
@@ -365,13 +560,18 @@ class Minimap final : public IWidget {
     const sf::Color &background_color_;
 
     /**
-     * @brief Function that draws the game entities (e.g., sprites) onto an `sf::RenderTarget`.
+     * @brief Function that draws the static track onto an `sf::RenderTarget`, used only when baking the cache.
      *
      * @note This uses type erasure to allow any callable type, such as lambdas or function pointers.
      *
      * @details This cannot be "const", because while it would prevent reassignment (good), it also makes construction harder because you can't move into it without casting away "const". So while the member doesn't need to be mutated, this isn't the right tool for enforcing that.
      */
-    GameEntitiesDrawer game_entities_drawer_;
+    GameEntitiesDrawer track_drawer_;
+
+    /**
+     * @brief Function that draws the moving position markers onto an `sf::RenderTarget`, called on every refresh.
+     */
+    GameEntitiesDrawer marker_drawer_;
 
     /**
      * @brief Pivot point for the speedometer window.
@@ -395,6 +595,33 @@ class Minimap final : public IWidget {
      */
     sf::View view_;
 
+    /**
+     * @brief Fixed resolution of the track cache texture, in pixels.
+     *
+     * Independent of the refresh resolution: the cache covers the whole track once, so it can afford to be larger than the per-refresh texture.
+     */
+    static constexpr sf::Vector2u track_cache_resolution_ = {1024u, 1024u};
+
+    /**
+     * @brief Cache texture holding the full track, re-baked only when the layout changes.
+     */
+    sf::RenderTexture track_cache_texture_;
+
+    /**
+     * @brief World-space rectangle the track cache covers, recorded by "invalidate_track_cache()".
+     */
+    sf::FloatRect track_bounds_;
+
+    /**
+     * @brief Whether the track cache must be re-baked before the next refresh.
+     */
+    bool track_cache_dirty_ = false;
+
+    /**
+     * @brief Whether the track cache holds a valid bake; false until the first "invalidate_track_cache()" plus refresh.
+     */
+    bool track_cache_valid_ = false;
+
     /**
      * @brief Accumulated time since the last texture refresh.
      */
@@ -402,7 +629,9 @@ class Minimap final : public IWidget {
 };
 
 /**
- * @brief Struct that represents a car's name and drift score for leaderboard display.
+ * @brief Struct that represents one car's race state for leaderboard display.
+ *
+ * Entries are expected to arrive already in race order (leader first), as maintained incrementally by the physics system's standings; the widget does not sort.
  */
 struct LeaderboardEntry final {
     /**
@@ -410,6 +639,16 @@ struct LeaderboardEntry final {
      */
     std::string car_name;
 
+    /**
+     * @brief Lap the car is currently on, 1-based.
+     */
+    std::uint32_t lap;
+
+    /**
+     * @brief Fastest completed lap time in seconds; "0.0" until the first lap is finished.
+     */
+    float best_lap_time;
+
     /**
      * @brief Drift score for the car.
      */
@@ -422,9 +661,9 @@ struct LeaderboardEntry final {
 };
 
 /**
- * @brief Class that displays the drift leaderboard in an ImGui overlay.
+ * @brief Class that displays the race standings in an ImGui overlay.
  *
- * Shows the current drift scores for all cars, sorted from highest to lowest score.
+ * Shows position, current lap, best lap time, and drift score for all cars, in the race order provided by the data collector.
  */
 class Leaderboard final : public IWidget {
   public:
@@ -458,12 +697,12 @@ class Leaderboard final : public IWidget {
      * The leaderboard data is refreshed at a throttled rate to improve performance, but the graphics are updated every frame.
      *
      * @param dt Time passed since the previous frame, in seconds.
-     * @param data_collector Function that collects the current leaderboard data when called.
+     * @param data_collector Function that collects the current leaderboard data when called; the returned vector lives in the frame arena and is only read within this call.
      *
      * @note Call this once per frame, before ImGui is rendered to the screen (i.e., before "render()").
      */
     void update_and_draw(const float dt,
-                         const std::function<std::vector<LeaderboardEntry>()> &data_collector);
+                         const std::function<arena::FrameVector<LeaderboardEntry>()> &data_collector);
 
   private:
     /**
@@ -475,7 +714,7 @@ class Leaderboard final : public IWidget {
      * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this method once each frame. The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
      */
     void update(const float dt,
-                const std::function<std::vector<LeaderboardEntry>()> &data_collector);
+                const std::function<arena::FrameVector<LeaderboardEntry>()> &data_collector);
 
     /**
      * @brief Draw the leaderboard in the corner provided during construction.
@@ -496,6 +735,13 @@ class Leaderboard final : public IWidget {
      */
     static constexpr ImVec2 window_size_ = {250.0f, 160.0f};
 
+    /**
+     * @brief Maximum number of entries displayed at once.
+     *
+     * @note With large stress-test AI grids the full list would not fit the window; the remaining cars are summarized in a footer line instead.
+     */
+    static constexpr std::size_t max_visible_entries_ = 8;
+
     /**
      * @brief Target window where the leaderboard will be drawn.
      */
@@ -521,7 +767,377 @@ class Leaderboard final : public IWidget {
     /**
      * @brief Cached leaderboard entries updated at throttled rate.
      */
-    std::vector<LeaderboardEntry> cached_entries_;
+    memory::TrackedVector<LeaderboardEntry, memory::Tag::Widgets> cached_entries_;
+};
+
+/**
+ * @brief Struct that represents one frame phase's timings for profiler overlay display.
+ */
+struct ProfilerEntry final {
+    /**
+     * @brief Phase name (e.g., "Input", "Car Updates").
+     */
+    std::string phase_name;
+
+    /**
+     * @brief Time spent in the phase during the last frame, in milliseconds.
+     */
+    float current_ms;
+
+    /**
+     * @brief Moving average of the per-frame time, in milliseconds.
+     */
+    float average_ms;
+};
+
+/**
+ * @brief Class that displays per-frame phase timings in an ImGui overlay.
+ *
+ * Shows the last-frame time and moving average for each instrumented frame phase, in the order the phases execute. Intended for debugging performance on machines where attaching an external profiler is not an option.
+ */
+class ProfilerOverlay final : public IWidget {
+  public:
+    /**
+     * @brief Construct a new ProfilerOverlay object.
+     *
+     * This calculates the pivot point and padding offset based on the provided corner, but does not perform any drawing until "update_and_draw()" is called.
+     *
+     * @param window Target window where the profiler overlay will be drawn.
+     * @param corner Corner of the window where the profiler overlay will be displayed (default: "TopLeft").
+     */
+    explicit ProfilerOverlay(sf::RenderTarget &window,
+                             const Corner corner = Corner::TopLeft);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~ProfilerOverlay() = default;
+
+    // Disable copy semantics - holds reference to external resource
+    ProfilerOverlay(const ProfilerOverlay &) = delete;
+    ProfilerOverlay &operator=(const ProfilerOverlay &) = delete;
+
+    // Allow move construction but disable move assignment (due to reference members)
+    ProfilerOverlay(ProfilerOverlay &&) = default;
+    ProfilerOverlay &operator=(ProfilerOverlay &&) = delete;
+
+    /**
+     * @brief Update the profiler overlay and draw it on the provided target as long as "enabled" is true. If "enabled" is false, do nothing.
+     *
+     * The timing data is refreshed at a throttled rate so the numbers stay readable, but the graphics are updated every frame.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     * @param data_collector Function that collects the current phase timings when called; the returned vector lives in the frame arena and is only read within this call.
+     *
+     * @note Call this once per frame, before ImGui is rendered to the screen (i.e., before "render()").
+     */
+    void update_and_draw(const float dt,
+                         const std::function<arena::FrameVector<ProfilerEntry>()> &data_collector);
+
+  private:
+    /**
+     * @brief Update the cached timing data with throttling.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     * @param data_collector Function that collects the current phase timings when called.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this method once each frame. The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void update(const float dt,
+                const std::function<arena::FrameVector<ProfilerEntry>()> &data_collector);
+
+    /**
+     * @brief Draw the profiler overlay in the corner provided during construction.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this after "update()" and before ImGui is rendered to the screen (i.e., before "render()"). The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void draw() const;
+
+    /**
+     * @brief How often to refresh the displayed timing data, in seconds.
+     *
+     * @note 10 Hz keeps the numbers readable; per-frame refresh makes them flicker too fast to read.
+     */
+    static constexpr float update_rate_ = 1.0f / 10.0f;
+
+    /**
+     * @brief Size of the profiler overlay window in pixels (width, height).
+     */
+    static constexpr ImVec2 window_size_ = {260.0f, 180.0f};
+
+    /**
+     * @brief Extra vertical offset in pixels, so the overlay does not cover the FPS counter, which defaults to the same corner.
+     */
+    static constexpr float fps_counter_clearance_ = 30.0f;
+
+    /**
+     * @brief Target window where the profiler overlay will be drawn.
+     */
+    const sf::RenderTarget &window_;
+
+    /**
+     * @brief Pivot point for the profiler overlay window.
+     *
+     * @note This is basically the corner of the window where the profiler overlay will be displayed. The "x" and "y" values are in the range "[0, 1]", where "(0, 0)" is the top-left corner and "(1, 1)" is the bottom-right corner.
+     */
+    ImVec2 pivot_;
+
+    /**
+     * @brief Padding offset based on the pivot point.
+     */
+    ImVec2 offset_;
+
+    /**
+     * @brief Accumulated time since the last timing data refresh.
+     */
+    float accumulation_ = 0.0f;
+
+    /**
+     * @brief Cached phase timings updated at throttled rate.
+     */
+    memory::TrackedVector<ProfilerEntry, memory::Tag::Widgets> cached_entries_;
+};
+
+/**
+ * @brief Class that displays per-subsystem memory usage and budgets in an ImGui overlay.
+ *
+ * Shows live bytes, the peak since launch, and allocations-per-frame for each subsystem tag, reading the counters maintained by "core::memory" directly (they are global, so no data collector is needed). A subsystem over its budget is drawn in red, which is how slow leaks like overnight tire-mark growth are meant to get noticed. In builds without the "ENABLE_MEMORY_TRACKING" CMake option the counters stay zero and the overlay says so.
+ */
+class MemoryOverlay final : public IWidget {
+  public:
+    /**
+     * @brief Construct a new MemoryOverlay object.
+     *
+     * This calculates the pivot point and padding offset based on the provided corner, but does not perform any drawing until "update_and_draw()" is called.
+     *
+     * @param window Target window where the memory overlay will be drawn.
+     * @param corner Corner of the window where the memory overlay will be displayed (default: "TopLeft").
+     */
+    explicit MemoryOverlay(sf::RenderTarget &window,
+                           const Corner corner = Corner::TopLeft);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~MemoryOverlay() = default;
+
+    // Disable copy semantics - holds reference to external resource
+    MemoryOverlay(const MemoryOverlay &) = delete;
+    MemoryOverlay &operator=(const MemoryOverlay &) = delete;
+
+    // Allow move construction but disable move assignment (due to reference members)
+    MemoryOverlay(MemoryOverlay &&) = default;
+    MemoryOverlay &operator=(MemoryOverlay &&) = delete;
+
+    /**
+     * @brief Update the memory overlay and draw it on the provided target as long as "enabled" is true. If "enabled" is false, do nothing.
+     *
+     * The counters are re-read at a throttled rate so the numbers stay readable, but the graphics are updated every frame.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     *
+     * @note Call this once per frame, before ImGui is rendered to the screen (i.e., before "render()").
+     */
+    void update_and_draw(const float dt);
+
+  private:
+    /**
+     * @brief Re-read the counters with throttling.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this method once each frame. The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void update(const float dt);
+
+    /**
+     * @brief Draw the memory overlay in the corner provided during construction.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this after "update()" and before ImGui is rendered to the screen (i.e., before "render()"). The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void draw() const;
+
+    /**
+     * @brief How often to re-read the counters, in seconds.
+     *
+     * @note 10 Hz keeps the numbers readable; per-frame refresh makes them flicker too fast to read.
+     */
+    static constexpr float update_rate_ = 1.0f / 10.0f;
+
+    /**
+     * @brief Size of the memory overlay window in pixels (width, height).
+     */
+    static constexpr ImVec2 window_size_ = {300.0f, 160.0f};
+
+    /**
+     * @brief Extra vertical offset in pixels, so the overlay does not cover the FPS counter and profiler overlay, which default to the same corner.
+     */
+    static constexpr float overlay_clearance_ = 220.0f;
+
+    /**
+     * @brief Target window where the memory overlay will be drawn.
+     */
+    const sf::RenderTarget &window_;
+
+    /**
+     * @brief Pivot point for the memory overlay window.
+     *
+     * @note This is basically the corner of the window where the memory overlay will be displayed. The "x" and "y" values are in the range "[0, 1]", where "(0, 0)" is the top-left corner and "(1, 1)" is the bottom-right corner.
+     */
+    ImVec2 pivot_;
+
+    /**
+     * @brief Padding offset based on the pivot point.
+     */
+    ImVec2 offset_;
+
+    /**
+     * @brief Accumulated time since the last counter refresh.
+     */
+    float accumulation_ = 0.0f;
+
+    /**
+     * @brief Cached counter snapshot updated at throttled rate.
+     */
+    std::array<memory::TagStats, memory::tag_count> cached_stats_{};
+};
+
+/**
+ * @brief Class that displays the input-event-to-present latency as an ImGui overlay.
+ *
+ * The app records a sample on every presented frame that consumed an input event: the time from the event arriving to the frame being handed to the display. The overlay shows the average and worst sample at a throttled rate, so input pipeline changes (late sampling, pacing modes, vsync) can be judged by their measured latency instead of feel. The display queue below the swap call is invisible from here, so the real wheel-to-photon figure is this number plus the display's own buffering.
+ */
+class LatencyOverlay final : public IWidget {
+  public:
+    /**
+     * @brief Construct a new LatencyOverlay object.
+     *
+     * This calculates the pivot point and padding offset based on the provided corner, but does not perform any drawing until "update_and_draw()" is called.
+     *
+     * @param window Target window where the latency overlay will be drawn.
+     * @param corner Corner of the window where the latency overlay will be displayed (default: "TopLeft").
+     */
+    explicit LatencyOverlay(sf::RenderTarget &window,
+                            const Corner corner = Corner::TopLeft);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~LatencyOverlay() = default;
+
+    // Disable copy semantics - holds reference to external resource
+    LatencyOverlay(const LatencyOverlay &) = delete;
+    LatencyOverlay &operator=(const LatencyOverlay &) = delete;
+
+    // Allow move construction but disable move assignment (due to reference members)
+    LatencyOverlay(LatencyOverlay &&) = default;
+    LatencyOverlay &operator=(LatencyOverlay &&) = delete;
+
+    /**
+     * @brief Record one input-event-to-present sample.
+     *
+     * @param latency_seconds Time from the input event arriving to the frame being presented, in seconds.
+     *
+     * @note Call this right after the present call, on frames that consumed at least one input event; frames without input produce no sample.
+     */
+    void record(const float latency_seconds);
+
+    /**
+     * @brief Update the latency figures and draw the overlay on the provided target as long as "enabled" is true. If "enabled" is false, do nothing.
+     *
+     * The displayed figures are recomputed at a throttled rate from the samples recorded since the last refresh, but the graphics are updated every frame.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     *
+     * @note Call this once per frame, before ImGui is rendered to the screen (i.e., before "render()").
+     */
+    void update_and_draw(const float dt);
+
+  private:
+    /**
+     * @brief Fold the samples recorded since the last refresh into the displayed figures, with throttling.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this method once each frame. The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void update(const float dt);
+
+    /**
+     * @brief Draw the latency overlay in the corner provided during construction.
+     *
+     * @note This method is called by "update_and_draw()" and is not intended to be called directly. Call this after "update()" and before ImGui is rendered to the screen (i.e., before "render()"). The value of "enabled" does NOT affect this method, use the higher-level "update_and_draw()" method instead.
+     */
+    void draw() const;
+
+    /**
+     * @brief How often to refresh the displayed figures, in seconds.
+     *
+     * @note 4 Hz keeps the numbers readable while still reacting quickly to pipeline changes.
+     */
+    static constexpr float update_rate_ = 1.0f / 4.0f;
+
+    /**
+     * @brief Size of the latency overlay window in pixels (width, height).
+     */
+    static constexpr ImVec2 window_size_ = {260.0f, 80.0f};
+
+    /**
+     * @brief Extra vertical offset in pixels, so the overlay does not cover the FPS counter, profiler overlay, and memory overlay, which default to the same corner.
+     */
+    static constexpr float overlay_clearance_ = 390.0f;
+
+    /**
+     * @brief Target window where the latency overlay will be drawn.
+     */
+    const sf::RenderTarget &window_;
+
+    /**
+     * @brief Pivot point for the latency overlay window.
+     *
+     * @note This is basically the corner of the window where the latency overlay will be displayed. The "x" and "y" values are in the range "[0, 1]", where "(0, 0)" is the top-left corner and "(1, 1)" is the bottom-right corner.
+     */
+    ImVec2 pivot_;
+
+    /**
+     * @brief Padding offset based on the pivot point.
+     */
+    ImVec2 offset_;
+
+    /**
+     * @brief Accumulated time since the last figure refresh.
+     */
+    float accumulation_ = 0.0f;
+
+    /**
+     * @brief Sum of the samples recorded since the last refresh, in seconds.
+     */
+    float sample_sum_seconds_ = 0.0f;
+
+    /**
+     * @brief Worst sample recorded since the last refresh, in seconds.
+     */
+    float sample_max_seconds_ = 0.0f;
+
+    /**
+     * @brief Number of samples recorded since the last refresh.
+     */
+    std::uint32_t sample_count_ = 0;
+
+    /**
+     * @brief Average latency shown by the overlay, in milliseconds.
+     */
+    float displayed_average_ms_ = 0.0f;
+
+    /**
+     * @brief Worst latency shown by the overlay, in milliseconds.
+     */
+    float displayed_max_ms_ = 0.0f;
+
+    /**
+     * @brief Whether at least one refresh with samples has happened; the overlay shows a placeholder until then.
+     */
+    bool has_figures_ = false;
 };
 
 }  // namespace core::widgets
@@ -2,13 +2,26 @@
  * @file world.cpp
  */
 
-#include <array>    // for std::array
-#include <cstddef>  // for std::size_t, std::ptrdiff_t
-#include <random>   // for std::mt19937, std::uniform_real_distribution, std::uniform_int_distribution
-#include <vector>   // for std::vector
+#include <algorithm>      // for std::min, std::max, std::clamp
+#include <array>          // for std::array
+#include <bit>            // for std::bit_cast
+#include <chrono>         // for std::chrono::seconds
+#include <cmath>          // for std::abs, std::atan2, std::hypot, std::llround, std::floor, std::lerp
+#include <cstddef>        // for std::size_t, std::ptrdiff_t
+#include <cstdint>        // for std::uint8_t, std::uint32_t
+#include <filesystem>     // for std::filesystem
+#include <fstream>        // for std::ifstream, std::ofstream
+#include <future>         // for std::async, std::future_status, std::launch
+#include <span>           // for std::span
+#include <unordered_map>  // for std::erase_if
+#include <utility>        // for std::move
+#include <vector>         // for std::vector
 
+#include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
-#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/View.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <spdlog/spdlog.h>
 
@@ -16,65 +29,598 @@
 
 namespace core::world {
 
+namespace {
+
+/**
+ * @brief Magic bytes identifying the track layout cache format ("VTC2"; bumped when the progress grid joined the layout, so "VTC1" caches miss cleanly and regenerate).
+ */
+constexpr std::uint8_t cache_magic_bytes[4] = {'V', 'T', 'C', '2'};
+
+/**
+ * @brief Append an integral value to the byte stream in little-endian order.
+ *
+ * @tparam T Integral type to write.
+ *
+ * @param bytes Byte stream to append to.
+ * @param value Value to write.
+ */
+template <typename T>
+void write_le(std::vector<std::uint8_t> &bytes,
+              const T value)
+{
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        bytes.emplace_back(static_cast<std::uint8_t>((static_cast<std::uint32_t>(value) >> (i * 8)) & 0xFFu));
+    }
+}
+
+/**
+ * @brief Read an integral value from the byte stream in little-endian order and advance the offset.
+ *
+ * @tparam T Integral type to read.
+ *
+ * @param bytes Byte stream to read from.
+ * @param offset Current read offset, in bytes; advanced past the value.
+ *
+ * @return Value read from the stream.
+ */
+template <typename T>
+[[nodiscard]] T read_le(const std::vector<std::uint8_t> &bytes,
+                        std::size_t &offset)
+{
+    std::uint32_t accumulator = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        accumulator |= static_cast<std::uint32_t>(bytes[offset + i]) << (i * 8);
+    }
+    offset += sizeof(T);
+    return static_cast<T>(accumulator);
+}
+
+/**
+ * @brief Append a float to the byte stream as its little-endian bit pattern.
+ *
+ * @param bytes Byte stream to append to.
+ * @param value Value to write.
+ */
+void write_f32(std::vector<std::uint8_t> &bytes,
+               const float value)
+{
+    write_le<std::uint32_t>(bytes, std::bit_cast<std::uint32_t>(value));
+}
+
+/**
+ * @brief Read a float from the byte stream and advance the offset.
+ *
+ * @param bytes Byte stream to read from.
+ * @param offset Current read offset, in bytes; advanced past the value.
+ *
+ * @return Value read from the stream.
+ */
+[[nodiscard]] float read_f32(const std::vector<std::uint8_t> &bytes,
+                             std::size_t &offset)
+{
+    return std::bit_cast<float>(read_le<std::uint32_t>(bytes, offset));
+}
+
+}  // namespace
+
 Track::Track(const Textures tiles,
-             std::mt19937 &rng,
-             const TrackConfig &config)
+             rng::Pcg32 &rng,
+             const TrackConfig &config,
+             const std::filesystem::path &cache_path)
     : tiles_(tiles),  //  Copy the small struct to prevent segfaults
       rng_(rng),
-      config_(Track::validate_config(config))
+      config_(Track::validate_config(config)),
+      requested_config_(this->config_)
 {
-    // Build the track immediately on construction
-    this->build();
+    // The first draw from the shared stream is this build's seed; the cache stores it, so a restart with the same seed and config can bulk-load the finished layout instead of regenerating it
+    const std::uint32_t build_seed = this->rng_.next();
+    if (cache_path.empty() || !this->try_load_cache(cache_path, build_seed)) {
+        // Build the track synchronously on construction; it must be ready for use immediately
+        this->apply_layout(Track::build_layout(this->config_, rng::Pcg32{build_seed}));
+        if (!cache_path.empty()) {
+            this->save_cache(cache_path, build_seed);
+        }
+    }
 }
 
 [[nodiscard]] const TrackConfig &Track::get_config() const
 {
-    return this->config_;
+    return this->requested_config_;
 }
 
 void Track::set_config(const TrackConfig &config)
 {
     const TrackConfig validated_config = Track::validate_config(config);
-    // Only rebuild if the configuration actually changes
-    if (!(this->config_ == validated_config)) {
-        SPDLOG_DEBUG("Config changed, rebuilding track...");
-        this->config_ = validated_config;
-        this->build();
-    }
-    else {
+    // Only rebuild if the configuration actually changes relative to the latest request
+    if (this->requested_config_ == validated_config) {
         SPDLOG_DEBUG("Config unchanged, skipping track rebuild!");
+        return;
     }
+
+    // Diff the configurations: if only the tile size differs, the existing layout can be scaled in place
+    // This fast path only applies when no build is in flight, since the active layout must match the active config
+    if (!this->build_pending_) {
+        TrackConfig size_matched_config = validated_config;
+        size_matched_config.size_px = this->config_.size_px;
+        if (size_matched_config == this->config_) {
+            SPDLOG_DEBUG("Only tile size changed, rescaling track in place...");
+            const float scale_factor = static_cast<float>(validated_config.size_px) / static_cast<float>(this->config_.size_px);
+            this->config_ = validated_config;
+            this->requested_config_ = validated_config;
+            this->rescale(scale_factor);
+            return;
+        }
+    }
+
+    // Anything that changes the layout itself (counts, detours) is generated on a background thread; "poll()" swaps it in when ready
+    SPDLOG_DEBUG("Config changed, building new track layout in the background...");
+    this->requested_config_ = validated_config;
+    if (!this->build_pending_) {
+        this->start_pending_build();
+    }
+    // If a build is already running, "poll()" will notice the stale result and relaunch with the latest config
 }
 
 void Track::reset()
 {
-    const TrackConfig default_config = Track::validate_config(TrackConfig{});  // Validate default compile-time config anyway
-    // Only rebuild if the configuration actually changes
-    if (!(this->config_ == default_config)) {
-        SPDLOG_DEBUG("Config changed during reset, rebuilding track...");
-        this->config_ = default_config;
-        this->build();
+    // Route through "set_config()" so the rebuild is diffed and runs in the background like any other change
+    this->set_config(TrackConfig{});
+}
+
+void Track::regenerate()
+{
+    SPDLOG_DEBUG("Regenerating track layout with the current configuration...");
+    if (!this->build_pending_) {
+        this->start_pending_build();
     }
-    else {
-        SPDLOG_DEBUG("Config is already default, skipping track rebuild!");
+    // If a build is already in flight, its result matches the requested config and will be swapped in by "poll()"; this request coalesces with it
+}
+
+bool Track::poll()
+{
+    if (!this->build_pending_) {
+        return false;
     }
+    if (this->pending_layout_.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+        return false;
+    }
+
+    Layout layout = this->pending_layout_.get();
+    if (!(layout.config == this->requested_config_)) {
+        // The config changed again while this layout was building; discard it and build the latest request
+        SPDLOG_DEBUG("Discarding stale track layout, relaunching build with the latest config...");
+        this->start_pending_build();
+        return false;
+    }
+
+    this->apply_layout(std::move(layout));
+    this->build_pending_ = false;
+    SPDLOG_DEBUG("Background track layout swapped in!");
+    return true;
 }
 
-bool Track::is_on_track(const sf::Vector2f &world_position) const
+void Track::apply_layout(Layout &&layout)
+{
+    this->config_ = layout.config;
+    this->tile_descriptors_ = std::move(layout.tile_descriptors);
+    this->collision_bounds_ = std::move(layout.collision_bounds);
+    this->tile_index_grid_ = std::move(layout.tile_index_grid);
+    this->grid_origin_ = layout.grid_origin;
+    this->grid_columns_ = layout.grid_columns;
+    this->grid_rows_ = layout.grid_rows;
+    this->distance_field_ = std::move(layout.distance_field);
+    this->distance_field_columns_ = layout.distance_field_columns;
+    this->distance_field_rows_ = layout.distance_field_rows;
+    this->distance_field_cell_size_ = layout.distance_field_cell_size;
+    this->waypoints_ = std::move(layout.waypoints);
+    this->racing_line_ = std::move(layout.racing_line);
+    this->progress_grid_ = std::move(layout.progress_grid);
+    this->progress_grid_columns_ = layout.progress_grid_columns;
+    this->progress_grid_rows_ = layout.progress_grid_rows;
+    this->progress_grid_cell_size_ = layout.progress_grid_cell_size;
+    this->finish_point_ = layout.finish_point;
+
+    // Everything materialized from the old layout is stale; chunks rebuild lazily around the camera
+    this->chunk_cache_.clear();
+}
+
+void Track::start_pending_build()
+{
+    this->build_pending_ = true;
+    // Seed a private RNG on this thread, so the background build never touches shared state
+    this->pending_layout_ = std::async(std::launch::async,
+                                       &Track::build_layout,
+                                       this->requested_config_,
+                                       rng::Pcg32{this->rng_.next()});
+}
+
+bool Track::try_load_cache(const std::filesystem::path &file_path,
+                           const std::uint32_t expected_seed)
 {
-    for (const auto &bounds : this->collision_bounds_) {
-        if (bounds.contains(world_position)) {
-            return true;
+    std::ifstream ifs(file_path, std::ios::binary | std::ios::ate);
+    if (!ifs) {
+        // A missing cache is the normal first-boot case, not an error
+        SPDLOG_INFO("No track layout cache found at '{}', generating from scratch!", file_path.string());
+        return false;
+    }
+    const std::streamsize file_size = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+    std::vector<std::uint8_t> bytes(static_cast<std::size_t>(file_size));
+    if (!ifs.read(reinterpret_cast<char *>(bytes.data()), file_size)) {
+        SPDLOG_WARN("Cannot read track layout cache '{}', generating from scratch!", file_path.string());
+        return false;
+    }
+
+    std::size_t offset = 0;
+    const auto has_bytes = [&bytes, &offset](const std::size_t count) {
+        return offset + count <= bytes.size();
+    };
+    const auto corrupt = [&file_path]() {
+        SPDLOG_WARN("Track layout cache '{}' is truncated or corrupt, generating from scratch!", file_path.string());
+        return false;
+    };
+
+    // Validate the fixed-size header first: magic, build seed, config
+    if (!has_bytes(4 + 4 + 16) ||
+        bytes[0] != cache_magic_bytes[0] || bytes[1] != cache_magic_bytes[1] ||
+        bytes[2] != cache_magic_bytes[2] || bytes[3] != cache_magic_bytes[3]) {
+        return corrupt();
+    }
+    offset = 4;
+    const std::uint32_t cached_seed = read_le<std::uint32_t>(bytes, offset);
+    TrackConfig cached_config;
+    cached_config.horizontal_count = read_le<std::uint32_t>(bytes, offset);
+    cached_config.vertical_count = read_le<std::uint32_t>(bytes, offset);
+    cached_config.size_px = read_le<std::uint32_t>(bytes, offset);
+    cached_config.detour_probability = read_f32(bytes, offset);
+
+    // The cache is only valid for the exact seed and config it was built from; anything else regenerates (and overwrites it afterwards)
+    if (cached_seed != expected_seed || !(cached_config == this->config_)) {
+        SPDLOG_INFO("Track layout cache '{}' is for a different seed or config, generating from scratch!", file_path.string());
+        return false;
+    }
+
+    Layout layout;
+    layout.config = cached_config;
+
+    // Tile descriptors: center position and tile type per placed tile
+    if (!has_bytes(4)) {
+        return corrupt();
+    }
+    const std::size_t tile_count = read_le<std::uint32_t>(bytes, offset);
+    if (!has_bytes(tile_count * 9)) {
+        return corrupt();
+    }
+    layout.tile_descriptors.reserve(tile_count);
+    for (std::size_t i = 0; i < tile_count; ++i) {
+        const float center_x = read_f32(bytes, offset);
+        const float center_y = read_f32(bytes, offset);
+        const std::uint8_t type_value = read_le<std::uint8_t>(bytes, offset);
+        if (type_value > static_cast<std::uint8_t>(TileType::HorizontalFinish)) {
+            return corrupt();
+        }
+        layout.tile_descriptors.emplace_back(TileDescriptor{.center = {center_x, center_y}, .type = static_cast<TileType>(type_value)});
+    }
+
+    // Collision bounds, parallel to the tile descriptors
+    if (!has_bytes(4)) {
+        return corrupt();
+    }
+    const std::size_t bound_count = read_le<std::uint32_t>(bytes, offset);
+    if (bound_count != tile_count || !has_bytes(bound_count * 16)) {
+        return corrupt();
+    }
+    layout.collision_bounds.reserve(bound_count);
+    for (std::size_t i = 0; i < bound_count; ++i) {
+        const float position_x = read_f32(bytes, offset);
+        const float position_y = read_f32(bytes, offset);
+        const float size_x = read_f32(bytes, offset);
+        const float size_y = read_f32(bytes, offset);
+        layout.collision_bounds.emplace_back(sf::FloatRect{{position_x, position_y}, {size_x, size_y}});
+    }
+
+    // Tile index grid with its origin and dimensions
+    if (!has_bytes(8 + 8 + 4)) {
+        return corrupt();
+    }
+    layout.grid_origin.x = read_f32(bytes, offset);
+    layout.grid_origin.y = read_f32(bytes, offset);
+    layout.grid_columns = read_le<std::uint32_t>(bytes, offset);
+    layout.grid_rows = read_le<std::uint32_t>(bytes, offset);
+    const std::size_t grid_cell_count = read_le<std::uint32_t>(bytes, offset);
+    if (grid_cell_count != layout.grid_columns * layout.grid_rows || !has_bytes(grid_cell_count * 4)) {
+        return corrupt();
+    }
+    layout.tile_index_grid.reserve(grid_cell_count);
+    for (std::size_t i = 0; i < grid_cell_count; ++i) {
+        layout.tile_index_grid.emplace_back(read_le<std::uint32_t>(bytes, offset));
+    }
+
+    // Signed distance field with its dimensions and cell size
+    if (!has_bytes(4 + 4 + 4 + 4)) {
+        return corrupt();
+    }
+    layout.distance_field_columns = read_le<std::uint32_t>(bytes, offset);
+    layout.distance_field_rows = read_le<std::uint32_t>(bytes, offset);
+    layout.distance_field_cell_size = read_f32(bytes, offset);
+    const std::size_t field_cell_count = read_le<std::uint32_t>(bytes, offset);
+    if (field_cell_count != layout.distance_field_columns * layout.distance_field_rows || !has_bytes(field_cell_count * 4)) {
+        return corrupt();
+    }
+    layout.distance_field.reserve(field_cell_count);
+    for (std::size_t i = 0; i < field_cell_count; ++i) {
+        layout.distance_field.emplace_back(read_f32(bytes, offset));
+    }
+
+    // Waypoints with their driving type
+    if (!has_bytes(4)) {
+        return corrupt();
+    }
+    const std::size_t waypoint_count = read_le<std::uint32_t>(bytes, offset);
+    if (!has_bytes(waypoint_count * 9)) {
+        return corrupt();
+    }
+    layout.waypoints.reserve(waypoint_count);
+    for (std::size_t i = 0; i < waypoint_count; ++i) {
+        const float position_x = read_f32(bytes, offset);
+        const float position_y = read_f32(bytes, offset);
+        const std::uint8_t type_value = read_le<std::uint8_t>(bytes, offset);
+        if (type_value > static_cast<std::uint8_t>(TrackWaypoint::DrivingType::Corner)) {
+            return corrupt();
+        }
+        layout.waypoints.emplace_back(TrackWaypoint{.position = {position_x, position_y}, .type = static_cast<TrackWaypoint::DrivingType>(type_value)});
+    }
+
+    // Racing line segments, parallel to the waypoints
+    if (!has_bytes(4)) {
+        return corrupt();
+    }
+    const std::size_t segment_count = read_le<std::uint32_t>(bytes, offset);
+    if (segment_count != waypoint_count || !has_bytes(segment_count * 22)) {
+        return corrupt();
+    }
+    layout.racing_line.reserve(segment_count);
+    for (std::size_t i = 0; i < segment_count; ++i) {
+        RacingLineSegment segment;
+        segment.direction.x = read_f32(bytes, offset);
+        segment.direction.y = read_f32(bytes, offset);
+        segment.length = read_f32(bytes, offset);
+        segment.curvature = read_f32(bytes, offset);
+        segment.target_speed = read_f32(bytes, offset);
+        segment.at_corner = read_le<std::uint8_t>(bytes, offset) != 0;
+        segment.approaching_corner = read_le<std::uint8_t>(bytes, offset) != 0;
+        layout.racing_line.emplace_back(segment);
+    }
+
+    // Progress grid with its dimensions and cell size; every cell must name an existing segment
+    if (!has_bytes(4 + 4 + 4 + 4)) {
+        return corrupt();
+    }
+    layout.progress_grid_columns = read_le<std::uint32_t>(bytes, offset);
+    layout.progress_grid_rows = read_le<std::uint32_t>(bytes, offset);
+    layout.progress_grid_cell_size = read_f32(bytes, offset);
+    const std::size_t progress_cell_count = read_le<std::uint32_t>(bytes, offset);
+    if (progress_cell_count != layout.progress_grid_columns * layout.progress_grid_rows || !has_bytes(progress_cell_count * 4)) {
+        return corrupt();
+    }
+    layout.progress_grid.reserve(progress_cell_count);
+    for (std::size_t i = 0; i < progress_cell_count; ++i) {
+        const float progress = read_f32(bytes, offset);
+        if (progress < 0.f || progress >= static_cast<float>(waypoint_count)) {
+            return corrupt();
         }
+        layout.progress_grid.emplace_back(progress);
+    }
+
+    // Finish line position
+    if (!has_bytes(8)) {
+        return corrupt();
+    }
+    layout.finish_point.x = read_f32(bytes, offset);
+    layout.finish_point.y = read_f32(bytes, offset);
+
+    this->apply_layout(std::move(layout));
+    SPDLOG_INFO("Loaded track layout cache with '{}' tiles ('{}' bytes) from '{}', skipping generation!", tile_count, bytes.size(), file_path.string());
+    return true;
+}
+
+void Track::save_cache(const std::filesystem::path &file_path,
+                       const std::uint32_t seed) const
+{
+    // Layout: 4-byte magic, u32 build seed, config (u32 horizontal count, u32 vertical count, u32 tile size, f32 detour probability),
+    // then each array prefixed with its u32 element count, in the order "try_load_cache()" reads them back
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(64 +
+                  this->tile_descriptors_.size() * 25 +
+                  this->tile_index_grid_.size() * 4 +
+                  this->distance_field_.size() * 4 +
+                  this->waypoints_.size() * 9 +
+                  this->racing_line_.size() * 22 +
+                  this->progress_grid_.size() * 4);
+    bytes.insert(bytes.end(), std::cbegin(cache_magic_bytes), std::cend(cache_magic_bytes));
+    write_le<std::uint32_t>(bytes, seed);
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->config_.horizontal_count));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->config_.vertical_count));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->config_.size_px));
+    write_f32(bytes, this->config_.detour_probability);
+
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->tile_descriptors_.size()));
+    for (const TileDescriptor &descriptor : this->tile_descriptors_) {
+        write_f32(bytes, descriptor.center.x);
+        write_f32(bytes, descriptor.center.y);
+        write_le<std::uint8_t>(bytes, static_cast<std::uint8_t>(descriptor.type));
+    }
+
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->collision_bounds_.size()));
+    for (const sf::FloatRect &bounds : this->collision_bounds_) {
+        write_f32(bytes, bounds.position.x);
+        write_f32(bytes, bounds.position.y);
+        write_f32(bytes, bounds.size.x);
+        write_f32(bytes, bounds.size.y);
+    }
+
+    write_f32(bytes, this->grid_origin_.x);
+    write_f32(bytes, this->grid_origin_.y);
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->grid_columns_));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->grid_rows_));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->tile_index_grid_.size()));
+    for (const std::uint32_t tile_index : this->tile_index_grid_) {
+        write_le<std::uint32_t>(bytes, tile_index);
+    }
+
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->distance_field_columns_));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->distance_field_rows_));
+    write_f32(bytes, this->distance_field_cell_size_);
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->distance_field_.size()));
+    for (const float distance : this->distance_field_) {
+        write_f32(bytes, distance);
+    }
+
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->waypoints_.size()));
+    for (const TrackWaypoint &waypoint : this->waypoints_) {
+        write_f32(bytes, waypoint.position.x);
+        write_f32(bytes, waypoint.position.y);
+        write_le<std::uint8_t>(bytes, static_cast<std::uint8_t>(waypoint.type));
+    }
+
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->racing_line_.size()));
+    for (const RacingLineSegment &segment : this->racing_line_) {
+        write_f32(bytes, segment.direction.x);
+        write_f32(bytes, segment.direction.y);
+        write_f32(bytes, segment.length);
+        write_f32(bytes, segment.curvature);
+        write_f32(bytes, segment.target_speed);
+        write_le<std::uint8_t>(bytes, segment.at_corner ? 1u : 0u);
+        write_le<std::uint8_t>(bytes, segment.approaching_corner ? 1u : 0u);
+    }
+
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->progress_grid_columns_));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->progress_grid_rows_));
+    write_f32(bytes, this->progress_grid_cell_size_);
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(this->progress_grid_.size()));
+    for (const float progress : this->progress_grid_) {
+        write_f32(bytes, progress);
+    }
+
+    write_f32(bytes, this->finish_point_.x);
+    write_f32(bytes, this->finish_point_.y);
+
+    std::filesystem::create_directories(file_path.parent_path());
+    std::ofstream ofs(file_path, std::ios::binary | std::ios::trunc);
+    if (!ofs) {
+        SPDLOG_ERROR("Cannot open track layout cache for writing: '{}'", file_path.string());
+        return;
+    }
+    ofs.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    SPDLOG_INFO("Track layout cache with '{}' tiles ('{}' bytes) was successfully saved to '{}'", this->tile_descriptors_.size(), bytes.size(), file_path.string());
+}
+
+bool Track::is_on_track(const sf::Vector2f &world_position) const
+{
+    // Single cell lookup in the uniform tile index grid built during "build()"
+    const float tile_size = static_cast<float>(this->config_.size_px);
+    const sf::Vector2f relative_position = world_position - this->grid_origin_;
+    if (relative_position.x < 0.f || relative_position.y < 0.f) {
+        return false;
+    }
+    const std::size_t column = static_cast<std::size_t>(relative_position.x / tile_size);
+    const std::size_t row = static_cast<std::size_t>(relative_position.y / tile_size);
+    if (column >= this->grid_columns_ || row >= this->grid_rows_) {
+        return false;
     }
-    return false;
+    return this->tile_index_grid_[row * this->grid_columns_ + column] != Track::no_tile_index_;
 }
 
-const std::vector<TrackWaypoint> &Track::get_waypoints() const
+TrackBoundarySample Track::sample_boundary(const sf::Vector2f &world_position) const
+{
+    // Nothing baked before the first build; report "deep inside", so callers never resolve a collision against a missing field
+    if (this->distance_field_columns_ == 0 || this->distance_field_rows_ == 0) [[unlikely]] {
+        return {.signed_distance = 1.0e9f, .gradient = {0.f, -1.f}};
+    }
+
+    // Bilinearly filter the field at continuous cell-center coordinates; integer coordinates clamp to the field edge, so queries outside the baked area stay well-defined
+    const auto value_at = [this](const float cell_x, const float cell_y) -> float {
+        const auto clamped = [this](const std::ptrdiff_t column, const std::ptrdiff_t row) -> float {
+            const std::size_t clamped_column = static_cast<std::size_t>(std::clamp<std::ptrdiff_t>(column, 0, static_cast<std::ptrdiff_t>(this->distance_field_columns_) - 1));
+            const std::size_t clamped_row = static_cast<std::size_t>(std::clamp<std::ptrdiff_t>(row, 0, static_cast<std::ptrdiff_t>(this->distance_field_rows_) - 1));
+            return this->distance_field_[clamped_row * this->distance_field_columns_ + clamped_column];
+        };
+        const float floor_x = std::floor(cell_x);
+        const float floor_y = std::floor(cell_y);
+        const float fraction_x = cell_x - floor_x;
+        const float fraction_y = cell_y - floor_y;
+        const auto column = static_cast<std::ptrdiff_t>(floor_x);
+        const auto row = static_cast<std::ptrdiff_t>(floor_y);
+        const float top = std::lerp(clamped(column, row), clamped(column + 1, row), fraction_x);
+        const float bottom = std::lerp(clamped(column, row + 1), clamped(column + 1, row + 1), fraction_x);
+        return std::lerp(top, bottom, fraction_y);
+    };
+
+    // Convert the world position into cell-center coordinates (sample points sit at cell centers, hence the half-cell shift)
+    const float inverse_cell_size = 1.f / this->distance_field_cell_size_;
+    const float cell_x = (world_position.x - this->grid_origin_.x) * inverse_cell_size - 0.5f;
+    const float cell_y = (world_position.y - this->grid_origin_.y) * inverse_cell_size - 0.5f;
+
+    // Central differences over one cell give the gradient of the filtered field
+    const float signed_distance = value_at(cell_x, cell_y);
+    sf::Vector2f gradient = {value_at(cell_x + 1.f, cell_y) - value_at(cell_x - 1.f, cell_y),
+                             value_at(cell_x, cell_y + 1.f) - value_at(cell_x, cell_y - 1.f)};
+    const float gradient_length = std::hypot(gradient.x, gradient.y);
+    if (gradient_length > 0.f) [[likely]] {
+        gradient /= gradient_length;
+    }
+    else {
+        // Degenerate plateau (e.g., equidistant from two edges); any fixed direction works, collisions this deep resolve over several steps anyway
+        gradient = {0.f, -1.f};
+    }
+    return {.signed_distance = signed_distance, .gradient = gradient};
+}
+
+TrackProgressSample Track::sample_progress(const sf::Vector2f &world_position) const
+{
+    // Nothing baked before the first build; report the start of the lap, so callers simply make no progress until the layout arrives
+    if (this->progress_grid_columns_ == 0 || this->progress_grid_rows_ == 0) [[unlikely]] {
+        return {.progress = 0.f, .segment = 0};
+    }
+
+    // Nearest-cell lookup clamped to the grid edge; no bilinear filtering because progress wraps at the finish seam, where blending neighboring cells would average wildly different values
+    const float inverse_cell_size = 1.f / this->progress_grid_cell_size_;
+    const auto column = static_cast<std::ptrdiff_t>(std::floor((world_position.x - this->grid_origin_.x) * inverse_cell_size));
+    const auto row = static_cast<std::ptrdiff_t>(std::floor((world_position.y - this->grid_origin_.y) * inverse_cell_size));
+    const std::size_t clamped_column = static_cast<std::size_t>(std::clamp<std::ptrdiff_t>(column, 0, static_cast<std::ptrdiff_t>(this->progress_grid_columns_) - 1));
+    const std::size_t clamped_row = static_cast<std::size_t>(std::clamp<std::ptrdiff_t>(row, 0, static_cast<std::ptrdiff_t>(this->progress_grid_rows_) - 1));
+    const float progress = this->progress_grid_[clamped_row * this->progress_grid_columns_ + clamped_column];
+    return {.progress = progress, .segment = std::min(static_cast<std::size_t>(progress), this->racing_line_.size() - 1)};
+}
+
+std::span<const TrackWaypoint> Track::get_waypoints() const
 {
     return this->waypoints_;
 }
 
+std::span<const RacingLineSegment> Track::get_racing_line() const
+{
+    return this->racing_line_;
+}
+
+std::span<const sf::FloatRect> Track::get_collision_bounds() const
+{
+    return this->collision_bounds_;
+}
+
+std::size_t Track::get_last_drawn_tile_count() const
+{
+    return this->last_drawn_tile_count_;
+}
+
+sf::FloatRect Track::get_world_bounds() const
+{
+    const float tile_size = static_cast<float>(this->config_.size_px);
+    return {this->grid_origin_,
+            {static_cast<float>(this->grid_columns_) * tile_size,
+             static_cast<float>(this->grid_rows_) * tile_size}};
+}
+
 const sf::Vector2f &Track::get_finish_position() const
 {
     // SPDLOG_DEBUG("Returning finish point at ('{}', '{}') px!", this->finish_point_.x, this->finish_point_.y);
@@ -83,9 +629,160 @@ const sf::Vector2f &Track::get_finish_position() const
 
 void Track::draw(sf::RenderTarget &target) const
 {
-    for (const sf::Sprite &sprite : this->sprites_) {
-        target.draw(sprite);
+    this->last_drawn_tile_count_ = 0;
+
+    // Nothing to draw before the first build
+    if (this->grid_columns_ == 0 || this->grid_rows_ == 0) [[unlikely]] {
+        return;
+    }
+
+    // Compute the visible world rectangle from the target's current view; views are never rotated in this game
+    const sf::View &view = target.getView();
+    const sf::Vector2f view_top_left = view.getCenter() - view.getSize() * 0.5f;
+    const sf::Vector2f view_bottom_right = view_top_left + view.getSize();
+
+    // Clamp the visible rectangle to a cell range in the same uniform grid used by "is_on_track()"
+    const float tile_size = static_cast<float>(this->config_.size_px);
+    const auto to_cell = [&](const float coordinate,
+                             const float origin,
+                             const std::size_t cell_count) -> std::size_t {
+        const float relative = (coordinate - origin) / tile_size;
+        if (relative < 0.f) {
+            return 0;
+        }
+        return std::min(static_cast<std::size_t>(relative), cell_count - 1);
+    };
+    const std::size_t first_column = to_cell(view_top_left.x, this->grid_origin_.x, this->grid_columns_);
+    const std::size_t last_column = to_cell(view_bottom_right.x, this->grid_origin_.x, this->grid_columns_);
+    const std::size_t first_row = to_cell(view_top_left.y, this->grid_origin_.y, this->grid_rows_);
+    const std::size_t last_row = to_cell(view_bottom_right.y, this->grid_origin_.y, this->grid_rows_);
+
+    // Entire view is off the grid; nothing visible
+    if (view_bottom_right.x < this->grid_origin_.x || view_bottom_right.y < this->grid_origin_.y) [[unlikely]] {
+        return;
+    }
+
+    // Cull at chunk granularity; a partially visible chunk is drawn whole, the GPU clips the rest
+    const std::size_t chunk_columns = (this->grid_columns_ + chunk_edge_tiles_ - 1) / chunk_edge_tiles_;
+    const std::size_t first_chunk_column = first_column / chunk_edge_tiles_;
+    const std::size_t last_chunk_column = last_column / chunk_edge_tiles_;
+    const std::size_t first_chunk_row = first_row / chunk_edge_tiles_;
+    const std::size_t last_chunk_row = last_row / chunk_edge_tiles_;
+
+    ++this->draw_counter_;
+    for (std::size_t chunk_row = first_chunk_row; chunk_row <= last_chunk_row; ++chunk_row) {
+        for (std::size_t chunk_column = first_chunk_column; chunk_column <= last_chunk_column; ++chunk_column) {
+            // Materialize the chunk on first use; afterwards it is served from the cache until evicted
+            const std::size_t chunk_key = chunk_row * chunk_columns + chunk_column;
+            auto cached = this->chunk_cache_.find(chunk_key);
+            if (cached == this->chunk_cache_.end()) {
+                cached = this->chunk_cache_.emplace(chunk_key, this->build_chunk_geometry(chunk_column, chunk_row)).first;
+            }
+            ChunkGeometry &chunk = cached->second;
+            chunk.last_used_frame = this->draw_counter_;
+            this->last_drawn_tile_count_ += chunk.tile_count;
+
+            // One draw call per source texture within the chunk (a single call when the tiles share an atlas)
+            for (const TileBatch &batch : chunk.batches) {
+                sf::RenderStates states;
+                states.texture = batch.texture;
+                target.draw(batch.vertices, states);
+            }
+        }
+    }
+
+    // Once the cache outgrows its cap, evict every chunk the camera has left; memory stays proportional to the area near the camera
+    if (this->chunk_cache_.size() > Track::max_cached_chunks_) {
+        const std::size_t evicted = std::erase_if(this->chunk_cache_,
+                                                  [this](const auto &entry) { return entry.second.last_used_frame != this->draw_counter_; });
+        SPDLOG_DEBUG("Evicted '{}' track chunks, '{}' remain materialized!", evicted, this->chunk_cache_.size());
+    }
+}
+
+const Track::TextureRegion &Track::region_for(const TileType type) const
+{
+    switch (type) {
+    case TileType::TopLeft:
+        return this->tiles_.top_left;
+    case TileType::TopRight:
+        return this->tiles_.top_right;
+    case TileType::BottomRight:
+        return this->tiles_.bottom_right;
+    case TileType::BottomLeft:
+        return this->tiles_.bottom_left;
+    case TileType::Vertical:
+        return this->tiles_.vertical;
+    case TileType::Horizontal:
+        return this->tiles_.horizontal;
+    case TileType::HorizontalFinish:
+        return this->tiles_.horizontal_finish;
     }
+    // Unreachable with a valid enum; keeps the compiler satisfied
+    return this->tiles_.horizontal;
+}
+
+Track::ChunkGeometry Track::build_chunk_geometry(const std::size_t chunk_column,
+                                                 const std::size_t chunk_row) const
+{
+    ChunkGeometry chunk;
+    const float tile_size = static_cast<float>(this->config_.size_px);
+    const float half_tile = 0.5f * tile_size;
+
+    // Cell range covered by this chunk, clamped to the grid edge
+    const std::size_t first_column = chunk_column * chunk_edge_tiles_;
+    const std::size_t first_row = chunk_row * chunk_edge_tiles_;
+    const std::size_t last_column = std::min(first_column + chunk_edge_tiles_, this->grid_columns_);
+    const std::size_t last_row = std::min(first_row + chunk_edge_tiles_, this->grid_rows_);
+
+    for (std::size_t row = first_row; row < last_row; ++row) {
+        for (std::size_t column = first_column; column < last_column; ++column) {
+            const std::uint32_t tile_index = this->tile_index_grid_[row * this->grid_columns_ + column];
+            if (tile_index == Track::no_tile_index_) {
+                continue;
+            }
+            const TileDescriptor &descriptor = this->tile_descriptors_[tile_index];
+            const TextureRegion &region = this->region_for(descriptor.type);
+
+            // Find the batch for this texture, creating it on first use
+            TileBatch *batch = nullptr;
+            for (TileBatch &candidate : chunk.batches) {
+                if (candidate.texture == &region.texture) {
+                    batch = &candidate;
+                    break;
+                }
+            }
+            if (batch == nullptr) {
+                batch = &chunk.batches.emplace_back(TileBatch{.texture = &region.texture,
+                                                              .vertices = sf::VertexArray(sf::PrimitiveType::Triangles)});
+            }
+
+            // Tile corners in world space; tiles are axis-aligned, so no rotation is involved
+            const sf::Vector2f world_top_left = {descriptor.center.x - half_tile, descriptor.center.y - half_tile};
+            const sf::Vector2f world_top_right = {descriptor.center.x + half_tile, descriptor.center.y - half_tile};
+            const sf::Vector2f world_bottom_right = {descriptor.center.x + half_tile, descriptor.center.y + half_tile};
+            const sf::Vector2f world_bottom_left = {descriptor.center.x - half_tile, descriptor.center.y + half_tile};
+
+            // Texture corners span the region's rectangle within its source texture (typically the shared atlas); the GPU scales it to the tile size
+            const sf::Vector2f region_position = {static_cast<float>(region.rect.position.x),
+                                                  static_cast<float>(region.rect.position.y)};
+            const sf::Vector2f region_size = {static_cast<float>(region.rect.size.x),
+                                              static_cast<float>(region.rect.size.y)};
+            const sf::Vector2f texture_top_left = region_position;
+            const sf::Vector2f texture_top_right = {region_position.x + region_size.x, region_position.y};
+            const sf::Vector2f texture_bottom_right = {region_position.x + region_size.x, region_position.y + region_size.y};
+            const sf::Vector2f texture_bottom_left = {region_position.x, region_position.y + region_size.y};
+
+            // Two triangles per tile, since SFML 3 removed the quad primitive
+            batch->vertices.append(sf::Vertex{.position = world_top_left, .texCoords = texture_top_left});
+            batch->vertices.append(sf::Vertex{.position = world_top_right, .texCoords = texture_top_right});
+            batch->vertices.append(sf::Vertex{.position = world_bottom_right, .texCoords = texture_bottom_right});
+            batch->vertices.append(sf::Vertex{.position = world_top_left, .texCoords = texture_top_left});
+            batch->vertices.append(sf::Vertex{.position = world_bottom_right, .texCoords = texture_bottom_right});
+            batch->vertices.append(sf::Vertex{.position = world_bottom_left, .texCoords = texture_bottom_left});
+            ++chunk.tile_count;
+        }
+    }
+    return chunk;
 }
 
 TrackConfig Track::validate_config(const TrackConfig &config)
@@ -131,80 +828,62 @@ TrackConfig Track::validate_config(const TrackConfig &config)
     return validated_config;
 }
 
-void Track::build()
+Track::Layout Track::build_layout(const TrackConfig config,
+                                  rng::Pcg32 rng)
 {
     SPDLOG_DEBUG("Starting build with: horizontal_count='{}', vertical_count='{}', size_px='{}', detour_probability='{}'...",
-                 this->config_.horizontal_count,
-                 this->config_.vertical_count,
-                 this->config_.size_px,
-                 this->config_.detour_probability);
+                 config.horizontal_count,
+                 config.vertical_count,
+                 config.size_px,
+                 config.detour_probability);
 
-    // Reset everything
-    this->sprites_.clear();
-    this->collision_bounds_.clear();
-    this->waypoints_.clear();
-    this->finish_point_ = {0.f, 0.f};  // Perhaps not needed, but just in case
+    // Generate into a fresh layout; the caller decides when to swap it into the active members
+    Layout layout;
+    layout.config = config;
 
     // Reserve capacity
     const std::size_t base_tile_count =
-        4                                           // Corners
-        + 2 * (this->config_.horizontal_count - 2)  // Top and bottom edges
-        + 2 * (this->config_.vertical_count - 2);   // Left and right edges
-    this->sprites_.reserve(base_tile_count * 2);    // Multiply by 2 for detours
-    this->waypoints_.reserve(base_tile_count * 2);  // Multiply by 2 for detours
-    // SPDLOG_DEBUG("Reserved capacity for '{}' sprites, now calculating track size...", this->sprites_.capacity());
+        4                                                  // Corners
+        + 2 * (config.horizontal_count - 2)                // Top and bottom edges
+        + 2 * (config.vertical_count - 2);                 // Left and right edges
+    layout.collision_bounds.reserve(base_tile_count * 2);  // Multiply by 2 for detours
+    layout.tile_descriptors.reserve(base_tile_count * 2);  // Multiply by 2 for detours
+    layout.waypoints.reserve(base_tile_count * 2);         // Multiply by 2 for detours
 
     // Define the half the tile size for centering and positioning
     constexpr float half = 0.5f;
 
     // Calculate total width and height based on the number of tiles and the desired tile size
-    const float tile_size = static_cast<float>(this->config_.size_px);
-    const float total_width = tile_size * static_cast<float>(this->config_.horizontal_count);
-    const float total_height = tile_size * static_cast<float>(this->config_.vertical_count);
+    const float tile_size = static_cast<float>(config.size_px);
+    const float total_width = tile_size * static_cast<float>(config.horizontal_count);
+    const float total_height = tile_size * static_cast<float>(config.vertical_count);
 
     // Top-left corner position, will be used as a starting point for placing tiles, assuming the track is centered at the origin
     const sf::Vector2f top_left_origin = {-half * total_width,
                                           -half * total_height};
 
-    // Assuming that all map textures are the same size and square (same height & width), get the width of the first one
-    // Then, calculate the scale factor based on the desired tile size and the texture size
-    // Unfortunately, "sprite.setScale()" expects a float, so we need to convert the final size to float
-    const float scale_factor = tile_size / static_cast<float>(this->tiles_.top_left.getSize().x);
-    // SPDLOG_DEBUG("Tile size '{}' px gives total size ('{}', '{}') px, top-left origin ('{}', '{}') px, and scale factor '{}x'!",
-    //              tile_size,
-    //              total_width,
-    //              total_height,
-    //              top_left_origin.x,
-    //              top_left_origin.y,
-    //              scale_factor);
-
     // Temporary vector to collect waypoints in build order, then reorder them starting from finish line
     std::vector<TrackWaypoint> temp_waypoints;
     temp_waypoints.reserve(base_tile_count * 2);
     std::size_t temp_finish_index = 0;
 
-    // Create a sprite from a texture, scale, center, position it, and collect waypoint data
-    const auto place_tile = [&](const sf::Texture &texture,
+    // Record a compact tile descriptor, cache its collision bounds, and collect waypoint data; vertex data is materialized per chunk at draw time
+    const auto place_tile = [&](const TileType type,
                                 const sf::Vector2f &position,
                                 const bool is_corner,
                                 const bool is_finish = false) {
-        // Create a new sprite using the texture
-        this->sprites_.emplace_back(texture);
-        sf::Sprite &sprite = this->sprites_.back();
+        const float half_tile = half * tile_size;
+        const sf::Vector2f world_top_left = {position.x - half_tile, position.y - half_tile};
 
-        // Set the origin to the center of the sprite, for easier positioning
-        sprite.setOrigin(sprite.getLocalBounds().getCenter());
+        layout.tile_descriptors.emplace_back(TileDescriptor{.center = position, .type = type});
 
-        // Scale the sprite to the desired size
-        sprite.setScale({scale_factor, scale_factor});
-
-        // Set the position of the sprite to the provided position
-        sprite.setPosition(position);
+        // Cache the collision bounds directly; this matches the old per-sprite "getGlobalBounds()" result
+        layout.collision_bounds.emplace_back(sf::FloatRect{world_top_left, {tile_size, tile_size}});
 
         // If it's the finish line, record its position to be used as a spawn point
         // This should be true only once throughout the entire track; you cannot have multiple finish points
         if (is_finish) {
-            this->finish_point_ = position;
+            layout.finish_point = position;
             // Record the finish index in the temporary build order
             temp_finish_index = temp_waypoints.size();
         }
@@ -219,22 +898,19 @@ void Track::build()
     // Define bubble sizes allowed for detours
     constexpr std::array<std::size_t, 2> bubble_heights = {3, 4};
 
-    // Define distribution for detour chance [0.0, 1.0]
-    std::uniform_real_distribution<float> detour_dist{0.0f, 1.0f};
-
     // Process the edge, walking downward and laying optional detours
     const auto process_edge_down = [&](const float main_x,
                                        const float detour_x,
-                                       const sf::Texture &top_detour,
-                                       const sf::Texture &top_main,
-                                       const sf::Texture &bottom_detour,
-                                       const sf::Texture &bottom_main) {
-        for (std::size_t row = 1; row < this->config_.vertical_count - 1;) {
-            if (detour_dist(this->rng_) < this->config_.detour_probability) {
+                                       const TileType top_detour,
+                                       const TileType top_main,
+                                       const TileType bottom_detour,
+                                       const TileType bottom_main) {
+        for (std::size_t row = 1; row < config.vertical_count - 1;) {
+            if (rng.uniform(0.0f, 1.0f) < config.detour_probability) {
                 // Determine which bubble heights fit
                 std::vector<std::size_t> viable;
                 for (const std::size_t height : bubble_heights) {
-                    if (row + height < this->config_.vertical_count) {
+                    if (row + height < config.vertical_count) {
                         viable.emplace_back(height);
                     }
                 }
@@ -243,7 +919,7 @@ void Track::build()
                     // If only one viable height, use it; otherwise pick a random one
                     const std::size_t height = viable.size() == 1
                                                    ? viable.front()
-                                                   : viable[std::uniform_int_distribution<std::size_t>(0, viable.size() - 1)(this->rng_)];
+                                                   : viable[rng.bounded(viable.size())];
                     const float y_top = top_left_origin.y + (static_cast<float>(row) + half) * tile_size;
                     const float y_bottom = y_top + static_cast<float>(height - 1) * tile_size;
 
@@ -258,7 +934,7 @@ void Track::build()
                     // Place straight detour verticals
                     for (std::size_t offset = 1; offset + 1 < height; ++offset) {
                         const float y_mid = y_top + static_cast<float>(offset) * tile_size;
-                        place_tile(this->tiles_.vertical,
+                        place_tile(TileType::Vertical,
                                    {detour_x, y_mid},
                                    false);
                     }
@@ -274,9 +950,9 @@ void Track::build()
                     // Advance row pointer beyond detour and insert continuity tile
                     // This is a fix for the real edge not having a vertical tile before the next detour
                     row += height;
-                    if (row < this->config_.vertical_count - 1) {
+                    if (row < config.vertical_count - 1) {
                         const float y_cont = top_left_origin.y + (static_cast<float>(row) + half) * tile_size;
-                        place_tile(this->tiles_.vertical,
+                        place_tile(TileType::Vertical,
                                    {main_x, y_cont},
                                    false);
                         ++row;
@@ -287,7 +963,7 @@ void Track::build()
 
             // No detour: plain vertical
             const float y = top_left_origin.y + (static_cast<float>(row) + half) * tile_size;
-            place_tile(this->tiles_.vertical,
+            place_tile(TileType::Vertical,
                        {main_x, y},
                        false);
             ++row;
@@ -297,12 +973,12 @@ void Track::build()
     // Process the edge, walking upward and laying optional detours
     const auto process_edge_up = [&](const float main_x,
                                      const float detour_x,
-                                     const sf::Texture &bottom_detour,
-                                     const sf::Texture &bottom_main,
-                                     const sf::Texture &top_detour,
-                                     const sf::Texture &top_main) {
-        for (std::ptrdiff_t row = static_cast<std::ptrdiff_t>(this->config_.vertical_count - 2); row > 0;) {
-            if (detour_dist(this->rng_) < this->config_.detour_probability) {
+                                     const TileType bottom_detour,
+                                     const TileType bottom_main,
+                                     const TileType top_detour,
+                                     const TileType top_main) {
+        for (std::ptrdiff_t row = static_cast<std::ptrdiff_t>(config.vertical_count - 2); row > 0;) {
+            if (rng.uniform(0.0f, 1.0f) < config.detour_probability) {
                 // Determine which bubble heights fit
                 std::vector<std::size_t> viable;
                 for (const std::size_t height : bubble_heights) {
@@ -316,7 +992,7 @@ void Track::build()
                     // If only one viable height, use it; otherwise pick a random one
                     const std::size_t height = viable.size() == 1
                                                    ? viable.front()
-                                                   : viable[std::uniform_int_distribution<std::size_t>(0, viable.size() - 1)(this->rng_)];
+                                                   : viable[rng.bounded(viable.size())];
                     const float y_bottom = top_left_origin.y + (static_cast<float>(row) + half) * tile_size;
                     const float y_top = y_bottom - static_cast<float>(height - 1) * tile_size;
 
@@ -331,7 +1007,7 @@ void Track::build()
                     // Place straight detour verticals
                     for (std::size_t off = 1; off + 1 < height; ++off) {
                         const float y_mid = y_bottom - static_cast<float>(off) * tile_size;
-                        place_tile(this->tiles_.vertical,
+                        place_tile(TileType::Vertical,
                                    {detour_x, y_mid},
                                    false);
                     }
@@ -349,7 +1025,7 @@ void Track::build()
                     row -= static_cast<std::ptrdiff_t>(height);
                     if (row > 0) {
                         const float y_cont = top_left_origin.y + (static_cast<float>(row) + half) * tile_size;
-                        place_tile(this->tiles_.vertical,
+                        place_tile(TileType::Vertical,
                                    {main_x, y_cont},
                                    false);
                         --row;
@@ -360,7 +1036,7 @@ void Track::build()
 
             // No detour: plain vertical
             const float y = top_left_origin.y + (static_cast<float>(row) + half) * tile_size;
-            place_tile(this->tiles_.vertical,
+            place_tile(TileType::Vertical,
                        {main_x, y},
                        false);
             --row;
@@ -376,90 +1052,306 @@ void Track::build()
     const float right_detour_x = right_main_x + tile_size;
 
     // Place top left corner
-    place_tile(this->tiles_.top_left,
+    place_tile(TileType::TopLeft,
                {left_main_x, top_row_y},
                true);
 
     // Place top edge left to right
-    const std::size_t finish_idx = 1 + (this->config_.horizontal_count - 2) / 2;
-    if (this->config_.horizontal_count % 2 == 0) {
-        SPDLOG_WARN("Horizontal tile count '{}' is even, the finish line will be placed at an uneven, right-of-center, index '{}'!", this->config_.horizontal_count, finish_idx);
+    const std::size_t finish_idx = 1 + (config.horizontal_count - 2) / 2;
+    if (config.horizontal_count % 2 == 0) {
+        SPDLOG_WARN("Horizontal tile count '{}' is even, the finish line will be placed at an uneven, right-of-center, index '{}'!", config.horizontal_count, finish_idx);
     }
-    for (std::size_t x_index = 1; x_index < this->config_.horizontal_count - 1; ++x_index) {
+    for (std::size_t x_index = 1; x_index < config.horizontal_count - 1; ++x_index) {
         const float x = top_left_origin.x + (static_cast<float>(x_index) + half) * tile_size;
         const bool is_finish = x_index == finish_idx;
         place_tile(is_finish
-                       ? this->tiles_.horizontal_finish
-                       : this->tiles_.horizontal,
+                       ? TileType::HorizontalFinish
+                       : TileType::Horizontal,
                    {x, top_row_y},
                    false,
                    is_finish);
     }
 
     // Place top right corner
-    place_tile(this->tiles_.top_right,
+    place_tile(TileType::TopRight,
                {right_main_x, top_row_y},
                true);
 
     // Place right edge downward
     process_edge_down(right_main_x,
                       right_detour_x,
-                      this->tiles_.top_right,
-                      this->tiles_.bottom_left,
-                      this->tiles_.bottom_right,
-                      this->tiles_.top_left);
+                      TileType::TopRight,
+                      TileType::BottomLeft,
+                      TileType::BottomRight,
+                      TileType::TopLeft);
 
     // Place bottom right corner
-    place_tile(this->tiles_.bottom_right,
+    place_tile(TileType::BottomRight,
                {right_main_x, bottom_row_y},
                true);
 
     // Place bottom edge right to left
-    for (std::size_t x_index = this->config_.horizontal_count - 2; x_index > 0; --x_index) {
+    for (std::size_t x_index = config.horizontal_count - 2; x_index > 0; --x_index) {
         const float x = top_left_origin.x + (static_cast<float>(x_index) + half) * tile_size;
-        place_tile(this->tiles_.horizontal,
+        place_tile(TileType::Horizontal,
                    {x, bottom_row_y},
                    false);
     }
 
     // Place bottom left corner
-    place_tile(this->tiles_.bottom_left,
+    place_tile(TileType::BottomLeft,
                {left_main_x, bottom_row_y},
                true);
 
     // Place left edge upward
     process_edge_up(left_main_x,
                     left_detour_x,
-                    this->tiles_.bottom_left,
-                    this->tiles_.top_right,
-                    this->tiles_.top_left,
-                    this->tiles_.bottom_right);
+                    TileType::BottomLeft,
+                    TileType::TopRight,
+                    TileType::TopLeft,
+                    TileType::BottomRight);
 
-    // Pre-cache collision bounds for all sprites
-    for (const auto &sprite : this->sprites_) {
-        this->collision_bounds_.emplace_back(sprite.getGlobalBounds());
+    // Build the uniform tile index grid shared by "is_on_track()" collision queries and "draw()" culling
+    // Every tile is an axis-aligned square of "tile_size" on a regular lattice, so each tile covers exactly one cell
+    sf::Vector2f minimum_corner = layout.collision_bounds.front().position;
+    sf::Vector2f maximum_corner = minimum_corner + layout.collision_bounds.front().size;
+    for (const sf::FloatRect &bounds : layout.collision_bounds) {
+        minimum_corner.x = std::min(minimum_corner.x, bounds.position.x);
+        minimum_corner.y = std::min(minimum_corner.y, bounds.position.y);
+        maximum_corner.x = std::max(maximum_corner.x, bounds.position.x + bounds.size.x);
+        maximum_corner.y = std::max(maximum_corner.y, bounds.position.y + bounds.size.y);
+    }
+    layout.grid_origin = minimum_corner;
+    // Round to the nearest integer to absorb floating-point noise in the tile positions
+    layout.grid_columns = static_cast<std::size_t>(std::llround((maximum_corner.x - minimum_corner.x) / tile_size));
+    layout.grid_rows = static_cast<std::size_t>(std::llround((maximum_corner.y - minimum_corner.y) / tile_size));
+    layout.tile_index_grid.assign(layout.grid_columns * layout.grid_rows, Track::no_tile_index_);
+    for (std::size_t tile_index = 0; tile_index < layout.collision_bounds.size(); ++tile_index) {
+        const sf::FloatRect &bounds = layout.collision_bounds[tile_index];
+        const std::size_t column = static_cast<std::size_t>(std::llround((bounds.position.x - layout.grid_origin.x) / tile_size));
+        const std::size_t row = static_cast<std::size_t>(std::llround((bounds.position.y - layout.grid_origin.y) / tile_size));
+        layout.tile_index_grid[row * layout.grid_columns + column] = static_cast<std::uint32_t>(tile_index);
+    }
+    SPDLOG_DEBUG("Tile index grid of '{}x{}' cells built for track collision and culling queries!", layout.grid_columns, layout.grid_rows);
+
+    // Bake the signed distance field over the track area, so collision queries get penetration depth and surface normal from one bilinear lookup
+    // Occupancy comes from the tile index grid; a two-pass chamfer transform then propagates the distance to the nearest boundary across the whole field
+    {
+        layout.distance_field_columns = layout.grid_columns * distance_field_cells_per_tile_;
+        layout.distance_field_rows = layout.grid_rows * distance_field_cells_per_tile_;
+        layout.distance_field_cell_size = tile_size / static_cast<float>(distance_field_cells_per_tile_);
+        const std::size_t cell_count = layout.distance_field_columns * layout.distance_field_rows;
+
+        // A distance-field cell is inside the track iff its covering tile cell is; cells beyond the grid count as outside
+        const auto is_inside = [&layout](const std::size_t column, const std::size_t row) -> bool {
+            const std::size_t tile_column = column / distance_field_cells_per_tile_;
+            const std::size_t tile_row = row / distance_field_cells_per_tile_;
+            return layout.tile_index_grid[tile_row * layout.grid_columns + tile_column] != Track::no_tile_index_;
+        };
+
+        // Seed: boundary cells (any 4-neighbor with opposite occupancy, or grid border while inside) start at zero, everything else at infinity
+        constexpr float infinite_distance = 1.0e9f;
+        std::vector<float> chamfer(cell_count, infinite_distance);
+        for (std::size_t row = 0; row < layout.distance_field_rows; ++row) {
+            for (std::size_t column = 0; column < layout.distance_field_columns; ++column) {
+                const bool inside = is_inside(column, row);
+                const bool left_differs = (column == 0) ? inside : is_inside(column - 1, row) != inside;
+                const bool right_differs = (column + 1 == layout.distance_field_columns) ? inside : is_inside(column + 1, row) != inside;
+                const bool top_differs = (row == 0) ? inside : is_inside(column, row - 1) != inside;
+                const bool bottom_differs = (row + 1 == layout.distance_field_rows) ? inside : is_inside(column, row + 1) != inside;
+                if (left_differs || right_differs || top_differs || bottom_differs) {
+                    chamfer[row * layout.distance_field_columns + column] = 0.f;
+                }
+            }
+        }
+
+        // Two-pass chamfer relaxation in cell units: forward over the top-left neighbors, backward over the bottom-right ones
+        constexpr float straight_step = 1.f;
+        constexpr float diagonal_step = 1.41421356f;
+        const auto relax = [&chamfer, &layout](const std::size_t column, const std::size_t row, const std::ptrdiff_t column_offset, const std::ptrdiff_t row_offset, const float step) {
+            const std::ptrdiff_t neighbor_column = static_cast<std::ptrdiff_t>(column) + column_offset;
+            const std::ptrdiff_t neighbor_row = static_cast<std::ptrdiff_t>(row) + row_offset;
+            if (neighbor_column < 0 || neighbor_row < 0 ||
+                neighbor_column >= static_cast<std::ptrdiff_t>(layout.distance_field_columns) ||
+                neighbor_row >= static_cast<std::ptrdiff_t>(layout.distance_field_rows)) {
+                return;
+            }
+            float &cell = chamfer[row * layout.distance_field_columns + column];
+            cell = std::min(cell, chamfer[static_cast<std::size_t>(neighbor_row) * layout.distance_field_columns + static_cast<std::size_t>(neighbor_column)] + step);
+        };
+        for (std::size_t row = 0; row < layout.distance_field_rows; ++row) {
+            for (std::size_t column = 0; column < layout.distance_field_columns; ++column) {
+                relax(column, row, -1, 0, straight_step);
+                relax(column, row, 0, -1, straight_step);
+                relax(column, row, -1, -1, diagonal_step);
+                relax(column, row, 1, -1, diagonal_step);
+            }
+        }
+        for (std::size_t row = layout.distance_field_rows; row-- > 0;) {
+            for (std::size_t column = layout.distance_field_columns; column-- > 0;) {
+                relax(column, row, 1, 0, straight_step);
+                relax(column, row, 0, 1, straight_step);
+                relax(column, row, 1, 1, diagonal_step);
+                relax(column, row, -1, 1, diagonal_step);
+            }
+        }
+
+        // Sign by occupancy and convert to pixels; the half-cell offset accounts for the edge lying between a boundary cell and its opposite neighbor
+        layout.distance_field.resize(cell_count);
+        for (std::size_t row = 0; row < layout.distance_field_rows; ++row) {
+            for (std::size_t column = 0; column < layout.distance_field_columns; ++column) {
+                const std::size_t index = row * layout.distance_field_columns + column;
+                const float distance_px = (chamfer[index] + 0.5f) * layout.distance_field_cell_size;
+                layout.distance_field[index] = is_inside(column, row) ? distance_px : -distance_px;
+            }
+        }
+        SPDLOG_DEBUG("Signed distance field of '{}x{}' cells ('{}' px per cell) baked for boundary collision!", layout.distance_field_columns, layout.distance_field_rows, layout.distance_field_cell_size);
     }
 
     // Reorder waypoints to start from the finish line position
     // This eliminates the need for finish_index_ workaround in AI navigation
     SPDLOG_DEBUG("Now reordering waypoints: finish line is at index '{}' (out of '{}' total)", temp_finish_index, temp_waypoints.size());
 
-    this->waypoints_.clear();
-    this->waypoints_.reserve(temp_waypoints.size());
+    layout.waypoints.clear();
+    layout.waypoints.reserve(temp_waypoints.size());
 
     // Add waypoints starting from finish line, going forward in racing direction
     for (std::size_t offset = 0; offset < temp_waypoints.size(); ++offset) {
         const std::size_t index = (temp_finish_index + offset) % temp_waypoints.size();
-        this->waypoints_.emplace_back(temp_waypoints[index]);
+        layout.waypoints.emplace_back(temp_waypoints[index]);
     }
 
-    SPDLOG_DEBUG("Waypoints reordered, now starting from the finish line at index '0' (out of '{}' total)", this->waypoints_.size());
+    SPDLOG_DEBUG("Waypoints reordered, now starting from the finish line at index '0' (out of '{}' total)", layout.waypoints.size());
+
+    // Precompute the racing line: per-segment unit direction, length, curvature, and target speed
+    // AI navigation reads these as table lookups every tick, so all the geometry is derived here exactly once per build
+    constexpr float corner_speed_factor = 1.2f;    // Target speed in corner context as fraction of tile size; increase = faster through corners but riskier, decrease = slower and safer
+    constexpr float straight_speed_factor = 3.0f;  // Target speed on straights as fraction of tile size; increase = faster on straights, decrease = more conservative
+    layout.racing_line.reserve(layout.waypoints.size());
+    for (std::size_t index = 0; index < layout.waypoints.size(); ++index) {
+        const std::size_t next_index = (index + 1) % layout.waypoints.size();
+        const std::size_t after_next_index = (index + 2) % layout.waypoints.size();
+        const TrackWaypoint &current_waypoint = layout.waypoints[index];
+        const TrackWaypoint &next_waypoint = layout.waypoints[next_index];
+
+        // Unit direction and length of this segment
+        sf::Vector2f direction = next_waypoint.position - current_waypoint.position;
+        const float length = std::hypot(direction.x, direction.y);
+        if (length > 0.f) [[likely]] {
+            direction /= length;
+        }
+
+        // Curvature: absolute turn angle between this segment and the following one
+        sf::Vector2f next_direction = layout.waypoints[after_next_index].position - next_waypoint.position;
+        const float next_length = std::hypot(next_direction.x, next_direction.y);
+        if (next_length > 0.f) [[likely]] {
+            next_direction /= next_length;
+        }
+        const float curvature = std::abs(std::atan2(direction.x * next_direction.y - direction.y * next_direction.x,
+                                                    direction.x * next_direction.x + direction.y * next_direction.y));
+
+        // Target speed drops in corner context (at a corner or about to enter one), mirroring what the AI used to derive per tick
+        const bool at_corner = current_waypoint.type == TrackWaypoint::DrivingType::Corner;
+        const bool approaching_corner = next_waypoint.type == TrackWaypoint::DrivingType::Corner;
+        const float target_speed = (at_corner || approaching_corner)
+                                       ? tile_size * corner_speed_factor
+                                       : tile_size * straight_speed_factor;
+
+        layout.racing_line.emplace_back(RacingLineSegment{
+            .direction = direction,
+            .length = length,
+            .curvature = curvature,
+            .target_speed = target_speed,
+            .at_corner = at_corner,
+            .approaching_corner = approaching_corner});
+    }
+    SPDLOG_DEBUG("Racing line with '{}' segments precomputed!", layout.racing_line.size());
+
+    // Bake the progress grid: every cell stores the continuous race progress (nearest segment index plus fractional projection along it) of its center
+    // Per-car progress tracking then becomes one cell lookup per step instead of distance computations against waypoints, and the fractional part orders cars exactly within a waypoint
+    {
+        layout.progress_grid_columns = layout.grid_columns * progress_cells_per_tile_;
+        layout.progress_grid_rows = layout.grid_rows * progress_cells_per_tile_;
+        layout.progress_grid_cell_size = tile_size / static_cast<float>(progress_cells_per_tile_);
+        layout.progress_grid.resize(layout.progress_grid_columns * layout.progress_grid_rows, 0.f);
+        for (std::size_t row = 0; row < layout.progress_grid_rows; ++row) {
+            for (std::size_t column = 0; column < layout.progress_grid_columns; ++column) {
+                const sf::Vector2f cell_center = layout.grid_origin + sf::Vector2f{(static_cast<float>(column) + 0.5f) * layout.progress_grid_cell_size,
+                                                                                   (static_cast<float>(row) + 0.5f) * layout.progress_grid_cell_size};
+
+                // Brute-force nearest-segment search; the clamped projection onto each segment gives both the distance and the fractional progress along it
+                // Strict less-than keeps the lower segment index on exact ties, so a shared endpoint always belongs to the earlier segment and the fraction stays below 1
+                float best_distance_squared = 1.0e18f;
+                float best_progress = 0.f;
+                for (std::size_t segment_index = 0; segment_index < layout.racing_line.size(); ++segment_index) {
+                    const RacingLineSegment &segment = layout.racing_line[segment_index];
+                    const sf::Vector2f to_cell = cell_center - layout.waypoints[segment_index].position;
+                    const float along = std::clamp(to_cell.x * segment.direction.x + to_cell.y * segment.direction.y, 0.f, segment.length);
+                    const sf::Vector2f nearest_point = layout.waypoints[segment_index].position + segment.direction * along;
+                    const sf::Vector2f difference = cell_center - nearest_point;
+                    const float distance_squared = difference.x * difference.x + difference.y * difference.y;
+                    if (distance_squared < best_distance_squared) {
+                        best_distance_squared = distance_squared;
+                        best_progress = static_cast<float>(segment_index) + ((segment.length > 0.f) ? along / segment.length : 0.f);
+                    }
+                }
+                layout.progress_grid[row * layout.progress_grid_columns + column] = best_progress;
+            }
+        }
+        SPDLOG_DEBUG("Progress grid of '{}x{}' cells ('{}' px per cell) baked for race progress tracking!", layout.progress_grid_columns, layout.progress_grid_rows, layout.progress_grid_cell_size);
+    }
 
     // Shrink containers
-    this->sprites_.shrink_to_fit();
-    this->waypoints_.shrink_to_fit();
-    this->collision_bounds_.shrink_to_fit();
-    SPDLOG_DEBUG("Track consisting of '{}' tiles built successfully!", this->sprites_.size());
+    layout.waypoints.shrink_to_fit();
+    layout.collision_bounds.shrink_to_fit();
+    layout.tile_descriptors.shrink_to_fit();
+    SPDLOG_DEBUG("Track consisting of '{}' tiles built successfully!", layout.collision_bounds.size());
+    return layout;
+}
+
+void Track::rescale(const float scale_factor)
+{
+    // The track is centered at the origin, so a uniform scale about the origin moves every tile to its new lattice position
+    const float tile_size = static_cast<float>(this->config_.size_px);
+
+    // Tile descriptors keep their types; only the world-space centers move
+    for (TileDescriptor &descriptor : this->tile_descriptors_) {
+        descriptor.center *= scale_factor;
+    }
+
+    // Materialized chunk geometry is stale at the new scale; it rebuilds lazily around the camera
+    this->chunk_cache_.clear();
+
+    // Collision bounds stay axis-aligned squares of the new tile size
+    for (sf::FloatRect &bounds : this->collision_bounds_) {
+        bounds.position *= scale_factor;
+        bounds.size = {tile_size, tile_size};
+    }
+
+    // Waypoints, finish point, and grid origin are plain world-space positions
+    for (TrackWaypoint &waypoint : this->waypoints_) {
+        waypoint.position *= scale_factor;
+    }
+    this->finish_point_ *= scale_factor;
+    this->grid_origin_ *= scale_factor;
+
+    // Racing line directions and curvatures are scale-invariant; only lengths and target speeds grow with the track
+    for (RacingLineSegment &segment : this->racing_line_) {
+        segment.length *= scale_factor;
+        segment.target_speed *= scale_factor;
+    }
+
+    // The distance field keeps its cell layout; only the stored distances and the cell size are in pixels and must scale
+    for (float &distance : this->distance_field_) {
+        distance *= scale_factor;
+    }
+    this->distance_field_cell_size_ *= scale_factor;
+
+    // Progress values are in waypoint units and thus scale-invariant; only the progress-grid cell size is in pixels
+    this->progress_grid_cell_size_ *= scale_factor;
+
+    // The tile index grid maps cells to tiles and is unaffected; cell size is derived from "config_.size_px" on every query
+    SPDLOG_DEBUG("Track rescaled in place by factor '{}', now '{}' px per tile!", scale_factor, this->config_.size_px);
 }
 
 }  // namespace core::world
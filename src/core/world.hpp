@@ -6,13 +6,20 @@
 
 #pragma once
 
-#include <cstddef>  // for std::size_t
-#include <cstdlib>  // for std::abs
-#include <random>   // for std::mt19937
-#include <vector>   // for std::vector
+#include <cstddef>        // for std::size_t
+#include <cstdint>        // for std::uint8_t, std::uint32_t, std::uint64_t
+#include <cstdlib>        // for std::abs
+#include <filesystem>     // for std::filesystem
+#include <future>         // for std::future
+#include <span>           // for std::span
+#include <unordered_map>  // for std::unordered_map
+#include <vector>         // for std::vector
 
 #include <SFML/Graphics.hpp>
 
+#include "memory.hpp"
+#include "rng.hpp"
+
 namespace core::world {
 
 /**
@@ -94,6 +101,73 @@ struct TrackWaypoint final {
     DrivingType type;
 };
 
+/**
+ * @brief Struct that represents one precomputed segment of the racing line, running from a waypoint to its successor.
+ *
+ * Segments are parallel to the waypoint sequence (segment "i" starts at waypoint "i"), so AI code indexed by waypoint can look up its segment directly. Everything in here is derived from the waypoints once per build, so per-tick AI logic becomes table lookups instead of recomputed geometry.
+ */
+struct RacingLineSegment final {
+    /**
+     * @brief Unit direction from this waypoint toward the next one.
+     */
+    sf::Vector2f direction;
+
+    /**
+     * @brief Distance to the next waypoint in pixels.
+     */
+    float length;
+
+    /**
+     * @brief Absolute turn angle in radians between this segment and the next one (e.g., "0.0" on straights, roughly pi/2 at corner tiles).
+     */
+    float curvature;
+
+    /**
+     * @brief Precomputed target speed in pixels per second for a car traversing this segment; lower in corner context, higher on straights.
+     */
+    float target_speed;
+
+    /**
+     * @brief True if the waypoint starting this segment is a corner.
+     */
+    bool at_corner;
+
+    /**
+     * @brief True if the next waypoint is a corner, i.e., the car should prepare to slow down and turn.
+     */
+    bool approaching_corner;
+};
+
+/**
+ * @brief Struct that represents one sample of the baked track boundary distance field.
+ */
+struct TrackBoundarySample final {
+    /**
+     * @brief Signed distance to the nearest track edge in pixels; positive inside the drivable area, negative outside (the magnitude is the penetration depth).
+     */
+    float signed_distance;
+
+    /**
+     * @brief Unit gradient of the distance field, pointing toward the track interior; the outward surface normal is its negation.
+     */
+    sf::Vector2f gradient;
+};
+
+/**
+ * @brief Result of a race progress query against the baked progress grid.
+ */
+struct TrackProgressSample final {
+    /**
+     * @brief Continuous race progress in waypoint units: the nearest segment's index plus the fractional projection along it, in "[0, waypoint count)".
+     */
+    float progress;
+
+    /**
+     * @brief Index of the racing-line segment nearest to the queried point; always equal to the integer part of "progress".
+     */
+    std::size_t segment;
+};
+
 /**
  * @brief Class that manages procedural generation, validation, and rendering of a race track.
  *
@@ -102,10 +176,27 @@ struct TrackWaypoint final {
 class Track final {
   public:
     /**
-     * @brief Parameter struct for the track textures. Holds references to the textures used to build the track.
+     * @brief Struct that represents a texture (or a sub-rectangle of a shared atlas texture) used for a single tile type.
+     */
+    struct TextureRegion final {
+        /**
+         * @brief Reference to the source texture.
+         *
+         * @note When regions of one atlas texture are used for all tile types, the whole track renders with a single texture bind.
+         */
+        const sf::Texture &texture;
+
+        /**
+         * @brief Pixel rectangle of the tile image within the texture.
+         */
+        sf::IntRect rect;
+    };
+
+    /**
+     * @brief Parameter struct for the track textures. Holds the texture regions used to build the track.
      *
-     * The caller is responsible for ensuring that these textures remain valid for the lifetime of the "Track" instance.
-     * It is assumed that all textures are square and of the same size (e.g., 256x256) for uniform scaling.
+     * The caller is responsible for ensuring that the referenced textures remain valid for the lifetime of the "Track" instance.
+     * It is assumed that all regions are square and of the same size (e.g., 256x256) for uniform scaling.
      */
     struct Textures final {
         /**
@@ -118,7 +209,7 @@ class Track final {
          * X
          * ```
          */
-        const sf::Texture &top_left;
+        TextureRegion top_left;
 
         /**
          * @brief Top-right curve texture.
@@ -130,7 +221,7 @@ class Track final {
          *   X
          * ```
          */
-        const sf::Texture &top_right;
+        TextureRegion top_right;
 
         /**
          * @brief Bottom-right curve texture.
@@ -142,7 +233,7 @@ class Track final {
          * XXX
          * ```
          */
-        const sf::Texture &bottom_right;
+        TextureRegion bottom_right;
 
         /**
          * @brief Bottom-left curve texture.
@@ -154,7 +245,7 @@ class Track final {
          * XXX
          * ```
          */
-        const sf::Texture &bottom_left;
+        TextureRegion bottom_left;
 
         /**
          * @brief [┃] Vertical road texture.
@@ -166,7 +257,7 @@ class Track final {
          *  X
          * ```
          */
-        const sf::Texture &vertical;
+        TextureRegion vertical;
 
         /**
          * @brief [━] Horizontal road texture.
@@ -178,7 +269,7 @@ class Track final {
          *
          * ```
          */
-        const sf::Texture &horizontal;
+        TextureRegion horizontal;
 
         /**
          * @brief [━] Horizontal finish line texture.
@@ -190,7 +281,7 @@ class Track final {
          *
          * ```
          */
-        const sf::Texture &horizontal_finish;
+        TextureRegion horizontal_finish;
     };
 
     /**
@@ -199,24 +290,32 @@ class Track final {
      * On construction, the track is automatically built using the provided configuration. The track will be ready for use immediately after construction.
      *
      * @param tiles Tiles struct containing the textures. It is assumed that all textures are square (e.g., 256x256) for uniform scaling. The caller is responsible for ensuring that these textures remain valid for the lifetime of the Track.
-     * @param rng Instance of a random number generator (e.g., std::mt19937) used for generating random detours.
+     * @param rng Instance of a random number generator used for generating random detours; typically a dedicated track-generation stream.
      * @param config Configuration struct containing the track configuration (invalid values will be clamped) (default: "TrackConfig()").
+     * @param cache_path Optional path to the binary layout cache file. If non-empty and the cached layout matches the build seed and configuration, the finished layout (tiles, collision data, waypoints, distance field) is bulk-loaded instead of regenerated; otherwise the freshly built layout is written back to this path. An empty path disables caching entirely (default: "{}").
      *
      * @details The textures MUST be copied to prevent segfaults.
+     *
+     * @note The textures are only dereferenced by "draw()", so a Track built from default-constructed textures is fully usable for headless simulation (see "src/headless.cpp").
      */
     explicit Track(const Textures tiles,  //  Copy to prevent segfault
-                   std::mt19937 &rng,
-                   const TrackConfig &config = TrackConfig());  // Use default config
+                   rng::Pcg32 &rng,
+                   const TrackConfig &config = TrackConfig(),  // Use default config
+                   const std::filesystem::path &cache_path = {});  // No cache by default
 
     /**
-     * @brief Get the current validated track configuration.
+     * @brief Get the latest requested validated track configuration.
      *
-     * @return Const reference to the current configuration.
+     * While a background rebuild is in flight, the drawn track may still reflect the previous configuration; this always returns the target of the most recent "set_config()" call, so UI widgets bound to it do not snap back mid-build.
+     *
+     * @return Const reference to the latest requested configuration.
      */
     [[nodiscard]] const TrackConfig &get_config() const;
 
     /**
-     * @brief Set the configuration (invalid values will be clamped), then build the track.
+     * @brief Set the configuration (invalid values will be clamped), then rebuild only what the change affects.
+     *
+     * The new configuration is diffed against the latest request: an unchanged configuration is a no-op and a pure tile-size change rescales the existing layout in place. Anything that changes the layout itself (tile counts or detour probability) is regenerated on a background thread while "draw()" keeps serving the current layout; call "poll()" once per frame to swap the new layout in when it is ready. This keeps dragging the track sliders in the settings panel from stalling the frame.
      *
      * @param config New configuration for the track; invalid values are clamped during validation.
      */
@@ -225,14 +324,32 @@ class Track final {
     /**
      * @brief Reset the track to use the default configuration.
      *
-     * This rebuilds the track using the default "TrackConfig", effectively restoring it to its initial state.
+     * This rebuilds the track using the default "TrackConfig", effectively restoring it to its initial state. Like "set_config()", the rebuild runs on a background thread and is swapped in by "poll()".
      */
     void reset();
 
+    /**
+     * @brief Rebuild the track with the current configuration and a fresh build seed drawn from the shared RNG stream.
+     *
+     * Like "set_config()", the rebuild runs on a background thread and is swapped in by "poll()". The layout is a pure function of the drawn seed, so a caller that re-seeds the track RNG stream first (as the settings UI does for explicit track codes) regenerates exactly the layout that seed encodes.
+     */
+    void regenerate();
+
+    /**
+     * @brief Swap in a background-built layout if one has finished, without blocking.
+     *
+     * If the configuration changed again while the layout was building, the stale result is discarded and a new build is launched with the latest request.
+     *
+     * @return True if a new layout was swapped in this call (callers should respawn cars, since the spawn point moved); false otherwise.
+     *
+     * @note Call this once per frame.
+     */
+    [[nodiscard]] bool poll();
+
     /**
      * @brief Check whether a given world-space point lies within any track tile boundary.
      *
-     * This performs a simple rectangular collision check against all track tile bounds using pre-cached collision rectangles. While it's technically possible to go outside curved tile shapes visually, this approach is simple and fast.
+     * This resolves the query via a uniform occupancy grid built during "build()", so the cost is a single cell lookup instead of a linear scan over all tile bounds. While it's technically possible to go outside curved tile shapes visually, this approach is simple and fast.
      *
      * @param world_position Coordinates in world space to test.
      *
@@ -240,14 +357,67 @@ class Track final {
      */
     [[nodiscard]] bool is_on_track(const sf::Vector2f &world_position) const;
 
+    /**
+     * @brief Sample the signed distance field of the track boundary at a world-space point.
+     *
+     * The field is baked over the track area during "build_layout()", so one bilinear lookup yields both the penetration depth and the surface normal for collision resolution; no per-tile scanning happens at query time. Coordinates outside the baked area clamp to the nearest edge sample.
+     *
+     * @param world_position Coordinates in world space to sample at.
+     *
+     * @return Signed distance (positive inside the track) and the unit gradient pointing toward the track interior.
+     */
+    [[nodiscard]] TrackBoundarySample sample_boundary(const sf::Vector2f &world_position) const;
+
+    /**
+     * @brief Sample the continuous race progress at a world-space point.
+     *
+     * The progress grid is baked over the track area during "build_layout()": every cell stores the racing-line segment nearest to its center plus the fractional projection along it, so per-car progress tracking costs one cell lookup instead of distance computations against waypoints. The value is continuous across the whole lap, which makes race ordering exact instead of quantized to whole waypoints.
+     *
+     * @param world_position Coordinates in world space to sample at.
+     *
+     * @return Continuous progress in waypoint units ("[0, waypoint count)") and the index of the nearest racing-line segment.
+     */
+    [[nodiscard]] TrackProgressSample sample_progress(const sf::Vector2f &world_position) const;
+
     /**
      * @brief Get the ordered sequence of waypoints.
      *
      * This is used for AI navigation around the track by following the waypoints sequentially.
      *
-     * @return Const reference to the vector of TrackWaypoint instances defining the racing line.
+     * @return Read-only view over the TrackWaypoint instances defining the racing line; copying the return value copies the view, never the array.
+     *
+     * @note The view is invalidated when "poll()" swaps in a rebuilt layout; consumers re-fetch it per frame, so none hold one across a rebuild.
      */
-    [[nodiscard]] const std::vector<TrackWaypoint> &get_waypoints() const;
+    [[nodiscard]] std::span<const TrackWaypoint> get_waypoints() const;
+
+    /**
+     * @brief Get the precomputed racing line segments, parallel to the waypoint sequence.
+     *
+     * Segment "i" runs from waypoint "i" to waypoint "i + 1" (wrapping at the end) and carries its unit direction, length, curvature, and target speed, so AI navigation can read ready-made values instead of recomputing them from raw waypoints every tick.
+     *
+     * @return Read-only view over the RacingLineSegment instances, one per waypoint; copying the return value copies the view, never the array.
+     *
+     * @note The view is invalidated when "poll()" swaps in a rebuilt layout; consumers re-fetch it per frame, so none hold one across a rebuild.
+     */
+    [[nodiscard]] std::span<const RacingLineSegment> get_racing_line() const;
+
+    /**
+     * @brief Get the world-space collision rectangle of every placed tile.
+     *
+     * Exposed for consumers that want the raw tile footprint (e.g., a minimap) without re-deriving it from the tile grid; per-point queries should keep using "is_on_track()", which resolves through the occupancy grid instead of scanning these.
+     *
+     * @return Read-only view over one axis-aligned rectangle per placed tile; copying the return value copies the view, never the array.
+     *
+     * @note The view is invalidated when "poll()" swaps in a rebuilt layout; consumers re-fetch it per frame, so none hold one across a rebuild.
+     */
+    [[nodiscard]] std::span<const sf::FloatRect> get_collision_bounds() const;
+
+    /**
+     * @brief Get the number of tiles drawn by the most recent "draw()" call.
+     *
+     * @return Number of tiles in the chunks drawn last frame; culling happens per chunk, so a partially visible chunk counts all of its tiles. Intended for telemetry and diagnostics.
+     */
+    [[nodiscard]] std::size_t get_last_drawn_tile_count() const;
 
     /**
      * @brief Get the world-space position of the finish line spawn point.
@@ -259,9 +429,20 @@ class Track final {
     [[nodiscard]] const sf::Vector2f &get_finish_position() const;
 
     /**
-     * @brief Draw all track tile sprites onto the provided render target.
+     * @brief Get the world-space rectangle covered by the track's tile grid.
+     *
+     * This spans every placed tile (including detours), so overlays sized to the track (e.g., the persistent skid mark layer) can cover it exactly.
      *
-     * @param target Target window where the track will be drawn.
+     * @return Axis-aligned rectangle enclosing all track tiles; zero-sized before the first build completes.
+     */
+    [[nodiscard]] sf::FloatRect get_world_bounds() const;
+
+    /**
+     * @brief Draw the visible track tiles onto the provided render target.
+     *
+     * The target's current view is used to cull at chunk granularity (blocks of "chunk_edge_tiles_" squared tiles): visible chunks have their vertex batches materialized on first use and reused from a cache on subsequent frames, and chunks the camera has left are evicted once the cache grows past its cap. Tiles are stored only as compact descriptors, so memory and per-frame cost stay proportional to the area near the camera, not the total track area.
+     *
+     * @param target Target window where the track will be drawn. The view assigned to the target determines which tiles are visible.
      *
      * @note Call this once per frame.
      */
@@ -288,13 +469,13 @@ class Track final {
     [[nodiscard]] static TrackConfig validate_config(const TrackConfig &config);
 
     /**
-     * @brief Build the track layout using the current configuration and textures.
+     * @brief Rescale the existing track layout in place after a tile-size-only configuration change.
      *
-     * This creates the complete track by placing corner tiles, horizontal/vertical edge tiles, and optional detour bubbles. It also generates collision bounds, waypoint sequences for AI navigation, and identifies the finish line position. Random detour bubbles are inserted on vertical edges according to detour probability, while horizontal edges remain straight.
+     * All world-space data (tile vertices, collision bounds, waypoints, finish point, grid origin) is multiplied by the scale factor; the tile layout, detours, and index grid are untouched. This is much cheaper than a full "build()" and keeps the same layout on screen, so scrubbing the size slider does not generate a new random track every tick.
      *
-     * @note This is marked as private, because we only want to build the track on construction and explicit config changes.
+     * @param scale_factor Ratio of the new tile size to the old tile size (e.g., "2.0" doubles the track dimensions).
      */
-    void build();
+    void rescale(const float scale_factor);
 
     /**
      * @brief Tile textures used for building the track.
@@ -310,7 +491,7 @@ class Track final {
      *
      * This determines random detour placement along vertical track edges according to the configured detour probability. Each edge segment uses this RNG to decide whether to generate a detour bubble.
      */
-    std::mt19937 &rng_;
+    rng::Pcg32 &rng_;
 
     /**
      * @brief Current validated track configuration.
@@ -320,11 +501,279 @@ class Track final {
     TrackConfig config_;
 
     /**
-     * @brief Collection of sprite objects for each tile in the track layout.
+     * @brief Batch of tile quads sharing a single source texture.
+     *
+     * All tiles using the same texture are collected into one vertex array (two triangles per tile, since SFML 3 removed quads), so the whole batch is submitted as a single draw call.
+     */
+    struct TileBatch final {
+        /**
+         * @brief Source texture shared by all tiles in this batch.
+         *
+         * @note This points into "tiles_", which outlives the batches.
+         */
+        const sf::Texture *texture;
+
+        /**
+         * @brief Textured triangle vertices for all tiles using this texture.
+         */
+        sf::VertexArray vertices;
+    };
+
+    /**
+     * @brief Tile type, identifying which texture region from "Textures" a tile renders with.
+     */
+    enum class TileType : std::uint8_t {
+        TopLeft,
+        TopRight,
+        BottomRight,
+        BottomLeft,
+        Vertical,
+        Horizontal,
+        HorizontalFinish
+    };
+
+    /**
+     * @brief Compact description of a single placed tile: its world-space center and tile type.
+     *
+     * Vertex data is not stored per tile; it is materialized per chunk on demand by "draw()", so the per-tile memory cost stays a few bytes no matter how large the track is.
+     */
+    struct TileDescriptor final {
+        /**
+         * @brief World-space center of the tile.
+         */
+        sf::Vector2f center;
+
+        /**
+         * @brief Tile type, resolved to a texture region at materialization time.
+         */
+        TileType type;
+    };
+
+    /**
+     * @brief Materialized render geometry of one chunk of tiles, built on demand and evicted when the camera moves away.
+     */
+    struct ChunkGeometry final {
+        /**
+         * @brief Batches covering the chunk's tiles, one per distinct source texture (a single batch when the tiles share an atlas).
+         */
+        std::vector<TileBatch> batches;
+
+        /**
+         * @brief Number of tiles baked into this chunk; feeds "last_drawn_tile_count_".
+         */
+        std::size_t tile_count = 0;
+
+        /**
+         * @brief Value of "draw_counter_" the last time this chunk was drawn; stale chunks are evicted when the cache grows past its cap.
+         */
+        std::uint64_t last_used_frame = 0;
+    };
+
+    /**
+     * @brief Complete generated track layout: everything "build_layout()" produces and "apply_layout()" swaps in.
+     *
+     * Bundling the layout into one struct lets a background thread generate a new track into a second buffer while the members below keep serving "draw()" and "is_on_track()".
+     */
+    struct Layout final {
+        /**
+         * @brief Validated configuration this layout was generated from.
+         */
+        TrackConfig config;
+
+        /**
+         * @brief Compact per-tile descriptors in placement order, matching "collision_bounds".
+         */
+        std::vector<TileDescriptor> tile_descriptors;
+
+        /**
+         * @brief Axis-aligned collision rectangle of each tile, in placement order.
+         */
+        std::vector<sf::FloatRect> collision_bounds;
+
+        /**
+         * @brief Uniform grid mapping each cell to the covering tile index, or "no_tile_index_" for empty cells.
+         */
+        std::vector<std::uint32_t> tile_index_grid;
+
+        /**
+         * @brief World-space position of the top-left corner of the grid.
+         */
+        sf::Vector2f grid_origin = {0.f, 0.f};
+
+        /**
+         * @brief Number of columns in the grid.
+         */
+        std::size_t grid_columns = 0;
+
+        /**
+         * @brief Number of rows in the grid.
+         */
+        std::size_t grid_rows = 0;
+
+        /**
+         * @brief Signed distance to the track edge per distance-field cell, in pixels; positive inside the track.
+         */
+        memory::TrackedVector<float, memory::Tag::World> distance_field;
+
+        /**
+         * @brief Number of columns in the distance field.
+         */
+        std::size_t distance_field_columns = 0;
+
+        /**
+         * @brief Number of rows in the distance field.
+         */
+        std::size_t distance_field_rows = 0;
+
+        /**
+         * @brief Edge length of a distance-field cell, in pixels.
+         */
+        float distance_field_cell_size = 0.f;
+
+        /**
+         * @brief Ordered waypoint sequence, starting from the finish line.
+         */
+        std::vector<TrackWaypoint> waypoints;
+
+        /**
+         * @brief Precomputed racing line segments, parallel to "waypoints".
+         */
+        std::vector<RacingLineSegment> racing_line;
+
+        /**
+         * @brief Continuous race progress per progress-grid cell, in waypoint units.
+         */
+        memory::TrackedVector<float, memory::Tag::World> progress_grid;
+
+        /**
+         * @brief Number of columns in the progress grid.
+         */
+        std::size_t progress_grid_columns = 0;
+
+        /**
+         * @brief Number of rows in the progress grid.
+         */
+        std::size_t progress_grid_rows = 0;
+
+        /**
+         * @brief Edge length of a progress-grid cell, in pixels.
+         */
+        float progress_grid_cell_size = 0.f;
+
+        /**
+         * @brief Center position of the finish-line tile.
+         */
+        sf::Vector2f finish_point = {0.f, 0.f};
+    };
+
+    /**
+     * @brief Generate a complete track layout from the given configuration and textures.
+     *
+     * This creates the complete track by placing corner tiles, horizontal/vertical edge tiles, and optional detour bubbles. It also generates collision bounds, waypoint sequences for AI navigation, and identifies the finish line position. Random detour bubbles are inserted on vertical edges according to detour probability, while horizontal edges remain straight. Tiles are recorded as compact descriptors only; no vertex data or textures are touched, so the build cost is independent of rendering.
+     *
+     * @param config Validated configuration to generate the layout from.
+     * @param rng Private random number generator for this build, seeded by the caller; passed by value so the build never touches shared state.
+     *
+     * @return Freshly generated layout, ready for "apply_layout()".
+     *
+     * @note This is static and side-effect free on purpose, so it can run on a background thread while the current layout keeps being drawn.
+     */
+    [[nodiscard]] static Layout build_layout(const TrackConfig config,
+                                             rng::Pcg32 rng);
+
+    /**
+     * @brief Move a generated layout into the active members serving "draw()" and "is_on_track()".
+     *
+     * @param layout Layout to consume; also updates the active configuration.
+     */
+    void apply_layout(Layout &&layout);
+
+    /**
+     * @brief Launch a background build of "requested_config_" via "std::async".
+     */
+    void start_pending_build();
+
+    /**
+     * @brief Try to bulk-load a previously cached layout and swap it in via "apply_layout()".
+     *
+     * The cache is only used when its magic bytes, build seed, and configuration all match; anything else (including a truncated or corrupt file) is treated as a miss, so the caller falls back to a regular build.
+     *
+     * @param file_path File to read, as written by "save_cache()".
+     * @param expected_seed Build seed the cached layout must have been generated from.
+     *
+     * @return True if the cached layout was loaded and applied; false on any mismatch or read failure.
+     */
+    [[nodiscard]] bool try_load_cache(const std::filesystem::path &file_path,
+                                      const std::uint32_t expected_seed);
+
+    /**
+     * @brief Serialize the active layout to a compact binary cache file.
+     *
+     * Everything "apply_layout()" consumes (tile descriptors, collision bounds, index grid, distance field, waypoints, racing line, finish point) is written little-endian behind a magic/seed/config header, so the next startup with the same seed and configuration can skip generation entirely.
+     *
+     * @param file_path File to write; parent directories are created as needed.
+     * @param seed Build seed the active layout was generated from.
+     */
+    void save_cache(const std::filesystem::path &file_path,
+                    const std::uint32_t seed) const;
+
+    /**
+     * @brief Resolve a tile type to its texture region in "tiles_".
+     *
+     * @param type Tile type to resolve.
+     *
+     * @return Const reference to the matching texture region.
+     */
+    [[nodiscard]] const TextureRegion &region_for(const TileType type) const;
+
+    /**
+     * @brief Materialize the render geometry of one chunk from its tile descriptors.
+     *
+     * This walks the chunk's cells in the tile index grid, builds two textured triangles per placed tile, and groups them into one batch per distinct source texture.
+     *
+     * @param chunk_column Chunk column (in chunks, not cells).
+     * @param chunk_row Chunk row (in chunks, not cells).
+     *
+     * @return Freshly built chunk geometry; empty batches if the chunk contains no tiles.
+     */
+    [[nodiscard]] ChunkGeometry build_chunk_geometry(const std::size_t chunk_column,
+                                                     const std::size_t chunk_row) const;
+
+    /**
+     * @brief Compact per-tile descriptors built during "build_layout()", indexed by the tile index grid.
+     *
+     * Entries are in placement order, matching "collision_bounds_". Render geometry is not kept per tile; "draw()" materializes it per chunk around the camera.
+     */
+    std::vector<TileDescriptor> tile_descriptors_;
+
+    /**
+     * @brief Number of tiles along each edge of a chunk.
+     *
+     * 8x8 tiles per chunk keeps a handful of chunks resident at typical zoom while making a chunk rebuild (at most 64 quads) far too cheap to notice when the camera crosses a boundary.
+     */
+    static constexpr std::size_t chunk_edge_tiles_ = 8;
+
+    /**
+     * @brief Maximum number of chunks kept materialized.
      *
-     * This contains all track tile sprites positioned and scaled according to the track configuration. Sprites are created during track building and ready for rendering each frame.
+     * When the cache grows past this, chunks not drawn in the current frame are evicted, so memory stays proportional to the area near the camera instead of the whole track.
+     */
+    static constexpr std::size_t max_cached_chunks_ = 64;
+
+    /**
+     * @brief Materialized chunks keyed by "chunk_row * chunk_columns + chunk_column"; marked mutable so "draw()" stays const while maintaining the cache.
+     */
+    mutable std::unordered_map<std::size_t, ChunkGeometry> chunk_cache_;
+
+    /**
+     * @brief Monotonic "draw()" call counter used to stamp chunk usage for eviction; marked mutable for the same reason as "chunk_cache_".
      */
-    std::vector<sf::Sprite> sprites_;
+    mutable std::uint64_t draw_counter_ = 0;
+
+    /**
+     * @brief Number of tiles drawn by the most recent "draw()" call; marked mutable for the same reason as "chunk_cache_".
+     */
+    mutable std::size_t last_drawn_tile_count_ = 0;
 
     /**
      * @brief Axis-aligned bounding rectangles used for collision detection against each sprite.
@@ -335,6 +784,62 @@ class Track final {
      */
     std::vector<sf::FloatRect> collision_bounds_;
 
+    /**
+     * @brief Sentinel value in "tile_index_grid_" marking a cell that is not covered by any tile.
+     */
+    static constexpr std::uint32_t no_tile_index_ = static_cast<std::uint32_t>(-1);
+
+    /**
+     * @brief Uniform grid mapping each cell to the index of the tile covering it, or "no_tile_index_" for empty cells.
+     *
+     * Tiles are axis-aligned squares of "config_.size_px" placed on a regular lattice, so each tile covers exactly one grid cell. The grid doubles as the O(1) collision index for "is_on_track()" and the culling index for "draw()".
+     */
+    std::vector<std::uint32_t> tile_index_grid_;
+
+    /**
+     * @brief World-space position of the top-left corner of the occupancy grid.
+     */
+    sf::Vector2f grid_origin_ = {0.f, 0.f};
+
+    /**
+     * @brief Number of columns in the occupancy grid.
+     */
+    std::size_t grid_columns_ = 0;
+
+    /**
+     * @brief Number of rows in the occupancy grid.
+     */
+    std::size_t grid_rows_ = 0;
+
+    /**
+     * @brief Number of distance-field cells along each edge of a tile.
+     *
+     * Higher values capture the boundary shape more precisely at the cost of bake time and memory; 8 cells keep the field coarse but smooth enough for believable wall normals after bilinear filtering.
+     */
+    static constexpr std::size_t distance_field_cells_per_tile_ = 8;
+
+    /**
+     * @brief Signed distance to the track edge per distance-field cell, in pixels; positive inside the track.
+     *
+     * Baked by "build_layout()" with a two-pass chamfer transform over the occupancy grid; "sample_boundary()" filters it bilinearly.
+     */
+    memory::TrackedVector<float, memory::Tag::World> distance_field_;
+
+    /**
+     * @brief Number of columns in the distance field.
+     */
+    std::size_t distance_field_columns_ = 0;
+
+    /**
+     * @brief Number of rows in the distance field.
+     */
+    std::size_t distance_field_rows_ = 0;
+
+    /**
+     * @brief Edge length of a distance-field cell, in pixels.
+     */
+    float distance_field_cell_size_ = 0.f;
+
     /**
      * @brief Ordered sequence of waypoints defining the AI navigation path around the track.
      *
@@ -342,12 +847,65 @@ class Track final {
      */
     std::vector<TrackWaypoint> waypoints_;
 
+    /**
+     * @brief Precomputed racing line segments, parallel to "waypoints_".
+     *
+     * Rebuilt with the waypoints during "build_layout()" and rescaled alongside them; AI navigation reads these instead of deriving directions and target speeds from raw waypoints every tick.
+     */
+    std::vector<RacingLineSegment> racing_line_;
+
+    /**
+     * @brief Number of progress-grid cells along each edge of a tile.
+     *
+     * The grid only has to resolve which racing-line segment a car is on, not the boundary shape, so it can stay much coarser than the distance field; 4 cells per tile pin every on-track position to the correct segment while keeping the bake and the cache small.
+     */
+    static constexpr std::size_t progress_cells_per_tile_ = 4;
+
+    /**
+     * @brief Continuous race progress per progress-grid cell, in waypoint units (nearest segment index plus fractional projection along it).
+     *
+     * Baked by "build_layout()" with a brute-force nearest-segment search per cell; "sample_progress()" reads single cells without filtering, because progress wraps at the finish line and interpolating across that seam would blend a full lap's difference.
+     */
+    memory::TrackedVector<float, memory::Tag::World> progress_grid_;
+
+    /**
+     * @brief Number of columns in the progress grid.
+     */
+    std::size_t progress_grid_columns_ = 0;
+
+    /**
+     * @brief Number of rows in the progress grid.
+     */
+    std::size_t progress_grid_rows_ = 0;
+
+    /**
+     * @brief Edge length of a progress-grid cell, in pixels.
+     */
+    float progress_grid_cell_size_ = 0.f;
+
     /**
      * @brief Center position of the finish-line sprite, used as a spawn point for vehicles.
      *
      * This contains the world coordinates of the finish line tile center where cars are initially placed. Set during track building when the finish line tile is positioned on the top edge.
      */
     sf::Vector2f finish_point_ = {0.f, 0.f};
+
+    /**
+     * @brief Future holding the layout being generated on a background thread, if any.
+     */
+    std::future<Layout> pending_layout_;
+
+    /**
+     * @brief Configuration targeted by the most recent rebuild request.
+     *
+     * Equal to "config_" whenever no build is in flight; "get_config()" returns this so UI widgets track the latest request instead of snapping back mid-build.
+     */
+    TrackConfig requested_config_;
+
+    /**
+     * @brief True while a background build is in flight; checked by "poll()".
+     */
+    bool build_pending_ = false;
 };
 
 }  // namespace core::world
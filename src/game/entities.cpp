@@ -2,179 +2,435 @@
  * @file entities.cpp
  */
 
-#include <algorithm>  // for std::clamp, std::max, std::min, std::erase_if
+#include <algorithm>  // for std::clamp, std::max, std::min, std::ranges::stable_sort
 #include <array>      // for std::array
-#include <cmath>      // for std::atan2, std::hypot, std::remainder, std::copysign, std::cos, std::sin, std::lerp
+#include <cmath>      // for std::copysign, std::floor, std::fmod, std::lerp, std::sqrt
 #include <cstddef>    // for std::size_t
-#include <cstdint>    // for std::uint8_t
+#include <cstdint>    // for std::uint8_t, std::uint32_t, std::uint64_t
 #include <cstdlib>    // for std::abs
-#include <numbers>    // for std::numbers
-#include <random>     // for std::mt19937, std::uniform_real_distribution
+#include <utility>    // for std::move
 
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Angle.hpp>
 #include <spdlog/spdlog.h>
 
+#include "core/math.hpp"   // Fast sincos/atan2/length kernels; libm accuracy is wasted at per-tick simulation scale
 #include "core/world.hpp"  // We depend on the Track class for car collision detection and waypoints
 #include "entities.hpp"
+#include "rng.hpp"         // Small per-car RNG streams, so parallel car updates never share a generator
 #include "settings.hpp"
 
 namespace game::entities {
 
-Car::Car(const sf::Texture &texture,
-         std::mt19937 &rng,
-         const core::world::Track &track,
-         const CarControlMode control_mode,
-         const CarConfig &config)
-    : sprite_(texture),
-      shadow_sprite_(texture),
-      track_(track),
-      config_(config),
-      rng_(rng),
-      control_mode_(control_mode)
+CarPhysicsSystem::CarPhysicsSystem(core::rng::Pcg32 &rng,
+                                   const core::world::Track &track)
+    : track_(track),
+      seed_rng_(rng)
 {
-    this->sprite_.setOrigin(this->sprite_.getLocalBounds().getCenter());
-
-    // Setup shadow sprite
-    this->shadow_sprite_.setOrigin(this->shadow_sprite_.getLocalBounds().getCenter());
-    this->shadow_sprite_.setColor({0, 0, 0, 80});  // Semi-transparent black shadow
-    this->shadow_sprite_.setScale({0.9f, 0.9f});   // Slightly smaller than the car
+}
 
-    this->reset();
+std::size_t CarPhysicsSystem::create_car(const CarControlMode control_mode,
+                                         const CarConfig &config)
+{
+    const std::size_t car_index = this->positions_.size();
+
+    // Append one slot to every parallel array; the values are filled in by "reset_car()" below
+    this->configs_.emplace_back(config);
+    this->control_modes_.emplace_back(control_mode);
+    this->inputs_.emplace_back();
+    this->positions_.emplace_back();
+    this->previous_positions_.emplace_back();
+    this->velocities_.emplace_back();
+    this->headings_radians_.emplace_back(0.0f);
+    this->previous_headings_radians_.emplace_back(0.0f);
+    this->steering_wheel_angles_degrees_.emplace_back(0.0f);
+    this->drift_scores_.emplace_back(0.0f);
+    this->lateral_slip_velocities_.emplace_back(0.0f);
+    this->last_wall_hit_speeds_.emplace_back(0.0f);
+    this->just_hit_wall_flags_.emplace_back(0);
+    this->waypoint_indices_.emplace_back(1);
+    this->waypoints_passed_.emplace_back(0);
+    this->race_progress_.emplace_back(0.0f);
+    this->lap_counts_.emplace_back(0);
+    this->current_lap_times_.emplace_back(0.0f);
+    this->last_lap_times_.emplace_back(0.0f);
+    this->best_lap_times_.emplace_back(0.0f);
+    this->sector_times_.emplace_back();
+    this->ai_update_timers_.emplace_back(CarPhysicsSystem::ai_phase_offset(car_index));
+
+    // Give the car its own RNG stream, so disjoint index ranges can be updated from different threads without sharing a generator
+    this->rngs_.emplace_back(core::rng::Pcg32{this->seed_rng_.next(), car_index});
+
+    this->reset_car(car_index);
+
+    // The grid changed, so the standings arrays are rebuilt from scratch; this only happens on car creation, never per frame
+    this->rebuild_standings();
+    return car_index;
 }
 
-void Car::reset()
+void CarPhysicsSystem::reset_car(const std::size_t car_index)
 {
     // Get spawn position from track
     const sf::Vector2f spawn_position = this->track_.get_finish_position();
 
-    // Place sprite at spawn position
-    this->sprite_.setPosition(spawn_position);
+    // Place car at spawn position
+    this->positions_[car_index] = spawn_position;
 
     // Point car downward initially (towards first waypoint if available)
     const auto waypoints = this->track_.get_waypoints();
     if (!waypoints.empty() && waypoints.size() > 1) {
         const sf::Vector2f direction_to_first_waypoint = waypoints[1].position - spawn_position;
-        const float initial_heading_radians = std::atan2(direction_to_first_waypoint.y, direction_to_first_waypoint.x);
-        this->sprite_.setRotation(sf::radians(initial_heading_radians));
+        this->headings_radians_[car_index] = core::math::fast_atan2(direction_to_first_waypoint.y, direction_to_first_waypoint.x);
     }
     else {
         // Default downward orientation if no waypoints available
-        this->sprite_.setRotation(sf::degrees(90.0f));
+        this->headings_radians_[car_index] = sf::degrees(90.0f).asRadians();
     }
 
     // Clear all physics state
-    this->velocity_ = {0.0f, 0.0f};
-    this->steering_wheel_angle_ = 0.0f;
-    this->current_input_ = {};  // Reset input values
-    this->last_position_ = spawn_position;
+    this->velocities_[car_index] = {0.0f, 0.0f};
+    this->steering_wheel_angles_degrees_[car_index] = 0.0f;
+    this->inputs_[car_index] = {};  // Reset input values
+
+    // Sync the render interpolation snapshot to the spawn transform, so the first drawn frame does not interpolate from a stale position
+    this->previous_positions_[car_index] = spawn_position;
+    this->previous_headings_radians_[car_index] = this->headings_radians_[car_index];
 
-    // Reset AI state
-    this->current_waypoint_index_number_ = 1;
-    this->ai_update_timer_ = 0.0f;
+    // Reset AI state; the timer restarts at the car's phase offset so resets do not re-align every car's AI tick into the same frame
+    this->waypoint_indices_[car_index] = 1;
+    this->ai_update_timers_[car_index] = CarPhysicsSystem::ai_phase_offset(car_index);
 
     // Reset drift score
-    this->drift_score_ = 0.0f;
+    this->drift_scores_[car_index] = 0.0f;
+
+    // Reset race progress and lap timing
+    this->waypoints_passed_[car_index] = 0;
+    this->race_progress_[car_index] = 0.0f;
+    this->lap_counts_[car_index] = 0;
+    this->current_lap_times_[car_index] = 0.0f;
+    this->last_lap_times_[car_index] = 0.0f;
+    this->best_lap_times_[car_index] = 0.0f;
+    this->sector_times_[car_index] = {};
 
     // Reset lateral slip velocity
-    this->current_lateral_slip_velocity_ = 0.0f;
+    this->lateral_slip_velocities_[car_index] = 0.0f;
 
     // Reset collision state
-    this->just_hit_wall_ = false;
-    this->last_wall_hit_speed_ = 0.0f;
+    this->just_hit_wall_flags_[car_index] = 0;
+    this->last_wall_hit_speeds_[car_index] = 0.0f;
 }
 
-[[nodiscard]] CarState Car::get_state() const
+void CarPhysicsSystem::place_car_at_waypoint(const std::size_t car_index,
+                                             const std::size_t waypoint_index)
+{
+    // Start from a clean spawn state, then move the car onto the requested waypoint
+    this->reset_car(car_index);
+
+    const auto &waypoints = this->track_.get_waypoints();
+    if (waypoints.empty()) [[unlikely]] {
+        // No waypoint line yet; the spawn placement from the reset is the best we can do
+        return;
+    }
+
+    const std::size_t index = waypoint_index % waypoints.size();
+    const std::size_t next_index = (index + 1) % waypoints.size();
+    const sf::Vector2f position = waypoints[index].position;
+    const sf::Vector2f to_next = waypoints[next_index].position - position;
+
+    this->positions_[car_index] = position;
+    this->headings_radians_[car_index] = core::math::fast_atan2(to_next.y, to_next.x);
+
+    // Sync the render interpolation snapshot, so the first drawn frame does not interpolate from the spawn point
+    this->previous_positions_[car_index] = position;
+    this->previous_headings_radians_[car_index] = this->headings_radians_[car_index];
+
+    // Aim the AI at the waypoint the car is now facing
+    this->waypoint_indices_[car_index] = next_index;
+
+    // Credit the waypoints behind the placement, so the initial standings reflect the grid spread instead of treating every car as tied at zero
+    this->waypoints_passed_[car_index] = index;
+    this->race_progress_[car_index] = static_cast<float>(index);
+}
+
+void CarPhysicsSystem::remove_last_car()
 {
-    // Calculate heading angle from sprite rotation
-    const float heading_radians = this->sprite_.getRotation().asRadians();
+    if (this->positions_.empty()) [[unlikely]] {
+        return;
+    }
+
+    // Shrink every parallel array by one slot, mirroring the appends in "create_car()"
+    this->configs_.pop_back();
+    this->control_modes_.pop_back();
+    this->inputs_.pop_back();
+    this->positions_.pop_back();
+    this->previous_positions_.pop_back();
+    this->velocities_.pop_back();
+    this->headings_radians_.pop_back();
+    this->previous_headings_radians_.pop_back();
+    this->steering_wheel_angles_degrees_.pop_back();
+    this->drift_scores_.pop_back();
+    this->lateral_slip_velocities_.pop_back();
+    this->last_wall_hit_speeds_.pop_back();
+    this->just_hit_wall_flags_.pop_back();
+    this->waypoint_indices_.pop_back();
+    this->waypoints_passed_.pop_back();
+    this->race_progress_.pop_back();
+    this->lap_counts_.pop_back();
+    this->current_lap_times_.pop_back();
+    this->last_lap_times_.pop_back();
+    this->best_lap_times_.pop_back();
+    this->sector_times_.pop_back();
+    this->ai_update_timers_.pop_back();
+    this->rngs_.pop_back();
+
+    // The removed index may still be referenced by the standings arrays, so rebuild them; this only happens on grid shrink, never per frame
+    this->rebuild_standings();
+}
 
+[[nodiscard]] CarState CarPhysicsSystem::get_state(const std::size_t car_index) const
+{
     return CarState{
-        .position = this->sprite_.getPosition(),
-        .velocity = this->velocity_,
-        .speed = std::hypot(this->velocity_.x, this->velocity_.y),
-        .heading_radians = heading_radians,
-        .lateral_slip_velocity = this->current_lateral_slip_velocity_,
-        .steering_angle = this->steering_wheel_angle_,
-        .control_mode = this->control_mode_,
-        .waypoint_index = this->current_waypoint_index_number_,
-        .drift_score = this->drift_score_,
-        .just_hit_wall = this->just_hit_wall_,
-        .last_wall_hit_speed = this->last_wall_hit_speed_};
+        .position = this->positions_[car_index],
+        .velocity = this->velocities_[car_index],
+        .speed = core::math::fast_length(this->velocities_[car_index].x, this->velocities_[car_index].y),
+        .heading_radians = this->headings_radians_[car_index],
+        .lateral_slip_velocity = this->lateral_slip_velocities_[car_index],
+        .steering_angle = this->steering_wheel_angles_degrees_[car_index],
+        .control_mode = this->control_modes_[car_index],
+        .waypoint_index = this->waypoint_indices_[car_index],
+        .drift_score = this->drift_scores_[car_index],
+        .lap = this->lap_counts_[car_index],
+        .current_lap_time = this->current_lap_times_[car_index],
+        .last_lap_time = this->last_lap_times_[car_index],
+        .best_lap_time = this->best_lap_times_[car_index],
+        .sector_times = this->sector_times_[car_index],
+        .race_position = this->race_positions_[car_index] + 1,
+        .just_hit_wall = this->just_hit_wall_flags_[car_index] != 0,
+        .last_wall_hit_speed = this->last_wall_hit_speeds_[car_index]};
 }
 
-void Car::set_control_mode(const CarControlMode control_mode)
+void CarPhysicsSystem::set_control_mode(const std::size_t car_index,
+                                        const CarControlMode control_mode)
 {
-    this->control_mode_ = control_mode;
+    this->control_modes_[car_index] = control_mode;
 }
 
-void Car::apply_input(const CarInput &input)
+void CarPhysicsSystem::apply_input(const std::size_t car_index,
+                                   const CarInput &input)
 {
     // Only store input values when in Player mode, ignore in AI mode
-    if (this->control_mode_ == CarControlMode::Player) {
-        this->current_input_ = input;
+    if (this->control_modes_[car_index] == CarControlMode::Player) {
+        this->inputs_[car_index] = input;
         // Uncomment when debugging controller input or whatever
         // SPDLOG_DEBUG("Applying input: throttle = {:.2f}, brake = {:.2f}, steering = {:.2f}, handbrake = {:.2f}",
         //              input.throttle, input.brake, input.steering, input.handbrake);
     }
 }
 
-void Car::update(const float dt)
+void CarPhysicsSystem::update(const float dt)
 {
-    // Update waypoint tracking for all cars to maintain race position
-    this->update_waypoint_tracking();
+    this->update_range(0, this->positions_.size(), dt);
+    this->resolve_car_collisions();
+    this->update_standings();
+}
 
-    // Handle AI behavior if in AI mode
-    if (this->control_mode_ == CarControlMode::AI) {
-        this->update_ai_behavior(dt);
+void CarPhysicsSystem::update_range(const std::size_t first_car_index,
+                                    const std::size_t last_car_index,
+                                    const float dt)
+{
+    // Snapshot the current transforms before stepping physics, so rendering can interpolate between the previous and current states; this is a tight copy over contiguous arrays
+    for (std::size_t car_index = first_car_index; car_index < last_car_index; ++car_index) {
+        this->previous_positions_[car_index] = this->positions_[car_index];
+        this->previous_headings_radians_[car_index] = this->headings_radians_[car_index];
     }
 
-    // Apply physics regardless of control mode
-    this->apply_physics_step(dt);
+    for (std::size_t car_index = first_car_index; car_index < last_car_index; ++car_index) {
+        // Update waypoint tracking, lap timing, and race progress for all cars
+        this->update_waypoint_tracking(car_index, dt);
 
-    // Update shadow sprite position and rotation to match main sprite (with offset)
-    this->shadow_sprite_.setPosition({this->sprite_.getPosition().x + 10.0f,
-                                      this->sprite_.getPosition().y + 10.0f});
-    this->shadow_sprite_.setRotation(this->sprite_.getRotation());
+        // Handle AI behavior if in AI mode
+        if (this->control_modes_[car_index] == CarControlMode::AI) {
+            this->update_ai_behavior(car_index, dt);
+        }
+
+        // Apply physics regardless of control mode
+        this->apply_physics_step(car_index, dt);
+    }
 }
 
-void Car::draw(sf::RenderTarget &target) const
+void CarPhysicsSystem::resolve_car_collisions()
 {
-    // Draw tire marks first (so they appear behind everything)
-    for (const auto &tire_mark : this->tire_marks_) {
-        target.draw(tire_mark.circle);
+    const std::size_t car_count = this->positions_.size();
+    if (car_count < 2) [[unlikely]] {
+        return;
     }
 
-    // Draw shadow (behind the car but above tire marks)
-    target.draw(this->shadow_sprite_);
+    // Map a world position to a spatial hash bucket; the primes decorrelate the cell coordinates and the mask replaces a modulo (bucket count is a power of two)
+    const auto bucket_of = [](const float x, const float y) -> std::size_t {
+        const auto cell_x = static_cast<long long>(std::floor(x / collision_cell_size_pixels_));
+        const auto cell_y = static_cast<long long>(std::floor(y / collision_cell_size_pixels_));
+        const auto hash = static_cast<std::size_t>(cell_x * 73856093LL) ^ static_cast<std::size_t>(cell_y * 19349663LL);
+        return hash & (collision_bucket_count_ - 1);
+    };
+
+    // Broadphase: rebuild the bucket lists from scratch; both arrays are reused across steps, so this allocates only when the car count grows
+    this->collision_cell_heads_.assign(collision_bucket_count_, collision_invalid_index_);
+    this->collision_next_indices_.assign(car_count, collision_invalid_index_);
+    for (std::size_t car_index = 0; car_index < car_count; ++car_index) {
+        const std::size_t bucket = bucket_of(this->positions_[car_index].x, this->positions_[car_index].y);
+        this->collision_next_indices_[car_index] = this->collision_cell_heads_[bucket];
+        this->collision_cell_heads_[bucket] = car_index;
+    }
 
-    // Draw the actual car on top of everything
-    target.draw(this->sprite_);
+    // Narrowphase: each car only tests the cars in its own and the 8 neighboring cells
+    for (std::size_t car_index = 0; car_index < car_count; ++car_index) {
+        sf::Vector2f position = this->positions_[car_index];
+        const float radius = this->configs_[car_index].car_collision_radius_pixels;
+
+        // Distinct hash cells can collide into the same bucket, so collect the neighborhood's buckets and skip duplicates to avoid resolving a pair twice
+        std::array<std::size_t, 9> buckets;
+        std::size_t bucket_count = 0;
+        for (int offset_y = -1; offset_y <= 1; ++offset_y) {
+            for (int offset_x = -1; offset_x <= 1; ++offset_x) {
+                const std::size_t bucket = bucket_of(position.x + static_cast<float>(offset_x) * collision_cell_size_pixels_,
+                                                     position.y + static_cast<float>(offset_y) * collision_cell_size_pixels_);
+                bool seen = false;
+                for (std::size_t i = 0; i < bucket_count; ++i) {
+                    if (buckets[i] == bucket) {
+                        seen = true;
+                        break;
+                    }
+                }
+                if (!seen) {
+                    buckets[bucket_count++] = bucket;
+                }
+            }
+        }
+
+        for (std::size_t bucket_slot = 0; bucket_slot < bucket_count; ++bucket_slot) {
+            for (std::size_t other_index = this->collision_cell_heads_[buckets[bucket_slot]];
+                 other_index != collision_invalid_index_;
+                 other_index = this->collision_next_indices_[other_index]) {
+                // Process each pair once
+                if (other_index <= car_index) {
+                    continue;
+                }
+
+                const sf::Vector2f delta = this->positions_[other_index] - position;
+                const float combined_radius = radius + this->configs_[other_index].car_collision_radius_pixels;
+                const float distance_squared = delta.x * delta.x + delta.y * delta.y;
+                if (distance_squared >= combined_radius * combined_radius || distance_squared <= 0.0f) {
+                    continue;
+                }
+
+                // Push the overlapping cars apart symmetrically along the contact normal
+                const float distance = std::sqrt(distance_squared);
+                const sf::Vector2f normal = delta / distance;
+                const float half_penetration = (combined_radius - distance) * 0.5f;
+                this->positions_[car_index] -= normal * half_penetration;
+                this->positions_[other_index] += normal * half_penetration;
+
+                // Bounce only if the cars are approaching each other; separating pairs are just pushed apart
+                const sf::Vector2f relative_velocity = this->velocities_[other_index] - this->velocities_[car_index];
+                const float approach_speed = relative_velocity.x * normal.x + relative_velocity.y * normal.y;
+                if (approach_speed < 0.0f) {
+                    // Equal-mass impulse with the configured retention ratio acting as restitution
+                    const float restitution = 0.5f * (this->configs_[car_index].collision_velocity_retention_ratio + this->configs_[other_index].collision_velocity_retention_ratio);
+                    const float impulse = -(1.0f + restitution) * approach_speed * 0.5f;
+                    this->velocities_[car_index] -= normal * impulse;
+                    this->velocities_[other_index] += normal * impulse;
+                }
+
+                // Refresh this car's local position after the push, so further contacts in the same step see the corrected state
+                position = this->positions_[car_index];
+            }
+        }
+    }
 }
 
-void Car::set_active(const bool active)
+void CarPhysicsSystem::update_standings()
 {
-    this->is_active_ = active;
+    // One insertion pass over the almost-sorted standings: a car's progress key changes by at most one waypoint per step, so this is O(cars) when the order is unchanged and only moves the cars that actually overtook someone
+    for (std::size_t position = 1; position < this->standings_.size(); ++position) {
+        std::size_t current = position;
+        // Continuous progress breaks ties between cars on the same waypoint count; the strictly-greater comparison keeps exact ties in their previous order, so equal cars do not flicker
+        while (current > 0 &&
+               (this->waypoints_passed_[this->standings_[current]] > this->waypoints_passed_[this->standings_[current - 1]] ||
+                (this->waypoints_passed_[this->standings_[current]] == this->waypoints_passed_[this->standings_[current - 1]] &&
+                 this->race_progress_[this->standings_[current]] > this->race_progress_[this->standings_[current - 1]]))) {
+            std::swap(this->standings_[current], this->standings_[current - 1]);
+            this->race_positions_[this->standings_[current]] = current;
+            --current;
+        }
+        this->race_positions_[this->standings_[current]] = current;
+    }
+}
 
-    // If deactivating, clear existing visual effects immediately
-    if (!active) {
-        this->tire_marks_.clear();
+[[nodiscard]] const std::vector<std::size_t> &CarPhysicsSystem::get_standings() const
+{
+    return this->standings_;
+}
+
+void CarPhysicsSystem::rebuild_standings()
+{
+    this->standings_.resize(this->positions_.size());
+    this->race_positions_.resize(this->positions_.size());
+    for (std::size_t car_index = 0; car_index < this->standings_.size(); ++car_index) {
+        this->standings_[car_index] = car_index;
+    }
+    // Stable sort, so equal progress keeps creation order (the player first, then the AI grid); continuous progress breaks ties between cars on the same waypoint count
+    std::ranges::stable_sort(this->standings_,
+                             [this](const std::size_t a, const std::size_t b) {
+                                 if (this->waypoints_passed_[a] != this->waypoints_passed_[b]) {
+                                     return this->waypoints_passed_[a] > this->waypoints_passed_[b];
+                                 }
+                                 return this->race_progress_[a] > this->race_progress_[b];
+                             });
+    for (std::size_t position = 0; position < this->standings_.size(); ++position) {
+        this->race_positions_[this->standings_[position]] = position;
     }
 }
 
-void Car::update_ai_behavior(const float dt)
+[[nodiscard]] std::size_t CarPhysicsSystem::size() const
+{
+    return this->positions_.size();
+}
+
+[[nodiscard]] const sf::Vector2f &CarPhysicsSystem::get_previous_position(const std::size_t car_index) const
+{
+    return this->previous_positions_[car_index];
+}
+
+[[nodiscard]] float CarPhysicsSystem::get_previous_heading_radians(const std::size_t car_index) const
+{
+    return this->previous_headings_radians_[car_index];
+}
+
+float CarPhysicsSystem::ai_phase_offset(const std::size_t car_index)
+{
+    // Fractional part of the golden ratio; its multiples modulo 1 form a low-discrepancy sequence, so phases stay near-uniformly spread for any car count
+    static constexpr float golden_ratio_fraction = 0.6180339887f;
+    const float phase = std::fmod(static_cast<float>(car_index) * golden_ratio_fraction, 1.0f);
+    return phase * CarPhysicsSystem::ai_update_rate_;
+}
+
+void CarPhysicsSystem::update_ai_behavior(const std::size_t car_index,
+                                          const float dt)
 {
     // Accumulate the delta time
-    this->ai_update_timer_ += dt;
+    this->ai_update_timers_[car_index] += dt;
 
     // If the accumulated time does not the update rate, ignore to save performance
-    if (this->ai_update_timer_ < this->ai_update_rate) {
+    if (this->ai_update_timers_[car_index] < this->ai_update_rate_) {
         return;
     }
 
     // Reset timer for next AI update cycle
-    this->ai_update_timer_ -= this->ai_update_rate;  // Keep any overshoot
+    this->ai_update_timers_[car_index] -= this->ai_update_rate_;  // Keep any overshoot
 
     // AI behavior constants
     static constexpr float collision_distance = 0.65f;                           // Distance ahead to check for collisions as fraction of tile size; increase = avoid collisions earlier, decrease = check collisions closer to car
@@ -182,8 +438,6 @@ void Car::update_ai_behavior(const float dt)
     static constexpr float corner_steering_threshold = 0.08f;                    // Heading difference threshold for steering in corners in radians; increase = less responsive cornering, decrease = more aggressive cornering
     static constexpr float minimum_straight_steering_difference = 0.1f;          // Minimum heading difference for straight steering in radians; increase = reduce steering wobble but less precision, decrease = more precise but potentially jittery steering
     static constexpr float early_corner_turn_distance = 1.0f;                    // Distance factor for early corner turning; increase = start turning earlier before corners, decrease = turn later and sharper into corners
-    static constexpr float corner_speed_factor = 1.2f;                           // Speed multiplier for corners as fraction of tile size; increase = faster through corners but riskier, decrease = slower and safer through corners
-    static constexpr float straight_speed_factor = 3.0f;                         // Speed multiplier for straights as fraction of tile size; increase = faster on straights, decrease = slower and more conservative on straights
     static constexpr float brake_distance_factor = 3.0f;                         // Distance factor for braking before corners; increase = start braking earlier before corners, decrease = brake later and more aggressively
     static constexpr float collision_velocity_threshold_factor = 0.1f;           // Minimum speed for collision checking as fraction of tile size; increase = only check collisions at higher speeds, decrease = check collisions even at very low speeds
     static constexpr float max_heading_for_full_steering_degrees = 45.0f;        // Degrees for maximum steering intensity; increase = require larger heading errors for full steering, decrease = apply full steering with smaller heading errors
@@ -199,7 +453,7 @@ void Car::update_ai_behavior(const float dt)
     static constexpr float gentle_brake_maximum = 0.3f;                          // Maximum brake for gentle speed adjustments; increase = more aggressive gentle braking, decrease = more conservative gentle braking
 
     // Reset input values at start of AI update
-    this->current_input_ = {};
+    this->inputs_[car_index] = {};
 
     // Get basic info
     const auto &waypoints = this->track_.get_waypoints();
@@ -210,28 +464,27 @@ void Car::update_ai_behavior(const float dt)
         return;
     }
 
-    const std::size_t current_index = this->current_waypoint_index_number_;
-    const std::size_t next_index = (current_index + 1) % waypoints.size();
+    const std::size_t current_index = this->waypoint_indices_[car_index];
     const core::world::TrackWaypoint &current_waypoint = waypoints[current_index];
-    const core::world::TrackWaypoint &next_waypoint = waypoints[next_index];
-    const sf::Vector2f car_position = this->sprite_.getPosition();
+    // The precomputed racing line carries the corner context and target speed for this segment, so no per-tick geometry is derived from raw waypoints
+    const core::world::RacingLineSegment &segment = this->track_.get_racing_line()[current_index];
+    const sf::Vector2f car_position = this->positions_[car_index];
     const float tile_size = static_cast<float>(this->track_.get_config().size_px);
-    const float current_speed = std::hypot(this->velocity_.x, this->velocity_.y);
+    const sf::Vector2f car_velocity = this->velocities_[car_index];
+    const float current_speed = core::math::fast_length(car_velocity.x, car_velocity.y);
 
     // Cache random variations to avoid multiple RNG calls per parameter
-    std::uniform_real_distribution<float> random_distribution(this->random_variation_minimum_, this->random_variation_maximum_);
-    const float speed_random_variation = random_distribution(this->rng_);
-    const float steering_random_variation = random_distribution(this->rng_);
-    const float distance_random_variation = random_distribution(this->rng_);
+    const float speed_random_variation = this->rngs_[car_index].uniform(this->random_variation_minimum_, this->random_variation_maximum_);
+    const float steering_random_variation = this->rngs_[car_index].uniform(this->random_variation_minimum_, this->random_variation_maximum_);
+    const float distance_random_variation = this->rngs_[car_index].uniform(this->random_variation_minimum_, this->random_variation_maximum_);
 
     // Calculate distances
     const sf::Vector2f vector_to_current_waypoint = current_waypoint.position - car_position;
-    const float distance_to_current_waypoint = std::hypot(vector_to_current_waypoint.x, vector_to_current_waypoint.y);
+    const float distance_to_current_waypoint = core::math::fast_length(vector_to_current_waypoint.x, vector_to_current_waypoint.y);
 
     // Collision detection - check one point ahead based on velocity direction
     bool collision_detected = false;
-    const sf::Vector2f car_velocity = this->velocity_;
-    const float velocity_magnitude = std::hypot(car_velocity.x, car_velocity.y);
+    const float velocity_magnitude = current_speed;
     const float collision_velocity_threshold = tile_size * collision_velocity_threshold_factor;
     if (velocity_magnitude > collision_velocity_threshold) {
         const sf::Vector2f velocity_normalized = car_velocity / velocity_magnitude;
@@ -239,15 +492,16 @@ void Car::update_ai_behavior(const float dt)
         collision_detected = !this->track_.is_on_track(check_point);
     }
 
-    // Determine driving context for better decision making
-    const bool at_corner = (current_waypoint.type == core::world::TrackWaypoint::DrivingType::Corner);
-    const bool approaching_corner = (next_waypoint.type == core::world::TrackWaypoint::DrivingType::Corner);
-    const bool in_corner_context = at_corner || approaching_corner;
+    // Driving context comes straight from the precomputed racing line
+    const bool approaching_corner = segment.approaching_corner;
+    const bool in_corner_context = segment.at_corner || approaching_corner;
 
-    // Steering logic with proportional control
-    const float desired_heading_radians = std::atan2(vector_to_current_waypoint.y, vector_to_current_waypoint.x);
-    const float current_heading_radians = this->sprite_.getRotation().asRadians();
-    const float heading_difference_radians = std::remainder(desired_heading_radians - current_heading_radians, 2.0f * std::numbers::pi_v<float>);
+    // Steering logic with proportional control; the signed angle between the car's forward vector and the waypoint direction is a cross/dot pair, replacing the old atan2-plus-remainder of absolute headings
+    const float current_heading_radians = this->headings_radians_[car_index];
+    const core::math::SinCos heading_sincos = core::math::fast_sincos(current_heading_radians);
+    const sf::Vector2f forward_unit_vector = {heading_sincos.cos, heading_sincos.sin};
+    const float heading_difference_radians = core::math::fast_atan2(forward_unit_vector.x * vector_to_current_waypoint.y - forward_unit_vector.y * vector_to_current_waypoint.x,
+                                                                    forward_unit_vector.x * vector_to_current_waypoint.x + forward_unit_vector.y * vector_to_current_waypoint.y);
 
     // Dynamic steering threshold based on context and early corner turning
     float steering_threshold = in_corner_context ? corner_steering_threshold : straight_steering_threshold;
@@ -272,15 +526,11 @@ void Car::update_ai_behavior(const float dt)
             steering_intensity = std::copysign(std::max(std::abs(steering_intensity), minimum_steering_intensity), steering_intensity);
         }
 
-        this->current_input_.steering = steering_intensity;
+        this->inputs_[car_index].steering = steering_intensity;
     }
 
-    // Speed management based on driving context
-    const float base_target_speed = in_corner_context
-                                        ? tile_size * corner_speed_factor
-                                        : tile_size * straight_speed_factor;
-
-    const float target_speed = base_target_speed * speed_random_variation;
+    // Speed management: the base target speed is precomputed per segment by the track; only the per-car random variation is applied here
+    const float target_speed = segment.target_speed * speed_random_variation;
     const float brake_distance = tile_size * brake_distance_factor * distance_random_variation;
 
     // Intelligent braking logic
@@ -297,23 +547,23 @@ void Car::update_ai_behavior(const float dt)
 
     // Smooth pedal operation with mutually exclusive throttle/brake logic
     if (emergency_brake) {
-        this->current_input_.brake = 1.0f;
-        this->current_input_.throttle = 0.0f;  // Ensure throttle is off during emergency braking
+        this->inputs_[car_index].brake = 1.0f;
+        this->inputs_[car_index].throttle = 0.0f;  // Ensure throttle is off during emergency braking
     }
     else if (speed_difference < -significant_speed_reduction_threshold) {
         // Proportional braking based on how much we need to slow down
         const float max_speed_over = target_speed * braking_speed_overage_factor;
         const float speed_over = current_speed - target_speed;
         const float brake_intensity = std::clamp(speed_over / max_speed_over, 0.0f, 1.0f);
-        this->current_input_.brake = brake_intensity;
-        this->current_input_.throttle = 0.0f;  // Ensure throttle is off when braking
+        this->inputs_[car_index].brake = brake_intensity;
+        this->inputs_[car_index].throttle = 0.0f;  // Ensure throttle is off when braking
     }
     else if (speed_difference > speed_increase_threshold) {
         // Proportional throttle based on how much we need to speed up
         const float max_speed_under = target_speed * throttle_speed_underage_factor;
         const float throttle_intensity = std::clamp(speed_difference / max_speed_under, 0.0f, 1.0f);
-        this->current_input_.throttle = throttle_intensity;
-        this->current_input_.brake = 0.0f;  // Ensure brake is off when accelerating
+        this->inputs_[car_index].throttle = throttle_intensity;
+        this->inputs_[car_index].brake = 0.0f;  // Ensure brake is off when accelerating
     }
     else {
         // Speed is close to target - use gentle control or let engine drag adjust naturally
@@ -321,212 +571,109 @@ void Car::update_ai_behavior(const float dt)
         if (speed_difference > gentle_speed_difference_threshold) {
             // Apply gentle throttle for fine speed adjustments
             const float gentle_throttle = std::clamp(speed_difference / speed_increase_threshold, 0.0f, gentle_throttle_maximum);
-            this->current_input_.throttle = gentle_throttle;
-            this->current_input_.brake = 0.0f;
+            this->inputs_[car_index].throttle = gentle_throttle;
+            this->inputs_[car_index].brake = 0.0f;
         }
         else if (speed_difference < -gentle_speed_difference_threshold) {
             // Apply gentle braking for fine speed adjustments
             const float gentle_brake = std::clamp(-speed_difference / significant_speed_reduction_threshold, 0.0f, gentle_brake_maximum);
-            this->current_input_.brake = gentle_brake;
-            this->current_input_.throttle = 0.0f;
+            this->inputs_[car_index].brake = gentle_brake;
+            this->inputs_[car_index].throttle = 0.0f;
         }
         else {
             // Let engine drag naturally adjust speed when very close to target
-            this->current_input_.throttle = 0.0f;
-            this->current_input_.brake = 0.0f;
+            this->inputs_[car_index].throttle = 0.0f;
+            this->inputs_[car_index].brake = 0.0f;
         }
     }
 }
 
-void Car::spawn_tire_marks(const float dt)
-{
-    if (!this->is_active_) {
-        return;
-    }
-    if (!settings::current::tire_marks) {
-        return;
-    }
-
-    // Accumulate the delta time
-    this->tire_update_timer_ += dt;
-
-    // Calculate tire update rate from settings (convert Hz to seconds)
-    const float tire_update_rate = 1.0f / static_cast<float>(settings::current::tire_marks_rate);
-
-    // If the accumulated time does not exceed the update rate, ignore to save performance
-    if (this->tire_update_timer_ < tire_update_rate) {
-        return;
-    }
-
-    // Reset timer for next tire update cycle
-    this->tire_update_timer_ -= tire_update_rate;  // Keep any overshoot
-
-    // Constants for tire mark appearance and positioning
-    static constexpr float tire_mark_radius = 12.0f;
-    static constexpr sf::Color tire_mark_color{122, 111, 85};  // Dark brown color for sand tracks
-
-    // Get car dimensions and position for wheel positioning
-    const sf::Vector2f car_position = this->sprite_.getPosition();
-    const float car_rotation_radians = this->sprite_.getRotation().asRadians();
-
-    // Approximate wheel positions based on car sprite size (71x131 pixels as per docs)
-    // We'll place wheels at corners of a smaller rectangle inside the car sprite
-    static constexpr float wheel_offset_forward = 40.0f;  // Distance from center to front/rear wheels
-    static constexpr float wheel_offset_side = 20.0f;     // Distance from center to left/right wheels
-
-    // Pre-compute relative wheel positions in local coordinates
-    static constexpr std::array<sf::Vector2f, 4> wheel_positions = {{
-        // {wheel_offset_forward, -wheel_offset_side},   // Front-left
-        // {wheel_offset_forward, wheel_offset_side},    // Front-right
-        {-wheel_offset_forward, -wheel_offset_side},  // Rear-left
-        {-wheel_offset_forward, wheel_offset_side}    // Rear-right
-    }};
-
-    // Calculate wheel positions relative to car center
-    // Note: Car sprite faces right (0 degrees), so forward is +X direction
-    const float cos_rotation = std::cos(car_rotation_radians);
-    const float sin_rotation = std::sin(car_rotation_radians);
-
-    // Transform local wheel positions to world coordinates
-    std::array<sf::Vector2f, 4> wheel_offsets;
-    for (std::size_t i = 0; i < wheel_positions.size(); ++i) {
-        const auto &[local_x, local_y] = wheel_positions[i];
-        wheel_offsets[i] = {
-            local_x * cos_rotation - local_y * sin_rotation,
-            local_x * sin_rotation + local_y * cos_rotation};
-    }
-
-    for (const auto &offset : wheel_offsets) {
-        TireMark tire_mark;
-        tire_mark.circle.setRadius(tire_mark_radius);
-        tire_mark.circle.setOrigin({tire_mark_radius, tire_mark_radius});  // Cente
-        tire_mark.circle.setPosition(car_position + offset);
-        tire_mark.circle.setFillColor(tire_mark_color);
-        tire_mark.life_remaining = this->initial_tire_lifetime_;
-
-        this->tire_marks_.emplace_back(tire_mark);
-    }
-}
-
-void Car::update_tire_marks(const float dt)
+void CarPhysicsSystem::apply_physics_step(const std::size_t car_index,
+                                          const float dt)
 {
-    if (!this->is_active_) {
-        return;
-    }
-    if (!settings::current::tire_marks) {
-        this->tire_marks_.clear();
-        return;
-    }
-
-    // Accumulate the delta time
-    this->tire_despawn_timer_ += dt;
-
-    // If the accumulated time does not the update rate, ignore to save performance
-    if (this->tire_despawn_timer_ < this->tire_despawn_rate) {
-        return;
-    }
-
-    // Reset timer for next AI update cycle
-    this->tire_despawn_timer_ -= this->tire_despawn_rate;  // Keep any overshoot
+    // Load the hot per-car state into locals once, so the step below works on registers instead of re-indexing the arrays
+    const CarConfig &config = this->configs_[car_index];
+    const CarInput &input = this->inputs_[car_index];
+    sf::Vector2f velocity = this->velocities_[car_index];
+    sf::Vector2f position = this->positions_[car_index];
+    float heading_radians = this->headings_radians_[car_index];
+    float steering_wheel_angle = this->steering_wheel_angles_degrees_[car_index];
 
-    // Update lifetime and fade alpha for all tire marks
-    for (auto &tire_mark : this->tire_marks_) {
-        tire_mark.life_remaining -= this->tire_despawn_rate;
-
-        // Fade out tire mark as it ages
-        if (tire_mark.life_remaining > 0.0f) {
-            const float alpha_ratio = tire_mark.life_remaining / this->initial_tire_lifetime_;
-            const std::uint8_t alpha = static_cast<std::uint8_t>(alpha_ratio * 255.0f);
-
-            sf::Color current_color = tire_mark.circle.getFillColor();
-            current_color.a = alpha;
-            tire_mark.circle.setFillColor(current_color);
-        }
-    }
-
-    // Remove expired tire marks
-    std::erase_if(this->tire_marks_,
-                  // Remove if life_remaining is zero or negative
-                  [](const TireMark &mark) { return mark.life_remaining <= 0.0f; });
-}
-
-void Car::apply_physics_step(const float dt)
-{
     // Reset collision state at the beginning of each physics step
-    this->just_hit_wall_ = false;
-    this->last_wall_hit_speed_ = 0.0f;
+    this->just_hit_wall_flags_[car_index] = 0;
+    this->last_wall_hit_speeds_[car_index] = 0.0f;
 
     // Compute forward unit vector from current heading
-    const float heading_angle_radians = this->sprite_.getRotation().asRadians();
-    const sf::Vector2f forward_unit_vector = {std::cos(heading_angle_radians), std::sin(heading_angle_radians)};
+    const core::math::SinCos heading_sincos = core::math::fast_sincos(heading_radians);
+    const sf::Vector2f forward_unit_vector = {heading_sincos.cos, heading_sincos.sin};
 
     // Storage for current speed
-    float current_speed = std::hypot(this->velocity_.x, this->velocity_.y);
+    float current_speed = core::math::fast_length(velocity.x, velocity.y);
 
     // Apply gas throttle along forward axis (using analog input)
-    if (this->current_input_.throttle > 0.0f) {
-        const float throttle_force = this->current_input_.throttle * this->config_.throttle_acceleration_rate_pixels_per_second_squared * dt;
-        this->velocity_ += forward_unit_vector * throttle_force;
-        current_speed = std::hypot(this->velocity_.x, this->velocity_.y);
+    if (input.throttle > 0.0f) {
+        const float throttle_force = input.throttle * config.throttle_acceleration_rate_pixels_per_second_squared * dt;
+        velocity += forward_unit_vector * throttle_force;
+        current_speed = core::math::fast_length(velocity.x, velocity.y);
     }
 
     // Apply foot brake deceleration (using analog input)
-    if (this->current_input_.brake > 0.0f && current_speed > this->config_.stopped_speed_threshold_pixels_per_second) {
-        const float brake_force = this->current_input_.brake * this->config_.brake_deceleration_rate_pixels_per_second_squared * dt;
+    if (input.brake > 0.0f && current_speed > config.stopped_speed_threshold_pixels_per_second) {
+        const float brake_force = input.brake * config.brake_deceleration_rate_pixels_per_second_squared * dt;
         const float brake_reduction = std::min(brake_force, current_speed);
-        const sf::Vector2f velocity_unit_vector = this->velocity_ / current_speed;
-        this->velocity_ -= velocity_unit_vector * brake_reduction;
+        const sf::Vector2f velocity_unit_vector = velocity / current_speed;
+        velocity -= velocity_unit_vector * brake_reduction;
         current_speed -= brake_reduction;
     }
 
     // Apply handbrake deceleration (using analog input)
-    if (this->current_input_.handbrake > 0.0f && current_speed > this->config_.stopped_speed_threshold_pixels_per_second) {
-        const float handbrake_force = this->current_input_.handbrake * this->config_.handbrake_deceleration_rate_pixels_per_second_squared * dt;
+    if (input.handbrake > 0.0f && current_speed > config.stopped_speed_threshold_pixels_per_second) {
+        const float handbrake_force = input.handbrake * config.handbrake_deceleration_rate_pixels_per_second_squared * dt;
         const float new_speed = current_speed - handbrake_force;
-        if (new_speed < this->config_.stopped_speed_threshold_pixels_per_second) {
-            this->velocity_ = {0.0f, 0.0f};
+        if (new_speed < config.stopped_speed_threshold_pixels_per_second) {
+            velocity = {0.0f, 0.0f};
             current_speed = 0.0f;
         }
         else {
-            const sf::Vector2f velocity_unit_vector = this->velocity_ / current_speed;
-            this->velocity_ = velocity_unit_vector * new_speed;
+            const sf::Vector2f velocity_unit_vector = velocity / current_speed;
+            velocity = velocity_unit_vector * new_speed;
             current_speed = new_speed;
         }
     }
 
     // Apply passive engine drag when no controls are active
-    const bool has_throttle_input = this->current_input_.throttle > 0.0f;
-    const bool has_brake_input = this->current_input_.brake > 0.0f;
-    const bool has_handbrake_input = this->current_input_.handbrake > 0.0f;
-    if (!has_throttle_input && !has_brake_input && !has_handbrake_input && current_speed > this->config_.stopped_speed_threshold_pixels_per_second) {
-        const float drag = this->config_.engine_braking_rate_pixels_per_second_squared * dt;
+    const bool has_throttle_input = input.throttle > 0.0f;
+    const bool has_brake_input = input.brake > 0.0f;
+    const bool has_handbrake_input = input.handbrake > 0.0f;
+    if (!has_throttle_input && !has_brake_input && !has_handbrake_input && current_speed > config.stopped_speed_threshold_pixels_per_second) {
+        const float drag = config.engine_braking_rate_pixels_per_second_squared * dt;
         const float speed_after_drag = std::max(current_speed - drag, 0.0f);
         const float drag_scale = (current_speed > 0.0f) ? speed_after_drag / current_speed : 0.0f;
-        this->velocity_ *= drag_scale;
+        velocity *= drag_scale;
         current_speed = speed_after_drag;
     }
 
     // Cap speed to configured maximum
-    if (current_speed > this->config_.maximum_movement_pixels_per_second) {
-        const float max_speed_scale = this->config_.maximum_movement_pixels_per_second / current_speed;
-        this->velocity_ *= max_speed_scale;
-        current_speed = this->config_.maximum_movement_pixels_per_second;
+    if (current_speed > config.maximum_movement_pixels_per_second) {
+        const float max_speed_scale = config.maximum_movement_pixels_per_second / current_speed;
+        velocity *= max_speed_scale;
+        current_speed = config.maximum_movement_pixels_per_second;
     }
 
     // Separate velocity into forward and lateral components
-    const float signed_forward_speed = forward_unit_vector.x * this->velocity_.x + forward_unit_vector.y * this->velocity_.y;
+    const float signed_forward_speed = forward_unit_vector.x * velocity.x + forward_unit_vector.y * velocity.y;
     const sf::Vector2f forward_velocity_vector = forward_unit_vector * signed_forward_speed;
-    const sf::Vector2f lateral_velocity_vector = this->velocity_ - forward_velocity_vector;
+    const sf::Vector2f lateral_velocity_vector = velocity - forward_velocity_vector;
 
     // Dampen lateral slip for arcade feel
-    const float slip_damping_ratio = 1.0f - std::clamp(this->config_.lateral_slip_damping_coefficient_per_second * dt, 0.0f, 1.0f);
-    this->velocity_ = forward_velocity_vector + lateral_velocity_vector * slip_damping_ratio;
+    const float slip_damping_ratio = 1.0f - std::clamp(config.lateral_slip_damping_coefficient_per_second * dt, 0.0f, 1.0f);
+    velocity = forward_velocity_vector + lateral_velocity_vector * slip_damping_ratio;
 
     // Calculate drift score based on lateral slip velocity and car speed
-    const float lateral_speed = std::hypot(lateral_velocity_vector.x, lateral_velocity_vector.y);
+    const float lateral_speed = core::math::fast_length(lateral_velocity_vector.x, lateral_velocity_vector.y);
 
     // Store lateral slip velocity for use in get_state() to avoid recalculation
-    this->current_lateral_slip_velocity_ = lateral_speed;
+    this->lateral_slip_velocities_[car_index] = lateral_speed;
 
     // Drift calculation constants
     static constexpr float drift_threshold_pixels_per_second = 50.0f;              // Minimum lateral speed to count as drifting
@@ -543,97 +690,77 @@ void Car::apply_physics_step(const float dt)
 
         // Calculate final drift score increment
         const float drift_score_increment = base_drift_points_per_second * speed_multiplier * drift_angle_factor * dt;
-        this->drift_score_ += drift_score_increment;
+        this->drift_scores_[car_index] += drift_score_increment;
 
         // Debug logging for drift detection (uncomment for testing)
-        // SPDLOG_DEBUG("Drifting! Lateral speed: {:.1f}, Forward speed: {:.1f}, Score increment: {:.2f}, Total score: {:.1f}", lateral_speed, current_speed, drift_score_increment, this->drift_score_);
-
-        // Spawn tire marks at wheel positions when drifting
-        this->spawn_tire_marks(dt);
+        // SPDLOG_DEBUG("Drifting! Lateral speed: {:.1f}, Forward speed: {:.1f}, Score increment: {:.2f}, Total score: {:.1f}", lateral_speed, current_speed, drift_score_increment, this->drift_scores_[car_index]);
     }
 
-    // Update and cleanup tire marks
-    this->update_tire_marks(dt);
-
     // Update steering wheel angle from analog input
-    if (std::abs(this->current_input_.steering) > 0.01f) {
+    if (std::abs(input.steering) > 0.01f) {
         // Apply steering based on analog input value (-1.0 to 1.0)
-        const float steering_rate = this->current_input_.steering * this->config_.steering_turn_rate_degrees_per_second * dt;
-        this->steering_wheel_angle_ += steering_rate;
+        const float steering_rate = input.steering * config.steering_turn_rate_degrees_per_second * dt;
+        steering_wheel_angle += steering_rate;
     }
     else {
         // Auto center steering wheel when no steering input is active
-        if (std::abs(this->steering_wheel_angle_) > this->config_.steering_autocenter_epsilon_degrees && current_speed > 0.0f) {
-            const float centering_factor = std::clamp(this->config_.steering_autocenter_rate_degrees_per_second * dt / std::abs(this->steering_wheel_angle_), 0.0f, 1.0f);
-            this->steering_wheel_angle_ = std::lerp(this->steering_wheel_angle_, 0.0f, centering_factor);
+        if (std::abs(steering_wheel_angle) > config.steering_autocenter_epsilon_degrees && current_speed > 0.0f) {
+            const float centering_factor = std::clamp(config.steering_autocenter_rate_degrees_per_second * dt / std::abs(steering_wheel_angle), 0.0f, 1.0f);
+            steering_wheel_angle = std::lerp(steering_wheel_angle, 0.0f, centering_factor);
         }
         else {
-            this->steering_wheel_angle_ = 0.0f;
+            steering_wheel_angle = 0.0f;
         }
     }
 
     // Clamp steering wheel angle to physical limits
-    this->steering_wheel_angle_ = std::clamp(this->steering_wheel_angle_, -this->config_.maximum_steering_angle_degrees, this->config_.maximum_steering_angle_degrees);
+    steering_wheel_angle = std::clamp(steering_wheel_angle, -config.maximum_steering_angle_degrees, config.maximum_steering_angle_degrees);
 
-    // Rotate sprite if moving forward or backward faster than threshold
-    if (std::abs(signed_forward_speed) > this->config_.minimum_speed_for_rotation_pixels_per_second) {
-        const float speed_ratio = std::clamp(current_speed / this->config_.maximum_movement_pixels_per_second, 0.0f, 1.0f);
-        const float steering_sensitivity = this->config_.steering_sensitivity_at_zero_speed * (1.0f - speed_ratio) + this->config_.steering_sensitivity_at_maximum_speed * speed_ratio;
+    // Rotate car if moving forward or backward faster than threshold
+    if (std::abs(signed_forward_speed) > config.minimum_speed_for_rotation_pixels_per_second) {
+        const float speed_ratio = std::clamp(current_speed / config.maximum_movement_pixels_per_second, 0.0f, 1.0f);
+        const float steering_sensitivity = config.steering_sensitivity_at_zero_speed * (1.0f - speed_ratio) + config.steering_sensitivity_at_maximum_speed * speed_ratio;
         const float direction_sign = (signed_forward_speed >= 0.0f) ? 1.0f : -1.0f;
         // Flip steering when reversing
-        this->sprite_.rotate(sf::degrees(direction_sign * this->steering_wheel_angle_ * steering_sensitivity * dt));
+        heading_radians += sf::degrees(direction_sign * steering_wheel_angle * steering_sensitivity * dt).asRadians();
     }
 
-    // Move sprite according to velocity
-    this->sprite_.move(this->velocity_ * dt);
+    // Move car according to velocity
+    position += velocity * dt;
 
-    // Handle collision with track boundaries
-    if (!this->track_.is_on_track(this->sprite_.getPosition())) {
+    // Handle collision with track boundaries via the baked signed distance field: one bilinear lookup yields the penetration depth and the surface normal, so curved tile edges resolve like curves instead of rectangles
+    const core::world::TrackBoundarySample boundary = this->track_.sample_boundary(position);
+    if (boundary.signed_distance < 0.0f) {
         // Record collision state
-        this->just_hit_wall_ = true;
-        this->last_wall_hit_speed_ = current_speed;
+        this->just_hit_wall_flags_[car_index] = 1;
+        this->last_wall_hit_speeds_[car_index] = current_speed;
 
-        this->sprite_.setPosition(this->last_position_);
-        // Restore last legal position
-        this->velocity_ = -this->velocity_ * this->config_.collision_velocity_retention_ratio;
-        current_speed = std::hypot(this->velocity_.x, this->velocity_.y);
-        // If below minimum speed, stop the car completely to avoid jitter
-        if (current_speed < this->config_.collision_minimum_bounce_speed_pixels_per_second) {
-            this->velocity_ = {0.0f, 0.0f};
-            // SPDLOG_DEBUG("Collision below minimum bounce speed; now stopping car!");
+        // Push the car back onto the track along the inward gradient by exactly the penetration depth
+        position += boundary.gradient * (-boundary.signed_distance);
+
+        // Reflect only the velocity component pointing into the wall, scaled by the retention ratio; the tangential component survives, so the car slides along the wall instead of the old full reversal with a random jitter angle
+        const float velocity_into_wall = velocity.x * boundary.gradient.x + velocity.y * boundary.gradient.y;  // Negative when moving toward the wall
+        if (velocity_into_wall < 0.0f) {
+            velocity -= boundary.gradient * ((1.0f + config.collision_velocity_retention_ratio) * velocity_into_wall);
         }
-        // Otherwise, bounce it randomly with speed-scaled angles to avoid jitter at low speeds
-        // This is a simple approximation of a bounce, not a real physics simulation; we use a random angle to make the bounce direction unpredictable
-        else {
-            // Calculate speed ratio from 0.0 (minimum bounce speed) to 1.0 (maximum speed)
-            // Protect against division by zero
-            float speed_ratio = 0.0f;
-            if (this->config_.maximum_movement_pixels_per_second > this->config_.collision_minimum_bounce_speed_pixels_per_second) {
-                speed_ratio = std::clamp((current_speed - this->config_.collision_minimum_bounce_speed_pixels_per_second) / (this->config_.maximum_movement_pixels_per_second - this->config_.collision_minimum_bounce_speed_pixels_per_second), 0.0f, 1.0f);
-            }
+        current_speed = core::math::fast_length(velocity.x, velocity.y);
 
-            // Interpolate between minimum and maximum jitter angles based on speed
-            const float max_jitter_angle_degrees = this->config_.collision_minimum_random_bounce_angle_degrees * (1.0f - speed_ratio) + this->config_.collision_maximum_random_bounce_angle_degrees * speed_ratio;
-
-            // Generate random angle within the calculated range
-            std::uniform_real_distribution<float> speed_scaled_jitter_dist(-max_jitter_angle_degrees, max_jitter_angle_degrees);
-            const float random_jitter_degrees = speed_scaled_jitter_dist(this->rng_);
-            const float random_jitter_radians = sf::degrees(random_jitter_degrees).asRadians();
-            const float cosine_jitter = std::cos(random_jitter_radians);
-            const float sine_jitter = std::sin(random_jitter_radians);
-            const sf::Vector2f original_velocity = this->velocity_;
-            this->velocity_.x = original_velocity.x * cosine_jitter - original_velocity.y * sine_jitter;
-            this->velocity_.y = original_velocity.x * sine_jitter + original_velocity.y * cosine_jitter;
-            this->sprite_.rotate(sf::degrees(random_jitter_degrees));
-            // SPDLOG_DEBUG("Collision above minimum bounce speed, current speed '{}' results in a speed ratio of '{}'; now bouncing back with a random angle of '{}' degrees!", current_speed, speed_ratio, random_jitter_degrees);
+        // If below minimum speed, stop the car completely to avoid jitter
+        if (current_speed < config.collision_minimum_bounce_speed_pixels_per_second) {
+            velocity = {0.0f, 0.0f};
+            // SPDLOG_DEBUG("Collision below minimum bounce speed; now stopping car!");
         }
     }
 
-    // Store last legal position for next frame
-    this->last_position_ = this->sprite_.getPosition();
+    // Write the stepped state back into the parallel arrays
+    this->velocities_[car_index] = velocity;
+    this->positions_[car_index] = position;
+    this->headings_radians_[car_index] = heading_radians;
+    this->steering_wheel_angles_degrees_[car_index] = steering_wheel_angle;
 }
 
-void Car::update_waypoint_tracking()
+void CarPhysicsSystem::update_waypoint_tracking(const std::size_t car_index,
+                                                const float dt)
 {
     // Get basic waypoint info
     const auto &waypoints = this->track_.get_waypoints();
@@ -644,27 +771,465 @@ void Car::update_waypoint_tracking()
         return;
     }
 
-    // Calculate distances and waypoint reach logic
-    const std::size_t current_index = this->current_waypoint_index_number_;
-    const std::size_t next_index = (current_index + 1) % waypoints.size();
-    const core::world::TrackWaypoint &current_waypoint = waypoints[current_index];
-    const sf::Vector2f car_position = this->sprite_.getPosition();
-    const float tile_size = static_cast<float>(this->track_.get_config().size_px);
+    // The lap clock runs every step; cars spawn on the finish line, so the first lap starts counting immediately
+    this->current_lap_times_[car_index] += dt;
 
-    // Calculate distance to current waypoint
-    const sf::Vector2f vector_to_current_waypoint = current_waypoint.position - car_position;
-    const float distance_to_current_waypoint = std::hypot(vector_to_current_waypoint.x, vector_to_current_waypoint.y);
-    const float waypoint_reach_distance = tile_size * this->waypoint_reach_factor_;
+    // One cell lookup gives the nearest racing-line segment and the continuous progress along the lap; the fraction tie-breaks standings between cars on the same waypoint count
+    const core::world::TrackProgressSample sample = this->track_.sample_progress(this->positions_[car_index]);
+    this->race_progress_[car_index] = sample.progress;
+
+    // Segment "i" starts at waypoint "i", so being on segment "current_index + k" means waypoints "current_index" through "current_index + k" were crossed since the last step
+    // A distance beyond the skip window means the car is still behind its target (most of the lap "ahead" in wrap-around terms is actually behind), so no waypoint is credited
+    const std::size_t current_index = this->waypoint_indices_[car_index];
+    const std::size_t segments_ahead = (sample.segment + waypoints.size() - current_index) % waypoints.size();
+    if (segments_ahead > CarPhysicsSystem::waypoint_skip_window_) {
+        return;
+    }
+
+    // Credit every crossed waypoint individually, so lap completion and sector splits fire even when a fast car clears several waypoints in one step
+    for (std::size_t crossed = 0; crossed <= segments_ahead; ++crossed) {
+        const std::size_t passed_index = (current_index + crossed) % waypoints.size();
+
+        // Race progress is a monotonic waypoint count, so standings comparisons never have to reason about lap wrap-around
+        ++this->waypoints_passed_[car_index];
+
+        if (passed_index == 0) {
+            // Waypoint 0 sits on the finish line, so reaching it completes the lap; the final sector is whatever the earlier splits have not covered
+            float earlier_sectors = 0.0f;
+            for (std::size_t sector = 0; sector + 1 < CarPhysicsSystem::sector_count_; ++sector) {
+                earlier_sectors += this->sector_times_[car_index][sector];
+            }
+            const float lap_time = this->current_lap_times_[car_index];
+            this->sector_times_[car_index][CarPhysicsSystem::sector_count_ - 1] = lap_time - earlier_sectors;
+            this->last_lap_times_[car_index] = lap_time;
+            if (this->best_lap_times_[car_index] == 0.0f || lap_time < this->best_lap_times_[car_index]) {
+                this->best_lap_times_[car_index] = lap_time;
+            }
+            ++this->lap_counts_[car_index];
+            this->current_lap_times_[car_index] = 0.0f;
+            this->sector_times_[car_index] = {};
+        }
+        else {
+            // Record a sector split when the reached waypoint is a sector boundary (the lap is split into sectors of equal waypoint count); the duration is the lap time minus the already-recorded splits
+            for (std::size_t sector = 0; sector + 1 < CarPhysicsSystem::sector_count_; ++sector) {
+                const std::size_t boundary_index = ((sector + 1) * waypoints.size()) / CarPhysicsSystem::sector_count_;
+                if (passed_index == boundary_index && this->sector_times_[car_index][sector] == 0.0f) {
+                    float earlier_sectors = 0.0f;
+                    for (std::size_t earlier = 0; earlier < sector; ++earlier) {
+                        earlier_sectors += this->sector_times_[car_index][earlier];
+                    }
+                    this->sector_times_[car_index][sector] = this->current_lap_times_[car_index] - earlier_sectors;
+                }
+            }
+        }
+    }
 
-    // Apply random variation to waypoint reach distance for more natural behavior
-    std::uniform_real_distribution<float> waypoint_random_distribution(this->random_variation_minimum_, this->random_variation_maximum_);
-    const float distance_random_variation = waypoint_random_distribution(this->rng_);
-    const float randomized_waypoint_reach_distance = waypoint_reach_distance * distance_random_variation;
+    // The next target is the waypoint ahead of the sampled segment; this is what the AI steers toward
+    this->waypoint_indices_[car_index] = (sample.segment + 1) % waypoints.size();
+}
+
+void SkidMarkLayer::rebuild(const sf::FloatRect &world_bounds)
+{
+    this->world_bounds_ = world_bounds;
+    this->stamp_count_ = 0;
+    this->dirty_ = false;
+    this->ready_ = false;
+
+    // Nothing to cover before the first track build
+    if (world_bounds.size.x <= 0.0f || world_bounds.size.y <= 0.0f) [[unlikely]] {
+        return;
+    }
+
+    // Cap the texture edge at our own limit and the GPU's, covering bigger tracks at a proportionally reduced resolution
+    const unsigned size_cap = std::min(SkidMarkLayer::maximum_texture_size_, sf::Texture::getMaximumSize());
+    const float scale = std::min(1.0f, static_cast<float>(size_cap) / std::max(world_bounds.size.x, world_bounds.size.y));
+    const sf::Vector2u texture_size = {static_cast<unsigned>(std::max(1.0f, world_bounds.size.x * scale)),
+                                       static_cast<unsigned>(std::max(1.0f, world_bounds.size.y * scale))};
+
+    if (!this->texture_.resize(texture_size)) {
+        SPDLOG_WARN("Failed to create '{}x{}' skid mark layer texture; persistent marks are disabled!", texture_size.x, texture_size.y);
+        return;
+    }
+
+    // Map the texture onto the world rectangle, so stamping and blitting both work in world coordinates regardless of the resolution cap; smoothing hides the cap on large tracks
+    this->texture_.setSmooth(true);
+    this->texture_.setView(sf::View{world_bounds.getCenter(), world_bounds.size});
+    this->texture_.clear(sf::Color::Transparent);
+    this->texture_.display();
+    this->ready_ = true;
+    SPDLOG_DEBUG("Created '{}x{}' skid mark layer texture covering '{}x{}' px of world space!", texture_size.x, texture_size.y, world_bounds.size.x, world_bounds.size.y);
+}
+
+void SkidMarkLayer::clear()
+{
+    this->stamp_count_ = 0;
+    this->dirty_ = false;
+    if (!this->ready_) {
+        return;
+    }
+    this->texture_.clear(sf::Color::Transparent);
+    this->texture_.display();
+}
+
+void SkidMarkLayer::stamp(const sf::Vector2f &world_position,
+                          const float radius,
+                          const sf::Color &color)
+{
+    if (!this->ready_) {
+        return;
+    }
+
+    // Rasterize the mark into the texture once; "draw()" flushes the texture update, so a burst of stamps costs one display per frame
+    sf::CircleShape mark{radius};
+    mark.setOrigin({radius, radius});
+    mark.setPosition(world_position);
+    mark.setFillColor(color);
+    this->texture_.draw(mark);
+    ++this->stamp_count_;
+    this->dirty_ = true;
+}
+
+void SkidMarkLayer::draw(sf::RenderTarget &target)
+{
+    if (!this->ready_) {
+        return;
+    }
+
+    // Flush stamps accumulated since the last frame in one texture update
+    if (this->dirty_) {
+        this->texture_.display();
+        this->dirty_ = false;
+    }
+
+    // Blit the whole layer as a single textured quad spanning the world bounds; the scale compensates for the resolution cap
+    sf::Sprite layer_sprite{this->texture_.getTexture()};
+    const sf::Vector2u texture_size = this->texture_.getSize();
+    layer_sprite.setPosition(this->world_bounds_.position);
+    layer_sprite.setScale({this->world_bounds_.size.x / static_cast<float>(texture_size.x),
+                           this->world_bounds_.size.y / static_cast<float>(texture_size.y)});
+    target.draw(layer_sprite);
+}
+
+Car::Car(const sf::Texture &texture,
+         const sf::IntRect &texture_rect,
+         const sf::Color tint,
+         CarPhysicsSystem &physics_system,
+         const CarControlMode control_mode,
+         const CarConfig &config)
+    : sprite_(texture, texture_rect),
+      shadow_sprite_(texture, texture_rect),
+      tire_marks_(settings::constants::max_fresh_tire_marks),
+      physics_system_(physics_system),
+      car_index_(physics_system.create_car(control_mode, config))
+{
+    this->sprite_.setOrigin(this->sprite_.getLocalBounds().getCenter());
+    // The paint job: the shared base texture is grayscale, so the vertex color multiply produces the per-car color without a texture of its own
+    this->sprite_.setColor(tint);
+
+    // Setup shadow sprite
+    this->shadow_sprite_.setOrigin(this->shadow_sprite_.getLocalBounds().getCenter());
+    this->shadow_sprite_.setColor({0, 0, 0, 80});  // Semi-transparent black shadow
+    this->shadow_sprite_.setScale({0.9f, 0.9f});   // Slightly smaller than the car
+}
+
+void Car::reset()
+{
+    this->physics_system_.reset_car(this->car_index_);
+    this->tire_marks_.clear();
+}
+
+void Car::place_at_waypoint(const std::size_t waypoint_index)
+{
+    this->physics_system_.place_car_at_waypoint(this->car_index_, waypoint_index);
+    this->tire_marks_.clear();
+}
+
+[[nodiscard]] CarState Car::get_state() const
+{
+    return this->physics_system_.get_state(this->car_index_);
+}
+
+void Car::set_control_mode(const CarControlMode control_mode)
+{
+    this->physics_system_.set_control_mode(this->car_index_, control_mode);
+}
+
+void Car::apply_input(const CarInput &input)
+{
+    this->physics_system_.apply_input(this->car_index_, input);
+}
+
+void Car::update_visuals(const float dt,
+                         SkidMarkLayer &skid_marks)
+{
+    // Drift threshold matching the physics system's drift score logic
+    static constexpr float drift_threshold_pixels_per_second = 50.0f;  // Minimum lateral speed to count as drifting
+
+    // Spawn tire marks at wheel positions when drifting
+    const CarState state = this->physics_system_.get_state(this->car_index_);
+    if (state.lateral_slip_velocity > drift_threshold_pixels_per_second && state.speed > drift_threshold_pixels_per_second) {
+        this->spawn_tire_marks(dt, skid_marks);
+    }
+
+    // Update fresh tire marks and bake settled ones into the persistent layer
+    this->update_tire_marks(dt, skid_marks);
+}
+
+void Car::draw(sf::RenderTarget &target,
+               const float interpolation_alpha) const
+{
+    // Draw fresh tire marks first (so they appear behind everything); settled marks live in the persistent skid mark layer and are drawn by the caller before any car
+    this->draw_tire_marks(target);
+
+    // Interpolate position between the previous and current physics states
+    const float alpha = std::clamp(interpolation_alpha, 0.0f, 1.0f);
+    const CarState state = this->physics_system_.get_state(this->car_index_);
+    const sf::Vector2f previous_position = this->physics_system_.get_previous_position(this->car_index_);
+    const sf::Vector2f interpolated_position = {std::lerp(previous_position.x, state.position.x, alpha),
+                                                std::lerp(previous_position.y, state.position.y, alpha)};
+
+    // Interpolate heading along the shortest angular path to avoid a visible spin when crossing the -pi/+pi boundary
+    const float previous_heading_radians = this->physics_system_.get_previous_heading_radians(this->car_index_);
+    const float heading_difference_radians = core::math::wrap_angle(state.heading_radians - previous_heading_radians);
+    const float interpolated_heading_radians = previous_heading_radians + heading_difference_radians * alpha;
+
+    // Draw shadow (behind the car but above tire marks) using copies with the interpolated transform, keeping this method const
+    sf::Sprite interpolated_shadow_sprite = this->shadow_sprite_;
+    interpolated_shadow_sprite.setPosition({interpolated_position.x + 10.0f,
+                                            interpolated_position.y + 10.0f});
+    interpolated_shadow_sprite.setRotation(sf::radians(interpolated_heading_radians));
+    target.draw(interpolated_shadow_sprite);
+
+    // Draw the actual car on top of everything
+    sf::Sprite interpolated_sprite = this->sprite_;
+    interpolated_sprite.setPosition(interpolated_position);
+    interpolated_sprite.setRotation(sf::radians(interpolated_heading_radians));
+    target.draw(interpolated_sprite);
+}
+
+void Car::draw_tire_marks(sf::RenderTarget &target) const
+{
+    for (const std::size_t slot : this->tire_marks_.get_alive_indices()) {
+        target.draw(this->tire_marks_[slot].circle);
+    }
+}
+
+void Car::set_active(const bool active)
+{
+    this->is_active_ = active;
+
+    // If deactivating, clear existing visual effects immediately
+    if (!active) {
+        this->tire_marks_.clear();
+    }
+}
+
+void Car::spawn_tire_marks(const float dt,
+                           SkidMarkLayer &skid_marks)
+{
+    if (!this->is_active_) {
+        return;
+    }
+    if (!settings::current::tire_marks) {
+        return;
+    }
+
+    // Accumulate the delta time
+    this->tire_update_timer_ += dt;
+
+    // Calculate tire update rate from settings (convert Hz to seconds)
+    const float tire_update_rate = 1.0f / static_cast<float>(settings::current::tire_marks_rate);
+
+    // If the accumulated time does not exceed the update rate, ignore to save performance
+    if (this->tire_update_timer_ < tire_update_rate) {
+        return;
+    }
+
+    // Reset timer for next tire update cycle
+    this->tire_update_timer_ -= tire_update_rate;  // Keep any overshoot
+
+    // Constants for tire mark appearance and positioning
+    static constexpr float tire_mark_radius = 12.0f;
+    static constexpr sf::Color tire_mark_color{122, 111, 85};  // Dark brown color for sand tracks
+
+    // Get car dimensions and position for wheel positioning
+    const CarState state = this->physics_system_.get_state(this->car_index_);
+    const sf::Vector2f car_position = state.position;
+    const float car_rotation_radians = state.heading_radians;
+
+    // Approximate wheel positions based on car sprite size (71x131 pixels as per docs)
+    // We'll place wheels at corners of a smaller rectangle inside the car sprite
+    static constexpr float wheel_offset_forward = 40.0f;  // Distance from center to front/rear wheels
+    static constexpr float wheel_offset_side = 20.0f;     // Distance from center to left/right wheels
+
+    // Pre-compute relative wheel positions in local coordinates; only the rear wheels leave marks when drifting
+    static constexpr std::array<sf::Vector2f, 2> wheel_positions = {{
+        {-wheel_offset_forward, -wheel_offset_side},  // Rear-left
+        {-wheel_offset_forward, wheel_offset_side}    // Rear-right
+    }};
+
+    // Calculate wheel positions relative to car center
+    // Note: Car sprite faces right (0 degrees), so forward is +X direction
+    const core::math::SinCos rotation_sincos = core::math::fast_sincos(car_rotation_radians);
+    const float cos_rotation = rotation_sincos.cos;
+    const float sin_rotation = rotation_sincos.sin;
+
+    // Transform local wheel positions to world coordinates
+    std::array<sf::Vector2f, 2> wheel_offsets;
+    for (std::size_t i = 0; i < wheel_positions.size(); ++i) {
+        const auto &[local_x, local_y] = wheel_positions[i];
+        wheel_offsets[i] = {
+            local_x * cos_rotation - local_y * sin_rotation,
+            local_x * sin_rotation + local_y * cos_rotation};
+    }
+
+    for (const auto &offset : wheel_offsets) {
+        const sf::Vector2f mark_position = car_position + offset;
+
+        // Take a slot from the fixed pool; when it is exhausted, bake the mark immediately instead of growing, so the hard cap holds under any drift length
+        const std::size_t slot = this->tire_marks_.acquire();
+        if (slot == core::pool::FixedPool<TireMark>::invalid_index) [[unlikely]] {
+            skid_marks.stamp(mark_position, tire_mark_radius, {tire_mark_color.r, tire_mark_color.g, tire_mark_color.b, this->baked_tire_alpha_});
+            continue;
+        }
+
+        // Reconfigure the recycled slot in place; the circle's heap-allocated geometry is reused across marks
+        TireMark &mark = this->tire_marks_[slot];
+        mark.circle.setRadius(tire_mark_radius);
+        mark.circle.setOrigin({tire_mark_radius, tire_mark_radius});  // Center
+        mark.circle.setPosition(mark_position);
+        mark.circle.setFillColor(tire_mark_color);
+        mark.lifetime = this->initial_tire_lifetime_;
+    }
+}
+
+void Car::update_tire_marks(const float dt,
+                            SkidMarkLayer &skid_marks)
+{
+    if (!this->is_active_) {
+        return;
+    }
+    if (!settings::current::tire_marks) {
+        this->tire_marks_.clear();
+        return;
+    }
+
+    // Accumulate the delta time
+    this->tire_despawn_timer_ += dt;
 
-    // Advance waypoint if close enough
-    if (distance_to_current_waypoint < randomized_waypoint_reach_distance) {
-        this->current_waypoint_index_number_ = next_index;
+    // If the accumulated time does not the update rate, ignore to save performance
+    if (this->tire_despawn_timer_ < this->tire_despawn_rate_) {
+        return;
+    }
+
+    // Reset timer for next fade update cycle
+    this->tire_despawn_timer_ -= this->tire_despawn_rate_;  // Keep any overshoot
+
+    // Fade and settle the fresh marks; walking the dense alive list backwards lets settled slots be released mid-walk, since a release only disturbs entries the walk has already visited
+    const float baked_alpha = static_cast<float>(this->baked_tire_alpha_);
+    const float alpha_scale = (255.0f - baked_alpha) / this->initial_tire_lifetime_;
+    const auto &alive_indices = this->tire_marks_.get_alive_indices();
+    for (std::size_t position = alive_indices.size(); position > 0; --position) {
+        const std::size_t slot = alive_indices[position - 1];
+        TireMark &mark = this->tire_marks_[slot];
+        mark.lifetime -= this->tire_despawn_rate_;
+
+        // Settled: stamp the mark into the persistent layer once (after which it costs nothing per frame), then recycle the slot
+        if (mark.lifetime <= 0.0f) {
+            sf::Color settled_color = mark.circle.getFillColor();
+            settled_color.a = this->baked_tire_alpha_;
+            skid_marks.stamp(mark.circle.getPosition(), mark.circle.getRadius(), settled_color);
+            this->tire_marks_.release(slot);
+            continue;
+        }
+
+        // Still fresh: fade from fully opaque down to the alpha the mark settles at
+        sf::Color fading_color = mark.circle.getFillColor();
+        fading_color.a = static_cast<std::uint8_t>(baked_alpha + mark.lifetime * alpha_scale);
+        mark.circle.setFillColor(fading_color);
+    }
+}
+
+CarBatchRenderer::CarBatchRenderer(const sf::Texture &texture,
+                                   const sf::IntRect &texture_rect)
+    : texture_(&texture),
+      half_size_(static_cast<float>(texture_rect.size.x) * 0.5f,
+                 static_cast<float>(texture_rect.size.y) * 0.5f)
+{
+    // Texture coordinates are absolute pixels within the (atlas) texture, in the same corner order "append_quad()" emits positions
+    const auto left = static_cast<float>(texture_rect.position.x);
+    const auto top = static_cast<float>(texture_rect.position.y);
+    const auto right = left + static_cast<float>(texture_rect.size.x);
+    const auto bottom = top + static_cast<float>(texture_rect.size.y);
+    this->texture_corners_ = {{{left, top}, {right, top}, {right, bottom}, {left, bottom}}};
+}
+
+void CarBatchRenderer::build(const CarPhysicsSystem &car_physics,
+                             const std::span<const sf::Color> tints,
+                             const float interpolation_alpha)
+{
+    const std::size_t car_count = car_physics.size();
+    this->shadow_vertices_.clear();
+    this->body_vertices_.clear();
+    this->shadow_vertices_.reserve(car_count * 6);
+    this->body_vertices_.reserve(car_count * 6);
+
+    const float alpha = std::clamp(interpolation_alpha, 0.0f, 1.0f);
+    for (std::size_t car_index = 0; car_index < car_count; ++car_index) {
+        // Interpolate the transform exactly like "Car::draw()", so switching between the paths never makes the grid jump
+        const CarState state = car_physics.get_state(car_index);
+        const sf::Vector2f previous_position = car_physics.get_previous_position(car_index);
+        const sf::Vector2f interpolated_position = {std::lerp(previous_position.x, state.position.x, alpha),
+                                                    std::lerp(previous_position.y, state.position.y, alpha)};
+        const float previous_heading_radians = car_physics.get_previous_heading_radians(car_index);
+        const float heading_difference_radians = core::math::wrap_angle(state.heading_radians - previous_heading_radians);
+        const float interpolated_heading_radians = previous_heading_radians + heading_difference_radians * alpha;
+        const auto [sine, cosine] = core::math::fast_sincos(interpolated_heading_radians);
+
+        const sf::Color tint = car_index < tints.size() ? tints[car_index] : sf::Color::White;
+        this->append_quad(this->shadow_vertices_, interpolated_position + shadow_offset_, cosine, sine, shadow_scale_, shadow_color_);
+        this->append_quad(this->body_vertices_, interpolated_position, cosine, sine, 1.0f, tint);
     }
 }
 
+void CarBatchRenderer::draw(sf::RenderTarget &target) const
+{
+    if (this->body_vertices_.empty()) [[unlikely]] {
+        return;
+    }
+
+    // Two submissions cover the whole grid: every shadow below every body, the same layering the per-sprite path produces for a single car
+    sf::RenderStates states;
+    states.texture = this->texture_;
+    target.draw(this->shadow_vertices_.data(), this->shadow_vertices_.size(), sf::PrimitiveType::Triangles, states);
+    target.draw(this->body_vertices_.data(), this->body_vertices_.size(), sf::PrimitiveType::Triangles, states);
+}
+
+void CarBatchRenderer::append_quad(std::vector<sf::Vertex> &layer,
+                                   const sf::Vector2f center,
+                                   const float cosine,
+                                   const float sine,
+                                   const float scale,
+                                   const sf::Color color)
+{
+    // Rotate the scaled half extents once and derive all four corners from the two resulting edge vectors; same rotation convention as "sf::Transform::rotate()" (clockwise in the y-down world)
+    const float half_width = this->half_size_.x * scale;
+    const float half_height = this->half_size_.y * scale;
+    const sf::Vector2f width_edge = {half_width * cosine, half_width * sine};
+    const sf::Vector2f height_edge = {-half_height * sine, half_height * cosine};
+    const std::array<sf::Vector2f, 4> corners = {
+        center - width_edge - height_edge,   // Top-left
+        center + width_edge - height_edge,   // Top-right
+        center + width_edge + height_edge,   // Bottom-right
+        center - width_edge + height_edge};  // Bottom-left
+
+    // Two triangles per quad; "sf::PrimitiveType::Triangles" keeps every car independent within the single submission
+    layer.push_back({corners[0], color, this->texture_corners_[0]});
+    layer.push_back({corners[1], color, this->texture_corners_[1]});
+    layer.push_back({corners[2], color, this->texture_corners_[2]});
+    layer.push_back({corners[0], color, this->texture_corners_[0]});
+    layer.push_back({corners[2], color, this->texture_corners_[2]});
+    layer.push_back({corners[3], color, this->texture_corners_[3]});
+}
+
 }  // namespace game::entities
@@ -6,13 +6,17 @@
 
 #pragma once
 
+#include <array>    // for std::array
 #include <cstddef>  // for std::size_t
-#include <random>   // for std::mt19937
+#include <cstdint>  // for std::uint8_t, std::uint32_t, std::uint64_t
+#include <span>     // for std::span
 #include <vector>   // for std::vector
 
 #include <SFML/Graphics.hpp>
 
+#include "core/pool.hpp"   // Fixed-capacity pool that bounds the transient effect count to a hard cap
 #include "core/world.hpp"  // We depend on the Track class for car collision detection and waypoints
+#include "rng.hpp"         // Small per-car RNG streams, so parallel car updates never share a generator
 
 namespace game::entities {
 
@@ -127,6 +131,13 @@ struct CarConfig final {
      */
     float collision_maximum_random_bounce_angle_degrees = 35.0f;
 
+    /**
+     * @brief Radius of the circle approximating the car body for car-to-car collision, in pixels.
+     *
+     * The 71x131 car sprite is approximated by a single circle, which keeps the pair test to one distance comparison. Splitting the difference between the half-width and half-length gives believable contact for both nose-to-tail and side-by-side hits.
+     */
+    float car_collision_radius_pixels = 45.0f;
+
     /**
      * @brief Speed threshold below which the car is considered stopped for physics calculations.
      *
@@ -243,6 +254,40 @@ struct CarState final {
      */
     float drift_score;
 
+    /**
+     * @brief Number of completed laps.
+     */
+    std::uint32_t lap;
+
+    /**
+     * @brief Time spent on the current lap so far, in seconds.
+     */
+    float current_lap_time;
+
+    /**
+     * @brief Time of the most recently completed lap, in seconds; "0.0" until the first lap is finished.
+     */
+    float last_lap_time;
+
+    /**
+     * @brief Time of the fastest completed lap, in seconds; "0.0" until the first lap is finished.
+     */
+    float best_lap_time;
+
+    /**
+     * @brief Durations of the sectors completed on the current lap, in seconds; "0.0" for sectors not yet reached.
+     *
+     * The lap is split into three sectors of equal waypoint count, with the last one ending at the finish line.
+     */
+    std::array<float, 3> sector_times;
+
+    /**
+     * @brief Current race position, 1-based (1 = leader).
+     *
+     * Maintained incrementally by "CarPhysicsSystem::update_standings()" from the monotonic count of waypoints each car has passed.
+     */
+    std::size_t race_position;
+
     /**
      * @brief True if the car collided with a wall in the last frame.
      */
@@ -255,46 +300,561 @@ struct CarState final {
 };
 
 /**
- * @brief Struct representing a single tire mark left by a car wheel.
+ * @brief Structure-of-arrays physics system that owns and integrates the dynamic state of all cars.
+ *
+ * Positions, velocities, headings, steering angles, and waypoint indices live in parallel arrays so the per-step integration walks contiguous memory instead of chasing per-object layouts. This keeps the update pass cache-friendly for large grids (100+ cars), and "update_range()" allows fanning disjoint index ranges across worker threads.
  *
- * Tire marks are small dark circles that fade out over time to show where cars have been drifting or braking hard.
+ * Cars are registered via "create_car()"; the "Car" class is a thin handle over an index into this system and owns only the visual state (sprites, tire marks).
  */
-struct TireMark final {
+class CarPhysicsSystem final {
+  public:
+    /**
+     * @brief Construct a new CarPhysicsSystem object.
+     *
+     * @param rng Reference to a random number generator used to seed the per-car RNG streams.
+     * @param track Reference to the race track object for boundary, spawnpoint, and waypoint information.
+     */
+    explicit CarPhysicsSystem(core::rng::Pcg32 &rng,
+                              const core::world::Track &track);
+
+    /**
+     * @brief Register a new car and return its index into the parallel arrays.
+     *
+     * The car is placed at the track's spawn point, facing the first waypoint.
+     *
+     * @param control_mode Initial control mode (Player or AI).
+     * @param config Configuration parameters controlling acceleration, braking, steering, and collision behavior.
+     *
+     * @return Index of the newly created car (e.g., "0").
+     */
+    [[nodiscard]] std::size_t create_car(const CarControlMode control_mode,
+                                         const CarConfig &config = CarConfig());  // Use default config
+
+    /**
+     * @brief Reset a car's position, heading, velocity, and steering to initial state.
+     *
+     * @param car_index Index of the car to reset.
+     *
+     * @note This uses the internal track reference to place the car at the track's spawn point.
+     */
+    void reset_car(const std::size_t car_index);
+
+    /**
+     * @brief Reset a car, then place it on the given waypoint facing the next one.
+     *
+     * This is used to spread large AI grids along the waypoint line instead of stacking every car on the spawn point.
+     *
+     * @param car_index Index of the car to place.
+     * @param waypoint_index Index into the track's waypoint sequence; wrapped around if out of range.
+     */
+    void place_car_at_waypoint(const std::size_t car_index,
+                               const std::size_t waypoint_index);
+
+    /**
+     * @brief Remove the most recently created car, shrinking every parallel array by one slot.
+     *
+     * Only the last car can be removed, so the indices of the remaining cars stay stable.
+     *
+     * @note The "Car" handle holding the removed index must be destroyed by the caller; it is not notified.
+     */
+    void remove_last_car();
+
+    /**
+     * @brief Get the current state of a car.
+     *
+     * @param car_index Index of the car.
+     *
+     * @return CarState struct containing position, velocity, speed, steering angle, control mode, waypoint index, and drift score.
+     */
+    [[nodiscard]] CarState get_state(const std::size_t car_index) const;
+
+    /**
+     * @brief Set the control mode of a car at runtime.
+     *
+     * @param car_index Index of the car.
+     * @param control_mode New control mode (Player or AI).
+     */
+    void set_control_mode(const std::size_t car_index,
+                          const CarControlMode control_mode);
+
+    /**
+     * @brief Apply unified input for both keyboard and controller to a car.
+     *
+     * @param car_index Index of the car.
+     * @param input Input values for throttle, brake, steering, and handbrake.
+     *
+     * @note Only effective in Player mode. Supports both digital (-1/0/1) and analog input values.
+     */
+    void apply_input(const std::size_t car_index,
+                     const CarInput &input);
+
+    /**
+     * @brief Step the physics of all cars over a time interval.
+     *
+     * @param dt Time passed since the previous simulation step, in seconds.
+     *
+     * @note Call this once per fixed simulation step.
+     */
+    void update(const float dt);
+
+    /**
+     * @brief Step the physics of a contiguous range of cars over a time interval.
+     *
+     * Ranges must be disjoint when called from multiple threads; each car only touches its own array slots, its own RNG stream, and the read-only track.
+     *
+     * @param first_car_index Index of the first car in the range (inclusive).
+     * @param last_car_index Index one past the last car in the range (exclusive).
+     * @param dt Time passed since the previous simulation step, in seconds.
+     */
+    void update_range(const std::size_t first_car_index,
+                      const std::size_t last_car_index,
+                      const float dt);
+
+    /**
+     * @brief Resolve car-to-car collisions across the whole field.
+     *
+     * Cars are binned into a uniform spatial hash grid, then each car only tests against the cars in its own and neighboring cells, so the pair test cost stays O(cars) instead of O(cars^2) on the stress-test grids. Overlapping pairs are pushed apart and bounced using the collision parameters in their configs.
+     *
+     * @note Call this once per fixed simulation step, after every "update_range()" call has finished; unlike those, this touches pairs of cars and must not run concurrently with them. "update()" already includes it.
+     */
+    void resolve_car_collisions();
+
+    /**
+     * @brief Restore the race standings order after the per-car updates advanced waypoint progress.
+     *
+     * The standings are kept in a persistent array ordered by each car's monotonic count of passed waypoints, so this is a single insertion pass over an almost-sorted sequence: O(cars) when nothing changed, and only the cars whose order actually changed are moved. No per-frame rebuild or full sort happens.
+     *
+     * @note Call this once per fixed simulation step, after every "update_range()" call has finished; like "resolve_car_collisions()", it touches cross-car state and must not run concurrently with them. "update()" already includes it.
+     */
+    void update_standings();
+
+    /**
+     * @brief Get the car indices in race order (index 0 = leader).
+     *
+     * Ordered by completed laps and waypoints within the lap (via the monotonic passed-waypoint count); ties keep their previous order, so standings do not flicker between cars on the same waypoint.
+     *
+     * @return Const reference to the standings array, updated by "update_standings()".
+     */
+    [[nodiscard]] const std::vector<std::size_t> &get_standings() const;
+
+    /**
+     * @brief Get the number of registered cars.
+     *
+     * @return Number of cars (e.g., "5").
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Get the position of a car before its most recent physics step.
+     *
+     * This is used by rendering code to interpolate car transforms between the previous and current physics states.
+     *
+     * @param car_index Index of the car.
+     *
+     * @return Position in world coordinates (pixels).
+     */
+    [[nodiscard]] const sf::Vector2f &get_previous_position(const std::size_t car_index) const;
+
+    /**
+     * @brief Get the heading of a car before its most recent physics step.
+     *
+     * This is used by rendering code to interpolate car transforms between the previous and current physics states.
+     *
+     * @param car_index Index of the car.
+     *
+     * @return Heading angle in radians.
+     */
+    [[nodiscard]] float get_previous_heading_radians(const std::size_t car_index) const;
+
+    // Disable move semantics
+    CarPhysicsSystem(CarPhysicsSystem &&) = delete;
+    CarPhysicsSystem &operator=(CarPhysicsSystem &&) = delete;
+
+    // Disable copy semantics
+    CarPhysicsSystem(const CarPhysicsSystem &) = delete;
+    CarPhysicsSystem &operator=(const CarPhysicsSystem &) = delete;
+
+  private:
+    /**
+     * @brief Update waypoint tracking, lap counting, and sector timing regardless of control mode.
+     *
+     * The lap timer accumulates every step; passing a waypoint bumps the car's monotonic progress count, crossing a sector boundary records the sector split, and reaching the finish waypoint completes the lap (updating last/best lap times).
+     * Progress comes from a single lookup into the track's baked progress grid, which also yields the continuous fraction used to order cars within a waypoint.
+     *
+     * @param car_index Index of the car.
+     * @param dt Time passed since the previous simulation step, in seconds.
+     */
+    void update_waypoint_tracking(const std::size_t car_index,
+                                  const float dt);
+
+    /**
+     * @brief Rebuild the standings arrays from scratch after a car was added or removed.
+     *
+     * Cars are ordered by their monotonic passed-waypoint count; this is only called on grid size changes, never per frame.
+     */
+    void rebuild_standings();
+
+    /**
+     * @brief Update AI behavior - handles waypoint navigation and control decisions.
+     *
+     * @param car_index Index of the car.
+     * @param dt Time passed since the previous simulation step, in seconds.
+     */
+    void update_ai_behavior(const std::size_t car_index,
+                            const float dt);
+
+    /**
+     * @brief Apply physics step to a car - combines all forces, slip, and collisions.
+     *
+     * @param car_index Index of the car.
+     * @param dt Time passed since the previous simulation step, in seconds.
+     */
+    void apply_physics_step(const std::size_t car_index,
+                            const float dt);
+
+    /**
+     * @brief Compute the initial AI update timer offset for a car.
+     *
+     * Each car starts its fixed-rate AI timer at a different phase within the update period, derived from the golden-ratio sequence so the phases stay near-uniformly spread for any car count. Without this, every car crosses the AI rate threshold in the same frame and the AI cost lands as a periodic spike instead of spread load.
+     *
+     * @param car_index Index of the car.
+     *
+     * @return Timer offset in seconds, in the range [0, "ai_update_rate_").
+     */
+    [[nodiscard]] static float ai_phase_offset(const std::size_t car_index);
+
+    /**
+     * @brief Reference to the race track for collision detection and waypoint data.
+     *
+     * Used for boundary checking, collision detection, spawn point retrieval, and AI waypoint navigation.
+     */
+    const core::world::Track &track_;
+
+    /**
+     * @brief Random number generator used to seed the per-car RNG streams in "create_car()".
+     */
+    core::rng::Pcg32 &seed_rng_;
+
+    /**
+     * @brief Per-car configuration parameters.
+     */
+    std::vector<CarConfig> configs_;
+
+    /**
+     * @brief Per-car control mode (Player or AI).
+     */
+    std::vector<CarControlMode> control_modes_;
+
+    /**
+     * @brief Per-car input values for analog/digital control.
+     */
+    std::vector<CarInput> inputs_;
+
+    /**
+     * @brief Per-car position in world coordinates (pixels).
+     */
+    std::vector<sf::Vector2f> positions_;
+
+    /**
+     * @brief Per-car position before the most recent physics step, for render interpolation.
+     */
+    std::vector<sf::Vector2f> previous_positions_;
+
+    /**
+     * @brief Per-car velocity in pixels per second.
+     */
+    std::vector<sf::Vector2f> velocities_;
+
+    /**
+     * @brief Per-car heading angle in radians.
+     */
+    std::vector<float> headings_radians_;
+
+    /**
+     * @brief Per-car heading before the most recent physics step, for render interpolation.
+     */
+    std::vector<float> previous_headings_radians_;
+
+    /**
+     * @brief Per-car steering wheel angle in degrees.
+     */
+    std::vector<float> steering_wheel_angles_degrees_;
+
+    /**
+     * @brief Per-car accumulated drift score.
+     */
+    std::vector<float> drift_scores_;
+
+    /**
+     * @brief Per-car lateral slip velocity magnitude in pixels per second, cached during physics updates.
+     */
+    std::vector<float> lateral_slip_velocities_;
+
+    /**
+     * @brief Per-car speed of the last wall collision in pixels per second.
+     */
+    std::vector<float> last_wall_hit_speeds_;
+
+    /**
+     * @brief Per-car flag set when the car hit a wall in the last physics update.
+     *
+     * @note std::uint8_t is used instead of bool to avoid the std::vector<bool> bit-packing proxy.
+     */
+    std::vector<std::uint8_t> just_hit_wall_flags_;
+
+    /**
+     * @brief Per-car index of the current target waypoint, also used for race position tracking.
+     */
+    std::vector<std::size_t> waypoint_indices_;
+
+    /**
+     * @brief Number of sectors a lap is split into for split timing.
+     */
+    static constexpr std::size_t sector_count_ = 3;
+
+    /**
+     * @brief Per-car monotonic count of waypoints passed since the last reset.
+     *
+     * This is the race progress key: laps and position within the lap collapse into one ever-increasing integer, so standings comparisons are a single integer compare and never wrap.
+     */
+    std::vector<std::uint64_t> waypoints_passed_;
+
+    /**
+     * @brief Per-car continuous race progress in waypoint units (segment index plus fraction), sampled from the track's baked progress grid.
+     *
+     * Tie-breaks standings between cars that have passed the same number of waypoints; unlike "waypoints_passed_" it is not monotonic (it wraps at the finish line).
+     */
+    std::vector<float> race_progress_;
+
     /**
-     * @brief Circle representing the tire mark.
+     * @brief Per-car number of completed laps.
      */
-    sf::CircleShape circle;
+    std::vector<std::uint32_t> lap_counts_;
 
     /**
-     * @brief Remaining lifetime in seconds before this tire mark disappears.
+     * @brief Per-car time spent on the current lap so far, in seconds.
      */
-    float life_remaining;
+    std::vector<float> current_lap_times_;
+
+    /**
+     * @brief Per-car time of the most recently completed lap, in seconds; "0.0" until the first lap is finished.
+     */
+    std::vector<float> last_lap_times_;
+
+    /**
+     * @brief Per-car time of the fastest completed lap, in seconds; "0.0" until the first lap is finished.
+     */
+    std::vector<float> best_lap_times_;
+
+    /**
+     * @brief Per-car durations of the sectors completed on the current lap, in seconds; "0.0" for sectors not yet reached.
+     */
+    std::vector<std::array<float, sector_count_>> sector_times_;
+
+    /**
+     * @brief Car indices in race order (index 0 = leader), maintained incrementally by "update_standings()".
+     */
+    std::vector<std::size_t> standings_;
+
+    /**
+     * @brief Per-car position in "standings_" (0-based), the inverse mapping kept in sync with it.
+     */
+    std::vector<std::size_t> race_positions_;
+
+    /**
+     * @brief Per-car time accumulator for AI update throttling.
+     */
+    std::vector<float> ai_update_timers_;
+
+    /**
+     * @brief Per-car RNG stream, so ranges of cars can be updated from different threads without sharing a generator.
+     */
+    std::vector<core::rng::Pcg32> rngs_;
+
+    /**
+     * @brief Head car index per spatial hash bucket for the car-to-car collision broadphase; "collision_invalid_index_" marks an empty bucket.
+     *
+     * Rebuilt from scratch by every "resolve_car_collisions()" call; kept as a member so the allocation is reused across steps.
+     */
+    std::vector<std::size_t> collision_cell_heads_;
+
+    /**
+     * @brief Next car index in the same spatial hash bucket, forming per-bucket singly linked lists through the car arrays.
+     */
+    std::vector<std::size_t> collision_next_indices_;
+
+    /**
+     * @brief Sentinel marking the end of a spatial hash bucket list.
+     */
+    static constexpr std::size_t collision_invalid_index_ = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Number of spatial hash buckets; a power of two, so the hash reduces with a mask instead of a modulo.
+     */
+    static constexpr std::size_t collision_bucket_count_ = 256;
+
+    /**
+     * @brief Edge length of a spatial hash cell, in pixels.
+     *
+     * Larger than the biggest car collision diameter, so any overlapping pair is guaranteed to sit in the same or neighboring cells.
+     */
+    static constexpr float collision_cell_size_pixels_ = 128.0f;
+
+    /**
+     * @brief Maximum number of waypoints a car may be credited with in one step of waypoint tracking.
+     *
+     * A sampled segment farther ahead than this is treated as the car being behind its target (wrap-around), so cutting across the infield never skips most of a lap.
+     */
+    static constexpr std::size_t waypoint_skip_window_ = 2;
+
+    /**
+     * @brief Random variation parameters for AI behavior consistency.
+     *
+     * These provide consistent random variations for the AI's speed, steering, and braking distance calculations.
+     */
+    static constexpr float random_variation_minimum_ = 0.8f;
+    static constexpr float random_variation_maximum_ = 1.2f;
+
+    /**
+     * @brief Target interval for AI updates in seconds (1/30 = ~0.0333 seconds for 30Hz).
+     *
+     * AI behavior will only be recalculated when the car's AI timer exceeds this interval.
+     */
+    static constexpr float ai_update_rate_ = 1.0f / 30.0f;
+};
+
+/**
+ * @brief Persistent world-space decal layer that skid marks are stamped into once.
+ *
+ * The layer owns an off-screen render texture covering the track bounds. A mark is drawn into the texture a single time when it settles, after which it costs nothing per frame: "draw()" blits the whole layer as one textured quad between the track and the cars, no matter how many marks have accumulated over the session. This replaces keeping thousands of short-lived circle shapes alive and re-drawing them every frame.
+ *
+ * The texture resolution is capped, so very large tracks render the layer at a reduced scale instead of exhausting video memory; at gameplay zoom the softening is not noticeable on ground decals.
+ */
+class SkidMarkLayer final {
+  public:
+    /**
+     * @brief Construct an empty layer; call "rebuild()" with the track bounds before stamping.
+     */
+    explicit SkidMarkLayer() = default;
+
+    /**
+     * @brief Recreate the layer texture to cover the given world-space rectangle, discarding all stamped marks.
+     *
+     * The texture edge length is capped at "maximum_texture_size_"; larger bounds are covered at a proportionally reduced resolution.
+     *
+     * @param world_bounds World-space rectangle the layer must cover, typically "Track::get_world_bounds()".
+     *
+     * @note Call this after every track rebuild, since the track bounds (and the spawn of every mark) moved.
+     */
+    void rebuild(const sf::FloatRect &world_bounds);
+
+    /**
+     * @brief Erase all stamped marks without resizing the texture.
+     */
+    void clear();
+
+    /**
+     * @brief Stamp one circular mark into the layer at a world-space position.
+     *
+     * The mark is rasterized into the texture exactly once and persists until "clear()" or "rebuild()"; there is no per-mark state to update afterwards.
+     *
+     * @param world_position Center of the mark in world coordinates.
+     * @param radius Radius of the mark in world-space pixels.
+     * @param color Fill color of the mark, including its settled alpha.
+     */
+    void stamp(const sf::Vector2f &world_position,
+               const float radius,
+               const sf::Color &color);
+
+    /**
+     * @brief Draw the accumulated layer onto the provided render target as a single textured quad.
+     *
+     * @param target Target window where the layer will be drawn; draw it after the track and before the cars.
+     *
+     * @note Call this once per frame. Not const because pending stamps are flushed to the texture here, once per frame instead of once per stamp.
+     */
+    void draw(sf::RenderTarget &target);
+
+    /**
+     * @brief Get the number of marks stamped since the last "rebuild()" or "clear()".
+     *
+     * @return Number of stamped marks; intended for telemetry and diagnostics.
+     */
+    [[nodiscard]] std::size_t get_stamp_count() const { return this->stamp_count_; }
+
+    // Disable move semantics
+    SkidMarkLayer(SkidMarkLayer &&) = delete;
+    SkidMarkLayer &operator=(SkidMarkLayer &&) = delete;
+
+    // Disable copy semantics
+    SkidMarkLayer(const SkidMarkLayer &) = delete;
+    SkidMarkLayer &operator=(const SkidMarkLayer &) = delete;
+
+  private:
+    /**
+     * @brief Off-screen texture holding every stamped mark.
+     *
+     * Its view is set to the world bounds during "rebuild()", so stamping and blitting both work directly in world coordinates regardless of the resolution cap.
+     */
+    sf::RenderTexture texture_;
+
+    /**
+     * @brief World-space rectangle covered by the texture.
+     */
+    sf::FloatRect world_bounds_;
+
+    /**
+     * @brief Number of marks stamped since the last "rebuild()" or "clear()".
+     */
+    std::size_t stamp_count_ = 0;
+
+    /**
+     * @brief Whether the texture was created successfully and covers valid bounds.
+     *
+     * If creation fails (e.g., no render texture support), stamping and drawing become no-ops instead of crashing; the game just runs without persistent marks.
+     */
+    bool ready_ = false;
+
+    /**
+     * @brief Whether stamps were drawn into the texture since the last flush.
+     *
+     * "sf::RenderTexture::display()" is only called when this is set, so idle frames skip the texture update entirely.
+     */
+    bool dirty_ = false;
+
+    /**
+     * @brief Maximum edge length of the layer texture, in texels.
+     *
+     * Large enough for pixel-perfect marks on default track sizes; bigger tracks trade resolution for bounded video memory (a 4096x4096 RGBA texture is 64 MiB).
+     */
+    static constexpr unsigned maximum_texture_size_ = 4096;
 };
 
 /**
- * @brief Unified car class that supports both player and AI control modes.
+ * @brief Thin handle over a car registered in a CarPhysicsSystem.
  *
- * Provides core physics simulation, rendering, collision handling, and AI navigation in a single class.
- * Control mode can be switched both at construction time and during runtime.
+ * The physics state lives in the system's parallel arrays; this class owns only the visual state (sprites, tire marks) and forwards state queries and input to the system by index. Because the handle is lightweight and movable, cars can live contiguously in resizable containers.
  *
- * On construction, the car is initialized with a texture, position, and control mode.
+ * On construction, the car is registered with the system and placed at the track's spawn point.
  */
 class Car final {
   public:
     /**
      * @brief Construct a new Car object.
      *
-     * @param texture Reference to the SFML texture used for the car sprite. This is expected to be around 71x131 pixels.
-     * @param rng Reference to a random number generator used for random decision making (e.g., collision bounces).
-     * @param track Reference to the race track object for boundary, spawnpoint and waypoint information.
+     * @param texture Reference to the SFML texture used for the car sprite (typically the shared atlas).
+     * @param texture_rect Pixel rectangle of the car image within the texture. This is expected to be around 71x131 pixels.
+     * @param tint Paint color multiplied onto the grayscale base texture via vertex color; all cars share one texture and differ only in this tint.
+     * @param physics_system Reference to the physics system that will own this car's dynamic state.
      * @param control_mode Initial control mode (Player or AI).
      * @param config Configuration parameters controlling acceleration, braking, steering, and collision behavior.
      *
-     * @note This uses the internal track reference to place the car at the track's spawn point.
+     * @note This registers the car with the physics system, which places it at the track's spawn point.
      */
     explicit Car(const sf::Texture &texture,
-                 std::mt19937 &rng,
-                 const core::world::Track &track,
+                 const sf::IntRect &texture_rect,
+                 const sf::Color tint,
+                 CarPhysicsSystem &physics_system,
                  const CarControlMode control_mode = CarControlMode::Player,
                  const CarConfig &config = CarConfig());  // Use default config
 
@@ -303,16 +863,23 @@ class Car final {
      *
      * This is useful when rebuilding the track or resetting the game.
      *
-     * @note This uses the internal track reference to place the car at the track's spawn point.
+     * @note This uses the physics system's track reference to place the car at the track's spawn point.
      */
     void reset();
 
+    /**
+     * @brief Reset this car, then place it on the given waypoint facing the next one.
+     *
+     * @param waypoint_index Index into the track's waypoint sequence; wrapped around if out of range.
+     */
+    void place_at_waypoint(const std::size_t waypoint_index);
+
     /**
      * @brief Get the current state of the car.
      *
      * @return CarState struct containing position, velocity, speed, steering angle, control mode, waypoint index, and drift score.
      *
-     * @note This replaces individual getter methods and provides all commonly needed car information in one call.
+     * @note This forwards to the physics system and provides all commonly needed car information in one call.
      */
     [[nodiscard]] CarState get_state() const;
 
@@ -320,8 +887,6 @@ class Car final {
      * @brief Set the control mode at runtime.
      *
      * @param control_mode New control mode (Player or AI).
-     *
-     * @note When switching to AI mode, the current waypoint index is reset to ensure proper navigation.
      */
     void set_control_mode(const CarControlMode control_mode);
 
@@ -335,90 +900,98 @@ class Car final {
     void apply_input(const CarInput &input);
 
     /**
-     * @brief Update the car's physics state over a time interval.
+     * @brief Update the car's visual effects (tire marks) from the current physics state.
+     *
+     * Fresh marks live as dynamic circles for a short settle period, then get stamped once into the skid mark layer, where they persist for the session at no further cost.
      *
-     * @param dt Time passed since the previous frame, in seconds.
+     * @param dt Time passed since the previous simulation step, in seconds.
+     * @param skid_marks Persistent decal layer that settled marks are baked into.
      *
-     * @note Call this method once per frame before calling "draw()". In AI mode, this will also perform AI calculations to determine steering and throttle/brake inputs based on waypoints.
+     * @note Call this once per simulation step, after the physics system has been updated. The physics itself is stepped by "CarPhysicsSystem::update()".
      */
-    void update(const float dt);
+    void update_visuals(const float dt,
+                        SkidMarkLayer &skid_marks);
 
     /**
      * @brief Draw the car on the provided render target.
      *
+     * The drawn transform is interpolated between the previous and current physics states, so rendering stays smooth even when the simulation steps at a lower rate than the display refresh.
+     *
      * @param target Target window where the car will be drawn.
+     * @param interpolation_alpha Blend factor in the range [0, 1] between the previous physics state (0) and the current one (1) (default: "1.0").
      *
-     * @note Call this once per frame, after "update()".
+     * @note Call this once per frame, after the physics system has been updated.
      */
-    void draw(sf::RenderTarget &target) const;
+    void draw(sf::RenderTarget &target,
+              const float interpolation_alpha = 1.0f) const;
 
     /**
-     * @brief Set whether this car is the active/selected car for visual effects.
+     * @brief Draw only this car's fresh tire marks, without the sprite.
      *
-     * @param active True if this is the currently selected car, false otherwise.
+     * Used by the instanced path ("CarBatchRenderer"), which replaces the per-car sprite draws but still wants the fresh marks of the active cars on screen.
      *
-     * @note Active cars show visual effects like tire marks, particles, etc. for performance.
+     * @param target Target window where the marks will be drawn.
      */
-    void set_active(const bool active);
-
-    // Disable move semantics
-    Car(Car &&) = delete;
-    Car &operator=(Car &&) = delete;
+    void draw_tire_marks(sf::RenderTarget &target) const;
 
-    // Disable copy semantics
-    Car(const Car &) = delete;
-    Car &operator=(const Car &) = delete;
-
-  private:
     /**
-     * @brief Apply physics step to the car - combines all forces, slip, and collisions.
-     *
-     * This processes the member input flags, then runs the entire physics pipeline.
+     * @brief Set whether this car is the active/selected car for visual effects.
      *
-     * @param dt Time passed since the previous frame, in seconds.
+     * @param active True if this is the currently selected car, false otherwise.
      *
-     * @note Always call this as the final step in the update loop from "update()", before drawing the car via "draw()".
+     * @note Active cars show visual effects like tire marks, particles, etc. for performance.
      */
-    void apply_physics_step(const float dt);
+    void set_active(const bool active);
 
     /**
-     * @brief Update AI behavior - handles waypoint navigation and control decisions.
-     *
-     * @param dt Time passed since the previous frame, in seconds.
+     * @brief Get the index of this car in the physics system's parallel arrays.
      *
-     * @note This is called automatically during "update()" when in AI mode.
+     * @return Car index (e.g., "0").
      */
-    void update_ai_behavior(const float dt);
+    [[nodiscard]] std::size_t get_index() const { return this->car_index_; }
 
     /**
-     * @brief Update waypoint tracking for race position regardless of control mode.
+     * @brief Get the number of tire marks this car currently has alive.
      *
-     * @note This is called automatically during "update()" for all cars to maintain accurate race position tracking.
+     * @return Number of live tire marks; intended for telemetry and diagnostics.
      */
-    void update_waypoint_tracking();
+    [[nodiscard]] std::size_t get_tire_mark_count() const { return this->tire_marks_.size(); }
 
+    // Allow move construction but disable move assignment (due to reference members)
+    Car(Car &&) = default;
+    Car &operator=(Car &&) = delete;
+
+    // Disable copy semantics - the car index must stay unique per handle
+    Car(const Car &) = delete;
+    Car &operator=(const Car &) = delete;
+
+  private:
     /**
-     * @brief Spawn tire marks at the four wheel positions when drifting.
+     * @brief Spawn tire marks at the rear wheel positions when drifting.
      *
-     * @param dt Time passed since the previous frame, in seconds.
+     * @param dt Time passed since the previous simulation step, in seconds.
+     * @param skid_marks Persistent decal layer that marks are baked into immediately when the fresh-mark pool is exhausted.
      *
-     * @note This is called automatically during physics simulation when drift conditions are met.
+     * @note This is called automatically during "update_visuals()" when drift conditions are met.
      */
-    void spawn_tire_marks(const float dt);
+    void spawn_tire_marks(const float dt,
+                          SkidMarkLayer &skid_marks);
 
     /**
-     * @brief Update tire marks by reducing their lifetime and removing expired ones.
+     * @brief Update fresh tire marks by reducing their lifetime and baking settled ones into the layer.
      *
-     * @param dt Time passed since the previous frame, in seconds.
+     * @param dt Time passed since the previous simulation step, in seconds.
+     * @param skid_marks Persistent decal layer that settled marks are stamped into.
      *
-     * @note This is called automatically during the update loop to manage tire mark cleanup.
+     * @note This is called automatically during "update_visuals()" to manage the fresh-mark settle stage.
      */
-    void update_tire_marks(const float dt);
+    void update_tire_marks(const float dt,
+                           SkidMarkLayer &skid_marks);
 
     /**
-     * @brief Car sprite object for rendering. Also used for motion and rotation.
+     * @brief Car sprite object for rendering.
      *
-     * The sprite handles visual representation, position tracking, and rotation for physics calculations.
+     * The transform is set from the physics system's state during "draw()".
      */
     sf::Sprite sprite_;
 
@@ -428,170 +1001,203 @@ class Car final {
     sf::Sprite shadow_sprite_;
 
     /**
-     * @brief Container of tire marks left by this car's wheels.
-     *
-     * Tire marks are spawned when drifting or braking hard and automatically fade out over time.
+     * @brief One fresh tire mark occupying a pool slot during its settle period.
      */
-    std::vector<TireMark> tire_marks_;
+    struct TireMark final {
+        /**
+         * @brief Circle drawn at the wheel position while the mark is fresh.
+         *
+         * Reconfigured in place when the slot is recycled, so the shape's heap-allocated geometry is reused across marks instead of reallocated.
+         */
+        sf::CircleShape circle;
+
+        /**
+         * @brief Remaining settle time in seconds before the mark is baked into the skid mark layer.
+         */
+        float lifetime = 0.0f;
+    };
 
     /**
-     * @brief Reference to the race track for collision detection and waypoint data.
+     * @brief Fixed-capacity pool of fresh tire marks, capped at "settings::constants::max_fresh_tire_marks".
      *
-     * Used for boundary checking, collision detection, spawn point retrieval, and AI waypoint navigation.
+     * Marks occupy a slot only during their settle period before being stamped into the persistent layer, so the worst-case memory and update cost of transient marks is a constant regardless of drift length. When the pool is exhausted, new marks are baked immediately instead of growing the pool.
      */
-    const core::world::Track &track_;
+    core::pool::FixedPool<TireMark> tire_marks_;
 
     /**
-     * @brief Configuration of the car.
-     *
-     * Contains all performance parameters including acceleration, braking, steering sensitivity, and collision behavior.
+     * @brief Reference to the physics system that owns this car's dynamic state.
      */
-    const CarConfig config_;
+    CarPhysicsSystem &physics_system_;
 
     /**
-     * @brief Random number generator.
-     *
-     * Used for collision bounce randomization and AI decision variation to prevent deterministic behavior.
+     * @brief Index of this car in the physics system's parallel arrays.
      */
-    std::mt19937 &rng_;
+    std::size_t car_index_;
 
     /**
-     * @brief Current control mode (Player or AI).
+     * @brief Time accumulator for tire mark spawning throttling.
      *
-     * Determines whether the car responds to player input or follows AI waypoint navigation.
+     * This tracks elapsed time since the last tire mark spawn to limit tire mark generation for performance.
      */
-    CarControlMode control_mode_;
+    float tire_update_timer_ = 0.0f;
 
     /**
-     * @brief Last valid position of the car sprite in world coordinates (pixels).
+     * @brief Time accumulator for tire mark fade-out throttling.
      *
-     * Stored for collision recovery when the car moves off-track and needs to be restored to a legal position.
+     * This tracks elapsed time since the last tire mark fade update to limit fade calculations for performance.
      */
-    sf::Vector2f last_position_ {0.0f, 0.0f};
+    float tire_despawn_timer_ = 0.0f;
 
     /**
-     * @brief Current velocity of the car in pixels per second.
+     * @brief Target interval for tire mark fade-out updates in seconds (1/30 = ~0.0333 seconds for 30Hz).
      *
-     * Two-dimensional velocity vector used for physics calculations including acceleration, braking, and collision response.
+     * Tire mark fade calculations will only be performed when tire_despawn_timer_ exceeds this interval.
      */
-    sf::Vector2f velocity_ = {0.0f, 0.0f};
+    static constexpr float tire_despawn_rate_ = 1.0f / 30.0f;
 
     /**
-     * @brief Current input values for analog/digital control.
+     * @brief Settle time in seconds for newly spawned tire marks before they are baked into the layer.
      *
-     * Keyboard provides digital values (0.0 or 1.0), controller provides analog values (0.0 to 1.0).
-     * Updated by apply_input() and used directly by physics calculations.
+     * Fresh marks start fully opaque and fade toward the baked alpha over this period, then get stamped into the persistent layer and their pool slot is recycled. Together with the pool's hard cap, this bounds the dynamic mark count regardless of how long a drift lasts.
      */
-    CarInput current_input_;
+    static constexpr float initial_tire_lifetime_ = 0.5f;
 
     /**
-     * @brief Current steering wheel angle in degrees ranging from -maximum_steering_angle_degrees to +maximum_steering_angle_degrees.
+     * @brief Alpha that settled tire marks are baked into the layer with.
      *
-     * Positive values turn the car right, negative values turn it left.
-     * Auto-centers towards zero when no steering input is active, controlled by steering_autocenter_rate_degrees_per_second.
-     * Updated by steering input and clamped to the configured maximum steering angle limits.
+     * Below full opacity, so the sand texture stays visible through session-long mark buildup; overlapping stamps still darken naturally through alpha blending.
      */
-    float steering_wheel_angle_ = 0.0f;
+    static constexpr std::uint8_t baked_tire_alpha_ = 150;
 
     /**
-     * @brief Index of the current target waypoint for AI navigation.
+     * @brief Whether this car is currently active (selected) for visual effects.
      *
-     * Tracks which waypoint the AI car is currently navigating towards in the track's waypoint sequence.
-     * Also used for race position tracking regardless of control mode.
+     * Active cars show tire marks, particles, and other visual effects for better performance.
      */
-    std::size_t current_waypoint_index_number_ = 1;
+    bool is_active_ = true;
+};
 
+/**
+ * @brief Class that renders the entire car grid as two batched vertex-array draws.
+ *
+ * The per-sprite path ("Car::draw()") builds a transform and issues a draw call per car, which is fine for the normal handful of cars but dominates frame time for the 100-200 car stress grids. This renderer instead walks the physics state once, appends a pre-rotated quad per car into a shadow layer and a body layer, and submits each layer with a single textured draw. Every car samples the same grayscale base region and carries its paint as a per-vertex tint, so no state changes happen between cars.
+ *
+ * The built vertices are in world space, so one "build()" per frame serves every viewport; "draw()" just submits the arrays under whatever view is active.
+ */
+class CarBatchRenderer final {
+  public:
     /**
-     * @brief Current accumulated drift score for this car.
+     * @brief Construct a new CarBatchRenderer object.
      *
-     * Score increases based on drift angle magnitude, speed, and duration while the car is sliding sideways.
+     * @param texture Reference to the SFML texture containing the car image (typically the shared atlas).
+     * @param texture_rect Pixel rectangle of the car image within the texture; the same region every quad samples.
      */
-    float drift_score_ = 0.0f;
+    explicit CarBatchRenderer(const sf::Texture &texture,
+                              const sf::IntRect &texture_rect);
 
     /**
-     * @brief Current lateral slip velocity magnitude in pixels per second.
+     * @brief Rebuild the shadow and body vertex layers from the current physics state.
+     *
+     * One pass over the parallel physics arrays: each car's transform is interpolated exactly like "Car::draw()" does, then expanded into two pre-rotated quads (shadow and body) using "core::math::fast_sincos()" instead of a full "sf::Transform" build.
+     *
+     * @param car_physics Physics system holding every car's state.
+     * @param tints Per-car paint colors, indexed by physics slot; cars beyond the span's size fall back to white (untinted).
+     * @param interpolation_alpha Blend factor in the range [0, 1] between the previous physics state (0) and the current one (1) (default: "1.0").
      *
-     * This is calculated during physics updates and cached to avoid recalculation in get_state().
+     * @note Call this once per frame, after the physics system has been updated; the storage is reused, so steady-state frames do not allocate.
      */
-    float current_lateral_slip_velocity_ = 0.0f;
+    void build(const CarPhysicsSystem &car_physics,
+               const std::span<const sf::Color> tints,
+               const float interpolation_alpha = 1.0f);
 
     /**
-     * @brief True if the car hit a wall in the last physics update.
+     * @brief Submit the built layers: all shadows in one draw, then all bodies in one draw.
+     *
+     * @param target Target window where the cars will be drawn.
+     *
+     * @note Call "build()" first; drawing without a build submits nothing.
      */
-    bool just_hit_wall_ = false;
+    void draw(sf::RenderTarget &target) const;
 
     /**
-     * @brief Speed at which the last wall collision occurred in pixels per second.
+     * @brief Get the body-layer vertices built by the last "build()".
+     *
+     * @return View over the body vertices, six per car; intended for tests and diagnostics.
      */
-    float last_wall_hit_speed_ = 0.0f;
+    [[nodiscard]] std::span<const sf::Vertex> get_body_vertices() const { return this->body_vertices_; }
 
     /**
-     * @brief Distance factor for waypoint reach detection used by both AI and waypoint tracking.
+     * @brief Get the shadow-layer vertices built by the last "build()".
      *
-     * Increase = reach waypoints from farther away, decrease = must get closer to reach waypoints.
+     * @return View over the shadow vertices, six per car; intended for tests and diagnostics.
      */
-    static constexpr float waypoint_reach_factor_ = 0.65f;
+    [[nodiscard]] std::span<const sf::Vertex> get_shadow_vertices() const { return this->shadow_vertices_; }
+
+    // Allow move semantics
+    CarBatchRenderer(CarBatchRenderer &&) = default;
+    CarBatchRenderer &operator=(CarBatchRenderer &&) = default;
 
+    // Disable copy semantics - there is no reason to duplicate the vertex storage
+    CarBatchRenderer(const CarBatchRenderer &) = delete;
+    CarBatchRenderer &operator=(const CarBatchRenderer &) = delete;
+
+  private:
     /**
-     * @brief Random variation parameters for waypoint tracking consistency.
+     * @brief Append one rotated, scaled quad (two triangles, six vertices) to a layer.
      *
-     * These provide consistent random variations for waypoint reach distance calculations.
+     * @param layer Vertex layer to append to (shadow or body).
+     * @param center Quad center in world space.
+     * @param cosine Cosine of the car heading.
+     * @param sine Sine of the car heading.
+     * @param scale Uniform scale applied to the quad's half extents (e.g., "0.9" for the shadow).
+     * @param color Vertex color: the car's tint for the body layer, the translucent shadow color for the shadow layer.
      */
-    static constexpr float random_variation_minimum_ = 0.8f;
-    static constexpr float random_variation_maximum_ = 1.2f;
+    void append_quad(std::vector<sf::Vertex> &layer,
+                     const sf::Vector2f center,
+                     const float cosine,
+                     const float sine,
+                     const float scale,
+                     const sf::Color color);
 
     /**
-     * @brief Time accumulator for AI update throttling.
-     *
-     * This tracks elapsed time since last AI behavior update to limit AI calculations to maximum 30Hz for performance.
+     * @brief Offset of the shadow quad from the car position, matching "Car::draw()".
      */
-    float ai_update_timer_ = 0.0f;
+    static constexpr sf::Vector2f shadow_offset_ = {10.0f, 10.0f};
 
     /**
-     * @brief Time accumulator for tire mark spawning throttling.
-     *
-     * This tracks elapsed time since the last tire mark spawn to limit tire mark generation to 120Hz for performance.
+     * @brief Scale of the shadow quad relative to the body, matching "Car::draw()".
      */
-    float tire_update_timer_ = 0.0f;
+    static constexpr float shadow_scale_ = 0.9f;
 
     /**
-     * @brief Time accumulator for tire mark fade-out throttling.
-     *
-     * This tracks elapsed time since the last tire mark fade update to limit fade calculations to 20Hz for performance.
+     * @brief Semi-transparent black shadow color, matching "Car::draw()".
      */
-    float tire_despawn_timer_ = 0.0f;
+    static constexpr sf::Color shadow_color_ = {0, 0, 0, 80};
 
     /**
-     * @brief Target interval for AI updates in seconds (1/30 = ~0.0333 seconds for 30Hz).
-     *
-     * AI behavior will only be recalculated when ai_update_timer_ exceeds this interval.
+     * @brief Texture containing the shared car image; bound once per layer draw.
      */
-    static constexpr float ai_update_rate = 1.0f / 30.0f;
+    const sf::Texture *texture_;
 
     /**
-     * @brief Target interval for tire mark fade-out updates in seconds (1/30 = ~0.0333 seconds for 30Hz).
-     *
-     * Tire mark fade calculations will only be performed when tire_despawn_timer_ exceeds this interval.
+     * @brief Texture coordinates of the car image's corners, in the order top-left, top-right, bottom-right, bottom-left.
      */
-    static constexpr float tire_despawn_rate = 1.0f / 30.0f;
+    std::array<sf::Vector2f, 4> texture_corners_;
 
     /**
-     * @brief Initial lifetime in seconds for newly spawned tire marks before they fully fade out.
-     *
-     * Tire marks start with this lifetime and gradually fade as their remaining time decreases to zero.
-     *
-     * Longer values provide more persistent visual trails but can impact performance with many tire marks.
+     * @brief Half extents of the car image in pixels; quads are expanded around each car's center by these, mirroring the sprite's centered origin.
      */
-    static constexpr float initial_tire_lifetime_ = 0.5f;
+    sf::Vector2f half_size_;
 
-    // static constexpr float tire_mark_spawn_rate_ = 0.02f;
+    /**
+     * @brief Shadow-layer vertices, rebuilt by "build()" and reused across frames.
+     */
+    std::vector<sf::Vertex> shadow_vertices_;
 
     /**
-     * @brief Whether this car is currently active (selected) for visual effects.
-     *
-     * Active cars show tire marks, particles, and other visual effects for better performance.
+     * @brief Body-layer vertices, rebuilt by "build()" and reused across frames.
      */
-    bool is_active_ = true;
+    std::vector<sf::Vertex> body_vertices_;
 };
 
 }  // namespace game::entities
@@ -0,0 +1,367 @@
+/**
+ * @file ghost.cpp
+ */
+
+#include <algorithm>   // for std::clamp
+#include <chrono>      // for std::chrono
+#include <cmath>       // for std::lrint, std::lround, std::remainder, std::lerp
+#include <cstddef>     // for std::size_t, std::ptrdiff_t
+#include <cstdint>     // for std::uint8_t, std::uint16_t, std::uint32_t, std::int8_t, std::int16_t, std::int32_t
+#include <filesystem>  // for std::filesystem
+#include <fstream>     // for std::ifstream, std::ofstream
+#include <future>      // for std::async, std::future_status, std::launch
+#include <numbers>     // for std::numbers
+#include <utility>     // for std::move
+#include <vector>      // for std::vector
+
+#include <spdlog/spdlog.h>
+
+#include "ghost.hpp"
+
+namespace game::ghost {
+
+namespace {
+
+/**
+ * @brief Magic bytes identifying the ghost recording format ("VGH1").
+ */
+constexpr std::uint8_t magic_bytes[4] = {'V', 'G', 'H', '1'};
+
+/**
+ * @brief Number of quantization steps per pixel (1/8 px resolution).
+ */
+constexpr float position_quantization_steps_per_px = 8.0f;
+
+/**
+ * @brief Full circle in radians; headings are quantized to 16 bits over this range.
+ */
+constexpr float full_circle_radians = 2.0f * std::numbers::pi_v<float>;
+
+/**
+ * @brief Append an integral value to the byte stream in little-endian order.
+ *
+ * @tparam T Integral type to write.
+ *
+ * @param bytes Byte stream to append to.
+ * @param value Value to write.
+ */
+template <typename T>
+void write_le(std::vector<std::uint8_t> &bytes,
+              const T value)
+{
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        bytes.emplace_back(static_cast<std::uint8_t>((static_cast<std::uint32_t>(value) >> (i * 8)) & 0xFFu));
+    }
+}
+
+/**
+ * @brief Read an integral value from the byte stream in little-endian order and advance the offset.
+ *
+ * @tparam T Integral type to read.
+ *
+ * @param bytes Byte stream to read from.
+ * @param offset Current read offset, in bytes; advanced past the value.
+ *
+ * @return Value read from the stream.
+ */
+template <typename T>
+[[nodiscard]] T read_le(const std::vector<std::uint8_t> &bytes,
+                        std::size_t &offset)
+{
+    std::uint32_t accumulator = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        accumulator |= static_cast<std::uint32_t>(bytes[offset + i]) << (i * 8);
+    }
+    offset += sizeof(T);
+    return static_cast<T>(accumulator);
+}
+
+/**
+ * @brief Quantize a heading angle into 16 bits over the full circle.
+ *
+ * @param heading_radians Heading angle, in radians (any range; wrapped internally).
+ *
+ * @return Quantized heading in [0, 65535].
+ */
+[[nodiscard]] std::uint16_t quantize_heading(const float heading_radians)
+{
+    // Wrap into [0, 2*pi), then scale to the full 16-bit range; the modulo keeps 2*pi itself from overflowing to 65536
+    float wrapped = std::remainder(heading_radians, full_circle_radians);
+    if (wrapped < 0.0f) {
+        wrapped += full_circle_radians;
+    }
+    return static_cast<std::uint16_t>(std::lround(wrapped / full_circle_radians * 65536.0f) % 65536);
+}
+
+/**
+ * @brief Dequantize a 16-bit heading back into radians.
+ *
+ * @param quantized Quantized heading in [0, 65535].
+ *
+ * @return Heading angle in [0, 2*pi) radians.
+ */
+[[nodiscard]] float dequantize_heading(const std::uint16_t quantized)
+{
+    return static_cast<float>(quantized) / 65536.0f * full_circle_radians;
+}
+
+}  // namespace
+
+std::vector<std::uint8_t> encode(const GhostRecording &recording)
+{
+    // Layout: 4-byte magic, u32 sample rate in millihertz, u32 sample count,
+    // then the first sample absolutely (i32 qx, i32 qy, u16 heading, i8 steering),
+    // then each following sample delta-encoded (i16 dqx, i16 dqy, u16 heading, i8 steering)
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(16 + recording.samples.size() * 7);
+    bytes.insert(bytes.end(), std::cbegin(magic_bytes), std::cend(magic_bytes));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(std::lround(recording.sample_rate_hz * 1000.0f)));
+    write_le<std::uint32_t>(bytes, static_cast<std::uint32_t>(recording.samples.size()));
+
+    std::int32_t previous_qx = 0;
+    std::int32_t previous_qy = 0;
+    for (std::size_t i = 0; i < recording.samples.size(); ++i) {
+        const GhostSample &sample = recording.samples[i];
+        const std::int32_t qx = static_cast<std::int32_t>(std::lrint(sample.position.x * position_quantization_steps_per_px));
+        const std::int32_t qy = static_cast<std::int32_t>(std::lrint(sample.position.y * position_quantization_steps_per_px));
+        if (i == 0) {
+            // First sample is absolute, so the decoder has an anchor to accumulate deltas onto
+            write_le<std::int32_t>(bytes, qx);
+            write_le<std::int32_t>(bytes, qy);
+        }
+        else {
+            // Clamp to the i16 range; at 1/8 px resolution that still allows ~136 px of movement per sample
+            const std::int32_t dx = std::clamp(qx - previous_qx, -32768, 32767);
+            const std::int32_t dy = std::clamp(qy - previous_qy, -32768, 32767);
+            write_le<std::int16_t>(bytes, static_cast<std::int16_t>(dx));
+            write_le<std::int16_t>(bytes, static_cast<std::int16_t>(dy));
+        }
+        // Track the quantized position the decoder will reconstruct, so clamping never accumulates error
+        previous_qx = (i == 0) ? qx : previous_qx + std::clamp(qx - previous_qx, -32768, 32767);
+        previous_qy = (i == 0) ? qy : previous_qy + std::clamp(qy - previous_qy, -32768, 32767);
+        write_le<std::uint16_t>(bytes, quantize_heading(sample.heading_radians));
+        write_le<std::int8_t>(bytes, static_cast<std::int8_t>(std::clamp(std::lround(sample.steering_angle), -127L, 127L)));
+    }
+    return bytes;
+}
+
+GhostRecording decode(const std::vector<std::uint8_t> &bytes)
+{
+    GhostRecording recording;
+
+    // Validate the fixed-size header first
+    constexpr std::size_t header_size = 4 + 4 + 4;
+    if (bytes.size() < header_size ||
+        bytes[0] != magic_bytes[0] || bytes[1] != magic_bytes[1] ||
+        bytes[2] != magic_bytes[2] || bytes[3] != magic_bytes[3]) {
+        SPDLOG_WARN("Ghost recording bytes are truncated or have an unknown format, returning empty recording!");
+        return recording;
+    }
+    std::size_t offset = 4;
+    recording.sample_rate_hz = static_cast<float>(read_le<std::uint32_t>(bytes, offset)) / 1000.0f;
+    const std::size_t sample_count = read_le<std::uint32_t>(bytes, offset);
+    if (sample_count == 0) {
+        return recording;
+    }
+
+    // First sample is absolute (11 bytes), the rest are deltas (7 bytes each)
+    const std::size_t expected_size = header_size + 11 + (sample_count - 1) * 7;
+    if (bytes.size() < expected_size) {
+        SPDLOG_WARN("Ghost recording bytes are truncated ('{}' bytes, expected '{}'), returning empty recording!", bytes.size(), expected_size);
+        return recording;
+    }
+
+    recording.samples.reserve(sample_count);
+    std::int32_t qx = 0;
+    std::int32_t qy = 0;
+    for (std::size_t i = 0; i < sample_count; ++i) {
+        if (i == 0) {
+            qx = read_le<std::int32_t>(bytes, offset);
+            qy = read_le<std::int32_t>(bytes, offset);
+        }
+        else {
+            qx += read_le<std::int16_t>(bytes, offset);
+            qy += read_le<std::int16_t>(bytes, offset);
+        }
+        const std::uint16_t quantized_heading = read_le<std::uint16_t>(bytes, offset);
+        const std::int8_t quantized_steering = read_le<std::int8_t>(bytes, offset);
+        recording.samples.emplace_back(GhostSample{
+            .position = {static_cast<float>(qx) / position_quantization_steps_per_px,
+                         static_cast<float>(qy) / position_quantization_steps_per_px},
+            .heading_radians = dequantize_heading(quantized_heading),
+            .steering_angle = static_cast<float>(quantized_steering)});
+    }
+    return recording;
+}
+
+GhostRecorder::GhostRecorder(const float sample_rate_hz,
+                             const float max_seconds)
+    : sample_rate_hz_(sample_rate_hz),
+      capacity_(static_cast<std::size_t>(sample_rate_hz * max_seconds))
+{
+    // Preallocate the full window up front, so recording never allocates on the hot path
+    this->samples_.reserve(this->capacity_);
+    SPDLOG_DEBUG("GhostRecorder created with capacity for '{}' samples ('{}' Hz over '{}' seconds), exiting constructor!", this->capacity_, sample_rate_hz, max_seconds);
+}
+
+void GhostRecorder::record(const sf::Vector2f &position,
+                           const float heading_radians,
+                           const float steering_angle,
+                           const float dt)
+{
+    this->accumulation_ += dt;
+    const float sample_interval = 1.0f / this->sample_rate_hz_;
+    if (this->accumulation_ < sample_interval) [[likely]] {
+        return;
+    }
+    this->accumulation_ -= sample_interval;
+
+    const GhostSample sample = {.position = position,
+                                .heading_radians = heading_radians,
+                                .steering_angle = steering_angle};
+    if (this->samples_.size() < this->capacity_) {
+        // Still filling the preallocated buffer
+        this->samples_.emplace_back(sample);
+        return;
+    }
+
+    // Buffer is full; overwrite the oldest sample
+    this->samples_[this->next_index_] = sample;
+    this->next_index_ = (this->next_index_ + 1) % this->capacity_;
+}
+
+void GhostRecorder::clear()
+{
+    this->samples_.clear();
+    this->next_index_ = 0;
+    this->accumulation_ = 0.0f;
+}
+
+GhostRecording GhostRecorder::snapshot() const
+{
+    GhostRecording recording;
+    recording.sample_rate_hz = this->sample_rate_hz_;
+    recording.samples.reserve(this->samples_.size());
+    if (this->samples_.size() == this->capacity_) {
+        // Buffer has wrapped; the oldest sample sits at the next write position
+        recording.samples.insert(recording.samples.end(), this->samples_.cbegin() + static_cast<std::ptrdiff_t>(this->next_index_), this->samples_.cend());
+        recording.samples.insert(recording.samples.end(), this->samples_.cbegin(), this->samples_.cbegin() + static_cast<std::ptrdiff_t>(this->next_index_));
+    }
+    else {
+        recording.samples = this->samples_;
+    }
+    return recording;
+}
+
+void GhostRecorder::save(const std::filesystem::path &file_path)
+{
+    // If the previous save is still being written, skip; overlapping writes would fight over the same file anyway
+    if (this->save_future_.valid() &&
+        this->save_future_.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+        SPDLOG_WARN("Previous ghost recording is still being written, skipping this save request!");
+        return;
+    }
+
+    // Snapshot the ring on the calling thread (a flat copy); encoding and disk IO happen in the background
+    GhostRecording recording = this->snapshot();
+    this->save_future_ = std::async(std::launch::async, [recording = std::move(recording), file_path]() {
+        const std::vector<std::uint8_t> bytes = encode(recording);
+        std::filesystem::create_directories(file_path.parent_path());
+        std::ofstream ofs(file_path, std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            SPDLOG_ERROR("Cannot open ghost recording file for writing: '{}'", file_path.string());
+            return;
+        }
+        ofs.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        SPDLOG_INFO("Ghost recording with '{}' samples ('{}' bytes) was successfully saved to '{}'", recording.samples.size(), bytes.size(), file_path.string());
+    });
+}
+
+GhostRecording GhostRecorder::load(const std::filesystem::path &file_path)
+{
+    std::ifstream ifs(file_path, std::ios::binary | std::ios::ate);
+    if (!ifs) {
+        // A missing recording is the normal first-boot case, not an error
+        SPDLOG_INFO("No ghost recording found at '{}', starting without a ghost!", file_path.string());
+        return {};
+    }
+    const std::streamsize file_size = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+    std::vector<std::uint8_t> bytes(static_cast<std::size_t>(file_size));
+    if (!ifs.read(reinterpret_cast<char *>(bytes.data()), file_size)) {
+        SPDLOG_ERROR("Cannot read ghost recording file: '{}'", file_path.string());
+        return {};
+    }
+    GhostRecording recording = decode(bytes);
+    SPDLOG_INFO("Loaded ghost recording with '{}' samples from '{}'", recording.samples.size(), file_path.string());
+    return recording;
+}
+
+std::size_t GhostRecorder::size() const
+{
+    return this->samples_.size();
+}
+
+GhostCar::GhostCar(const sf::Texture &texture,
+                   const sf::IntRect &texture_rect,
+                   const sf::Color tint)
+    : sprite_(texture, texture_rect)
+{
+    this->sprite_.setOrigin(this->sprite_.getLocalBounds().getCenter());
+    this->sprite_.setColor({tint.r, tint.g, tint.b, ghost_alpha_});
+}
+
+void GhostCar::set_recording(GhostRecording recording)
+{
+    this->recording_ = std::move(recording);
+    this->playback_seconds_ = 0.0f;
+}
+
+bool GhostCar::has_recording() const
+{
+    return !this->recording_.samples.empty();
+}
+
+void GhostCar::update(const float dt)
+{
+    if (!this->has_recording()) [[unlikely]] {
+        return;
+    }
+    this->playback_seconds_ += dt;
+
+    // Loop once the playback position passes the final sample
+    const float recording_seconds = static_cast<float>(this->recording_.samples.size()) / this->recording_.sample_rate_hz;
+    if (this->playback_seconds_ >= recording_seconds) {
+        this->playback_seconds_ = 0.0f;
+    }
+}
+
+void GhostCar::draw(sf::RenderTarget &target) const
+{
+    if (!this->has_recording()) [[unlikely]] {
+        return;
+    }
+
+    // Interpolate between the two samples surrounding the playback position, so the ghost moves smoothly despite the low recording rate
+    const float sample_position = this->playback_seconds_ * this->recording_.sample_rate_hz;
+    const std::size_t first_index = std::min(static_cast<std::size_t>(sample_position), this->recording_.samples.size() - 1);
+    const std::size_t second_index = std::min(first_index + 1, this->recording_.samples.size() - 1);
+    const float alpha = std::clamp(sample_position - static_cast<float>(first_index), 0.0f, 1.0f);
+    const GhostSample &first = this->recording_.samples[first_index];
+    const GhostSample &second = this->recording_.samples[second_index];
+
+    const sf::Vector2f interpolated_position = {std::lerp(first.position.x, second.position.x, alpha),
+                                                std::lerp(first.position.y, second.position.y, alpha)};
+
+    // Interpolate heading along the shortest angular path to avoid a visible spin when crossing the wrap-around
+    const float heading_difference_radians = std::remainder(second.heading_radians - first.heading_radians, full_circle_radians);
+    const float interpolated_heading_radians = first.heading_radians + heading_difference_radians * alpha;
+
+    // Copy the sprite so this method stays const, matching how the cars draw their interpolated transforms
+    sf::Sprite interpolated_sprite = this->sprite_;
+    interpolated_sprite.setPosition(interpolated_position);
+    interpolated_sprite.setRotation(sf::radians(interpolated_heading_radians));
+    target.draw(interpolated_sprite);
+}
+
+}  // namespace game::ghost
@@ -0,0 +1,272 @@
+/**
+ * @file ghost.hpp
+ *
+ * @brief Ghost replay recording, compact binary persistence, and playback.
+ */
+
+#pragma once
+
+#include <cstddef>     // for std::size_t
+#include <cstdint>     // for std::uint8_t
+#include <filesystem>  // for std::filesystem
+#include <future>      // for std::future
+#include <vector>      // for std::vector
+
+#include <SFML/Graphics.hpp>
+
+namespace game::ghost {
+
+/**
+ * @brief Struct that represents one recorded car state sample.
+ */
+struct GhostSample final {
+    /**
+     * @brief World-space position of the car, in pixels.
+     */
+    sf::Vector2f position;
+
+    /**
+     * @brief Heading of the car, in radians.
+     */
+    float heading_radians;
+
+    /**
+     * @brief Steering wheel angle of the car, in degrees.
+     */
+    float steering_angle;
+};
+
+/**
+ * @brief Struct that represents a complete ghost recording: the sample rate plus the sample sequence.
+ */
+struct GhostRecording final {
+    /**
+     * @brief Rate at which the samples were taken, in Hz.
+     */
+    float sample_rate_hz = 30.0f;
+
+    /**
+     * @brief Recorded samples in chronological order; empty when no recording is available.
+     */
+    std::vector<GhostSample> samples;
+};
+
+/**
+ * @brief Encode a ghost recording into the compact binary format.
+ *
+ * Positions are quantized to 1/8 px and delta-encoded against the previous sample (the first sample is stored absolutely), headings are quantized to 16 bits over the full circle, and steering angles to whole degrees in a signed byte. A one-minute recording at the default 30 Hz is roughly 13 KB.
+ *
+ * @param recording Recording to encode.
+ *
+ * @return Encoded bytes, ready to be written to disk.
+ *
+ * @note The delta encoding assumes continuous motion between samples; clear the recorder when teleporting cars (e.g., on reset), otherwise a clamped delta would make the decoded path drift.
+ */
+[[nodiscard]] std::vector<std::uint8_t> encode(const GhostRecording &recording);
+
+/**
+ * @brief Decode a ghost recording from the compact binary format.
+ *
+ * @param bytes Encoded bytes, as produced by "encode()".
+ *
+ * @return Decoded recording; the sample list is empty if the bytes are truncated or not a ghost recording.
+ */
+[[nodiscard]] GhostRecording decode(const std::vector<std::uint8_t> &bytes);
+
+/**
+ * @brief Class that samples car state into a preallocated ring buffer at a fixed rate and persists it as a compact binary file.
+ *
+ * Recording is meant to be called every fixed update; it only stores a sample when enough time has accumulated, and appending to the ring never allocates. Once the buffer is full, the oldest samples are overwritten, so the recorder always holds the most recent window of driving. Saving snapshots the ring on the calling thread and performs encoding and disk IO on a background thread.
+ */
+class GhostRecorder final {
+  public:
+    /**
+     * @brief Construct a new GhostRecorder object and preallocate the ring buffer.
+     *
+     * @param sample_rate_hz Rate at which samples are taken, in Hz (default: "30.0").
+     * @param max_seconds Length of the recording window, in seconds (default: "120.0"); older samples are overwritten.
+     */
+    explicit GhostRecorder(const float sample_rate_hz = 30.0f,
+                           const float max_seconds = 120.0f);
+
+    /**
+     * @brief Default destructor.
+     *
+     * @note If a save is still being written in the background, its future blocks here until the file is finished.
+     */
+    ~GhostRecorder() = default;
+
+    // Disable copy semantics - owns a pending save future
+    GhostRecorder(const GhostRecorder &) = delete;
+    GhostRecorder &operator=(const GhostRecorder &) = delete;
+
+    // Disable move semantics - there is no reason to move a recorder between owners
+    GhostRecorder(GhostRecorder &&) = delete;
+    GhostRecorder &operator=(GhostRecorder &&) = delete;
+
+    /**
+     * @brief Feed the current car state to the recorder; a sample is stored only when the sample interval has elapsed.
+     *
+     * @param position World-space position of the car, in pixels.
+     * @param heading_radians Heading of the car, in radians.
+     * @param steering_angle Steering wheel angle of the car, in degrees.
+     * @param dt Time passed since the previous call, in seconds (e.g., the fixed timestep).
+     */
+    void record(const sf::Vector2f &position,
+                const float heading_radians,
+                const float steering_angle,
+                const float dt);
+
+    /**
+     * @brief Discard all recorded samples and restart the sample timer.
+     *
+     * @note Call this whenever the car teleports (e.g., on reset), so the delta encoding never spans a discontinuity.
+     */
+    void clear();
+
+    /**
+     * @brief Get a chronological copy of the recorded samples.
+     *
+     * @return Recording holding the sample rate and the samples, oldest first.
+     */
+    [[nodiscard]] GhostRecording snapshot() const;
+
+    /**
+     * @brief Save the recorded samples to the provided file on a background thread.
+     *
+     * The ring is snapshotted on the calling thread (a cheap copy); encoding and disk IO happen in the background. If a previous save is still being written, this call logs a warning and does nothing.
+     *
+     * @param file_path File to write (e.g., "ghost.bin" inside the application storage directory); the parent directory is created if missing.
+     */
+    void save(const std::filesystem::path &file_path);
+
+    /**
+     * @brief Load a ghost recording from the provided file.
+     *
+     * @param file_path File to read, as written by "save()".
+     *
+     * @return Decoded recording; the sample list is empty if the file is missing or corrupt (logged, not thrown).
+     */
+    [[nodiscard]] static GhostRecording load(const std::filesystem::path &file_path);
+
+    /**
+     * @brief Get the number of samples currently held in the ring buffer.
+     *
+     * @return Number of recorded samples, at most the preallocated capacity.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+  private:
+    /**
+     * @brief Rate at which samples are taken, in Hz.
+     */
+    float sample_rate_hz_;
+
+    /**
+     * @brief Maximum number of samples the ring buffer can hold.
+     */
+    std::size_t capacity_;
+
+    /**
+     * @brief Ring buffer of samples; grows up to "capacity_", then wraps around.
+     */
+    std::vector<GhostSample> samples_;
+
+    /**
+     * @brief Index of the slot that the next sample will be written to once the buffer is full.
+     */
+    std::size_t next_index_ = 0;
+
+    /**
+     * @brief Accumulated time since the last stored sample, in seconds.
+     */
+    float accumulation_ = 0.0f;
+
+    /**
+     * @brief Future of the background save task; checked before starting a new save.
+     */
+    std::future<void> save_future_;
+};
+
+/**
+ * @brief Class that plays a ghost recording back as a translucent car sprite.
+ *
+ * Playback interpolates between neighboring samples, so the ghost moves smoothly even though the recording rate is far below the display refresh rate. The playback loops when it reaches the end of the recording.
+ */
+class GhostCar final {
+  public:
+    /**
+     * @brief Construct a new GhostCar object.
+     *
+     * @param texture Texture (e.g., atlas) containing the car sprite.
+     * @param texture_rect Pixel rectangle of the car sprite within the texture.
+     * @param tint Paint color multiplied onto the grayscale base texture; typically the player car's tint, so the ghost reads as "you, earlier".
+     */
+    explicit GhostCar(const sf::Texture &texture,
+                      const sf::IntRect &texture_rect,
+                      const sf::Color tint);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~GhostCar() = default;
+
+    // Disable copy semantics - sprite holds a reference to an external texture
+    GhostCar(const GhostCar &) = delete;
+    GhostCar &operator=(const GhostCar &) = delete;
+
+    // Allow move construction but disable move assignment (due to reference members)
+    GhostCar(GhostCar &&) = default;
+    GhostCar &operator=(GhostCar &&) = delete;
+
+    /**
+     * @brief Replace the recording to play back and restart playback from the beginning.
+     *
+     * @param recording Recording to play; an empty sample list disables the ghost.
+     */
+    void set_recording(GhostRecording recording);
+
+    /**
+     * @brief Check whether a non-empty recording is loaded.
+     *
+     * @return True if the ghost has samples to play back.
+     */
+    [[nodiscard]] bool has_recording() const;
+
+    /**
+     * @brief Advance the playback position; loops at the end of the recording.
+     *
+     * @param dt Time passed since the previous frame, in seconds.
+     */
+    void update(const float dt);
+
+    /**
+     * @brief Draw the translucent ghost at the current playback position; does nothing without a recording.
+     *
+     * @param target Target to draw the ghost onto.
+     */
+    void draw(sf::RenderTarget &target) const;
+
+  private:
+    /**
+     * @brief Alpha value of the ghost sprite, so it is clearly distinguishable from real cars.
+     */
+    static constexpr std::uint8_t ghost_alpha_ = 110;
+
+    /**
+     * @brief Translucent sprite drawn at the interpolated playback position.
+     */
+    sf::Sprite sprite_;
+
+    /**
+     * @brief Recording being played back.
+     */
+    GhostRecording recording_;
+
+    /**
+     * @brief Current playback position, in seconds since the start of the recording.
+     */
+    float playback_seconds_ = 0.0f;
+};
+
+}  // namespace game::ghost
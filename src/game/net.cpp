@@ -0,0 +1,266 @@
+/**
+ * @file net.cpp
+ */
+
+#include <cstdint>  // for std::uint8_t, std::uint64_t
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/Socket.hpp>
+#include <SFML/System/Time.hpp>
+#include <spdlog/spdlog.h>
+
+#include "net.hpp"
+
+namespace game::net {
+
+namespace {
+
+/**
+ * @brief Enum of the message types exchanged between peers; the first byte of every packet.
+ */
+enum class MessageType : std::uint8_t {
+    /**
+     * @brief Handshake from host to joiner, carrying the session seed.
+     */
+    Hello = 1,
+
+    /**
+     * @brief One player input for one tick.
+     */
+    Input = 2,
+
+    /**
+     * @brief State hash for one hash-interval tick.
+     */
+    Hash = 3,
+};
+
+}  // namespace
+
+void LockstepSession::host(const unsigned short port,
+                           const std::uint64_t session_seed)
+{
+    this->disconnect();
+
+    this->listener_.setBlocking(false);
+    if (this->listener_.listen(port) != sf::Socket::Status::Done) {
+        SPDLOG_ERROR("Failed to listen on port '{}', the port may be in use", port);
+        return;
+    }
+
+    this->host_ = true;
+    this->session_seed_ = session_seed;
+    this->state_ = SessionState::Listening;
+    SPDLOG_INFO("Hosting lockstep session on port '{}' with session seed '{}'", port, session_seed);
+}
+
+void LockstepSession::join(const sf::IpAddress &address,
+                           const unsigned short port)
+{
+    this->disconnect();
+
+    // A short blocking connect keeps the API simple; two seconds is generous for a LAN and short enough to not feel like a hang in the UI
+    this->socket_.setBlocking(true);
+    if (this->socket_.connect(address, port, sf::seconds(2.0f)) != sf::Socket::Status::Done) {
+        SPDLOG_ERROR("Failed to connect to '{}:{}'", address.toString(), port);
+        return;
+    }
+    this->socket_.setBlocking(false);
+
+    this->host_ = false;
+    this->state_ = SessionState::Connecting;
+    SPDLOG_INFO("Connected to host '{}:{}', waiting for handshake", address.toString(), port);
+}
+
+void LockstepSession::disconnect()
+{
+    this->socket_.disconnect();
+    this->listener_.close();
+    this->state_ = SessionState::Disconnected;
+    this->host_ = false;
+    this->session_seed_ = 0;
+    this->current_tick_ = 0;
+    this->local_inputs_.clear();
+    this->remote_inputs_.clear();
+    this->local_hashes_.clear();
+    this->remote_hashes_.clear();
+}
+
+void LockstepSession::poll()
+{
+    if (this->state_ == SessionState::Disconnected) {
+        return;
+    }
+
+    // Hosting: promote the first (and only) peer that connects
+    if (this->state_ == SessionState::Listening) {
+        if (this->listener_.accept(this->socket_) == sf::Socket::Status::Done) {
+            this->socket_.setBlocking(false);
+            this->listener_.close();
+
+            // Hand the joiner the session seed; the session starts running on both sides once it is delivered
+            sf::Packet hello;
+            hello << static_cast<std::uint8_t>(MessageType::Hello) << this->session_seed_;
+            if (this->socket_.send(hello) != sf::Socket::Status::Done) {
+                SPDLOG_ERROR("Failed to send handshake to the peer");
+                this->disconnect();
+                return;
+            }
+            SPDLOG_INFO("Peer connected, lockstep session is running");
+            this->start_running();
+        }
+        return;
+    }
+
+    // Drain every packet that has arrived; TCP plus "sf::Packet" handles framing, so each receive yields exactly one message
+    sf::Packet packet;
+    sf::Socket::Status status = this->socket_.receive(packet);
+    while (status == sf::Socket::Status::Done) {
+        this->handle_packet(packet);
+        packet.clear();
+        status = this->socket_.receive(packet);
+    }
+
+    if (status == sf::Socket::Status::Disconnected || status == sf::Socket::Status::Error) [[unlikely]] {
+        SPDLOG_WARN("Peer disconnected, ending the lockstep session");
+        this->disconnect();
+    }
+}
+
+void LockstepSession::submit_local_input(const PeerInput &input)
+{
+    if (this->state_ != SessionState::Running) {
+        return;
+    }
+
+    // While a tick is stalled waiting for the peer, this is called again with the same target tick; only the first submission counts, so a stall cannot overwrite or resend
+    const std::uint64_t target_tick = this->current_tick_ + input_delay_ticks;
+    if (this->local_inputs_.contains(target_tick)) {
+        return;
+    }
+    this->local_inputs_.emplace(target_tick, input);
+
+    sf::Packet packet;
+    packet << static_cast<std::uint8_t>(MessageType::Input) << target_tick
+           << input.throttle << input.brake << input.steering << input.handbrake;
+    if (this->socket_.send(packet) != sf::Socket::Status::Done) [[unlikely]] {
+        // Partial sends do not happen with packets this small; treat any failure as a dead connection
+        SPDLOG_WARN("Failed to send input for tick '{}', ending the lockstep session", target_tick);
+        this->disconnect();
+    }
+}
+
+bool LockstepSession::try_get_tick_inputs(PeerInput &local_input,
+                                          PeerInput &remote_input)
+{
+    if (this->state_ != SessionState::Running) {
+        return false;
+    }
+
+    const auto local_it = this->local_inputs_.find(this->current_tick_);
+    const auto remote_it = this->remote_inputs_.find(this->current_tick_);
+    if (local_it == this->local_inputs_.end() || remote_it == this->remote_inputs_.end()) {
+        return false;
+    }
+
+    local_input = local_it->second;
+    remote_input = remote_it->second;
+    return true;
+}
+
+void LockstepSession::complete_tick(const std::uint64_t state_hash)
+{
+    if (this->state_ != SessionState::Running) {
+        return;
+    }
+
+    this->local_inputs_.erase(this->current_tick_);
+    this->remote_inputs_.erase(this->current_tick_);
+
+    if (this->current_tick_ % hash_interval_ticks == 0) {
+        this->local_hashes_.emplace(this->current_tick_, state_hash);
+
+        sf::Packet packet;
+        packet << static_cast<std::uint8_t>(MessageType::Hash) << this->current_tick_ << state_hash;
+        if (this->socket_.send(packet) != sf::Socket::Status::Done) [[unlikely]] {
+            SPDLOG_WARN("Failed to send state hash for tick '{}', ending the lockstep session", this->current_tick_);
+            this->disconnect();
+            return;
+        }
+        this->check_hashes(this->current_tick_);
+    }
+
+    ++this->current_tick_;
+}
+
+void LockstepSession::handle_packet(sf::Packet &packet)
+{
+    std::uint8_t raw_type = 0;
+    if (!(packet >> raw_type)) [[unlikely]] {
+        SPDLOG_WARN("Received a malformed packet, ignoring it");
+        return;
+    }
+
+    switch (static_cast<MessageType>(raw_type)) {
+    case MessageType::Hello: {
+        std::uint64_t seed = 0;
+        if (packet >> seed && this->state_ == SessionState::Connecting) {
+            this->session_seed_ = seed;
+            SPDLOG_INFO("Handshake received with session seed '{}', lockstep session is running", seed);
+            this->start_running();
+        }
+        break;
+    }
+    case MessageType::Input: {
+        std::uint64_t tick = 0;
+        PeerInput input = {};
+        if (packet >> tick >> input.throttle >> input.brake >> input.steering >> input.handbrake) {
+            this->remote_inputs_.emplace(tick, input);
+        }
+        break;
+    }
+    case MessageType::Hash: {
+        std::uint64_t tick = 0;
+        std::uint64_t hash = 0;
+        if (packet >> tick >> hash) {
+            this->remote_hashes_.emplace(tick, hash);
+            this->check_hashes(tick);
+        }
+        break;
+    }
+    default:
+        SPDLOG_WARN("Received unknown message type '{}', ignoring it", raw_type);
+        break;
+    }
+}
+
+void LockstepSession::check_hashes(const std::uint64_t tick)
+{
+    const auto local_it = this->local_hashes_.find(tick);
+    const auto remote_it = this->remote_hashes_.find(tick);
+    if (local_it == this->local_hashes_.end() || remote_it == this->remote_hashes_.end()) {
+        return;
+    }
+
+    if (local_it->second != remote_it->second) [[unlikely]] {
+        SPDLOG_ERROR("State hash mismatch at tick '{}' (local '{}', remote '{}'), the simulations have diverged!", tick, local_it->second, remote_it->second);
+        this->state_ = SessionState::Diverged;
+    }
+
+    this->local_hashes_.erase(local_it);
+    this->remote_hashes_.erase(remote_it);
+}
+
+void LockstepSession::start_running()
+{
+    // Both sides seed the first ticks with neutral input, so the simulation can start immediately; real inputs begin landing at "input_delay_ticks"
+    for (std::uint64_t tick = 0; tick < input_delay_ticks; ++tick) {
+        this->local_inputs_.emplace(tick, PeerInput{});
+        this->remote_inputs_.emplace(tick, PeerInput{});
+    }
+    this->current_tick_ = 0;
+    this->state_ = SessionState::Running;
+}
+
+}  // namespace game::net
@@ -0,0 +1,323 @@
+/**
+ * @file net.hpp
+ *
+ * @brief Input-lockstep LAN networking for head-to-head races.
+ */
+
+#pragma once
+
+#include <bit>            // for std::bit_cast
+#include <cstdint>        // for std::uint32_t, std::uint64_t
+#include <unordered_map>  // for std::unordered_map
+
+#include <SFML/Network.hpp>
+
+namespace game::net {
+
+/**
+ * @brief Default TCP port the lockstep session listens and connects on.
+ */
+inline constexpr unsigned short default_port = 27015;
+
+/**
+ * @brief Number of ticks a local input is delayed before the simulation consumes it.
+ *
+ * Both peers schedule every input this many ticks into the future, so the packet has that long to cross the wire before the receiving simulation needs it. Three ticks at 120 Hz is 25 ms — comfortably above LAN round trips — while staying below the threshold where steering feels detached.
+ */
+inline constexpr std::uint64_t input_delay_ticks = 3;
+
+/**
+ * @brief Ticks between state hash exchanges; 120 compares the full simulation state once per second.
+ */
+inline constexpr std::uint64_t hash_interval_ticks = 120;
+
+/**
+ * @brief Enum of the states a lockstep session moves through.
+ */
+enum class SessionState {
+    /**
+     * @brief No session; the default state and the state after "disconnect()".
+     */
+    Disconnected,
+
+    /**
+     * @brief Hosting: listening for the peer to connect.
+     */
+    Listening,
+
+    /**
+     * @brief Joined and waiting for the host's handshake (session seed).
+     */
+    Connecting,
+
+    /**
+     * @brief Both peers connected and exchanging inputs; the simulation may run.
+     */
+    Running,
+
+    /**
+     * @brief The periodic state hashes disagreed; the simulations have drifted apart and the race result is void.
+     */
+    Diverged,
+};
+
+/**
+ * @brief Struct that represents one player's input for one tick, as it crosses the wire.
+ *
+ * This is deliberately not the physics module's input type: networking only defines the wire format, and the application layer translates between the two. The fields mirror what the physics consumes, so the translation is a plain member-by-member copy.
+ */
+struct PeerInput final {
+    /**
+     * @brief Throttle amount in the "[0, 1]" range.
+     */
+    float throttle = 0.0f;
+
+    /**
+     * @brief Brake amount in the "[0, 1]" range.
+     */
+    float brake = 0.0f;
+
+    /**
+     * @brief Steering amount in the "[-1, 1]" range, where negative is left.
+     */
+    float steering = 0.0f;
+
+    /**
+     * @brief Handbrake amount in the "[0, 1]" range.
+     */
+    float handbrake = 0.0f;
+};
+
+/**
+ * @brief Class that accumulates a hash of the deterministic simulation state, one float at a time.
+ *
+ * FNV-1a over the bit patterns of the mixed values, so "-0.0 != 0.0" and NaN payloads count as divergence too; equality of the bits is the contract, not float equality. The caller decides what to feed in (the application hashes each car's position, velocity, and heading in car-index order); two machines mixing the same values in the same order produce the same hash, so any divergence in the physics (uninitialized state, float environment differences, iteration-order dependence) shows up as a mismatch.
+ */
+class StateHash final {
+  public:
+    /**
+     * @brief Mix one float into the hash.
+     *
+     * @param value Value to mix; its bit pattern is hashed, not its numeric value.
+     */
+    void mix(const float value)
+    {
+        std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+        for (int byte = 0; byte < 4; ++byte) {
+            this->hash_ ^= bits & 0xffu;
+            this->hash_ *= 1099511628211ull;
+            bits >>= 8u;
+        }
+    }
+
+    /**
+     * @brief Get the accumulated hash.
+     *
+     * @return 64-bit hash of every value mixed so far.
+     */
+    [[nodiscard]] std::uint64_t get() const { return this->hash_; }
+
+  private:
+    /**
+     * @brief Accumulated FNV-1a hash, starting at the 64-bit offset basis.
+     */
+    std::uint64_t hash_ = 14695981039346656037ull;
+};
+
+/**
+ * @brief Class that runs an input-lockstep race between two machines on a LAN.
+ *
+ * Peers exchange only "PeerInput" structs (a few bytes per tick) over TCP; each machine simulates the identical deterministic world, so no car state ever crosses the wire. A tick may only be simulated once both its inputs are present ("try_get_tick_inputs()"), which is the lockstep: the faster machine stalls until the slower one's input arrives. Inputs are scheduled "input_delay_ticks" ahead, so on a healthy LAN the stall never happens. Every "hash_interval_ticks", both peers exchange a hash of their full physics state; a mismatch flags the session as diverged instead of letting the race silently split into two different realities.
+ *
+ * The host's session seed is handed to the joiner during the handshake; both machines must seed their RNG and track from it (and spawn the same car grid) before the first tick.
+ */
+class LockstepSession final {
+  public:
+    /**
+     * @brief Default constructor; the session starts disconnected.
+     */
+    explicit LockstepSession() = default;
+
+    /**
+     * @brief Default destructor; sockets close themselves.
+     */
+    ~LockstepSession() = default;
+
+    // Disable copy semantics - owns sockets
+    LockstepSession(const LockstepSession &) = delete;
+    LockstepSession &operator=(const LockstepSession &) = delete;
+
+    // Disable move semantics - created once and polled every frame
+    LockstepSession(LockstepSession &&) = delete;
+    LockstepSession &operator=(LockstepSession &&) = delete;
+
+    /**
+     * @brief Start hosting: listen for the peer and offer the given session seed.
+     *
+     * @param port TCP port to listen on (e.g., "default_port").
+     * @param session_seed Seed the deterministic simulation on both machines will use; sent to the joiner during the handshake.
+     */
+    void host(const unsigned short port,
+              const std::uint64_t session_seed);
+
+    /**
+     * @brief Join a hosted session.
+     *
+     * The connect itself blocks for at most a couple of seconds; the handshake (receiving the host's session seed) completes asynchronously in "poll()".
+     *
+     * @param address IP address of the hosting machine (e.g., "192.168.0.10").
+     * @param port TCP port the host is listening on (e.g., "default_port").
+     */
+    void join(const sf::IpAddress &address,
+              const unsigned short port);
+
+    /**
+     * @brief Tear the session down and return to the disconnected state.
+     */
+    void disconnect();
+
+    /**
+     * @brief Pump the sockets: accept the peer, complete the handshake, and buffer incoming inputs and hashes.
+     *
+     * @note Call this once per frame while the session is not disconnected; it never blocks.
+     */
+    void poll();
+
+    /**
+     * @brief Get the current session state.
+     *
+     * @return Current state (e.g., "SessionState::Running").
+     */
+    [[nodiscard]] SessionState get_state() const { return this->state_; }
+
+    /**
+     * @brief Check whether the session is running and the simulation may step.
+     *
+     * @return True if both peers are connected and exchanging inputs; false otherwise.
+     */
+    [[nodiscard]] bool is_running() const { return this->state_ == SessionState::Running; }
+
+    /**
+     * @brief Check whether this machine is the host.
+     *
+     * The host's input drives the first car on both machines and the joiner's input the second, so the mapping must be mirrored, not symmetric.
+     *
+     * @return True if this machine called "host()"; false if it called "join()".
+     */
+    [[nodiscard]] bool is_host() const { return this->host_; }
+
+    /**
+     * @brief Get the seed both machines must build their deterministic session from.
+     *
+     * @return Session seed; only meaningful once the session is running.
+     */
+    [[nodiscard]] std::uint64_t get_session_seed() const { return this->session_seed_; }
+
+    /**
+     * @brief Get the tick the simulation is currently waiting to execute.
+     *
+     * @return Tick number, starting at "0" when the session starts running.
+     */
+    [[nodiscard]] std::uint64_t get_current_tick() const { return this->current_tick_; }
+
+    /**
+     * @brief Schedule the local input for future consumption and send it to the peer.
+     *
+     * The input is stored (and transmitted) for "current tick + input_delay_ticks". Repeated calls while the same tick is stalled are no-ops, so calling this every simulation attempt is safe.
+     *
+     * @param input Local player's input this tick.
+     */
+    void submit_local_input(const PeerInput &input);
+
+    /**
+     * @brief Try to fetch both inputs for the current tick.
+     *
+     * @param local_input Output: the local input scheduled for this tick.
+     * @param remote_input Output: the peer's input for this tick.
+     *
+     * @return True if both inputs are present and the tick may be simulated; false if the peer's input has not arrived yet (the caller must stall the simulation and retry after the next "poll()").
+     */
+    [[nodiscard]] bool try_get_tick_inputs(PeerInput &local_input,
+                                           PeerInput &remote_input);
+
+    /**
+     * @brief Mark the current tick as simulated and advance to the next one.
+     *
+     * On hash-interval ticks, the provided state hash is recorded and sent to the peer; a mismatch against the peer's hash for the same tick moves the session to "SessionState::Diverged".
+     *
+     * @param state_hash Hash of the physics state after simulating this tick (see "StateHash"); only read on hash-interval ticks, pass "0" otherwise if computing it is inconvenient.
+     */
+    void complete_tick(const std::uint64_t state_hash);
+
+  private:
+    /**
+     * @brief Process one received packet: buffer an input, record a hash, or complete the handshake.
+     *
+     * @param packet Packet received from the peer.
+     */
+    void handle_packet(sf::Packet &packet);
+
+    /**
+     * @brief Compare the local and remote hash for a tick, if both are present, and flag divergence.
+     *
+     * @param tick Tick the hashes were taken at.
+     */
+    void check_hashes(const std::uint64_t tick);
+
+    /**
+     * @brief Enter the running state and pre-fill the first "input_delay_ticks" ticks with neutral inputs on both sides, mirroring what the peer does.
+     */
+    void start_running();
+
+    /**
+     * @brief Listener socket used while hosting.
+     */
+    sf::TcpListener listener_;
+
+    /**
+     * @brief Connection to the peer.
+     */
+    sf::TcpSocket socket_;
+
+    /**
+     * @brief Current session state.
+     */
+    SessionState state_ = SessionState::Disconnected;
+
+    /**
+     * @brief Whether this machine is the host.
+     */
+    bool host_ = false;
+
+    /**
+     * @brief Seed the deterministic session is built from; chosen by the host, received by the joiner.
+     */
+    std::uint64_t session_seed_ = 0;
+
+    /**
+     * @brief Tick the simulation is currently waiting to execute.
+     */
+    std::uint64_t current_tick_ = 0;
+
+    /**
+     * @brief Local inputs scheduled by tick; entries are erased as ticks complete.
+     */
+    std::unordered_map<std::uint64_t, PeerInput> local_inputs_;
+
+    /**
+     * @brief Peer inputs received by tick; entries are erased as ticks complete.
+     */
+    std::unordered_map<std::uint64_t, PeerInput> remote_inputs_;
+
+    /**
+     * @brief Local state hashes by tick, kept until the peer's hash for the same tick arrives.
+     */
+    std::unordered_map<std::uint64_t, std::uint64_t> local_hashes_;
+
+    /**
+     * @brief Peer state hashes by tick, kept until the local hash for the same tick is computed.
+     */
+    std::unordered_map<std::uint64_t, std::uint64_t> remote_hashes_;
+};
+
+}  // namespace game::net
@@ -0,0 +1,162 @@
+/**
+ * @file particles.cpp
+ */
+
+#include <algorithm>  // for std::clamp
+#include <cmath>      // for std::cos, std::sin
+#include <cstddef>    // for std::size_t
+#include <cstdint>    // for std::uint8_t
+#include <numbers>    // for std::numbers
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "particles.hpp"
+#include "rng.hpp"
+
+namespace game::particles {
+
+ParticleSystem::ParticleSystem(const core::rng::Pcg32 rng)
+    : rng_(rng)
+{
+    // Preallocate everything up front, so emission and the per-step update never touch the heap
+    this->positions_x_.resize(ParticleSystem::capacity_);
+    this->positions_y_.resize(ParticleSystem::capacity_);
+    this->velocities_x_.resize(ParticleSystem::capacity_);
+    this->velocities_y_.resize(ParticleSystem::capacity_);
+    this->ages_.resize(ParticleSystem::capacity_);
+    this->lifetimes_.resize(ParticleSystem::capacity_);
+    this->sizes_.resize(ParticleSystem::capacity_);
+    this->colors_.resize(ParticleSystem::capacity_);
+    this->vertices_.resize(ParticleSystem::capacity_ * 6);
+}
+
+void ParticleSystem::emit_sparks(const sf::Vector2f position,
+                                 const float impact_speed)
+{
+    // Scale the burst size with the impact severity, so a glancing scrape throws a few sparks and a head-on hit throws a shower
+    const float severity = std::clamp(impact_speed / ParticleSystem::max_burst_impact_speed_, 0.0f, 1.0f);
+    const std::size_t burst_count = ParticleSystem::min_sparks_per_impact_ + static_cast<std::size_t>(severity * static_cast<float>(ParticleSystem::max_sparks_per_impact_ - ParticleSystem::min_sparks_per_impact_));
+
+    for (std::size_t spark = 0; spark < burst_count; ++spark) {
+        // Sparks fly out in all directions; the speed scales with severity, so hard hits scatter farther
+        const float angle = this->rng_.uniform(0.0f, 2.0f * std::numbers::pi_v<float>);
+        const float speed = this->rng_.uniform(120.0f, 280.0f) * (0.5f + severity);
+        this->emit(position,
+                   {std::cos(angle) * speed, std::sin(angle) * speed},
+                   this->rng_.uniform(0.15f, 0.45f),
+                   this->rng_.uniform(3.0f, 6.0f),
+                   ParticleSystem::spark_color_);
+    }
+}
+
+void ParticleSystem::emit_drift_smoke(const sf::Vector2f position,
+                                      const float lateral_slip_velocity)
+{
+    if (lateral_slip_velocity < ParticleSystem::drift_threshold_pixels_per_second_) [[likely]] {
+        return;
+    }
+
+    // One puff per fixed step with slight positional jitter; the puffs drift slowly and fade, merging into a trail behind the sliding car
+    const sf::Vector2f jittered = position + sf::Vector2f{this->rng_.uniform(-10.0f, 10.0f), this->rng_.uniform(-10.0f, 10.0f)};
+    this->emit(jittered,
+               {this->rng_.uniform(-40.0f, 40.0f), this->rng_.uniform(-40.0f, 40.0f)},
+               this->rng_.uniform(0.4f, 0.9f),
+               this->rng_.uniform(8.0f, 18.0f),
+               ParticleSystem::smoke_color_);
+}
+
+void ParticleSystem::update(const float dt)
+{
+    // Integrate and age in straight passes over the parallel arrays; each loop touches one or two contiguous float arrays, which is what lets the compiler vectorize them
+    for (std::size_t i = 0; i < this->alive_count_; ++i) {
+        this->positions_x_[i] += this->velocities_x_[i] * dt;
+    }
+    for (std::size_t i = 0; i < this->alive_count_; ++i) {
+        this->positions_y_[i] += this->velocities_y_[i] * dt;
+    }
+    for (std::size_t i = 0; i < this->alive_count_; ++i) {
+        this->ages_[i] += dt;
+    }
+
+    // Retire expired particles by swapping the last live particle into the freed slot, keeping the live range dense; order between particles does not matter visually
+    for (std::size_t i = 0; i < this->alive_count_;) {
+        if (this->ages_[i] >= this->lifetimes_[i]) {
+            const std::size_t last = --this->alive_count_;
+            this->positions_x_[i] = this->positions_x_[last];
+            this->positions_y_[i] = this->positions_y_[last];
+            this->velocities_x_[i] = this->velocities_x_[last];
+            this->velocities_y_[i] = this->velocities_y_[last];
+            this->ages_[i] = this->ages_[last];
+            this->lifetimes_[i] = this->lifetimes_[last];
+            this->sizes_[i] = this->sizes_[last];
+            this->colors_[i] = this->colors_[last];
+        }
+        else {
+            ++i;
+        }
+    }
+
+    // Rebuild the vertex array once per step instead of once per draw, so split-screen viewports submit the same batch without re-tessellating
+    this->vertex_count_ = 0;
+    for (std::size_t i = 0; i < this->alive_count_; ++i) {
+        // Fade the alpha linearly from the base value to zero over the lifetime
+        sf::Color color = this->colors_[i];
+        const float life_fraction = 1.0f - this->ages_[i] / this->lifetimes_[i];
+        color.a = static_cast<std::uint8_t>(static_cast<float>(color.a) * life_fraction);
+
+        const float half = this->sizes_[i] * 0.5f;
+        const sf::Vector2f top_left = {this->positions_x_[i] - half, this->positions_y_[i] - half};
+        const sf::Vector2f top_right = {this->positions_x_[i] + half, this->positions_y_[i] - half};
+        const sf::Vector2f bottom_left = {this->positions_x_[i] - half, this->positions_y_[i] + half};
+        const sf::Vector2f bottom_right = {this->positions_x_[i] + half, this->positions_y_[i] + half};
+
+        // Two triangles per particle; untextured, so the whole pool renders with one draw call and zero texture binds
+        sf::Vertex *quad = &this->vertices_[this->vertex_count_];
+        quad[0] = {.position = top_left, .color = color, .texCoords = {}};
+        quad[1] = {.position = top_right, .color = color, .texCoords = {}};
+        quad[2] = {.position = bottom_right, .color = color, .texCoords = {}};
+        quad[3] = {.position = top_left, .color = color, .texCoords = {}};
+        quad[4] = {.position = bottom_right, .color = color, .texCoords = {}};
+        quad[5] = {.position = bottom_left, .color = color, .texCoords = {}};
+        this->vertex_count_ += 6;
+    }
+}
+
+void ParticleSystem::draw(sf::RenderTarget &target) const
+{
+    if (this->vertex_count_ == 0) [[unlikely]] {
+        return;
+    }
+    target.draw(this->vertices_.data(), this->vertex_count_, sf::PrimitiveType::Triangles);
+}
+
+std::size_t ParticleSystem::get_alive_count() const
+{
+    return this->alive_count_;
+}
+
+void ParticleSystem::emit(const sf::Vector2f position,
+                          const sf::Vector2f velocity,
+                          const float lifetime,
+                          const float size,
+                          const sf::Color color)
+{
+    if (this->alive_count_ == ParticleSystem::capacity_) [[unlikely]] {
+        return;
+    }
+    const std::size_t slot = this->alive_count_++;
+    this->positions_x_[slot] = position.x;
+    this->positions_y_[slot] = position.y;
+    this->velocities_x_[slot] = velocity.x;
+    this->velocities_y_[slot] = velocity.y;
+    this->ages_[slot] = 0.0f;
+    this->lifetimes_[slot] = lifetime;
+    this->sizes_[slot] = size;
+    this->colors_[slot] = color;
+}
+
+}  // namespace game::particles
@@ -0,0 +1,206 @@
+/**
+ * @file particles.hpp
+ *
+ * @brief Pooled particle effects (drift smoke, collision sparks) with batched rendering.
+ */
+
+#pragma once
+
+#include <cstddef>  // for std::size_t
+#include <vector>   // for std::vector
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "memory.hpp"
+#include "rng.hpp"
+
+namespace game::particles {
+
+/**
+ * @brief Class that owns a fixed pool of short-lived particles and renders them all in one draw call.
+ *
+ * The pool is preallocated once and particle state lives in parallel arrays (structure-of-arrays), so the per-step integrate-and-fade pass is a handful of tight loops over contiguous floats with no allocation and no per-particle objects. Dead particles are compacted by swapping the last live particle into their slot, keeping the live range dense. "update()" also rebuilds the untextured vertex array, so "draw()" is a single submit that can be repeated cheaply per split-screen viewport.
+ *
+ * Emission hooks onto the car events that already exist: wall impacts spawn spark bursts and sustained lateral slip spawns smoke puffs.
+ */
+class ParticleSystem final {
+  public:
+    /**
+     * @brief Construct a new ParticleSystem object and preallocate the pool.
+     *
+     * @param rng Random number generator stream used for emission jitter (directions, lifetimes, sizes).
+     */
+    explicit ParticleSystem(const core::rng::Pcg32 rng);
+
+    /**
+     * @brief Default destructor.
+     */
+    ~ParticleSystem() = default;
+
+    // Disable copy semantics
+    ParticleSystem(const ParticleSystem &) = delete;
+    ParticleSystem &operator=(const ParticleSystem &) = delete;
+
+    // Disable move semantics
+    ParticleSystem(ParticleSystem &&) = delete;
+    ParticleSystem &operator=(ParticleSystem &&) = delete;
+
+    /**
+     * @brief Spawn a burst of sparks for a wall impact; the burst size scales with the impact speed.
+     *
+     * @param position World-space position of the impact, in pixels.
+     * @param impact_speed Speed at which the car hit the wall, in pixels per second; impacts below the audible wall-hit range spawn the minimum burst.
+     */
+    void emit_sparks(const sf::Vector2f position,
+                     const float impact_speed);
+
+    /**
+     * @brief Spawn one smoke puff for a drifting car; does nothing below the drift threshold.
+     *
+     * Call this every fixed step per car; at the fixed timestep the per-step puffs merge into a continuous trail.
+     *
+     * @param position World-space position of the car, in pixels.
+     * @param lateral_slip_velocity Current lateral slip velocity magnitude in pixels per second.
+     */
+    void emit_drift_smoke(const sf::Vector2f position,
+                          const float lateral_slip_velocity);
+
+    /**
+     * @brief Integrate positions, age and fade every live particle, retire expired ones, and rebuild the vertex array.
+     *
+     * @param dt Time passed since the previous simulation step, in seconds (e.g., the fixed timestep).
+     */
+    void update(const float dt);
+
+    /**
+     * @brief Draw every live particle with a single untextured vertex-array draw call.
+     *
+     * @param target Render target (e.g., window) to draw the particles in.
+     */
+    void draw(sf::RenderTarget &target) const;
+
+    /**
+     * @brief Get the number of currently live particles.
+     *
+     * @return Live particle count; at most the pool capacity.
+     */
+    [[nodiscard]] std::size_t get_alive_count() const;
+
+  private:
+    /**
+     * @brief Append one particle to the pool; silently dropped when the pool is full.
+     *
+     * Dropping is the cheapest overflow policy and visually invisible: the pool only fills during extreme pileups, and every particle already dies within a second.
+     *
+     * @param position World-space spawn position, in pixels.
+     * @param velocity World-space velocity, in pixels per second.
+     * @param lifetime Time until the particle is retired, in seconds.
+     * @param size Edge length of the rendered quad, in pixels.
+     * @param color Base color including the starting alpha; the alpha fades linearly to zero over the lifetime.
+     */
+    void emit(const sf::Vector2f position,
+              const sf::Vector2f velocity,
+              const float lifetime,
+              const float size,
+              const sf::Color color);
+
+    /**
+     * @brief Hard capacity of the particle pool.
+     *
+     * This bounds the worst-case memory and per-step update cost to a constant; sized for a full stress-test grid drifting and colliding at once, with headroom.
+     */
+    static constexpr std::size_t capacity_ = 4096;
+
+    /**
+     * @brief Minimum lateral slip velocity required to spawn drift smoke, in pixels per second.
+     *
+     * Matches the tire screech threshold, so the smoke appears exactly when the screech becomes audible.
+     */
+    static constexpr float drift_threshold_pixels_per_second_ = 150.0f;
+
+    /**
+     * @brief Number of sparks spawned per wall impact at the minimum and maximum impact speeds.
+     */
+    static constexpr std::size_t min_sparks_per_impact_ = 4;
+    static constexpr std::size_t max_sparks_per_impact_ = 16;
+
+    /**
+     * @brief Impact speed at which a wall hit spawns the maximum spark burst, in pixels per second.
+     */
+    static constexpr float max_burst_impact_speed_ = 800.0f;
+
+    /**
+     * @brief Base color of collision sparks; a warm yellow-orange that fades out over the lifetime.
+     */
+    static constexpr sf::Color spark_color_ = {255, 210, 120, 255};
+
+    /**
+     * @brief Base color of drift smoke; a translucent grey, so overlapping puffs build up softly instead of going opaque.
+     */
+    static constexpr sf::Color smoke_color_ = {130, 130, 130, 90};
+
+    /**
+     * @brief Random number generator stream for emission jitter.
+     */
+    core::rng::Pcg32 rng_;
+
+    /**
+     * @brief Number of currently live particles; the live state occupies the first "alive_count_" slots of every array below.
+     */
+    std::size_t alive_count_ = 0;
+
+    /**
+     * @brief Per-particle X position in world coordinates (pixels).
+     */
+    core::memory::TrackedVector<float, core::memory::Tag::Entities> positions_x_;
+
+    /**
+     * @brief Per-particle Y position in world coordinates (pixels).
+     */
+    core::memory::TrackedVector<float, core::memory::Tag::Entities> positions_y_;
+
+    /**
+     * @brief Per-particle X velocity in pixels per second.
+     */
+    core::memory::TrackedVector<float, core::memory::Tag::Entities> velocities_x_;
+
+    /**
+     * @brief Per-particle Y velocity in pixels per second.
+     */
+    core::memory::TrackedVector<float, core::memory::Tag::Entities> velocities_y_;
+
+    /**
+     * @brief Per-particle age in seconds, accumulated every update.
+     */
+    core::memory::TrackedVector<float, core::memory::Tag::Entities> ages_;
+
+    /**
+     * @brief Per-particle lifetime in seconds; the particle is retired when its age reaches this.
+     */
+    core::memory::TrackedVector<float, core::memory::Tag::Entities> lifetimes_;
+
+    /**
+     * @brief Per-particle quad edge length in pixels.
+     */
+    core::memory::TrackedVector<float, core::memory::Tag::Entities> sizes_;
+
+    /**
+     * @brief Per-particle base color including the starting alpha.
+     */
+    core::memory::TrackedVector<sf::Color, core::memory::Tag::Entities> colors_;
+
+    /**
+     * @brief Vertex array rebuilt by "update()" and submitted by "draw()"; six vertices (two triangles) per live particle.
+     */
+    core::memory::TrackedVector<sf::Vertex, core::memory::Tag::Entities> vertices_;
+
+    /**
+     * @brief Number of vertices currently valid in "vertices_".
+     */
+    std::size_t vertex_count_ = 0;
+};
+
+}  // namespace game::particles
@@ -0,0 +1,104 @@
+/**
+ * @file headless.cpp
+ *
+ * @brief Entry-point of the headless simulation benchmark.
+ *
+ * This steps the car physics and AI without creating a window or loading any assets, so it can run on build servers without a GPU session. The track is built from default-constructed textures; those are only ever dereferenced when drawing, which the benchmark never does.
+ */
+
+#include <chrono>     // for std::chrono
+#include <cstddef>    // for std::size_t
+#include <cstdlib>    // for EXIT_FAILURE, EXIT_SUCCESS
+#include <exception>  // for std::exception
+#include <string>     // for std::stoul
+
+#include <SFML/Graphics/Texture.hpp>
+#include <spdlog/spdlog.h>
+
+#include "core/world.hpp"
+#include "game/entities.hpp"
+#include "rng.hpp"
+#include "settings.hpp"
+
+/**
+ * @brief Entry-point of the headless simulation benchmark.
+ *
+ * Steps N AI cars for M simulated seconds at the fixed physics rate, then prints throughput.
+ *
+ * @param argc Number of command-line arguments (e.g., "4").
+ * @param argv Array of command-line arguments: "[car_count] [simulated_seconds] [seed]" (e.g., "{'./vroom-headless', '64', '120', '42'}").
+ *
+ * @return EXIT_SUCCESS if the simulation ran successfully, EXIT_FAILURE otherwise.
+ */
+int main(int argc,
+         char *argv[])
+{
+    try {
+        // Defaults mirror a busy race: more cars than the game spawns, for a full minute
+        std::size_t car_count = 64;
+        std::size_t simulated_seconds = 60;
+        unsigned seed = settings::constants::deterministic_seed;
+        if (argc > 1) {
+            car_count = std::stoul(argv[1]);
+        }
+        if (argc > 2) {
+            simulated_seconds = std::stoul(argv[2]);
+        }
+        if (argc > 3) {
+            seed = static_cast<unsigned>(std::stoul(argv[3]));
+        }
+        if (car_count == 0 || simulated_seconds == 0) {
+            SPDLOG_ERROR("Both the car count and the simulated seconds must be greater than zero!");
+            return EXIT_FAILURE;
+        }
+
+        // Default-constructed texture shared by all tile regions; never dereferenced, because the benchmark never draws
+        const sf::Texture placeholder_texture;
+        const core::world::Track::Textures tiles = {
+            .top_left = {placeholder_texture, {}},
+            .top_right = {placeholder_texture, {}},
+            .bottom_right = {placeholder_texture, {}},
+            .bottom_left = {placeholder_texture, {}},
+            .vertical = {placeholder_texture, {}},
+            .horizontal = {placeholder_texture, {}},
+            .horizontal_finish = {placeholder_texture, {}},
+        };
+
+        // Build the track and register the cars, exactly as the game does minus the visuals
+        // The seed defaults to the fixed deterministic one, so repeated runs step through the same track and the same physics - a before/after comparison then measures the code, not a lucky layout
+        core::rng::Pcg32 track_rng{seed, 0};
+        core::rng::Pcg32 physics_rng{seed, 1};
+        const core::world::Track track{tiles, track_rng};
+        game::entities::CarPhysicsSystem car_physics{physics_rng, track};
+        for (std::size_t i = 0; i < car_count; ++i) {
+            static_cast<void>(car_physics.create_car(game::entities::CarControlMode::AI));
+        }
+
+        // Step the whole field at the game's fixed physics rate and measure the wall-clock cost
+        constexpr float fixed_dt = 1.0f / 120.0f;
+        const std::size_t step_count = simulated_seconds * 120;
+        SPDLOG_INFO("Stepping '{}' cars for '{}' simulated seconds ('{}' fixed steps) with seed '{}'...", car_count, simulated_seconds, step_count, seed);
+
+        const auto start_time = std::chrono::steady_clock::now();
+        for (std::size_t step = 0; step < step_count; ++step) {
+            car_physics.update(fixed_dt);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+        // Report throughput; "car updates" is the number of single-car physics steps executed
+        const double wall_seconds = elapsed.count();
+        const double car_updates = static_cast<double>(car_count) * static_cast<double>(step_count);
+        SPDLOG_INFO("Finished in '{:.3f}' s of wall time ('{:.1f}x' realtime)", wall_seconds, static_cast<double>(simulated_seconds) / wall_seconds);
+        SPDLOG_INFO("Throughput: '{:.0f}' fixed steps/s, '{:.0f}' car updates/s", static_cast<double>(step_count) / wall_seconds, car_updates / wall_seconds);
+
+        return EXIT_SUCCESS;
+    }
+    catch (const std::exception &e) {
+        SPDLOG_CRITICAL("Headless simulation failed: {}", e.what());
+        return EXIT_FAILURE;
+    }
+    catch (...) {
+        SPDLOG_CRITICAL("Headless simulation failed due to an unknown error!");
+        return EXIT_FAILURE;
+    }
+}
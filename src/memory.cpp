@@ -0,0 +1,111 @@
+/**
+ * @file memory.cpp
+ */
+
+#include <array>    // for std::array
+#include <atomic>   // for std::atomic, std::memory_order_relaxed
+#include <cstddef>  // for std::size_t
+
+#include "memory.hpp"
+
+namespace core::memory {
+
+namespace {
+
+/**
+ * @brief Display name per tag, in tag order.
+ */
+constexpr std::array<const char *, tag_count> tag_names = {"world", "entities", "widgets", "sfx", "assets"};
+
+/**
+ * @brief Budget per tag in bytes, in tag order.
+ *
+ * Calibrated from the peaks of a 20x20 stress-test session with headroom; exceeding one paints the overlay number red so growth gets noticed, it does not fail anything.
+ */
+constexpr std::array<std::size_t, tag_count> tag_budgets = {
+    64 * 1024 * 1024,   // world: the distance field and progress grid dominate, and scale with the track config
+    32 * 1024 * 1024,   // entities: physics arrays and particle pools are preallocated, so this should be flat
+    8 * 1024 * 1024,    // widgets: caches refresh in place; steady-state growth here is a leak
+    16 * 1024 * 1024,   // sfx: a fixed voice pool plus mixer scratch
+    256 * 1024 * 1024,  // assets: decoded images and sound buffers, paid once at startup
+};
+
+/**
+ * @brief Struct that holds one subsystem's atomic counters.
+ *
+ * Relaxed ordering throughout: the counters are statistics, not synchronization, and the asset builders and background track build update them from their own threads.
+ */
+struct Counters final {
+    /**
+     * @brief Bytes currently allocated and not yet freed.
+     */
+    std::atomic<std::size_t> live_bytes{0};
+
+    /**
+     * @brief Largest value "live_bytes" has reached since launch.
+     */
+    std::atomic<std::size_t> peak_bytes{0};
+
+    /**
+     * @brief Allocations recorded during the frame in progress.
+     */
+    std::atomic<std::size_t> frame_allocations{0};
+
+    /**
+     * @brief Allocations recorded during the last completed frame, latched by "end_frame()".
+     */
+    std::atomic<std::size_t> last_frame_allocations{0};
+};
+
+/**
+ * @brief One counter block per tag, in tag order.
+ */
+std::array<Counters, tag_count> counters;
+
+}  // namespace
+
+#if defined(VROOM_MEMORY_TRACKING)
+
+void record_allocation(const Tag tag,
+                       const std::size_t bytes)
+{
+    Counters &entry = counters[static_cast<std::size_t>(tag)];
+    const std::size_t live = entry.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    entry.frame_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    // Raise the peak if this allocation set a new high; the CAS loop only spins when another thread raised it concurrently
+    std::size_t peak = entry.peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !entry.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void record_deallocation(const Tag tag,
+                         const std::size_t bytes)
+{
+    counters[static_cast<std::size_t>(tag)].live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+#endif
+
+void end_frame()
+{
+    for (Counters &entry : counters) {
+        entry.last_frame_allocations.store(entry.frame_allocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+std::array<TagStats, tag_count> get_stats()
+{
+    std::array<TagStats, tag_count> stats;
+    for (std::size_t index = 0; index < tag_count; ++index) {
+        const Counters &entry = counters[index];
+        stats[index] = TagStats{.name = tag_names[index],
+                                .live_bytes = entry.live_bytes.load(std::memory_order_relaxed),
+                                .peak_bytes = entry.peak_bytes.load(std::memory_order_relaxed),
+                                .budget_bytes = tag_budgets[index],
+                                .allocations_last_frame = entry.last_frame_allocations.load(std::memory_order_relaxed)};
+    }
+    return stats;
+}
+
+}  // namespace core::memory
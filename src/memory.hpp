@@ -0,0 +1,222 @@
+/**
+ * @file memory.hpp
+ *
+ * @brief Per-subsystem allocation tracking with budgets.
+ */
+
+#pragma once
+
+#include <array>    // for std::array
+#include <cstddef>  // for std::size_t
+#include <memory>   // for std::allocator
+#include <vector>   // for std::vector
+
+namespace core::memory {
+
+/**
+ * @brief Subsystem that an allocation is attributed to.
+ */
+enum class Tag : std::size_t {
+    /**
+     * @brief Track layout data: tile grids, distance field, progress grid.
+     */
+    World,
+
+    /**
+     * @brief Car and effect state: physics arrays, tire marks, particles.
+     */
+    Entities,
+
+    /**
+     * @brief UI widget caches: leaderboard rows, profiler rows, and similar.
+     */
+    Widgets,
+
+    /**
+     * @brief Audio voices and mixer scratch.
+     */
+    Sfx,
+
+    /**
+     * @brief Asset decoding: images and sound buffers.
+     */
+    Assets,
+};
+
+/**
+ * @brief Number of subsystem tags; used to size the counter tables.
+ */
+inline constexpr std::size_t tag_count = 5;
+
+/**
+ * @brief Whether allocation tracking is compiled into this build.
+ *
+ * Controlled by the "ENABLE_MEMORY_TRACKING" CMake option; when off, the record functions are empty inline stubs and "TrackingAllocator" costs exactly as much as "std::allocator".
+ */
+#if defined(VROOM_MEMORY_TRACKING)
+inline constexpr bool tracking_enabled = true;
+#else
+inline constexpr bool tracking_enabled = false;
+#endif
+
+/**
+ * @brief Struct that holds one subsystem's memory counters for display.
+ */
+struct TagStats final {
+    /**
+     * @brief Subsystem name (e.g., "world", "entities").
+     */
+    const char *name;
+
+    /**
+     * @brief Bytes currently allocated and not yet freed.
+     */
+    std::size_t live_bytes;
+
+    /**
+     * @brief Largest value "live_bytes" has reached since launch.
+     */
+    std::size_t peak_bytes;
+
+    /**
+     * @brief Budget for this subsystem in bytes; exceeding it is a red number in the overlay, not an error.
+     */
+    std::size_t budget_bytes;
+
+    /**
+     * @brief Number of allocations recorded during the last completed frame; a nonzero steady-state value means a container is churning the heap every frame.
+     */
+    std::size_t allocations_last_frame;
+};
+
+#if defined(VROOM_MEMORY_TRACKING)
+
+/**
+ * @brief Record an allocation against a subsystem.
+ *
+ * @param tag Subsystem the allocation belongs to.
+ * @param bytes Size of the allocation in bytes.
+ *
+ * @note Thread-safe; the asset builders and the background track build allocate off the main thread.
+ */
+void record_allocation(const Tag tag,
+                       const std::size_t bytes);
+
+/**
+ * @brief Record a deallocation against a subsystem.
+ *
+ * @param tag Subsystem the allocation belonged to.
+ * @param bytes Size passed to the matching "record_allocation()" call.
+ */
+void record_deallocation(const Tag tag,
+                         const std::size_t bytes);
+
+#else
+
+/**
+ * @brief No-op stub; tracking is compiled out of this build.
+ */
+inline void record_allocation(const Tag, const std::size_t) {}
+
+/**
+ * @brief No-op stub; tracking is compiled out of this build.
+ */
+inline void record_deallocation(const Tag, const std::size_t) {}
+
+#endif
+
+/**
+ * @brief Latch the per-frame allocation counters and reset them for the next frame.
+ *
+ * @note Call this once per frame, after the frame has been displayed.
+ */
+void end_frame();
+
+/**
+ * @brief Get a snapshot of every subsystem's counters.
+ *
+ * @return One entry per tag, in tag order; all counters are zero when tracking is compiled out.
+ */
+[[nodiscard]] std::array<TagStats, tag_count> get_stats();
+
+/**
+ * @brief Standard-conforming allocator that attributes a container's storage to a subsystem.
+ *
+ * Plug this into std::vector (see the "TrackedVector" alias) to make the container's heap usage show up in the memory overlay under the given tag. The tag is a template parameter rather than runtime state, so the allocator stays stateless and default-constructible, and the container type documents its owner.
+ *
+ * @tparam T Type of the allocated elements.
+ * @tparam tag Subsystem the storage is attributed to.
+ *
+ * @note Not marked "final": the standard library derives from allocators internally (empty base optimization).
+ */
+template <typename T, Tag tag>
+class TrackingAllocator {
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Explicit rebind member; "std::allocator_traits" cannot synthesize it because "tag" is a non-type template parameter.
+     *
+     * @tparam U Element type to rebind to.
+     */
+    template <typename U>
+    struct rebind {
+        using other = TrackingAllocator<U, tag>;
+    };
+
+    /**
+     * @brief Default constructor; the allocator carries no state.
+     */
+    TrackingAllocator() = default;
+
+    /**
+     * @brief Rebinding copy constructor required by the allocator interface.
+     *
+     * @tparam U Element type of the source allocator.
+     */
+    template <typename U>
+    explicit TrackingAllocator(const TrackingAllocator<U, tag> &) {}
+
+    /**
+     * @brief Allocate storage for a number of elements, recording it against the tag.
+     *
+     * @param count Number of elements of type "T".
+     *
+     * @return Pointer to uninitialized storage.
+     */
+    [[nodiscard]] T *allocate(const std::size_t count)
+    {
+        record_allocation(tag, count * sizeof(T));
+        return std::allocator<T>{}.allocate(count);
+    }
+
+    /**
+     * @brief Return storage obtained from "allocate()", recording the release against the tag.
+     *
+     * @param pointer Pointer previously returned by "allocate()".
+     * @param count Element count passed to the matching "allocate()" call.
+     */
+    void deallocate(T *pointer,
+                    const std::size_t count)
+    {
+        record_deallocation(tag, count * sizeof(T));
+        std::allocator<T>{}.deallocate(pointer, count);
+    }
+
+    /**
+     * @brief Compare two allocators; stateless allocators with the same tag are always interchangeable.
+     */
+    template <typename U>
+    [[nodiscard]] bool operator==(const TrackingAllocator<U, tag> &) const { return true; }
+};
+
+/**
+ * @brief Vector whose heap usage is attributed to a subsystem in the memory overlay.
+ *
+ * @tparam T Type of the vector elements.
+ * @tparam tag Subsystem the storage is attributed to.
+ */
+template <typename T, Tag tag>
+using TrackedVector = std::vector<T, TrackingAllocator<T, tag>>;
+
+}  // namespace core::memory
@@ -0,0 +1,101 @@
+/**
+ * @file rng.hpp
+ *
+ * @brief Small, fast random number generation.
+ */
+
+#pragma once
+
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint32_t, std::uint64_t
+
+namespace core::rng {
+
+/**
+ * @brief Class that implements the PCG32 (PCG-XSH-RR 64/32) random number generator.
+ *
+ * The whole generator is 16 bytes of state, compared to the ~2.5 KB of std::mt19937, so per-car and per-subsystem instances stay resident in cache instead of thrashing it. Each instance selects one of 2^63 independent streams, which lets every consumer (track generation, each car's physics, audio) own its own generator instead of contending on a shared one.
+ *
+ * Helpers like "uniform()" replace the freshly-constructed std::uniform_*_distribution objects previously used in hot paths; they compile down to a multiply and a shift.
+ */
+class Pcg32 final {
+  public:
+    /**
+     * @brief Construct a new Pcg32 object.
+     *
+     * @param seed Value that determines the generated sequence; the same seed and stream always produce the same sequence.
+     * @param stream Stream selector (default: "0"); instances with the same seed but different streams produce statistically independent sequences.
+     */
+    explicit constexpr Pcg32(const std::uint64_t seed,
+                             const std::uint64_t stream = 0)
+        : state_(0),
+          increment_((stream << 1u) | 1u)
+    {
+        // Standard PCG seeding: advance once, mix in the seed, advance again
+        static_cast<void>(this->next());
+        this->state_ += seed;
+        static_cast<void>(this->next());
+    }
+
+    /**
+     * @brief Generate the next 32-bit value in the sequence.
+     *
+     * @return Uniformly distributed value over the full 32-bit range.
+     */
+    [[nodiscard]] constexpr std::uint32_t next()
+    {
+        const std::uint64_t old_state = this->state_;
+        this->state_ = old_state * multiplier_ + this->increment_;
+        const std::uint32_t xorshifted = static_cast<std::uint32_t>(((old_state >> 18u) ^ old_state) >> 27u);
+        const std::uint32_t rotation = static_cast<std::uint32_t>(old_state >> 59u);
+        return (xorshifted >> rotation) | (xorshifted << ((32u - rotation) & 31u));
+    }
+
+    /**
+     * @brief Generate a float uniformly distributed in the provided half-open range.
+     *
+     * @param minimum Inclusive lower bound of the range.
+     * @param maximum Exclusive upper bound of the range.
+     *
+     * @return Value in [minimum, maximum).
+     */
+    [[nodiscard]] constexpr float uniform(const float minimum,
+                                          const float maximum)
+    {
+        // Use the top 24 bits, which map exactly onto the float mantissa, for a value in [0, 1)
+        const float unit = static_cast<float>(this->next() >> 8u) * 0x1.0p-24f;
+        return minimum + (maximum - minimum) * unit;
+    }
+
+    /**
+     * @brief Generate an index uniformly distributed below the provided bound.
+     *
+     * @param bound Exclusive upper bound; must be greater than zero and fit in 32 bits.
+     *
+     * @return Value in [0, bound).
+     *
+     * @note This uses Lemire's multiply-shift reduction without a rejection loop; the bias is below 2^-32 per call, which is irrelevant for gameplay randomness.
+     */
+    [[nodiscard]] constexpr std::size_t bounded(const std::size_t bound)
+    {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(this->next()) * static_cast<std::uint64_t>(bound)) >> 32u);
+    }
+
+  private:
+    /**
+     * @brief Multiplier of the underlying 64-bit linear congruential generator.
+     */
+    static constexpr std::uint64_t multiplier_ = 6364136223846793005ULL;
+
+    /**
+     * @brief Current state of the underlying linear congruential generator.
+     */
+    std::uint64_t state_;
+
+    /**
+     * @brief Stream-selecting increment; always odd, so every stream has full period.
+     */
+    std::uint64_t increment_;
+};
+
+}  // namespace core::rng
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstddef>  // for std::size_t
+
 namespace settings {
 
 namespace constants {
@@ -74,6 +76,67 @@ inline constexpr unsigned windowed_min_width = 800;
  */
 inline constexpr unsigned windowed_min_height = 600;
 
+/**
+ * @brief Minimum number of AI cars.
+ */
+inline constexpr int min_ai_cars = 1;
+
+/**
+ * @brief Maximum number of AI cars.
+ *
+ * @note Counts in the hundreds are intended as a stress-test mode for finding the car-count ceiling on a given machine, not as a balanced gameplay experience.
+ */
+inline constexpr int max_ai_cars = 200;
+
+/**
+ * @brief Minimum number of split-screen players.
+ */
+inline constexpr int min_players = 1;
+
+/**
+ * @brief Maximum number of split-screen players.
+ *
+ * @note Bounded by the quadrant viewport layout; more players would need a different screen partitioning scheme.
+ */
+inline constexpr int max_players = 4;
+
+/**
+ * @brief Fixed simulation timestep in seconds (1/120 = ~0.0083 seconds for 120Hz).
+ *
+ * The main loop accumulates frame time and steps the simulation at this fixed rate, so physics behavior is identical regardless of the display refresh rate.
+ *
+ * @note Rendering interpolates between the previous and current physics states, so the renderer can run slower (e.g., 30-40 FPS) without degrading the drift physics.
+ */
+inline constexpr float physics_timestep_seconds = 1.0f / 120.0f;
+
+/**
+ * @brief Maximum number of fixed simulation steps performed per rendered frame.
+ *
+ * This prevents the "spiral of death" where a slow frame causes more physics steps, which in turn causes an even slower frame.
+ */
+inline constexpr unsigned max_physics_steps_per_frame = 8;
+
+/**
+ * @brief Hard capacity of the per-car pool for fresh (not yet baked) tire marks.
+ *
+ * Fresh marks occupy pool slots only during their short settle period before being stamped into the persistent skid mark layer, so this bounds the worst-case memory and per-step update cost of transient effects to a constant. Sized for two wheels spawning at the maximum tire mark rate (240 Hz) for the full settle time, with headroom.
+ */
+inline constexpr std::size_t max_fresh_tire_marks = 256;
+
+/**
+ * @brief Minimum allowed world render scale.
+ *
+ * Below half resolution, the upscale becomes visibly blurry even at racing speed, so the auto mode and the settings slider both stop here.
+ */
+inline constexpr float min_world_render_scale = 0.5f;
+
+/**
+ * @brief Seed used for the root random number generator when deterministic mode is enabled.
+ *
+ * Track generation and every per-car RNG stream derive from this seed, so two runs with the same seed, the same settings, and the same input sequence step through identical simulation states.
+ */
+inline constexpr unsigned deterministic_seed = 1337u;
+
 }  // namespace constants
 
 namespace current {
@@ -107,6 +170,42 @@ inline bool vsync = false;
  */
 inline int fps_idx = 4;
 
+/**
+ * @brief Whether the frame pacer is allowed to spin-wait for the last fraction of each frame interval.
+ *
+ * If true, the pacer sleeps for the whole interval instead, which saves battery at the cost of some pacing jitter. If vsync is enabled or the FPS limit is unlimited, this value is ignored.
+ *
+ * @note This defaults to disabled (spin-waiting allowed), because consistent frame delivery matters more than power draw on mains-powered machines.
+ */
+inline bool low_power_pacing = false;
+
+/**
+ * @brief Scale factor applied to the world render pass (track, cars, effects).
+ *
+ * At "1.0", the world is drawn directly into the window at native resolution. Below that, it is drawn into a smaller render texture and upscaled, which cuts GPU fill cost roughly quadratically; UI and ImGui are always composited at native resolution. This is clamped to ["min_world_render_scale", 1.0].
+ *
+ * @note This defaults to native resolution. When "world_render_auto_scale" is enabled, this value is adjusted automatically at runtime.
+ */
+inline float world_render_scale = 1.0f;
+
+/**
+ * @brief Whether the world render scale adapts to the frame time automatically.
+ *
+ * If true, the scale is lowered when frame time exceeds the budget implied by the FPS limit and raised back when there is comfortable headroom. If false, "world_render_scale" is used as-is.
+ *
+ * @note This defaults to disabled.
+ */
+inline bool world_render_auto_scale = false;
+
+/**
+ * @brief Whether the quality governor may step effect density and anti-aliasing down to hold the frame-time budget.
+ *
+ * If true, tire mark rate, particles, tire marks, and finally anti-aliasing are degraded one step at a time when the frame time stays over budget after the render scale has bottomed out, and restored with hysteresis when headroom returns. The user's own values are snapshotted and come back exactly when the governor steps up or is disabled. If false, all quality settings are used as-is.
+ *
+ * @note This defaults to disabled.
+ */
+inline bool auto_quality = false;
+
 /**
  * @brief Index of the fullscreen resolution.
  *
@@ -144,6 +243,51 @@ inline bool tire_marks = true;
  */
 inline int tire_marks_rate = 90;
 
+/**
+ * @brief Whether particle effects (drift smoke, collision sparks) are enabled.
+ *
+ * If false, no new particles are emitted; the already-live ones still fade out. The pool and its single draw call are cheap, so this is a taste toggle more than a performance one.
+ *
+ * @note This defaults to enabled.
+ */
+inline bool particles = true;
+
+/**
+ * @brief Number of AI cars to spawn.
+ *
+ * The cars are spread evenly along the waypoint line on spawn. Values in the hundreds act as a stress-test mode; see "max_ai_cars".
+ *
+ * @note This defaults to 4 cars.
+ */
+inline int ai_car_count = 4;
+
+/**
+ * @brief Number of split-screen players sharing the simulation.
+ *
+ * The simulation runs once regardless of this value; only the render pass repeats per viewport. Player 1 uses the keyboard or gamepad 0, players 2-4 each need their own gamepad.
+ *
+ * @note This defaults to 1 player (no split).
+ */
+inline int player_count = 1;
+
+/**
+ * @brief Whether the simulation runs in deterministic mode.
+ *
+ * If true, the root RNG is seeded with "deterministic_seed" instead of std::random_device, so track layouts and car physics (collision bounces, AI waypoint variation) are reproducible run to run. Combined with the fixed physics timestep, a recorded input sequence then replays identically, which is what regression benchmarks and physics bug reports from the field need.
+ *
+ * @note This is read once at startup, so changing it at runtime only takes effect on the next launch.
+ */
+inline bool deterministic = false;
+
+/**
+ * @brief Explicit seed for track generation, acting as a shareable track code.
+ *
+ * If nonzero, the track generation stream is seeded with this value instead of the session seed, so two machines entering the same code (with the same track layout settings) generate the same track. This also makes the binary layout cache effective across restarts, since the build seed stays stable.
+ *
+ * @note This defaults to "0", which keeps the fresh-random-track-per-session behavior (unless deterministic mode already fixes the session seed).
+ */
+inline int track_seed = 0;
+
 /**
  * @brief Whether to prefer gamepad input over keyboard when both are available.
  *
@@ -252,6 +396,15 @@ inline float wall_hit_volume = 0.60f;
  */
 inline float ui_volume = 0.7f;
 
+/**
+ * @brief Background music volume as a float (0.0-1.0).
+ *
+ * Controls the volume of the streamed background music tracks.
+ *
+ * @note This defaults to 0.5 (50%).
+ */
+inline float music_volume = 0.5f;
+
 }  // namespace current
 
 }  // namespace settings
@@ -0,0 +1,66 @@
+/**
+ * @file arena.test.cpp
+ */
+
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uintptr_t
+
+#include <snitch/snitch.hpp>
+
+#include "arena.hpp"
+
+TEST_CASE("FrameArena serves aligned blocks and rewinds on reset", "[src][arena.hpp]")
+{
+    core::arena::FrameArena arena{1024};
+
+    void *first = arena.allocate(100, 16);
+    REQUIRE(first != nullptr);
+    CHECK(reinterpret_cast<std::uintptr_t>(first) % 16 == 0);
+
+    // After a reset, the same storage is handed out again
+    arena.reset();
+    void *second = arena.allocate(100, 16);
+    CHECK(second == first);
+    CHECK(arena.get_high_water_mark() >= 100);
+}
+
+TEST_CASE("FrameArena falls back to the heap when exhausted", "[src][arena.hpp]")
+{
+    core::arena::FrameArena arena{16};
+
+    // Larger than the whole buffer; must still succeed via the heap fallback
+    void *block = arena.allocate(64, 8);
+    REQUIRE(block != nullptr);
+    CHECK(arena.get_overflow_count() == 1);
+    arena.deallocate(block, 64, 8);
+}
+
+TEST_CASE("FrameVector assembles data in the arena", "[src][arena.hpp]")
+{
+    core::arena::FrameArena arena{4096};
+
+    core::arena::FrameVector<int> values{core::arena::Allocator<int>{arena}};
+    values.reserve(8);
+    for (int i = 0; i < 8; ++i) {
+        values.push_back(i);
+    }
+    REQUIRE(values.size() == 8);
+    CHECK(values.front() == 0);
+    CHECK(values.back() == 7);
+
+    // The vector's storage came from the arena buffer, not the heap
+    CHECK(arena.get_overflow_count() == 0);
+    CHECK(arena.get_high_water_mark() == 0);  // High water mark only latches on reset
+}
+
+TEST_CASE("Allocators sharing an arena compare equal", "[src][arena.hpp]")
+{
+    core::arena::FrameArena first_arena{64};
+    core::arena::FrameArena second_arena{64};
+
+    const core::arena::Allocator<int> a{first_arena};
+    const core::arena::Allocator<float> b{a};  // Rebound copy shares the arena
+    const core::arena::Allocator<int> c{second_arena};
+    CHECK(a == b);
+    CHECK_FALSE(a == c);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file jobs.test.cpp
+ */
+
+#include <atomic>   // for std::atomic
+#include <cstddef>  // for std::size_t
+
+#include <snitch/snitch.hpp>
+
+#include "core/jobs.hpp"
+
+TEST_CASE("JobSystem executes all submitted jobs before wait returns", "[src][core][jobs.hpp]")
+{
+    core::jobs::JobSystem job_system;
+    std::atomic<std::size_t> counter = 0;
+
+    constexpr std::size_t job_count = 100;
+    for (std::size_t i = 0; i < job_count; ++i) {
+        job_system.submit([&counter]() { counter.fetch_add(1); });
+    }
+    job_system.wait();
+
+    REQUIRE(counter.load() == job_count);
+}
+
+TEST_CASE("JobSystem spawns at least one worker thread", "[src][core][jobs.hpp]")
+{
+    const core::jobs::JobSystem job_system;
+    CHECK(job_system.get_worker_count() >= 1);
+}
+
+TEST_CASE("JobSystem wait is safe to call with no pending jobs", "[src][core][jobs.hpp]")
+{
+    core::jobs::JobSystem job_system;
+    job_system.wait();  // Must not deadlock or throw
+    CHECK(job_system.get_worker_count() >= 1);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file math.test.cpp
+ */
+
+#include <algorithm>  // for std::max
+#include <cmath>      // for std::atan2, std::cos, std::fabs, std::hypot, std::round, std::sin
+#include <numbers>    // for std::numbers
+
+#include <snitch/snitch.hpp>
+
+#include "core/math.hpp"
+
+namespace {
+
+/**
+ * @brief Pi as a float, to keep the sweeps below readable.
+ */
+constexpr float pi = std::numbers::pi_v<float>;
+
+}  // namespace
+
+TEST_CASE("Fast sincos stays within its documented error bound", "[src][core][math.hpp]")
+{
+    // Sweep well past one revolution on both sides; headings are wrapped, but steering deltas can briefly exceed [-pi, pi]
+    float max_sin_error = 0.0f;
+    float max_cos_error = 0.0f;
+    for (int step = -4000; step <= 4000; ++step) {
+        const float angle = static_cast<float>(step) * 0.005f;  // [-20, 20] radians
+        const core::math::SinCos result = core::math::fast_sincos(angle);
+        max_sin_error = std::max(max_sin_error, std::fabs(result.sin - std::sin(angle)));
+        max_cos_error = std::max(max_cos_error, std::fabs(result.cos - std::cos(angle)));
+    }
+    CAPTURE(max_sin_error);
+    CAPTURE(max_cos_error);
+    CHECK(max_sin_error < 3.0e-5f);
+    CHECK(max_cos_error < 3.0e-5f);
+}
+
+TEST_CASE("Fast atan2 matches libm within its documented error bound", "[src][core][math.hpp]")
+{
+    // Grid over all octants, including axis-aligned vectors
+    float max_error = 0.0f;
+    for (int y_step = -40; y_step <= 40; ++y_step) {
+        for (int x_step = -40; x_step <= 40; ++x_step) {
+            const float y = static_cast<float>(y_step) * 25.0f;
+            const float x = static_cast<float>(x_step) * 25.0f;
+            if (x == 0.0f && y == 0.0f) {
+                continue;  // Both implementations hit the degenerate case; checked separately below
+            }
+            max_error = std::max(max_error, std::fabs(core::math::fast_atan2(y, x) - std::atan2(y, x)));
+        }
+    }
+    CAPTURE(max_error);
+    CHECK(max_error < 1.0e-4f);
+
+    // The degenerate origin returns zero instead of relying on libm's signed-zero rules
+    CHECK(core::math::fast_atan2(0.0f, 0.0f) == 0.0f);
+}
+
+TEST_CASE("Wrap angle lands in the half-open principal range", "[src][core][math.hpp]")
+{
+    // Every result must be in [-pi, pi) and differ from the input by a whole number of turns
+    for (int step = -1000; step <= 1000; ++step) {
+        const float angle = static_cast<float>(step) * 0.05f;  // [-50, 50] radians
+        const float wrapped = core::math::wrap_angle(angle);
+        CAPTURE(angle);
+        CHECK(wrapped >= -pi);
+        CHECK(wrapped < pi);
+        const float turns = (angle - wrapped) / (2.0f * pi);
+        CHECK(std::fabs(turns - std::round(turns)) < 1.0e-3f);
+    }
+
+    // Identity on values already in range
+    CHECK(core::math::wrap_angle(0.0f) == 0.0f);
+    CHECK(std::fabs(core::math::wrap_angle(pi) - (-pi)) < 1.0e-6f);
+}
+
+TEST_CASE("Fast length matches hypot at game-world magnitudes", "[src][core][math.hpp]")
+{
+    CHECK(core::math::fast_length(3.0f, 4.0f) == 5.0f);
+    CHECK(core::math::fast_length(0.0f, 0.0f) == 0.0f);
+
+    // Velocities top out at a few thousand pixels per second; no overflow protection is needed there
+    const float large = core::math::fast_length(3000.0f, -4000.0f);
+    CHECK(std::fabs(large - std::hypot(3000.0f, -4000.0f)) < 1.0e-2f);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file pool.test.cpp
+ */
+
+#include <cstddef>  // for std::size_t
+
+#include <snitch/snitch.hpp>
+
+#include "core/pool.hpp"
+
+TEST_CASE("FixedPool acquires up to capacity and then reports exhaustion", "[src][core][pool.hpp]")
+{
+    core::pool::FixedPool<int> pool{3};
+    REQUIRE(pool.capacity() == 3);
+    REQUIRE(pool.size() == 0);
+
+    const std::size_t first = pool.acquire();
+    const std::size_t second = pool.acquire();
+    const std::size_t third = pool.acquire();
+    REQUIRE(first != core::pool::FixedPool<int>::invalid_index);
+    REQUIRE(second != core::pool::FixedPool<int>::invalid_index);
+    REQUIRE(third != core::pool::FixedPool<int>::invalid_index);
+    REQUIRE(pool.size() == 3);
+
+    // The fourth acquire must fail instead of growing past the cap
+    CHECK(pool.acquire() == core::pool::FixedPool<int>::invalid_index);
+}
+
+TEST_CASE("FixedPool recycles released slots through the free list", "[src][core][pool.hpp]")
+{
+    core::pool::FixedPool<int> pool{2};
+    const std::size_t first = pool.acquire();
+    const std::size_t second = pool.acquire();
+    REQUIRE(pool.acquire() == core::pool::FixedPool<int>::invalid_index);
+
+    pool.release(first);
+    REQUIRE(pool.size() == 1);
+
+    // The freed slot comes back without any allocation; capacity is unchanged
+    const std::size_t recycled = pool.acquire();
+    CHECK(recycled == first);
+    CHECK(pool.size() == 2);
+    CHECK(pool.capacity() == 2);
+
+    // Releasing a slot that is not alive is a no-op
+    pool.release(first);
+    pool.release(first);
+    CHECK(pool.size() == 1);
+    pool.release(second);
+    CHECK(pool.size() == 0);
+}
+
+TEST_CASE("FixedPool alive indices cover exactly the acquired slots", "[src][core][pool.hpp]")
+{
+    core::pool::FixedPool<int> pool{4};
+    const std::size_t first = pool.acquire();
+    const std::size_t second = pool.acquire();
+    const std::size_t third = pool.acquire();
+    pool[first] = 10;
+    pool[second] = 20;
+    pool[third] = 30;
+
+    pool.release(second);
+
+    // The released slot must be absent and the survivors present, in unspecified order
+    int sum = 0;
+    for (const std::size_t slot : pool.get_alive_indices()) {
+        CHECK(slot != second);
+        sum += pool[slot];
+    }
+    CHECK(sum == 40);
+}
+
+TEST_CASE("FixedPool clear releases every slot at once", "[src][core][pool.hpp]")
+{
+    core::pool::FixedPool<int> pool{3};
+    static_cast<void>(pool.acquire());
+    static_cast<void>(pool.acquire());
+    REQUIRE(pool.size() == 2);
+
+    pool.clear();
+    CHECK(pool.size() == 0);
+    CHECK(pool.get_alive_indices().empty());
+
+    // The whole capacity is available again afterwards
+    std::size_t acquired = 0;
+    while (pool.acquire() != core::pool::FixedPool<int>::invalid_index) {
+        ++acquired;
+    }
+    CHECK(acquired == 3);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file profiler.test.cpp
+ */
+
+#include <cstddef>     // for std::size_t
+#include <filesystem>  // for std::filesystem
+#include <fstream>     // for std::ifstream
+#include <string>      // for std::string, std::getline
+
+#include <snitch/snitch.hpp>
+
+#include "core/profiler.hpp"
+
+TEST_CASE("FrameProfiler sums samples with the same name within one frame", "[src][core][profiler.hpp]")
+{
+    core::profiler::FrameProfiler profiler;
+    profiler.add_sample("Phase", 0.001f);  // 1 ms
+    profiler.add_sample("Phase", 0.002f);  // 2 ms
+    profiler.end_frame();
+
+    const auto &stats = profiler.get_stats();
+    REQUIRE(stats.size() == 1);
+    CHECK(stats[0].current_ms > 2.9f);
+    CHECK(stats[0].current_ms < 3.1f);
+}
+
+TEST_CASE("FrameProfiler keeps phases in first-sampled order", "[src][core][profiler.hpp]")
+{
+    core::profiler::FrameProfiler profiler;
+    profiler.add_sample("First", 0.001f);
+    profiler.add_sample("Second", 0.001f);
+    profiler.add_sample("First", 0.001f);  // Must not reorder or duplicate
+    profiler.end_frame();
+
+    const auto &stats = profiler.get_stats();
+    REQUIRE(stats.size() == 2);
+    CHECK(std::string{stats[0].name} == "First");
+    CHECK(std::string{stats[1].name} == "Second");
+}
+
+TEST_CASE("FrameProfiler resets accumulators between frames", "[src][core][profiler.hpp]")
+{
+    core::profiler::FrameProfiler profiler;
+    profiler.add_sample("Phase", 0.002f);  // 2 ms
+    profiler.end_frame();
+
+    // Second frame has no samples for the phase, so its current time must drop to zero
+    profiler.end_frame();
+
+    const auto &stats = profiler.get_stats();
+    REQUIRE(stats.size() == 1);
+    CHECK(stats[0].current_ms == 0.f);
+}
+
+TEST_CASE("TraceRecorder preallocates capacity from the requested history length", "[src][core][profiler.hpp]")
+{
+    const core::profiler::TraceRecorder recorder{1.0f};
+    CHECK(recorder.get_capacity() >= 1);
+    CHECK(recorder.size() == 0);
+}
+
+TEST_CASE("TraceRecorder overwrites the oldest events once full", "[src][core][profiler.hpp]")
+{
+    // Tiny history window, so the ring wraps after a handful of events
+    core::profiler::TraceRecorder recorder{0.001f};
+    const std::size_t capacity = recorder.get_capacity();
+
+    for (std::size_t i = 0; i < capacity * 2; ++i) {
+        recorder.record_phase("Phase", 0.001f);
+    }
+
+    // The buffer must stay bounded at its preallocated capacity
+    CHECK(recorder.size() == capacity);
+}
+
+TEST_CASE("TraceRecorder records both phases and counters", "[src][core][profiler.hpp]")
+{
+    core::profiler::TraceRecorder recorder;
+    recorder.record_phase("Phase", 0.001f);
+    recorder.record_counter("Counter", 42.f);
+    CHECK(recorder.size() == 2);
+}
+
+TEST_CASE("ScopedTimer reports elapsed time on destruction", "[src][core][profiler.hpp]")
+{
+    core::profiler::FrameProfiler profiler;
+    {
+        const core::profiler::ScopedTimer timer{profiler, "Scoped"};
+    }
+    profiler.end_frame();
+
+    const auto &stats = profiler.get_stats();
+    REQUIRE(stats.size() == 1);
+    CHECK(std::string{stats[0].name} == "Scoped");
+    CHECK(stats[0].current_ms >= 0.f);
+}
+
+TEST_CASE("StartupTimeline appends one report line per launch", "[src][core][profiler.hpp]")
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "vroom_startup_report_test";
+    std::filesystem::remove_all(directory);
+
+    core::profiler::StartupTimeline timeline;
+    timeline.mark("first");
+    timeline.mark("second");
+    timeline.append_report(directory, "0.0.0-test");
+
+    const std::filesystem::path file_path = directory / "startup_report.log";
+    REQUIRE(std::filesystem::exists(file_path));
+
+    // The line must carry the version and one "key_ms=" token per milestone, so the fleet tooling can parse it
+    std::string contents;
+    {
+        std::ifstream ifs(file_path);
+        std::getline(ifs, contents);
+    }
+    CHECK(contents.find("version=0.0.0-test") != std::string::npos);
+    CHECK(contents.find("total_ms=") != std::string::npos);
+    CHECK(contents.find("first_ms=") != std::string::npos);
+    CHECK(contents.find("second_ms=") != std::string::npos);
+
+    // A second launch appends instead of overwriting
+    timeline.append_report(directory, "0.0.0-test");
+    std::size_t line_count = 0;
+    {
+        std::ifstream ifs(file_path);
+        std::string line;
+        while (std::getline(ifs, line)) {
+            ++line_count;
+        }
+    }
+    CHECK(line_count == 2);
+
+    std::filesystem::remove_all(directory);
+}
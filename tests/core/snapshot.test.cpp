@@ -0,0 +1,68 @@
+/**
+ * @file snapshot.test.cpp
+ */
+
+#include <cstdint>  // for std::uint64_t
+#include <thread>   // for std::jthread
+
+#include <snitch/snitch.hpp>
+
+#include "core/snapshot.hpp"
+
+TEST_CASE("TripleBuffer returns the newest published snapshot", "[src][core][snapshot.hpp]")
+{
+    core::snapshot::TripleBuffer<int> channel;
+
+    // Before the first publish, the consumer sees a default-constructed snapshot
+    CHECK(channel.read() == 0);
+
+    channel.write() = 42;
+    channel.publish();
+    CHECK(channel.read() == 42);
+
+    // Re-reading without a new publish returns the same snapshot
+    CHECK(channel.read() == 42);
+}
+
+TEST_CASE("TripleBuffer drops stale snapshots when the producer outpaces the consumer", "[src][core][snapshot.hpp]")
+{
+    core::snapshot::TripleBuffer<int> channel;
+
+    // Publish twice without reading; the consumer must see only the newest value
+    channel.write() = 1;
+    channel.publish();
+    channel.write() = 2;
+    channel.publish();
+    CHECK(channel.read() == 2);
+    CHECK(channel.get_published_count() == 2);
+}
+
+TEST_CASE("TripleBuffer hands monotonic snapshots across threads", "[src][core][snapshot.hpp]")
+{
+    core::snapshot::TripleBuffer<std::uint64_t> channel;
+    constexpr std::uint64_t publish_count = 10000;
+
+    std::uint64_t last_seen = 0;
+    bool monotonic = true;
+    {
+        const std::jthread producer{[&channel]() {
+            for (std::uint64_t value = 1; value <= publish_count; ++value) {
+                channel.write() = value;
+                channel.publish();
+            }
+        }};
+
+        // Consume concurrently; values may be skipped but must never go backwards
+        while (last_seen < publish_count) {
+            const std::uint64_t seen = channel.read();
+            if (seen < last_seen) {
+                monotonic = false;
+                break;
+            }
+            last_seen = seen;
+        }
+    }
+    CHECK(monotonic);
+    CHECK(last_seen == publish_count);
+    CHECK(channel.get_published_count() == publish_count);
+}
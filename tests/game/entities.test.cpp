@@ -2,9 +2,18 @@
  * @file game.test.cpp
  */
 
+#include <array>    // for std::array
+#include <cmath>    // for std::abs
+#include <cstddef>  // for std::size_t
+#include <span>     // for std::span
+
 #include <snitch/snitch.hpp>
+#include <SFML/Graphics/Texture.hpp>
 
+#include "core/world.hpp"
 #include "game/entities.hpp"
+#include "helpers/placeholder_track.hpp"
+#include "rng.hpp"
 
 TEST_CASE("CarConfig default values are reasonable", "[src][game][entities.hpp]")
 {
@@ -18,6 +27,51 @@ TEST_CASE("CarConfig default values are reasonable", "[src][game][entities.hpp]"
     CHECK(config.maximum_steering_angle_degrees > 0.0f);
     CHECK(config.steering_sensitivity_at_zero_speed >= config.steering_sensitivity_at_maximum_speed);
     CHECK(config.lateral_slip_damping_coefficient_per_second > 0.0f);
+    CHECK(config.car_collision_radius_pixels > 0.0f);
     CHECK(config.collision_velocity_retention_ratio >= 0.0f);
     CHECK(config.collision_velocity_retention_ratio <= 1.0f);
 }
+
+TEST_CASE("CarBatchRenderer builds one shadow and one body quad per car", "[src][game][entities.hpp]")
+{
+    const sf::Texture placeholder_texture;
+    const core::world::Track::Textures tiles = helpers::make_placeholder_tiles(placeholder_texture);
+    core::rng::Pcg32 rng{helpers::fixed_seed};
+    const core::world::Track track{tiles, rng};
+
+    game::entities::CarPhysicsSystem car_physics{rng, track};
+    constexpr std::size_t car_count = 3;
+    for (std::size_t i = 0; i < car_count; ++i) {
+        static_cast<void>(car_physics.create_car(game::entities::CarControlMode::AI));
+    }
+    car_physics.update(helpers::fixed_dt);
+
+    const std::array<sf::Color, car_count> tints = {sf::Color{49, 154, 215}, sf::Color{56, 197, 115}, sf::Color{239, 112, 28}};
+    game::entities::CarBatchRenderer batch{placeholder_texture, {{0, 0}, {131, 71}}};
+    batch.build(car_physics, tints, 1.0f);
+
+    // Six vertices (two triangles) per car in each layer
+    const std::span<const sf::Vertex> bodies = batch.get_body_vertices();
+    const std::span<const sf::Vertex> shadows = batch.get_shadow_vertices();
+    REQUIRE(bodies.size() == car_count * 6);
+    REQUIRE(shadows.size() == car_count * 6);
+
+    for (std::size_t car_index = 0; car_index < car_count; ++car_index) {
+        const game::entities::CarState state = car_physics.get_state(car_index);
+        const std::span<const sf::Vertex> quad = bodies.subspan(car_index * 6, 6);
+
+        // Vertices 0 and 2 are opposite corners, so their midpoint is the quad center; at alpha 1 that must be the car's current position
+        const sf::Vector2f center = (quad[0].position + quad[2].position) / 2.0f;
+        CHECK(std::abs(center.x - state.position.x) < 0.01f);
+        CHECK(std::abs(center.y - state.position.y) < 0.01f);
+
+        // The body carries the car's tint, the shadow the fixed translucent black
+        CHECK(quad[0].color == tints[car_index]);
+        CHECK(shadows[car_index * 6].color == sf::Color{0, 0, 0, 80});
+
+        // The shadow quad sits at the fixed offset below-right of the body
+        const sf::Vector2f shadow_center = (shadows[car_index * 6].position + shadows[car_index * 6 + 2].position) / 2.0f;
+        CHECK(std::abs(shadow_center.x - (center.x + 10.0f)) < 0.01f);
+        CHECK(std::abs(shadow_center.y - (center.y + 10.0f)) < 0.01f);
+    }
+}
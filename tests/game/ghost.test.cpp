@@ -0,0 +1,80 @@
+/**
+ * @file ghost.test.cpp
+ */
+
+#include <cmath>    // for std::abs
+#include <cstddef>  // for std::size_t
+
+#include <snitch/snitch.hpp>
+
+#include "game/ghost.hpp"
+
+TEST_CASE("Ghost recording round-trips through the binary format within quantization error", "[src][game][ghost.hpp]")
+{
+    game::ghost::GhostRecording recording;
+    recording.sample_rate_hz = 30.0f;
+    for (std::size_t i = 0; i < 100; ++i) {
+        recording.samples.emplace_back(game::ghost::GhostSample{
+            .position = {1000.0f + static_cast<float>(i) * 3.5f, 2000.0f - static_cast<float>(i) * 1.25f},
+            .heading_radians = static_cast<float>(i) * 0.05f,
+            .steering_angle = static_cast<float>(i % 90) - 45.0f});
+    }
+
+    const auto bytes = game::ghost::encode(recording);
+    const auto decoded = game::ghost::decode(bytes);
+
+    REQUIRE(decoded.samples.size() == recording.samples.size());
+    CHECK(decoded.sample_rate_hz == recording.sample_rate_hz);
+    for (std::size_t i = 0; i < recording.samples.size(); ++i) {
+        // Positions are quantized to 1/8 px, headings to 16 bits over the circle, steering to whole degrees
+        CHECK(std::abs(decoded.samples[i].position.x - recording.samples[i].position.x) <= 0.125f);
+        CHECK(std::abs(decoded.samples[i].position.y - recording.samples[i].position.y) <= 0.125f);
+        CHECK(std::abs(decoded.samples[i].heading_radians - recording.samples[i].heading_radians) <= 0.001f);
+        CHECK(std::abs(decoded.samples[i].steering_angle - recording.samples[i].steering_angle) <= 0.5f);
+    }
+}
+
+TEST_CASE("Ghost decoding rejects truncated or foreign bytes", "[src][game][ghost.hpp]")
+{
+    // Not a ghost recording at all
+    CHECK(game::ghost::decode({0x00, 0x01, 0x02, 0x03}).samples.empty());
+
+    // Valid recording cut short mid-sample
+    game::ghost::GhostRecording recording;
+    recording.samples.emplace_back(game::ghost::GhostSample{.position = {1.0f, 2.0f}, .heading_radians = 0.0f, .steering_angle = 0.0f});
+    auto bytes = game::ghost::encode(recording);
+    bytes.pop_back();
+    CHECK(game::ghost::decode(bytes).samples.empty());
+}
+
+TEST_CASE("GhostRecorder samples at its fixed rate and wraps the ring buffer", "[src][game][ghost.hpp]")
+{
+    // 10 Hz over 1 second = capacity for 10 samples
+    game::ghost::GhostRecorder recorder(10.0f, 1.0f);
+
+    // Feed 2 seconds of fixed updates at 100 Hz; only every 10th step crosses the sample interval
+    for (std::size_t i = 0; i < 200; ++i) {
+        recorder.record({static_cast<float>(i), 0.0f}, 0.0f, 0.0f, 0.01f);
+    }
+
+    // The ring must have wrapped and kept only the newest window
+    REQUIRE(recorder.size() == 10);
+    const auto recording = recorder.snapshot();
+    REQUIRE(recording.samples.size() == 10);
+
+    // Samples must be in chronological order despite the wrap-around
+    for (std::size_t i = 1; i < recording.samples.size(); ++i) {
+        CHECK(recording.samples[i].position.x > recording.samples[i - 1].position.x);
+    }
+}
+
+TEST_CASE("GhostRecorder clear discards all samples", "[src][game][ghost.hpp]")
+{
+    game::ghost::GhostRecorder recorder(10.0f, 1.0f);
+    recorder.record({0.0f, 0.0f}, 0.0f, 0.0f, 1.0f);
+    REQUIRE(recorder.size() == 1);
+
+    recorder.clear();
+    CHECK(recorder.size() == 0);
+    CHECK(recorder.snapshot().samples.empty());
+}
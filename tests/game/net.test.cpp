@@ -0,0 +1,98 @@
+/**
+ * @file net.test.cpp
+ */
+
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint64_t
+
+#include <snitch/snitch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include "core/world.hpp"
+#include "game/entities.hpp"
+#include "game/net.hpp"
+#include "helpers/placeholder_track.hpp"
+#include "rng.hpp"
+
+namespace {
+
+/**
+ * @brief Hash each car's position, velocity, and heading in car-index order, mirroring what the application feeds into "game::net::StateHash".
+ *
+ * @param car_physics Physics system to hash.
+ *
+ * @return 64-bit hash of the physics state.
+ */
+[[nodiscard]] std::uint64_t hash_physics_state(const game::entities::CarPhysicsSystem &car_physics)
+{
+    game::net::StateHash hasher;
+    for (std::size_t car_index = 0; car_index < car_physics.size(); ++car_index) {
+        const game::entities::CarState state = car_physics.get_state(car_index);
+        hasher.mix(state.position.x);
+        hasher.mix(state.position.y);
+        hasher.mix(state.velocity.x);
+        hasher.mix(state.velocity.y);
+        hasher.mix(state.heading_radians);
+    }
+    return hasher.get();
+}
+
+}  // namespace
+
+TEST_CASE("Identically seeded simulations hash identically every tick", "[src][game][net.hpp]")
+{
+    const sf::Texture placeholder_texture;
+    const core::world::Track::Textures tiles = helpers::make_placeholder_tiles(placeholder_texture);
+
+    // Two independent "machines" built from the same seed, exactly as the lockstep handshake prescribes; if any part of the physics stack is non-deterministic (uninitialized state, iteration-order dependence), the hashes split
+    core::rng::Pcg32 rng_a{helpers::fixed_seed};
+    core::rng::Pcg32 rng_b{helpers::fixed_seed};
+    const core::world::Track track_a{tiles, rng_a};
+    const core::world::Track track_b{tiles, rng_b};
+    game::entities::CarPhysicsSystem physics_a{rng_a, track_a};
+    game::entities::CarPhysicsSystem physics_b{rng_b, track_b};
+    const std::size_t player_a = physics_a.create_car(game::entities::CarControlMode::Player);
+    const std::size_t player_b = physics_b.create_car(game::entities::CarControlMode::Player);
+    for (std::size_t i = 0; i < 3; ++i) {
+        static_cast<void>(physics_a.create_car(game::entities::CarControlMode::AI));
+        static_cast<void>(physics_b.create_car(game::entities::CarControlMode::AI));
+    }
+
+    // Same input sequence on both sides, like the lockstep delivers; full throttle with a slight steer keeps the cars moving so the state actually evolves
+    constexpr game::entities::CarInput input = {.throttle = 1.0f, .brake = 0.0f, .steering = 0.2f, .handbrake = 0.0f};
+    for (std::size_t tick = 0; tick < 600; ++tick) {
+        physics_a.apply_input(player_a, input);
+        physics_b.apply_input(player_b, input);
+        physics_a.update(helpers::fixed_dt);
+        physics_b.update(helpers::fixed_dt);
+        const std::uint64_t hash_a = hash_physics_state(physics_a);
+        const std::uint64_t hash_b = hash_physics_state(physics_b);
+        REQUIRE(hash_a == hash_b);
+    }
+}
+
+TEST_CASE("Diverging inputs produce diverging hashes", "[src][game][net.hpp]")
+{
+    const sf::Texture placeholder_texture;
+    const core::world::Track::Textures tiles = helpers::make_placeholder_tiles(placeholder_texture);
+
+    core::rng::Pcg32 rng_a{helpers::fixed_seed};
+    core::rng::Pcg32 rng_b{helpers::fixed_seed};
+    const core::world::Track track_a{tiles, rng_a};
+    const core::world::Track track_b{tiles, rng_b};
+    game::entities::CarPhysicsSystem physics_a{rng_a, track_a};
+    game::entities::CarPhysicsSystem physics_b{rng_b, track_b};
+    const std::size_t player_a = physics_a.create_car(game::entities::CarControlMode::Player);
+    const std::size_t player_b = physics_b.create_car(game::entities::CarControlMode::Player);
+
+    // One machine accelerates, the other stands still; the hash must notice, otherwise the divergence check is theater
+    constexpr game::entities::CarInput throttle_input = {.throttle = 1.0f, .brake = 0.0f, .steering = 0.0f, .handbrake = 0.0f};
+    physics_a.apply_input(player_a, throttle_input);
+    physics_b.apply_input(player_b, game::entities::CarInput{});
+    for (std::size_t tick = 0; tick < 10; ++tick) {
+        physics_a.update(helpers::fixed_dt);
+        physics_b.update(helpers::fixed_dt);
+    }
+
+    CHECK(hash_physics_state(physics_a) != hash_physics_state(physics_b));
+}
@@ -0,0 +1,54 @@
+/**
+ * @file particles.test.cpp
+ */
+
+#include <cstddef>  // for std::size_t
+
+#include <snitch/snitch.hpp>
+
+#include "game/particles.hpp"
+#include "rng.hpp"
+
+TEST_CASE("Particles age out and the pool compacts back to empty", "[src][game][particles.hpp]")
+{
+    game::particles::ParticleSystem particles{core::rng::Pcg32{42}};
+    REQUIRE(particles.get_alive_count() == 0);
+
+    particles.emit_sparks({100.0f, 100.0f}, 500.0f);
+    const std::size_t spawned = particles.get_alive_count();
+    REQUIRE(spawned > 0);
+
+    // Spark lifetimes top out well below a second, so one second of updates must retire the whole burst
+    for (std::size_t step = 0; step < 120; ++step) {
+        particles.update(1.0f / 120.0f);
+    }
+    CHECK(particles.get_alive_count() == 0);
+}
+
+TEST_CASE("Drift smoke respects the slip threshold", "[src][game][particles.hpp]")
+{
+    game::particles::ParticleSystem particles{core::rng::Pcg32{42}};
+
+    // Below the drift threshold, nothing is emitted
+    particles.emit_drift_smoke({0.0f, 0.0f}, 100.0f);
+    CHECK(particles.get_alive_count() == 0);
+
+    // Above it, exactly one puff per call
+    particles.emit_drift_smoke({0.0f, 0.0f}, 200.0f);
+    CHECK(particles.get_alive_count() == 1);
+}
+
+TEST_CASE("A full pool drops new particles instead of growing", "[src][game][particles.hpp]")
+{
+    game::particles::ParticleSystem particles{core::rng::Pcg32{42}};
+
+    // Emit far more puffs than the pool can hold; the count must saturate at the capacity
+    for (std::size_t i = 0; i < 10000; ++i) {
+        particles.emit_drift_smoke({0.0f, 0.0f}, 500.0f);
+    }
+    const std::size_t saturated = particles.get_alive_count();
+    CHECK(saturated < 10000);
+
+    particles.emit_drift_smoke({0.0f, 0.0f}, 500.0f);
+    CHECK(particles.get_alive_count() == saturated);
+}
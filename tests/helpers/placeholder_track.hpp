@@ -0,0 +1,45 @@
+/**
+ * @file placeholder_track.hpp
+ *
+ * @brief Shared fixtures for tests that build a Track without a GPU session.
+ */
+
+#pragma once
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include "core/world.hpp"
+
+namespace helpers {
+
+/**
+ * @brief Fixed RNG seed shared by the track and simulation fixtures, so every run builds the identical session.
+ */
+inline constexpr unsigned fixed_seed = 12345;
+
+/**
+ * @brief Fixed physics timestep matching the game's 120 Hz simulation rate, in seconds.
+ */
+inline constexpr float fixed_dt = 1.0f / 120.0f;
+
+/**
+ * @brief Build the placeholder track textures; never dereferenced, because these tests never draw.
+ *
+ * @param placeholder_texture Default-constructed texture shared by all tile regions; must outlive the returned struct.
+ *
+ * @return Textures struct usable for building a Track without a GPU session.
+ */
+[[nodiscard]] inline core::world::Track::Textures make_placeholder_tiles(const sf::Texture &placeholder_texture)
+{
+    return {
+        .top_left = {placeholder_texture, {}},
+        .top_right = {placeholder_texture, {}},
+        .bottom_right = {placeholder_texture, {}},
+        .bottom_left = {placeholder_texture, {}},
+        .vertical = {placeholder_texture, {}},
+        .horizontal = {placeholder_texture, {}},
+        .horizontal_finish = {placeholder_texture, {}},
+    };
+}
+
+}  // namespace helpers
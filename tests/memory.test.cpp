@@ -0,0 +1,56 @@
+/**
+ * @file memory.test.cpp
+ */
+
+#include <array>    // for std::array
+#include <cstddef>  // for std::size_t
+#include <cstring>  // for std::strcmp
+
+#include <snitch/snitch.hpp>
+
+#include "memory.hpp"
+
+TEST_CASE("Stats snapshot covers every subsystem tag", "[src][memory.hpp]")
+{
+    const std::array<core::memory::TagStats, core::memory::tag_count> stats = core::memory::get_stats();
+
+    // Names follow the tag order, so the overlay rows are stable across frames
+    CHECK(std::strcmp(stats[static_cast<std::size_t>(core::memory::Tag::World)].name, "world") == 0);
+    CHECK(std::strcmp(stats[static_cast<std::size_t>(core::memory::Tag::Entities)].name, "entities") == 0);
+    CHECK(std::strcmp(stats[static_cast<std::size_t>(core::memory::Tag::Widgets)].name, "widgets") == 0);
+    CHECK(std::strcmp(stats[static_cast<std::size_t>(core::memory::Tag::Sfx)].name, "sfx") == 0);
+    CHECK(std::strcmp(stats[static_cast<std::size_t>(core::memory::Tag::Assets)].name, "assets") == 0);
+
+    // Every subsystem has a budget, even in builds where tracking is compiled out
+    for (const core::memory::TagStats &entry : stats) {
+        CAPTURE(entry.name);
+        CHECK(entry.budget_bytes > 0);
+    }
+}
+
+TEST_CASE("Tracked vector records live and peak bytes", "[src][memory.hpp]")
+{
+    if constexpr (!core::memory::tracking_enabled) {
+        SKIP("tracking is compiled out; rebuild with ENABLE_MEMORY_TRACKING");
+    }
+
+    // Other containers in the process share these counters, so compare deltas instead of absolute values
+    const std::size_t live_before = core::memory::get_stats()[static_cast<std::size_t>(core::memory::Tag::Widgets)].live_bytes;
+
+    {
+        core::memory::TrackedVector<float, core::memory::Tag::Widgets> tracked;
+        tracked.resize(1024);
+
+        const core::memory::TagStats during = core::memory::get_stats()[static_cast<std::size_t>(core::memory::Tag::Widgets)];
+        CHECK(during.live_bytes >= live_before + 1024 * sizeof(float));
+        CHECK(during.peak_bytes >= during.live_bytes);
+    }
+
+    // The vector is gone, so its bytes must have been returned
+    const core::memory::TagStats after = core::memory::get_stats()[static_cast<std::size_t>(core::memory::Tag::Widgets)];
+    CHECK(after.live_bytes == live_before);
+
+    // The allocation above lands in the per-frame counter once the frame is latched
+    core::memory::end_frame();
+    CHECK(core::memory::get_stats()[static_cast<std::size_t>(core::memory::Tag::Widgets)].allocations_last_frame >= 1);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file performance.test.cpp
+ *
+ * @brief Timed regression tests for the hot paths, asserted against generous wall-clock budgets.
+ *
+ * These complement the microbenchmark suite: the benchmarks measure, these fail. The budgets are roughly an order of magnitude above what the slowest supported hardware needs, so they never flake on a loaded CI machine but still catch the "innocent change doubles the track rebuild" class of regression at merge time. If one of these fails, run the benchmarks executable to find out where the time went.
+ */
+
+#include <chrono>   // for std::chrono
+#include <cstddef>  // for std::size_t
+
+#include <snitch/snitch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "core/world.hpp"
+#include "game/entities.hpp"
+#include "helpers/placeholder_track.hpp"
+#include "rng.hpp"
+
+namespace {
+
+/**
+ * @brief Measure the wall-clock time of the provided callable, in milliseconds.
+ *
+ * @param work Callable to time.
+ *
+ * @return Elapsed time in milliseconds.
+ */
+[[nodiscard]] float time_ms(const auto &work)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    work();
+    const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+}  // namespace
+
+TEST_CASE("Track build for a 20x20 config stays within budget", "[performance]")
+{
+    const sf::Texture placeholder_texture;
+    const core::world::Track::Textures tiles = helpers::make_placeholder_tiles(placeholder_texture);
+
+    // A 20x20 grid is well past the default 7x7, so this covers the full generation pipeline (tiles, collision data, waypoints, distance field, progress grid) at stress-test scale
+    const float elapsed_ms = time_ms([&]() {
+        core::rng::Pcg32 rng{helpers::fixed_seed};
+        const core::world::Track track{tiles, rng, {.horizontal_count = 20, .vertical_count = 20}};
+        CHECK(!track.get_waypoints().empty());
+    });
+
+    CAPTURE(elapsed_ms);
+    CHECK(elapsed_ms < 2000.0f);
+}
+
+TEST_CASE("Boundary queries stay within budget", "[performance]")
+{
+    const sf::Texture placeholder_texture;
+    const core::world::Track::Textures tiles = helpers::make_placeholder_tiles(placeholder_texture);
+    core::rng::Pcg32 rng{helpers::fixed_seed};
+    const core::world::Track track{tiles, rng};
+
+    // One hit and one miss per iteration, matching the per-car-per-tick usage pattern
+    const sf::Vector2f on_track_point = track.get_finish_position();
+    constexpr sf::Vector2f off_track_point = {-1.0e6f, -1.0e6f};
+    std::size_t hits = 0;
+    const float elapsed_ms = time_ms([&]() {
+        for (std::size_t i = 0; i < 10'000; ++i) {
+            hits += track.is_on_track(on_track_point) ? 1 : 0;
+            hits += track.is_on_track(off_track_point) ? 1 : 0;
+        }
+    });
+    CHECK(hits == 10'000);
+
+    CAPTURE(elapsed_ms);
+    CHECK(elapsed_ms < 50.0f);
+}
+
+TEST_CASE("1000 physics steps for a full grid stay within budget", "[performance]")
+{
+    const sf::Texture placeholder_texture;
+    const core::world::Track::Textures tiles = helpers::make_placeholder_tiles(placeholder_texture);
+    core::rng::Pcg32 rng{helpers::fixed_seed};
+    const core::world::Track track{tiles, rng};
+
+    // 16 AI cars covers physics, steering, waypoint tracking, and collision resolution; 1000 steps is ~8 seconds of simulated time
+    game::entities::CarPhysicsSystem car_physics{rng, track};
+    for (std::size_t i = 0; i < 16; ++i) {
+        static_cast<void>(car_physics.create_car(game::entities::CarControlMode::AI));
+    }
+
+    const float elapsed_ms = time_ms([&]() {
+        for (std::size_t step = 0; step < 1000; ++step) {
+            car_physics.update(helpers::fixed_dt);
+        }
+    });
+
+    CAPTURE(elapsed_ms);
+    CHECK(elapsed_ms < 1000.0f);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file rng.test.cpp
+ */
+
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint32_t
+
+#include <snitch/snitch.hpp>
+
+#include "rng.hpp"
+
+TEST_CASE("Pcg32 is deterministic for the same seed and stream", "[src][rng.hpp]")
+{
+    core::rng::Pcg32 first{42};
+    core::rng::Pcg32 second{42};
+    for (std::size_t i = 0; i < 100; ++i) {
+        REQUIRE(first.next() == second.next());
+    }
+}
+
+TEST_CASE("Pcg32 streams with the same seed diverge", "[src][rng.hpp]")
+{
+    core::rng::Pcg32 first{42, 0};
+    core::rng::Pcg32 second{42, 1};
+
+    // Different streams share the seed but must not produce the same sequence
+    std::size_t matches = 0;
+    for (std::size_t i = 0; i < 100; ++i) {
+        if (first.next() == second.next()) {
+            ++matches;
+        }
+    }
+    CHECK(matches < 100);
+}
+
+TEST_CASE("Pcg32 uniform stays within the half-open range", "[src][rng.hpp]")
+{
+    core::rng::Pcg32 rng{123};
+    for (std::size_t i = 0; i < 1000; ++i) {
+        const float value = rng.uniform(-2.5f, 7.5f);
+        CHECK(value >= -2.5f);
+        CHECK(value < 7.5f);
+    }
+}
+
+TEST_CASE("Pcg32 bounded stays below the bound and hits every bucket", "[src][rng.hpp]")
+{
+    core::rng::Pcg32 rng{7};
+    constexpr std::size_t bucket_count = 4;
+    std::size_t hits[bucket_count] = {};
+    for (std::size_t i = 0; i < 1000; ++i) {
+        const std::size_t index = rng.bounded(bucket_count);
+        REQUIRE(index < bucket_count);
+        ++hits[index];
+    }
+
+    // With 1000 draws over 4 buckets, every bucket must have been hit
+    for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        CHECK(hits[bucket] > 0);
+    }
+}